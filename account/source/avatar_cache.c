@@ -0,0 +1,200 @@
+#include <stdlib.h>
+#include <string.h>
+#include <turbojpeg.h>
+
+#include "avatar_cache.h"
+#include "jpeg_thumb.h"
+
+#define AVATAR_PIXELS (AVATAR_CACHE_SIZE * AVATAR_CACHE_SIZE)
+
+static bool uidEqual(AccountUid a, AccountUid b)
+{
+    return a.uid[0] == b.uid[0] && a.uid[1] == b.uid[1];
+}
+
+typedef struct {
+    tjhandle tj;
+    u8* jpeg;
+    u32 jpeg_capacity;
+    u32 pixels[AVATAR_PIXELS];    // Decoded outside of the lock
+} RefreshContext;
+
+// Loads the avatar of one profile into r->pixels
+static bool loadAvatar(RefreshContext* r, AccountProfile* profile)
+{
+    u32 size = 0;
+    if (R_FAILED(accountProfileGetImageSize(profile, &size)) || !size)
+        return false;
+    if (size > r->jpeg_capacity) {
+        u8* jpeg = (u8*)realloc(r->jpeg, size);
+        if (!jpeg)
+            return false;
+        r->jpeg = jpeg;
+        r->jpeg_capacity = size;
+    }
+    if (R_FAILED(accountProfileLoadImage(profile, r->jpeg, r->jpeg_capacity, &size)))
+        return false;
+    return jpegDecodeThumbnail(r->tj, r->jpeg, size, r->pixels, AVATAR_CACHE_SIZE);
+}
+
+static int findSlot(AvatarCache* c, AccountUid uid)
+{
+    for (int i = 0; i < ACCOUNT_MAX_USERS; i++) {
+        if (accountUidIsValid(&c->slots[i].uid) && uidEqual(c->slots[i].uid, uid))
+            return i;
+    }
+    return -1;
+}
+
+static int findFreeSlot(AvatarCache* c)
+{
+    for (int i = 0; i < ACCOUNT_MAX_USERS; i++) {
+        if (!accountUidIsValid(&c->slots[i].uid))
+            return i;
+    }
+    return -1;
+}
+
+// Only this thread writes the slots: it reads them without the lock
+static void refreshAll(AvatarCache* c, RefreshContext* r)
+{
+    u64 start = armGetSystemTick();
+    AccountUid uids[ACCOUNT_MAX_USERS];
+    s32 count = 0;
+    if (R_FAILED(accountListAllUsers(uids, ACCOUNT_MAX_USERS, &count)))
+        return;
+
+    // Slots of the users which were deleted are freed first, so that new users can take them
+    avatarCacheLock(c);
+    for (int i = 0; i < ACCOUNT_MAX_USERS; i++) {
+        bool found = false;
+        for (s32 j = 0; j < count && !found; j++)
+            found = uidEqual(c->slots[i].uid, uids[j]);
+        if (!found && accountUidIsValid(&c->slots[i].uid)) {
+            memset(&c->slots[i], 0, sizeof(c->slots[i]));
+            c->generation++;
+        }
+    }
+    avatarCacheUnlock(c);
+
+    for (s32 j = 0; j < count; j++) {
+        AccountProfile profile;
+        AccountProfileBase base;
+        if (R_FAILED(accountGetProfile(&profile, uids[j])))
+            continue;
+
+        int slot = findSlot(c, uids[j]);
+        bool ok = R_SUCCEEDED(accountProfileGet(&profile, NULL, &base));
+        // The common case: nothing changed since the last refresh, so no image is loaded
+        if (ok && slot >= 0 && c->slots[slot].ready && c->slots[slot].last_edit_timestamp == base.last_edit_timestamp) {
+            accountProfileClose(&profile);
+            continue;
+        }
+        ok = ok && loadAvatar(r, &profile);
+        accountProfileClose(&profile);
+        if (!ok)
+            continue;
+
+        avatarCacheLock(c);
+        if (slot < 0)
+            slot = findFreeSlot(c);
+        if (slot >= 0) {
+            AvatarSlot* s = &c->slots[slot];
+            u32 x, y;
+            avatarCacheSlotOrigin(slot, &x, &y);
+            for (u32 row = 0; row < AVATAR_CACHE_SIZE; row++)
+                memcpy(c->atlas + (y + row) * AVATAR_CACHE_WIDTH + x, r->pixels + row * AVATAR_CACHE_SIZE,
+                    AVATAR_CACHE_SIZE * 4);
+            s->uid = uids[j];
+            s->last_edit_timestamp = base.last_edit_timestamp;
+            memset(s->nickname, 0, sizeof(s->nickname));
+            strncpy(s->nickname, base.nickname, sizeof(s->nickname) - 1);
+            s->ready = true;
+            s->generation++;
+            c->generation++;
+            c->decodes++;
+        }
+        avatarCacheUnlock(c);
+    }
+
+    avatarCacheLock(c);
+    c->refreshes++;
+    c->last_refresh_ns = armTicksToNs(armGetSystemTick() - start);
+    avatarCacheUnlock(c);
+}
+
+static void avatarThread(void* arg)
+{
+    AvatarCache* c = (AvatarCache*)arg;
+    RefreshContext* r = (RefreshContext*)calloc(1, sizeof(RefreshContext));
+    if (r)
+        r->tj = tjInitDecompress();
+
+    for (;;) {
+        waitSingle(waiterForUEvent(&c->wake), UINT64_MAX);
+        if (__atomic_load_n(&c->exiting, __ATOMIC_ACQUIRE))
+            break;
+        if (r && r->tj)
+            refreshAll(c, r);
+    }
+
+    if (r) {
+        if (r->tj)
+            tjDestroy(r->tj);
+        free(r->jpeg);
+        free(r);
+    }
+}
+
+Result avatarCacheInit(AvatarCache* c)
+{
+    memset(c, 0, sizeof(*c));
+    mutexInit(&c->lock);
+    ueventCreate(&c->wake, true);
+
+    c->atlas = (u32*)aligned_alloc(64, AVATAR_CACHE_WIDTH * AVATAR_CACHE_HEIGHT * 4);
+    if (!c->atlas)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    // Transparent until the avatars are loaded
+    memset(c->atlas, 0, AVATAR_CACHE_WIDTH * AVATAR_CACHE_HEIGHT * 4);
+
+    // Below the priority of the main thread, so that refreshing never delays a frame
+    Result rc = threadCreate(&c->thread, avatarThread, c, NULL, 0x8000, 0x2D, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&c->thread);
+        if (R_FAILED(rc))
+            threadClose(&c->thread);
+    }
+    if (R_FAILED(rc)) {
+        free(c->atlas);
+        c->atlas = NULL;
+    }
+    return rc;
+}
+
+void avatarCacheExit(AvatarCache* c)
+{
+    if (!c->atlas)
+        return;
+    __atomic_store_n(&c->exiting, true, __ATOMIC_RELEASE);
+    ueventSignal(&c->wake);
+    threadWaitForExit(&c->thread);
+    threadClose(&c->thread);
+    free(c->atlas);
+    c->atlas = NULL;
+}
+
+void avatarCacheRefresh(AvatarCache* c)
+{
+    ueventSignal(&c->wake);
+}
+
+int avatarCacheFind(AvatarCache* c, AccountUid uid)
+{
+    avatarCacheLock(c);
+    int slot = findSlot(c, uid);
+    if (slot >= 0 && !c->slots[slot].ready)
+        slot = -1;
+    avatarCacheUnlock(c);
+    return slot;
+}
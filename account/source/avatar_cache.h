@@ -0,0 +1,82 @@
+#pragma once
+#include <switch.h>
+
+// Profile pictures of all the user accounts, decoded once into a shared RGBA8 atlas.
+//
+// Loading an avatar is two IPC calls (accountProfileGetImageSize, accountProfileLoadImage) and the decode of a
+// 256x256 JPEG: a user selection screen can't afford that whenever it redraws. Here a background thread does it once
+// per user, and again only when the profile changed, which it tells from the last edit timestamp of the profile (one
+// small accountProfileGet call). Images are decoded at AVATAR_CACHE_SIZE with the IDCT scaling of libjpeg-turbo.
+//
+// The atlas is a single texture of AVATAR_CACHE_COLUMNS x AVATAR_CACHE_ROWS slots, one per user, rows tightly packed.
+// Each slot is written whole under the lock, and the generation of the atlas and of the slot is bumped: a renderer
+// uploads the atlas (or just the slots which changed) when the generation it last uploaded is behind, and draws
+// avatars as sub-rectangles of it.
+//
+// avatarCacheRefresh only wakes the thread, and returns right away: call it when the screen opens, or when a
+// notification says that an account changed. Until an avatar is ready, its slot is -1.
+//
+// Usage:
+//     AvatarCache c;
+//     avatarCacheInit(&c);            // acc must be initialized
+//     avatarCacheRefresh(&c);
+//     each frame: if (c.generation != uploaded) { avatarCacheLock; upload c.atlas; avatarCacheUnlock; }
+//                 slot = avatarCacheFind(&c, uid); draw the slot's rectangle
+//     avatarCacheExit(&c);
+
+#define AVATAR_CACHE_SIZE 64
+#define AVATAR_CACHE_COLUMNS 4
+#define AVATAR_CACHE_ROWS ((ACCOUNT_MAX_USERS + AVATAR_CACHE_COLUMNS - 1) / AVATAR_CACHE_COLUMNS)
+#define AVATAR_CACHE_WIDTH (AVATAR_CACHE_SIZE * AVATAR_CACHE_COLUMNS)
+#define AVATAR_CACHE_HEIGHT (AVATAR_CACHE_SIZE * AVATAR_CACHE_ROWS)
+
+typedef struct {
+    AccountUid uid;
+    u64 last_edit_timestamp;      // Of the profile the avatar was decoded from
+    u32 generation;               // Bumped when the slot is written
+    bool ready;
+    char nickname[0x21];
+} AvatarSlot;
+
+typedef struct {
+    u32* atlas;                   // AVATAR_CACHE_WIDTH x AVATAR_CACHE_HEIGHT, RGBA8
+    AvatarSlot slots[ACCOUNT_MAX_USERS];
+    u32 generation;               // Bumped when any slot is written
+    Mutex lock;
+
+    // Statistics
+    u32 refreshes;
+    u32 decodes;
+    u64 last_refresh_ns;
+
+    Thread thread;
+    UEvent wake;
+    bool exiting;
+} AvatarCache;
+
+Result avatarCacheInit(AvatarCache* c);
+void avatarCacheExit(AvatarCache* c);
+
+// Asks the background thread to check the profiles for changes
+void avatarCacheRefresh(AvatarCache* c);
+
+// Slot of a user, -1 if the avatar isn't loaded yet
+int avatarCacheFind(AvatarCache* c, AccountUid uid);
+
+// Held while reading the atlas or the slots
+static inline void avatarCacheLock(AvatarCache* c)
+{
+    mutexLock(&c->lock);
+}
+
+static inline void avatarCacheUnlock(AvatarCache* c)
+{
+    mutexUnlock(&c->lock);
+}
+
+// Top-left pixel of a slot in the atlas
+static inline void avatarCacheSlotOrigin(int slot, u32* x, u32* y)
+{
+    *x = (slot % AVATAR_CACHE_COLUMNS) * AVATAR_CACHE_SIZE;
+    *y = (slot / AVATAR_CACHE_COLUMNS) * AVATAR_CACHE_SIZE;
+}
@@ -3,7 +3,30 @@
 
 #include <switch.h>
 
+#include "avatar_cache.h"
+
 //This example shows how to get info for the preselected user account. See libnx acc.h.
+//It also keeps the profile pictures of all the accounts decoded in an AvatarCache (see avatar_cache.h), as a user selection screen would: press A to refresh it, only the profiles edited since the last refresh get their image loaded and decoded again.
+
+static void printAvatars(AvatarCache* cache)
+{
+    avatarCacheLock(cache);
+    printf("\x1b[8;1HAvatar atlas: %ux%u, generation %u\x1b[K\n", AVATAR_CACHE_WIDTH, AVATAR_CACHE_HEIGHT, cache->generation);
+    printf("%u refreshes, %u decodes, last refresh took %lu us\x1b[K\n\n", cache->refreshes, cache->decodes, cache->last_refresh_ns / 1000);
+    for (int i = 0; i < ACCOUNT_MAX_USERS; i++) {
+        const AvatarSlot* s = &cache->slots[i];
+        if (s->ready) {
+            u32 x, y;
+            avatarCacheSlotOrigin(i, &x, &y);
+            //The first pixel of the avatar, to show that it was decoded
+            printf("Slot %d at %3u,%3u: %-16s edited %lu, pixel %08X\x1b[K\n", i, x, y, s->nickname, s->last_edit_timestamp, cache->atlas[y * AVATAR_CACHE_WIDTH + x]);
+        }
+        else {
+            printf("Slot %d: empty\x1b[K\n", i);
+        }
+    }
+    avatarCacheUnlock(cache);
+}
 
 int main(int argc, char **argv)
 {
@@ -13,6 +36,8 @@ int main(int argc, char **argv)
     AccountProfile profile;
     AccountUserData userdata;
     AccountProfileBase profilebase;
+    AvatarCache cache;
+    bool account_initialized = false, cache_started = false;
 
     char nickname[0x21];
 
@@ -25,8 +50,21 @@ int main(int argc, char **argv)
     if (R_FAILED(rc)) {
         printf("accountInitialize() failed: 0x%x\n", rc);
     }
+    else {
+        account_initialized = true;
+    }
 
     if (R_SUCCEEDED(rc)) {
+        //Started first, so that the avatars load while the rest of the UI is set up
+        Result rc2 = avatarCacheInit(&cache);
+        if (R_FAILED(rc2)) {
+            printf("avatarCacheInit() failed: 0x%x\n", rc2);
+        }
+        else {
+            cache_started = true;
+            avatarCacheRefresh(&cache);
+        }
+
         rc = accountGetPreselectedUser(&userID);
 
         if (R_FAILED(rc)) {
@@ -55,14 +93,12 @@ int main(int argc, char **argv)
                 strncpy(nickname, profilebase.nickname, sizeof(nickname)-1);//Copy the nickname elsewhere to make sure it's NUL-terminated.
 
                 printf("Nickname: %s\n", nickname);//Note that the print-console doesn't support UTF-8. The nickname is UTF-8, so this will only display properly if there isn't any non-ASCII characters. To display it properly, a print method which supports UTF-8 should be used instead.
-
-                //You can also use accountProfileGetImageSize()/accountProfileLoadImage() to load the icon for use with a JPEG library, for displaying the user profile icon. See libnx acc.h.
             }
 
             accountProfileClose(&profile);
         }
 
-        accountExit();
+        printf("Press A to refresh the avatars\n");
     }
 
     // Main loop
@@ -76,9 +112,21 @@ int main(int argc, char **argv)
 
         if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
 
+        if (cache_started) {
+            //Returns right away, the refresh happens in the background
+            if (kDown & KEY_A) avatarCacheRefresh(&cache);
+
+            //Redrawn every frame: reading the cache costs no IPC and no decoding
+            printAvatars(&cache);
+        }
+
         consoleUpdate(NULL);
     }
 
+    //The cache thread uses the account service, so it's stopped before accountExit
+    if (cache_started) avatarCacheExit(&cache);
+    if (account_initialized) accountExit();
+
     consoleExit(NULL);
     return 0;
 }
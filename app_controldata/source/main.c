@@ -4,68 +4,65 @@
 
 #include <switch.h>
 
+#include "title_meta.h"
+
 //This example shows how to get NsApplicationControlData for an application, which contains nacp/icon. See libnx ns.h.
+//nsGetApplicationControlData returns the nacp and the JPEG icon of one application per call, and a launcher needs them for every installed title: title_meta.c fetches them all on a loader thread and the job system, decodes the icons to 64x64 RGBA8, and keeps them in a cache on sdmc so that the next launch only fetches the titles which were installed or updated since.
+
+#define LIST_LINES 30
+
+static void printTitles(const TitleMetaLoader* l)
+{
+    u32 done = __atomic_load_n(&l->done, __ATOMIC_ACQUIRE);
+    u32 fetched = __atomic_load_n(&l->fetched, __ATOMIC_RELAXED);
+    u64 end_tick = __atomic_load_n(&l->end_tick, __ATOMIC_RELAXED);
+    printf("\x1b[1;1H%u/%u titles, %u fetched, %u from the cache", done, l->count, fetched, done - fetched);
+    if (end_tick)
+        printf(", in %lu ms", armTicksToNs(end_tick - l->start_tick) / 1000000);
+    printf("\x1b[K\n\n");
+
+    //Entries are drawn as they become ready, in the order of the list rather than the order they're loaded in
+    for (u32 i = 0; i < l->count && i < LIST_LINES; i++) {
+        const TitleMeta* t = &l->titles[i];
+        printf("%016lX ", t->application_id);
+        if (titleMetaIsReady(t))
+            //The print-console doesn't support UTF-8: names with non-ASCII characters won't display properly
+            printf("v%-8u %s%s %.40s", t->version, t->cached ? "C" : " ", t->has_icon ? "I" : " ", t->name);
+        else if (t->state == TitleMetaState_Failed)
+            printf("failed");
+        else
+            printf("...");
+        printf("\x1b[K\n");
+    }
+}
 
 int main(int argc, char **argv)
 {
     Result rc=0;
-
-    u64 application_id=0x01007ef00011e000;//ApplicationId for use with nsGetApplicationControlData, in this case BOTW.
-    NsApplicationControlData *buf=NULL;
-    u64 outsize=0;
-
-    NacpLanguageEntry *langentry = NULL;
-    char name[0x201];
+    TitleMetaLoader loader;
+    bool ns_initialized = false, started = false;
 
     consoleInit(NULL);
 
-    buf = (NsApplicationControlData*)malloc(sizeof(NsApplicationControlData));
-    if (buf==NULL) {
-        rc = MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
-        printf("Failed to alloc mem.\n");
+    rc = nsInitialize();
+    if (R_FAILED(rc)) {
+        printf("nsInitialize() failed: 0x%x\n", rc);
     }
     else {
-        memset(buf, 0, sizeof(NsApplicationControlData));
+        ns_initialized = true;
     }
 
     if (R_SUCCEEDED(rc)) {
-        rc = nsInitialize();
+        rc = titleMetaStart(&loader, TITLE_META_CACHE_PATH);
         if (R_FAILED(rc)) {
-            printf("nsInitialize() failed: 0x%x\n", rc);
+            printf("titleMetaStart() failed: 0x%x\n", rc);
         }
-    }
-
-    if (R_SUCCEEDED(rc)) {
-        rc = nsGetApplicationControlData(NsApplicationControlSource_Storage, application_id, buf, sizeof(NsApplicationControlData), &outsize);
-        if (R_FAILED(rc)) {
-            printf("nsGetApplicationControlData() failed: 0x%x\n", rc);
+        else {
+            started = true;
+            consoleClear();
         }
-
-        if (outsize < sizeof(buf->nacp)) {
-            rc = -1;
-            printf("Outsize is too small: 0x%lx.\n", outsize);
-        }
-
-        if (R_SUCCEEDED(rc)) {
-            rc = nacpGetLanguageEntry(&buf->nacp, &langentry);
-
-            if (R_FAILED(rc) || langentry==NULL) printf("Failed to load LanguageEntry.\n");
-        }
-
-        if (R_SUCCEEDED(rc)) {
-            memset(name, 0, sizeof(name));
-            strncpy(name, langentry->name, sizeof(name)-1);//Don't assume the nacp string is NUL-terminated for safety.
-
-            printf("Name: %s\n", name);//Note that the print-console doesn't support UTF-8. The name is UTF-8, so this will only display properly if there isn't any non-ASCII characters. To display it properly, a print method which supports UTF-8 should be used instead.
-
-            //You could also load the JPEG icon from buf->nacp.icon. The icon size can be calculated with: iconsize = outsize - sizeof(buf->nacp);
-        }
-
-        nsExit();
     }
 
-    free(buf);
-
     // Main loop
     while(appletMainLoop())
     {
@@ -77,9 +74,16 @@ int main(int argc, char **argv)
 
         if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
 
+        //The list is shown from the first frame, the loader fills it in
+        if (started) printTitles(&loader);
+
         consoleUpdate(NULL);
     }
 
+    //Waits for the loader if it's still running: the cache is only written once all the titles are loaded
+    if (started) titleMetaStop(&loader);
+    if (ns_initialized) nsExit();
+
     consoleExit(NULL);
     return 0;
 }
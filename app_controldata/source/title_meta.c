@@ -0,0 +1,328 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <turbojpeg.h>
+
+#include "title_meta.h"
+#include "perf.h"
+#include "jpeg_thumb.h"
+
+#define CACHE_MAGIC 0x4D4C5454 // "TTLM"
+#define CACHE_FORMAT 1
+#define ICON_BYTES (TITLE_META_ICON_SIZE * TITLE_META_ICON_SIZE * 4)
+#define LIST_PAGE 64
+#define JOB_GRAIN 4
+
+typedef struct {
+    u32 magic;
+    u32 format;
+    u64 language;                 // Names are in this language
+    u32 count;
+    u32 icon_size;
+} CacheHeader;
+
+// Followed by the name, the author, and ICON_BYTES of icon if has_icon
+typedef struct {
+    u64 application_id;
+    u32 version;
+    u16 name_len;
+    u16 author_len;
+    u32 has_icon;
+    u32 reserved;
+} CacheRecord;
+
+struct TitleMetaCacheEntry {
+    u64 application_id;
+    u32 version;
+    u32 offset;                   // Of the record in cache_data
+};
+
+static int compareEntries(const void* a, const void* b)
+{
+    u64 x = ((const struct TitleMetaCacheEntry*)a)->application_id;
+    u64 y = ((const struct TitleMetaCacheEntry*)b)->application_id;
+    return x < y ? -1 : x > y;
+}
+
+//---------------------------------------------------------------------------------
+// Cache file
+//---------------------------------------------------------------------------------
+static void loadCache(TitleMetaLoader* l)
+{
+    FILE* f = fopen(l->cache_path, "rb");
+    if (!f)
+        return;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    CacheHeader hdr;
+    if (size < (long)sizeof(hdr) || fread(&hdr, sizeof(hdr), 1, f) != 1 || hdr.magic != CACHE_MAGIC
+        || hdr.format != CACHE_FORMAT || hdr.language != l->language || hdr.icon_size != TITLE_META_ICON_SIZE) {
+        fclose(f);
+        return;
+    }
+
+    size -= sizeof(hdr);
+    l->cache_data = (u8*)malloc(size);
+    l->cache_index = (struct TitleMetaCacheEntry*)malloc(hdr.count * sizeof(struct TitleMetaCacheEntry));
+    bool ok = l->cache_data && l->cache_index && fread(l->cache_data, 1, size, f) == (size_t)size;
+    fclose(f);
+
+    // Stops at the first record which doesn't fit, the ones before it are still used
+    u32 offset = 0;
+    for (u32 i = 0; ok && i < hdr.count; i++) {
+        CacheRecord rec;
+        if (offset + sizeof(rec) > (u32)size)
+            break;
+        memcpy(&rec, l->cache_data + offset, sizeof(rec));
+        u32 rec_size = sizeof(rec) + rec.name_len + rec.author_len + (rec.has_icon ? ICON_BYTES : 0);
+        if (rec.name_len > 0x200 || rec.author_len > 0x100 || offset + rec_size > (u32)size)
+            break;
+
+        l->cache_index[l->cache_count].application_id = rec.application_id;
+        l->cache_index[l->cache_count].version = rec.version;
+        l->cache_index[l->cache_count].offset = offset;
+        l->cache_count++;
+        offset += rec_size;
+    }
+
+    qsort(l->cache_index, l->cache_count, sizeof(struct TitleMetaCacheEntry), compareEntries);
+}
+
+static bool loadFromCache(const TitleMetaLoader* l, TitleMeta* t)
+{
+    struct TitleMetaCacheEntry key = { .application_id = t->application_id };
+    const struct TitleMetaCacheEntry* e = (const struct TitleMetaCacheEntry*)bsearch(&key, l->cache_index,
+        l->cache_count, sizeof(key), compareEntries);
+    if (!e || e->version != t->version)
+        return false;
+
+    CacheRecord rec;
+    const u8* p = l->cache_data + e->offset;
+    memcpy(&rec, p, sizeof(rec));
+    p += sizeof(rec);
+    memcpy(t->name, p, rec.name_len);
+    t->name[rec.name_len] = 0;
+    p += rec.name_len;
+    memcpy(t->author, p, rec.author_len);
+    t->author[rec.author_len] = 0;
+    p += rec.author_len;
+    if (rec.has_icon)
+        memcpy(t->icon, p, ICON_BYTES);
+    t->has_icon = rec.has_icon;
+    return true;
+}
+
+static void writeCache(const TitleMetaLoader* l)
+{
+    // Written next to it and renamed, so that an interrupted write doesn't leave a truncated cache
+    char tmp_path[FS_MAX_PATH + 4];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", l->cache_path);
+    FILE* f = fopen(tmp_path, "wb");
+    if (!f)
+        return;
+
+    CacheHeader hdr = { CACHE_MAGIC, CACHE_FORMAT, l->language, 0, TITLE_META_ICON_SIZE };
+    for (u32 i = 0; i < l->count; i++)
+        hdr.count += l->titles[i].state == TitleMetaState_Ready;
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1;
+
+    for (u32 i = 0; ok && i < l->count; i++) {
+        const TitleMeta* t = &l->titles[i];
+        if (t->state != TitleMetaState_Ready)
+            continue;
+        CacheRecord rec = { t->application_id, t->version, strlen(t->name), strlen(t->author), t->has_icon, 0 };
+        ok = fwrite(&rec, sizeof(rec), 1, f) == 1
+            && fwrite(t->name, 1, rec.name_len, f) == rec.name_len
+            && fwrite(t->author, 1, rec.author_len, f) == rec.author_len
+            && (!t->has_icon || fwrite(t->icon, ICON_BYTES, 1, f) == 1);
+    }
+
+    ok = fclose(f) == 0 && ok;
+    if (ok) {
+        remove(l->cache_path);
+        ok = rename(tmp_path, l->cache_path) == 0;
+    }
+    if (!ok)
+        remove(tmp_path);
+}
+
+//---------------------------------------------------------------------------------
+// Fetching
+//---------------------------------------------------------------------------------
+static u32 queryVersion(u64 application_id)
+{
+    // The base title and its update each have an entry: the update has the highest version
+    NsApplicationContentMetaStatus list[8];
+    s32 count = 0;
+    u32 version = 0;
+    if (R_SUCCEEDED(nsListApplicationContentMetaStatus(application_id, 0, list, 8, &count))) {
+        for (s32 i = 0; i < count; i++) {
+            if (list[i].version > version)
+                version = list[i].version;
+        }
+    }
+    return version;
+}
+
+typedef struct {
+    NsApplicationControlData* data;
+    tjhandle tj;
+} FetchContext;
+
+static bool fetchTitle(FetchContext* c, TitleMeta* t)
+{
+    // Only allocated once a title of the range misses the cache
+    if (!c->data && !(c->data = (NsApplicationControlData*)malloc(sizeof(NsApplicationControlData))))
+        return false;
+
+    u64 size = 0;
+    Result rc = nsGetApplicationControlData(NsApplicationControlSource_Storage, t->application_id, c->data,
+        sizeof(NsApplicationControlData), &size);
+    if (R_FAILED(rc) || size < sizeof(c->data->nacp))
+        return false;
+
+    NacpLanguageEntry* entry = NULL;
+    if (R_FAILED(nacpGetLanguageEntry(&c->data->nacp, &entry)) || !entry)
+        return false;
+    // The NACP strings aren't always NUL-terminated
+    strncpy(t->name, entry->name, sizeof(entry->name));
+    t->name[sizeof(entry->name)] = 0;
+    strncpy(t->author, entry->author, sizeof(entry->author));
+    t->author[sizeof(entry->author)] = 0;
+
+    if (!c->tj)
+        c->tj = tjInitDecompress();
+    u32 icon_size = size - sizeof(c->data->nacp);
+    t->has_icon = c->tj && icon_size && jpegDecodeThumbnail(c->tj, c->data->icon, icon_size, t->icon, TITLE_META_ICON_SIZE);
+    return true;
+}
+
+static void loadRange(void* arg, u32 begin, u32 end)
+{
+    TitleMetaLoader* l = (TitleMetaLoader*)arg;
+    FetchContext c = { NULL, NULL };
+
+    for (u32 i = begin; i < end; i++) {
+        TitleMeta* t = &l->titles[i];
+        t->version = queryVersion(t->application_id);
+
+        TitleMetaState state = TitleMetaState_Ready;
+        t->cached = loadFromCache(l, t);
+        if (!t->cached) {
+            if (!fetchTitle(&c, t))
+                state = TitleMetaState_Failed;
+            __atomic_add_fetch(&l->fetched, 1, __ATOMIC_RELAXED);
+        }
+
+        __atomic_store_n(&t->state, state, __ATOMIC_RELEASE);
+        __atomic_add_fetch(&l->done, 1, __ATOMIC_RELEASE);
+    }
+
+    free(c.data);
+    if (c.tj)
+        tjDestroy(c.tj);
+}
+
+static void loaderThread(void* arg)
+{
+    TitleMetaLoader* l = (TitleMetaLoader*)arg;
+    loadCache(l);
+
+    // Job system workers take the other cores; if they can't be started, this thread does it all
+    l->rc = jobSystemInit();
+    if (R_SUCCEEDED(l->rc)) {
+        jobParallelFor(l->count, JOB_GRAIN, loadRange, l);
+        jobSystemExit();
+    }
+    else
+        loadRange(l, 0, l->count);
+    __atomic_store_n(&l->end_tick, armGetSystemTick(), __ATOMIC_RELAXED);
+
+    // Rewritten on updates and new titles, and to drop the titles which were removed
+    if (l->fetched || l->cache_count != l->count)
+        writeCache(l);
+
+    free(l->cache_data);
+    free(l->cache_index);
+    l->cache_data = NULL;
+    l->cache_index = NULL;
+}
+
+//---------------------------------------------------------------------------------
+// API
+//---------------------------------------------------------------------------------
+static Result listTitles(TitleMetaLoader* l)
+{
+    NsApplicationRecord* records = (NsApplicationRecord*)malloc(TITLE_META_MAX_TITLES * sizeof(NsApplicationRecord));
+    if (!records)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+
+    Result rc = 0;
+    s32 count = 0, got = LIST_PAGE;
+    while (R_SUCCEEDED(rc) && got == LIST_PAGE && count + LIST_PAGE <= TITLE_META_MAX_TITLES) {
+        rc = nsListApplicationRecord(records + count, LIST_PAGE, count, &got);
+        if (R_SUCCEEDED(rc))
+            count += got;
+    }
+
+    if (R_SUCCEEDED(rc) && count) {
+        l->titles = (TitleMeta*)calloc(count, sizeof(TitleMeta));
+        l->icons = (u32*)aligned_alloc(64, (size_t)count * ICON_BYTES);
+        if (!l->titles || !l->icons)
+            rc = MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    }
+    if (R_SUCCEEDED(rc)) {
+        for (s32 i = 0; i < count; i++) {
+            l->titles[i].application_id = records[i].application_id;
+            l->titles[i].icon = l->icons + (size_t)i * TITLE_META_ICON_SIZE * TITLE_META_ICON_SIZE;
+        }
+        l->count = count;
+    }
+
+    free(records);
+    return rc;
+}
+
+Result titleMetaStart(TitleMetaLoader* l, const char* cache_path)
+{
+    memset(l, 0, sizeof(*l));
+    l->start_tick = armGetSystemTick();
+    strncpy(l->cache_path, cache_path, sizeof(l->cache_path) - 1);
+
+    Result rc = setInitialize();
+    if (R_SUCCEEDED(rc)) {
+        rc = setGetSystemLanguage(&l->language);
+        setExit();
+    }
+
+    if (R_SUCCEEDED(rc))
+        rc = listTitles(l);
+    if (R_SUCCEEDED(rc))
+        rc = threadCreate(&l->thread, loaderThread, l, NULL, 0x10000, 0x2C, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&l->thread);
+        if (R_FAILED(rc))
+            threadClose(&l->thread);
+    }
+
+    if (R_FAILED(rc)) {
+        titleMetaStop(l);
+        return rc;
+    }
+    l->started = true;
+    return 0;
+}
+
+void titleMetaStop(TitleMetaLoader* l)
+{
+    if (l->started) {
+        threadWaitForExit(&l->thread);
+        threadClose(&l->thread);
+    }
+    free(l->titles);
+    free(l->icons);
+    memset(l, 0, sizeof(*l));
+}
@@ -7,8 +7,28 @@
 // Include the main libnx system header, for Switch development
 #include <switch.h>
 
+#include "play_stats.h"
+
 // This example shows how to use applet to get playstats for applications. See also libnx applet.h. See applet.h for the requirements for using this.
 // This also shows how to use pdmqry, see also libnx pdm.h.
+// play_stats.c builds per-title and per-user statistics from the pdmqry events: they're saved along with the last event read, so that each launch only reads the events logged since the previous one.
+
+// Prints the most played titles and the users, converting timestamps only for what is shown.
+static void printPlayStats(const PlayStats* stats)
+{
+    const PlayStatsTitle* top[10];
+    u32 count = playStatsSortedTitles(stats, top, sizeof(top)/sizeof(top[0]));
+
+    printf("%u titles, %lu events folded, %lu missed\n", stats->title_count, stats->events_folded, stats->missed_events);
+    for (u32 i=0; i<count; i++) {
+        time_t last = pdmPlayTimestampToPosix(top[i]->last_played);
+        printf("0x%016lX: %uh%02u, %u launches, last %s", top[i]->application_id, top[i]->play_minutes / 60, top[i]->play_minutes % 60, top[i]->launches, ctime(&last));
+    }
+    for (u32 i=0; i<stats->user_count; i++) {
+        const PlayStatsUser* user = &stats->users[i];
+        printf("user 0x%lx 0x%lx: %uh%02u, %u sessions\n", user->uid.uid[1], user->uid.uid[0], user->play_minutes / 60, user->play_minutes % 60, user->sessions);
+    }
+}
 
 /// Main program entrypoint
 int main(int argc, char* argv[])
@@ -29,6 +49,8 @@ int main(int argc, char* argv[])
     s32 total_out;
     s32 i;
     bool initflag=0;
+    PlayStats playstats_agg;
+    bool statsflag=0;
 
     // Only needed when using the cmds which require the Uid.
     AccountUid preselected_uid={0};
@@ -46,8 +68,22 @@ int main(int argc, char* argv[])
         if (R_SUCCEEDED(rc)) initflag = true;
     }
 
+    // Folds in the events since the last launch, and saves the statistics right away so that the next launch starts from here.
+    if (initflag) {
+        u32 new_events=0;
+        u64 start_tick = armGetSystemTick();
+        Result rc2 = playStatsLoad(&playstats_agg, PLAY_STATS_PATH);
+        if (R_SUCCEEDED(rc2)) {
+            statsflag = true;
+            rc2 = playStatsUpdate(&playstats_agg, &new_events);
+        }
+        if (R_SUCCEEDED(rc2)) rc2 = playStatsSave(&playstats_agg, PLAY_STATS_PATH);
+        printf("Play statistics: 0x%x, %u new events in %lu us\n", rc2, new_events, armTicksToNs(armGetSystemTick() - start_tick) / 1000);
+    }
+
     printf("Press A to get playstats.\n");
     if (initflag) printf("Press X to use pdmqry.\n");
+    if (statsflag) printf("Press Y to show the play statistics.\n");
     printf("Press + to exit.\n");
 
     // Main loop
@@ -137,10 +173,19 @@ int main(int argc, char* argv[])
             // For more cmds, see pdm.h.
         }
 
+        if (statsflag && (kDown & KEY_Y)) {
+            // Only the events logged while this was running are read
+            u32 new_events=0;
+            Result rc2 = playStatsUpdate(&playstats_agg, &new_events);
+            if (R_SUCCEEDED(rc2) && new_events) playStatsSave(&playstats_agg, PLAY_STATS_PATH);
+            printPlayStats(&playstats_agg);
+        }
+
         // Update the console, sending a new frame to the display
         consoleUpdate(NULL);
     }
 
+    if (statsflag) playStatsFree(&playstats_agg);
     pdmqryExit();
 
     // Deinitialize and clean up resources used by the console (important!)
@@ -0,0 +1,360 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "play_stats.h"
+
+#define SAVE_MAGIC 0x54534C50 // "PLST"
+#define SAVE_FORMAT 1
+#define FIRST_APPLICATION_ID 0x0100000000010000ULL // Lower program ids are system applets and modules
+#define MIN_TITLE_CAPACITY 64
+
+typedef struct {
+    u32 magic;
+    u32 format;
+    u32 title_count;
+    u32 user_count;
+    u64 focused_id;
+    u32 focused_since;
+    s32 next_applet_index;
+    s32 next_account_index;
+    u64 events_folded;
+    u64 missed_events;
+} SaveHeader;
+
+//---------------------------------------------------------------------------------
+// Aggregates
+//---------------------------------------------------------------------------------
+static u32 titleSlot(u64 application_id, u32 capacity)
+{
+    return (u32)((application_id * 0x9E3779B97F4A7C15ULL) >> 32) & (capacity - 1);
+}
+
+static bool growTitles(PlayStats* s)
+{
+    u32 capacity = s->title_capacity ? s->title_capacity * 2 : MIN_TITLE_CAPACITY;
+    PlayStatsTitle* titles = (PlayStatsTitle*)calloc(capacity, sizeof(PlayStatsTitle));
+    if (!titles)
+        return false;
+
+    for (u32 i = 0; i < s->title_capacity; i++) {
+        const PlayStatsTitle* t = &s->titles[i];
+        if (!t->application_id)
+            continue;
+        u32 slot = titleSlot(t->application_id, capacity);
+        while (titles[slot].application_id)
+            slot = (slot + 1) & (capacity - 1);
+        titles[slot] = *t;
+    }
+
+    free(s->titles);
+    s->titles = titles;
+    s->title_capacity = capacity;
+    return true;
+}
+
+static PlayStatsTitle* getTitle(PlayStats* s, u64 application_id)
+{
+    // Kept at most half full, so that probe sequences stay short
+    if ((s->title_count + 1) * 2 > s->title_capacity && !growTitles(s))
+        return NULL;
+
+    u32 slot = titleSlot(application_id, s->title_capacity);
+    while (s->titles[slot].application_id && s->titles[slot].application_id != application_id)
+        slot = (slot + 1) & (s->title_capacity - 1);
+
+    PlayStatsTitle* t = &s->titles[slot];
+    if (!t->application_id) {
+        t->application_id = application_id;
+        s->title_count++;
+    }
+    return t;
+}
+
+static PlayStatsUser* getUser(PlayStats* s, AccountUid uid)
+{
+    for (u32 i = 0; i < s->user_count; i++) {
+        if (s->users[i].uid.uid[0] == uid.uid[0] && s->users[i].uid.uid[1] == uid.uid[1])
+            return &s->users[i];
+    }
+    if (s->user_count == ACCOUNT_MAX_USERS)
+        return NULL;
+
+    // Users which were deleted keep their entry: there are few enough of them
+    PlayStatsUser* u = &s->users[s->user_count++];
+    memset(u, 0, sizeof(*u));
+    u->uid = uid;
+    return u;
+}
+
+static void endFocus(PlayStats* s, u32 timestamp)
+{
+    PlayStatsTitle* t = getTitle(s, s->focused_id);
+    if (t && timestamp >= s->focused_since) {
+        t->play_minutes += timestamp - s->focused_since;
+        t->last_played = timestamp;
+    }
+    s->focused_id = 0;
+}
+
+static void foldAppletEvent(PlayStats* s, const PdmAppletEvent* ev)
+{
+    if (ev->program_id < FIRST_APPLICATION_ID)
+        return;
+
+    u32 timestamp = ev->timestampUser;
+    switch (ev->eventType) {
+        case PdmAppletEventType_Launch: {
+            PlayStatsTitle* t = getTitle(s, ev->program_id);
+            if (t) {
+                t->launches++;
+                t->last_played = timestamp;
+            }
+            break;
+        }
+
+        case PdmAppletEventType_InFocus:
+            // Focus moved without an event for the title which had it
+            if (s->focused_id && s->focused_id != ev->program_id)
+                endFocus(s, timestamp);
+            if (s->focused_id != ev->program_id) {
+                s->focused_id = ev->program_id;
+                s->focused_since = timestamp;
+            }
+            break;
+
+        case PdmAppletEventType_OutOfFocus:
+        case PdmAppletEventType_OutOfFocus4:
+        case PdmAppletEventType_Exit:
+        case PdmAppletEventType_Exit5:
+        case PdmAppletEventType_Exit6:
+            if (s->focused_id == ev->program_id)
+                endFocus(s, timestamp);
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void foldAccountEvent(PlayStats* s, const PdmAccountEvent* ev)
+{
+    PlayStatsUser* u = getUser(s, ev->uid);
+    if (!u)
+        return;
+
+    u32 timestamp = (u32)ev->timestampUser;
+    bool was_open = u->open_since != 0;
+    if (was_open && timestamp >= u->open_since) {
+        u->play_minutes += timestamp - u->open_since;
+        u->last_played = timestamp;
+    }
+    u->open_since = 0;
+
+    if (ev->eventType == PdmAccountEventType_Open) {
+        u->sessions++;
+        u->open_since = timestamp;
+    }
+}
+
+//---------------------------------------------------------------------------------
+// Update
+//---------------------------------------------------------------------------------
+// The log is a ring: the events it dropped since the last update are lost. If it's behind the high-water mark, it
+// was cleared, and is read again from its start.
+// Returns how many events were dropped.
+static s32 clampIndex(s32* index, s32 start, s32 end)
+{
+    s32 dropped = 0;
+    if (*index < start) {
+        dropped = start - *index;
+        *index = start;
+    }
+    else if (*index > end + 1)
+        *index = start;
+    return dropped;
+}
+
+static Result foldAppletEvents(PlayStats* s, PdmAppletEvent* events, s32 end, u32* folded)
+{
+    Result rc = 0;
+    for (bool done = false; !done && s->next_applet_index <= end;) {
+        s32 count = 0;
+        rc = pdmqryQueryAppletEvent(s->next_applet_index, false, events, PLAY_STATS_BATCH, &count);
+        done = R_FAILED(rc) || count <= 0;
+        for (s32 i = 0; !done && i < count; i++) {
+            if ((s32)events[i].entry_index > end) {
+                done = true;
+                break;
+            }
+            foldAppletEvent(s, &events[i]);
+            s->next_applet_index = events[i].entry_index + 1;
+            (*folded)++;
+        }
+    }
+    return rc;
+}
+
+static Result foldAccountEvents(PlayStats* s, PdmAccountEvent* events, s32 end, u32* folded)
+{
+    Result rc = 0;
+    for (bool done = false; !done && s->next_account_index <= end;) {
+        s32 count = 0;
+        rc = pdmqryQueryAccountEvent(s->next_account_index, events, PLAY_STATS_BATCH, &count);
+        done = R_FAILED(rc) || count <= 0;
+        for (s32 i = 0; !done && i < count; i++) {
+            if ((s32)events[i].entry_index > end) {
+                done = true;
+                break;
+            }
+            foldAccountEvent(s, &events[i]);
+            s->next_account_index = events[i].entry_index + 1;
+            (*folded)++;
+        }
+    }
+    return rc;
+}
+
+Result playStatsUpdate(PlayStats* s, u32* new_events)
+{
+    if (new_events)
+        *new_events = 0;
+
+    s32 total = 0, start = 0, end = 0;
+    Result rc = pdmqryGetAvailablePlayEventRange(&total, &start, &end);
+    if (R_FAILED(rc) || total == 0)
+        return rc;
+    s32 dropped_applet = clampIndex(&s->next_applet_index, start, end);
+    s32 dropped_account = clampIndex(&s->next_account_index, start, end);
+    s->missed_events += dropped_applet > dropped_account ? dropped_applet : dropped_account;
+
+    size_t event_size = sizeof(PdmAppletEvent) > sizeof(PdmAccountEvent) ? sizeof(PdmAppletEvent) : sizeof(PdmAccountEvent);
+    void* buf = malloc(PLAY_STATS_BATCH * event_size);
+    if (!buf)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+
+    // Each stream's index only moves past the events folded in, so that a failed update is resumed by the next one
+    // without counting anything twice. Both stop at the end of the range read above: events logged meanwhile are left
+    // for the next update.
+    u32 folded = 0;
+    rc = foldAppletEvents(s, (PdmAppletEvent*)buf, end, &folded);
+    if (R_SUCCEEDED(rc))
+        rc = foldAccountEvents(s, (PdmAccountEvent*)buf, end, &folded);
+    free(buf);
+
+    if (R_SUCCEEDED(rc)) {
+        // Filtered out by the queries, the other events up to the end are done too
+        s->next_applet_index = s->next_account_index = end + 1;
+    }
+    s->events_folded += folded;
+    if (new_events)
+        *new_events = folded;
+    return rc;
+}
+
+static int compareTitles(const void* a, const void* b)
+{
+    const PlayStatsTitle* x = *(const PlayStatsTitle* const*)a;
+    const PlayStatsTitle* y = *(const PlayStatsTitle* const*)b;
+    return x->play_minutes > y->play_minutes ? -1 : x->play_minutes < y->play_minutes;
+}
+
+u32 playStatsSortedTitles(const PlayStats* s, const PlayStatsTitle** out, u32 max)
+{
+    const PlayStatsTitle** all = (const PlayStatsTitle**)malloc((s->title_count + 1) * sizeof(*all));
+    if (!all)
+        return 0;
+    u32 count = 0;
+    for (u32 i = 0; i < s->title_capacity; i++) {
+        if (s->titles[i].application_id)
+            all[count++] = &s->titles[i];
+    }
+    qsort(all, count, sizeof(*all), compareTitles);
+    if (count > max)
+        count = max;
+    memcpy(out, all, count * sizeof(*all));
+    free(all);
+    return count;
+}
+
+//---------------------------------------------------------------------------------
+// Persistence
+//---------------------------------------------------------------------------------
+Result playStatsLoad(PlayStats* s, const char* path)
+{
+    memset(s, 0, sizeof(*s));
+    if (!growTitles(s))
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+
+    FILE* f = fopen(path, "rb");
+    if (!f)
+        return 0;
+
+    SaveHeader hdr;
+    bool ok = fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == SAVE_MAGIC && hdr.format == SAVE_FORMAT
+        && hdr.user_count <= ACCOUNT_MAX_USERS;
+    for (u32 i = 0; ok && i < hdr.title_count; i++) {
+        PlayStatsTitle saved;
+        PlayStatsTitle* t = NULL;
+        ok = fread(&saved, sizeof(saved), 1, f) == 1 && saved.application_id && (t = getTitle(s, saved.application_id));
+        if (ok)
+            *t = saved;
+    }
+    ok = ok && fread(s->users, sizeof(PlayStatsUser), hdr.user_count, f) == hdr.user_count;
+    fclose(f);
+
+    // A file which can't be read is ignored: the statistics are rebuilt from the start of the log
+    if (!ok) {
+        playStatsFree(s);
+        memset(s, 0, sizeof(*s));
+        return growTitles(s) ? 0 : MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    }
+
+    s->user_count = hdr.user_count;
+    s->focused_id = hdr.focused_id;
+    s->focused_since = hdr.focused_since;
+    s->next_applet_index = hdr.next_applet_index;
+    s->next_account_index = hdr.next_account_index;
+    s->events_folded = hdr.events_folded;
+    s->missed_events = hdr.missed_events;
+    return 0;
+}
+
+Result playStatsSave(const PlayStats* s, const char* path)
+{
+    // Written next to it and renamed, so that an interrupted write leaves the previous statistics
+    char tmp_path[FS_MAX_PATH + 4];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+    FILE* f = fopen(tmp_path, "wb");
+    if (!f)
+        return MAKERESULT(Module_Libnx, LibnxError_NotFound);
+
+    SaveHeader hdr = {
+        SAVE_MAGIC, SAVE_FORMAT, s->title_count, s->user_count, s->focused_id, s->focused_since,
+        s->next_applet_index, s->next_account_index, s->events_folded, s->missed_events,
+    };
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1;
+    for (u32 i = 0; ok && i < s->title_capacity; i++) {
+        if (s->titles[i].application_id)
+            ok = fwrite(&s->titles[i], sizeof(PlayStatsTitle), 1, f) == 1;
+    }
+    ok = ok && fwrite(s->users, sizeof(PlayStatsUser), s->user_count, f) == s->user_count;
+    ok = fclose(f) == 0 && ok;
+
+    if (ok) {
+        remove(path);
+        ok = rename(tmp_path, path) == 0;
+    }
+    if (!ok) {
+        remove(tmp_path);
+        return MAKERESULT(Module_Libnx, LibnxError_IoError);
+    }
+    return 0;
+}
+
+void playStatsFree(PlayStats* s)
+{
+    free(s->titles);
+    s->titles = NULL;
+    s->title_capacity = s->title_count = 0;
+}
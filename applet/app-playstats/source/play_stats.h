@@ -0,0 +1,67 @@
+#pragma once
+#include <switch.h>
+
+// Play time statistics per title and per user, kept up to date incrementally from the pdm event log.
+//
+// The aggregates are folded from the events once, and saved with the entry index of the last event folded in (the
+// high-water mark): playStatsUpdate only queries the events logged after it, PLAY_STATS_BATCH per IPC call, so
+// opening the stats screen costs in proportion to what was played since it was last opened, not to the whole history.
+//
+// - Per title, from the applet events: launches, and the time spent in focus (from InFocus to the next OutOfFocus or
+//   Exit of the same program).
+// - Per user, from the account events: sessions, and the time the account was open.
+//
+// Timestamps stay in pdm's own unit (PdmPlayTimestamp, minutes since 1970) while folding: times are converted with
+// pdmPlayTimestampToPosix only when they're displayed, not once per event. A title in focus or a user account open
+// when the log ends is kept open in the saved state, and closed by the events of a later update.
+//
+// The pdm log is a ring: if it wrapped past the high-water mark since the last update, the events in between are lost,
+// which is counted in missed_events.
+
+#define PLAY_STATS_PATH "sdmc:/switch/app-playstats.bin"
+#define PLAY_STATS_BATCH 512
+
+typedef struct {
+    u64 application_id;
+    u32 launches;
+    u32 play_minutes;
+    u32 last_played;              // PdmPlayTimestamp
+} PlayStatsTitle;
+
+typedef struct {
+    AccountUid uid;
+    u32 sessions;
+    u32 play_minutes;
+    u32 open_since;               // PdmPlayTimestamp, 0 when closed
+    u32 last_played;
+} PlayStatsUser;
+
+typedef struct {
+    // Open addressing hash table on the application id, with a power of 2 capacity
+    PlayStatsTitle* titles;
+    u32 title_capacity;
+    u32 title_count;
+
+    PlayStatsUser users[ACCOUNT_MAX_USERS];
+    u32 user_count;
+
+    u64 focused_id;               // Title in focus at the high-water mark, 0 if none
+    u32 focused_since;
+
+    s32 next_applet_index;        // Entry index of the first event not folded in yet, per event stream
+    s32 next_account_index;
+    u64 events_folded;            // Since the statistics were created
+    u64 missed_events;
+} PlayStats;
+
+// Loads the saved statistics, or starts empty if there are none (or they can't be read)
+Result playStatsLoad(PlayStats* s, const char* path);
+Result playStatsSave(const PlayStats* s, const char* path);
+void playStatsFree(PlayStats* s);
+
+// Folds the events logged since the last update, pdmqry must be initialized. new_events is optional.
+Result playStatsUpdate(PlayStats* s, u32* new_events);
+
+// Fills out with pointers to the titles, most played first, returns how many. The pointers are valid until the next
+// update.
+u32 playStatsSortedTitles(const PlayStats* s, const PlayStatsTitle** out, u32 max);
@@ -5,10 +5,15 @@
 #include <inttypes.h>
 #include <switch.h>
 #include "sample_bin.h"
+#include "voice_pool.h"
+#include "audio_stats.h"
 
 // Sample comes from this website:
 // https://www.soundjay.com/magic-sound-effect.html
 
+// Metronome at 120 bpm, in samples of the clock of the pool
+#define BEAT_SAMPLES (VOICE_POOL_SAMPLE_RATE / 2)
+
 int main(void)
 {
     consoleInit(NULL);
@@ -25,19 +30,9 @@ int main(void)
         .num_mix_buffers = 2,
     };
 
-    size_t mempool_size = (sample_bin_size + 0xFFF) &~ 0xFFF;
-    void* mempool_ptr = memalign(0x1000, mempool_size);
-    memcpy(mempool_ptr, sample_bin, sample_bin_size);
-    armDCacheFlush(mempool_ptr, mempool_size);
-
-    AudioDriverWaveBuf wavebuf = {0};
-    wavebuf.data_raw = mempool_ptr;
-    wavebuf.size = sample_bin_size;
-    wavebuf.start_sample_offset = 0;
-    wavebuf.end_sample_offset = sample_bin_size/2;
-    //wavebuf.is_looping = true;
-
     AudioDriver drv;
+    VoicePool pool;
+    int sample = -1, sample_low = -1;
     Result res;
     res = audrenInitialize(&arConfig);
     bool initedDriver = false;
@@ -53,8 +48,19 @@ int main(void)
             printf("audrvCreate: %08" PRIx32 "\n", res);
         else
         {
-            int mpid = audrvMemPoolAdd(&drv, mempool_ptr, mempool_size);
-            audrvMemPoolAttach(&drv, mpid);
+            // All the voices share the sample memory of the pool (the last one is its clock), with room for the sample resampled from 22.05kHz below
+            res = voicePoolInit(&pool, &drv, arConfig.num_voices - 1, sample_bin_size * 4);
+            if (R_FAILED(res))
+                printf("voicePoolInit: %08" PRIx32 "\n", res);
+            else
+            {
+                sample = voicePoolAddSample(&pool, sample_bin, sample_bin_size, 1, VOICE_POOL_SAMPLE_RATE);
+
+                // Stand-in for a 22.05kHz asset: the same data, taken as 22.05kHz, is converted to 48kHz (and plays lower and longer)
+                u64 start = armGetSystemTick();
+                sample_low = voicePoolAddSample(&pool, sample_bin, sample_bin_size, 1, 22050);
+                printf("resampled from 22.05kHz in %" PRIu64 " us\n", armTicksToNs(armGetSystemTick() - start) / 1000);
+            }
 
             static const u8 sink_channels[] = { 0, 1 };
             int sink = audrvDeviceSinkAdd(&drv, AUDREN_DEFAULT_DEVICE_NAME, 2, sink_channels);
@@ -64,15 +70,21 @@ int main(void)
 
             res = audrenStartAudioRenderer();
             printf("audrenStartAudioRenderer: %" PRIx32 "\n", res);
-
-            audrvVoiceInit(&drv, 0, 1, PcmFormat_Int16, 48000);
-            audrvVoiceSetDestinationMix(&drv, 0, AUDREN_FINAL_MIX_ID);
-            audrvVoiceSetMixFactor(&drv, 0, 1.0f, 0, 0);
-            audrvVoiceSetMixFactor(&drv, 0, 1.0f, 0, 1);
-            audrvVoiceStart(&drv, 0);
         }
     }
-    printf("done. Press A to play a sound.\n");
+    // Only the time between updates is tracked: voices play one-shot sounds, there's no queue that could run dry.
+    // Statistics are also sent to the nxlink host, when started with nxlink -s.
+    static AudioStats stats;
+    audioStatsInit(&stats);
+    bool sockets_ok = R_SUCCEEDED(socketInitializeDefault());
+    int log_fd = audioStatsNxlinkOpen();
+    u32 frame = 0;
+    bool metronome = false;
+    u64 next_beat = 0;
+
+    printf("done. Press A to play a sound, X to play a burst of 8 low priority sounds,\n");
+    printf("Y to play a high priority sound that is never stolen, and B to play the 22.05kHz sample.\n");
+    printf("ZR toggles a metronome, scheduled on exact samples rather than frames.\n");
 
     // Main loop
     while (appletMainLoop())
@@ -84,29 +96,72 @@ int main(void)
         if (kDown & KEY_PLUS)
             break;
 
-        if (initedDriver)
+        if (initedDriver && sample >= 0)
         {
             if (kDown & KEY_A)
+                voicePoolPlay(&pool, sample, 1, 1.0f, 0.0f, 1.0f);
+
+            if (kDown & KEY_X)
             {
-                audrvVoiceStop(&drv, 0);
-                audrvVoiceAddWaveBuf(&drv, 0, &wavebuf);
-                audrvVoiceStart(&drv, 0);
+                // Spread over the stereo field, with slightly different pitches
+                for (int i = 0; i < 8; i++)
+                    voicePoolPlay(&pool, sample, 0, 0.5f, (rand() % 201 - 100) / 100.0f, 0.75f + (rand() % 51) / 100.0f);
             }
 
-            res = audrvUpdate(&drv);
+            if (kDown & KEY_Y)
+                voicePoolPlay(&pool, sample, 2, 1.0f, 0.0f, 0.5f);
+
+            if ((kDown & KEY_B) && sample_low >= 0)
+                voicePoolPlay(&pool, sample_low, 1, 1.0f, 0.0f, 1.0f);
+
+            if (kDown & KEY_ZR)
+            {
+                metronome = !metronome;
+                next_beat = voicePoolGetClock(&pool) + VOICE_POOL_LEAD_FRAMES;
+            }
+
+            // Beats are handed to the pool a little ahead of time, it starts them on the right sample
+            while (metronome && next_beat < voicePoolGetClock(&pool) + VOICE_POOL_LEAD_FRAMES)
+            {
+                voicePoolPlayAt(&pool, next_beat, sample, 1, 0.7f, 0.0f, 2.0f);
+                next_beat += BEAT_SAMPLES;
+            }
+
+            // Every change made this frame is sent in one go
+            res = voicePoolUpdate(&pool);
             if (R_FAILED(res))
                 printf("audrvUpdate: %" PRIx32 "\n", res);
-            if (wavebuf.state == AudioDriverWaveBufState_Playing)
-                printf("sample count = %" PRIu32 "\n", audrvVoiceGetPlayedSampleCount(&drv, 0));
+            audioStatsEvent(&stats);
+            printf("\x1b[10;1Hactive voices = %2" PRIu32 "/%d, stolen = %" PRIu32 ", rejected = %" PRIu32 "   \n",
+                pool.num_active, pool.num_voices, pool.num_stolen, pool.num_rejected);
+            printf("clock = %10" PRIu64 ", start error = %4" PRId32 " samples, late = %" PRIu32 "   \n",
+                voicePoolGetClock(&pool), pool.clock_error, pool.num_late);
+
+            // About once per second
+            if (++frame % 60 == 0)
+            {
+                AudioStatsReport report;
+                char line[256];
+                audioStatsReport(&stats, &report, true);
+                audioStatsFormat(line, sizeof(line), "audrvUpdate", &report);
+                printf("\x1b[13;1H%s   ", line);
+                audioStatsLog(log_fd, "audrvUpdate", &report);
+            }
         }
 
         consoleUpdate(NULL);
     }
 
     if (initedDriver)
+    {
+        voicePoolExit(&pool);
         audrvClose(&drv);
+    }
     if (initedAudren)
         audrenExit();
+    audioStatsNxlinkClose(log_fd);
+    if (sockets_ok)
+        socketExit();
 
     consoleExit(NULL);
     return 0;
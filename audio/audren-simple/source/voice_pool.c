@@ -0,0 +1,370 @@
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+
+#include "voice_pool.h"
+#include "resampler.h"
+
+#define HANDLE_VOICE_BITS 8
+
+// Stereo silence at the start of the sample memory, for lead-ins and the clock voice
+#define SILENCE_SIZE (VOICE_POOL_LEAD_FRAMES * 2 * sizeof(s16))
+
+static VoicePoolHandle makeHandle(int voice, u32 serial)
+{
+    return (serial << HANDLE_VOICE_BITS) | voice;
+}
+
+static VoicePoolVoice* lookupHandle(VoicePool* pool, VoicePoolHandle handle)
+{
+    int voice = handle & ((1 << HANDLE_VOICE_BITS) - 1);
+    if (handle == VOICE_POOL_INVALID_HANDLE || voice >= pool->num_voices)
+        return NULL;
+
+    VoicePoolVoice* v = &pool->voices[voice];
+    if (v->sample < 0 || makeHandle(voice, v->serial) != handle)
+        return NULL;
+    return v;
+}
+
+Result voicePoolInit(VoicePool* pool, AudioDriver* drv, int num_voices, size_t mem_size)
+{
+    memset(pool, 0, sizeof(*pool));
+    pool->drv = drv;
+    pool->num_voices = num_voices < VOICE_POOL_MAX_VOICES ? num_voices : VOICE_POOL_MAX_VOICES;
+    pool->next_serial = 1;
+
+    pool->mem_size = (SILENCE_SIZE + mem_size + 0xFFF) &~ 0xFFF;
+    pool->mem = (u8*)memalign(0x1000, pool->mem_size);
+    if (!pool->mem)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    memset(pool->mem, 0, SILENCE_SIZE);
+    armDCacheFlush(pool->mem, SILENCE_SIZE);
+    pool->mem_used = SILENCE_SIZE;
+
+    pool->mempool_id = audrvMemPoolAdd(drv, pool->mem, pool->mem_size);
+    if (pool->mempool_id < 0) {
+        free(pool->mem);
+        pool->mem = NULL;
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    }
+    audrvMemPoolAttach(drv, pool->mempool_id);
+
+    // The clock voice loops silence, without being mixed anywhere
+    int clock = pool->num_voices;
+    if (!audrvVoiceInit(drv, clock, 1, PcmFormat_Int16, VOICE_POOL_SAMPLE_RATE)) {
+        audrvMemPoolDetach(drv, pool->mempool_id);
+        audrvMemPoolRemove(drv, pool->mempool_id);
+        free(pool->mem);
+        pool->mem = NULL;
+        return MAKERESULT(Module_Libnx, LibnxError_BadInput);
+    }
+    audrvVoiceSetDestinationMix(drv, clock, AUDREN_FINAL_MIX_ID);
+    audrvVoiceSetMixFactor(drv, clock, 0.0f, 0, 0);
+    audrvVoiceSetMixFactor(drv, clock, 0.0f, 0, 1);
+    pool->clock_wavebuf.data_raw = pool->mem;
+    pool->clock_wavebuf.size = pool->mem_size;
+    pool->clock_wavebuf.start_sample_offset = 0;
+    pool->clock_wavebuf.end_sample_offset = VOICE_POOL_LEAD_FRAMES;
+    pool->clock_wavebuf.is_looping = true;
+    audrvVoiceAddWaveBuf(drv, clock, &pool->clock_wavebuf);
+    audrvVoiceStart(drv, clock);
+    pool->clock_tick = armGetSystemTick();
+
+    for (int i = 0; i < pool->num_voices; i++)
+        pool->voices[i].sample = -1;
+    return 0;
+}
+
+void voicePoolExit(VoicePool* pool)
+{
+    for (int i = 0; i < pool->num_voices; i++) {
+        if (pool->voices[i].channels)
+            audrvVoiceDrop(pool->drv, i);
+    }
+
+    if (pool->mem) {
+        audrvVoiceDrop(pool->drv, pool->num_voices);
+        audrvMemPoolDetach(pool->drv, pool->mempool_id);
+        audrvMemPoolRemove(pool->drv, pool->mempool_id);
+        audrvUpdate(pool->drv);
+        free(pool->mem);
+    }
+    memset(pool, 0, sizeof(*pool));
+}
+
+// Converts the sample data to VOICE_POOL_SAMPLE_RATE into dst, returning the number of frames written
+static u32 resampleInto(s16* dst, u32 max_frames, const s16* src, u32 frames, u8 channels, u32 sample_rate)
+{
+    // Samples are added at load time, from one thread: the filter tables are kept around for the next sample at the same rate
+    static ResamplerFilter filter;
+    static Resampler rs;
+    static const s16 silence[RESAMPLER_TAPS / 2 * RESAMPLER_MAX_CHANNELS];
+
+    if (filter.in_rate != sample_rate || filter.out_rate != VOICE_POOL_SAMPLE_RATE)
+        resamplerFilterInit(&filter, sample_rate, VOICE_POOL_SAMPLE_RATE);
+    resamplerInit(&rs, &filter, channels);
+
+    // Feed the sample and then enough silence to flush the filter, then drop the output delay at the start
+    u32 produced = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        const s16* in = pass ? silence : src;
+        u32 left = pass ? RESAMPLER_TAPS / 2 : frames;
+        while (left && produced < max_frames) {
+            u32 used = left;
+            produced += resamplerProcess(&rs, in, &used, &dst[produced * channels], max_frames - produced);
+            in += used * channels;
+            left -= used;
+        }
+    }
+
+    u32 delay = (u32)((u64)(RESAMPLER_TAPS / 2) * VOICE_POOL_SAMPLE_RATE / sample_rate);
+    if (delay > produced)
+        delay = produced;
+    memmove(dst, &dst[delay * channels], (produced - delay) * channels * sizeof(s16));
+    return produced - delay;
+}
+
+int voicePoolAddSample(VoicePool* pool, const void* data, size_t size, u8 channels, u32 sample_rate)
+{
+    if (pool->num_samples >= VOICE_POOL_MAX_SAMPLES || !channels || channels > RESAMPLER_MAX_CHANNELS || !sample_rate)
+        return -1;
+
+    // Keep every sample 64-byte aligned (to share cache lines with nothing else)
+    size_t offset = (pool->mem_used + 0x3F) &~ 0x3F;
+    size_t frame_size = sizeof(s16) * channels;
+    u32 frames = size / frame_size;
+
+    if (sample_rate == VOICE_POOL_SAMPLE_RATE) {
+        size = frames * frame_size;
+        if (offset + size > pool->mem_size)
+            return -1;
+        memcpy(pool->mem + offset, data, size);
+    } else {
+        u32 max_frames = resamplerOutputFrames(sample_rate, VOICE_POOL_SAMPLE_RATE, frames + RESAMPLER_TAPS / 2);
+        if (offset + max_frames * frame_size > pool->mem_size)
+            return -1;
+        frames = resampleInto((s16*)(pool->mem + offset), max_frames, (const s16*)data, frames, channels, sample_rate);
+        size = frames * frame_size;
+    }
+
+    armDCacheFlush(pool->mem + offset, size);
+    pool->mem_used = offset + size;
+
+    VoicePoolSample* s = &pool->samples[pool->num_samples];
+    s->offset = offset;
+    s->size = size;
+    s->num_samples = frames;
+    s->sample_rate = VOICE_POOL_SAMPLE_RATE;
+    s->channels = channels;
+    return pool->num_samples++;
+}
+
+// Returns an idle voice, or the one to steal for a sound of the given priority, or -1.
+static int pickVoice(VoicePool* pool, int priority)
+{
+    int best = -1;
+    for (int i = 0; i < pool->num_voices; i++) {
+        VoicePoolVoice* v = &pool->voices[i];
+        if (v->sample < 0)
+            return i;
+
+        if (v->priority > priority)
+            continue;
+        if (best < 0 || v->priority < pool->voices[best].priority ||
+            (v->priority == pool->voices[best].priority && (s32)(v->serial - pool->voices[best].serial) < 0))
+            best = i;
+    }
+    return best;
+}
+
+// lead is the number of frames of silence played before the sample, at the pitch of the voice
+static VoicePoolHandle startVoice(VoicePool* pool, int sample, int priority, float volume, float pan, float pitch, u32 lead)
+{
+    if (sample < 0 || sample >= pool->num_samples)
+        return VOICE_POOL_INVALID_HANDLE;
+
+    int id = pickVoice(pool, priority);
+    if (id < 0) {
+        pool->num_rejected++;
+        return VOICE_POOL_INVALID_HANDLE;
+    }
+
+    AudioDriver* drv = pool->drv;
+    VoicePoolVoice* v = &pool->voices[id];
+    const VoicePoolSample* s = &pool->samples[sample];
+
+    // Stealing a voice: drop its queued wavebuf, so that the struct can be queued again right away.
+    // Dropping also releases the voice itself, so it has to be initialized again below.
+    if (v->sample >= 0) {
+        audrvVoiceStop(drv, id);
+        audrvVoiceDrop(drv, id);
+        v->channels = 0;
+        v->sample_rate = 0;
+        pool->num_stolen++;
+    }
+
+    // Voices only need to be reinitialized when the format changes (or after they were dropped)
+    if (v->channels != s->channels || v->sample_rate != s->sample_rate) {
+        if (!audrvVoiceInit(drv, id, s->channels, PcmFormat_Int16, s->sample_rate)) {
+            v->channels = 0;
+            v->sample = -1;
+            return VOICE_POOL_INVALID_HANDLE;
+        }
+        audrvVoiceSetDestinationMix(drv, id, AUDREN_FINAL_MIX_ID);
+        v->channels = s->channels;
+        v->sample_rate = s->sample_rate;
+    }
+
+    // Balance panning, from -1 (left) to 1 (right)
+    float left = 1.0f - pan, right = 1.0f + pan;
+    left = left > 1.0f ? 1.0f : left;
+    right = right > 1.0f ? 1.0f : right;
+    if (s->channels == 1) {
+        audrvVoiceSetMixFactor(drv, id, left, 0, 0);
+        audrvVoiceSetMixFactor(drv, id, right, 0, 1);
+    } else {
+        audrvVoiceSetMixFactor(drv, id, left, 0, 0);
+        audrvVoiceSetMixFactor(drv, id, 0.0f, 0, 1);
+        audrvVoiceSetMixFactor(drv, id, 0.0f, 1, 0);
+        audrvVoiceSetMixFactor(drv, id, right, 1, 1);
+    }
+    audrvVoiceSetVolume(drv, id, volume);
+    audrvVoiceSetPitch(drv, id, pitch);
+
+    if (lead) {
+        memset(&v->lead, 0, sizeof(v->lead));
+        v->lead.data_raw = pool->mem;
+        v->lead.size = pool->mem_size;
+        v->lead.start_sample_offset = 0;
+        v->lead.end_sample_offset = lead < VOICE_POOL_LEAD_FRAMES ? lead : VOICE_POOL_LEAD_FRAMES;
+        audrvVoiceAddWaveBuf(drv, id, &v->lead);
+    }
+
+    memset(&v->wavebuf, 0, sizeof(v->wavebuf));
+    v->wavebuf.data_raw = pool->mem;
+    v->wavebuf.size = pool->mem_size;
+    v->wavebuf.start_sample_offset = s->offset / (sizeof(s16) * s->channels);
+    v->wavebuf.end_sample_offset = v->wavebuf.start_sample_offset + s->num_samples;
+    audrvVoiceAddWaveBuf(drv, id, &v->wavebuf);
+    audrvVoiceStart(drv, id);
+
+    v->sample = sample;
+    v->priority = priority;
+    v->serial = pool->next_serial++;
+    if (!(pool->next_serial << HANDLE_VOICE_BITS))
+        pool->next_serial = 1; // never produce VOICE_POOL_INVALID_HANDLE
+    return makeHandle(id, v->serial);
+}
+
+VoicePoolHandle voicePoolPlay(VoicePool* pool, int sample, int priority, float volume, float pan, float pitch)
+{
+    return startVoice(pool, sample, priority, volume, pan, pitch, 0);
+}
+
+bool voicePoolPlayAt(VoicePool* pool, u64 when, int sample, int priority, float volume, float pan, float pitch)
+{
+    if (pool->num_scheduled >= VOICE_POOL_MAX_SCHEDULED || sample < 0 || sample >= pool->num_samples)
+        return false;
+
+    VoicePoolScheduled* sc = &pool->scheduled[pool->num_scheduled++];
+    sc->when = when;
+    sc->sample = sample;
+    sc->priority = priority;
+    sc->volume = volume;
+    sc->pan = pan;
+    sc->pitch = pitch;
+    return true;
+}
+
+void voicePoolStop(VoicePool* pool, VoicePoolHandle handle)
+{
+    VoicePoolVoice* v = lookupHandle(pool, handle);
+    if (!v)
+        return;
+
+    int id = v - pool->voices;
+    audrvVoiceStop(pool->drv, id);
+    audrvVoiceDrop(pool->drv, id);
+    v->channels = 0;
+    v->sample_rate = 0;
+    v->sample = -1;
+}
+
+bool voicePoolIsPlaying(VoicePool* pool, VoicePoolHandle handle)
+{
+    return lookupHandle(pool, handle) != NULL;
+}
+
+static u64 ticksToSamples(u64 ticks)
+{
+    return ticks * VOICE_POOL_SAMPLE_RATE / armGetSystemTickFreq();
+}
+
+// First sample of the renderer frame that will pick up the next update. The renderer moves on in whole
+// frames, at a phase we don't know, so this may be a frame off (clock_error tells by how much it was).
+static u64 estimateStart(VoicePool* pool)
+{
+    u64 elapsed = ticksToSamples(armGetSystemTick() - pool->clock_tick);
+    u64 frames = (elapsed + AUDREN_SAMPLES_PER_FRAME_48KHZ / 2) / AUDREN_SAMPLES_PER_FRAME_48KHZ;
+    return pool->clock_samples + frames * AUDREN_SAMPLES_PER_FRAME_48KHZ;
+}
+
+// Starts the scheduled sounds which begin soon enough for their lead-in
+static void sendScheduled(VoicePool* pool, u64 start)
+{
+    for (int i = 0; i < pool->num_scheduled;) {
+        VoicePoolScheduled* sc = &pool->scheduled[i];
+        if (sc->when >= start + VOICE_POOL_LEAD_FRAMES / 2) {
+            i++;
+            continue;
+        }
+
+        u32 lead = 0;
+        if (sc->when >= start)
+            lead = (u32)((sc->when - start) * sc->pitch);
+        else
+            pool->num_late++;
+        startVoice(pool, sc->sample, sc->priority, sc->volume, sc->pan, sc->pitch, lead);
+
+        *sc = pool->scheduled[--pool->num_scheduled];
+    }
+}
+
+Result voicePoolUpdate(VoicePool* pool)
+{
+    u64 start = estimateStart(pool);
+    sendScheduled(pool, start);
+
+    Result rc = audrvUpdate(pool->drv);
+
+    // The played sample count of the clock voice is where the next renderer frame starts
+    u32 count = audrvVoiceGetPlayedSampleCount(pool->drv, pool->num_voices);
+    pool->clock_samples += (u32)(count - pool->clock_count);
+    pool->clock_count = count;
+    pool->clock_tick = armGetSystemTick();
+    pool->clock_error = (s32)(s64)(pool->clock_samples - start);
+
+    // The wavebuf states were refreshed by the update, retire the voices that are done
+    u32 active = 0;
+    for (int i = 0; i < pool->num_voices; i++) {
+        VoicePoolVoice* v = &pool->voices[i];
+        if (v->sample < 0)
+            continue;
+
+        if (v->wavebuf.state == AudioDriverWaveBufState_Done || v->wavebuf.state == AudioDriverWaveBufState_Free)
+            v->sample = -1;
+        else
+            active++;
+    }
+    pool->num_active = active;
+    return rc;
+}
+
+u64 voicePoolGetClock(VoicePool* pool)
+{
+    u64 now = pool->clock_samples + ticksToSamples(armGetSystemTick() - pool->clock_tick);
+    if (now > pool->clock_returned)
+        pool->clock_returned = now;
+    return pool->clock_returned;
+}
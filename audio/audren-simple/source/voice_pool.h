@@ -0,0 +1,113 @@
+#pragma once
+#include <switch.h>
+
+// Polyphonic voice pool on top of audrv.
+//
+// Sample data for every sound lives in a single memory region, registered once as an audren mempool
+// and shared by all voices: playing a sound only queues a wavebuf pointing into it, no matter how
+// many voices play that same sound at once.
+//
+// voicePoolPlay picks an idle voice, or steals the one with the lowest priority (the oldest one among
+// equals) when all of them are busy. Nothing is sent to the audio renderer service until voicePoolUpdate,
+// which is meant to be called once per frame and batches all the changes into a single audrvUpdate.
+//
+// Samples at other rates (44.1kHz, 32kHz, 22.05kHz assets...) are resampled to VOICE_POOL_SAMPLE_RATE
+// when they're added. All voices then run at the output rate of the renderer, with a pitch of 1 unless
+// asked otherwise, and only need to be reinitialized when the channel count changes.
+//
+// The pool also keeps a sample clock: one extra voice loops silence, and its played sample count is read
+// back at every update, giving the position of the renderer on a 48kHz timeline. voicePoolPlayAt schedules
+// a sound at a sample of that timeline: when it is sent, a lead-in of silence from the start of the sample
+// memory is queued in front of it, so that the sound starts on that exact sample rather than on the next
+// renderer frame after the key press. The output latency of the device is not included in the clock.
+
+#define VOICE_POOL_MAX_VOICES  32
+#define VOICE_POOL_MAX_SAMPLES 32
+#define VOICE_POOL_SAMPLE_RATE 48000 // of the audio renderer
+#define VOICE_POOL_LEAD_FRAMES 4800  // Longest lead-in, sounds scheduled further ahead wait in the pool
+#define VOICE_POOL_MAX_SCHEDULED 32
+
+// Identifies one playback of a sound; it becomes stale once the voice is reused.
+typedef u32 VoicePoolHandle;
+#define VOICE_POOL_INVALID_HANDLE 0
+
+typedef struct {
+    u32 offset;      // in the sample memory
+    u32 size;
+    u32 num_samples; // per channel
+    u32 sample_rate;
+    u8 channels;
+} VoicePoolSample;
+
+typedef struct {
+    AudioDriverWaveBuf lead;
+    AudioDriverWaveBuf wavebuf;
+    int sample;      // -1 when idle
+    int priority;
+    u32 serial;      // age of the current playback, also part of its handle
+    u32 sample_rate; // format the voice was initialized with
+    u8 channels;
+} VoicePoolVoice;
+
+typedef struct {
+    u64 when;        // on the clock of the pool
+    int sample;
+    int priority;
+    float volume, pan, pitch;
+} VoicePoolScheduled;
+
+typedef struct {
+    AudioDriver* drv;
+
+    u8* mem;
+    size_t mem_size;
+    size_t mem_used;
+    int mempool_id;
+
+    VoicePoolSample samples[VOICE_POOL_MAX_SAMPLES];
+    int num_samples;
+
+    VoicePoolVoice voices[VOICE_POOL_MAX_VOICES];
+    int num_voices;
+    u32 next_serial;
+
+    VoicePoolScheduled scheduled[VOICE_POOL_MAX_SCHEDULED];
+    int num_scheduled;
+
+    // Clock voice
+    AudioDriverWaveBuf clock_wavebuf;
+    u32 clock_count;    // last played sample count read
+    u64 clock_samples;  // same, without wrapping around
+    u64 clock_tick;     // system tick it was read at
+    u64 clock_returned; // by voicePoolGetClock, which never goes backwards
+
+    // Statistics
+    u32 num_active;
+    u32 num_stolen;
+    u32 num_rejected;
+    u32 num_late;       // scheduled sounds sent after their time, started right away
+    s32 clock_error;    // of the start position estimated for the last update, in samples
+} VoicePool;
+
+// Uses voices 0 to num_voices-1 of the driver, plus voice num_voices for the clock, with mem_size bytes of sample memory.
+// Must be called before the first audrvUpdate, so that the mempool is attached along with it.
+Result voicePoolInit(VoicePool* pool, AudioDriver* drv, int num_voices, size_t mem_size);
+void voicePoolExit(VoicePool* pool);
+
+// Copies PCM16 sample data into the sample memory (resampled if it isn't at VOICE_POOL_SAMPLE_RATE),
+// returning the sample id or -1 if there's no room left. Mono and stereo samples are supported.
+int voicePoolAddSample(VoicePool* pool, const void* data, size_t size, u8 channels, u32 sample_rate);
+
+// Starts playing a sample, returning VOICE_POOL_INVALID_HANDLE if every voice is busy with a higher priority sound
+VoicePoolHandle voicePoolPlay(VoicePool* pool, int sample, int priority, float volume, float pan, float pitch);
+// Schedules a sample to start at the given position of the clock, returning false if too many sounds are already
+// scheduled. Unlike voicePoolPlay, the voice is only picked when the sound is sent, so there's no handle.
+bool voicePoolPlayAt(VoicePool* pool, u64 when, int sample, int priority, float volume, float pan, float pitch);
+void voicePoolStop(VoicePool* pool, VoicePoolHandle handle);
+bool voicePoolIsPlaying(VoicePool* pool, VoicePoolHandle handle);
+
+// Sends all the changes made since the last call to the audio renderer, and retires the voices which finished playing
+Result voicePoolUpdate(VoicePool* pool);
+
+// Sample being rendered now: the count read at the last update, extrapolated from the time elapsed since
+u64 voicePoolGetClock(VoicePool* pool);
@@ -0,0 +1,167 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "audio_stats.h"
+
+void audioStatsInit(AudioStats* stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    mutexInit(&stats->mutex);
+}
+
+void audioStatsEvent(AudioStats* stats)
+{
+    u64 now = armGetSystemTick();
+
+    mutexLock(&stats->mutex);
+    if (stats->last_tick) {
+        stats->intervals[stats->next_interval] = armTicksToNs(now - stats->last_tick) / 1000;
+        stats->next_interval = (stats->next_interval + 1) % AUDIO_STATS_WINDOW;
+        if (stats->num_intervals < AUDIO_STATS_WINDOW)
+            stats->num_intervals++;
+    }
+    stats->last_tick = now;
+    stats->events++;
+    mutexUnlock(&stats->mutex);
+}
+
+void audioStatsQueueDepth(AudioStats* stats, u32 depth)
+{
+    mutexLock(&stats->mutex);
+    stats->depth_hist[depth < AUDIO_STATS_MAX_DEPTH ? depth : AUDIO_STATS_MAX_DEPTH]++;
+    stats->depth_samples++;
+    mutexUnlock(&stats->mutex);
+}
+
+void audioStatsUnderrun(AudioStats* stats)
+{
+    mutexLock(&stats->mutex);
+    stats->underruns++;
+    stats->total_underruns++;
+    mutexUnlock(&stats->mutex);
+}
+
+static int compareU32(const void* a, const void* b)
+{
+    u32 x = *(const u32*)a, y = *(const u32*)b;
+    return x < y ? -1 : x > y;
+}
+
+// Nearest-rank percentile of sorted values
+static u32 percentile(const u32* sorted, u32 count, u32 pct)
+{
+    u32 rank = (count * pct + 99) / 100;
+    return sorted[rank ? rank - 1 : 0];
+}
+
+static u32 depthPercentile(const u32* hist, u32 samples, u32 pct)
+{
+    u32 rank = (samples * pct + 99) / 100;
+    u32 cum = 0;
+    for (u32 d = 0; d <= AUDIO_STATS_MAX_DEPTH; d++) {
+        cum += hist[d];
+        if (cum >= rank && cum)
+            return d;
+    }
+    return AUDIO_STATS_MAX_DEPTH;
+}
+
+void audioStatsReport(AudioStats* stats, AudioStatsReport* rep, bool reset)
+{
+    // Copied out under the lock, sorted outside of it so that the audio thread is never held up
+    u32* sorted = stats->sorted;
+    u32 depth_hist[AUDIO_STATS_MAX_DEPTH + 1];
+
+    mutexLock(&stats->mutex);
+    u32 count = stats->num_intervals;
+    memcpy(sorted, stats->intervals, count * sizeof(u32));
+    memcpy(depth_hist, stats->depth_hist, sizeof(depth_hist));
+    u32 depth_samples = stats->depth_samples;
+
+    memset(rep, 0, sizeof(*rep));
+    rep->events = stats->events;
+    rep->underruns = stats->underruns;
+    rep->total_underruns = stats->total_underruns;
+
+    if (reset) {
+        stats->num_intervals = 0;
+        stats->next_interval = 0;
+        memset(stats->depth_hist, 0, sizeof(stats->depth_hist));
+        stats->depth_samples = 0;
+        stats->events = 0;
+        stats->underruns = 0;
+    }
+    mutexUnlock(&stats->mutex);
+
+    if (count) {
+        qsort(sorted, count, sizeof(u32), compareU32);
+        rep->interval_p50 = percentile(sorted, count, 50);
+        rep->interval_p90 = percentile(sorted, count, 90);
+        rep->interval_p99 = percentile(sorted, count, 99);
+        rep->interval_max = sorted[count - 1];
+    }
+
+    if (depth_samples) {
+        rep->has_depth = true;
+        rep->depth_min = depthPercentile(depth_hist, depth_samples, 0);
+        rep->depth_p1 = depthPercentile(depth_hist, depth_samples, 1);
+        rep->depth_p50 = depthPercentile(depth_hist, depth_samples, 50);
+    }
+}
+
+int audioStatsFormat(char* buf, size_t size, const char* name, const AudioStatsReport* rep)
+{
+    int len = snprintf(buf, size, "%s: %u events, interval p50/p90/p99/max %u/%u/%u/%u us, underruns %u (%u total)",
+        name, rep->events, rep->interval_p50, rep->interval_p90, rep->interval_p99, rep->interval_max,
+        rep->underruns, rep->total_underruns);
+    if (rep->has_depth && len >= 0 && (size_t)len < size)
+        len += snprintf(buf + len, size - len, ", depth min/p1/p50 %u/%u/%u", rep->depth_min, rep->depth_p1, rep->depth_p50);
+    return len;
+}
+
+int audioStatsNxlinkOpen(void)
+{
+    // Only set when started through nxlink
+    if (__nxlink_host.s_addr == 0)
+        return -1;
+
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd >= 0) {
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(NXLINK_CLIENT_PORT);
+        addr.sin_addr = __nxlink_host;
+        if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    return fd;
+}
+
+void audioStatsNxlinkClose(int fd)
+{
+    if (fd >= 0)
+        close(fd);
+}
+
+void audioStatsLog(int fd, const char* name, const AudioStatsReport* rep)
+{
+    if (fd < 0)
+        return;
+
+    char line[256];
+    int len = audioStatsFormat(line, sizeof(line) - 1, name, rep);
+    if (len < 0)
+        return;
+    if ((size_t)len > sizeof(line) - 2)
+        len = sizeof(line) - 2;
+    line[len++] = '\n';
+    send(fd, line, len, 0);
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <switch.h>
+
+// Instrumentation for the audio examples: how regularly the audio code runs, and how close the
+// output queue came to running dry.
+//
+// The audio thread (or callback) reports each wakeup with audioStatsEvent, the number of buffers
+// still queued with audioStatsQueueDepth, and audioStatsUnderrun whenever the queue ran dry. The main
+// thread periodically takes a report, with percentiles over the recent wakeups, and shows it or sends
+// it to the nxlink host. An intermittent crackle shows up as a high p99/max interval, or as a low
+// minimum depth, well before it turns into counted underruns.
+//
+// Usage:
+//     AudioStats stats;
+//     audioStatsInit(&stats);
+//     socketInitializeDefault();
+//     int log_fd = audioStatsNxlinkOpen();
+//     ...
+//     // Audio thread
+//     audioStatsEvent(&stats);
+//     audioStatsQueueDepth(&stats, queued);
+//     ...
+//     // Main thread, once per second
+//     AudioStatsReport rep;
+//     audioStatsReport(&stats, &rep, true);
+//     audioStatsLog(log_fd, "playback", &rep);
+
+#define AUDIO_STATS_WINDOW    512 // Intervals kept for the percentiles
+#define AUDIO_STATS_MAX_DEPTH 32
+
+typedef struct {
+    Mutex mutex;
+    u64 last_tick;
+    u32 intervals[AUDIO_STATS_WINDOW]; // in microseconds
+    u32 num_intervals;
+    u32 next_interval;
+    u32 depth_hist[AUDIO_STATS_MAX_DEPTH + 1];
+    u32 depth_samples;
+    u32 events;
+    u32 underruns;
+    u32 total_underruns;
+    u32 sorted[AUDIO_STATS_WINDOW]; // Scratch space of audioStatsReport, not protected by the mutex
+} AudioStats;
+
+typedef struct {
+    u32 events;
+    u32 underruns;
+    u32 total_underruns;        // Never reset
+    u32 interval_p50;           // Time between wakeups, in microseconds
+    u32 interval_p90;
+    u32 interval_p99;
+    u32 interval_max;
+    u32 depth_min;              // Buffers queued, the low percentiles are the ones that matter
+    u32 depth_p1;
+    u32 depth_p50;
+    bool has_depth;
+} AudioStatsReport;
+
+void audioStatsInit(AudioStats* stats);
+
+// These can be called from any thread, and take a short lock
+void audioStatsEvent(AudioStats* stats);
+void audioStatsQueueDepth(AudioStats* stats, u32 depth);
+void audioStatsUnderrun(AudioStats* stats);
+
+// Computes the statistics since the last reset. Resetting starts a new window, except for total_underruns.
+// Reports on the same stats must not be taken from several threads at once.
+void audioStatsReport(AudioStats* stats, AudioStatsReport* rep, bool reset);
+
+// Formats a report on a single line (without newline), returns the length like snprintf
+int audioStatsFormat(char* buf, size_t size, const char* name, const AudioStatsReport* rep);
+
+// Connects to the nxlink host (nxlink -s), without redirecting stdio so that the console keeps working.
+// Sockets have to be initialized by the application beforehand, and are left to it to shut down.
+// Returns -1 when the app wasn't started through nxlink, or the host can't be reached.
+int audioStatsNxlinkOpen(void);
+void audioStatsNxlinkClose(int fd);
+// Sends a formatted report line, does nothing if fd is -1
+void audioStatsLog(int fd, const char* name, const AudioStatsReport* rep);
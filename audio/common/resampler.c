@@ -0,0 +1,157 @@
+#include <string.h>
+#include <math.h>
+
+#include "resampler.h"
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#define KAISER_BETA 8.0f
+#define CUTOFF_MARGIN 0.92f // Fraction of the Nyquist frequency kept, the rest is the transition band
+
+// Zeroth order modified Bessel function of the first kind
+static float besselI0(float x)
+{
+    float sum = 1.0f, term = 1.0f;
+    for (int k = 1; k < 32; k++) {
+        term *= (x / (2.0f * k)) * (x / (2.0f * k));
+        sum += term;
+        if (term < sum * 1e-8f)
+            break;
+    }
+    return sum;
+}
+
+void resamplerFilterInit(ResamplerFilter* filter, u32 in_rate, u32 out_rate)
+{
+    filter->in_rate = in_rate;
+    filter->out_rate = out_rate;
+    filter->step = ((u64)in_rate << 32) / out_rate;
+
+    // Cutoff relative to the input rate
+    float fc = 0.5f * CUTOFF_MARGIN * (out_rate < in_rate ? (float)out_rate / in_rate : 1.0f);
+    float half = RESAMPLER_TAPS / 2;
+    float norm = besselI0(KAISER_BETA);
+
+    for (u32 p = 0; p <= RESAMPLER_PHASES; p++) {
+        float* row = filter->coeffs[p];
+        float sum = 0.0f;
+        for (u32 k = 0; k < RESAMPLER_TAPS; k++) {
+            // Distance from the output position to input sample k of the window
+            float d = (float)k - (half - 1.0f) - (float)p / RESAMPLER_PHASES;
+            float x = d / half;
+            float v = 0.0f;
+            if (x > -1.0f && x < 1.0f) {
+                float a = 2.0f * (float)M_PI * fc * d;
+                float sinc = a != 0.0f ? sinf(a) / a : 1.0f;
+                v = 2.0f * fc * sinc * besselI0(KAISER_BETA * sqrtf(1.0f - x * x)) / norm;
+            }
+            row[k] = v;
+            sum += v;
+        }
+
+        // Unity gain at DC for every phase
+        for (u32 k = 0; k < RESAMPLER_TAPS; k++)
+            row[k] /= sum;
+    }
+}
+
+u32 resamplerOutputFrames(u32 in_rate, u32 out_rate, u32 in_frames)
+{
+    u64 step = ((u64)in_rate << 32) / out_rate;
+    return (u32)((((u64)in_frames << 32) / step) + 2);
+}
+
+void resamplerInit(Resampler* rs, const ResamplerFilter* filter, u32 channels)
+{
+    rs->filter = filter;
+    rs->channels = channels < RESAMPLER_MAX_CHANNELS ? channels : RESAMPLER_MAX_CHANNELS;
+    resamplerReset(rs);
+}
+
+void resamplerReset(Resampler* rs)
+{
+    rs->frac = 0;
+    rs->need = 1;
+    rs->hist_pos = 0;
+    memset(rs->hist, 0, sizeof(rs->hist));
+}
+
+static inline void pushFrame(Resampler* rs, const s16* frame)
+{
+    for (u32 c = 0; c < rs->channels; c++) {
+        float v = frame[c];
+        rs->hist[c][rs->hist_pos] = v;
+        rs->hist[c][rs->hist_pos + RESAMPLER_TAPS] = v;
+    }
+    rs->hist_pos = (rs->hist_pos + 1) % RESAMPLER_TAPS;
+}
+
+static inline s16 saturate(float v)
+{
+    s32 s = (s32)lrintf(v);
+    return s > 0x7FFF ? 0x7FFF : s < -0x8000 ? -0x8000 : s;
+}
+
+static void computeFrame(Resampler* rs, s16* out)
+{
+    const ResamplerFilter* filter = rs->filter;
+    u32 p = rs->frac >> (32 - RESAMPLER_PHASE_BITS);
+    float t = (float)(rs->frac << RESAMPLER_PHASE_BITS) * (1.0f / 4294967296.0f);
+    const float* c0 = filter->coeffs[p];
+    const float* c1 = filter->coeffs[p + 1];
+
+    // Interpolate the coefficients once, they're the same for every channel
+    float coeffs[RESAMPLER_TAPS] __attribute__((aligned(16)));
+#ifdef __ARM_NEON
+    float32x4_t tv = vdupq_n_f32(t);
+    for (u32 k = 0; k < RESAMPLER_TAPS; k += 4) {
+        float32x4_t a = vld1q_f32(&c0[k]);
+        vst1q_f32(&coeffs[k], vmlaq_f32(a, vsubq_f32(vld1q_f32(&c1[k]), a), tv));
+    }
+
+    for (u32 c = 0; c < rs->channels; c++) {
+        const float* w = &rs->hist[c][rs->hist_pos];
+        float32x4_t acc0 = vdupq_n_f32(0.0f), acc1 = vdupq_n_f32(0.0f);
+        for (u32 k = 0; k < RESAMPLER_TAPS; k += 8) {
+            acc0 = vmlaq_f32(acc0, vld1q_f32(&w[k]), vld1q_f32(&coeffs[k]));
+            acc1 = vmlaq_f32(acc1, vld1q_f32(&w[k + 4]), vld1q_f32(&coeffs[k + 4]));
+        }
+        out[c] = saturate(vaddvq_f32(vaddq_f32(acc0, acc1)));
+    }
+#else
+    for (u32 k = 0; k < RESAMPLER_TAPS; k++)
+        coeffs[k] = c0[k] + (c1[k] - c0[k]) * t;
+
+    for (u32 c = 0; c < rs->channels; c++) {
+        const float* w = &rs->hist[c][rs->hist_pos];
+        float acc = 0.0f;
+        for (u32 k = 0; k < RESAMPLER_TAPS; k++)
+            acc += w[k] * coeffs[k];
+        out[c] = saturate(acc);
+    }
+#endif
+}
+
+u32 resamplerProcess(Resampler* rs, const s16* in, u32* in_frames, s16* out, u32 out_frames)
+{
+    u32 avail = *in_frames, used = 0, produced = 0;
+
+    while (produced < out_frames) {
+        for (; rs->need && used < avail; rs->need--, used++)
+            pushFrame(rs, &in[used * rs->channels]);
+        if (rs->need)
+            break;
+
+        computeFrame(rs, &out[produced * rs->channels]);
+        produced++;
+
+        u64 pos = (u64)rs->frac + rs->filter->step;
+        rs->frac = (u32)pos;
+        rs->need = (u32)(pos >> 32);
+    }
+
+    *in_frames = used;
+    return produced;
+}
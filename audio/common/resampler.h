@@ -0,0 +1,46 @@
+#pragma once
+#include <switch.h>
+
+// Streaming polyphase resampler, for converting assets to the 48kHz rate of the audio renderer.
+//
+// The filter is a Kaiser windowed sinc, tabulated at RESAMPLER_PHASES positions between two input
+// samples, with linear interpolation between neighbouring phases. Its cutoff is set below the lower
+// of the two Nyquist frequencies, so that downsampling doesn't alias. One ResamplerFilter holds the
+// tables for a given pair of rates and can be shared, each stream only needs its own Resampler.
+//
+// Output is delayed by RESAMPLER_TAPS / 2 input frames. To get the end of a finite sound out, feed
+// that many frames of silence after it.
+
+#define RESAMPLER_TAPS 32
+#define RESAMPLER_PHASE_BITS 7
+#define RESAMPLER_PHASES (1 << RESAMPLER_PHASE_BITS)
+#define RESAMPLER_MAX_CHANNELS 2
+
+typedef struct {
+    float coeffs[RESAMPLER_PHASES + 1][RESAMPLER_TAPS] __attribute__((aligned(16)));
+    u32 in_rate;
+    u32 out_rate;
+    u64 step;       // Input frames per output frame, 32.32 fixed point
+} ResamplerFilter;
+
+typedef struct {
+    const ResamplerFilter* filter;
+    u32 channels;
+    u32 frac;       // Position of the next output frame past the filter center, 0.32 fixed point
+    u32 need;       // Input frames to consume before the next output frame
+    u32 hist_pos;
+    // The last RESAMPLER_TAPS input frames of each channel, stored twice in a row so that they're always contiguous
+    float hist[RESAMPLER_MAX_CHANNELS][RESAMPLER_TAPS * 2] __attribute__((aligned(16)));
+} Resampler;
+
+void resamplerFilterInit(ResamplerFilter* filter, u32 in_rate, u32 out_rate);
+
+// Upper bound of the output frames produced for in_frames of input
+u32 resamplerOutputFrames(u32 in_rate, u32 out_rate, u32 in_frames);
+
+void resamplerInit(Resampler* rs, const ResamplerFilter* filter, u32 channels);
+void resamplerReset(Resampler* rs);
+
+// Resamples interleaved s16 frames, until either the input runs out or out_frames were produced.
+// On return, in_frames is set to the number of input frames consumed. Returns the number of frames produced.
+u32 resamplerProcess(Resampler* rs, const s16* in, u32* in_frames, s16* out, u32 out_frames);
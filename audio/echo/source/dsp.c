@@ -0,0 +1,396 @@
+#include <string.h>
+#include <math.h>
+
+#include "dsp.h"
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#define REVERB_INPUT_GAIN 0.03f
+#define REVERB_ALLPASS_FEEDBACK 0.5f
+
+void dsp_chain_init(DspChain* chain)
+{
+    memset(chain, 0, sizeof(*chain));
+}
+
+int dsp_chain_add(DspChain* chain, const char* name, DspProcessFn process, void* effect)
+{
+    if (chain->num_stages >= DSP_MAX_STAGES)
+        return -1;
+
+    DspStage* stage = &chain->stages[chain->num_stages];
+    stage->name = name;
+    stage->process = process;
+    stage->effect = effect;
+    stage->enabled = true;
+    return chain->num_stages++;
+}
+
+void dsp_chain_set_enabled(DspChain* chain, int stage, bool enabled)
+{
+    if (stage >= 0 && (u32)stage < chain->num_stages)
+        __atomic_store_n(&chain->stages[stage].enabled, enabled, __ATOMIC_RELAXED);
+}
+
+bool dsp_chain_is_enabled(DspChain* chain, int stage)
+{
+    if (stage < 0 || (u32)stage >= chain->num_stages)
+        return false;
+    return __atomic_load_n(&chain->stages[stage].enabled, __ATOMIC_RELAXED);
+}
+
+static void s16_to_float(float* out, const s16* in, u32 count)
+{
+    u32 i = 0;
+#ifdef __ARM_NEON
+    const float32x4_t scale = vdupq_n_f32(1.0f / 32768.0f);
+    for (; i + 8 <= count; i += 8) {
+        int16x8_t s = vld1q_s16(&in[i]);
+        vst1q_f32(&out[i], vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(s))), scale));
+        vst1q_f32(&out[i + 4], vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(s))), scale));
+    }
+#endif
+    for (; i < count; i++)
+        out[i] = in[i] * (1.0f / 32768.0f);
+}
+
+static void float_to_s16(s16* out, const float* in, u32 count)
+{
+    u32 i = 0;
+#ifdef __ARM_NEON
+    // Both the conversion to s32 and the narrowing saturate
+    const float32x4_t scale = vdupq_n_f32(32768.0f);
+    for (; i + 8 <= count; i += 8) {
+        int32x4_t lo = vcvtq_s32_f32(vmulq_f32(vld1q_f32(&in[i]), scale));
+        int32x4_t hi = vcvtq_s32_f32(vmulq_f32(vld1q_f32(&in[i + 4]), scale));
+        vst1q_s16(&out[i], vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+    }
+#endif
+    for (; i < count; i++) {
+        float s = in[i] * 32768.0f;
+        out[i] = s >= 32767.0f ? 32767 : s <= -32768.0f ? -32768 : (s16)s;
+    }
+}
+
+void dsp_chain_process(DspChain* chain, const s16* in, s16* out, u32 frames)
+{
+    if (frames > DSP_MAX_FRAMES)
+        frames = DSP_MAX_FRAMES;
+
+    u64 start = armGetSystemTick();
+
+    s16_to_float(chain->buf, in, frames * DSP_CHANNELS);
+    for (u32 i = 0; i < chain->num_stages; i++) {
+        DspStage* stage = &chain->stages[i];
+        if (__atomic_load_n(&stage->enabled, __ATOMIC_RELAXED))
+            stage->process(stage->effect, chain->buf, frames);
+    }
+    float_to_s16(out, chain->buf, frames * DSP_CHANNELS);
+
+    __atomic_fetch_add(&chain->ticks, armGetSystemTick() - start, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&chain->blocks, 1, __ATOMIC_RELAXED);
+}
+
+void dsp_eq_init(DspEq* eq)
+{
+    memset(eq, 0, sizeof(*eq));
+}
+
+bool dsp_eq_add_band(DspEq* eq, DspBiquadType type, float freq, float q, float gain_db)
+{
+    if (eq->num_bands >= DSP_EQ_MAX_BANDS)
+        return false;
+
+    float A = powf(10.0f, gain_db / 40.0f);
+    float w0 = 2.0f * (float)M_PI * freq / DSP_SAMPLE_RATE;
+    float cosw = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * q);
+    float sq = 2.0f * sqrtf(A) * alpha;
+    float b0, b1, b2, a0, a1, a2;
+
+    switch (type) {
+        default:
+        case DspBiquadType_LowPass:
+            b0 = (1.0f - cosw) / 2.0f;
+            b1 = 1.0f - cosw;
+            b2 = (1.0f - cosw) / 2.0f;
+            a0 = 1.0f + alpha;
+            a1 = -2.0f * cosw;
+            a2 = 1.0f - alpha;
+            break;
+        case DspBiquadType_HighPass:
+            b0 = (1.0f + cosw) / 2.0f;
+            b1 = -(1.0f + cosw);
+            b2 = (1.0f + cosw) / 2.0f;
+            a0 = 1.0f + alpha;
+            a1 = -2.0f * cosw;
+            a2 = 1.0f - alpha;
+            break;
+        case DspBiquadType_Peaking:
+            b0 = 1.0f + alpha * A;
+            b1 = -2.0f * cosw;
+            b2 = 1.0f - alpha * A;
+            a0 = 1.0f + alpha / A;
+            a1 = -2.0f * cosw;
+            a2 = 1.0f - alpha / A;
+            break;
+        case DspBiquadType_LowShelf:
+            b0 = A * ((A + 1.0f) - (A - 1.0f) * cosw + sq);
+            b1 = 2.0f * A * ((A - 1.0f) - (A + 1.0f) * cosw);
+            b2 = A * ((A + 1.0f) - (A - 1.0f) * cosw - sq);
+            a0 = (A + 1.0f) + (A - 1.0f) * cosw + sq;
+            a1 = -2.0f * ((A - 1.0f) + (A + 1.0f) * cosw);
+            a2 = (A + 1.0f) + (A - 1.0f) * cosw - sq;
+            break;
+        case DspBiquadType_HighShelf:
+            b0 = A * ((A + 1.0f) + (A - 1.0f) * cosw + sq);
+            b1 = -2.0f * A * ((A - 1.0f) + (A + 1.0f) * cosw);
+            b2 = A * ((A + 1.0f) + (A - 1.0f) * cosw - sq);
+            a0 = (A + 1.0f) - (A - 1.0f) * cosw + sq;
+            a1 = 2.0f * ((A - 1.0f) - (A + 1.0f) * cosw);
+            a2 = (A + 1.0f) - (A - 1.0f) * cosw - sq;
+            break;
+    }
+
+    DspBiquad* bq = &eq->bands[eq->num_bands++];
+    memset(bq, 0, sizeof(*bq));
+    bq->b0 = b0 / a0;
+    bq->b1 = b1 / a0;
+    bq->b2 = b2 / a0;
+    bq->a1 = a1 / a0;
+    bq->a2 = a2 / a0;
+    return true;
+}
+
+// Transposed direct form II. The filter is recursive, so instead of several samples at once, both channels are processed at once.
+static void biquad_process(DspBiquad* bq, float* buf, u32 frames)
+{
+    const float b0 = bq->b0, b1 = bq->b1, b2 = bq->b2, a1 = bq->a1, a2 = bq->a2;
+
+#ifdef __ARM_NEON
+    float32x2_t z1 = vld1_f32(bq->z1), z2 = vld1_f32(bq->z2);
+    for (u32 i = 0; i < frames; i++) {
+        float32x2_t x = vld1_f32(&buf[i * 2]);
+        float32x2_t y = vmla_n_f32(z1, x, b0);
+        z1 = vmls_n_f32(vmla_n_f32(z2, x, b1), y, a1);
+        z2 = vmls_n_f32(vmul_n_f32(x, b2), y, a2);
+        vst1_f32(&buf[i * 2], y);
+    }
+    vst1_f32(bq->z1, z1);
+    vst1_f32(bq->z2, z2);
+#else
+    for (u32 c = 0; c < DSP_CHANNELS; c++) {
+        float z1 = bq->z1[c], z2 = bq->z2[c];
+        for (u32 i = 0; i < frames; i++) {
+            float x = buf[i * DSP_CHANNELS + c];
+            float y = b0 * x + z1;
+            z1 = b1 * x - a1 * y + z2;
+            z2 = b2 * x - a2 * y;
+            buf[i * DSP_CHANNELS + c] = y;
+        }
+        bq->z1[c] = z1;
+        bq->z2[c] = z2;
+    }
+#endif
+}
+
+void dsp_eq_process(void* effect, float* buf, u32 frames)
+{
+    DspEq* eq = (DspEq*)effect;
+    for (u32 i = 0; i < eq->num_bands; i++)
+        biquad_process(&eq->bands[i], buf, frames);
+}
+
+#define LIMITER_BLOCK 8
+
+void dsp_limiter_init(DspLimiter* lim, float gain_db, float threshold_db, float release_ms)
+{
+    memset(lim, 0, sizeof(*lim));
+    lim->gain = powf(10.0f, gain_db / 20.0f);
+    lim->threshold = powf(10.0f, threshold_db / 20.0f);
+    // The envelope falls by 60dB over release_ms
+    lim->release = powf(10.0f, -3.0f * LIMITER_BLOCK * 1000.0f / (release_ms * DSP_SAMPLE_RATE));
+    lim->cur_gain = 1.0f;
+}
+
+void dsp_limiter_process(void* effect, float* buf, u32 frames)
+{
+    DspLimiter* lim = (DspLimiter*)effect;
+
+    for (u32 i = 0; i < frames; i += LIMITER_BLOCK) {
+        u32 n = frames - i < LIMITER_BLOCK ? frames - i : LIMITER_BLOCK;
+        float* x = &buf[i * DSP_CHANNELS];
+        float peak = 0.0f;
+        u32 j = 0;
+
+        // Apply the input gain, and find the block peak
+#ifdef __ARM_NEON
+        if (n == LIMITER_BLOCK) {
+            float32x4_t m = vdupq_n_f32(0.0f);
+            for (; j < LIMITER_BLOCK * DSP_CHANNELS; j += 4) {
+                float32x4_t v = vmulq_n_f32(vld1q_f32(&x[j]), lim->gain);
+                vst1q_f32(&x[j], v);
+                m = vmaxq_f32(m, vabsq_f32(v));
+            }
+            peak = vmaxvq_f32(m);
+        }
+#endif
+        for (; j < n * DSP_CHANNELS; j++) {
+            x[j] *= lim->gain;
+            float a = fabsf(x[j]);
+            peak = a > peak ? a : peak;
+        }
+
+        float decayed = lim->env * lim->release;
+        lim->env = peak > decayed ? peak : decayed;
+        float target = lim->env > lim->threshold ? lim->threshold / lim->env : 1.0f;
+
+        // Instant attack, the release is ramped over the block
+        float g = target < lim->cur_gain ? target : lim->cur_gain;
+        float step = (target - g) / n;
+        j = 0;
+#ifdef __ARM_NEON
+        if (n == LIMITER_BLOCK) {
+            const float ramp[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+            float32x4_t gv = vmlaq_n_f32(vdupq_n_f32(g), vld1q_f32(ramp), step);
+            float32x4_t gstep = vdupq_n_f32(step * 2.0f);
+            for (; j < LIMITER_BLOCK * DSP_CHANNELS; j += 4) {
+                vst1q_f32(&x[j], vmulq_f32(vld1q_f32(&x[j]), gv));
+                gv = vaddq_f32(gv, gstep);
+            }
+        }
+#endif
+        for (; j < n * DSP_CHANNELS; j += DSP_CHANNELS) {
+            float fg = g + step * (j / DSP_CHANNELS);
+            x[j] *= fg;
+            x[j + 1] *= fg;
+        }
+        lim->cur_gain = target;
+    }
+}
+
+void dsp_delay_init(DspDelay* delay, float delay_ms, float feedback, float wet)
+{
+    memset(delay, 0, sizeof(*delay));
+    u32 length = (u32)(delay_ms * DSP_SAMPLE_RATE / 1000.0f);
+    delay->length = length < 1 ? 1 : length > DSP_DELAY_MAX_FRAMES ? DSP_DELAY_MAX_FRAMES : length;
+    delay->feedback = feedback;
+    delay->wet = wet;
+}
+
+void dsp_delay_process(void* effect, float* buf, u32 frames)
+{
+    DspDelay* delay = (DspDelay*)effect;
+    const float fb = delay->feedback, wet = delay->wet;
+
+    // The delay line is exactly length frames long, so each slot is read before being overwritten with the new input.
+    // Within a run that doesn't wrap, no slot is touched twice: the whole run can be processed as a flat vector.
+    while (frames) {
+        u32 n = delay->length - delay->pos;
+        if (n > frames)
+            n = frames;
+
+        float* d = &delay->buf[delay->pos * DSP_CHANNELS];
+        u32 count = n * DSP_CHANNELS, j = 0;
+#ifdef __ARM_NEON
+        for (; j + 4 <= count; j += 4) {
+            float32x4_t dv = vld1q_f32(&d[j]);
+            float32x4_t xv = vld1q_f32(&buf[j]);
+            vst1q_f32(&d[j], vmlaq_n_f32(xv, dv, fb));
+            vst1q_f32(&buf[j], vmlaq_n_f32(xv, dv, wet));
+        }
+#endif
+        for (; j < count; j++) {
+            float dv = d[j], xv = buf[j];
+            d[j] = xv + dv * fb;
+            buf[j] = xv + dv * wet;
+        }
+
+        delay->pos += n;
+        if (delay->pos == delay->length)
+            delay->pos = 0;
+        buf += count;
+        frames -= n;
+    }
+}
+
+void dsp_reverb_init(DspReverb* rev, float room, float damp, float wet)
+{
+    // Freeverb tunings, scaled from 44.1kHz
+    static const u32 comb_tuning[DSP_REVERB_COMBS] = { 1116, 1277, 1422, 1557 };
+    static const u32 allpass_tuning[DSP_REVERB_ALLPASSES] = { 556, 441 };
+
+    memset(rev, 0, sizeof(*rev));
+    for (u32 i = 0; i < DSP_REVERB_COMBS; i++)
+        rev->comb_len[i] = comb_tuning[i] * DSP_SAMPLE_RATE / 44100;
+    for (u32 i = 0; i < DSP_REVERB_ALLPASSES; i++)
+        rev->allpass_len[i] = allpass_tuning[i] * DSP_SAMPLE_RATE / 44100;
+
+    rev->feedback = 0.7f + room * 0.28f;
+    rev->damp = damp * 0.4f;
+    rev->wet = wet;
+}
+
+void dsp_reverb_process(void* effect, float* buf, u32 frames)
+{
+    DspReverb* rev = (DspReverb*)effect;
+    const float fb = rev->feedback, damp = rev->damp, wet = rev->wet;
+
+#ifdef __ARM_NEON
+    // The four combs run in parallel, one per lane: only their delay line accesses are done per lane
+    float32x4_t filter = vld1q_f32(rev->comb_filter);
+#endif
+
+    for (u32 i = 0; i < frames; i++) {
+        float* x = &buf[i * DSP_CHANNELS];
+        float in = (x[0] + x[1]) * REVERB_INPUT_GAIN;
+        float acc;
+
+#ifdef __ARM_NEON
+        float32x4_t out = vdupq_n_f32(0.0f);
+        out = vsetq_lane_f32(rev->comb_buf[0][rev->comb_pos[0]], out, 0);
+        out = vsetq_lane_f32(rev->comb_buf[1][rev->comb_pos[1]], out, 1);
+        out = vsetq_lane_f32(rev->comb_buf[2][rev->comb_pos[2]], out, 2);
+        out = vsetq_lane_f32(rev->comb_buf[3][rev->comb_pos[3]], out, 3);
+
+        filter = vmlaq_n_f32(vmulq_n_f32(out, 1.0f - damp), filter, damp);
+        float32x4_t next = vmlaq_n_f32(vdupq_n_f32(in), filter, fb);
+
+        rev->comb_buf[0][rev->comb_pos[0]] = vgetq_lane_f32(next, 0);
+        rev->comb_buf[1][rev->comb_pos[1]] = vgetq_lane_f32(next, 1);
+        rev->comb_buf[2][rev->comb_pos[2]] = vgetq_lane_f32(next, 2);
+        rev->comb_buf[3][rev->comb_pos[3]] = vgetq_lane_f32(next, 3);
+        acc = vaddvq_f32(out);
+#else
+        acc = 0.0f;
+        for (u32 c = 0; c < DSP_REVERB_COMBS; c++) {
+            float out = rev->comb_buf[c][rev->comb_pos[c]];
+            rev->comb_filter[c] = out * (1.0f - damp) + rev->comb_filter[c] * damp;
+            rev->comb_buf[c][rev->comb_pos[c]] = in + rev->comb_filter[c] * fb;
+            acc += out;
+        }
+#endif
+        for (u32 c = 0; c < DSP_REVERB_COMBS; c++) {
+            if (++rev->comb_pos[c] == rev->comb_len[c])
+                rev->comb_pos[c] = 0;
+        }
+
+        for (u32 a = 0; a < DSP_REVERB_ALLPASSES; a++) {
+            float* ap = &rev->allpass_buf[a][rev->allpass_pos[a]];
+            float bufout = *ap;
+            *ap = acc + bufout * REVERB_ALLPASS_FEEDBACK;
+            acc = bufout - acc;
+            if (++rev->allpass_pos[a] == rev->allpass_len[a])
+                rev->allpass_pos[a] = 0;
+        }
+
+        x[0] += acc * wet;
+        x[1] += acc * wet;
+    }
+
+#ifdef __ARM_NEON
+    vst1q_f32(rev->comb_filter, filter);
+#endif
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <switch.h>
+
+// Block-based effects chain for the echo path.
+//
+// dsp_chain_process converts a block of interleaved stereo s16 samples to float, runs it through
+// every enabled stage in order, and converts it back with saturation. Stages are plain callbacks
+// on an effect struct, so that other effects can be plugged in next to the ones below. Effects
+// own all their memory (delay lines included): nothing is allocated while processing.
+//
+// Stages can be toggled from another thread, everything else must be set up before processing starts.
+
+#define DSP_SAMPLE_RATE 48000
+#define DSP_CHANNELS 2
+#define DSP_MAX_FRAMES 1920 // 40ms
+#define DSP_MAX_STAGES 8
+
+typedef void (*DspProcessFn)(void* effect, float* buf, u32 frames);
+
+typedef struct {
+    const char* name;
+    DspProcessFn process;
+    void* effect;
+    bool enabled;
+} DspStage;
+
+typedef struct {
+    DspStage stages[DSP_MAX_STAGES];
+    u32 num_stages;
+    float buf[DSP_MAX_FRAMES * DSP_CHANNELS] __attribute__((aligned(16)));
+
+    // Time spent in dsp_chain_process, for statistics
+    u64 ticks;
+    u32 blocks;
+} DspChain;
+
+void dsp_chain_init(DspChain* chain);
+// Returns the stage index, or -1 if the chain is full. Stages start enabled.
+int dsp_chain_add(DspChain* chain, const char* name, DspProcessFn process, void* effect);
+void dsp_chain_set_enabled(DspChain* chain, int stage, bool enabled);
+bool dsp_chain_is_enabled(DspChain* chain, int stage);
+// in and out may be the same buffer. frames is limited to DSP_MAX_FRAMES.
+void dsp_chain_process(DspChain* chain, const s16* in, s16* out, u32 frames);
+
+// Equalizer: up to DSP_EQ_MAX_BANDS biquads in series (RBJ cookbook filters), both channels processed at once.
+#define DSP_EQ_MAX_BANDS 4
+
+typedef enum {
+    DspBiquadType_LowPass,
+    DspBiquadType_HighPass,
+    DspBiquadType_Peaking,
+    DspBiquadType_LowShelf,
+    DspBiquadType_HighShelf,
+} DspBiquadType;
+
+typedef struct {
+    float b0, b1, b2, a1, a2;
+    float z1[DSP_CHANNELS], z2[DSP_CHANNELS];
+} DspBiquad;
+
+typedef struct {
+    DspBiquad bands[DSP_EQ_MAX_BANDS];
+    u32 num_bands;
+} DspEq;
+
+void dsp_eq_init(DspEq* eq);
+bool dsp_eq_add_band(DspEq* eq, DspBiquadType type, float freq, float q, float gain_db);
+void dsp_eq_process(void* effect, float* buf, u32 frames);
+
+// Gain followed by a peak limiter, with the gain reduction computed per 8 frame block.
+typedef struct {
+    float gain;
+    float threshold;
+    float release;   // Envelope decay per block
+    float env;
+    float cur_gain;
+} DspLimiter;
+
+void dsp_limiter_init(DspLimiter* lim, float gain_db, float threshold_db, float release_ms);
+void dsp_limiter_process(void* effect, float* buf, u32 frames);
+
+// Feedback delay (echo), up to 500ms.
+#define DSP_DELAY_MAX_FRAMES (DSP_SAMPLE_RATE / 2)
+
+typedef struct {
+    float buf[DSP_DELAY_MAX_FRAMES * DSP_CHANNELS] __attribute__((aligned(16)));
+    u32 length;      // in frames
+    u32 pos;
+    float feedback;
+    float wet;
+} DspDelay;
+
+void dsp_delay_init(DspDelay* delay, float delay_ms, float feedback, float wet);
+void dsp_delay_process(void* effect, float* buf, u32 frames);
+
+// Simple mono-in reverb: four damped comb filters in parallel, then two allpass filters in series (Schroeder/Freeverb).
+#define DSP_REVERB_COMBS 4
+#define DSP_REVERB_COMB_MAX 1800
+#define DSP_REVERB_ALLPASSES 2
+#define DSP_REVERB_ALLPASS_MAX 640
+
+typedef struct {
+    float comb_buf[DSP_REVERB_COMBS][DSP_REVERB_COMB_MAX];
+    u32 comb_len[DSP_REVERB_COMBS], comb_pos[DSP_REVERB_COMBS];
+    float comb_filter[DSP_REVERB_COMBS] __attribute__((aligned(16)));
+    float allpass_buf[DSP_REVERB_ALLPASSES][DSP_REVERB_ALLPASS_MAX];
+    u32 allpass_len[DSP_REVERB_ALLPASSES], allpass_pos[DSP_REVERB_ALLPASSES];
+    float feedback;
+    float damp;
+    float wet;
+} DspReverb;
+
+// room goes from 0 to 1 (decay time), damp from 0 to 1 (high frequency absorption)
+void dsp_reverb_init(DspReverb* rev, float room, float damp, float wet);
+void dsp_reverb_process(void* effect, float* buf, u32 frames);
@@ -1,19 +1,197 @@
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <malloc.h>
 #include <math.h>
 
 #include <switch.h>
 
+#include "dsp.h"
+#include "audio_stats.h"
+
 // Example for audio capture and playback.
 // This example continuously records audio data from the default input device (see libnx audin.h),
 // and sends it to the default audio output device (see libnx audout.h).
+// This is done by a dedicated audio thread with several small buffers queued in each direction, so that
+// the delay between capture and playback stays as low as possible. The buffer size and count can be
+// changed at runtime, and the round-trip latency can be measured (this needs the speaker to be heard
+// by the microphone, or a loopback cable).
+// Captured audio goes through an effects chain (see dsp.h) before being played.
 
 #define SAMPLERATE 48000
 #define CHANNELCOUNT 2
-#define FRAMERATE (1000 / 30)
-#define SAMPLECOUNT (SAMPLERATE / FRAMERATE)
 #define BYTESPERSAMPLE 2
+#define MAXBUFFERCOUNT 8
+#define MAXBUFFERMS 40 // Also the largest block dsp_chain_process handles (DSP_MAX_FRAMES)
+
+#define CLICK_THRESHOLD 0x2000     // Captured amplitude at which the click counts as heard
+#define CLICK_TIMEOUT_NS 1000000000ULL
+
+static const u32 buffer_ms_options[] = { 5, 10, 15, 20, 30, 40 };
+
+typedef struct {
+    AudioInBuffer in_buffers[MAXBUFFERCOUNT];
+    AudioOutBuffer out_buffers[MAXBUFFERCOUNT];
+    Thread thread;
+    bool exit;
+
+    // Only used by the audio thread: buffers which aren't currently appended
+    AudioInBuffer* parked_in[MAXBUFFERCOUNT];
+    AudioOutBuffer* free_out[MAXBUFFERCOUNT];
+    u32 num_parked_in, num_free_out;
+    u32 queued_in, queued_out;
+    bool measuring;
+    u64 click_tick;
+
+    // Settings, written by the main thread and picked up with the next buffer
+    u32 buffer_samples;
+    u32 buffer_count;   // Maximum number of buffers queued in each direction
+    bool measure_request;
+
+    // Effects, processed by the audio thread. Only their enabled state is changed afterwards.
+    DspChain dsp;
+    DspEq eq;
+    DspDelay delay;
+    DspReverb reverb;
+    DspLimiter limiter;
+
+    // Results and statistics, for the main thread
+    u64 latency_ns;     // 0 if the click wasn't heard
+    u32 measurements;
+    u32 dropped;        // Captured buffers that couldn't be played, because the playback queue was full
+    u32 underruns;      // Times the playback queue ran dry
+    AudioStats stats;   // Capture wakeups, and playback queue depth
+} LoopbackState;
+
+// Writes a short full-scale square burst, easy to pick out of the captured data.
+static void write_click(s16* out, u32 samples)
+{
+    memset(out, 0, samples * CHANNELCOUNT * BYTESPERSAMPLE);
+    for (u32 i = 0; i < samples && i < SAMPLERATE / 500; i++) {
+        s16 s = (i / 24) & 1 ? -0x6000 : 0x6000; // 1kHz
+        for (u32 c = 0; c < CHANNELCOUNT; c++)
+            out[i * CHANNELCOUNT + c] = s;
+    }
+}
+
+static bool contains_click(const s16* in, u32 samples)
+{
+    for (u32 i = 0; i < samples * CHANNELCOUNT; i++) {
+        if (abs(in[i]) >= CLICK_THRESHOLD)
+            return true;
+    }
+    return false;
+}
+
+// Sends a captured buffer to playback. now is when the capture was released.
+static void loopback_echo(LoopbackState* state, AudioInBuffer* in, u32 count, u64 now)
+{
+    const s16* in_data = (const s16*)in->buffer;
+    u32 samples = in->data_size / (CHANNELCOUNT * BYTESPERSAMPLE);
+
+    // The round trip is from handing the click to audout, to getting it back from audin
+    if (state->measuring) {
+        if (contains_click(in_data, samples)) {
+            __atomic_store_n(&state->latency_ns, armTicksToNs(now - state->click_tick), __ATOMIC_RELAXED);
+            __atomic_fetch_add(&state->measurements, 1, __ATOMIC_RELAXED);
+            state->measuring = false;
+        }
+        else if (armTicksToNs(now - state->click_tick) > CLICK_TIMEOUT_NS) {
+            __atomic_store_n(&state->latency_ns, 0, __ATOMIC_RELAXED);
+            __atomic_fetch_add(&state->measurements, 1, __ATOMIC_RELAXED);
+            state->measuring = false;
+        }
+    }
+
+    // Dropping a buffer here, rather than queuing more, keeps the latency bounded if capture runs ahead of playback
+    if (state->queued_out >= count || !state->num_free_out) {
+        __atomic_fetch_add(&state->dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    audioStatsQueueDepth(&state->stats, state->queued_out);
+    if (!state->queued_out) {
+        __atomic_fetch_add(&state->underruns, 1, __ATOMIC_RELAXED);
+        audioStatsUnderrun(&state->stats);
+    }
+
+    AudioOutBuffer* out = state->free_out[--state->num_free_out];
+    s16* out_data = (s16*)out->buffer;
+
+    if (!state->measuring && __atomic_exchange_n(&state->measure_request, false, __ATOMIC_RELAXED)) {
+        write_click(out_data, samples);
+        state->measuring = true;
+        state->click_tick = armGetSystemTick();
+    }
+    else if (state->measuring)
+        memset(out_data, 0, in->data_size); // Muted while measuring, so that only the click itself comes back
+    else
+        dsp_chain_process(&state->dsp, in_data, out_data, samples);
+
+    out->data_size = in->data_size;
+    if (R_SUCCEEDED(audoutAppendAudioOutBuffer(out)))
+        state->queued_out++;
+    else
+        state->free_out[state->num_free_out++] = out;
+}
+
+// The audio thread waits for each captured buffer, and appends it for playback right away.
+// The main thread only changes the settings and shows the statistics, it never waits on audio.
+static void loopback_thread_func(void* arg)
+{
+    LoopbackState* state = (LoopbackState*)arg;
+
+    while (!__atomic_load_n(&state->exit, __ATOMIC_ACQUIRE))
+    {
+        u32 count = __atomic_load_n(&state->buffer_count, __ATOMIC_RELAXED);
+        u32 data_size = __atomic_load_n(&state->buffer_samples, __ATOMIC_RELAXED) * CHANNELCOUNT * BYTESPERSAMPLE;
+
+        // Keep count capture buffers queued, resizing them as they're appended again.
+        while (state->queued_in < count && state->num_parked_in) {
+            AudioInBuffer* in = state->parked_in[--state->num_parked_in];
+            in->data_size = data_size;
+            if (R_FAILED(audinAppendAudioInBuffer(in))) {
+                state->parked_in[state->num_parked_in++] = in;
+                break;
+            }
+            state->queued_in++;
+        }
+
+        // Collect the playback buffers which were played.
+        AudioOutBuffer* released_out = NULL;
+        u32 released_out_count = 0;
+        while (R_SUCCEEDED(audoutGetReleasedAudioOutBuffer(&released_out, &released_out_count)) && released_out_count && released_out) {
+            state->free_out[state->num_free_out++] = released_out;
+            state->queued_out--;
+            released_out = NULL;
+        }
+
+        AudioInBuffer* released_in = NULL;
+        u32 released_in_count = 0;
+        Result rc = audinWaitCaptureFinish(&released_in, &released_in_count, 100000000ULL);
+        if (R_FAILED(rc))
+            continue;
+
+        // Only one buffer is returned at a time, the others which may have been released meanwhile are picked up without waiting.
+        while (released_in_count && released_in) {
+            u64 now = armGetSystemTick();
+            state->queued_in--;
+            audioStatsEvent(&state->stats);
+
+            loopback_echo(state, released_in, count, now);
+
+            // Parked instead when the buffer count was lowered
+            released_in->data_size = data_size;
+            if (state->queued_in < count && R_SUCCEEDED(audinAppendAudioInBuffer(released_in)))
+                state->queued_in++;
+            else
+                state->parked_in[state->num_parked_in++] = released_in;
+
+            released_in = NULL;
+            if (R_FAILED(audinGetReleasedAudioInBuffer(&released_in, &released_in_count)))
+                break;
+        }
+    }
+}
 
 int main(int argc, char **argv)
 {
@@ -22,20 +200,43 @@ int main(int argc, char **argv)
     // Initialize console. Using NULL as the second argument tells the console library to use the internal console structure as current one.
     consoleInit(NULL);
 
-    AudioInBuffer audin_buf;
-    AudioOutBuffer audout_buf;
-    AudioInBuffer *released_in_buffer;
-    AudioOutBuffer *released_out_buffer;
-    u32 released_in_count;
-    u32 released_out_count;
+    static LoopbackState state;
+    u32 ms_option = 1;
+    u32 buffer_count = 4;
+    state.buffer_samples = SAMPLERATE * buffer_ms_options[ms_option] / 1000;
+    state.buffer_count = buffer_count;
+    audioStatsInit(&state.stats);
+
+    // Statistics are also sent to the nxlink host, when started with nxlink -s
+    bool sockets_ok = R_SUCCEEDED(socketInitializeDefault());
+    int log_fd = audioStatsNxlinkOpen();
+
+    // Set up the effects chain: the EQ removes rumble and adds some presence, and the limiter comes last to catch the peaks of everything before it.
+    dsp_chain_init(&state.dsp);
+    dsp_eq_init(&state.eq);
+    dsp_eq_add_band(&state.eq, DspBiquadType_HighPass, 100.0f, 0.707f, 0.0f);
+    dsp_eq_add_band(&state.eq, DspBiquadType_Peaking, 3000.0f, 1.0f, 4.0f);
+    dsp_delay_init(&state.delay, 250.0f, 0.4f, 0.5f);
+    dsp_reverb_init(&state.reverb, 0.5f, 0.5f, 0.5f);
+    dsp_limiter_init(&state.limiter, 6.0f, -1.0f, 100.0f);
 
-    // Make sure the sample buffer size is aligned to 0x1000 bytes.
-    u32 data_size = (SAMPLECOUNT * CHANNELCOUNT * BYTESPERSAMPLE);
-    u32 buffer_size = (data_size + 0xfff) & ~0xfff;
+    u64 effect_keys[] = { KEY_X, KEY_Y, KEY_B, KEY_L };
+    int effect_stages[] = {
+        dsp_chain_add(&state.dsp, "EQ", dsp_eq_process, &state.eq),
+        dsp_chain_add(&state.dsp, "delay", dsp_delay_process, &state.delay),
+        dsp_chain_add(&state.dsp, "reverb", dsp_reverb_process, &state.reverb),
+        dsp_chain_add(&state.dsp, "limiter", dsp_limiter_process, &state.limiter),
+    };
+    dsp_chain_set_enabled(&state.dsp, effect_stages[1], false);
+    dsp_chain_set_enabled(&state.dsp, effect_stages[2], false);
+
+    // Make sure the sample buffer size is aligned to 0x1000 bytes. Every buffer is allocated for the largest size.
+    u32 max_data_size = (SAMPLERATE * MAXBUFFERMS / 1000) * CHANNELCOUNT * BYTESPERSAMPLE;
+    u32 buffer_size = (max_data_size + 0xfff) & ~0xfff;
 
     // Allocate the buffers.
-    u8* in_buf_data = memalign(0x1000, buffer_size);
-    u8* out_buf_data = memalign(0x1000, buffer_size);
+    u8* in_buf_data = memalign(0x1000, buffer_size * MAXBUFFERCOUNT);
+    u8* out_buf_data = memalign(0x1000, buffer_size * MAXBUFFERCOUNT);
 
     // Ensure buffers were properly allocated.
     if ((in_buf_data == NULL) || (out_buf_data == NULL))
@@ -46,8 +247,8 @@ int main(int argc, char **argv)
 
     if (R_SUCCEEDED(rc))
     {
-        memset(in_buf_data, 0, buffer_size);
-        memset(out_buf_data, 0, buffer_size);
+        memset(in_buf_data, 0, buffer_size * MAXBUFFERCOUNT);
+        memset(out_buf_data, 0, buffer_size * MAXBUFFERCOUNT);
     }
 
     if (R_SUCCEEDED(rc))
@@ -78,33 +279,50 @@ int main(int argc, char **argv)
         printf("audoutStartAudioOut() returned 0x%x\n", rc);
     }
 
-    // Prepare the input buffer.
-    audin_buf.next = NULL;
-    audin_buf.buffer = in_buf_data;
-    audin_buf.buffer_size = buffer_size;
-    audin_buf.data_size = data_size;
-    audin_buf.data_offset = 0;
+    if (R_SUCCEEDED(rc))
+    {
+        // Prepare the buffers. The audio thread appends the input buffers, and the output ones as they get filled.
+        for (int i = 0; i < MAXBUFFERCOUNT; i++)
+        {
+            AudioInBuffer* in = &state.in_buffers[i];
+            in->next = NULL;
+            in->buffer = in_buf_data + i * buffer_size;
+            in->buffer_size = buffer_size;
+            in->data_size = 0;
+            in->data_offset = 0;
+            state.parked_in[state.num_parked_in++] = in;
+
+            AudioOutBuffer* out = &state.out_buffers[i];
+            out->next = NULL;
+            out->buffer = out_buf_data + i * buffer_size;
+            out->buffer_size = buffer_size;
+            out->data_size = 0;
+            out->data_offset = 0;
+            state.free_out[state.num_free_out++] = out;
+        }
 
-    // Prepare the output buffer.
-    audout_buf.next = NULL;
-    audout_buf.buffer = out_buf_data;
-    audout_buf.buffer_size = buffer_size;
-    audout_buf.data_size = data_size;
-    audout_buf.data_offset = 0;
+        // Start playback with a single buffer of silence, as a margin for the first captured buffer.
+        AudioOutBuffer* out = state.free_out[--state.num_free_out];
+        out->data_size = state.buffer_samples * CHANNELCOUNT * BYTESPERSAMPLE;
+        rc = audoutAppendAudioOutBuffer(out);
+        printf("audoutAppendAudioOutBuffer() returned 0x%x\n", rc);
+        if (R_SUCCEEDED(rc))
+            state.queued_out++;
+    }
 
-    // Prepare pointers and counters for released buffers.
-    released_in_buffer = NULL;
-    released_out_buffer = NULL;
-    released_in_count = 0;
-    released_out_count = 0;
+    if (R_SUCCEEDED(rc))
+    {
+        // Use a higher priority than the main thread (0x2C), so that the audio thread is never delayed by it.
+        rc = threadCreate(&state.thread, loopback_thread_func, &state, NULL, 0x4000, 0x28, -2);
+        if (R_SUCCEEDED(rc))
+            rc = threadStart(&state.thread);
+        printf("Audio thread start returned 0x%x\n", rc);
+    }
 
-    // Append the initial input buffer.
-    rc = audinAppendAudioInBuffer(&audin_buf);
-    printf("audinAppendAudioInBuffer() returned 0x%x\n", rc);
+    printf("Left/Right: buffer size, Up/Down: buffer count, A: measure the round-trip latency.\n");
+    printf("X: EQ, Y: delay, B: reverb, L: limiter.\n");
 
-    // Append the initial output buffer.
-    rc = audoutAppendAudioOutBuffer(&audout_buf);
-    printf("audoutAppendAudioOutBuffer() returned 0x%x\n", rc);
+    u32 frame = 0;
 
     while (appletMainLoop())
     {
@@ -116,21 +334,66 @@ int main(int argc, char **argv)
 
         if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
 
-        // Wait for audio capture and playback to finish.
-        audinWaitCaptureFinish(&released_in_buffer, &released_in_count, UINT64_MAX);
-        audoutWaitPlayFinish(&released_out_buffer, &released_out_count, UINT64_MAX);
+        if ((kDown & KEY_DLEFT) && ms_option > 0) ms_option--;
+        if ((kDown & KEY_DRIGHT) && ms_option < sizeof(buffer_ms_options) / sizeof(buffer_ms_options[0]) - 1) ms_option++;
+        if ((kDown & KEY_DDOWN) && buffer_count > 2) buffer_count--;
+        if ((kDown & KEY_DUP) && buffer_count < MAXBUFFERCOUNT) buffer_count++;
+
+        __atomic_store_n(&state.buffer_samples, SAMPLERATE * buffer_ms_options[ms_option] / 1000, __ATOMIC_RELAXED);
+        __atomic_store_n(&state.buffer_count, buffer_count, __ATOMIC_RELAXED);
+
+        if (kDown & KEY_A)
+            __atomic_store_n(&state.measure_request, true, __ATOMIC_RELAXED);
+
+        for (u32 i = 0; i < sizeof(effect_keys) / sizeof(effect_keys[0]); i++)
+        {
+            if (kDown & effect_keys[i])
+                dsp_chain_set_enabled(&state.dsp, effect_stages[i], !dsp_chain_is_enabled(&state.dsp, effect_stages[i]));
+        }
 
-        // Copy the captured audio data into the playback buffer.
-        if ((released_in_buffer != NULL) && (released_out_buffer != NULL))
-            memcpy(released_out_buffer->buffer, released_in_buffer->buffer, released_in_buffer->data_size);
+        u64 latency_ns = __atomic_load_n(&state.latency_ns, __ATOMIC_RELAXED);
+        printf("\x1b[10;1Hbuffers: %u x %2u ms  ", buffer_count, buffer_ms_options[ms_option]);
+        printf("\x1b[11;1Hdropped: %u, underruns: %u  ",
+            __atomic_load_n(&state.dropped, __ATOMIC_RELAXED), __atomic_load_n(&state.underruns, __ATOMIC_RELAXED));
+        if (__atomic_load_n(&state.measurements, __ATOMIC_RELAXED))
+        {
+            if (latency_ns)
+                printf("\x1b[12;1Hround-trip latency: %3lu.%lu ms      ", latency_ns / 1000000, latency_ns / 100000 % 10);
+            else
+                printf("\x1b[12;1Hround-trip latency: click not heard");
+        }
 
-        // Append the released buffers again.
-        audinAppendAudioInBuffer(released_in_buffer);
-        audoutAppendAudioOutBuffer(released_out_buffer);
+        printf("\x1b[13;1Heffects:");
+        for (u32 i = 0; i < sizeof(effect_stages) / sizeof(effect_stages[0]); i++)
+            printf(" %s %s ", state.dsp.stages[effect_stages[i]].name, dsp_chain_is_enabled(&state.dsp, effect_stages[i]) ? "on " : "off");
+
+        // Print how long processing a buffer takes, about once per second.
+        if (++frame % 60 == 0)
+        {
+            u64 ticks = __atomic_exchange_n(&state.dsp.ticks, 0, __ATOMIC_RELAXED);
+            u32 blocks = __atomic_exchange_n(&state.dsp.blocks, 0, __ATOMIC_RELAXED);
+            if (blocks)
+                printf("\x1b[14;1Hdsp_chain_process: %6lu ns per buffer  ", armTicksToNs(ticks / blocks));
+
+            AudioStatsReport report;
+            char line[256];
+            audioStatsReport(&state.stats, &report, true);
+            audioStatsFormat(line, sizeof(line), "loopback", &report);
+            printf("\x1b[16;1H%s   ", line);
+            audioStatsLog(log_fd, "loopback", &report);
+        }
 
         consoleUpdate(NULL);
     }
 
+    if (R_SUCCEEDED(rc))
+    {
+        // Stop the audio thread.
+        __atomic_store_n(&state.exit, true, __ATOMIC_RELEASE);
+        threadWaitForExit(&state.thread);
+        threadClose(&state.thread);
+    }
+
     // Stop audio capture.
     rc = audinStopAudioIn();
     printf("audinStopAudioIn() returned 0x%x\n", rc);
@@ -143,6 +406,12 @@ int main(int argc, char **argv)
     audinExit();
     audoutExit();
 
+    free(in_buf_data);
+    free(out_buf_data);
+    audioStatsNxlinkClose(log_fd);
+    if (sockets_ok)
+        socketExit();
+
     consoleExit(NULL);
     return 0;
 }
@@ -4,55 +4,280 @@
 #include <malloc.h>
 #include <inttypes.h>
 #include <switch.h>
-#include <opus/opusfile.h>
 
-#include "sample_opus.h"
+#include "opus_demux.h"
+#include "stream_reader.h"
+#include "audio_stats.h"
+#include "trace.h"
 
-// Sample comes from this website:
+// Sample comes from this website (romfs:/sample.opus):
 // https://www.soundjay.com/magic-sound-effect.html
 
 //Example for playing audio decoded with hwopus using audren. This decodes Opus in hardware. For encoding this is not available with hwopus, hence that has to be done in software.
-//Requires package switch-opusfile.
-//This uses libopusfile, see also the docs for that.
-//Note that actual apps should handle audio on a dedicated thread.
+//The Ogg container is parsed by opus_demux.c, which lays the packets out in the format hwopus expects, so that they're decoded in place without extra copies.
+//Decoding and audrv are handled by a dedicated thread, which keeps a ring of short wavebufs queued: playback starts quickly, and isn't affected by the main loop stalling.
+//The file is streamed from sdmc:/music.opus if it exists (romfs:/sample.opus otherwise) by stream_reader.c, which reads ahead on its own thread, so that decoding doesn't wait on file I/O.
+//The player thread only holds its mutex around audrv calls: opening and reading the file, and decoding, happen without it, so that the main loop never waits on them.
+
+#define MAX_PACKET_SAMPLES 5760 // 120ms at 48kHz, the longest an Opus packet can be.
+#define MAX_SPANS 64
+
+#define RING_DEPTH 8   // Number of wavebufs in the ring.
+#define BUFFER_MS 10   // Minimum duration of each wavebuf.
+
+#define WINDOW_SIZE OPUS_DEMUX_MIN_WINDOW_SIZE
+
+//Spans of the player thread and of the main loop are written to the file, see trace.h
+//#define TRACE_FILE "sdmc:/hwopus_trace.json"
+
+typedef struct {
+    OpusDemuxer dmx;
+    u8* staging;
+    size_t staging_size;
+    OpusPacketSpan spans[MAX_SPANS];
+    int num_spans, cur_span;
+    s32 skip; // Samples still to be dropped from the start of the stream.
+} DecodeState;
+
+typedef struct {
+    Thread thread;
+    Mutex mutex; // Protects drv, and the fields below which are shared with the main thread.
+    bool exit;
+
+    AudioDriver* drv;
+
+    // Only used by the player thread
+    HwopusDecoder* decoder;
+    DecodeState decode;
+    StreamReader reader;
+    u8* window;
+    s16* mem;
+    int num_channels;
+    int sample_rate;
+    s32 slot_samples;   // Capacity of each wavebuf, per channel.
+    s32 target_samples; // What is decoded into each wavebuf at least, per channel.
+    AudioDriverWaveBuf wavebuf[RING_DEPTH];
+    int next; // Next wavebuf of the ring to be queued.
+    bool eof;
+    bool starved;
+
+    // Shared with the main thread
+    bool restart; // Set by the main thread to (re)start playback.
+    bool playing;
+
+    // Statistics
+    u32 underruns;
+    u32 min_queued; // Lowest number of wavebufs seen queued while playing.
+    u32 read_stalls; // Copy of reader.stalls, which is only updated by the player thread.
+    AudioStats stats; // Player thread wakeups, and queue depth while playing.
+} Player;
+
+static size_t staging_size = 0x10000;
+
+//Decodes packets straight into out until at least min_samples were decoded or there's no room left for another packet.
+//Returns the number of samples per channel, 0 at the end of the stream or -1 on error.
+static s32 hw_decode(HwopusDecoder *decoder, DecodeState *st, s16 *out, s32 min_samples, s32 max_samples, int num_channels) {
+    s32 total = 0;
+
+    while (total < min_samples && max_samples - total >= MAX_PACKET_SAMPLES) {
+        //Lay out as many packets as possible at once, then decode them one by one from the staging buffer.
+        if (st->cur_span == st->num_spans) {
+            st->num_spans = opus_demux_read_packets(&st->dmx, st->staging, st->staging_size, st->spans, MAX_SPANS);
+            st->cur_span = 0;
+            if (st->num_spans == 0) break;
+        }
 
-static size_t opuspkt_tmpbuf_size = sizeof(HwopusHeader) + 4096*48;
-static u8* opuspkt_tmpbuf;
+        const OpusPacketSpan *span = &st->spans[st->cur_span++];
+        s16 *dst = &out[total * num_channels];
+        s32 DecodedDataSize = 0;
+        s32 DecodedSampleCount = 0;
 
-int hw_decode(void *_ctx, OpusMSDecoder *_decoder, void *_pcm, const ogg_packet *_op, int _nsamples, int _nchannels, int _format, int _li) {
-    HwopusDecoder *decoder = (HwopusDecoder*)_ctx;
-    HwopusHeader *hdr = NULL;
-    size_t pktsize, pktsize_extra;
+        Result rc = hwopusDecodeInterleaved(decoder, &DecodedDataSize, &DecodedSampleCount, &st->staging[span->offset], span->size, dst, (max_samples - total) * num_channels * sizeof(s16));
+        if (R_FAILED(rc)) {
+            printf("hwopusDecodeInterleaved: %08" PRIx32 "\n", rc);
+            return -1;
+        }
+        if ((u32)DecodedDataSize != span->size) return -1;
+
+        //Drop the pre-skip samples given by the OpusHead.
+        if (st->skip) {
+            s32 n = st->skip < DecodedSampleCount ? st->skip : DecodedSampleCount;
+            memmove(dst, &dst[n * num_channels], (DecodedSampleCount - n) * num_channels * sizeof(s16));
+            DecodedSampleCount -= n;
+            st->skip -= n;
+        }
 
-    Result rc = 0;
-    s32 DecodedDataSize = 0;
-    s32 DecodedSampleCount = 0;
+        total += DecodedSampleCount;
+    }
 
-    if (_format != OP_DEC_FORMAT_SHORT) return OPUS_BAD_ARG;
+    return total;
+}
+
+static size_t demux_read(void* user, void* buf, size_t size) {
+    return stream_reader_read((StreamReader*)user, buf, size);
+}
+
+//Sets up voice 0 for the decoded samples. Dropping the voice releases it, so this is done again on every restart.
+static void player_voice_setup(AudioDriver* drv, int num_channels, int sample_rate) {
+    audrvVoiceInit(drv, 0, num_channels, PcmFormat_Int16, sample_rate);
+    audrvVoiceSetDestinationMix(drv, 0, AUDREN_FINAL_MIX_ID);
+    if (num_channels == 1) {//mono
+        audrvVoiceSetMixFactor(drv, 0, 1.0f, 0, 0);
+        audrvVoiceSetMixFactor(drv, 0, 1.0f, 0, 1);
+    }
+    else {//stereo
+        audrvVoiceSetMixFactor(drv, 0, 1.0f, 0, 0);
+        audrvVoiceSetMixFactor(drv, 0, 0.0f, 0, 1);
+        audrvVoiceSetMixFactor(drv, 0, 0.0f, 1, 0);
+        audrvVoiceSetMixFactor(drv, 0, 1.0f, 1, 1);
+    }
+}
 
-    pktsize = _op->bytes;//Opus packet size.
-    pktsize_extra = pktsize+8;//Packet size with HwopusHeader.
+//(Re)opens the file and starts demuxing it from the beginning. Called without the mutex held.
+static bool player_open(Player* p) {
+    TRACE_SCOPE("player_open");
+    stream_reader_close(&p->reader);
+    if (!stream_reader_open(&p->reader, "sdmc:/music.opus") && !stream_reader_open(&p->reader, "romfs:/sample.opus")) {
+        printf("Failed to open the file.\n");
+        return false;
+    }
 
-    if (pktsize_extra > opuspkt_tmpbuf_size) return OPUS_INTERNAL_ERROR;
+    if (!opus_demux_init_stream(&p->decode.dmx, demux_read, &p->reader, p->window, WINDOW_SIZE)) {
+        printf("Failed to parse the Ogg Opus file.\n");
+        return false;
+    }
 
-    hdr = (HwopusHeader*)opuspkt_tmpbuf;
-    memset(opuspkt_tmpbuf, 0, pktsize_extra);
+    if (p->decode.dmx.channels != p->num_channels)
+        printf("Warning: the file has %u channels, the decoder was initialized for %d.\n", p->decode.dmx.channels, p->num_channels);
 
-    hdr->size = __builtin_bswap32(pktsize);
-    memcpy(&opuspkt_tmpbuf[sizeof(HwopusHeader)], _op->packet, pktsize);
+    p->decode.num_spans = p->decode.cur_span = 0;
+    p->decode.skip = p->decode.dmx.pre_skip;
+    p->eof = false;
+    p->starved = false;
+    return true;
+}
 
-    rc = hwopusDecodeInterleaved(decoder, &DecodedDataSize, &DecodedSampleCount, opuspkt_tmpbuf, pktsize_extra, _pcm, _nsamples * _nchannels * sizeof(opus_int16));
+//Decodes into the free wavebufs of the ring, in order, and returns how many were filled; they're queued by the caller.
+//Called without the mutex held: only audrvUpdate, which runs on this thread too, changes the state of the wavebufs.
+static int player_decode(Player* p) {
+    TRACE_SCOPE("player_decode");
+    int filled = 0;
+    while (!p->eof && filled < RING_DEPTH) {
+        AudioDriverWaveBuf* wb = &p->wavebuf[(p->next + filled) % RING_DEPTH];
+        if (wb->state != AudioDriverWaveBufState_Free && wb->state != AudioDriverWaveBufState_Done)
+            break;
 
-    if (R_FAILED(rc)) return OPUS_INTERNAL_ERROR;
-    if (DecodedDataSize != pktsize_extra || DecodedSampleCount != _nsamples) return OPUS_INVALID_PACKET;
+        s16* curbuf = p->mem + wb->start_sample_offset * p->num_channels;
 
-    return 0;
+        //Decode directly into the wavebuf.
+        TRACE_SCOPE("decode wavebuf");
+        s32 decoded = hw_decode(p->decoder, &p->decode, curbuf, p->target_samples, p->slot_samples, p->num_channels);
+        if (decoded <= 0) {//End of file reached, or error.
+            if (decoded < 0)
+                printf("hw_decode() failed.\n");
+            p->eof = true;
+            break;
+        }
+
+        armDCacheFlush(curbuf, decoded * p->num_channels * sizeof(s16));
+        wb->end_sample_offset = wb->start_sample_offset + decoded;
+        filled++;
+    }
+    return filled;
+}
+
+static void player_thread_func(void* arg) {
+    Player* p = (Player*)arg;
+    traceSetThreadName("player");
+
+    while (!__atomic_load_n(&p->exit, __ATOMIC_ACQUIRE)) {
+        mutexLock(&p->mutex);
+
+        bool restart = p->restart;
+        p->restart = false;
+        if (restart) {
+            //Drop whatever is still queued, so that all the wavebufs can be reused right away.
+            p->playing = false;
+            audrvVoiceStop(p->drv, 0);
+            audrvVoiceDrop(p->drv, 0);
+            player_voice_setup(p->drv, p->num_channels, p->sample_rate);
+            for (int i = 0; i < RING_DEPTH; i++)
+                p->wavebuf[i].state = AudioDriverWaveBufState_Free;
+            p->next = 0;
+        }
+        bool playing = p->playing;
+
+        mutexUnlock(&p->mutex);
+
+        //The file I/O and the decoding happen outside of the mutex.
+        if (restart)
+            playing = player_open(p);
+        int filled = playing ? player_decode(p) : 0;
+
+        mutexLock(&p->mutex);
+
+        if (restart) {
+            p->playing = playing;
+            p->min_queued = RING_DEPTH;
+        }
+
+        if (p->playing) {
+            for (int i = 0; i < filled; i++) {
+                audrvVoiceAddWaveBuf(p->drv, 0, &p->wavebuf[p->next]);
+                p->next = (p->next + 1) % RING_DEPTH;
+            }
+
+            u32 queued = 0;
+            for (int i = 0; i < RING_DEPTH; i++) {
+                if (p->wavebuf[i].state == AudioDriverWaveBufState_Queued || p->wavebuf[i].state == AudioDriverWaveBufState_Playing)
+                    queued++;
+            }
+
+            if (queued == 0 && p->eof)
+                p->playing = false;
+            else {
+                //Running dry before the end of the stream is an underrun, which is counted once until the ring is refilled.
+                if (queued == 0 && !p->starved) {
+                    p->underruns++;
+                    audioStatsUnderrun(&p->stats);
+                }
+                audioStatsQueueDepth(&p->stats, queued);
+                p->starved = queued == 0;
+                if (queued < p->min_queued)
+                    p->min_queued = queued;
+
+                if (queued && !audrvVoiceIsPlaying(p->drv, 0))
+                    audrvVoiceStart(p->drv, 0);
+            }
+        }
+        p->read_stalls = p->reader.stalls;
+
+        Result res;
+        {
+            TRACE_SCOPE("audrvUpdate");
+            res = audrvUpdate(p->drv);
+        }
+        if (R_FAILED(res))
+            printf("audrvUpdate: %" PRIx32 "\n", res);
+        audioStatsEvent(&p->stats);
+
+        mutexUnlock(&p->mutex);
+
+        //Wake up once per audio renderer frame (5ms), which is when wavebufs get released.
+        TRACE_SCOPE("audrenWaitFrame");
+        audrenWaitFrame();
+    }
 }
 
 int main(void)
 {
     consoleInit(NULL);
 
+#ifdef TRACE_FILE
+    traceInit(TRACE_FILE);
+    traceSetThreadName("main");
+#endif
+
     printf("Simple hwopus-decoder example with audren\n");
 
     static const AudioRendererConfig arConfig =
@@ -67,16 +292,15 @@ int main(void)
 
     size_t num_channels = 1;
     size_t samplerate = 48000;
-    size_t max_samples = samplerate;
-    size_t max_samples_datasize = max_samples*num_channels*sizeof(opus_int16);
-    size_t mempool_size = (max_samples_datasize*2 + 0xFFF) &~ 0xFFF;//*2 for 2 wavebufs.
+    s32 target_samples = samplerate * BUFFER_MS / 1000;
+    s32 slot_samples = target_samples + MAX_PACKET_SAMPLES;//Room for one more packet, since packets don't have to line up with BUFFER_MS.
+    size_t slot_datasize = slot_samples*num_channels*sizeof(s16);
+    size_t mempool_size = (slot_datasize*RING_DEPTH + 0xFFF) &~ 0xFFF;
     void* mempool_ptr = memalign(0x1000, mempool_size);
-    void* tmpdata_ptr = malloc(max_samples_datasize);
-    opuspkt_tmpbuf = (u8*)malloc(opuspkt_tmpbuf_size);
-    opus_int16* curbuf = NULL;
+    u8* staging_ptr = (u8*)malloc(staging_size);
+    u8* window_ptr = (u8*)malloc(WINDOW_SIZE);
 
-    AudioDriverWaveBuf wavebuf[2] = {0};
-    int i, wavei;
+    int i;
 
     HwopusDecoder hwdecoder = {0};
 
@@ -84,21 +308,29 @@ int main(void)
     Result res=0;
     bool initedDriver = false;
     bool initedAudren = false;
-    bool audio_playing = false;
+    bool initedThread = false;
+
+    static Player player;
+    audioStatsInit(&player.stats);
 
-    int opret=0;
-    int total_samples_size=0;
-    OggOpusFile *of = NULL;
+    //Statistics are also sent to the nxlink host, when started with nxlink -s.
+    bool initedSockets = R_SUCCEEDED(socketInitializeDefault());
+    int log_fd = audioStatsNxlinkOpen();
+    u32 frame = 0;
 
     if (mempool_ptr) memset(mempool_ptr, 0, mempool_size);
-    if (tmpdata_ptr) memset(tmpdata_ptr, 0, max_samples_datasize);
-    if (opuspkt_tmpbuf) memset(opuspkt_tmpbuf, 0, opuspkt_tmpbuf_size);
 
-    if (mempool_ptr==NULL || tmpdata_ptr==NULL || opuspkt_tmpbuf==NULL) {
+    if (mempool_ptr==NULL || staging_ptr==NULL || window_ptr==NULL) {
         res = 1;
         printf("Failed to allocate memory.\n");
     }
 
+    if (R_SUCCEEDED(res)) {
+        res = romfsInit();
+        if (R_FAILED(res))
+            printf("romfsInit: %08" PRIx32 "\n", res);
+    }
+
     if (R_SUCCEEDED(res)) {
         res = hwopusDecoderInitialize(&hwdecoder, samplerate, num_channels);//This assumes that the opus file is <samplerate> with <num_channels>.
         if (R_FAILED(res))
@@ -122,7 +354,7 @@ int main(void)
                     audrvMemPoolAttach(&drv, mpid);
 
                     static const u8 sink_channels[] = { 0, 1 };
-                    int sink = audrvDeviceSinkAdd(&drv, AUDREN_DEFAULT_DEVICE_NAME, 2, sink_channels);
+                    audrvDeviceSinkAdd(&drv, AUDREN_DEFAULT_DEVICE_NAME, 2, sink_channels);
 
                     res = audrvUpdate(&drv);
                     printf("audrvUpdate: %" PRIx32 "\n", res);
@@ -130,125 +362,118 @@ int main(void)
                     res = audrenStartAudioRenderer();
                     printf("audrenStartAudioRenderer: %" PRIx32 "\n", res);
 
-                    audrvVoiceInit(&drv, 0, num_channels, PcmFormat_Int16, samplerate);
-                    audrvVoiceSetDestinationMix(&drv, 0, AUDREN_FINAL_MIX_ID);
-                    if (num_channels == 1) {//mono
-                        audrvVoiceSetMixFactor(&drv, 0, 1.0f, 0, 0);
-                        audrvVoiceSetMixFactor(&drv, 0, 1.0f, 0, 1);
+                    player_voice_setup(&drv, num_channels, samplerate);
+
+                    player.drv = &drv;
+                    player.decoder = &hwdecoder;
+                    player.decode.staging = staging_ptr;
+                    player.decode.staging_size = staging_size;
+                    player.window = window_ptr;
+                    player.mem = (s16*)mempool_ptr;
+                    player.num_channels = num_channels;
+                    player.sample_rate = samplerate;
+                    player.slot_samples = slot_samples;
+                    player.target_samples = target_samples;
+                    mutexInit(&player.mutex);
+
+                    for(i=0; i<RING_DEPTH; i++) {
+                        player.wavebuf[i].data_raw = mempool_ptr;
+                        player.wavebuf[i].size = mempool_size;
+                        player.wavebuf[i].start_sample_offset = i * slot_samples;
+                        player.wavebuf[i].end_sample_offset = player.wavebuf[i].start_sample_offset + slot_samples;
                     }
-                    else {//stereo
-                        audrvVoiceSetMixFactor(&drv, 0, 1.0f, 0, 0);
-                        audrvVoiceSetMixFactor(&drv, 0, 0.0f, 0, 1);
-                        audrvVoiceSetMixFactor(&drv, 0, 0.0f, 1, 0);
-                        audrvVoiceSetMixFactor(&drv, 0, 1.0f, 1, 1);
-                    }
-                    audrvVoiceStart(&drv, 0);
 
-                    for(i=0; i<2; i++) {
-                        wavebuf[i].data_raw = mempool_ptr;
-                        wavebuf[i].size = max_samples_datasize*2;//*2 for 2 wavebufs.
-                        wavebuf[i].start_sample_offset = i * max_samples;
-                        wavebuf[i].end_sample_offset = wavebuf[i].start_sample_offset + max_samples;
-                    }
+                    //From here on, audrv is only used by the player thread, or with its mutex held.
+                    //Use a higher priority than the main thread, so that decoding is never delayed by it.
+                    res = threadCreate(&player.thread, player_thread_func, &player, NULL, 0x4000, 0x2B, -2);
+                    if (R_SUCCEEDED(res))
+                        res = threadStart(&player.thread);
+                    initedThread = R_SUCCEEDED(res);
+                    if (R_FAILED(res))
+                        printf("Player thread start: %08" PRIx32 "\n", res);
                 }
             }
         }
     }
 
-    if (initedDriver)
-        printf("done. Press A to play a sound.\n");
+    if (initedThread)
+        printf("done. Press A to play a sound, hold B to stall the main loop.\n");
     else
         printf("Init failed.\n");
 
+    printf("Ring: %d wavebufs of %d ms or more.\n", RING_DEPTH, BUFFER_MS);
+
     // Main loop
     while (appletMainLoop())
     {
+        TRACE_SCOPE("frame");
         hidScanInput();
 
         u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+        u64 kHeld = hidKeysHeld(CONTROLLER_P1_AUTO);
 
         if (kDown & KEY_PLUS)
             break;
 
-        if (initedDriver)
+        if (initedThread)
         {
             if (kDown & KEY_A)
             {
-                //Close the opus-file if needed and (re)open it, since libopusfile doesn't support seek-to-beginning.
-                if (of)
-                    op_free(of);
-                of = op_open_memory (sample_opus, sample_opus_size, NULL);
-                if (of == NULL) {
-                    printf("Failed to open OggOpusFile.\n");
-                }
-                else {
-                    op_set_decode_callback(of, hw_decode, &hwdecoder);
-
-                    audrvVoiceStop(&drv, 0);
-                    audio_playing = true;
-                }
+                //The player thread reopens the file itself, the main loop never waits on file I/O.
+                mutexLock(&player.mutex);
+                player.restart = true;
+                mutexUnlock(&player.mutex);
             }
 
-            if (audio_playing) {
-                wavei = -1;
-                for(i=0; i<2; i++) {
-                    if (wavebuf[i].state == AudioDriverWaveBufState_Free || wavebuf[i].state == AudioDriverWaveBufState_Done) {
-                        wavei = i;
-                        break;
-                    }
-                }
+            mutexLock(&player.mutex);
 
-                if (wavei >= 0) {
-                    curbuf = (opus_int16*)(mempool_ptr + wavebuf[wavei].start_sample_offset);
+            printf("\x1b[8;1Hplaying = %d, sample count = %8" PRIu32 ", underruns = %" PRIu32 ", min queued = %" PRIu32 ", read stalls = %" PRIu32 "   \n",
+                player.playing, audrvVoiceGetPlayedSampleCount(&drv, 0), player.underruns, player.min_queued, player.read_stalls);
 
-                    opret = op_read(of, tmpdata_ptr, max_samples * num_channels, NULL);//The buffer used here has to be seperate from mempool_ptr.
-                    if (opret < 0)
-                        printf("op_read() failed: %d\n", opret);
-                    else if (opret == 0) {//End of file reached (see also libopusfile docs).
-                        audio_playing = false;
-
-                        if (of)
-                            op_free(of);
-                        of = NULL;
-                    }
-                    else {
-                        if (opret > max_samples) opret = max_samples;//Should never happen.
-                        total_samples_size = opret*sizeof(opus_int16);//Total samples data-size per channel.
-                        memcpy(curbuf, tmpdata_ptr, total_samples_size);
-                        armDCacheFlush(curbuf, total_samples_size);
+            mutexUnlock(&player.mutex);
 
-                        wavebuf[wavei].end_sample_offset = wavebuf[wavei].start_sample_offset + total_samples_size/sizeof(opus_int16);
-
-                        audrvVoiceAddWaveBuf(&drv, 0, &wavebuf[wavei]);
-                    }
-                }
-                else {
-                    if (!audrvVoiceIsPlaying(&drv, 0))
-                        audrvVoiceStart(&drv, 0);
-                }
+            //About once per second.
+            if (++frame % 60 == 0) {
+                AudioStatsReport report;
+                char line[256];
+                audioStatsReport(&player.stats, &report, true);
+                audioStatsFormat(line, sizeof(line), "player", &report);
+                printf("\x1b[10;1H%s   ", line);
+                audioStatsLog(log_fd, "player", &report);
             }
-
-            res = audrvUpdate(&drv);
-            if (R_FAILED(res))
-                printf("audrvUpdate: %" PRIx32 "\n", res);
-            if (audrvVoiceIsPlaying(&drv, 0))
-                printf("sample count = %" PRIu32 "\n", audrvVoiceGetPlayedSampleCount(&drv, 0));
         }
 
         consoleUpdate(NULL);
+
+        //Simulate a render hitch, playback carries on regardless.
+        if (kHeld & KEY_B)
+            svcSleepThread(100000000ULL);
+    }
+
+    if (initedThread) {
+        __atomic_store_n(&player.exit, true, __ATOMIC_RELEASE);
+        threadWaitForExit(&player.thread);
+        threadClose(&player.thread);
     }
+    stream_reader_close(&player.reader);
 
     hwopusDecoderExit(&hwdecoder);
-    if (of)
-        op_free(of);
     if (initedDriver)
         audrvClose(&drv);
     if (initedAudren)
         audrenExit();
+    romfsExit();
 
     free(mempool_ptr);
-    free(tmpdata_ptr);
-    free(opuspkt_tmpbuf);
+    free(staging_ptr);
+    free(window_ptr);
+    audioStatsNxlinkClose(log_fd);
+    if (initedSockets)
+        socketExit();
+
+#ifdef TRACE_FILE
+    traceExit();
+#endif
 
     consoleExit(NULL);
     return 0;
@@ -0,0 +1,230 @@
+#include <string.h>
+#include <stdint.h>
+
+#include "opus_demux.h"
+
+#define OGG_PAGE_HEADER_SIZE 27
+
+static u32 read_le32(const u8* p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((u32)p[3] << 24);
+}
+
+// Drops the window data which is no longer needed, and reads more. Returns false if nothing could be read.
+static bool refill(OpusDemuxer* dmx)
+{
+    if (!dmx->read || dmx->end_of_data)
+        return false;
+
+    OpusDemuxCursor* cur = &dmx->cur;
+    size_t keep = dmx->anchor != SIZE_MAX ? dmx->anchor : cur->page ? (size_t)(cur->page - dmx->data) : cur->pos;
+    if (keep) {
+        memmove(dmx->window, dmx->window + keep, dmx->size - keep);
+        dmx->size -= keep;
+        dmx->base += keep;
+        cur->pos -= keep;
+        if (cur->page) {
+            cur->page -= keep;
+            cur->body -= keep;
+            cur->lacing -= keep;
+        }
+        if (dmx->anchor != SIZE_MAX)
+            dmx->anchor -= keep;
+    }
+
+    size_t want = dmx->window_size - dmx->size;
+    size_t got = want ? dmx->read(dmx->user, dmx->window + dmx->size, want) : 0;
+    dmx->size += got;
+    if (got < want)
+        dmx->end_of_data = true;
+    return got != 0;
+}
+
+// Moves on to the next page of our stream. Returns false at the end of the data.
+static bool next_page(OpusDemuxer* dmx)
+{
+    OpusDemuxCursor* cur = &dmx->cur;
+
+    for (;;) {
+        if (cur->pos + OGG_PAGE_HEADER_SIZE > dmx->size) {
+            if (refill(dmx))
+                continue;
+            return false;
+        }
+
+        const u8* hdr = &dmx->data[cur->pos];
+        if (memcmp(hdr, "OggS", 4) != 0 || hdr[4] != 0)
+            return false;
+
+        u32 num_lacing = hdr[26];
+        if (cur->pos + OGG_PAGE_HEADER_SIZE + num_lacing > dmx->size) {
+            if (refill(dmx))
+                continue;
+            return false;
+        }
+
+        u32 body_size = 0;
+        for (u32 i = 0; i < num_lacing; i++)
+            body_size += hdr[OGG_PAGE_HEADER_SIZE + i];
+
+        size_t body_pos = cur->pos + OGG_PAGE_HEADER_SIZE + num_lacing;
+        if (body_pos + body_size > dmx->size) {
+            if (refill(dmx))
+                continue;
+            return false;
+        }
+        cur->pos = body_pos + body_size;
+
+        // Skip pages of other logical streams
+        if (read_le32(&hdr[14]) != dmx->serial)
+            continue;
+
+        cur->page = hdr;
+        cur->lacing = &hdr[OGG_PAGE_HEADER_SIZE];
+        cur->num_lacing = num_lacing;
+        cur->cur_lacing = 0;
+        cur->body = &dmx->data[body_pos];
+        cur->body_pos = 0;
+        return true;
+    }
+}
+
+// Goes back to a saved cursor, which may have been moved by a refill since
+static void restore(OpusDemuxer* dmx, const OpusDemuxCursor* saved, size_t saved_base)
+{
+    size_t shift = dmx->base - saved_base;
+    dmx->cur = *saved;
+    dmx->cur.pos -= shift;
+    if (saved->page) {
+        dmx->cur.page -= shift;
+        dmx->cur.body -= shift;
+        dmx->cur.lacing -= shift;
+    }
+}
+
+// Copies the next packet to dst (if there's room for it), returning its size, or -1 at the end of the stream.
+// The packet is consumed only if it was copied, or if dst is NULL (which skips it).
+static s32 read_packet(OpusDemuxer* dmx, u8* dst, size_t dst_size, bool* fits)
+{
+    OpusDemuxCursor* cur = &dmx->cur;
+    OpusDemuxCursor saved = *cur;
+    size_t saved_base = dmx->base;
+    size_t size = 0;
+    *fits = true;
+
+    // Keep the data the cursor may go back to. Skipped packets are never gone back to, and may be larger than the window.
+    if (dst)
+        dmx->anchor = cur->page ? (size_t)(cur->page - dmx->data) : cur->pos;
+
+    for (;;) {
+        if (cur->cur_lacing == cur->num_lacing && !next_page(dmx)) {
+            if (dst)
+                restore(dmx, &saved, saved_base);
+            dmx->anchor = SIZE_MAX;
+            return -1;
+        }
+
+        // When it doesn't fit, keep scanning only to report the full size
+        u32 len = cur->lacing[cur->cur_lacing++];
+        if (!dst || size + len > dst_size)
+            *fits = false;
+        if (*fits)
+            memcpy(&dst[size], &cur->body[cur->body_pos], len);
+        cur->body_pos += len;
+        size += len;
+
+        // A lacing value below 255 ends the packet, otherwise it continues (possibly on the next page)
+        if (len < 255)
+            break;
+    }
+
+    if (!*fits && dst)
+        restore(dmx, &saved, saved_base);
+    dmx->anchor = SIZE_MAX;
+    return size;
+}
+
+static bool parse_head(OpusDemuxer* dmx)
+{
+    // The stream of the first page is the one we play
+    if (dmx->size < OGG_PAGE_HEADER_SIZE || memcmp(dmx->data, "OggS", 4) != 0)
+        return false;
+    dmx->serial = read_le32(&dmx->data[14]);
+
+    // 19 bytes, plus the channel mapping table for mapping families other than 0
+    u8 head[19 + 2 + 255];
+    bool fits;
+    s32 head_size = read_packet(dmx, head, sizeof(head), &fits);
+    if (head_size < 19 || !fits || memcmp(head, "OpusHead", 8) != 0)
+        return false;
+
+    dmx->channels = head[9];
+    dmx->pre_skip = head[10] | (head[11] << 8);
+    dmx->input_sample_rate = read_le32(&head[12]);
+
+    // OpusTags comes next, and is skipped by opus_demux_read_packets
+    dmx->headers_left = 1;
+    return true;
+}
+
+bool opus_demux_init(OpusDemuxer* dmx, const void* data, size_t size)
+{
+    memset(dmx, 0, sizeof(*dmx));
+    dmx->data = (const u8*)data;
+    dmx->size = size;
+    dmx->anchor = SIZE_MAX;
+    dmx->end_of_data = true;
+
+    return parse_head(dmx);
+}
+
+bool opus_demux_init_stream(OpusDemuxer* dmx, OpusDemuxReadFn read, void* user, void* window, size_t window_size)
+{
+    memset(dmx, 0, sizeof(*dmx));
+    if (window_size < OPUS_DEMUX_MIN_WINDOW_SIZE)
+        return false;
+
+    dmx->read = read;
+    dmx->user = user;
+    dmx->window = (u8*)window;
+    dmx->window_size = window_size;
+    dmx->data = dmx->window;
+    dmx->anchor = SIZE_MAX;
+
+    refill(dmx);
+    return parse_head(dmx);
+}
+
+int opus_demux_read_packets(OpusDemuxer* dmx, u8* buf, size_t buf_size, OpusPacketSpan* spans, int max_spans)
+{
+    int count = 0;
+    size_t pos = 0;
+
+    // OpusTags can be large (cover art...), it's skipped without being copied
+    bool fits;
+    for (; dmx->headers_left; dmx->headers_left--) {
+        if (read_packet(dmx, NULL, 0, &fits) < 0)
+            return 0;
+    }
+
+    while (count < max_spans && pos + sizeof(HwopusHeader) < buf_size) {
+        s32 size = read_packet(dmx, &buf[pos + sizeof(HwopusHeader)], buf_size - pos - sizeof(HwopusHeader), &fits);
+        if (size < 0 || !fits)
+            break;
+        if (size == 0)
+            continue;
+
+        HwopusHeader* hdr = (HwopusHeader*)&buf[pos];
+        hdr->size = __builtin_bswap32(size);
+        hdr->final_range = 0;
+
+        spans[count].offset = pos;
+        spans[count].size = sizeof(HwopusHeader) + size;
+        count++;
+
+        // Keep the headers 4-byte aligned
+        pos = (pos + sizeof(HwopusHeader) + size + 3) &~ 3;
+    }
+
+    return count;
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <switch.h>
+
+// Minimal Ogg Opus demuxer, laying packets out the way hwopus wants them.
+//
+// hwopusDecodeInterleaved expects every packet to be preceded by a HwopusHeader. Instead of
+// extracting each packet (libogg copies it once) and then copying it again behind a header,
+// opus_demux_read_packets copies the packet data straight out of the Ogg pages into a staging
+// buffer, with room for the header reserved in front of each one. Packets end up back to back,
+// and are then decoded in place, one after the other.
+//
+// The file is either held in memory, or streamed through a read callback into a window buffer,
+// which is compacted and topped up whenever the next page isn't entirely in it.
+//
+// Only single stream (non-chained) files are handled, and page CRCs are not checked.
+
+// Large enough for two pages of the maximum size
+#define OPUS_DEMUX_MIN_WINDOW_SIZE 0x20000
+
+// Returns the number of bytes read, less than size only at the end of the stream
+typedef size_t (*OpusDemuxReadFn)(void* user, void* buf, size_t size);
+
+typedef struct {
+    u32 offset; // of the HwopusHeader in the staging buffer
+    u32 size;   // including the HwopusHeader
+} OpusPacketSpan;
+
+// Position in the data, everything points into it so that it's cheap to save
+typedef struct {
+    size_t pos;        // of the next page
+    const u8* page;    // being read
+    const u8* body;
+    u32 body_pos;
+    const u8* lacing;
+    u32 num_lacing;
+    u32 cur_lacing;
+} OpusDemuxCursor;
+
+typedef struct {
+    const u8* data;
+    size_t size;
+    OpusDemuxCursor cur;
+
+    // Streaming only
+    OpusDemuxReadFn read;
+    void* user;
+    u8* window;
+    size_t window_size;
+    size_t base;       // Stream offset of the start of the window
+    size_t anchor;     // Compaction keeps everything from there on, SIZE_MAX if unset
+    bool end_of_data;
+
+    u32 serial;
+    int headers_left;  // OpusTags is skipped
+
+    // From OpusHead
+    u8 channels;
+    u16 pre_skip;
+    u32 input_sample_rate;
+} OpusDemuxer;
+
+// Returns false if the data doesn't start with a valid OpusHead
+bool opus_demux_init(OpusDemuxer* dmx, const void* data, size_t size);
+
+// Same, for a stream: window is owned by the caller, and must be at least OPUS_DEMUX_MIN_WINDOW_SIZE
+bool opus_demux_init_stream(OpusDemuxer* dmx, OpusDemuxReadFn read, void* user, void* window, size_t window_size);
+
+// Lays out as many audio packets as fit in the staging buffer (up to max_spans), returning their count.
+// Returns 0 at the end of the stream.
+int opus_demux_read_packets(OpusDemuxer* dmx, u8* buf, size_t buf_size, OpusPacketSpan* spans, int max_spans);
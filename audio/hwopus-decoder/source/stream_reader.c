@@ -0,0 +1,141 @@
+#include <string.h>
+#include <malloc.h>
+
+#include "stream_reader.h"
+
+static void stream_reader_thread_func(void* arg)
+{
+    StreamReader* r = (StreamReader*)arg;
+
+    for (;;) {
+        mutexLock(&r->mutex);
+        int i = r->fill_chunk;
+        bool full = r->ready[i];
+        bool stop = r->exit;
+        mutexUnlock(&r->mutex);
+
+        if (stop)
+            break;
+        if (full) {
+            waitSingle(waiterForUEvent(&r->space_event), -1);
+            continue;
+        }
+
+        // The chunk isn't visible to the reading side until it's marked ready
+        size_t n = fread(r->chunks[i], 1, STREAM_READER_CHUNK_SIZE, r->f);
+
+        mutexLock(&r->mutex);
+        r->chunk_size[i] = n;
+        r->ready[i] = true;
+        r->eof = n < STREAM_READER_CHUNK_SIZE;
+        r->fill_chunk = i ^ 1;
+        stop = r->eof;
+        mutexUnlock(&r->mutex);
+
+        ueventSignal(&r->data_event);
+        if (stop)
+            break;
+    }
+}
+
+bool stream_reader_open(StreamReader* r, const char* path)
+{
+    memset(r, 0, sizeof(*r));
+
+    r->f = fopen(path, "rb");
+    if (!r->f)
+        return false;
+
+    // Chunks are read whole, stdio buffering would only add a copy
+    setvbuf(r->f, NULL, _IONBF, 0);
+
+    r->mem = (u8*)memalign(0x1000, 2 * STREAM_READER_CHUNK_SIZE);
+    if (!r->mem) {
+        fclose(r->f);
+        r->f = NULL;
+        return false;
+    }
+    r->chunks[0] = r->mem;
+    r->chunks[1] = r->mem + STREAM_READER_CHUNK_SIZE;
+
+    mutexInit(&r->mutex);
+    ueventCreate(&r->data_event, true);
+    ueventCreate(&r->space_event, true);
+
+    // Same priority as the player thread: reading is mostly waiting on the filesystem anyway
+    Result rc = threadCreate(&r->thread, stream_reader_thread_func, r, NULL, 0x4000, 0x2B, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&r->thread);
+        if (R_FAILED(rc))
+            threadClose(&r->thread);
+    }
+    if (R_FAILED(rc)) {
+        free(r->mem);
+        fclose(r->f);
+        memset(r, 0, sizeof(*r));
+        return false;
+    }
+    return true;
+}
+
+void stream_reader_close(StreamReader* r)
+{
+    if (!r->f)
+        return;
+
+    mutexLock(&r->mutex);
+    r->exit = true;
+    mutexUnlock(&r->mutex);
+    ueventSignal(&r->space_event);
+
+    threadWaitForExit(&r->thread);
+    threadClose(&r->thread);
+
+    free(r->mem);
+    fclose(r->f);
+    memset(r, 0, sizeof(*r));
+}
+
+size_t stream_reader_read(StreamReader* r, void* buf, size_t size)
+{
+    u8* dst = (u8*)buf;
+    size_t done = 0;
+
+    while (done < size) {
+        int i = r->read_chunk;
+
+        mutexLock(&r->mutex);
+        bool ready = r->ready[i];
+        bool eof = r->eof;
+        mutexUnlock(&r->mutex);
+
+        if (!ready) {
+            // Once the last chunk was loaded, a chunk which isn't ready never will be
+            if (eof)
+                break;
+            r->stalls++;
+            waitSingle(waiterForUEvent(&r->data_event), -1);
+            continue;
+        }
+
+        size_t n = r->chunk_size[i] - r->read_pos;
+        if (n > size - done)
+            n = size - done;
+        memcpy(&dst[done], &r->chunks[i][r->read_pos], n);
+        r->read_pos += n;
+        done += n;
+
+        // Hand the chunk back to the thread as soon as it's consumed
+        if (r->read_pos == r->chunk_size[i]) {
+            mutexLock(&r->mutex);
+            r->ready[i] = false;
+            mutexUnlock(&r->mutex);
+            ueventSignal(&r->space_event);
+
+            r->read_chunk = i ^ 1;
+            r->read_pos = 0;
+        }
+    }
+
+    return done;
+}
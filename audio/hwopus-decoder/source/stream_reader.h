@@ -0,0 +1,39 @@
+#pragma once
+#include <stdio.h>
+#include <switch.h>
+
+// Read-ahead file reader, for streaming audio from sdmc or romfs.
+//
+// A thread reads the file in large aligned chunks into a double buffer, unbuffered, so that each
+// chunk is a single read straight into its final place. stream_reader_read only copies out of
+// chunks which are already loaded: as long as the read-ahead keeps up, the caller never waits on I/O.
+
+#define STREAM_READER_CHUNK_SIZE 0x20000
+
+typedef struct {
+    Thread thread;
+    Mutex mutex;         // Protects ready, chunk_size, eof and exit
+    UEvent data_event;   // A chunk was loaded
+    UEvent space_event;  // A chunk was consumed
+
+    FILE* f;
+    u8* mem;
+    u8* chunks[2];
+    size_t chunk_size[2];
+    bool ready[2];
+    int fill_chunk;      // Next chunk the thread loads
+    bool eof;
+    bool exit;
+
+    // Only used by the reading side
+    int read_chunk;
+    size_t read_pos;
+    u32 stalls;          // Number of times a read had to wait for the thread
+} StreamReader;
+
+// Returns false if the file can't be opened
+bool stream_reader_open(StreamReader* r, const char* path);
+void stream_reader_close(StreamReader* r);
+
+// Returns the number of bytes read, less than size only at the end of the file
+size_t stream_reader_read(StreamReader* r, void* buf, size_t size);
@@ -5,22 +5,73 @@
 
 #include <switch.h>
 
-#define SAMPLERATE 48000
+#include "synth.h"
+#include "audio_stats.h"
+#include "trace.h"
+
+#define SAMPLERATE SYNTH_SAMPLE_RATE
 #define CHANNELCOUNT 2
-#define FRAMERATE (1000 / 30)
-#define SAMPLECOUNT (SAMPLERATE / FRAMERATE)
+#define SAMPLECOUNT 480 // 10ms per buffer
 #define BYTESPERSAMPLE 2
+#define BUFFERCOUNT 3
+
+// Spans of the audio thread and of the main loop are written to the file, see trace.h
+//#define TRACE_FILE "sdmc:/playtone_trace.json"
+
+typedef struct {
+    Synth synth;
+    AudioOutBuffer buffers[BUFFERCOUNT];
+    Thread thread;
+    bool exit;
 
-void fill_audio_buffer(void* audio_buffer, size_t offset, size_t size, int frequency) {
-    if (audio_buffer == NULL) return;
-    
-    u32* dest = (u32*) audio_buffer;
-    for (int i = 0; i < size; i++) {
-        // This is a simple sine wave, with a frequency of `frequency` Hz, and an amplitude 30% of maximum.
-        s16 sample = 0.3 * 0x7FFF * sin(frequency * (2 * M_PI) * (offset + i) / SAMPLERATE);
+    // Time spent in synth_render, for the statistics shown by the main thread
+    u64 render_ticks;
+    u32 render_blocks;
 
-        // Stereo samples are interleaved: left and right channels.
-        dest[i] = (sample << 16) | (sample & 0xffff);
+    // Wakeups and queue depth of the audio thread
+    AudioStats stats;
+} AudioThreadState;
+
+// The audio thread keeps the audout queue full, rendering each buffer as soon as it's released.
+// The main thread only updates the voices, it never waits on audio.
+static void audio_thread_func(void* arg)
+{
+    AudioThreadState* state = (AudioThreadState*)arg;
+    traceSetThreadName("audio");
+
+    while (!__atomic_load_n(&state->exit, __ATOMIC_ACQUIRE))
+    {
+        AudioOutBuffer *released = NULL;
+        u32 released_count = 0;
+        Result rc = audoutWaitPlayFinish(&released, &released_count, 100000000ULL);
+        if (R_FAILED(rc) || !released)
+            continue;
+
+        audioStatsEvent(&state->stats);
+
+        // Only one buffer is returned at a time, the others which may have been released meanwhile are picked up without waiting.
+        // How many there were tells how far the queue was drained.
+        u32 pending = 0;
+        while (released && released_count)
+        {
+            TRACE_SCOPE("synth_render");
+            u64 start = armGetSystemTick();
+            synth_render(&state->synth, (s16*)released->buffer, SAMPLECOUNT);
+            u64 ticks = armGetSystemTick() - start;
+            __atomic_fetch_add(&state->render_ticks, ticks, __ATOMIC_RELAXED);
+            __atomic_fetch_add(&state->render_blocks, 1, __ATOMIC_RELAXED);
+
+            audoutAppendAudioOutBuffer(released);
+            pending++;
+
+            released = NULL;
+            if (R_FAILED(audoutGetReleasedAudioOutBuffer(&released, &released_count)))
+                break;
+        }
+
+        audioStatsQueueDepth(&state->stats, BUFFERCOUNT - pending);
+        if (pending >= BUFFERCOUNT)
+            audioStatsUnderrun(&state->stats);
     }
 }
 
@@ -35,18 +86,36 @@ int main(int argc, char **argv)
         7040, 3520, 1760, 880, 440
     };
 
+    // One voice per button, so that several tones can be held at once.
+    u64 notekeys[] = {
+        KEY_A,
+        KEY_B, KEY_Y, KEY_X, KEY_DLEFT, KEY_DUP,
+        KEY_DRIGHT,
+        KEY_DDOWN, KEY_L, KEY_R, KEY_ZL, KEY_ZR
+    };
+
     // Initialize console. Using NULL as the second argument tells the console library to use the internal console structure as current one.
     consoleInit(NULL);
 
-    AudioOutBuffer audout_buf;
-    AudioOutBuffer *audout_released_buf;
+#ifdef TRACE_FILE
+    traceInit(TRACE_FILE);
+    traceSetThreadName("main");
+#endif
+
+    static AudioThreadState audio;
+    synth_init(&audio.synth);
+    audioStatsInit(&audio.stats);
+
+    // Statistics are also sent to the nxlink host, when started with nxlink -s
+    bool sockets_ok = R_SUCCEEDED(socketInitializeDefault());
+    int log_fd = audioStatsNxlinkOpen();
 
     // Make sure the sample buffer size is aligned to 0x1000 bytes.
     u32 data_size = (SAMPLECOUNT * CHANNELCOUNT * BYTESPERSAMPLE);
     u32 buffer_size = (data_size + 0xfff) & ~0xfff;
 
-    // Allocate the buffer.
-    u8* out_buf_data = memalign(0x1000, buffer_size);
+    // Allocate the buffers.
+    u8* out_buf_data = memalign(0x1000, buffer_size * BUFFERCOUNT);
 
     // Ensure buffers were properly allocated.
     if (out_buf_data == NULL)
@@ -56,7 +125,7 @@ int main(int argc, char **argv)
     }
 
     if (R_SUCCEEDED(rc))
-        memset(out_buf_data, 0, buffer_size);
+        memset(out_buf_data, 0, buffer_size * BUFFERCOUNT);
 
     if (R_SUCCEEDED(rc))
     {
@@ -77,115 +146,76 @@ int main(int argc, char **argv)
         printf("audoutStartAudioOut() returned 0x%x\n", rc);
     }
 
-    bool play_tone = false;
-    printf("Press A, B, Y, X, Left, Up, Right, Down, L, R, ZL or ZR to play a different tone.\n");
-
-    while (appletMainLoop())
+    if (R_SUCCEEDED(rc))
     {
-        //Scan all the inputs. This should be done once for each frame
-        hidScanInput();
-
-        //hidKeysDown returns information about which buttons have been just pressed (and they weren't in the previous frame)
-        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
-
-        if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
-
-        if (kDown & KEY_A)
-        {
-            fill_audio_buffer(out_buf_data, 0, data_size, notefreq[0]);
-            play_tone = true;
-        }
-
-        if (kDown & KEY_B)
-        {
-            fill_audio_buffer(out_buf_data, 0, data_size, notefreq[1]);
-            play_tone = true;
-        }
-
-        if (kDown & KEY_Y)
-        {
-            fill_audio_buffer(out_buf_data, 0, data_size, notefreq[2]);
-            play_tone = true;
-        }
-
-        if (kDown & KEY_X)
+        // Queue all the (silent) buffers, the audio thread then refills them as they're released.
+        for (int i = 0; i < BUFFERCOUNT; i++)
         {
-            fill_audio_buffer(out_buf_data, 0, data_size, notefreq[3]);
-            play_tone = true;
+            AudioOutBuffer* buf = &audio.buffers[i];
+            buf->next = NULL;
+            buf->buffer = out_buf_data + i * buffer_size;
+            buf->buffer_size = buffer_size;
+            buf->data_size = data_size;
+            buf->data_offset = 0;
+            audoutAppendAudioOutBuffer(buf);
         }
 
-        if (kDown & KEY_DLEFT)
-        {
-            fill_audio_buffer(out_buf_data, 0, data_size, notefreq[4]);
-            play_tone = true;
-        }
+        // Use a higher priority than the main thread, so that rendering audio is never delayed by it.
+        rc = threadCreate(&audio.thread, audio_thread_func, &audio, NULL, 0x4000, 0x2B, -2);
+        if (R_SUCCEEDED(rc))
+            rc = threadStart(&audio.thread);
+        printf("Audio thread start returned 0x%x\n", rc);
+    }
 
-        if (kDown & KEY_DUP)
-        {
-            fill_audio_buffer(out_buf_data, 0, data_size, notefreq[5]);
-            play_tone = true;
-        }
+    printf("Hold A, B, Y, X, Left, Up, Right, Down, L, R, ZL or ZR to play a different tone.\n");
 
-        if (kDown & KEY_DRIGHT)
-        {
-            fill_audio_buffer(out_buf_data, 0, data_size, notefreq[6]);
-            play_tone = true;
-        }
+    u32 frame = 0;
 
-        if (kDown & KEY_DDOWN)
-        {
-            fill_audio_buffer(out_buf_data, 0, data_size, notefreq[7]);
-            play_tone = true;
-        }
+    while (appletMainLoop())
+    {
+        TRACE_SCOPE("frame");
 
-        if (kDown & KEY_L)
-        {
-            fill_audio_buffer(out_buf_data, 0, data_size, notefreq[8]);
-            play_tone = true;
-        }
+        //Scan all the inputs. This should be done once for each frame
+        hidScanInput();
 
-        if (kDown & KEY_R)
-        {
-            fill_audio_buffer(out_buf_data, 0, data_size, notefreq[9]);
-            play_tone = true;
-        }
+        //hidKeysDown returns information about which buttons have been just pressed (and they weren't in the previous frame)
+        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+        u64 kHeld = hidKeysHeld(CONTROLLER_P1_AUTO);
 
-        if (kDown & KEY_ZL)
-        {
-            fill_audio_buffer(out_buf_data, 0, data_size, notefreq[10]);
-            play_tone = true;
-        }
+        if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
 
-        if (kDown & KEY_ZR)
-        {
-            fill_audio_buffer(out_buf_data, 0, data_size, notefreq[11]);
-            play_tone = true;
-        }
+        // The tones themselves are generated by the audio thread, which picks up the new voice settings with its next buffer.
+        for (u32 i = 0; i < sizeof(notekeys) / sizeof(notekeys[0]); i++)
+            synth_set_voice(&audio.synth, i, notefreq[i], (kHeld & notekeys[i]) ? 0.25f : 0.0f);
 
-        if (R_SUCCEEDED(rc) && play_tone)
+        // Print how long rendering a buffer takes, about once per second.
+        if (R_SUCCEEDED(rc) && ++frame % 60 == 0)
         {
-            // Prepare the audio data source buffer.
-            audout_buf.next = NULL;
-            audout_buf.buffer = out_buf_data;
-            audout_buf.buffer_size = buffer_size;
-            audout_buf.data_size = data_size;
-            audout_buf.data_offset = 0;
-
-            // Prepare pointer for the released buffer.
-            audout_released_buf = NULL;
-
-            // Play the buffer.
-            rc = audoutPlayBuffer(&audout_buf, &audout_released_buf);
-
-            if (R_FAILED(rc))
-                printf("audoutPlayBuffer() returned 0x%x\n", rc);
-
-            play_tone = false;
+            u64 ticks = __atomic_exchange_n(&audio.render_ticks, 0, __ATOMIC_RELAXED);
+            u32 blocks = __atomic_exchange_n(&audio.render_blocks, 0, __ATOMIC_RELAXED);
+            if (blocks)
+                printf("\x1b[20;1Hsynth_render: %5lu ns per %u samples, %2u voices  ",
+                    armTicksToNs(ticks / blocks), SAMPLECOUNT, audio.synth.active_voices);
+
+            AudioStatsReport report;
+            char line[256];
+            audioStatsReport(&audio.stats, &report, true);
+            audioStatsFormat(line, sizeof(line), "audout", &report);
+            printf("\x1b[22;1H%s   ", line);
+            audioStatsLog(log_fd, "audout", &report);
         }
 
         consoleUpdate(NULL);
     }
 
+    if (R_SUCCEEDED(rc))
+    {
+        // Stop the audio thread.
+        __atomic_store_n(&audio.exit, true, __ATOMIC_RELEASE);
+        threadWaitForExit(&audio.thread);
+        threadClose(&audio.thread);
+    }
+
     // Stop audio playback.
     rc = audoutStopAudioOut();
     printf("audoutStopAudioOut() returned 0x%x\n", rc);
@@ -193,6 +223,15 @@ int main(int argc, char **argv)
     // Terminate the default audio output device.
     audoutExit();
 
+    free(out_buf_data);
+    audioStatsNxlinkClose(log_fd);
+    if (sockets_ok)
+        socketExit();
+
+#ifdef TRACE_FILE
+    traceExit();
+#endif
+
     consoleExit(NULL);
     return 0;
 }
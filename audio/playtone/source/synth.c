@@ -0,0 +1,141 @@
+#include <string.h>
+#include <math.h>
+
+#include "synth.h"
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#define TABLE_BITS 10
+#define TABLE_SIZE (1 << TABLE_BITS)
+#define FRAC_BITS  15
+
+// One period of a sine wave, plus a copy of the first entry so interpolation never needs to wrap
+static s16 sine_table[TABLE_SIZE + 1];
+
+void synth_init(Synth* synth)
+{
+    memset(synth, 0, sizeof(*synth));
+
+    if (sine_table[TABLE_SIZE / 4] == 0) {
+        for (int i = 0; i < TABLE_SIZE; i++)
+            sine_table[i] = (s16)lrintf(0x7FFF * sinf(2.0f * (float)M_PI * i / TABLE_SIZE));
+        sine_table[TABLE_SIZE] = sine_table[0];
+    }
+}
+
+void synth_set_voice(Synth* synth, u32 voice, u32 frequency, float amplitude)
+{
+    if (voice >= SYNTH_MAX_VOICES)
+        return;
+
+    SynthVoice* v = &synth->voices[voice];
+    u32 step = (u32)(((u64)frequency << 32) / SYNTH_SAMPLE_RATE);
+    s32 gain = (s32)(amplitude * 0x7FFF);
+
+    // Keep the old pitch while a note fades out, instead of retuning the tail
+    if (gain)
+        __atomic_store_n(&v->step, step, __ATOMIC_RELAXED);
+    __atomic_store_n(&v->target_gain, gain, __ATOMIC_RELAXED);
+}
+
+static inline s32 osc_sample(u32 phase)
+{
+    u32 idx = phase >> (32 - TABLE_BITS);
+    s32 frac = (phase >> (32 - TABLE_BITS - FRAC_BITS)) & ((1 << FRAC_BITS) - 1);
+    s32 a = sine_table[idx], b = sine_table[idx + 1];
+    return a + (((b - a) * frac) >> FRAC_BITS);
+}
+
+// Adds one voice to the mix. The gain goes linearly from v->gain to target over the block.
+static void render_voice(SynthVoice* v, s32* mix, u32 frames, u32 step, s32 target)
+{
+    u32 phase = v->phase;
+    s32 gain = v->gain * 1024; // Q25 during the ramp, for precision
+    s32 gain_step = (target - v->gain) * 1024 / (s32)frames;
+    u32 i = 0;
+
+#ifdef __ARM_NEON
+    const u32 lanes[4] = { 0, 1, 2, 3 };
+    uint32x4_t ph = vmlaq_n_u32(vdupq_n_u32(phase), vld1q_u32(lanes), step);
+    int32x4_t g = vmlaq_n_s32(vdupq_n_s32(gain), vreinterpretq_s32_u32(vld1q_u32(lanes)), gain_step);
+    uint32x4_t ph_step = vdupq_n_u32(step * 4);
+    int32x4_t g_step = vdupq_n_s32(gain_step * 4);
+    uint32x4_t frac_mask = vdupq_n_u32((1 << FRAC_BITS) - 1);
+
+    for (; i + 4 <= frames; i += 4) {
+        // NEON has no gather: the table lookups are done per lane (the table is tiny and stays in L1),
+        // everything else is done on all four samples at once
+        uint32x4_t idx = vshrq_n_u32(ph, 32 - TABLE_BITS);
+        int32x4_t a = vdupq_n_s32(0), b = vdupq_n_s32(0);
+        a = vsetq_lane_s32(sine_table[vgetq_lane_u32(idx, 0)], a, 0);
+        b = vsetq_lane_s32(sine_table[vgetq_lane_u32(idx, 0) + 1], b, 0);
+        a = vsetq_lane_s32(sine_table[vgetq_lane_u32(idx, 1)], a, 1);
+        b = vsetq_lane_s32(sine_table[vgetq_lane_u32(idx, 1) + 1], b, 1);
+        a = vsetq_lane_s32(sine_table[vgetq_lane_u32(idx, 2)], a, 2);
+        b = vsetq_lane_s32(sine_table[vgetq_lane_u32(idx, 2) + 1], b, 2);
+        a = vsetq_lane_s32(sine_table[vgetq_lane_u32(idx, 3)], a, 3);
+        b = vsetq_lane_s32(sine_table[vgetq_lane_u32(idx, 3) + 1], b, 3);
+
+        int32x4_t frac = vreinterpretq_s32_u32(vandq_u32(vshrq_n_u32(ph, 32 - TABLE_BITS - FRAC_BITS), frac_mask));
+        int32x4_t s = vaddq_s32(a, vshrq_n_s32(vmulq_s32(vsubq_s32(b, a), frac), FRAC_BITS));
+
+        // Apply the gain (Q25 -> Q15), and accumulate
+        s = vshrq_n_s32(vmulq_s32(s, vshrq_n_s32(g, 10)), 15);
+        vst1q_s32(&mix[i], vaddq_s32(vld1q_s32(&mix[i]), s));
+
+        ph = vaddq_u32(ph, ph_step);
+        g = vaddq_s32(g, g_step);
+    }
+
+    phase += step * i;
+    gain += gain_step * (s32)i;
+#endif
+
+    for (; i < frames; i++) {
+        mix[i] += (osc_sample(phase) * (gain >> 10)) >> 15;
+        phase += step;
+        gain += gain_step;
+    }
+
+    v->phase = phase;
+    v->gain = target;
+}
+
+void synth_render(Synth* synth, s16* out, u32 frames)
+{
+    if (frames > SYNTH_MAX_BLOCK_FRAMES)
+        frames = SYNTH_MAX_BLOCK_FRAMES;
+
+    s32* mix = synth->mix;
+    memset(mix, 0, frames * sizeof(s32));
+
+    u32 active = 0;
+    for (u32 i = 0; i < SYNTH_MAX_VOICES; i++) {
+        SynthVoice* v = &synth->voices[i];
+        s32 target = __atomic_load_n(&v->target_gain, __ATOMIC_RELAXED);
+        if (!v->gain && !target)
+            continue;
+
+        render_voice(v, mix, frames, __atomic_load_n(&v->step, __ATOMIC_RELAXED), target);
+        active++;
+    }
+    synth->active_voices = active;
+
+    // Saturate the mix to 16 bits, and duplicate it to both channels
+    u32 i = 0;
+#ifdef __ARM_NEON
+    for (; i + 8 <= frames; i += 8) {
+        int16x8_t s = vcombine_s16(vqmovn_s32(vld1q_s32(&mix[i])), vqmovn_s32(vld1q_s32(&mix[i + 4])));
+        int16x8x2_t lr = { { s, s } };
+        vst2q_s16(&out[i * 2], lr);
+    }
+#endif
+    for (; i < frames; i++) {
+        s32 s = mix[i];
+        s = s > 0x7FFF ? 0x7FFF : s < -0x8000 ? -0x8000 : s;
+        out[i * 2 + 0] = s;
+        out[i * 2 + 1] = s;
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <switch.h>
+
+// Small wavetable synthesizer.
+//
+// Each voice is a sine oscillator read out of a lookup table with a 32-bit fixed-point phase
+// accumulator (the top bits index the table, the next ones interpolate between two entries).
+// The phase of a voice keeps running across buffers and note changes, and volume changes are
+// ramped over one block, so that starting, stopping or retuning a note doesn't click.
+//
+// synth_set_voice may be called from any thread, while synth_render is called from the audio thread.
+
+#define SYNTH_SAMPLE_RATE      48000
+#define SYNTH_MAX_VOICES       16
+#define SYNTH_MAX_BLOCK_FRAMES 1024 // frames rendered per synth_render call at most, must be a multiple of 8
+
+typedef struct {
+    // Set by synth_set_voice
+    u32 step;        // phase increment per sample
+    s32 target_gain; // Q15
+
+    // Only touched by synth_render
+    u32 phase;
+    s32 gain;
+} SynthVoice;
+
+typedef struct {
+    SynthVoice voices[SYNTH_MAX_VOICES];
+    s32 mix[SYNTH_MAX_BLOCK_FRAMES] __attribute__((aligned(16)));
+    u32 active_voices; // number of voices which made a sound in the last block
+} Synth;
+
+void synth_init(Synth* synth);
+
+// Sets the frequency (in Hz) and amplitude (from 0 to 1) of a voice: an amplitude of 0 stops the note
+void synth_set_voice(Synth* synth, u32 voice, u32 frequency, float amplitude);
+
+// Renders frames of interleaved stereo PCM16, mixing all the playing voices
+void synth_render(Synth* synth, s16* out, u32 frames);
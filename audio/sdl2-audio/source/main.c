@@ -10,6 +10,15 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_mixer.h>
 
+#include "audio_stats.h"
+
+// Called by SDL_mixer on its audio thread, once per mixed chunk.
+// SDL doesn't expose its output queue, so only the time between callbacks is tracked.
+static void post_mix(void *udata, Uint8 *stream, int len)
+{
+    audioStatsEvent((AudioStats*)udata);
+}
+
 // Main program entrypoint
 int main(int argc, char *argv[])
 {
@@ -38,6 +47,14 @@ int main(int argc, char *argv[])
     // Sound from https://freesound.org/people/jens.enk/sounds/434610/
     Mix_Music *audio = Mix_LoadMUS("romfs:/test.mp3");
 
+    // Track how regularly the mixer runs, and send the statistics to the nxlink host when started with nxlink -s
+    static AudioStats stats;
+    audioStatsInit(&stats);
+    bool sockets_ok = R_SUCCEEDED(socketInitializeDefault());
+    int log_fd = audioStatsNxlinkOpen();
+    u32 frame = 0;
+    Mix_SetPostMix(post_mix, &stats);
+
     // Main loop
     while (appletMainLoop())
     {
@@ -54,11 +71,23 @@ int main(int argc, char *argv[])
         if (kDown & KEY_A)
             Mix_PlayMusic(audio, 1); //Play the audio file
 
+        // About once per second
+        if (++frame % 60 == 0)
+        {
+            AudioStatsReport report;
+            char line[256];
+            audioStatsReport(&stats, &report, true);
+            audioStatsFormat(line, sizeof(line), "mixer", &report);
+            printf("\x1b[5;1H%s   ", line);
+            audioStatsLog(log_fd, "mixer", &report);
+        }
+
         // Update the console, sending a new frame to the display
         consoleUpdate(NULL);
     }
 
     // Free the loaded sound
+    Mix_SetPostMix(NULL, NULL);
     Mix_FreeMusic(audio);
 
     // Shuts down SDL subsystems
@@ -66,6 +95,9 @@ int main(int argc, char *argv[])
 
     // Deinitialize and clean up resources used by the console (important!)
     romfsExit();
+    audioStatsNxlinkClose(log_fd);
+    if (sockets_ok)
+        socketExit();
     consoleExit(NULL);
     return 0;
 }
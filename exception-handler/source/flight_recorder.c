@@ -0,0 +1,68 @@
+#include <string.h>
+
+#include "flight_recorder.h"
+
+static FlightRecorder g_recorder;
+
+void flight_recorder_init(void)
+{
+    memset(&g_recorder, 0, sizeof(g_recorder));
+    g_recorder.tick_freq = armGetSystemTickFreq();
+    g_recorder.last_frame_tick = armGetSystemTick();
+}
+
+void flight_recorder_event(u32 tag, u32 value)
+{
+    u32 index = __atomic_fetch_add(&g_recorder.event_head, 1, __ATOMIC_RELAXED);
+    FlightRecorderEvent* event = &g_recorder.events[index & (FLIGHT_RECORDER_NUM_EVENTS - 1)];
+    event->tick = armGetSystemTick();
+    event->tag = tag;
+    event->value = value;
+}
+
+void flight_recorder_frame(void)
+{
+    u64 tick = armGetSystemTick();
+    u32 index = g_recorder.frame_head;
+    g_recorder.frame_ticks[index & (FLIGHT_RECORDER_NUM_FRAMES - 1)] = (u32)(tick - g_recorder.last_frame_tick);
+    g_recorder.last_frame_tick = tick;
+    g_recorder.frame_head = index + 1;
+}
+
+Result flight_recorder_dump(const char* path, const ThreadExceptionDump* ctx)
+{
+    // Not on the stack: the exception stack is small
+    static char fs_path[FS_MAX_PATH];
+    FsFileSystem* fs;
+    if (fsdevTranslatePath(path, &fs, fs_path) == -1)
+        return MAKERESULT(Module_Libnx, LibnxError_NotFound);
+
+    FlightRecorderDumpHeader hdr = {
+        .magic = FLIGHT_RECORDER_MAGIC,
+        .version = FLIGHT_RECORDER_VERSION,
+        .dump_tick = armGetSystemTick(),
+        .exception_dump_size = sizeof(ThreadExceptionDump),
+        .recorder_size = sizeof(FlightRecorder),
+    };
+    s64 size = sizeof(hdr) + sizeof(ThreadExceptionDump) + sizeof(FlightRecorder);
+
+    // A previous dump is replaced, the file is created with its final size so that nothing needs to grow it
+    fsFsDeleteFile(fs, fs_path);
+    Result rc = fsFsCreateFile(fs, fs_path, size, 0);
+    FsFile f;
+    if (R_SUCCEEDED(rc))
+        rc = fsFsOpenFile(fs, fs_path, FsOpenMode_Write, &f);
+    if (R_FAILED(rc))
+        return rc;
+
+    s64 offset = 0;
+    rc = fsFileWrite(&f, offset, &hdr, sizeof(hdr), FsWriteOption_None);
+    offset += sizeof(hdr);
+    if (R_SUCCEEDED(rc))
+        rc = fsFileWrite(&f, offset, ctx, sizeof(ThreadExceptionDump), FsWriteOption_None);
+    offset += sizeof(ThreadExceptionDump);
+    if (R_SUCCEEDED(rc))
+        rc = fsFileWrite(&f, offset, &g_recorder, sizeof(FlightRecorder), FsWriteOption_Flush);
+    fsFileClose(&f);
+    return rc;
+}
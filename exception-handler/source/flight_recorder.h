@@ -0,0 +1,54 @@
+#pragma once
+#include <switch.h>
+
+// Flight recorder: the last events and frame times, kept in memory, for the exception handler to write out.
+//
+// Recording an event is one atomic increment and a 16-byte store into a ring, and recording a frame is a 4-byte store:
+// nothing is formatted, allocated or locked, so it can be left on in release builds. When the application crashes,
+// flight_recorder_dump writes the rings as they are, along with the ThreadExceptionDump, in one file, with the fs
+// service directly rather than stdio: the crashing thread may well hold the newlib locks, or have corrupted its heap.
+//
+// The file is a FlightRecorderDumpHeader, followed by the ThreadExceptionDump, followed by the FlightRecorder. Both
+// rings are written in full: the entry for a running index i is at i % capacity, and the heads are the indices of the
+// next entries to be written. The entry being written when the crash happened, if any, may be torn.
+
+#define FLIGHT_RECORDER_NUM_EVENTS 1024    // Power of 2
+#define FLIGHT_RECORDER_NUM_FRAMES 512     // Power of 2, more than 8 seconds at 60 fps
+#define FLIGHT_RECORDER_MAGIC 0x4D445246   // "FRDM"
+#define FLIGHT_RECORDER_VERSION 1
+
+// Four-character tags, which stay readable in a hex dump, e.g. FLIGHT_RECORDER_TAG('L','O','A','D')
+#define FLIGHT_RECORDER_TAG(a, b, c, d) ((u32)(a) | (u32)(b) << 8 | (u32)(c) << 16 | (u32)(d) << 24)
+
+typedef struct {
+    u64 tick;                          // armGetSystemTick
+    u32 tag;
+    u32 value;                         // Meaning depends on the tag
+} FlightRecorderEvent;
+
+typedef struct {
+    u64 tick_freq;
+    u32 event_head;
+    u32 frame_head;
+    u64 last_frame_tick;
+    FlightRecorderEvent events[FLIGHT_RECORDER_NUM_EVENTS];
+    u32 frame_ticks[FLIGHT_RECORDER_NUM_FRAMES];   // Time between two flight_recorder_frame calls
+} FlightRecorder;
+
+typedef struct {
+    u32 magic;
+    u32 version;
+    u64 dump_tick;
+    u32 exception_dump_size;           // sizeof(ThreadExceptionDump)
+    u32 recorder_size;                 // sizeof(FlightRecorder)
+} FlightRecorderDumpHeader;
+
+void flight_recorder_init(void);
+
+// From any thread
+void flight_recorder_event(u32 tag, u32 value);
+// Once per frame, from one thread
+void flight_recorder_frame(void);
+
+// From __libnx_exception_handler. path is translated like with fopen, relative to the current directory.
+Result flight_recorder_dump(const char* path, const ThreadExceptionDump* ctx);
@@ -6,6 +6,8 @@
 // Include the main libnx system header, for Switch development
 #include <switch.h>
 
+#include "flight_recorder.h"
+
 //This example shows how to use userland exception handling. See also libnx init.c and thread_context.h.
 
 alignas(16) u8 __nx_exception_stack[0x1000];
@@ -13,28 +15,9 @@ u64 __nx_exception_stack_size = sizeof(__nx_exception_stack);
 
 void __libnx_exception_handler(ThreadExceptionDump *ctx)
 {
-    int i;
-    FILE *f = fopen("exception_dump", "w");
-    if(f==NULL)return;
-
-    fprintf(f, "error_desc: 0x%x\n", ctx->error_desc);//You can also parse this with ThreadExceptionDesc.
-    //This assumes AArch64, however you can also use threadExceptionIsAArch64().
-    for(i=0; i<29; i++)fprintf(f, "[X%d]: 0x%lx\n", i, ctx->cpu_gprs[i].x);
-    fprintf(f, "fp: 0x%lx\n", ctx->fp.x);
-    fprintf(f, "lr: 0x%lx\n", ctx->lr.x);
-    fprintf(f, "sp: 0x%lx\n", ctx->sp.x);
-    fprintf(f, "pc: 0x%lx\n", ctx->pc.x);
-
-    //You could print fpu_gprs if you want.
-
-    fprintf(f, "pstate: 0x%x\n", ctx->pstate);
-    fprintf(f, "afsr0: 0x%x\n", ctx->afsr0);
-    fprintf(f, "afsr1: 0x%x\n", ctx->afsr1);
-    fprintf(f, "esr: 0x%x\n", ctx->esr);
-
-    fprintf(f, "far: 0x%lx\n", ctx->far.x);
-
-    fclose(f);
+    //The registers are written out raw along with the flight recorder, see flight_recorder.h for the layout. Nothing
+    //here goes through stdio: the crash may have happened with its locks held.
+    flight_recorder_dump("exception_dump", ctx);
 }
 
 // Main program entrypoint
@@ -47,11 +30,12 @@ int main(int argc, char* argv[])
     //   take a look at the graphics/opengl set of examples, which uses EGL instead.
     consoleInit(NULL);
 
-    printf("Triggering crash...\n");
-    consoleUpdate(NULL);
+    //From here on, the last frames and events end up in the dump if the application crashes.
+    flight_recorder_init();
+    flight_recorder_event(FLIGHT_RECORDER_TAG('I','N','I','T'), 0);
 
-    //Trigger a crash.
-    *((u64*)8) = 16;
+    printf("Press A to trigger a crash.\n");
+    consoleUpdate(NULL);
 
     // Main loop
     while (appletMainLoop())
@@ -66,8 +50,20 @@ int main(int argc, char* argv[])
         if (kDown & KEY_PLUS)
             break; // break in order to return to hbmenu
 
+        if (kDown)
+            flight_recorder_event(FLIGHT_RECORDER_TAG('K','E','Y','S'), (u32)kDown);
+
+        if (kDown & KEY_A) {
+            flight_recorder_event(FLIGHT_RECORDER_TAG('C','R','S','H'), 0);
+
+            //Trigger a crash.
+            *((u64*)8) = 16;
+        }
+
         // Your code goes here
 
+        flight_recorder_frame();
+
         // Update the console, sending a new frame to the display
         consoleUpdate(NULL);
     }
@@ -0,0 +1,77 @@
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#include "dir_scan.h"
+
+static Result dirScanOpenDir(FsDir* dir, const char* path, u32 flags)
+{
+    FsFileSystem* fs;
+    char fs_path[FS_MAX_PATH];
+    if (fsdevTranslatePath(path, &fs, fs_path) == -1)
+        return MAKERESULT(Module_Libnx, errno == ENODEV ? LibnxError_NotFound : LibnxError_BadInput);
+
+    u32 mode = 0;
+    if (flags & DirScanFlags_Dirs)
+        mode |= FsDirOpenMode_ReadDirs;
+    if (flags & DirScanFlags_Files)
+        mode |= FsDirOpenMode_ReadFiles;
+    // Saves looking up the size of every file
+    if (!(flags & DirScanFlags_Sizes))
+        mode |= FsDirOpenMode_NoFileSize;
+    return fsFsOpenDirectory(fs, fs_path, mode, dir);
+}
+
+Result dirScanOpen(DirScan* s, const char* path, u32 flags)
+{
+    memset(s, 0, sizeof(*s));
+    s->entries = (FsDirectoryEntry*)malloc(DIR_SCAN_BATCH * sizeof(FsDirectoryEntry));
+    if (!s->entries)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+
+    Result rc = dirScanOpenDir(&s->dir, path, flags);
+    if (R_FAILED(rc)) {
+        free(s->entries);
+        s->entries = NULL;
+    }
+    return rc;
+}
+
+const FsDirectoryEntry* dirScanNext(DirScan* s)
+{
+    if (s->pos == s->count) {
+        if (s->done)
+            return NULL;
+
+        s64 total = 0;
+        s->rc = fsDirRead(&s->dir, &total, DIR_SCAN_BATCH, s->entries);
+        s->pos = 0;
+        s->count = R_SUCCEEDED(s->rc) ? total : 0;
+        // A short batch is the last one, this saves an IPC returning nothing
+        if (s->count < DIR_SCAN_BATCH)
+            s->done = true;
+        if (!s->count)
+            return NULL;
+    }
+    return &s->entries[s->pos++];
+}
+
+void dirScanClose(DirScan* s)
+{
+    if (s->entries) {
+        fsDirClose(&s->dir);
+        free(s->entries);
+        s->entries = NULL;
+    }
+}
+
+Result dirScanGetCount(const char* path, u32 flags, s64* out)
+{
+    FsDir dir;
+    Result rc = dirScanOpenDir(&dir, path, flags);
+    if (R_SUCCEEDED(rc)) {
+        rc = fsDirGetEntryCount(&dir, out);
+        fsDirClose(&dir);
+    }
+    return rc;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <switch.h>
+
+// Directory enumeration through the native fs API.
+//
+// readdir goes through the devoptab layer one entry at a time, and a stat per entry is needed for its size. A DirScan
+// reads the entries with fsDirRead instead, DIR_SCAN_BATCH of them per IPC, and the size of the files comes with them
+// (unless it isn't asked for, which is faster still).
+//
+// Paths are the ones used with stdio ("sdmc:/switch", "save:/", or relative to the current directory), translated to
+// the fs device they're on with fsdevTranslatePath.
+//
+// Usage:
+//     DirScan scan;
+//     if (R_SUCCEEDED(dirScanOpen(&scan, "sdmc:/switch", DirScanFlags_All))) {
+//         const FsDirectoryEntry* ent;
+//         while ((ent = dirScanNext(&scan)))
+//             printf("%s %ld\n", ent->name, ent->file_size);
+//         dirScanClose(&scan);
+//     }
+
+#define DIR_SCAN_BATCH 256 // Entries read at once, 0x310 bytes each
+
+typedef enum {
+    DirScanFlags_Dirs  = BIT(0),
+    DirScanFlags_Files = BIT(1),
+    DirScanFlags_Sizes = BIT(2),  // Without it, file_size is 0
+    DirScanFlags_All   = DirScanFlags_Dirs | DirScanFlags_Files | DirScanFlags_Sizes,
+} DirScanFlags;
+
+typedef struct {
+    FsDir dir;
+    FsDirectoryEntry* entries;
+    s32 count, pos;
+    bool done;
+    Result rc;                    // Error which ended the scan, 0 at the end of the directory
+} DirScan;
+
+Result dirScanOpen(DirScan* s, const char* path, u32 flags);
+// Returns the next entry, valid until the next call, or NULL at the end of the directory or on error (see s->rc)
+const FsDirectoryEntry* dirScanNext(DirScan* s);
+void dirScanClose(DirScan* s);
+
+// Number of entries in the directory, without reading them
+Result dirScanGetCount(const char* path, u32 flags, s64* out);
@@ -0,0 +1,240 @@
+#include <string.h>
+#include <stdlib.h>
+#include <malloc.h>
+
+#include "file_copy.h"
+
+static bool fileCopyFailed(FileCopy* c)
+{
+    return R_FAILED(__atomic_load_n(&c->rc, __ATOMIC_ACQUIRE));
+}
+
+// Records the first error, and wakes every stage so that they see it and stop. Each semaphore has at most one waiter,
+// which exits as soon as it's woken, so one signal each is enough.
+static void fileCopyFail(FileCopy* c, Result rc)
+{
+    Result expected = 0;
+    if (!__atomic_compare_exchange_n(&c->rc, &expected, rc, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        return;
+    semaphoreSignal(&c->free_sem);
+    semaphoreSignal(&c->read_sem);
+    semaphoreSignal(&c->hashed_sem);
+}
+
+static void fileCopyStageDone(FileCopy* c)
+{
+    u32 stages = c->has_dst ? 3 : 2;
+    if (__atomic_add_fetch(&c->stages_done, 1, __ATOMIC_ACQ_REL) == stages)
+        c->end_tick = armGetSystemTick();
+}
+
+static void fileCopyReader(void* arg)
+{
+    FileCopy* c = (FileCopy*)arg;
+    for (u32 i = 0; i < c->num_chunks; i++) {
+        semaphoreWait(&c->free_sem);
+        if (fileCopyFailed(c))
+            break;
+
+        FileCopyBuffer* buf = &c->buffers[i % FILE_COPY_BUFFERS];
+        s64 offset = (s64)i * FILE_COPY_BUFFER_SIZE;
+        buf->size = c->size - offset < FILE_COPY_BUFFER_SIZE ? c->size - offset : FILE_COPY_BUFFER_SIZE;
+
+        u64 start = armGetSystemTick();
+        u64 read = 0;
+        Result rc = fsFileRead(&c->src, offset, buf->data, buf->size, FsReadOption_None, &read);
+        if (R_SUCCEEDED(rc) && read != buf->size)
+            rc = MAKERESULT(Module_Libnx, LibnxError_IoError);
+        if (R_FAILED(rc)) {
+            fileCopyFail(c, rc);
+            break;
+        }
+        c->read_ticks += armGetSystemTick() - start;
+        __atomic_store_n(&c->bytes_read, offset + buf->size, __ATOMIC_RELAXED);
+
+        semaphoreSignal(&c->read_sem);
+    }
+    fileCopyStageDone(c);
+}
+
+static void fileCopyHasher(void* arg)
+{
+    FileCopy* c = (FileCopy*)arg;
+    for (u32 i = 0; i < c->num_chunks; i++) {
+        semaphoreWait(&c->read_sem);
+        if (fileCopyFailed(c))
+            break;
+
+        FileCopyBuffer* buf = &c->buffers[i % FILE_COPY_BUFFERS];
+        u64 start = armGetSystemTick();
+        sha256ContextUpdate(&c->sha, buf->data, buf->size);
+        c->hash_ticks += armGetSystemTick() - start;
+        __atomic_store_n(&c->bytes_hashed, (u64)i * FILE_COPY_BUFFER_SIZE + buf->size, __ATOMIC_RELAXED);
+
+        // When only hashing, the buffer goes straight back to the reader
+        semaphoreSignal(c->has_dst ? &c->hashed_sem : &c->free_sem);
+    }
+    fileCopyStageDone(c);
+}
+
+static void fileCopyWriter(void* arg)
+{
+    FileCopy* c = (FileCopy*)arg;
+    for (u32 i = 0; i < c->num_chunks; i++) {
+        semaphoreWait(&c->hashed_sem);
+        if (fileCopyFailed(c))
+            break;
+
+        FileCopyBuffer* buf = &c->buffers[i % FILE_COPY_BUFFERS];
+        s64 offset = (s64)i * FILE_COPY_BUFFER_SIZE;
+        u64 start = armGetSystemTick();
+        Result rc = fsFileWrite(&c->dst, offset, buf->data, buf->size, FsWriteOption_None);
+        if (R_FAILED(rc)) {
+            fileCopyFail(c, rc);
+            break;
+        }
+        c->write_ticks += armGetSystemTick() - start;
+        __atomic_store_n(&c->bytes_written, offset + buf->size, __ATOMIC_RELAXED);
+
+        semaphoreSignal(&c->free_sem);
+    }
+
+    if (!fileCopyFailed(c)) {
+        Result rc = fsFileFlush(&c->dst);
+        if (R_FAILED(rc))
+            fileCopyFail(c, rc);
+    }
+    fileCopyStageDone(c);
+}
+
+static void fileCopyFree(FileCopy* c)
+{
+    for (u32 i = 0; i < FILE_COPY_BUFFERS; i++) {
+        free(c->buffers[i].data);
+        c->buffers[i].data = NULL;
+    }
+    fsFileClose(&c->src);
+    if (c->has_dst) {
+        fsFileClose(&c->dst);
+        if (fileCopyFailed(c))
+            fsFsDeleteFile(c->dst_fs, c->dst_path);
+    }
+}
+
+static Result fileCopyOpen(FileCopy* c, const char* src, const char* dst)
+{
+    FsFileSystem* src_fs;
+    char path[FS_MAX_PATH];
+    if (fsdevTranslatePath(src, &src_fs, path) == -1)
+        return MAKERESULT(Module_Libnx, LibnxError_NotFound);
+
+    Result rc = fsFsOpenFile(src_fs, path, FsOpenMode_Read, &c->src);
+    if (R_SUCCEEDED(rc))
+        rc = fsFileGetSize(&c->src, &c->size);
+    if (R_FAILED(rc) || !dst)
+        return rc;
+
+    if (fsdevTranslatePath(dst, &c->dst_fs, c->dst_path) == -1)
+        return MAKERESULT(Module_Libnx, LibnxError_NotFound);
+
+    // Created at its final size, so that the writes don't have to grow it. Files of 4 GiB or more need to be
+    // concatenation files on FAT32.
+    fsFsDeleteFile(c->dst_fs, c->dst_path);
+    rc = fsFsCreateFile(c->dst_fs, c->dst_path, c->size, c->size >= 0x100000000LL ? FsCreateOption_BigFile : 0);
+    if (R_SUCCEEDED(rc))
+        rc = fsFsOpenFile(c->dst_fs, c->dst_path, FsOpenMode_Write, &c->dst);
+    if (R_SUCCEEDED(rc))
+        c->has_dst = true;
+    return rc;
+}
+
+Result fileCopyStart(FileCopy* c, const char* src, const char* dst)
+{
+    memset(c, 0, sizeof(*c));
+
+    Result rc = fileCopyOpen(c, src, dst);
+    if (R_FAILED(rc)) {
+        c->rc = rc;
+        fileCopyFree(c);
+        return rc;
+    }
+    c->num_chunks = (c->size + FILE_COPY_BUFFER_SIZE - 1) / FILE_COPY_BUFFER_SIZE;
+
+    // Page-aligned, so that the fs service can map them directly
+    for (u32 i = 0; i < FILE_COPY_BUFFERS; i++) {
+        c->buffers[i].data = (u8*)memalign(0x1000, FILE_COPY_BUFFER_SIZE);
+        if (!c->buffers[i].data) {
+            c->rc = MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+            fileCopyFree(c);
+            return c->rc;
+        }
+    }
+
+    semaphoreInit(&c->free_sem, FILE_COPY_BUFFERS);
+    semaphoreInit(&c->read_sem, 0);
+    semaphoreInit(&c->hashed_sem, 0);
+    sha256ContextCreate(&c->sha);
+    c->start_tick = armGetSystemTick();
+
+    // One core per stage
+    rc = threadCreate(&c->reader, fileCopyReader, c, NULL, 0x4000, 0x2C, 0);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadCreate(&c->hasher, fileCopyHasher, c, NULL, 0x4000, 0x2C, 1);
+        if (R_SUCCEEDED(rc) && c->has_dst) {
+            rc = threadCreate(&c->writer, fileCopyWriter, c, NULL, 0x4000, 0x2C, 2);
+            if (R_FAILED(rc))
+                threadClose(&c->hasher);
+        }
+        if (R_FAILED(rc))
+            threadClose(&c->reader);
+    }
+    if (R_FAILED(rc)) {
+        c->rc = rc;
+        fileCopyFree(c);
+        return rc;
+    }
+
+    // A stage which doesn't start fails the copy, the others then stop on their own
+    Thread* threads[3] = { &c->reader, &c->hasher, &c->writer };
+    u32 count = c->has_dst ? 3 : 2;
+    for (u32 i = 0; i < count; i++) {
+        Result rc2 = threadStart(threads[i]);
+        if (R_SUCCEEDED(rc2))
+            c->started |= BIT(i);
+        else {
+            fileCopyFail(c, rc2);
+            fileCopyStageDone(c);
+        }
+    }
+    return 0;
+}
+
+bool fileCopyIsDone(FileCopy* c)
+{
+    return __atomic_load_n(&c->stages_done, __ATOMIC_ACQUIRE) == (c->has_dst ? 3U : 2U);
+}
+
+Result fileCopyFinish(FileCopy* c, u8 hash[SHA256_HASH_SIZE])
+{
+    Thread* threads[3] = { &c->reader, &c->hasher, &c->writer };
+    u32 count = c->has_dst ? 3 : 2;
+    for (u32 i = 0; i < count; i++) {
+        if (c->started & BIT(i))
+            threadWaitForExit(threads[i]);
+        threadClose(threads[i]);
+    }
+
+    Result rc = c->rc;
+    if (R_SUCCEEDED(rc) && hash)
+        sha256ContextGetHash(&c->sha, hash);
+    fileCopyFree(c);
+    return rc;
+}
+
+double fileCopyGetRate(FileCopy* c)
+{
+    u64 end = fileCopyIsDone(c) ? c->end_tick : armGetSystemTick();
+    u64 bytes = c->has_dst ? c->bytes_written : c->bytes_hashed;
+    u64 ns = armTicksToNs(end - c->start_tick);
+    return ns ? bytes * 1000.0 / ns : 0.0;
+}
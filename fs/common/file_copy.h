@@ -0,0 +1,58 @@
+#pragma once
+#include <switch.h>
+
+// Pipelined file copy with SHA-256, through the native fs API.
+//
+// fread/fwrite in one thread leave the card idle while the data is hashed or written, and the other way around. Here
+// three threads each run one stage, on their own core: the reader fills buffers from the source with large fsFileRead
+// calls, the hasher runs SHA-256 over them (sha256ContextUpdate uses the ARMv8 crypto instructions), and the writer
+// writes them to the destination. FILE_COPY_BUFFERS buffers go around in order, so each stage only waits when the next
+// one falls behind, and the copy runs at the speed of the slowest stage, usually the card.
+//
+// Without a destination, the source is only hashed, which verifies a copy.
+//
+// Usage:
+//     FileCopy c;
+//     Result rc = fileCopyStart(&c, "sdmc:/a.bin", "sdmc:/b.bin");
+//     while (R_SUCCEEDED(rc) && !fileCopyIsDone(&c)) { show c.bytes_written ... }
+//     rc = fileCopyFinish(&c, hash);
+
+#define FILE_COPY_BUFFERS 8
+#define FILE_COPY_BUFFER_SIZE 0x200000
+
+typedef struct {
+    u8* data;
+    u32 size;
+} FileCopyBuffer;
+
+typedef struct {
+    FsFile src, dst;
+    bool has_dst;
+    FsFileSystem* dst_fs;                   // To delete the destination if the copy fails
+    char dst_path[FS_MAX_PATH];
+    s64 size;
+    u32 num_chunks;
+
+    FileCopyBuffer buffers[FILE_COPY_BUFFERS];
+    Semaphore free_sem, read_sem, hashed_sem;
+    Thread reader, hasher, writer;
+    u32 started;                            // Bit per thread which was started
+    Sha256Context sha;
+
+    Result rc;                              // First error of any stage, the others then skip their work
+    u32 stages_done;
+
+    // Progress, read without locking
+    u64 bytes_read, bytes_hashed, bytes_written;
+    u64 start_tick, end_tick;
+    u64 read_ticks, hash_ticks, write_ticks; // Time spent by each stage on its work, rather than waiting
+} FileCopy;
+
+// Starts copying src to dst (which is replaced), or only hashing src if dst is NULL
+Result fileCopyStart(FileCopy* c, const char* src, const char* dst);
+bool fileCopyIsDone(FileCopy* c);
+// Waits for the end of the copy, and frees everything. hash may be NULL.
+Result fileCopyFinish(FileCopy* c, u8 hash[SHA256_HASH_SIZE]);
+
+// Throughput of the whole copy so far, in MB/s
+double fileCopyGetRate(FileCopy* c);
@@ -0,0 +1,78 @@
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "text_reader.h"
+
+Result textReaderOpen(TextReader* r, const char* path)
+{
+    memset(r, 0, sizeof(*r));
+    FILE* f = fopen(path, "rb");
+    if (!f)
+        return MAKERESULT(Module_Libnx, LibnxError_NotFound);
+
+    // The file is read in one go, a stdio buffer would only add a copy
+    setvbuf(f, NULL, _IONBF, 0);
+
+    Result rc = 0;
+    off_t size = -1;
+    if (fseeko(f, 0, SEEK_END) == 0)
+        size = ftello(f);
+    if (size < 0 || fseeko(f, 0, SEEK_SET) != 0)
+        rc = MAKERESULT(Module_Libnx, LibnxError_IoError);
+
+    if (R_SUCCEEDED(rc)) {
+        // One more byte for the NUL after the last line
+        r->buf = (char*)malloc(size + 1);
+        if (!r->buf)
+            rc = MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+        else if (size && fread(r->buf, size, 1, f) != 1)
+            rc = MAKERESULT(Module_Libnx, LibnxError_IoError);
+    }
+    fclose(f);
+
+    if (R_FAILED(rc)) {
+        free(r->buf);
+        r->buf = NULL;
+        return rc;
+    }
+
+    r->size = size;
+    r->buf[size] = 0;
+    if (size >= 3 && memcmp(r->buf, "\xEF\xBB\xBF", 3) == 0)
+        r->pos = 3;
+    return 0;
+}
+
+bool textReaderNext(TextReader* r, TextLine* line)
+{
+    if (r->pos >= r->size)
+        return false;
+
+    char* start = r->buf + r->pos;
+    size_t left = r->size - r->pos;
+    char* end = (char*)memchr(start, '\n', left);
+    if (end)
+        r->pos += end - start + 1;
+    else {
+        // The last line has no line end, the NUL after the buffer ends it
+        end = start + left;
+        r->pos = r->size;
+    }
+
+    if (end > start && end[-1] == '\r')
+        end--;
+    *end = 0;
+
+    line->data = start;
+    line->len = end - start;
+    r->line_no++;
+    return true;
+}
+
+void textReaderClose(TextReader* r)
+{
+    free(r->buf);
+    r->buf = NULL;
+    r->size = r->pos = 0;
+}
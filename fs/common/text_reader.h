@@ -0,0 +1,35 @@
+#pragma once
+#include <switch.h>
+
+// Line by line reading of text files (config files, CSV/INI data tables).
+//
+// fgets copies every line into the caller's buffer and splits the lines which don't fit in it. A TextReader reads the
+// whole file into one buffer with a single unbuffered read instead, and returns the lines as views into that buffer:
+// the line ends are found with memchr, and the "\n" or "\r\n" is replaced by a NUL in place, so a line can also be used
+// as a C string. A UTF-8 byte order mark at the start of the file is skipped.
+//
+// Usage:
+//     TextReader r;
+//     if (R_SUCCEEDED(textReaderOpen(&r, "romfs:/data/items.csv"))) {
+//         TextLine line;
+//         while (textReaderNext(&r, &line))
+//             parse_item(line.data, line.len);
+//         textReaderClose(&r);
+//     }
+
+typedef struct {
+    const char* data;             // NUL-terminated, without the line end
+    size_t len;
+} TextLine;
+
+typedef struct {
+    char* buf;
+    size_t size;
+    size_t pos;
+    u32 line_no;                  // Of the last line returned, from 1
+} TextReader;
+
+Result textReaderOpen(TextReader* r, const char* path);
+// Returns the next line, valid until textReaderClose, or false at the end of the file
+bool textReaderNext(TextReader* r, TextLine* line);
+void textReaderClose(TextReader* r);
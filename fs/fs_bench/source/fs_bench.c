@@ -0,0 +1,273 @@
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <malloc.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "fs_bench.h"
+
+#define FS_BENCH_ERROR MAKERESULT(Module_Libnx, LibnxError_IoError)
+
+typedef struct {
+    FsBenchApi api;
+    FILE* f;
+    int fd;
+    FsFile file;
+} FsBenchFile;
+
+typedef struct {
+    const FsBenchParams* params;
+    Semaphore* ready;
+    UEvent* go;
+    u32 index;
+    Thread thread;
+
+    u64 ops, bytes;
+    Result rc;
+} FsBenchThread;
+
+const char* fs_bench_api_name(FsBenchApi api)
+{
+    static const char* const names[FsBenchApi_Count] = { "stdio", "posix", "fsfile" };
+    return names[api];
+}
+
+const char* fs_bench_pattern_name(FsBenchPattern pattern)
+{
+    static const char* const names[FsBenchPattern_Count] = { "seq_read", "rand_read", "seq_write", "rand_write" };
+    return names[pattern];
+}
+
+static Result fs_bench_open(FsBenchFile* h, const FsBenchParams* p)
+{
+    bool write = fs_bench_pattern_writes(p->pattern);
+    memset(h, 0, sizeof(*h));
+    h->api = p->api;
+    h->fd = -1;
+
+    switch (p->api) {
+        case FsBenchApi_Stdio:
+            // No truncation, the blocks are written over the existing file
+            h->f = fopen(p->path, write ? "r+b" : "rb");
+            return h->f ? 0 : FS_BENCH_ERROR;
+
+        case FsBenchApi_Posix:
+            h->fd = open(p->path, write ? O_WRONLY : O_RDONLY);
+            return h->fd >= 0 ? 0 : FS_BENCH_ERROR;
+
+        default: {
+            FsFileSystem* fs;
+            char fs_path[FS_MAX_PATH];
+            // romfs isn't an fs device
+            if (fsdevTranslatePath(p->path, &fs, fs_path) == -1)
+                return MAKERESULT(Module_Libnx, LibnxError_NotFound);
+            return fsFsOpenFile(fs, fs_path, write ? FsOpenMode_Write : FsOpenMode_Read, &h->file);
+        }
+    }
+}
+
+static Result fs_bench_io(FsBenchFile* h, bool is_write, u64 offset, void* buf, u32 size)
+{
+    switch (h->api) {
+        case FsBenchApi_Stdio:
+            if (fseeko(h->f, offset, SEEK_SET) != 0)
+                return FS_BENCH_ERROR;
+            if (is_write)
+                return fwrite(buf, size, 1, h->f) == 1 ? 0 : FS_BENCH_ERROR;
+            return fread(buf, size, 1, h->f) == 1 ? 0 : FS_BENCH_ERROR;
+
+        case FsBenchApi_Posix:
+            if (lseek(h->fd, offset, SEEK_SET) != (off_t)offset)
+                return FS_BENCH_ERROR;
+            if (is_write)
+                return write(h->fd, buf, size) == (ssize_t)size ? 0 : FS_BENCH_ERROR;
+            return read(h->fd, buf, size) == (ssize_t)size ? 0 : FS_BENCH_ERROR;
+
+        default: {
+            if (is_write)
+                return fsFileWrite(&h->file, offset, buf, size, FsWriteOption_None);
+            u64 bytes_read = 0;
+            Result rc = fsFileRead(&h->file, offset, buf, size, FsReadOption_None, &bytes_read);
+            return R_SUCCEEDED(rc) && bytes_read != size ? FS_BENCH_ERROR : rc;
+        }
+    }
+}
+
+static Result fs_bench_close(FsBenchFile* h, bool write)
+{
+    Result rc = 0;
+    switch (h->api) {
+        case FsBenchApi_Stdio:
+            if (h->f && fclose(h->f) != 0)
+                rc = FS_BENCH_ERROR;
+            break;
+
+        case FsBenchApi_Posix:
+            if (h->fd >= 0 && close(h->fd) != 0)
+                rc = FS_BENCH_ERROR;
+            break;
+
+        default:
+            if (write)
+                rc = fsFileFlush(&h->file);
+            fsFileClose(&h->file);
+            break;
+    }
+    return rc;
+}
+
+static void fs_bench_thread_func(void* arg)
+{
+    FsBenchThread* t = (FsBenchThread*)arg;
+    const FsBenchParams* p = t->params;
+    bool write = fs_bench_pattern_writes(p->pattern);
+    bool random = p->pattern == FsBenchPattern_RandRead || p->pattern == FsBenchPattern_RandWrite;
+
+    FsBenchFile h;
+    u8* buf = (u8*)memalign(0x1000, p->block_size);
+    Result rc = buf ? fs_bench_open(&h, p) : MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    bool opened = R_SUCCEEDED(rc);
+    if (buf)
+        memset(buf, 0xA5 ^ t->index, p->block_size);
+
+    // Every thread starts at the same time, even when the open failed
+    semaphoreSignal(t->ready);
+    waitSingle(waiterForUEvent(t->go), UINT64_MAX);
+
+    // Sequential: each thread covers its part of the file. Random: as many blocks, anywhere in the file.
+    u64 num_blocks = p->file_size / p->block_size;
+    u64 first = num_blocks * t->index / p->num_threads;
+    u64 count = num_blocks * (t->index + 1) / p->num_threads - first;
+    if (random && count == 0)
+        count = 1;
+    u64 seed = 0x9E3779B97F4A7C15ULL * (t->index + 1);
+
+    u64 deadline = armGetSystemTick() + armNsToTicks(p->time_limit_ns);
+    for (u64 i = 0; opened && i < count && R_SUCCEEDED(rc); i++) {
+        u64 block = first + i;
+        if (random) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            block = seed % num_blocks;
+        }
+
+        rc = fs_bench_io(&h, write, block * p->block_size, buf, p->block_size);
+        if (R_SUCCEEDED(rc)) {
+            t->ops++;
+            t->bytes += p->block_size;
+        }
+        if (armGetSystemTick() >= deadline)
+            break;
+    }
+
+    if (opened) {
+        Result close_rc = fs_bench_close(&h, write);
+        if (R_SUCCEEDED(rc))
+            rc = close_rc;
+    }
+    t->rc = rc;
+    free(buf);
+}
+
+void fs_bench_run(const FsBenchParams* p, FsBenchResult* out)
+{
+    static FsBenchThread threads[FS_BENCH_MAX_THREADS];
+    memset(out, 0, sizeof(*out));
+    if (p->num_threads == 0 || p->num_threads > FS_BENCH_MAX_THREADS || p->block_size == 0 || p->block_size > p->file_size) {
+        out->rc = MAKERESULT(Module_Libnx, LibnxError_BadInput);
+        return;
+    }
+
+    Semaphore ready;
+    UEvent go;
+    semaphoreInit(&ready, 0);
+    ueventCreate(&go, false);
+
+    u32 started = 0;
+    for (u32 i = 0; i < p->num_threads; i++) {
+        FsBenchThread* t = &threads[i];
+        memset(t, 0, sizeof(*t));
+        t->params = p;
+        t->ready = &ready;
+        t->go = &go;
+        t->index = i;
+
+        // Spread over the cores the application can use, so a thread blocked in the fs doesn't hold up another
+        Result rc = threadCreate(&t->thread, fs_bench_thread_func, t, NULL, 0x4000, 0x2C, i % 3);
+        if (R_SUCCEEDED(rc)) {
+            rc = threadStart(&t->thread);
+            if (R_FAILED(rc))
+                threadClose(&t->thread);
+        }
+        if (R_FAILED(rc)) {
+            out->rc = rc;
+            break;
+        }
+        started++;
+    }
+
+    // Once every thread has opened the file. If one couldn't be started the others still run, the result has its error.
+    for (u32 i = 0; i < started; i++)
+        semaphoreWait(&ready);
+    u64 start = armGetSystemTick();
+    ueventSignal(&go);
+
+    for (u32 i = 0; i < started; i++) {
+        threadWaitForExit(&threads[i].thread);
+        threadClose(&threads[i].thread);
+    }
+
+    // Savedata: the written blocks are only on the storage once committed
+    Result commit_rc = 0;
+    if (fs_bench_pattern_writes(p->pattern) && p->commit_device)
+        commit_rc = fsdevCommitDevice(p->commit_device);
+    out->ns = armTicksToNs(armGetSystemTick() - start);
+
+    for (u32 i = 0; i < started; i++) {
+        out->ops += threads[i].ops;
+        out->bytes += threads[i].bytes;
+        if (R_SUCCEEDED(out->rc))
+            out->rc = threads[i].rc;
+    }
+    if (R_SUCCEEDED(out->rc))
+        out->rc = commit_rc;
+}
+
+bool fs_bench_create_file(const char* path, const char* commit_device, u64 size)
+{
+    FsFileSystem* fs;
+    char fs_path[FS_MAX_PATH];
+    if (fsdevTranslatePath(path, &fs, fs_path) == -1)
+        return false;
+
+    fsFsDeleteFile(fs, fs_path);
+    Result rc = fsFsCreateFile(fs, fs_path, size, 0);
+    if (R_FAILED(rc))
+        return false;
+
+    FsFile f;
+    rc = fsFsOpenFile(fs, fs_path, FsOpenMode_Write, &f);
+    if (R_FAILED(rc))
+        return false;
+
+    const u32 chunk_size = 0x100000;
+    u32* chunk = (u32*)memalign(0x1000, chunk_size);
+    if (!chunk)
+        rc = MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    for (u64 pos = 0; pos < size && R_SUCCEEDED(rc); pos += chunk_size) {
+        u64 len = size - pos < chunk_size ? size - pos : chunk_size;
+        for (u32 i = 0; i < len / 4; i++)
+            chunk[i] = (pos / 4 + i) * 2654435761U;
+        rc = fsFileWrite(&f, pos, chunk, len, FsWriteOption_None);
+    }
+    if (R_SUCCEEDED(rc))
+        rc = fsFileFlush(&f);
+    fsFileClose(&f);
+    free(chunk);
+
+    if (R_SUCCEEDED(rc) && commit_device)
+        rc = fsdevCommitDevice(commit_device);
+    return R_SUCCEEDED(rc);
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <switch.h>
+
+// One measurement of the benchmark: a pattern of reads or writes of block_size bytes on one file, done by num_threads
+// threads at the same time (the queue depth) through one of the file APIs, until the file was covered once or the
+// time limit is reached.
+//
+// Each thread opens the file itself, so none of the APIs serializes the threads on a shared handle or file position.
+// Opening is done before the time starts; closing, which flushes what's written, is timed.
+
+#define FS_BENCH_MAX_THREADS 8
+
+typedef enum {
+    FsBenchApi_Stdio,                   // fopen/fseek/fread/fwrite, with the default buffering
+    FsBenchApi_Posix,                   // open/lseek/read/write
+    FsBenchApi_FsFile,                  // fsFileRead/fsFileWrite on the fs device's filesystem, bypassing devoptab
+    FsBenchApi_Count,
+} FsBenchApi;
+
+typedef enum {
+    FsBenchPattern_SeqRead,
+    FsBenchPattern_RandRead,
+    FsBenchPattern_SeqWrite,
+    FsBenchPattern_RandWrite,
+    FsBenchPattern_Count,
+} FsBenchPattern;
+
+typedef struct {
+    const char* path;                   // With the device, e.g. "sdmc:/fs_bench.bin"
+    const char* commit_device;          // Committed after writing (savedata), NULL if none
+    u64 file_size;
+    FsBenchApi api;
+    FsBenchPattern pattern;
+    u32 block_size;
+    u32 num_threads;
+    u64 time_limit_ns;
+} FsBenchParams;
+
+typedef struct {
+    u64 ops;
+    u64 bytes;
+    u64 ns;
+    Result rc;                          // The first failure, 0 if none
+} FsBenchResult;
+
+const char* fs_bench_api_name(FsBenchApi api);
+const char* fs_bench_pattern_name(FsBenchPattern pattern);
+static inline bool fs_bench_pattern_writes(FsBenchPattern pattern) {
+    return pattern == FsBenchPattern_SeqWrite || pattern == FsBenchPattern_RandWrite;
+}
+
+// Writes a file of size bytes to read from, with the native API. Returns false if it fails.
+bool fs_bench_create_file(const char* path, const char* commit_device, u64 size);
+
+void fs_bench_run(const FsBenchParams* params, FsBenchResult* out);
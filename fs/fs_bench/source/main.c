@@ -0,0 +1,191 @@
+#include <string.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+#include <switch.h>
+
+#include "fs_bench.h"
+
+//This example measures the throughput of romfs, the SD card and savedata, with sequential and random reads and writes of various block sizes,
+//done by 1 to 4 threads at a time, through stdio, POSIX and the native fs API (see fs_bench.h). The results are written to a CSV file.
+//Comparing the APIs on the same storage shows what the devoptab layer costs, comparing block sizes and thread counts shows what the storage itself can do.
+
+//Uncomment to also benchmark savedata.
+//WARNING: this writes a file into the savedata of the first game found (and removes it afterwards), use it with your own application's savedata.
+//#define BENCH_SAVE
+
+#define CSV_PATH "sdmc:/fs_bench.csv"
+#define ROMFS_PATH "romfs:/bench.bin"//Generated by the Makefile, 4 MiB since it ships in the NRO.
+#define SDMC_PATH "sdmc:/fs_bench.bin"
+#define SDMC_FILE_SIZE (64*1024*1024)
+#define SAVE_PATH "save:/fs_bench.bin"
+#define SAVE_FILE_SIZE (4*1024*1024)//What's written before a commit must fit in the journal of the savedata.
+#define RUN_TIME_NS 500000000ULL
+
+typedef struct {
+    const char* name;
+    const char* path;
+    const char* commit_device;
+    u64 size;
+    bool writable;
+} BenchTarget;
+
+static const u32 s_block_sizes[] = { 0x1000, 0x4000, 0x10000, 0x40000, 0x100000, 0x800000 };
+static const u32 s_thread_counts[] = { 1, 2, 4 };
+
+//Runs every combination on one target. Returns false if B was pressed to stop.
+bool bench_target(FILE* csv, const BenchTarget* target) {
+    for (u32 api=0; api<FsBenchApi_Count; api++) {
+        for (u32 pattern=0; pattern<FsBenchPattern_Count; pattern++) {
+            if (fs_bench_pattern_writes(pattern) && !target->writable) continue;
+
+            for (u32 b=0; b<sizeof(s_block_sizes)/sizeof(s_block_sizes[0]); b++) {
+                if (s_block_sizes[b] > target->size) continue;
+
+                for (u32 t=0; t<sizeof(s_thread_counts)/sizeof(s_thread_counts[0]); t++) {
+                    hidScanInput();
+                    if (hidKeysDown(CONTROLLER_P1_AUTO) & KEY_B) return false;
+
+                    FsBenchParams params = {
+                        .path = target->path,
+                        .commit_device = target->commit_device,
+                        .file_size = target->size,
+                        .api = api,
+                        .pattern = pattern,
+                        .block_size = s_block_sizes[b],
+                        .num_threads = s_thread_counts[t],
+                        .time_limit_ns = RUN_TIME_NS,
+                    };
+                    FsBenchResult res;
+                    fs_bench_run(&params, &res);
+
+                    double secs = res.ns / 1e9;
+                    double mbps = secs > 0 ? res.bytes / 1e6 / secs : 0.0;
+                    double iops = secs > 0 ? res.ops / secs : 0.0;
+                    fprintf(csv, "%s,%s,%s,%u,%u,%lu,%lu,%.6f,%.2f,%.1f,0x%x\n", target->name, fs_bench_api_name(api), fs_bench_pattern_name(pattern),
+                        params.block_size, params.num_threads, res.ops, res.bytes, secs, mbps, iops, res.rc);
+
+                    printf("\r%s %s %s %7u B x%u: %8.2f MB/s %9.1f IOPS", target->name, fs_bench_api_name(api), fs_bench_pattern_name(pattern),
+                        params.block_size, params.num_threads, mbps, iops);
+                    if (R_FAILED(res.rc)) printf(" (0x%x)", res.rc);
+                    printf(CONSOLE_ESC(K));
+                    consoleUpdate(NULL);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+#ifdef BENCH_SAVE
+//Mounts the savedata of the first game found as "save", like the save example.
+Result mount_save(void) {
+    FsSaveDataInfoReader reader;
+    FsSaveDataInfo info;
+    s64 total_entries=0;
+
+    Result rc = fsOpenSaveDataInfoReader(&reader, FsSaveDataSpaceId_User);
+    if (R_FAILED(rc)) return rc;
+    do {
+        rc = fsSaveDataInfoReaderRead(&reader, &info, 1, &total_entries);
+    } while (R_SUCCEEDED(rc) && total_entries!=0 && info.save_data_type != FsSaveDataType_Account);
+    fsSaveDataInfoReaderClose(&reader);
+
+    if (R_FAILED(rc)) return rc;
+    if (total_entries==0) return MAKERESULT(Module_Libnx, LibnxError_NotFound);
+    return fsdevMountSaveData("save", info.application_id, info.uid);
+}
+#endif
+
+void run_all(void) {
+    FILE* csv = fopen(CSV_PATH, "w");
+    if (csv==NULL) {
+        printf("Failed to open " CSV_PATH ".\n");
+        return;
+    }
+    //Large enough to hold what's written for a whole target, so that the CSV isn't written to the SD card during its benchmark.
+    static char csv_buffer[0x10000];
+    setvbuf(csv, csv_buffer, _IOFBF, sizeof(csv_buffer));
+    fprintf(csv, "target,api,pattern,block_size,threads,ops,bytes,seconds,mb_per_s,iops,result\n");
+
+    bool go_on = true;
+
+    struct stat st;
+    if (stat(ROMFS_PATH, &st)==0) {
+        BenchTarget romfs = { "romfs", ROMFS_PATH, NULL, st.st_size, false };
+        printf("Benchmarking romfs (%lu MiB)...\n", romfs.size >> 20);
+        go_on = bench_target(csv, &romfs);
+        printf("\n");
+        fflush(csv);
+    }
+    else printf(ROMFS_PATH " not found, skipping romfs.\n");
+
+    if (go_on) {
+        printf("Creating " SDMC_PATH "...\n");
+        consoleUpdate(NULL);
+        if (fs_bench_create_file(SDMC_PATH, NULL, SDMC_FILE_SIZE)) {
+            BenchTarget sdmc = { "sdmc", SDMC_PATH, NULL, SDMC_FILE_SIZE, true };
+            printf("Benchmarking sdmc...\n");
+            go_on = bench_target(csv, &sdmc);
+            printf("\n");
+            fflush(csv);
+        }
+        else printf("Failed to create " SDMC_PATH ".\n");
+        remove(SDMC_PATH);
+    }
+
+#ifdef BENCH_SAVE
+    if (go_on) {
+        Result rc = mount_save();
+        if (R_FAILED(rc)) printf("Failed to mount savedata: 0x%x\n", rc);
+        else {
+            if (fs_bench_create_file(SAVE_PATH, "save", SAVE_FILE_SIZE)) {
+                BenchTarget save = { "save", SAVE_PATH, "save", SAVE_FILE_SIZE, true };
+                printf("Benchmarking save...\n");
+                go_on = bench_target(csv, &save);
+                printf("\n");
+                fflush(csv);
+            }
+            else printf("Failed to create " SAVE_PATH ".\n");
+            remove(SAVE_PATH);
+            fsdevCommitDevice("save");
+            fsdevUnmountDevice("save");
+        }
+    }
+#endif
+
+    fclose(csv);
+    printf(go_on ? "Done, results in " CSV_PATH ".\n" : "Stopped, partial results in " CSV_PATH ".\n");
+}
+
+int main(int argc, char **argv)
+{
+    consoleInit(NULL);
+
+    Result rc = romfsInit();
+    if (R_FAILED(rc)) printf("romfsInit: %08X\n", rc);
+
+    printf("fs_bench example\n");
+    printf("Press A to run the benchmark (this takes several minutes), B to stop it.\n");
+    consoleUpdate(NULL);
+
+    // Main loop
+    while(appletMainLoop())
+    {
+        //Scan all the inputs. This should be done once for each frame
+        hidScanInput();
+
+        //hidKeysDown returns information about which buttons have been just pressed (and they weren't in the previous frame)
+        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+
+        if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
+
+        if (kDown & KEY_A) run_all();
+
+        consoleUpdate(NULL);
+    }
+
+    romfsExit();
+    consoleExit(NULL);
+    return 0;
+}
@@ -1,30 +1,24 @@
 #include <string.h>
 #include <stdio.h>
-#include <errno.h>
 
 #include <switch.h>
 
+#include "text_reader.h"
+
 void printfile(const char* path)
 {
-    FILE* f = fopen(path, "r");
-    if (f)
+    //The whole file is read at once, and the lines are split in place, whatever their length. See text_reader.h.
+    TextReader r;
+    Result rc = textReaderOpen(&r, path);
+    if (R_SUCCEEDED(rc))
     {
-        char mystring[100];
-        while (fgets(mystring, sizeof(mystring), f))
-        {
-            int a = strlen(mystring);
-            if (mystring[a-1] == '\n')
-            {
-                mystring[a-1] = 0;
-                if (mystring[a-2] == '\r')
-                    mystring[a-2] = 0;
-            }
-            puts(mystring);
-        }
+        TextLine line;
+        while (textReaderNext(&r, &line))
+            puts(line.data);
         printf(">>EOF<<\n");
-        fclose(f);
+        textReaderClose(&r);
     } else {
-        printf("errno is %d, %s\n", errno, strerror(errno));
+        printf("textReaderOpen() failed: 0x%x\n", rc);
     }
 }
 
@@ -1,11 +1,59 @@
 #include <string.h>
 #include <stdio.h>
-#include <dirent.h>
 
 #include <switch.h>
 
+#include "dir_scan.h"
+#include "save_writer.h"
+
 //This example shows how to access savedata for (official) applications/games.
 
+//Uncomment to also run the save_writer demo, which autosaves a made-up game state incrementally (see save_writer.h).
+//WARNING: this writes a file into the savedata which is mounted (by default the one of the first game found), use it with your own application's savedata.
+//#define SAVE_WRITER_DEMO
+
+#ifdef SAVE_WRITER_DEMO
+#define DEMO_STATE_SIZE (512*1024)
+
+typedef struct {
+    u32 autosaves;
+    float player_pos[3];
+    u8 world[DEMO_STATE_SIZE - 16];//Mostly unchanged between autosaves, like the state of most games.
+} DemoState;
+
+static DemoState s_state;
+
+void save_writer_demo(void) {
+    static SaveWriter writer;
+    Result rc = save_writer_start(&writer, "save", "/save_writer_demo.bin", sizeof(DemoState));
+    if (R_FAILED(rc)) {
+        printf("save_writer_start() failed: 0x%x\n", rc);
+        return;
+    }
+
+    size_t size;
+    const void* loaded = save_writer_get_loaded(&writer, &size);
+    if (loaded && size==sizeof(s_state)) memcpy(&s_state, loaded, size);
+    printf("save_writer demo: %u autosaves so far\n", s_state.autosaves);
+
+    //Each autosave changes a few bytes, so only a chunk or two is written. submit() returns at once, the thread does the rest.
+    for (u32 i=0; i<5; i++) {
+        s_state.autosaves++;
+        s_state.player_pos[0] += 1.0f;
+        s_state.world[(s_state.autosaves * 7919) % sizeof(s_state.world)]++;
+        save_writer_submit(&writer, &s_state, sizeof(s_state));
+        save_writer_flush(&writer);
+
+        SaveWriterStats stats;
+        save_writer_get_stats(&writer, &stats);
+        printf("autosave %u: 0x%x, %lu chunks written, %lu skipped in total, last one took %.2f ms\n", s_state.autosaves, stats.last_rc,
+            stats.chunks_written, stats.chunks_skipped, armTicksToNs(stats.last_save_ticks) / 1000000.0);
+    }
+
+    save_writer_stop(&writer);
+}
+#endif
+
 Result get_save(u64 *application_id, AccountUid *uid) {
     Result rc=0;
     FsSaveDataInfoReader reader;
@@ -43,9 +91,6 @@ int main(int argc, char **argv)
 {
     Result rc=0;
 
-    DIR* dir;
-    struct dirent* ent;
-
     AccountUid uid={0};
     u64 application_id=0x01007ef00011e000;//ApplicationId of the save to mount, in this case BOTW.
 
@@ -89,22 +134,30 @@ int main(int argc, char **argv)
     //See also libnx fs_dev.h for fsdevCommitDevice.
 
     if (R_SUCCEEDED(rc)) {
-        dir = opendir("save:/");//Open the "save:/" directory.
-        if(dir==NULL)
+        //Directories can be listed with opendir/readdir, or with the native fs API, which reads many entries at once and the sizes of the files with them. See dir_scan.h.
+        DirScan scan;
+        Result rc2 = dirScanOpen(&scan, "save:/", DirScanFlags_All);//Open the "save:/" directory.
+        if (R_FAILED(rc2))
         {
-            printf("Failed to open dir.\n");
+            printf("Failed to open dir: 0x%x\n", rc2);
         }
         else
         {
             printf("Dir-listing for 'save:/':\n");
-            while ((ent = readdir(dir)))
+            const FsDirectoryEntry* ent;
+            while ((ent = dirScanNext(&scan)))
             {
-                printf("d_name: %s\n", ent->d_name);
+                if (ent->type == FsDirEntryType_Dir) printf("dir:  %s\n", ent->name);
+                else printf("file: %s, %ld bytes\n", ent->name, ent->file_size);
             }
-            closedir(dir);
+            dirScanClose(&scan);
             printf("Done.\n");
         }
 
+#ifdef SAVE_WRITER_DEMO
+        save_writer_demo();
+#endif
+
         //When you are done with savedata, you can use the below.
         //Any devices still mounted at app exit are automatically unmounted.
         fsdevUnmountDevice("save");
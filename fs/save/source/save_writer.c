@@ -0,0 +1,235 @@
+#include <string.h>
+#include <stdlib.h>
+#include <malloc.h>
+
+#include "save_writer.h"
+
+static void save_writer_hash_chunks(const u8* data, size_t size, u8 (*hashes)[SHA256_HASH_SIZE])
+{
+    for (size_t pos = 0, i = 0; pos < size; pos += SAVE_WRITER_CHUNK_SIZE, i++) {
+        size_t len = size - pos < SAVE_WRITER_CHUNK_SIZE ? size - pos : SAVE_WRITER_CHUNK_SIZE;
+        sha256CalculateHash(hashes[i], data + pos, len);
+    }
+}
+
+// Reads the saved state into buffers[0], and the hashes of its chunks, so that the first save is incremental too
+static void save_writer_read_existing(SaveWriter* w)
+{
+    FsFile f;
+    if (R_FAILED(fsFsOpenFile(w->fs, w->path, FsOpenMode_Read, &f)))
+        return;
+
+    SaveWriterHeader hdr;
+    u64 read = 0;
+    Result rc = fsFileRead(&f, 0, &hdr, sizeof(hdr), FsReadOption_None, &read);
+    if (R_SUCCEEDED(rc) && read == sizeof(hdr) && hdr.magic == SAVE_WRITER_MAGIC && hdr.version == SAVE_WRITER_VERSION &&
+        hdr.chunk_size == SAVE_WRITER_CHUNK_SIZE && hdr.size <= w->max_size) {
+        rc = fsFileRead(&f, SAVE_WRITER_DATA_OFFSET, w->buffers[0], hdr.size, FsReadOption_None, &read);
+        if (R_SUCCEEDED(rc) && read == hdr.size) {
+            save_writer_hash_chunks(w->buffers[0], hdr.size, w->hashes);
+            w->num_hashes = (hdr.size + SAVE_WRITER_CHUNK_SIZE - 1) / SAVE_WRITER_CHUNK_SIZE;
+            w->saved_size = hdr.size;
+            w->generation = hdr.generation;
+            w->loaded_size = hdr.size;
+        }
+    }
+    fsFileClose(&f);
+}
+
+static Result save_writer_write(SaveWriter* w, const u8* data, size_t size, u32* written, u32* skipped, u64* bytes)
+{
+    FsFile f;
+    Result rc = fsFsOpenFile(w->fs, w->path, FsOpenMode_Write, &f);
+    if (R_FAILED(rc)) {
+        rc = fsFsCreateFile(w->fs, w->path, SAVE_WRITER_DATA_OFFSET + size, 0);
+        if (R_SUCCEEDED(rc))
+            rc = fsFsOpenFile(w->fs, w->path, FsOpenMode_Write, &f);
+        if (R_FAILED(rc))
+            return rc;
+        w->num_hashes = 0; // A new file, everything is written
+    }
+
+    if (size != w->saved_size)
+        rc = fsFileSetSize(&f, SAVE_WRITER_DATA_OFFSET + size);
+
+    u32 num_chunks = (size + SAVE_WRITER_CHUNK_SIZE - 1) / SAVE_WRITER_CHUNK_SIZE;
+    save_writer_hash_chunks(data, size, w->new_hashes);
+    for (u32 i = 0; i < num_chunks && R_SUCCEEDED(rc); i++) {
+        // The last chunk changes size along with the state, the hash covers that
+        if (i < w->num_hashes && memcmp(w->new_hashes[i], w->hashes[i], SHA256_HASH_SIZE) == 0) {
+            (*skipped)++;
+            continue;
+        }
+
+        size_t pos = (size_t)i * SAVE_WRITER_CHUNK_SIZE;
+        size_t len = size - pos < SAVE_WRITER_CHUNK_SIZE ? size - pos : SAVE_WRITER_CHUNK_SIZE;
+        rc = fsFileWrite(&f, SAVE_WRITER_DATA_OFFSET + pos, data + pos, len, FsWriteOption_None);
+        (*written)++;
+        *bytes += len;
+    }
+
+    if (R_SUCCEEDED(rc)) {
+        SaveWriterHeader hdr;
+        memset(&hdr, 0, sizeof(hdr));
+        hdr.magic = SAVE_WRITER_MAGIC;
+        hdr.version = SAVE_WRITER_VERSION;
+        hdr.size = size;
+        hdr.chunk_size = SAVE_WRITER_CHUNK_SIZE;
+        hdr.generation = w->generation + 1;
+        rc = fsFileWrite(&f, 0, &hdr, sizeof(hdr), FsWriteOption_Flush);
+    }
+    fsFileClose(&f);
+
+    // One commit for the whole save
+    if (R_SUCCEEDED(rc))
+        rc = fsdevCommitDevice(w->device);
+
+    if (R_SUCCEEDED(rc)) {
+        memcpy(w->hashes, w->new_hashes, num_chunks * SHA256_HASH_SIZE);
+        w->num_hashes = num_chunks;
+        w->saved_size = size;
+        w->generation++;
+    }
+    else
+        w->num_hashes = 0; // What's in the file isn't known anymore, the next save rewrites everything
+    return rc;
+}
+
+static void save_writer_thread_func(void* arg)
+{
+    SaveWriter* w = (SaveWriter*)arg;
+
+    mutexLock(&w->mutex);
+    for (;;) {
+        // Leaves only once everything submitted is saved
+        if (w->pending < 0) {
+            if (w->exit)
+                break;
+            mutexUnlock(&w->mutex);
+            waitSingle(waiterForUEvent(&w->wake_event), UINT64_MAX);
+            mutexLock(&w->mutex);
+            continue;
+        }
+
+        int b = w->writing = w->pending;
+        w->pending = -1;
+        mutexUnlock(&w->mutex);
+
+        u32 written = 0, skipped = 0;
+        u64 bytes = 0;
+        u64 start = armGetSystemTick();
+        Result rc = save_writer_write(w, w->buffers[b], w->sizes[b], &written, &skipped, &bytes);
+        u64 ticks = armGetSystemTick() - start;
+
+        mutexLock(&w->mutex);
+        w->writing = -1;
+        w->stats.saves++;
+        w->stats.chunks_written += written;
+        w->stats.chunks_skipped += skipped;
+        w->stats.bytes_written += bytes;
+        w->stats.last_save_ticks = ticks;
+        w->stats.last_rc = rc;
+        if (R_FAILED(rc))
+            w->stats.failures++;
+        if (w->pending < 0)
+            condvarWakeAll(&w->idle_cv);
+    }
+    mutexUnlock(&w->mutex);
+}
+
+Result save_writer_start(SaveWriter* w, const char* device, const char* path, size_t max_size)
+{
+    memset(w, 0, sizeof(*w));
+    if (strlen(device) >= sizeof(w->device) || strlen(path) >= sizeof(w->path) || max_size > SAVE_WRITER_MAX_CHUNKS * SAVE_WRITER_CHUNK_SIZE)
+        return MAKERESULT(Module_Libnx, LibnxError_BadInput);
+
+    w->fs = fsdevGetDeviceFileSystem(device);
+    if (!w->fs)
+        return MAKERESULT(Module_Libnx, LibnxError_NotFound);
+    strcpy(w->device, device);
+    strcpy(w->path, path);
+    w->max_size = max_size;
+    w->pending = w->writing = -1;
+
+    for (int i = 0; i < 2; i++) {
+        w->buffers[i] = (u8*)memalign(0x1000, max_size ? max_size : 1);
+        if (!w->buffers[i]) {
+            free(w->buffers[0]);
+            w->buffers[0] = NULL;
+            return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+        }
+    }
+
+    mutexInit(&w->mutex);
+    condvarInit(&w->idle_cv);
+    ueventCreate(&w->wake_event, true);
+    save_writer_read_existing(w);
+
+    // Below the priority of the game's threads, a save can take a while
+    Result rc = threadCreate(&w->thread, save_writer_thread_func, w, NULL, 0x4000, 0x30, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&w->thread);
+        if (R_FAILED(rc))
+            threadClose(&w->thread);
+    }
+    if (R_FAILED(rc)) {
+        free(w->buffers[0]);
+        free(w->buffers[1]);
+        w->buffers[0] = w->buffers[1] = NULL;
+    }
+    return rc;
+}
+
+void save_writer_stop(SaveWriter* w)
+{
+    mutexLock(&w->mutex);
+    w->exit = true;
+    mutexUnlock(&w->mutex);
+    ueventSignal(&w->wake_event);
+
+    threadWaitForExit(&w->thread);
+    threadClose(&w->thread);
+
+    free(w->buffers[0]);
+    free(w->buffers[1]);
+    w->buffers[0] = w->buffers[1] = NULL;
+}
+
+const void* save_writer_get_loaded(SaveWriter* w, size_t* size)
+{
+    *size = w->loaded_size;
+    return w->loaded_size ? w->buffers[0] : NULL;
+}
+
+bool save_writer_submit(SaveWriter* w, const void* state, size_t size)
+{
+    if (size > w->max_size)
+        return false;
+
+    mutexLock(&w->mutex);
+    // Replaces the state waiting if there's one, otherwise takes the buffer which isn't being written
+    int b = w->pending >= 0 ? w->pending : (w->writing == 0 ? 1 : 0);
+    memcpy(w->buffers[b], state, size);
+    w->sizes[b] = size;
+    w->pending = b;
+    w->loaded_size = 0;
+    mutexUnlock(&w->mutex);
+
+    ueventSignal(&w->wake_event);
+    return true;
+}
+
+void save_writer_flush(SaveWriter* w)
+{
+    mutexLock(&w->mutex);
+    while (w->pending >= 0 || w->writing >= 0)
+        condvarWait(&w->idle_cv, &w->mutex);
+    mutexUnlock(&w->mutex);
+}
+
+void save_writer_get_stats(SaveWriter* w, SaveWriterStats* out)
+{
+    mutexLock(&w->mutex);
+    *out = w->stats;
+    mutexUnlock(&w->mutex);
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <switch.h>
+
+// Incremental game state saving, on a background thread.
+//
+// The state is saved to one file of a mounted savedata device, in chunks of SAVE_WRITER_CHUNK_SIZE bytes. The writer
+// keeps the SHA-256 of every chunk which was committed, and a save only rewrites the chunks whose hash changed, then
+// commits the device once. Savedata is journaled by the system: nothing written is visible until the commit, so a
+// save is either entirely there or not at all, even if the console loses power in the middle of it.
+//
+// save_writer_submit only copies the state into one of two snapshot buffers, and returns; the thread hashes and writes
+// it. If a new state is submitted while the previous one is still being written, it replaces any other state waiting,
+// only the latest one is saved.
+//
+// The chunks changed by one save must fit in the journal of the savedata (see the journal size of the application's
+// NACP).
+
+#define SAVE_WRITER_CHUNK_SIZE 0x4000
+#define SAVE_WRITER_MAX_CHUNKS 256      // States up to 4 MiB
+#define SAVE_WRITER_MAGIC 0x57564153    // "SAVW"
+#define SAVE_WRITER_VERSION 1
+
+#define SAVE_WRITER_DATA_OFFSET 0x1000 // The state starts page-aligned
+
+// At the start of the file, followed by the state at SAVE_WRITER_DATA_OFFSET
+typedef struct {
+    u32 magic;
+    u32 version;
+    u32 size;
+    u32 chunk_size;
+    u64 generation;                     // Incremented by each save
+} SaveWriterHeader;
+
+typedef struct {
+    u64 saves;
+    u64 chunks_written, chunks_skipped;
+    u64 bytes_written;
+    u64 last_save_ticks;                // Time taken by the last save, commit included
+    u32 failures;
+    Result last_rc;
+} SaveWriterStats;
+
+typedef struct {
+    Thread thread;
+    Mutex mutex;                        // Protects the buffers, pending, writing, stats and exit
+    CondVar idle_cv;
+    UEvent wake_event;
+    bool exit;
+
+    char device[32];
+    char path[FS_MAX_PATH];             // Within the device, e.g. "/state.bin"
+    FsFileSystem* fs;
+    size_t max_size;
+
+    u8* buffers[2];
+    size_t sizes[2];
+    int pending;                        // Buffer submitted and not written yet, or -1
+    int writing;                        // Buffer being written by the thread, or -1
+    size_t loaded_size;                 // State read by save_writer_start, in buffers[0]
+
+    // Only used by the thread
+    u8 hashes[SAVE_WRITER_MAX_CHUNKS][SHA256_HASH_SIZE];    // Of the committed chunks
+    u8 new_hashes[SAVE_WRITER_MAX_CHUNKS][SHA256_HASH_SIZE];
+    u32 num_hashes;
+    size_t saved_size;
+    u64 generation;
+
+    SaveWriterStats stats;
+} SaveWriter;
+
+// Starts the writer for path on device ("save", mounted with fsdevMountSaveData), reading the state saved there
+Result save_writer_start(SaveWriter* w, const char* device, const char* path, size_t max_size);
+// Saves what was submitted and not saved yet, and stops the thread
+void save_writer_stop(SaveWriter* w);
+
+// The state read by save_writer_start, NULL if there was none. Valid until the first save_writer_submit.
+const void* save_writer_get_loaded(SaveWriter* w, size_t* size);
+
+// Copies the state, to be saved by the thread. Returns false if it's larger than max_size.
+bool save_writer_submit(SaveWriter* w, const void* state, size_t size);
+// Waits until everything submitted is committed
+void save_writer_flush(SaveWriter* w);
+
+void save_writer_get_stats(SaveWriter* w, SaveWriterStats* out);
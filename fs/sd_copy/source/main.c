@@ -0,0 +1,146 @@
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <switch.h>
+
+#include "file_copy.h"
+
+//This example copies a file on the SD card and verifies the copy, with a pipeline of threads which read, hash and write at the same time (see file_copy.h).
+//For comparison, the same copy can be done the usual way, with fread/fwrite and hashing in a single thread.
+
+#define SRC_PATH "sdmc:/sd_copy_src.bin"
+#define DST_PATH "sdmc:/sd_copy_dst.bin"
+#define TEST_FILE_SIZE (256*1024*1024)
+#define STDIO_CHUNK_SIZE 0x100000
+
+//Writes a test file to copy, when there's none yet.
+bool create_test_file(void) {
+    FILE* f = fopen(SRC_PATH, "wb");
+    if (f==NULL) return false;
+
+    u32* chunk = (u32*)malloc(STDIO_CHUNK_SIZE);
+    bool ok = chunk!=NULL;
+    for (u32 pos=0; ok && pos<TEST_FILE_SIZE; pos+=STDIO_CHUNK_SIZE) {
+        for (u32 i=0; i<STDIO_CHUNK_SIZE/4; i++) chunk[i] = (pos/4 + i) * 2654435761U;
+        ok = fwrite(chunk, STDIO_CHUNK_SIZE, 1, f) == 1;
+    }
+    free(chunk);
+    fclose(f);
+    return ok;
+}
+
+void print_hash(const u8* hash) {
+    for (u32 i=0; i<SHA256_HASH_SIZE; i++) printf("%02x", hash[i]);
+    printf("\n");
+}
+
+//Runs fileCopy, showing its progress. dst NULL only hashes src.
+Result run_pipeline(const char* src, const char* dst, u8* hash) {
+    FileCopy c;
+    Result rc = fileCopyStart(&c, src, dst);
+    if (R_FAILED(rc)) return rc;
+
+    while (!fileCopyIsDone(&c)) {
+        printf("\x1b[20;1H%s: read %lu, hashed %lu, written %lu MiB, %.1f MB/s      \n", dst ? "copy" : "verify",
+            c.bytes_read >> 20, c.bytes_hashed >> 20, c.bytes_written >> 20, fileCopyGetRate(&c));
+        consoleUpdate(NULL);
+        svcSleepThread(50000000ULL);
+    }
+
+    double rate = fileCopyGetRate(&c);
+    u64 total = armTicksToNs(c.end_tick - c.start_tick);
+    printf("\x1b[20;1H%s: %lu MiB at %.1f MB/s. Busy: read %.0f%%, hash %.0f%%, write %.0f%%" CONSOLE_ESC(K) "\n", dst ? "copy" : "verify", c.size >> 20, rate,
+        total ? armTicksToNs(c.read_ticks) * 100.0 / total : 0.0, total ? armTicksToNs(c.hash_ticks) * 100.0 / total : 0.0,
+        total ? armTicksToNs(c.write_ticks) * 100.0 / total : 0.0);
+    return fileCopyFinish(&c, hash);
+}
+
+//The single-threaded way, each step waiting for the previous one.
+bool run_stdio(u8* hash) {
+    FILE* in = fopen(SRC_PATH, "rb");
+    FILE* out = fopen(DST_PATH, "wb");
+    u8* chunk = (u8*)malloc(STDIO_CHUNK_SIZE);
+    bool ok = in && out && chunk;
+
+    Sha256Context sha;
+    sha256ContextCreate(&sha);
+    u64 start = armGetSystemTick();
+    u64 total = 0;
+    while (ok) {
+        size_t n = fread(chunk, 1, STDIO_CHUNK_SIZE, in);
+        if (n==0) break;
+        sha256ContextUpdate(&sha, chunk, n);
+        ok = fwrite(chunk, 1, n, out) == n;
+        total += n;
+    }
+    if (out && fclose(out)!=0) ok = false;
+    if (in) fclose(in);
+    free(chunk);
+
+    u64 ns = armTicksToNs(armGetSystemTick() - start);
+    if (ok) {
+        sha256ContextGetHash(&sha, hash);
+        printf("fread/fwrite: %lu MiB at %.1f MB/s\n", total >> 20, ns ? total * 1000.0 / ns : 0.0);
+    }
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    consoleInit(NULL);
+
+    printf("sd_copy example\n");
+    printf("Press A to copy " SRC_PATH " to " DST_PATH " with the pipeline, then verify the copy.\n");
+    printf("Press Y to copy it with fread/fwrite instead.\n");
+    printf("Press X to create a %u MiB test file at " SRC_PATH ".\n", TEST_FILE_SIZE >> 20);
+
+    // Main loop
+    while(appletMainLoop())
+    {
+        //Scan all the inputs. This should be done once for each frame
+        hidScanInput();
+
+        //hidKeysDown returns information about which buttons have been just pressed (and they weren't in the previous frame)
+        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+
+        if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
+
+        if (kDown & KEY_X) {
+            printf("Creating " SRC_PATH "...\n");
+            consoleUpdate(NULL);
+            printf(create_test_file() ? "Done.\n" : "Failed to create " SRC_PATH ".\n");
+        }
+
+        if (kDown & KEY_A) {
+            u8 hash[SHA256_HASH_SIZE], verify_hash[SHA256_HASH_SIZE];
+            Result rc = run_pipeline(SRC_PATH, DST_PATH, hash);
+            if (R_FAILED(rc)) printf("Copy failed: 0x%x\n", rc);
+            else {
+                printf("SHA-256: ");
+                print_hash(hash);
+
+                //Hashing the copy reads it back from the card.
+                rc = run_pipeline(DST_PATH, NULL, verify_hash);
+                if (R_FAILED(rc)) printf("Verify failed: 0x%x\n", rc);
+                else printf(memcmp(hash, verify_hash, sizeof(hash))==0 ? "The copy matches.\n" : "The copy DOESN'T match.\n");
+            }
+        }
+
+        if (kDown & KEY_Y) {
+            u8 hash[SHA256_HASH_SIZE];
+            printf("Copying with fread/fwrite...\n");
+            consoleUpdate(NULL);
+            if (run_stdio(hash)) {
+                printf("SHA-256: ");
+                print_hash(hash);
+            }
+            else printf("Copy failed.\n");
+        }
+
+        consoleUpdate(NULL);
+    }
+
+    consoleExit(NULL);
+    return 0;
+}
@@ -1,11 +1,52 @@
 #include <string.h>
 #include <stdio.h>
 #include <dirent.h>
+#include <sys/stat.h>
 
 #include <switch.h>
 
+#include "dir_scan.h"
+
 //The SD card is automatically mounted as the default device, usable with standard stdio. SD root dir is located at "/" (also "sdmc:/" but normally using the latter isn't needed).
 //The default current-working-directory when using relative paths is normally the directory where your application is located on the SD card.
+//Directories can also be listed with the native fs API, many entries per call, see dir_scan.h. This is much faster for large directories.
+
+#define BENCH_PATH "sdmc:/switch"
+
+//Lists path with readdir, and a stat per entry for the size, the way stdio code usually does it.
+u32 count_readdir(const char* path, u64* total_size) {
+    u32 count = 0;
+    *total_size = 0;
+    DIR* dir = opendir(path);
+    if (dir==NULL) return 0;
+
+    struct dirent* ent;
+    char entpath[PATH_MAX];
+    while ((ent = readdir(dir))) {
+        struct stat st;
+        snprintf(entpath, sizeof(entpath), "%s/%s", path, ent->d_name);
+        if (stat(entpath, &st)==0 && S_ISREG(st.st_mode)) *total_size += st.st_size;
+        count++;
+    }
+    closedir(dir);
+    return count;
+}
+
+//Same, with dir_scan.
+u32 count_dir_scan(const char* path, u64* total_size) {
+    u32 count = 0;
+    *total_size = 0;
+    DirScan scan;
+    if (R_FAILED(dirScanOpen(&scan, path, DirScanFlags_All))) return 0;
+
+    const FsDirectoryEntry* ent;
+    while ((ent = dirScanNext(&scan))) {
+        if (ent->type == FsDirEntryType_File) *total_size += ent->file_size;
+        count++;
+    }
+    dirScanClose(&scan);
+    return count;
+}
 
 int main(int argc, char **argv)
 {
@@ -30,6 +71,28 @@ int main(int argc, char **argv)
         printf("Done.\n");
     }
 
+    DirScan scan;
+    Result rc = dirScanOpen(&scan, "", DirScanFlags_All);//Same, with the sizes of the files.
+    if (R_FAILED(rc))
+    {
+        printf("dirScanOpen() failed: 0x%x\n", rc);
+    }
+    else
+    {
+        printf("Dir-listing for '' with dir_scan:\n");
+        const FsDirectoryEntry* ent2;
+        while ((ent2 = dirScanNext(&scan)))
+        {
+            if (ent2->type == FsDirEntryType_Dir) printf("dir:  %s\n", ent2->name);
+            else printf("file: %s, %ld bytes\n", ent2->name, ent2->file_size);
+        }
+        if (R_FAILED(scan.rc)) printf("fsDirRead() failed: 0x%x\n", scan.rc);
+        dirScanClose(&scan);
+        printf("Done.\n");
+    }
+
+    printf("Press A to time both ways of listing " BENCH_PATH ".\n");
+
     // Main loop
     while(appletMainLoop())
     {
@@ -41,6 +104,19 @@ int main(int argc, char **argv)
 
         if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
 
+        if (kDown & KEY_A)
+        {
+            u64 size_readdir, size_scan;
+            u64 start = armGetSystemTick();
+            u32 count = count_readdir(BENCH_PATH, &size_readdir);
+            u64 mid = armGetSystemTick();
+            u32 count2 = count_dir_scan(BENCH_PATH, &size_scan);
+            u64 end = armGetSystemTick();
+
+            printf("readdir+stat: %u entries, %lu bytes in %.2f ms\n", count, size_readdir, armTicksToNs(mid - start) / 1000000.0);
+            printf("dir_scan:     %u entries, %lu bytes in %.2f ms\n", count2, size_scan, armTicksToNs(end - mid) / 1000000.0);
+        }
+
         consoleUpdate(NULL);
     }
 
@@ -0,0 +1,184 @@
+#include <stdio.h>
+#include <string.h>
+#include <sys/iosupport.h>
+
+#include "console_writer.h"
+
+#define CONSOLE_WRITER_BUFFER_SIZE 4096
+#define CONSOLE_WRITER_MAX_ESCAPE  32
+
+static PrintConsole* s_con;
+static ConsoleDrawRunFunc s_drawRun;
+static const devoptab_t* s_prevStdout;
+static char s_buffer[CONSOLE_WRITER_BUFFER_SIZE];
+
+// Range of characters drawn through runs: printable, and part of the font
+static u8 s_plainFirst, s_plainLast;
+
+// Escape sequence cut by the end of a write, completed by the next one. libnx only sees whole sequences.
+static char s_escape[CONSOLE_WRITER_MAX_ESCAPE];
+static size_t s_escapeLen;
+
+static inline bool consoleWriterIsPlain(char c)
+{
+    return (u8)c >= s_plainFirst && (u8)c <= s_plainLast;
+}
+
+static void consoleWriterForward(struct _reent* r, void* fd, const char* ptr, size_t len)
+{
+    while (len)
+    {
+        ssize_t ret = s_prevStdout->write_r(r, fd, ptr, len);
+        if (ret <= 0)
+            break;
+        ptr += ret;
+        len -= ret;
+    }
+}
+
+// Length of the escape sequence at the start of ptr (a CSI sequence ends with a byte in 0x40-0x7E,
+// anything else after ESC is a single character), or 0 if it does not end within len
+static size_t consoleWriterEscapeLength(const char* ptr, size_t len)
+{
+    if (len < 2)
+        return 0;
+    if (ptr[1] != '[')
+        return 2;
+    for (size_t i = 2; i < len; i ++)
+    {
+        if ((u8)ptr[i] >= 0x40 && (u8)ptr[i] <= 0x7E)
+            return i + 1;
+    }
+    return 0;
+}
+
+// Completes the pending escape sequence with the start of ptr, returns the number of bytes taken
+static size_t consoleWriterCompleteEscape(struct _reent* r, void* fd, const char* ptr, size_t len)
+{
+    size_t taken = len < sizeof(s_escape) - s_escapeLen ? len : sizeof(s_escape) - s_escapeLen;
+    memcpy(&s_escape[s_escapeLen], ptr, taken);
+
+    size_t seqLen = consoleWriterEscapeLength(s_escape, s_escapeLen + taken);
+    if (!seqLen)
+    {
+        if (s_escapeLen + taken < sizeof(s_escape))
+        {
+            // Still incomplete
+            s_escapeLen += taken;
+            return taken;
+        }
+
+        // Not something libnx would parse either: let it deal with the bytes as they are
+        seqLen = sizeof(s_escape);
+    }
+
+    consoleWriterForward(r, fd, s_escape, seqLen);
+    taken = seqLen - s_escapeLen;
+    s_escapeLen = 0;
+    return taken;
+}
+
+static ssize_t consoleWriterWrite(struct _reent* r, void* fd, const char* ptr, size_t len)
+{
+    PrintConsole* con = s_con;
+
+    // Characters are handled by a custom callback: libnx has to see all of them
+    if (con->PrintChar)
+    {
+        consoleWriterForward(r, fd, ptr, len);
+        return len;
+    }
+
+    size_t i = s_escapeLen ? consoleWriterCompleteEscape(r, fd, ptr, len) : 0;
+    while (i < len)
+    {
+        size_t start = i;
+        if (ptr[i] == 0x1B)
+        {
+            size_t seqLen = consoleWriterEscapeLength(&ptr[i], len - i);
+            if (!seqLen && len - i < sizeof(s_escape))
+            {
+                // Keep the start of the sequence for the next write
+                memcpy(s_escape, &ptr[i], len - i);
+                s_escapeLen = len - i;
+                break;
+            }
+            if (!seqLen)
+                seqLen = len - i;
+            consoleWriterForward(r, fd, &ptr[i], seqLen);
+            i += seqLen;
+            continue;
+        }
+
+        if (!consoleWriterIsPlain(ptr[i]))
+        {
+            // Control characters and characters outside of the font, all at once
+            while (i < len && ptr[i] != 0x1B && !consoleWriterIsPlain(ptr[i]))
+                i ++;
+            consoleWriterForward(r, fd, &ptr[start], i - start);
+            continue;
+        }
+
+        if (con->cursorX >= con->windowWidth || con->cursorY >= con->windowHeight)
+        {
+            // The character starts a new row, which might scroll the window: libnx takes care of it,
+            // and draws the character as well
+            consoleWriterForward(r, fd, &ptr[i], 1);
+            i ++;
+            continue;
+        }
+
+        // Draw as much as fits in the row, advancing the cursor the way libnx does
+        size_t room = con->windowWidth - con->cursorX;
+        while (i < len && i - start < room && consoleWriterIsPlain(ptr[i]))
+            i ++;
+        s_drawRun(con, con->windowX + con->cursorX, con->windowY + con->cursorY, &ptr[start], i - start);
+        con->cursorX += i - start;
+    }
+
+    return len;
+}
+
+static const devoptab_t s_devoptab = {
+    .name = "con",
+    .write_r = consoleWriterWrite,
+};
+
+void consoleWriterInit(PrintConsole* con, ConsoleDrawRunFunc drawRun)
+{
+    if (s_con)
+        return;
+
+    int first = con->font.asciiOffset > 0x20 ? con->font.asciiOffset : 0x20;
+    int last = con->font.asciiOffset + con->font.numChars - 1;
+    if (last > 0x7E)
+        last = 0x7E;
+    s_plainFirst = first;
+    s_plainLast = last;
+    s_escapeLen = 0;
+
+    s_con = con;
+    s_drawRun = drawRun;
+    fflush(stdout);
+    s_prevStdout = devoptab_list[STD_OUT];
+    devoptab_list[STD_OUT] = &s_devoptab;
+    setvbuf(stdout, s_buffer, _IOFBF, sizeof(s_buffer));
+}
+
+void consoleWriterExit(void)
+{
+    if (!s_con)
+        return;
+
+    // Back to the unbuffered libnx device, as set up by consoleInit
+    fflush(stdout);
+    setvbuf(stdout, NULL, _IONBF, 0);
+    devoptab_list[STD_OUT] = s_prevStdout;
+    s_con = NULL;
+}
+
+void consoleWriterFlush(void)
+{
+    if (s_con)
+        fflush(stdout);
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <switch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Buffered stdout writer for the GPU console renderers.
+// libnx's console device prints one character at a time, calling the drawChar callback of the
+// renderer for each of them. This writer takes its place as the stdout device: stdout becomes
+// fully buffered, and each write is split into runs of plain characters (printable, within the
+// font) that are handed to the renderer at once, one call per run and row. Everything else
+// (escape sequences, control characters, wrapping to the next row and scrolling) is passed on
+// to the libnx device, so the console state stays libnx's own.
+//
+// stderr is left unbuffered, so its output may overtake buffered stdout output.
+//
+// Usage, from the renderer callbacks:
+//     init:         consoleWriterInit(con, drawRun);
+//     flushAndSwap: consoleWriterFlush(); then render as usual
+//     deinit:       consoleWriterExit();
+
+// Draws len plain characters at x,y (console coordinates) with the current attributes of the
+// console. Runs never extend past the end of the row of the window.
+typedef void (*ConsoleDrawRunFunc)(PrintConsole* con, int x, int y, const char* str, int len);
+
+void consoleWriterInit(PrintConsole* con, ConsoleDrawRunFunc drawRun);
+void consoleWriterExit(void);
+
+// Writes out the buffered output, so that it shows up in the frame about to be rendered
+void consoleWriterFlush(void);
+
+#ifdef __cplusplus
+}
+#endif
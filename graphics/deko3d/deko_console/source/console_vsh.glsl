@@ -12,6 +12,7 @@ layout (std140, binding = 0) uniform Config
     vec4 dimensions;
     vec4 vertices[3];
     vec4 palettes[24];
+    vec4 scroll; // x: row of the character buffer holding the first console row
 } u;
 
 void main()
@@ -19,6 +20,7 @@ void main()
     float id = float(gl_InstanceID);
     float tileRow = floor(id / u.dimensions.z);
     float tileCol = id - tileRow * u.dimensions.z;
+    tileRow = mod(tileRow - u.scroll.x + u.dimensions.w, u.dimensions.w);
 
     vec2 basePos;
     basePos.x = 2.0 * (tileCol + 0.5) / u.dimensions.z - 1.0;
@@ -6,6 +6,12 @@
 #include <switch.h>
 #include <deko3d.h>
 
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#include "console_writer.h"
+
 // Define the desired number of framebuffers
 #define FB_NUM 2
 
@@ -15,6 +21,13 @@
 // Define the size of the memory block that will hold command lists
 #define CMDMEMSIZE (64*1024)
 
+// Define the size of the memory slice that holds the per-frame commands of each character buffer
+#define DYNCMDMEMSIZE (4*1024)
+
+// Define the number of character buffers. The CPU writes to one of them while the GPU
+// may still be reading the others, so that printing never waits for the GPU.
+#define NUM_CHARBUFS 3
+
 #define NUM_IMAGE_SLOTS   1
 #define NUM_SAMPLER_SLOTS 1
 
@@ -34,6 +47,7 @@ typedef struct {
     float dimensions[4];
     VertexDef vertices[3];
     PaletteColor palettes[24];
+    float scroll[4];
 } ConsoleConfig;
 
 static const VertexDef g_vertexData[3] = {
@@ -101,17 +115,32 @@ struct GpuRenderer {
     DkSwapchain swapchain;
     DkImage framebuffers[FB_NUM];
     DkImage tileset;
-    ConsoleChar* charBuf;
+    ConsoleChar* charBufs[NUM_CHARBUFS];
+    ConsoleChar* charBuf; // the one being written to this frame
+    unsigned curCharBuf;
+
+    // Bookkeeping used to bring a character buffer up to date when it gets reused:
+    // the frame each row was last modified in, and the last frame each buffer was written in.
+    u32 frameCounter;
+    u32* rowFrames;
+    u32 charBufFrames[NUM_CHARBUFS];
+
+    // The rows are stored as a ring buffer: this is the row of the character buffers that
+    // holds the first console row, and it is passed to the vertex shader.
+    int baseRow;
+    DkGpuAddr configAddr;
+    uint32_t configSize;
 
     uint32_t codeMemOffset;
     DkShader vertexShader;
     DkShader fragmentShader;
 
     DkCmdBuf cmdbuf;
+    DkCmdBuf dynCmdbuf;
     DkCmdList cmdsBindFramebuffer[FB_NUM];
-    DkCmdList cmdsRender;
+    DkCmdList cmdsRender[NUM_CHARBUFS];
 
-    DkFence lastRenderFence;
+    DkFence renderFences[NUM_CHARBUFS];
 };
 
 static struct GpuRenderer* GpuRenderer(PrintConsole* con)
@@ -119,6 +148,15 @@ static struct GpuRenderer* GpuRenderer(PrintConsole* con)
     return (struct GpuRenderer*)con->renderer;
 }
 
+// Returns the row of the character buffers that holds the given console row
+static inline int GpuRenderer_row(struct GpuRenderer* r, PrintConsole* con, int y)
+{
+    int row = y + r->baseRow;
+    return row < con->consoleHeight ? row : row - con->consoleHeight;
+}
+
+static void GpuRenderer_drawRun(PrintConsole* con, int x, int y, const char* str, int len);
+
 static void GpuRenderer_destroy(struct GpuRenderer* r)
 {
     // Make sure the queue is idle before destroying anything
@@ -126,12 +164,14 @@ static void GpuRenderer_destroy(struct GpuRenderer* r)
 
     // Destroy all the resources we've created
     dkQueueDestroy(r->queue);
+    dkCmdBufDestroy(r->dynCmdbuf);
     dkCmdBufDestroy(r->cmdbuf);
     dkSwapchainDestroy(r->swapchain);
     dkMemBlockDestroy(r->dataMemBlock);
     dkMemBlockDestroy(r->codeMemBlock);
     dkMemBlockDestroy(r->imageMemBlock);
     dkDeviceDestroy(r->device);
+    free(r->rowFrames);
 
     // Clear out all state
     memset(&r->initialized, 0, sizeof(*r) - offsetof(struct GpuRenderer, initialized));
@@ -272,7 +312,7 @@ static bool GpuRenderer_init(PrintConsole* con)
     sampler.magFilter = DkFilter_Nearest;
     dkSamplerDescriptorInitialize(&descriptors.samplers[0], &sampler);
 
-    uint32_t descriptorsOffset = CMDMEMSIZE;
+    uint32_t descriptorsOffset = CMDMEMSIZE + NUM_CHARBUFS*DYNCMDMEMSIZE;
     uint32_t configOffset = (descriptorsOffset + sizeof(descriptors) + DK_UNIFORM_BUF_ALIGNMENT - 1) &~ (DK_UNIFORM_BUF_ALIGNMENT - 1);
     uint32_t configSize = (sizeof(ConsoleConfig) + DK_UNIFORM_BUF_ALIGNMENT - 1) &~ (DK_UNIFORM_BUF_ALIGNMENT - 1);
 
@@ -281,7 +321,7 @@ static bool GpuRenderer_init(PrintConsole* con)
 
     // Create a memory block which will be used for recording command lists using a command buffer
     dkMemBlockMakerDefaults(&memBlockMaker, r->device,
-        (charBufOffset + charBufSize + DK_MEMBLOCK_ALIGNMENT - 1) &~ (DK_MEMBLOCK_ALIGNMENT - 1)
+        (charBufOffset + NUM_CHARBUFS*charBufSize + DK_MEMBLOCK_ALIGNMENT - 1) &~ (DK_MEMBLOCK_ALIGNMENT - 1)
     );
     memBlockMaker.flags = DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached;
     r->dataMemBlock = dkMemBlockCreate(&memBlockMaker);
@@ -290,6 +330,7 @@ static bool GpuRenderer_init(PrintConsole* con)
     DkCmdBufMaker cmdbufMaker;
     dkCmdBufMakerDefaults(&cmdbufMaker, r->device);
     r->cmdbuf = dkCmdBufCreate(&cmdbufMaker);
+    r->dynCmdbuf = dkCmdBufCreate(&cmdbufMaker);
 
     // Feed our memory to the command buffer so that we can start recording commands
     dkCmdBufAddMemory(r->cmdbuf, r->dataMemBlock, 0, CMDMEMSIZE);
@@ -320,6 +361,8 @@ static bool GpuRenderer_init(PrintConsole* con)
 
     // Set up configuration
     DkGpuAddr configAddr = dkMemBlockGetGpuAddr(r->dataMemBlock) + configOffset;
+    r->configAddr = configAddr;
+    r->configSize = configSize;
     ConsoleConfig consoleConfig = {};
     consoleConfig.dimensions[0] = width;
     consoleConfig.dimensions[1] = height;
@@ -345,10 +388,18 @@ static bool GpuRenderer_init(PrintConsole* con)
     // Destroy the scratch memory block since we don't need it anymore
     dkMemBlockDestroy(scratchMemBlock);
 
-    // Retrieve the address of the character buffer
+    // Retrieve the addresses of the character buffers
     DkGpuAddr charBufAddr = dkMemBlockGetGpuAddr(r->dataMemBlock) + charBufOffset;
-    r->charBuf = (ConsoleChar*)((uint8_t*)dkMemBlockGetCpuAddr(r->dataMemBlock) + charBufOffset);
-    memset(r->charBuf, 0, charBufSize);
+    for (unsigned i = 0; i < NUM_CHARBUFS; i ++) {
+        r->charBufs[i] = (ConsoleChar*)((uint8_t*)dkMemBlockGetCpuAddr(r->dataMemBlock) + charBufOffset + i*charBufSize);
+        memset(r->charBufs[i], 0, charBufSize);
+        r->charBufFrames[i] = 0;
+    }
+    r->curCharBuf = 0;
+    r->charBuf = r->charBufs[0];
+    r->frameCounter = 1; // buffers start out as last written in frame 0
+    r->rowFrames = (u32*)calloc(con->consoleHeight, sizeof(u32));
+    r->baseRow = 0;
 
     // Generate a command list for each framebuffer, which will bind each of them as a render target
     for (unsigned i = 0; i < FB_NUM; i ++) {
@@ -374,23 +425,28 @@ static bool GpuRenderer_init(PrintConsole* con)
     rasterizerState.fillRectangleEnable = true;
     colorState.alphaCompareOp = DkCompareOp_Greater;
 
-    // Generate the main rendering command list
-    dkCmdBufSetViewports(r->cmdbuf, 0, &viewport, 1);
-    dkCmdBufSetScissors(r->cmdbuf, 0, &scissor, 1);
-    //dkCmdBufClearColorFloat(r->cmdbuf, 0, DkColorMask_RGBA, 0.125f, 0.294f, 0.478f, 0.0f);
-    dkCmdBufClearColorFloat(r->cmdbuf, 0, DkColorMask_RGBA, 0.0f, 0.0f, 0.0f, 0.0f);
-    dkCmdBufBindShaders(r->cmdbuf, DkStageFlag_GraphicsMask, shaders, sizeof(shaders)/sizeof(shaders[0]));
-    dkCmdBufBindRasterizerState(r->cmdbuf, &rasterizerState);
-    dkCmdBufBindColorState(r->cmdbuf, &colorState);
-    dkCmdBufBindColorWriteState(r->cmdbuf, &colorWriteState);
-    dkCmdBufBindUniformBuffer(r->cmdbuf, DkStage_Vertex, 0, configAddr, configSize);
-    dkCmdBufBindTexture(r->cmdbuf, DkStage_Fragment, 0, dkMakeTextureHandle(0, 0));
-    dkCmdBufBindVtxAttribState(r->cmdbuf, g_attribState, sizeof(g_attribState)/sizeof(g_attribState[0]));
-    dkCmdBufBindVtxBufferState(r->cmdbuf, g_vtxbufState, sizeof(g_vtxbufState)/sizeof(g_vtxbufState[0]));
-    dkCmdBufBindVtxBuffer(r->cmdbuf, 0, charBufAddr, charBufSize);
-    dkCmdBufSetAlphaRef(r->cmdbuf, 0.0f);
-    dkCmdBufDraw(r->cmdbuf, DkPrimitive_Triangles, 3, totalConSize, 0, 0);
-    r->cmdsRender = dkCmdBufFinishList(r->cmdbuf);
+    // Generate the main rendering command list for each character buffer
+    for (unsigned i = 0; i < NUM_CHARBUFS; i ++) {
+        dkCmdBufSetViewports(r->cmdbuf, 0, &viewport, 1);
+        dkCmdBufSetScissors(r->cmdbuf, 0, &scissor, 1);
+        //dkCmdBufClearColorFloat(r->cmdbuf, 0, DkColorMask_RGBA, 0.125f, 0.294f, 0.478f, 0.0f);
+        dkCmdBufClearColorFloat(r->cmdbuf, 0, DkColorMask_RGBA, 0.0f, 0.0f, 0.0f, 0.0f);
+        dkCmdBufBindShaders(r->cmdbuf, DkStageFlag_GraphicsMask, shaders, sizeof(shaders)/sizeof(shaders[0]));
+        dkCmdBufBindRasterizerState(r->cmdbuf, &rasterizerState);
+        dkCmdBufBindColorState(r->cmdbuf, &colorState);
+        dkCmdBufBindColorWriteState(r->cmdbuf, &colorWriteState);
+        dkCmdBufBindUniformBuffer(r->cmdbuf, DkStage_Vertex, 0, configAddr, configSize);
+        dkCmdBufBindTexture(r->cmdbuf, DkStage_Fragment, 0, dkMakeTextureHandle(0, 0));
+        dkCmdBufBindVtxAttribState(r->cmdbuf, g_attribState, sizeof(g_attribState)/sizeof(g_attribState[0]));
+        dkCmdBufBindVtxBufferState(r->cmdbuf, g_vtxbufState, sizeof(g_vtxbufState)/sizeof(g_vtxbufState[0]));
+        dkCmdBufBindVtxBuffer(r->cmdbuf, 0, charBufAddr + i*charBufSize, charBufSize);
+        dkCmdBufSetAlphaRef(r->cmdbuf, 0.0f);
+        dkCmdBufDraw(r->cmdbuf, DkPrimitive_Triangles, 3, totalConSize, 0, 0);
+        r->cmdsRender[i] = dkCmdBufFinishList(r->cmdbuf);
+    }
+
+    // Take over stdout, so that printing goes through GpuRenderer_drawRun a run of characters at a time
+    consoleWriterInit(con, GpuRenderer_drawRun);
 
     r->initialized = true;
     return true;
@@ -401,14 +457,14 @@ static void GpuRenderer_deinit(PrintConsole* con)
     struct GpuRenderer* r = GpuRenderer(con);
 
     if (r->initialized) {
+        consoleWriterExit();
         GpuRenderer_destroy(r);
     }
 }
 
-static void GpuRenderer_drawChar(PrintConsole* con, int x, int y, int c)
+// Resolves the palette entries of the current attributes
+static inline void GpuRenderer_colors(PrintConsole* con, int* front, int* back)
 {
-    struct GpuRenderer* r = GpuRenderer(con);
-
     int writingColor = con->fg;
     int screenColor = con->bg;
 
@@ -424,28 +480,89 @@ static void GpuRenderer_drawChar(PrintConsole* con, int x, int y, int c)
         screenColor = tmp;
     }
 
-    // Wait for the fence
-    dkFenceWait(&r->lastRenderFence, UINT64_MAX);
+    *front = writingColor;
+    *back = screenColor;
+}
+
+static void GpuRenderer_drawChar(PrintConsole* con, int x, int y, int c)
+{
+    struct GpuRenderer* r = GpuRenderer(con);
 
-    ConsoleChar* pos = &r->charBuf[y*con->consoleWidth+x];
+    int writingColor, screenColor;
+    GpuRenderer_colors(con, &writingColor, &screenColor);
+
+    // The current character buffer is not in use by the GPU, so it can be written to directly
+    int row = GpuRenderer_row(r, con, y);
+    ConsoleChar* pos = &r->charBuf[row*con->consoleWidth+x];
     pos->tileId = c;
     pos->frontPal = writingColor;
     pos->backPal = screenColor;
+    r->rowFrames[row] = r->frameCounter;
+}
+
+static void GpuRenderer_drawRun(PrintConsole* con, int x, int y, const char* str, int len)
+{
+    struct GpuRenderer* r = GpuRenderer(con);
+
+    // Same attributes for the whole run: the palettes are resolved once
+    int writingColor, screenColor;
+    GpuRenderer_colors(con, &writingColor, &screenColor);
+
+    int row = GpuRenderer_row(r, con, y);
+    ConsoleChar* pos = &r->charBuf[row*con->consoleWidth+x];
+    uint8_t offset = con->font.asciiOffset;
+    int i = 0;
+
+#ifdef __ARM_NEON
+    // A ConsoleChar is the tile id followed by the two palettes, which as a little endian halfword is
+    // frontPal | backPal << 8. Widen 16 characters at a time into tile ids, and interleave them with that.
+    uint16x8_t pals = vdupq_n_u16(writingColor | (screenColor << 8));
+    uint8x16_t offsets = vdupq_n_u8(offset);
+    for (; i + 16 <= len; i += 16) {
+        uint8x16_t chars = vsubq_u8(vld1q_u8((const uint8_t*)&str[i]), offsets);
+        uint16x8x2_t lo = { { vmovl_u8(vget_low_u8(chars)), pals } };
+        uint16x8x2_t hi = { { vmovl_high_u8(chars), pals } };
+        vst2q_u16((uint16_t*)&pos[i], lo);
+        vst2q_u16((uint16_t*)&pos[i+8], hi);
+    }
+#endif
+
+    for (; i < len; i ++) {
+        pos[i].tileId = (uint8_t)str[i] - offset;
+        pos[i].frontPal = writingColor;
+        pos[i].backPal = screenColor;
+    }
+
+    r->rowFrames[row] = r->frameCounter;
 }
 
 static void GpuRenderer_scrollWindow(PrintConsole* con)
 {
     struct GpuRenderer* r = GpuRenderer(con);
 
-    // Wait for the fence
-    dkFenceWait(&r->lastRenderFence, UINT64_MAX);
+    if (con->windowX == 0 && con->windowY == 0 &&
+        con->windowWidth == con->consoleWidth && con->windowHeight == con->consoleHeight) {
+        // The window covers the whole console, so just rotate the ring of rows. The row that
+        // wraps around to the bottom takes over the contents of the previous bottom row.
+        int oldLastRow = GpuRenderer_row(r, con, con->consoleHeight-1);
+        r->baseRow = GpuRenderer_row(r, con, 1);
+        int lastRow = GpuRenderer_row(r, con, con->consoleHeight-1);
+        memcpy(
+            &r->charBuf[lastRow*con->consoleWidth],
+            &r->charBuf[oldLastRow*con->consoleWidth],
+            sizeof(ConsoleChar)*con->consoleWidth);
+        r->rowFrames[lastRow] = r->frameCounter;
+        return;
+    }
 
     // Perform the scrolling
     for (int y = 0; y < con->windowHeight-1; y ++) {
+        int row = GpuRenderer_row(r, con, con->windowY+y+0);
         memcpy(
-            &r->charBuf[(con->windowY+y+0)*con->consoleWidth + con->windowX],
-            &r->charBuf[(con->windowY+y+1)*con->consoleWidth + con->windowX],
+            &r->charBuf[row*con->consoleWidth + con->windowX],
+            &r->charBuf[GpuRenderer_row(r, con, con->windowY+y+1)*con->consoleWidth + con->windowX],
             sizeof(ConsoleChar)*con->windowWidth);
+        r->rowFrames[row] = r->frameCounter;
     }
 }
 
@@ -453,20 +570,51 @@ static void GpuRenderer_flushAndSwap(PrintConsole* con)
 {
     struct GpuRenderer* r = GpuRenderer(con);
 
+    // Draw what is left in the stdout buffer, so that it shows up in this frame
+    consoleWriterFlush();
+
     // Acquire a framebuffer from the swapchain (and wait for it to be available)
     int slot = dkQueueAcquireImage(r->queue, r->swapchain);
 
     // Run the command list that binds said framebuffer as a render target
     dkQueueSubmitCommands(r->queue, r->cmdsBindFramebuffer[slot]);
 
-    // Run the main rendering command list
-    dkQueueSubmitCommands(r->queue, r->cmdsRender);
+    // Update the base row in the configuration. The commands are recorded into the memory
+    // slice of the current character buffer, which the GPU is done with as well.
+    unsigned cur = r->curCharBuf;
+    float scroll[4] = { (float)r->baseRow, 0.0f, 0.0f, 0.0f };
+    dkCmdBufClear(r->dynCmdbuf);
+    dkCmdBufAddMemory(r->dynCmdbuf, r->dataMemBlock, CMDMEMSIZE + cur*DYNCMDMEMSIZE, DYNCMDMEMSIZE);
+    dkCmdBufPushConstants(r->dynCmdbuf, r->configAddr, r->configSize, offsetof(ConsoleConfig, scroll), sizeof(scroll), scroll);
+    dkQueueSubmitCommands(r->queue, dkCmdBufFinishList(r->dynCmdbuf));
+
+    // Run the main rendering command list, reading from the current character buffer
+    dkQueueSubmitCommands(r->queue, r->cmdsRender[cur]);
 
-    // Signal the fence
-    dkQueueSignalFence(r->queue, &r->lastRenderFence, false);
+    // Signal the fence, which tells us when the GPU is done with the character buffer
+    dkQueueSignalFence(r->queue, &r->renderFences[cur], false);
 
     // Now that we are done rendering, present it to the screen
     dkQueuePresentImage(r->queue, r->swapchain, slot);
+
+    // Move on to the oldest character buffer, which is the only place we may wait for the GPU
+    unsigned next = (cur + 1) % NUM_CHARBUFS;
+    dkFenceWait(&r->renderFences[next], UINT64_MAX);
+
+    // Bring it up to date by copying forward the rows modified since it was last written to
+    u32 stale = r->charBufFrames[next];
+    for (int y = 0; y < con->consoleHeight; y ++) {
+        if ((s32)(r->rowFrames[y] - stale) > 0) {
+            memcpy(
+                &r->charBufs[next][y*con->consoleWidth],
+                &r->charBufs[cur][y*con->consoleWidth],
+                sizeof(ConsoleChar)*con->consoleWidth);
+        }
+    }
+
+    r->charBufFrames[cur] = r->frameCounter++;
+    r->curCharBuf = next;
+    r->charBuf = r->charBufs[next];
 }
 
 static struct GpuRenderer s_gpuRenderer =
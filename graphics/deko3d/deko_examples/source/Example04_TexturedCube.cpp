@@ -7,6 +7,7 @@
 ** - Creating and using samplers and sampler descriptors
 ** - Calculating combined image+sampler handles for use by shaders
 ** - Initializing persistent state in a queue
+** - Loading a mip-mapped .dktx container, and streaming in its larger levels after the first frames
 **
 ** The texture used in this example was borrowed from https://pixabay.com/photos/cat-animal-pet-cats-close-up-300572/
 */
@@ -18,6 +19,7 @@
 #include "SampleFramework/CCmdMemRing.h"
 #include "SampleFramework/CDescriptorSet.h"
 #include "SampleFramework/CExternalImage.h"
+#include "SampleFramework/CImageUploadBatch.h"
 
 // C++ standard library headers
 #include <array>
@@ -108,6 +110,8 @@ class CExample04 final : public CApplication
     static constexpr unsigned DynamicCmdSize = 0x10000;
     static constexpr unsigned MaxImages = 1;
     static constexpr unsigned MaxSamplers = 1;
+    static constexpr unsigned InitialLevels = 4; // 16x16 and smaller, the rest is streamed in later
+    static constexpr u64 StreamDelayNs = 1000000000UL;
 
     dk::UniqueDevice device;
     dk::UniqueQueue queue;
@@ -131,6 +135,7 @@ class CExample04 final : public CApplication
 
     CMemPool::Handle vertexBuffer;
     CExternalImage texImage;
+    CImageUploadBatch uploadBatch;
 
     uint32_t framebufferWidth;
     uint32_t framebufferHeight;
@@ -183,8 +188,10 @@ public:
         vertexBuffer = pool_data->allocate(sizeof(CubeVertexData), alignof(Vertex));
         memcpy(vertexBuffer.getCpuAddr(), CubeVertexData.data(), vertexBuffer.getSize());
 
-        // Load the image
-        texImage.load(*pool_images, *pool_data, device, queue, "romfs:/cat-256x256.bc1", 256, 256, DkImageFormat_RGB_BC1);
+        // Load the smallest levels of the image, which is all that's needed to start rendering
+        uploadBatch.init(*pool_data, device, queue);
+        texImage.loadContainer(uploadBatch, *pool_images, device, "romfs:/cat-256x256.dktx", 0, InitialLevels);
+        uploadBatch.finish();
 
         // Configure persistent state in the queue
         {
@@ -193,7 +200,7 @@ public:
 
             // Configure a sampler
             dk::Sampler sampler;
-            sampler.setFilter(DkFilter_Linear, DkFilter_Linear);
+            sampler.setFilter(DkFilter_Linear, DkFilter_Linear, DkMipFilter_Linear);
             sampler.setWrapMode(DkWrapMode_ClampToEdge, DkWrapMode_ClampToEdge, DkWrapMode_ClampToEdge);
 
             // Upload the sampler descriptor
@@ -341,11 +348,24 @@ public:
         render_cmdlist = cmdbuf.finishList();
     }
 
-    void render()
+    void render(u64 ns)
     {
         // Begin generating the dynamic command list, for commands that need to be sent only this frame specifically
         dynmem.begin(dyncmd);
 
+        // Once the cube has been on screen for a while, stream in the rest of the mip chain. The copies go
+        // through the same queue ahead of this frame's commands, so the descriptor exposing the new levels
+        // can be updated right away, as long as the texture and descriptor caches are invalidated first.
+        if (texImage.getFirstResidentLevel() && ns >= StreamDelayNs && texImage.streamLevels(uploadBatch))
+        {
+            uploadBatch.submit();
+            dyncmd.barrier(DkBarrier_Full, DkInvalidateFlags_Image);
+            imageDescriptorSet.update(dyncmd, 0, texImage.getDescriptor());
+            dyncmd.barrier(DkBarrier_None, DkInvalidateFlags_Descriptors);
+        }
+        else
+            uploadBatch.reclaim();
+
         // Update the uniform buffer with the new transformation state (this data gets inlined in the command list)
         dyncmd.pushConstants(
             transformUniformBuffer.getGpuAddr(), transformUniformBuffer.getSize(),
@@ -402,7 +422,7 @@ public:
         transformState.mdlvMtx = glm::rotate(transformState.mdlvMtx, -period1 * tau, glm::vec3{0.0f, 1.0f, 0.0f});
         transformState.mdlvMtx = glm::scale(transformState.mdlvMtx, glm::vec3{0.5f});
 
-        render();
+        render(ns);
         return true;
     }
 };
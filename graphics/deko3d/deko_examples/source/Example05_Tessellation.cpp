@@ -1,5 +1,5 @@
 /*
-** deko3d Example 05: Simple Tessellation
+** deko3d Example 05: Tessellation (Adaptive Terrain LOD)
 ** This example shows how to use tessellation.
 ** New concepts in this example:
 ** - Using tessellation control and evaluation shaders
@@ -7,17 +7,42 @@
 ** - Configuring and using line polygon mode
 ** - Configuring and using built-in edge smoothing
 ** - Configuring and using blending (needed for obeying alpha generated by edge smoothing)
+** - Choosing tessellation levels per edge from the projected size of the edge (adaptive LOD)
+** - Discarding whole patches outside of the view frustum from the control shader
+** - Splitting a frame into a cached static pass and a small dynamic pass (CCmdListCache)
+** - Loading all the shaders into a single code allocation (CShaderLibrary)
+**
+** Press A to cycle through the scenes:
+** - A triangle, subdivided with constant tessellation levels
+** - A terrain made of quad patches, whose control shader picks the level of each edge so that
+**   its segments are about the same length on screen, and culls the patches out of view.
+**   Use UP/DOWN to change the target length of the segments.
+** - The same terrain with every patch subdivided the same, for comparison
+** The terrain scenes print the number of patches drawn and triangles generated every second:
+** with adaptive LOD, the triangle count follows the detail visible on screen instead of the
+** number of patches. The terrain state and draw are recorded once and replayed every frame; only
+** the statistics reset, the uniforms and the statistics binding are recorded per frame.
 */
 
 // Sample Framework headers
 #include "SampleFramework/CApplication.h"
 #include "SampleFramework/CMemPool.h"
 #include "SampleFramework/CShader.h"
+#include "SampleFramework/CCmdMemRing.h"
+#include "SampleFramework/CCmdListCache.h"
 
 // C++ standard library headers
 #include <array>
 #include <optional>
 
+// GLM headers
+#define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES // Enforces GLSL std140/std430 alignment rules for glm types
+#define GLM_FORCE_INTRINSICS               // Enables usage of SIMD CPU instructions (requiring the above as well)
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
 namespace
 {
     struct Vertex
@@ -43,6 +68,55 @@ namespace
         Vertex{ { -1.0f, -1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f } },
         Vertex{ { +1.0f, -1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } },
     };
+
+    struct TerrainVertex
+    {
+        float position[3];
+    };
+
+    constexpr std::array TerrainVertexAttribState =
+    {
+        DkVtxAttribState{ 0, 0, offsetof(TerrainVertex, position), DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
+    };
+
+    constexpr std::array TerrainVertexBufferState =
+    {
+        DkVtxBufferState{ sizeof(TerrainVertex), 0 },
+    };
+
+    // The terrain is a grid of quad patches centered on the origin
+    constexpr unsigned PatchesPerSide = 32;
+    constexpr unsigned NumPatches = PatchesPerSide * PatchesPerSide;
+    constexpr float PatchSize = 16.0f;
+    constexpr float TerrainHeight = 48.0f;
+    constexpr float MaxTessLevel = 32.0f;
+    constexpr float FixedTessLevel = 16.0f;
+
+    struct TerrainParams
+    {
+        glm::mat4 mdlvMtx;
+        glm::mat4 projMtx;
+        glm::vec4 lodParams;     // x: viewport width, y: viewport height, z: target edge length in pixels, w: max level
+        glm::vec4 terrainParams; // x: height scale, y: fixed level (0 for adaptive)
+    };
+
+    // Written by the tessellation control shader
+    struct TessStats
+    {
+        uint32_t visiblePatches;
+        uint32_t culledPatches;
+        uint32_t triangles;
+        uint32_t padding;
+    };
+
+    enum Scene
+    {
+        Scene_Triangle,
+        Scene_TerrainAdaptive,
+        Scene_TerrainFixed,
+
+        Scene_Count
+    };
 }
 
 class CExample05 final : public CApplication
@@ -51,6 +125,8 @@ class CExample05 final : public CApplication
     static constexpr uint32_t FramebufferWidth = 1280;
     static constexpr uint32_t FramebufferHeight = 720;
     static constexpr unsigned StaticCmdSize = 0x10000;
+    static constexpr unsigned DynamicCmdSize = 0x10000;
+    static constexpr unsigned TerrainCmdSize = 0x1000;
 
     dk::UniqueDevice device;
     dk::UniqueQueue queue;
@@ -60,23 +136,56 @@ class CExample05 final : public CApplication
     std::optional<CMemPool> pool_data;
 
     dk::UniqueCmdBuf cmdbuf;
+    dk::UniqueCmdBuf dyncmd;
+    CCmdMemRing<NumFramebuffers> dynmem;
+
+    // The shaders are loaded as a single library, one module per file in this order
+    enum
+    {
+        Shader_Vertex,
+        Shader_TessCtrl,
+        Shader_TessEval,
+        Shader_Fragment,
+        Shader_TerrainVertex,
+        Shader_TerrainCtrl,
+        Shader_TerrainEval,
+    };
 
-    CShader vertexShader;
-    CShader tessCtrlShader;
-    CShader tessEvalShader;
-    CShader fragmentShader;
+    CShaderLibrary shaders;
 
     CMemPool::Handle vertexBuffer;
+    CMemPool::Handle terrainVertexBuffer;
 
+    TerrainParams terrainState;
+    CMemPool::Handle terrainUniformBuffer;
+
+    // One set of statistics per slice of the dynamic command memory ring, which is only reused
+    // (and read back) once the GPU is done with the frame that wrote it
+    CMemPool::Handle statsBuffer;
+    unsigned statsSlot;
+    u64 frameNs;
+
+    Scene scene;
+    float targetEdgePixels;
+    u64 statsFrames, statsPatches, statsCulled, statsTriangles;
+    u64 lastReportNs;
+
+    CMemPool::Handle depthBuffer_mem;
     CMemPool::Handle framebuffers_mem[NumFramebuffers];
+
+    dk::Image depthBuffer;
     dk::Image framebuffers[NumFramebuffers];
     DkCmdList framebuffer_cmdlists[NumFramebuffers];
     dk::UniqueSwapchain swapchain;
 
     DkCmdList render_cmdlist;
 
+    // Declared after the pools, so that the command memory of the passes is freed first
+    CCmdListCache<NumFramebuffers> terrainPasses;
+
 public:
-    CExample05()
+    CExample05() : statsSlot{}, frameNs{}, scene{Scene_Triangle}, targetEdgePixels{12.0f},
+        statsFrames{}, statsPatches{}, statsCulled{}, statsTriangles{}, lastReportNs{}
     {
         // Create the deko3d device
         device = dk::DeviceMaker{}.create();
@@ -94,16 +203,57 @@ public:
         CMemPool::Handle cmdmem = pool_data->allocate(StaticCmdSize);
         cmdbuf.addMemory(cmdmem.getMemBlock(), cmdmem.getOffset(), cmdmem.getSize());
 
-        // Load the shaders
-        vertexShader.load(*pool_code, "romfs:/shaders/basic_vsh.dksh");
-        tessCtrlShader.load(*pool_code, "romfs:/shaders/tess_simple_tcsh.dksh");
-        tessEvalShader.load(*pool_code, "romfs:/shaders/tess_simple_tesh.dksh");
-        fragmentShader.load(*pool_code, "romfs:/shaders/color_fsh.dksh");
+        // Create the dynamic command buffer and allocate memory for it
+        dyncmd = dk::CmdBufMaker{device}.create();
+        dynmem.allocate(*pool_data, DynamicCmdSize);
+
+        // Load the shaders, all of them into a single code allocation
+        shaders.load(*pool_code, {
+            "romfs:/shaders/basic_vsh.dksh",
+            "romfs:/shaders/tess_simple_tcsh.dksh",
+            "romfs:/shaders/tess_simple_tesh.dksh",
+            "romfs:/shaders/color_fsh.dksh",
+            "romfs:/shaders/terrain_vsh.dksh",
+            "romfs:/shaders/tess_terrain_tcsh.dksh",
+            "romfs:/shaders/tess_terrain_tesh.dksh",
+        });
 
         // Load the vertex buffer
         vertexBuffer = pool_data->allocate(sizeof(TriangleVertexData), alignof(Vertex));
         memcpy(vertexBuffer.getCpuAddr(), TriangleVertexData.data(), vertexBuffer.getSize());
 
+        // Generate the terrain patches, four corners each (the heights are filled in by the shaders)
+        terrainVertexBuffer = pool_data->allocate(NumPatches*4*sizeof(TerrainVertex), alignof(TerrainVertex));
+        TerrainVertex* patch = (TerrainVertex*)terrainVertexBuffer.getCpuAddr();
+        float origin = -0.5f * PatchesPerSide * PatchSize;
+        for (unsigned z = 0; z < PatchesPerSide; z ++)
+        {
+            for (unsigned x = 0; x < PatchesPerSide; x ++, patch += 4)
+            {
+                float x0 = origin + x*PatchSize, x1 = x0 + PatchSize;
+                float z0 = origin + z*PatchSize, z1 = z0 + PatchSize;
+                patch[0] = TerrainVertex{ { x0, 0.0f, z0 } };
+                patch[1] = TerrainVertex{ { x1, 0.0f, z0 } };
+                patch[2] = TerrainVertex{ { x1, 0.0f, z1 } };
+                patch[3] = TerrainVertex{ { x0, 0.0f, z1 } };
+            }
+        }
+
+        // Create the uniform and statistics buffers
+        terrainUniformBuffer = pool_data->allocate(sizeof(terrainState), DK_UNIFORM_BUF_ALIGNMENT);
+        statsBuffer = pool_data->allocate(NumFramebuffers*sizeof(TessStats), DK_UNIFORM_BUF_ALIGNMENT);
+        memset(statsBuffer.getCpuAddr(), 0, statsBuffer.getSize());
+
+        terrainState.projMtx = glm::perspectiveRH_ZO(
+            glm::radians(50.0f),
+            float(FramebufferWidth)/float(FramebufferHeight),
+            0.5f, 1000.0f);
+
+        // The terrain frame: per frame commands, followed by the cached state and draw
+        terrainPasses.addDynamic([](void* self, dk::CmdBuf cmd) { static_cast<CExample05*>(self)->recordTerrainFrame(cmd); }, this);
+        terrainPasses.addStatic(device, *pool_data, TerrainCmdSize,
+            [](void* self, dk::CmdBuf cmd) { static_cast<CExample05*>(self)->recordTerrainCommands(cmd); }, this);
+
         // Create the framebuffer resources
         createFramebufferResources();
     }
@@ -113,12 +263,28 @@ public:
         // Destroy the framebuffer resources
         destroyFramebufferResources();
 
-        // Destroy the vertex buffer (not strictly needed in this case)
+        // Destroy the cached passes and the buffers (not strictly needed in this case)
+        terrainPasses.clear();
+        statsBuffer.destroy();
+        terrainUniformBuffer.destroy();
+        terrainVertexBuffer.destroy();
         vertexBuffer.destroy();
     }
 
     void createFramebufferResources()
     {
+        // Create layout for the depth buffer
+        dk::ImageLayout layout_depthbuffer;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageRender | DkImageFlags_HwCompression)
+            .setFormat(DkImageFormat_Z24S8)
+            .setDimensions(FramebufferWidth, FramebufferHeight)
+            .initialize(layout_depthbuffer);
+
+        // Create the depth buffer
+        depthBuffer_mem = pool_images->allocate(layout_depthbuffer.getSize(), layout_depthbuffer.getAlignment());
+        depthBuffer.initialize(layout_depthbuffer, depthBuffer_mem.getMemBlock(), depthBuffer_mem.getOffset());
+
         // Create layout for the framebuffers
         dk::ImageLayout layout_framebuffer;
         dk::ImageLayoutMaker{device}
@@ -138,8 +304,8 @@ public:
             framebuffers[i].initialize(layout_framebuffer, framebuffers_mem[i].getMemBlock(), framebuffers_mem[i].getOffset());
 
             // Generate a command list that binds it
-            dk::ImageView colorTarget{ framebuffers[i] };
-            cmdbuf.bindRenderTargets(&colorTarget);
+            dk::ImageView colorTarget{ framebuffers[i] }, depthTarget{ depthBuffer };
+            cmdbuf.bindRenderTargets(&colorTarget, &depthTarget);
             framebuffer_cmdlists[i] = cmdbuf.finishList();
 
             // Fill in the array for use later by the swapchain creation code
@@ -170,6 +336,9 @@ public:
         // Destroy the framebuffers
         for (unsigned i = 0; i < NumFramebuffers; i ++)
             framebuffers_mem[i].destroy();
+
+        // Destroy the depth buffer
+        depthBuffer_mem.destroy();
     }
 
     void recordStaticCommands()
@@ -179,6 +348,7 @@ public:
         dk::ColorState colorState;
         dk::ColorWriteState colorWriteState;
         dk::BlendState blendState;
+        dk::DepthStencilState depthStencilState;
 
         // Configure rasterizer state: draw polygons as lines, and enable polygon smoothing
         rasterizerState.setPolygonMode(DkPolygonMode_Line);
@@ -187,6 +357,10 @@ public:
         // Configure color state: enable blending (needed for polygon smoothing since it generates alpha values)
         colorState.setBlendEnable(0, true);
 
+        // The triangle is flat, so it doesn't need depth testing
+        depthStencilState.setDepthTestEnable(false);
+        depthStencilState.setDepthWriteEnable(false);
+
         // Configure viewport and scissor
         cmdbuf.setViewports(0, { { 0.0f, 0.0f, FramebufferWidth, FramebufferHeight, 0.0f, 1.0f } });
         cmdbuf.setScissors(0, { { 0, 0, FramebufferWidth, FramebufferHeight } });
@@ -195,11 +369,13 @@ public:
         cmdbuf.clearColor(0, DkColorMask_RGBA, 0.0f, 0.0f, 0.0f, 0.0f);
 
         // Bind state required for drawing the triangle
-        cmdbuf.bindShaders(DkStageFlag_GraphicsMask, { vertexShader, tessCtrlShader, tessEvalShader, fragmentShader });
+        cmdbuf.bindShaders(DkStageFlag_GraphicsMask, {
+            shaders.get(Shader_Vertex), shaders.get(Shader_TessCtrl), shaders.get(Shader_TessEval), shaders.get(Shader_Fragment) });
         cmdbuf.bindRasterizerState(rasterizerState);
         cmdbuf.bindColorState(colorState);
         cmdbuf.bindColorWriteState(colorWriteState);
         cmdbuf.bindBlendStates(0, blendState);
+        cmdbuf.bindDepthStencilState(depthStencilState);
         cmdbuf.bindVtxBuffer(0, vertexBuffer.getGpuAddr(), vertexBuffer.getSize());
         cmdbuf.bindVtxAttribState(VertexAttribState);
         cmdbuf.bindVtxBufferState(VertexBufferState);
@@ -208,7 +384,7 @@ public:
 
         // Note that the tessellation control shader is optional. If no such shader is bound,
         // the following commands can be used to control tessellation:
-        // (try it out! remove the "tessCtrlShader" from the bindShaders call and uncomment these)
+        // (try it out! remove the Shader_TessCtrl shader from the bindShaders call and uncomment these)
         //cmdbuf.setTessInnerLevels(5.0f);
         //cmdbuf.setTessOuterLevels(7.0f, 3.0f, 5.0f);
 
@@ -219,19 +395,135 @@ public:
         render_cmdlist = cmdbuf.finishList();
     }
 
-    void render()
+    void recordTerrainFrame(dk::CmdBuf cmd)
     {
-        // Acquire a framebuffer from the swapchain (and wait for it to be available)
-        int slot = queue.acquireImage(swapchain);
+        // The ring slice this frame records into was just waited for, and with it the frame that
+        // wrote the statistics in the matching slot
+        TessStats* stats = (TessStats*)statsBuffer.getCpuAddr() + statsSlot;
+        readStats(*stats, frameNs);
+
+        // Reset the statistics the control shader is about to gather
+        static const TessStats zeroStats = {};
+        DkGpuAddr statsAddr = statsBuffer.getGpuAddr() + statsSlot*sizeof(TessStats);
+        cmd.pushData(statsAddr, &zeroStats, sizeof(zeroStats));
+
+        // Update the uniform buffer with this frame's parameters
+        cmd.pushConstants(
+            terrainUniformBuffer.getGpuAddr(), terrainUniformBuffer.getSize(),
+            0, sizeof(terrainState), &terrainState);
+
+        // The slot changes every frame, so it is bound here rather than in the static pass
+        cmd.bindStorageBuffer(DkStage_TessCtrl, 0, statsAddr, sizeof(TessStats));
+    }
 
-        // Run the command list that attaches said framebuffer to the queue
-        queue.submitCommands(framebuffer_cmdlists[slot]);
+    void recordTerrainCommands(dk::CmdBuf cmd)
+    {
+        // Initialize state structs with deko3d defaults
+        dk::RasterizerState rasterizerState;
+        dk::ColorState colorState;
+        dk::ColorWriteState colorWriteState;
+        dk::BlendState blendState;
+        dk::DepthStencilState depthStencilState;
+
+        // Same wireframe look as the triangle, so that the subdivision can be seen. The patches
+        // are seen from both sides.
+        rasterizerState.setPolygonMode(DkPolygonMode_Line);
+        rasterizerState.setPolygonSmoothEnable(true);
+        rasterizerState.setCullMode(DkFace_None);
+        colorState.setBlendEnable(0, true);
 
-        // Run the main rendering command list
-        queue.submitCommands(render_cmdlist);
+        cmd.setViewports(0, { { 0.0f, 0.0f, FramebufferWidth, FramebufferHeight, 0.0f, 1.0f } });
+        cmd.setScissors(0, { { 0, 0, FramebufferWidth, FramebufferHeight } });
+        cmd.clearColor(0, DkColorMask_RGBA, 0.45f, 0.60f, 0.80f, 1.0f);
+        cmd.clearDepthStencil(true, 1.0f, 0xFF, 0);
+
+        cmd.bindShaders(DkStageFlag_GraphicsMask, {
+            shaders.get(Shader_TerrainVertex), shaders.get(Shader_TerrainCtrl), shaders.get(Shader_TerrainEval), shaders.get(Shader_Fragment) });
+        cmd.bindUniformBuffer(DkStage_TessCtrl, 0, terrainUniformBuffer.getGpuAddr(), terrainUniformBuffer.getSize());
+        cmd.bindUniformBuffer(DkStage_TessEval, 0, terrainUniformBuffer.getGpuAddr(), terrainUniformBuffer.getSize());
+        cmd.bindRasterizerState(rasterizerState);
+        cmd.bindColorState(colorState);
+        cmd.bindColorWriteState(colorWriteState);
+        cmd.bindBlendStates(0, blendState);
+        cmd.bindDepthStencilState(depthStencilState);
+        cmd.bindVtxBuffer(0, terrainVertexBuffer.getGpuAddr(), terrainVertexBuffer.getSize());
+        cmd.bindVtxAttribState(TerrainVertexAttribState);
+        cmd.bindVtxBufferState(TerrainVertexBufferState);
+        cmd.setLineWidth(1.5f);
+        cmd.setPatchSize(4);
+
+        // Draw all the patches: the ones out of view are discarded by the control shader
+        cmd.draw(DkPrimitive_Patches, NumPatches*4, 1, 0, 0);
+
+        // Fragment barrier, to make sure we finish previous work before discarding the depth buffer
+        cmd.barrier(DkBarrier_Fragments, 0);
+        cmd.discardDepthStencil();
+    }
+
+    void readStats(TessStats const& stats, u64 ns)
+    {
+        // Slots not written yet since the scene was selected are skipped
+        if (stats.visiblePatches || stats.culledPatches)
+            statsFrames ++;
+        statsPatches += stats.visiblePatches;
+        statsCulled += stats.culledPatches;
+        statsTriangles += stats.triangles;
 
-        // Now that we are done rendering, present it to the screen
+        if (ns - lastReportNs < 1000000000UL)
+            return;
+
+        if (statsFrames)
+        {
+            auto const& cacheStats = terrainPasses.getStats();
+            printf("[tess] %s: %lu/%u patches drawn (%lu culled), ~%lu triangles per frame, target %.0f px per edge\n",
+                scene == Scene_TerrainAdaptive ? "adaptive" : "fixed",
+                statsPatches / statsFrames, NumPatches, statsCulled / statsFrames, statsTriangles / statsFrames,
+                targetEdgePixels);
+            printf("[tess] static pass: %u recorded, %u replayed; %lu ns recording per frame\n",
+                cacheStats.staticRecords, cacheStats.staticReplays, cacheStats.recordNs);
+        }
+
+        statsFrames = statsPatches = statsCulled = statsTriangles = 0;
+        lastReportNs = ns;
+    }
+
+    void render(u64 ns)
+    {
+        if (scene == Scene_Triangle)
+        {
+            // Acquire a framebuffer from the swapchain (and wait for it to be available)
+            int slot = queue.acquireImage(swapchain);
+
+            // Run the command list that attaches said framebuffer to the queue
+            queue.submitCommands(framebuffer_cmdlists[slot]);
+
+            // Run the main rendering command list
+            queue.submitCommands(render_cmdlist);
+
+            // Now that we are done rendering, present it to the screen
+            queue.presentImage(swapchain, slot);
+            return;
+        }
+
+        // The cache waits for the ring slice before running the dynamic pass (which reads back the
+        // statistics), and signals its fence after the static pass, so that it covers the draw
+        // and with it the writes to the statistics
+        frameNs = ns;
+        int slot = queue.acquireImage(swapchain);
+        queue.submitCommands(framebuffer_cmdlists[slot]);
+        terrainPasses.submit(queue, dyncmd, dynmem);
         queue.presentImage(swapchain, slot);
+
+        statsSlot = (statsSlot + 1) % NumFramebuffers;
+    }
+
+    void selectScene(Scene newScene)
+    {
+        // Drop the statistics gathered with the previous settings
+        queue.waitIdle();
+        memset(statsBuffer.getCpuAddr(), 0, statsBuffer.getSize());
+        statsFrames = statsPatches = statsCulled = statsTriangles = 0;
+        scene = newScene;
     }
 
     bool onFrame(u64 ns) override
@@ -240,8 +532,23 @@ public:
         u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
         if (kDown & KEY_PLUS)
             return false;
-
-        render();
+        if (kDown & KEY_A)
+            selectScene(Scene((scene + 1) % Scene_Count));
+        if ((kDown & KEY_UP) && targetEdgePixels < 64.0f)
+            targetEdgePixels *= 2.0f;
+        if ((kDown & KEY_DOWN) && targetEdgePixels > 4.0f)
+            targetEdgePixels *= 0.5f;
+
+        // Circle over the terrain, looking ahead and slightly down
+        float time = ns / 1000000000.0; // double precision division; followed by implicit cast to single precision
+        float angle = time * 0.15f;
+        glm::vec3 eye{ 140.0f * cosf(angle), TerrainHeight + 20.0f, 140.0f * sinf(angle) };
+        glm::vec3 ahead{ -sinf(angle), -0.35f, cosf(angle) };
+        terrainState.mdlvMtx = glm::lookAtRH(eye, eye + ahead, glm::vec3{0.0f, 1.0f, 0.0f});
+        terrainState.lodParams = glm::vec4{ FramebufferWidth, FramebufferHeight, targetEdgePixels, MaxTessLevel };
+        terrainState.terrainParams = glm::vec4{ TerrainHeight, scene == Scene_TerrainFixed ? FixedTessLevel : 0.0f, 0.0f, 0.0f };
+
+        render(ns);
         return true;
     }
 };
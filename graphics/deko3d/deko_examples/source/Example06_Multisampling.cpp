@@ -7,13 +7,20 @@
 ** - Configuring multisample state
 ** - Performing a resolve step
 ** - Discarding color/depth buffers that are not used for presentation
+** - Benchmarking render target settings: press A to sweep through every combination of
+**   MSAA level, hardware compression and tiled cache, printing the GPU time of each (visible through nxlink)
+** - Following the render profile of CApplication: the MSAA level, render resolution and number of
+**   frames in flight change with the operation and performance modes, and a change only recreates
+**   the resources it affects (the MSAA level alone does not touch the swapchain)
 */
 
 // Sample Framework headers
 #include "SampleFramework/CApplication.h"
 #include "SampleFramework/CMemPool.h"
 #include "SampleFramework/CShader.h"
-#include "SampleFramework/CCmdMemRing.h"
+#include "SampleFramework/CFramePipeline.h"
+#include "SampleFramework/CGpuProfiler.h"
+#include "SampleFramework/CBenchmarkSweep.h"
 
 // C++ standard library headers
 #include <array>
@@ -91,6 +98,22 @@ namespace
         glm::mat4 projMtx;
     };
 
+    // Render target settings, varied by the benchmark sweep
+    struct RenderConfig
+    {
+        DkMsMode msMode;
+        bool compression;
+        bool tiledCache;
+    };
+
+    constexpr std::array MsModes = { DkMsMode_1x, DkMsMode_2x, DkMsMode_4x, DkMsMode_8x };
+    constexpr unsigned NumBenchConfigs = MsModes.size()*2*2;
+
+    RenderConfig GetBenchConfig(unsigned id)
+    {
+        return RenderConfig{ MsModes[id % MsModes.size()], !((id / MsModes.size()) & 1), !((id / MsModes.size()) & 2) };
+    }
+
     inline float fractf(float x)
     {
         return x - floorf(x);
@@ -102,7 +125,8 @@ class CExample06 final : public CApplication
     static constexpr unsigned NumFramebuffers = 2;
     static constexpr unsigned StaticCmdSize = 0x10000;
     static constexpr unsigned DynamicCmdSize = 0x10000;
-    static constexpr DkMsMode MultisampleMode = DkMsMode_4x;
+    static constexpr unsigned MaxFramesInFlight = 3;
+    static constexpr unsigned ProfilerFrames = MaxFramesInFlight;
 
     dk::UniqueDevice device;
     dk::UniqueQueue queue;
@@ -113,7 +137,14 @@ class CExample06 final : public CApplication
 
     dk::UniqueCmdBuf cmdbuf;
     dk::UniqueCmdBuf dyncmd;
-    CCmdMemRing<NumFramebuffers> dynmem;
+    CFramePipeline<MaxFramesInFlight> pipeline;
+
+    CGpuProfiler<ProfilerFrames> profiler;
+    unsigned profFrame;
+
+    CBenchmarkSweep bench;
+    RenderConfig config;
+    RenderConfig defaultConfig; // The MSAA level comes from the render profile
 
     CShader vertexShader;
     CShader fragmentShader;
@@ -139,7 +170,7 @@ class CExample06 final : public CApplication
     DkCmdList render_cmdlist, discard_cmdlist;
 
 public:
-    CExample06()
+    CExample06() : config{DkMsMode_4x, true, false}, defaultConfig{config}, framebufferWidth{}, framebufferHeight{}
     {
         // Create the deko3d device
         device = dk::DeviceMaker{}.create();
@@ -159,7 +190,17 @@ public:
 
         // Create the dynamic command buffer and allocate memory for it
         dyncmd = dk::CmdBufMaker{device}.create();
-        dynmem.allocate(*pool_data, DynamicCmdSize);
+        pipeline.allocate(*pool_data, DynamicCmdSize);
+
+        // Create the GPU profiler, used to measure the time taken by each configuration of the benchmark
+        profiler.allocate(*pool_data);
+        profFrame = profiler.registerPass("Frame");
+
+        // Configure the tile size used by the tiled cache (when enabled)
+        cmdbuf.setTileSize(64, 64);
+        queue.submitCommands(cmdbuf.finishList());
+        queue.waitIdle();
+        cmdbuf.clear();
 
         // Load the shaders
         vertexShader.load(*pool_code, "romfs:/shaders/transform_vsh.dksh");
@@ -187,34 +228,6 @@ public:
 
     void createFramebufferResources()
     {
-        // Create layout for the (multisampled) color buffer
-        dk::ImageLayout layout_colorbuffer;
-        dk::ImageLayoutMaker{device}
-            .setType(DkImageType_2DMS)
-            .setFlags(DkImageFlags_UsageRender | DkImageFlags_Usage2DEngine | DkImageFlags_HwCompression)
-            .setFormat(DkImageFormat_RGBA8_Unorm)
-            .setMsMode(MultisampleMode)
-            .setDimensions(framebufferWidth, framebufferHeight)
-            .initialize(layout_colorbuffer);
-
-        // Create layout for the (also multisampled) depth buffer
-        dk::ImageLayout layout_depthbuffer;
-        dk::ImageLayoutMaker{device}
-            .setType(DkImageType_2DMS)
-            .setFlags(DkImageFlags_UsageRender | DkImageFlags_HwCompression)
-            .setFormat(DkImageFormat_Z24S8)
-            .setMsMode(MultisampleMode)
-            .setDimensions(framebufferWidth, framebufferHeight)
-            .initialize(layout_depthbuffer);
-
-        // Create the color buffer
-        colorBuffer_mem = pool_images->allocate(layout_colorbuffer.getSize(), layout_colorbuffer.getAlignment());
-        colorBuffer.initialize(layout_colorbuffer, colorBuffer_mem.getMemBlock(), colorBuffer_mem.getOffset());
-
-        // Create the depth buffer
-        depthBuffer_mem = pool_images->allocate(layout_depthbuffer.getSize(), layout_depthbuffer.getAlignment());
-        depthBuffer.initialize(layout_depthbuffer, depthBuffer_mem.getMemBlock(), depthBuffer_mem.getOffset());
-
         // Create layout for the framebuffers
         dk::ImageLayout layout_framebuffer;
         dk::ImageLayoutMaker{device}
@@ -233,11 +246,6 @@ public:
             framebuffers_mem[i] = pool_images->allocate(fb_size, fb_align);
             framebuffers[i].initialize(layout_framebuffer, framebuffers_mem[i].getMemBlock(), framebuffers_mem[i].getOffset());
 
-            // Generate a command list that resolves the color buffer into the framebuffer
-            dk::ImageView colorView { colorBuffer }, framebufferView { framebuffers[i] };
-            cmdbuf.resolveImage(colorView, framebufferView);
-            framebuffer_cmdlists[i] = cmdbuf.finishList();
-
             // Fill in the array for use later by the swapchain creation code
             fb_array[i] = &framebuffers[i];
         }
@@ -245,8 +253,8 @@ public:
         // Create the swapchain using the framebuffers
         swapchain = dk::SwapchainMaker{device, nwindowGetDefault(), fb_array}.create();
 
-        // Generate the main command lists
-        recordStaticCommands();
+        // Create the render targets that get resolved into the framebuffers
+        createRenderTargets();
 
         // Initialize the projection matrix
         transformState.projMtx = glm::perspectiveRH_ZO(
@@ -260,11 +268,8 @@ public:
         // Return early if we have nothing to destroy
         if (!swapchain) return;
 
-        // Make sure the queue is idle before destroying anything
-        queue.waitIdle();
-
-        // Clear the static cmdbuf, destroying the static cmdlists in the process
-        cmdbuf.clear();
+        // Destroy the render targets first, which also makes sure the queue is idle
+        destroyRenderTargets();
 
         // Destroy the swapchain
         swapchain.destroy();
@@ -272,6 +277,67 @@ public:
         // Destroy the framebuffers
         for (unsigned i = 0; i < NumFramebuffers; i ++)
             framebuffers_mem[i].destroy();
+    }
+
+    void createRenderTargets()
+    {
+        // Single sampled render targets are plain 2D images, and get copied instead of resolved
+        bool multisampled = config.msMode != DkMsMode_1x;
+        uint32_t compressionFlag = config.compression ? DkImageFlags_HwCompression : 0;
+
+        // Create layout for the (multisampled) color buffer
+        dk::ImageLayout layout_colorbuffer;
+        dk::ImageLayoutMaker{device}
+            .setType(multisampled ? DkImageType_2DMS : DkImageType_2D)
+            .setFlags(DkImageFlags_UsageRender | DkImageFlags_Usage2DEngine | compressionFlag)
+            .setFormat(DkImageFormat_RGBA8_Unorm)
+            .setMsMode(config.msMode)
+            .setDimensions(framebufferWidth, framebufferHeight)
+            .initialize(layout_colorbuffer);
+
+        // Create layout for the (also multisampled) depth buffer
+        dk::ImageLayout layout_depthbuffer;
+        dk::ImageLayoutMaker{device}
+            .setType(multisampled ? DkImageType_2DMS : DkImageType_2D)
+            .setFlags(DkImageFlags_UsageRender | compressionFlag)
+            .setFormat(DkImageFormat_Z24S8)
+            .setMsMode(config.msMode)
+            .setDimensions(framebufferWidth, framebufferHeight)
+            .initialize(layout_depthbuffer);
+
+        // Create the color buffer
+        colorBuffer_mem = pool_images->allocate(layout_colorbuffer.getSize(), layout_colorbuffer.getAlignment());
+        colorBuffer.initialize(layout_colorbuffer, colorBuffer_mem.getMemBlock(), colorBuffer_mem.getOffset());
+
+        // Create the depth buffer
+        depthBuffer_mem = pool_images->allocate(layout_depthbuffer.getSize(), layout_depthbuffer.getAlignment());
+        depthBuffer.initialize(layout_depthbuffer, depthBuffer_mem.getMemBlock(), depthBuffer_mem.getOffset());
+
+        for (unsigned i = 0; i < NumFramebuffers; i ++)
+        {
+            // Generate a command list that resolves the color buffer into the framebuffer
+            dk::ImageView colorView { colorBuffer }, framebufferView { framebuffers[i] };
+            if (multisampled)
+                cmdbuf.resolveImage(colorView, framebufferView);
+            else
+            {
+                DkImageRect rect = { 0, 0, 0, framebufferWidth, framebufferHeight, 1 };
+                cmdbuf.copyImage(colorView, rect, framebufferView, rect);
+            }
+            framebuffer_cmdlists[i] = cmdbuf.finishList();
+        }
+
+        // Generate the main command lists
+        recordStaticCommands();
+    }
+
+    void destroyRenderTargets()
+    {
+        // Make sure the queue is idle before destroying anything
+        queue.waitIdle();
+
+        // Clear the static cmdbuf, destroying the static cmdlists in the process
+        cmdbuf.clear();
 
         // Destroy the depth buffer
         depthBuffer_mem.destroy();
@@ -290,9 +356,12 @@ public:
         dk::DepthStencilState depthStencilState;
 
         // Configure multisample state
-        multisampleState.setMode(MultisampleMode);
+        multisampleState.setMode(config.msMode);
         multisampleState.setLocations();
 
+        // Enable or disable the tiled cache
+        cmdbuf.tiledCacheOp(config.tiledCache ? DkTiledCacheOp_Enable : DkTiledCacheOp_Disable);
+
         // Bind color buffer and depth buffer
         dk::ImageView colorTarget { colorBuffer }, depthTarget { depthBuffer };
         cmdbuf.bindRenderTargets(&colorTarget, &depthTarget);
@@ -335,15 +404,19 @@ public:
     void render()
     {
         // Begin generating the dynamic command list, for commands that need to be sent only this frame specifically
-        dynmem.begin(dyncmd);
+        pipeline.begin(dyncmd);
+
+        // Collect the GPU timings of the last frame that used this profiler slot
+        profiler.beginFrame();
 
         // Update the uniform buffer with the new transformation state (this data gets inlined in the command list)
         dyncmd.pushConstants(
             transformUniformBuffer.getGpuAddr(), transformUniformBuffer.getSize(),
             0, sizeof(transformState), &transformState);
 
-        // Finish off the dynamic command list (which also submits it to the queue)
-        queue.submitCommands(dynmem.end(dyncmd));
+        // Submit the dynamic commands so far, ending with the timestamp marking the start of the frame
+        profiler.begin(dyncmd, profFrame);
+        queue.submitCommands(dyncmd.finishList());
 
         // Run the main rendering command list
         queue.submitCommands(render_cmdlist);
@@ -357,20 +430,63 @@ public:
         // Submit the command list used for discarding the color and depth buffers
         queue.submitCommands(discard_cmdlist);
 
+        // Timestamp the end of the frame, then finish off the dynamic command list
+        profiler.end(dyncmd, profFrame);
+        profiler.endFrame(dyncmd);
+        queue.submitCommands(pipeline.end(dyncmd));
+
         // Now that we are done rendering, present it to the screen (this also flushes the queue)
         queue.presentImage(swapchain, slot);
     }
 
-    void onOperationMode(AppletOperationMode mode) override
+    void applyConfig(RenderConfig const& newConfig)
     {
-        // Destroy the framebuffer resources
-        destroyFramebufferResources();
+        // Recreate the render targets and the static command lists with the new settings (the
+        // framebuffers and the swapchain do not depend on them)
+        destroyRenderTargets();
+        config = newConfig;
+        createRenderTargets();
+
+        if (bench.isActive())
+        {
+            static const char* const msNames[] = { "1x", "2x", "4x", "8x" };
+            char name[CBenchmarkSweep::MaxNameLength];
+            snprintf(name, sizeof(name), "MSAA %s, compression %s, tiled cache %s", msNames[config.msMode],
+                config.compression ? "on" : "off", config.tiledCache ? "on" : "off");
+
+            // Estimated traffic (ignoring compression and caching): color and depth written at every
+            // sample, then the color samples read back by the resolve which writes the framebuffer
+            u64 pixels = u64(framebufferWidth)*framebufferHeight;
+            u64 samples = pixels << config.msMode;
+            bench.describe(name, samples*(4+4) + samples*4 + pixels*4);
+        }
+    }
+
+    void onRenderProfile(CRenderProfile const& profile, unsigned changes) override
+    {
+        printf("Render profile: %s, %ux%u, MSAA %ux, %u frames in flight\n", profile.name,
+            profile.getRenderWidth(), profile.getRenderHeight(), 1U << profile.msMode, profile.framesInFlight);
 
-        // Choose framebuffer size
-        chooseFramebufferSize(framebufferWidth, framebufferHeight, mode);
+        // Only the per-frame rings are affected, and the pipeline drains itself first
+        if (changes & CRenderProfile::Change_FramesInFlight)
+            pipeline.setFramesInFlight(profile.framesInFlight);
 
-        // Recreate the framebuffers and its associated resources
-        createFramebufferResources();
+        // The sweep sets the MSAA level itself, so it is only applied once the sweep is over
+        defaultConfig.msMode = profile.msMode;
+
+        if (changes & CRenderProfile::Change_Resolution)
+        {
+            // Results would not be comparable across resolutions, so abort any sweep in progress
+            destroyFramebufferResources();
+            if (bench.isActive())
+                bench.stop();
+            config = defaultConfig;
+            framebufferWidth = profile.getRenderWidth();
+            framebufferHeight = profile.getRenderHeight();
+            createFramebufferResources();
+        }
+        else if ((changes & CRenderProfile::Change_Msaa) && !bench.isActive())
+            applyConfig(defaultConfig);
     }
 
     bool onFrame(u64 ns) override
@@ -380,6 +496,16 @@ public:
         if (kDown & KEY_PLUS)
             return false;
 
+        // Start the benchmark sweep, or advance it according to the GPU time of the latest frame
+        if ((kDown & KEY_A) && !bench.isActive())
+        {
+            printf("[bench] Running %u configurations at %ux%u...\n", NumBenchConfigs, framebufferWidth, framebufferHeight);
+            bench.start(NumBenchConfigs);
+            applyConfig(GetBenchConfig(0));
+        }
+        else if (bench.update(profiler.getLastNs(profFrame)))
+            applyConfig(bench.isActive() ? GetBenchConfig(bench.getConfig()) : defaultConfig);
+
         float time = ns / 1000000000.0; // double precision division; followed by implicit cast to single precision
         float tau = glm::two_pi<float>();
 
@@ -2,11 +2,17 @@
 ** deko3d Example 07: Mesh Loading and Lighting (sRGB)
 ** This example shows how to load a mesh, and render it using per-fragment lighting.
 ** New concepts in this example:
-** - Loading geometry data (mesh) from the filesystem
+** - Loading geometry data (mesh) from the filesystem, packed with quantized attributes (see tools/mkdkmesh.py)
 ** - Configuring and using index buffers
 ** - Using sRGB framebuffers
 ** - Using multiple uniform buffers on different stages
+** - Sub-allocating per-draw uniform blocks from a ring that follows the frames in flight
 ** - Basic Blinn-Phong lighting with Reinhard tone mapping
+** - Recording draws on several cores at once (CParallelRecorder), each worker with its own uniform ring
+**
+** Press A to switch between a single teapot and a grid of teapots, whose draws are split across three
+** worker threads. Each worker records its share into its own command list, and the lists are submitted
+** in order after the main rendering command list, whose bound state they inherit.
 */
 
 // Sample Framework headers
@@ -14,7 +20,9 @@
 #include "SampleFramework/CMemPool.h"
 #include "SampleFramework/CShader.h"
 #include "SampleFramework/CCmdMemRing.h"
-#include "SampleFramework/FileLoader.h"
+#include "SampleFramework/CUniformRing.h"
+#include "SampleFramework/CParallelRecorder.h"
+#include "SampleFramework/CMesh.h"
 
 // C++ standard library headers
 #include <array>
@@ -30,23 +38,6 @@
 
 namespace
 {
-    struct Vertex
-    {
-        float position[3];
-        float normal[3];
-    };
-
-    constexpr std::array VertexAttribState =
-    {
-        DkVtxAttribState{ 0, 0, offsetof(Vertex, position), DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
-        DkVtxAttribState{ 0, 0, offsetof(Vertex, normal),   DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
-    };
-
-    constexpr std::array VertexBufferState =
-    {
-        DkVtxBufferState{ sizeof(Vertex), 0 },
-    };
-
     struct Transformation
     {
         glm::mat4 mdlvMtx;
@@ -72,6 +63,12 @@ class CExample07 final : public CApplication
     static constexpr unsigned NumFramebuffers = 2;
     static constexpr unsigned StaticCmdSize = 0x10000;
     static constexpr unsigned DynamicCmdSize = 0x10000;
+    static constexpr unsigned UniformSliceSize = 0x1000;
+    static constexpr unsigned GridSize = 10;
+    static constexpr float GridSpacing = 1.25f;
+    static constexpr unsigned NumWorkers = CParallelRecorder<NumFramebuffers>::MaxWorkers;
+    static constexpr unsigned WorkerCmdSize = 0x4000;
+    static constexpr unsigned WorkerUniformSliceSize = 0x8000; // enough for a third of the grid at 256 bytes per block
     static constexpr DkMsMode MultisampleMode = DkMsMode_4x;
 
     dk::UniqueDevice device;
@@ -84,18 +81,20 @@ class CExample07 final : public CApplication
     dk::UniqueCmdBuf cmdbuf;
     dk::UniqueCmdBuf dyncmd;
     CCmdMemRing<NumFramebuffers> dynmem;
+    CUniformRing<NumFramebuffers> uniforms;
+
+    CParallelRecorder<NumFramebuffers> recorder;
+    CUniformRing<NumFramebuffers> workerUniforms[NumWorkers];
+    bool gridMode;
+    float gridTime;
 
     CShader vertexShader;
     CShader fragmentShader;
 
     Transformation transformState;
-    CMemPool::Handle transformUniformBuffer;
-
     Lighting lightingState;
-    CMemPool::Handle lightingUniformBuffer;
 
-    CMemPool::Handle vertexBuffer;
-    CMemPool::Handle indexBuffer;
+    CMesh mesh;
 
     uint32_t framebufferWidth;
     uint32_t framebufferHeight;
@@ -136,14 +135,18 @@ public:
         dynmem.allocate(*pool_data, DynamicCmdSize);
 
         // Load the shaders
-        vertexShader.load(*pool_code, "romfs:/shaders/transform_normal_vsh.dksh");
+        vertexShader.load(*pool_code, "romfs:/shaders/transform_packed_vsh.dksh");
         fragmentShader.load(*pool_code, "romfs:/shaders/basic_lighting_fsh.dksh");
 
-        // Create the transformation uniform buffer
-        transformUniformBuffer = pool_data->allocate(sizeof(transformState), DK_UNIFORM_BUF_ALIGNMENT);
+        // Allocate the ring the uniform buffers are written into every frame
+        uniforms.allocate(*pool_data, UniformSliceSize);
 
-        // Create the lighting uniform buffer
-        lightingUniformBuffer = pool_data->allocate(sizeof(lightingState), DK_UNIFORM_BUF_ALIGNMENT);
+        // Start the workers used for the grid mode; each one writes its uniform buffers into its own ring
+        recorder.create(device, *pool_data, WorkerCmdSize, NumWorkers);
+        for (unsigned i = 0; i < NumWorkers; i ++)
+            workerUniforms[i].allocate(*pool_data, WorkerUniformSliceSize);
+        gridMode = false;
+        gridTime = 0.0f;
 
         // Initialize the lighting state
         lightingState.lightPos = glm::vec4{0.0f, 4.0f, 1.0f, 1.0f};
@@ -152,23 +155,19 @@ public:
         lightingState.specular = glm::vec4{24.0f*glm::vec3{0.394737f,0.308916f,0.134004f}, 64.0f};
 
         // Load the teapot mesh
-        vertexBuffer = LoadFile(*pool_data, "romfs:/teapot-vtx.bin", alignof(Vertex));
-        indexBuffer = LoadFile(*pool_data, "romfs:/teapot-idx.bin", alignof(u16));
+        mesh.load(*pool_data, "romfs:/teapot.dkmesh");
     }
 
     ~CExample07()
     {
+        // Stop the workers
+        recorder.destroy();
+
         // Destroy the framebuffer resources
         destroyFramebufferResources();
 
-        // Destroy the index buffer (not strictly needed in this case)
-        indexBuffer.destroy();
-
-        // Destroy the vertex buffer (not strictly needed in this case)
-        vertexBuffer.destroy();
-
-        // Destroy the uniform buffer (not strictly needed in this case)
-        transformUniformBuffer.destroy();
+        // Destroy the mesh (not strictly needed in this case)
+        mesh.destroy();
     }
 
     void createFramebufferResources()
@@ -291,22 +290,14 @@ public:
         cmdbuf.clearColor(0, DkColorMask_RGBA, 0.0f, 0.0f, 0.0f, 0.0f);
         cmdbuf.clearDepthStencil(true, 1.0f, 0xFF, 0);
 
-        // Bind state required for drawing the mesh
+        // Bind state required for drawing the mesh (the uniform buffers are bound every frame, along with the draw)
         cmdbuf.bindShaders(DkStageFlag_GraphicsMask, { vertexShader, fragmentShader });
-        cmdbuf.bindUniformBuffer(DkStage_Vertex, 0, transformUniformBuffer.getGpuAddr(), transformUniformBuffer.getSize());
-        cmdbuf.bindUniformBuffer(DkStage_Fragment, 0, lightingUniformBuffer.getGpuAddr(), lightingUniformBuffer.getSize());
         cmdbuf.bindRasterizerState(rasterizerState);
         cmdbuf.bindMultisampleState(multisampleState);
         cmdbuf.bindColorState(colorState);
         cmdbuf.bindColorWriteState(colorWriteState);
         cmdbuf.bindDepthStencilState(depthStencilState);
-        cmdbuf.bindVtxBuffer(0, vertexBuffer.getGpuAddr(), vertexBuffer.getSize());
-        cmdbuf.bindVtxAttribState(VertexAttribState);
-        cmdbuf.bindVtxBufferState(VertexBufferState);
-        cmdbuf.bindIdxBuffer(DkIdxFormat_Uint16, indexBuffer.getGpuAddr());
-
-        // Draw the mesh
-        cmdbuf.drawIndexed(DkPrimitive_Triangles, indexBuffer.getSize() / sizeof(u16), 1, 0, 0, 0);
+        mesh.bind(cmdbuf);
 
         // Finish off this command list
         render_cmdlist = cmdbuf.finishList();
@@ -320,27 +311,72 @@ public:
         discard_cmdlist = cmdbuf.finishList();
     }
 
-    void render()
+    static void recordGridItems(void* userData, dk::CmdBuf cmdbuf, unsigned worker, unsigned first, unsigned count)
     {
-        // Begin generating the dynamic command list, for commands that need to be sent only this frame specifically
-        dynmem.begin(dyncmd);
+        static_cast<CExample07*>(userData)->recordGrid(cmdbuf, worker, first, count);
+    }
 
-        // Update the transformation uniform buffer with the new state (this data gets inlined in the command list)
-        dyncmd.pushConstants(
-            transformUniformBuffer.getGpuAddr(), transformUniformBuffer.getSize(),
-            0, sizeof(transformState), &transformState);
+    // Runs on a worker thread: only the worker's own command buffer and uniform ring are written to
+    void recordGrid(dk::CmdBuf cmdbuf, unsigned worker, unsigned first, unsigned count)
+    {
+        CUniformRing<NumFramebuffers>& ring = workerUniforms[worker];
+        ring.begin(cmdbuf);
+        ring.push(cmdbuf, DkStage_Fragment, 0, lightingState);
 
-        // Update the lighting uniform buffer with the new state
-        dyncmd.pushConstants(
-            lightingUniformBuffer.getGpuAddr(), lightingUniformBuffer.getSize(),
-            0, sizeof(lightingState), &lightingState);
+        Transformation transform;
+        transform.projMtx = transformState.projMtx;
 
-        // Finish off the dynamic command list (which also submits it to the queue)
-        queue.submitCommands(dynmem.end(dyncmd));
+        glm::mat4 viewMtx{1.0f};
+        viewMtx = glm::translate(viewMtx, glm::vec3{0.0f, 0.0f, -16.0f});
+        viewMtx = glm::rotate(viewMtx, glm::radians(35.0f), glm::vec3{1.0f, 0.0f, 0.0f});
 
-        // Run the main rendering command list
+        float tau = glm::two_pi<float>();
+        for (unsigned i = first; i < first + count; i ++)
+        {
+            float x = (float(i % GridSize) - 0.5f*(GridSize-1)) * GridSpacing;
+            float z = (float(i / GridSize) - 0.5f*(GridSize-1)) * GridSpacing;
+
+            // Every teapot spins at the same rate, each one starting from a different angle
+            transform.mdlvMtx = glm::translate(viewMtx, glm::vec3{x, 0.0f, z});
+            transform.mdlvMtx = glm::rotate(transform.mdlvMtx, -fractf(gridTime/8.0f + i*0.137f) * tau, glm::vec3{0.0f, 1.0f, 0.0f});
+            transform.mdlvMtx = glm::translate(transform.mdlvMtx, glm::vec3{0.0f, -0.5f, 0.0f});
+
+            ring.push(cmdbuf, DkStage_Vertex, 0, transform);
+            mesh.draw(cmdbuf);
+        }
+
+        ring.end(cmdbuf);
+    }
+
+    void render()
+    {
+        // Run the main rendering command list, which clears the buffers and binds the state for the mesh
         queue.submitCommands(render_cmdlist);
 
+        if (gridMode)
+        {
+            // Record the grid across the workers, and submit their command lists in order
+            recorder.recordAndSubmit(queue, GridSize*GridSize, recordGridItems, this);
+        }
+        else
+        {
+            // Begin generating the dynamic command list, for commands that need to be sent only this frame specifically
+            dynmem.begin(dyncmd);
+
+            // Write the uniform buffers for this frame into the ring and bind them. The draw is recorded right after,
+            // so that the fence closing this slice of the ring is only signaled once the GPU is done reading it.
+            uniforms.begin(dyncmd);
+            uniforms.push(dyncmd, DkStage_Vertex, 0, transformState);
+            uniforms.push(dyncmd, DkStage_Fragment, 0, lightingState);
+
+            // Draw the mesh
+            mesh.draw(dyncmd);
+            uniforms.end(dyncmd);
+
+            // Finish off the dynamic command list (which also submits it to the queue)
+            queue.submitCommands(dynmem.end(dyncmd));
+        }
+
         // Acquire a framebuffer from the swapchain
         int slot = queue.acquireImage(swapchain);
 
@@ -373,7 +409,11 @@ public:
         if (kDown & KEY_PLUS)
             return false;
 
+        if (kDown & KEY_A)
+            gridMode = !gridMode;
+
         float time = ns / 1000000000.0; // double precision division; followed by implicit cast to single precision
+        gridTime = time;
         float tau = glm::two_pi<float>();
 
         float period1 = fractf(time/8.0f);
@@ -7,6 +7,14 @@
 ** - Enabling and configuring the tiled cache
 ** - Using the tiled barrier for relaxing ordering to the tiles generated by the binner (as opposed to a full fragment barrier)
 ** - Custom composition step reading the output of previous rendering passes as textures
+** - Tiled light culling: a compute pass bins many point lights into screen tiles using the g-buffer
+** - Dynamic resolution: scaling the rendered area according to the measured GPU time, and cropping the output
+** - Loading the shaders and the mesh from an asset pack (romfs:/assets.dkpak, see assets.lst), with a single romfs open
+** - Benchmarking render target settings: press A to sweep through every combination of g-buffer formats,
+**   hardware compression and tiled cache, printing the GPU time of each (visible through nxlink)
+**
+** MSAA is not part of the sweep here, as the g-buffer would need per-sample shading in the composition
+** step; see Example06 for the MSAA sweep.
 */
 
 // Sample Framework headers
@@ -15,7 +23,11 @@
 #include "SampleFramework/CShader.h"
 #include "SampleFramework/CCmdMemRing.h"
 #include "SampleFramework/CDescriptorSet.h"
-#include "SampleFramework/FileLoader.h"
+#include "SampleFramework/CAssetPack.h"
+#include "SampleFramework/CGpuProfiler.h"
+#include "SampleFramework/CFrameArena.h"
+#include "SampleFramework/CDynamicResolution.h"
+#include "SampleFramework/CBenchmarkSweep.h"
 
 // C++ standard library headers
 #include <array>
@@ -56,12 +68,58 @@ namespace
 
     struct Lighting
     {
-        glm::vec4 lightPos; // if w=0 this is lightDir
-        glm::vec3 ambient;
-        glm::vec3 diffuse;
+        glm::vec4 ambient;
         glm::vec4 specular; // w is shininess
+        uint32_t numTilesX;
+        uint32_t padding[3];
     };
 
+    struct Tiling
+    {
+        uint32_t screenSize[2];
+        uint32_t numTilesX;
+        uint32_t numLights;
+    };
+
+    struct PointLight
+    {
+        glm::vec4 posRadius; // xyz is view space position, w is radius of influence
+        glm::vec4 color;
+    };
+
+    // Formats of the g-buffer render targets: albedo, then normal and view direction (which need a sign)
+    struct GBufferFormats
+    {
+        const char* name;
+        DkImageFormat albedo;
+        DkImageFormat vectors;
+        uint32_t albedoBpp;
+        uint32_t vectorsBpp;
+    };
+
+    constexpr std::array GBufferFormatChoices =
+    {
+        GBufferFormats{ "RGBA16F x3",         DkImageFormat_RGBA16_Float, DkImageFormat_RGBA16_Float, 8,  8  },
+        GBufferFormats{ "RGBA8 + RGBA16F x2", DkImageFormat_RGBA8_Unorm,  DkImageFormat_RGBA16_Float, 4,  8  },
+        GBufferFormats{ "RGBA32F x3",         DkImageFormat_RGBA32_Float, DkImageFormat_RGBA32_Float, 16, 16 },
+    };
+
+    // Render target settings, varied by the benchmark sweep
+    struct RenderConfig
+    {
+        unsigned gbufferFormats;
+        bool compression;
+        bool tiledCache;
+    };
+
+    constexpr unsigned NumBenchConfigs = GBufferFormatChoices.size()*2*2;
+
+    RenderConfig GetBenchConfig(unsigned id)
+    {
+        unsigned n = GBufferFormatChoices.size();
+        return RenderConfig{ id % n, !((id / n) & 1), !((id / n) & 2) };
+    }
+
     inline float fractf(float x)
     {
         return x - floorf(x);
@@ -75,6 +133,12 @@ class CExample08 final : public CApplication
     static constexpr unsigned DynamicCmdSize = 0x10000;
     static constexpr unsigned MaxImages = 3;
     static constexpr unsigned MaxSamplers = 1;
+    static constexpr unsigned ProfilerFrames = NumFramebuffers+1;
+    static constexpr unsigned ProfilerPrintInterval = 120;
+    static constexpr unsigned NumLights = 256;
+    static constexpr unsigned TileSize = 16;            // must match TILE_SIZE in the shaders
+    static constexpr unsigned MaxLightsPerTile = 63;    // must match MAX_LIGHTS_PER_TILE in the shaders
+    static constexpr RenderConfig DefaultConfig = { 0, true, true };
 
     dk::UniqueDevice device;
     dk::UniqueQueue queue;
@@ -87,6 +151,15 @@ class CExample08 final : public CApplication
     dk::UniqueCmdBuf dyncmd;
     CCmdMemRing<NumFramebuffers> dynmem;
 
+    CGpuProfiler<ProfilerFrames> profiler;
+    unsigned profGBuffer, profLightCulling, profComposition;
+    unsigned frameCount;
+
+    CDynamicResolution dynres;
+
+    CBenchmarkSweep bench;
+    RenderConfig config;
+
     CDescriptorSet<MaxImages> imageDescriptorSet;
     CDescriptorSet<MaxSamplers> samplerDescriptorSet;
 
@@ -95,6 +168,7 @@ class CExample08 final : public CApplication
 
     CShader compositionVertexShader;
     CShader compositionFragmentShader;
+    CShader lightCullingShader;
 
     Transformation transformState;
     CMemPool::Handle transformUniformBuffer;
@@ -102,6 +176,13 @@ class CExample08 final : public CApplication
     Lighting lightingState;
     CMemPool::Handle lightingUniformBuffer;
 
+    Tiling tilingState;
+    CMemPool::Handle tilingUniformBuffer;
+
+    std::array<PointLight, NumLights> lights;
+    CFrameArena<NumFramebuffers> lightArena;
+    CMemPool::Handle tileLightsBuffer;
+
     CMemPool::Handle vertexBuffer;
     CMemPool::Handle indexBuffer;
 
@@ -122,16 +203,16 @@ class CExample08 final : public CApplication
     DkCmdList framebuffer_cmdlists[NumFramebuffers];
     dk::UniqueSwapchain swapchain;
 
-    DkCmdList render_cmdlist, composition_cmdlist;
+    DkCmdList render_cmdlist, culling_cmdlist, composition_cmdlist;
 
 public:
-    CExample08()
+    CExample08() : frameCount{}, config{DefaultConfig}
     {
         // Create the deko3d device
         device = dk::DeviceMaker{}.create();
 
-        // Create the main queue
-        queue = dk::QueueMaker{device}.setFlags(DkQueueFlags_Graphics).create();
+        // Create the main queue, with compute support for the light culling pass
+        queue = dk::QueueMaker{device}.setFlags(DkQueueFlags_Graphics | DkQueueFlags_Compute).create();
 
         // Create the memory pools
         pool_images.emplace(device, DkMemBlockFlags_GpuCached | DkMemBlockFlags_Image, 64*1024*1024);
@@ -147,15 +228,26 @@ public:
         dyncmd = dk::CmdBufMaker{device}.create();
         dynmem.allocate(*pool_data, DynamicCmdSize);
 
+        // Create the GPU profiler, used to measure the time taken by each rendering pass
+        profiler.allocate(*pool_data);
+        profGBuffer = profiler.registerPass("G-buffer");
+        profLightCulling = profiler.registerPass("Light culling");
+        profComposition = profiler.registerPass("Composition");
+
         // Create the image and sampler descriptor sets
         imageDescriptorSet.allocate(*pool_data);
         samplerDescriptorSet.allocate(*pool_data);
 
+        // Open the asset pack, which holds the shaders and the mesh: one romfs open and one index read for all of them
+        CAssetPack pack;
+        pack.open("romfs:/assets.dkpak");
+
         // Load the shaders
-        vertexShader.load(*pool_code, "romfs:/shaders/transform_normal_vsh.dksh");
-        fragmentShader.load(*pool_code, "romfs:/shaders/basic_deferred_fsh.dksh");
-        compositionVertexShader.load(*pool_code, "romfs:/shaders/composition_vsh.dksh");
-        compositionFragmentShader.load(*pool_code, "romfs:/shaders/composition_fsh.dksh");
+        vertexShader.load(*pool_code, pack, "shaders/transform_normal_vsh.dksh");
+        fragmentShader.load(*pool_code, pack, "shaders/basic_deferred_fsh.dksh");
+        compositionVertexShader.load(*pool_code, pack, "shaders/composition_vsh.dksh");
+        compositionFragmentShader.load(*pool_code, pack, "shaders/composition_fsh.dksh");
+        lightCullingShader.load(*pool_code, pack, "shaders/light_culling.dksh");
 
         // Create the transformation uniform buffer
         transformUniformBuffer = pool_data->allocate(sizeof(transformState), DK_UNIFORM_BUF_ALIGNMENT);
@@ -164,14 +256,20 @@ public:
         lightingUniformBuffer = pool_data->allocate(sizeof(lightingState), DK_UNIFORM_BUF_ALIGNMENT);
 
         // Initialize the lighting state
-        lightingState.lightPos = glm::vec4{0.0f, 4.0f, 1.0f, 1.0f};
-        lightingState.ambient = glm::vec3{0.046227f,0.028832f,0.003302f};
-        lightingState.diffuse = glm::vec3{0.564963f,0.367818f,0.051293f};
-        lightingState.specular = glm::vec4{24.0f*glm::vec3{0.394737f,0.308916f,0.134004f}, 64.0f};
+        lightingState.ambient = glm::vec4{0.046227f,0.028832f,0.003302f,0.0f};
+        lightingState.specular = glm::vec4{glm::vec3{0.394737f,0.308916f,0.134004f}, 64.0f};
+
+        // Create the tiling uniform buffer
+        tilingUniformBuffer = pool_data->allocate(sizeof(tilingState), DK_UNIFORM_BUF_ALIGNMENT);
+        tilingState.numLights = NumLights;
+
+        // Create the ring of light buffers: the lights move every frame, so each frame in flight gets its own copy
+        lightArena.allocate(*pool_data, sizeof(lights), DK_UNIFORM_BUF_ALIGNMENT);
 
         // Load the teapot mesh
-        vertexBuffer = LoadFile(*pool_data, "romfs:/teapot-vtx.bin", alignof(Vertex));
-        indexBuffer = LoadFile(*pool_data, "romfs:/teapot-idx.bin", alignof(u16));
+        vertexBuffer = pack.load(*pool_data, "teapot-vtx.bin", alignof(Vertex));
+        indexBuffer = pack.load(*pool_data, "teapot-idx.bin", alignof(u16));
+        pack.close();
 
         // Configure persistent state in the queue
         {
@@ -179,9 +277,8 @@ public:
             imageDescriptorSet.bindForImages(cmdbuf);
             samplerDescriptorSet.bindForSamplers(cmdbuf);
 
-            // Enable the tiled cache
+            // Configure the tile size used by the tiled cache (which is enabled by the g-buffer cmdlist)
             cmdbuf.setTileSize(64, 64); // example size, please experiment with this
-            cmdbuf.tiledCacheOp(DkTiledCacheOp_Enable);
 
             // Submit the configuration commands to the queue
             queue.submitCommands(cmdbuf.finishList());
@@ -192,18 +289,29 @@ public:
 
     void createFramebufferResources()
     {
-        // Calculate layout for the different buffers part of the g-buffer
+        GBufferFormats const& formats = GBufferFormatChoices[config.gbufferFormats];
+        uint32_t compressionFlag = config.compression ? DkImageFlags_HwCompression : 0;
+
+        // Calculate layout for the albedo buffer
+        dk::ImageLayout layout_albedo;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageRender | compressionFlag)
+            .setFormat(formats.albedo)
+            .setDimensions(framebufferWidth, framebufferHeight)
+            .initialize(layout_albedo);
+
+        // Calculate layout for the other buffers part of the g-buffer
         dk::ImageLayout layout_gbuffer;
         dk::ImageLayoutMaker{device}
-            .setFlags(DkImageFlags_UsageRender | DkImageFlags_HwCompression)
-            .setFormat(DkImageFormat_RGBA16_Float)
+            .setFlags(DkImageFlags_UsageRender | compressionFlag)
+            .setFormat(formats.vectors)
             .setDimensions(framebufferWidth, framebufferHeight)
             .initialize(layout_gbuffer);
 
         // Calculate layout for the depth buffer
         dk::ImageLayout layout_depthbuffer;
         dk::ImageLayoutMaker{device}
-            .setFlags(DkImageFlags_UsageRender | DkImageFlags_HwCompression)
+            .setFlags(DkImageFlags_UsageRender | compressionFlag)
             .setFormat(DkImageFormat_Z24S8)
             .setDimensions(framebufferWidth, framebufferHeight)
             .initialize(layout_depthbuffer);
@@ -217,8 +325,8 @@ public:
             .initialize(layout_framebuffer);
 
         // Create the albedo buffer
-        albedoBuffer_mem = pool_images->allocate(layout_gbuffer.getSize(), layout_gbuffer.getAlignment());
-        albedoBuffer.initialize(layout_gbuffer, albedoBuffer_mem.getMemBlock(), albedoBuffer_mem.getOffset());
+        albedoBuffer_mem = pool_images->allocate(layout_albedo.getSize(), layout_albedo.getAlignment());
+        albedoBuffer.initialize(layout_albedo, albedoBuffer_mem.getMemBlock(), albedoBuffer_mem.getOffset());
 
         // Create the normal buffer
         normalBuffer_mem = pool_images->allocate(layout_gbuffer.getSize(), layout_gbuffer.getAlignment());
@@ -232,6 +340,15 @@ public:
         depthBuffer_mem = pool_images->allocate(layout_depthbuffer.getSize(), layout_depthbuffer.getAlignment());
         depthBuffer.initialize(layout_depthbuffer, depthBuffer_mem.getMemBlock(), depthBuffer_mem.getOffset());
 
+        // Create the buffer holding the list of lights affecting each screen tile
+        uint32_t numTilesX = (framebufferWidth + TileSize - 1) / TileSize;
+        uint32_t numTilesY = (framebufferHeight + TileSize - 1) / TileSize;
+        tileLightsBuffer = pool_data->allocate(numTilesX*numTilesY*(MaxLightsPerTile+1)*sizeof(uint32_t), DK_UNIFORM_BUF_ALIGNMENT);
+
+        // Update the tiling state (the screen size is updated every frame according to the render scale)
+        tilingState.numTilesX = numTilesX;
+        lightingState.numTilesX = numTilesX;
+
         // Create the framebuffers
         uint64_t fb_size  = layout_framebuffer.getSize();
         uint32_t fb_align = layout_framebuffer.getAlignment();
@@ -282,6 +399,9 @@ public:
         for (unsigned i = 0; i < NumFramebuffers; i ++)
             framebuffers_mem[i].destroy();
 
+        // Destroy the tile light lists
+        tileLightsBuffer.destroy();
+
         // Destroy the rendertargets
         depthBuffer_mem.destroy();
         viewDirBuffer_mem.destroy();
@@ -301,6 +421,7 @@ public:
         vertexBuffer.destroy();
 
         // Destroy the uniform buffers (not strictly needed in this case)
+        tilingUniformBuffer.destroy();
         lightingUniformBuffer.destroy();
         transformUniformBuffer.destroy();
     }
@@ -313,15 +434,14 @@ public:
         dk::ColorWriteState colorWriteState;
         dk::DepthStencilState depthStencilState;
 
+        // Enable or disable the tiled cache
+        cmdbuf.tiledCacheOp(config.tiledCache ? DkTiledCacheOp_Enable : DkTiledCacheOp_Disable);
+
         // Bind g-buffer and depth buffer
         dk::ImageView albedoTarget { albedoBuffer }, normalTarget { normalBuffer }, viewDirTarget { viewDirBuffer }, depthTarget { depthBuffer };
         cmdbuf.bindRenderTargets({ &albedoTarget, &normalTarget, &viewDirTarget }, &depthTarget);
 
-        // Configure viewport and scissor
-        const DkViewport viewport = { 0.0f, 0.0f, float(framebufferWidth), float(framebufferHeight), 0.0f, 1.0f };
-        const DkScissor scissor   = { 0, 0, framebufferWidth, framebufferHeight };
-        cmdbuf.setViewports(0, { viewport, viewport, viewport });
-        cmdbuf.setScissors(0, { scissor, scissor, scissor });
+        // Note: the viewport and scissor are configured every frame according to the dynamic resolution scale
 
         // Clear the g-buffer and the depth buffer
         cmdbuf.clearColor(0, DkColorMask_RGBA, 0.0f, 0.0f, 0.0f, 0.0f);
@@ -344,9 +464,10 @@ public:
         // Draw the mesh
         cmdbuf.drawIndexed(DkPrimitive_Triangles, indexBuffer.getSize() / sizeof(u16), 1, 0, 0, 0);
 
-        // Tiled barrier (similar to using Vulkan's vkCmdNextSubpass) + image cache
-        // flush so that the next rendering step can access the output from this step
-        cmdbuf.barrier(DkBarrier_Tiles, DkInvalidateFlags_Image);
+        // Full fragment barrier + image cache flush so that the light culling step can access the output
+        // from this step. Unlike the composition step, the light culling step reads pixels belonging to
+        // other tiles of the tiled cache, so the tiled barrier is not enough here.
+        cmdbuf.barrier(DkBarrier_Fragments, DkInvalidateFlags_Image);
 
         // Discard the depth buffer since we don't need it anymore
         cmdbuf.discardDepthStencil();
@@ -370,11 +491,25 @@ public:
         // Flush the descriptor cache
         cmdbuf.barrier(DkBarrier_None, DkInvalidateFlags_Descriptors);
 
+        // Bind state required for running the light culling job (the light buffer itself is bound every frame)
+        cmdbuf.bindShaders(DkStageFlag_Compute, { lightCullingShader });
+        cmdbuf.bindUniformBuffer(DkStage_Compute, 0, tilingUniformBuffer.getGpuAddr(), tilingUniformBuffer.getSize());
+        cmdbuf.bindStorageBuffer(DkStage_Compute, 1, tileLightsBuffer.getGpuAddr(), tileLightsBuffer.getSize());
+        cmdbuf.bindTextures(DkStage_Compute, 2, dkMakeTextureHandle(2, 0));
+
+        // Run the light culling job, one work group per tile
+        cmdbuf.dispatchCompute(tilingState.numTilesX, (framebufferHeight + TileSize - 1) / TileSize, 1);
+
+        // Place a barrier so that the composition step sees the lists of lights generated by the job
+        cmdbuf.barrier(DkBarrier_Primitives, 0);
+
+        // End of the light culling cmdlist
+        culling_cmdlist = cmdbuf.finishList();
+
         // Bind state required for doing the composition
-        cmdbuf.setViewports(0, viewport);
-        cmdbuf.setScissors(0, scissor);
         cmdbuf.bindShaders(DkStageFlag_GraphicsMask, { compositionVertexShader, compositionFragmentShader });
         cmdbuf.bindUniformBuffer(DkStage_Fragment, 0, lightingUniformBuffer.getGpuAddr(), lightingUniformBuffer.getSize());
+        cmdbuf.bindStorageBuffer(DkStage_Fragment, 1, tileLightsBuffer.getGpuAddr(), tileLightsBuffer.getSize());
         cmdbuf.bindTextures(DkStage_Fragment, 0, {
             dkMakeTextureHandle(0, 0),
             dkMakeTextureHandle(1, 0),
@@ -401,11 +536,50 @@ public:
         composition_cmdlist = cmdbuf.finishList();
     }
 
+    u64 getFrameGpuNs() const
+    {
+        return profiler.getLastNs(profGBuffer) + profiler.getLastNs(profLightCulling) + profiler.getLastNs(profComposition);
+    }
+
+    void applyConfig(RenderConfig const& newConfig)
+    {
+        // Recreate the render targets and the static command lists with the new settings
+        destroyFramebufferResources();
+        config = newConfig;
+        dynres.reset();
+        createFramebufferResources();
+
+        if (bench.isActive())
+        {
+            GBufferFormats const& formats = GBufferFormatChoices[config.gbufferFormats];
+            char name[CBenchmarkSweep::MaxNameLength];
+            snprintf(name, sizeof(name), "%s, compression %s, tiled %s", formats.name,
+                config.compression ? "on" : "off", config.tiledCache ? "on" : "off");
+
+            // Estimated traffic (ignoring compression and caching): g-buffer and depth written, view
+            // direction read by light culling, g-buffer read by the composition which writes the framebuffer
+            u64 pixels = u64(framebufferWidth)*framebufferHeight;
+            u64 gbufferBytes = pixels*(formats.albedoBpp + 2*formats.vectorsBpp);
+            bench.describe(name, gbufferBytes + pixels*4 + pixels*formats.vectorsBpp + gbufferBytes + pixels*4);
+        }
+    }
+
     void render()
     {
         // Begin generating the dynamic command list, for commands that need to be sent only this frame specifically
         dynmem.begin(dyncmd);
 
+        // Collect the GPU timings of the last frame that used this profiler slot
+        profiler.beginFrame();
+
+        // Pick the render scale for this frame according to the latest GPU time of all passes
+        // (benchmark runs are always done at full resolution)
+        if (!bench.isActive())
+            dynres.update(getFrameGpuNs());
+        dynres.setViewports(dyncmd, 3);
+        tilingState.screenSize[0] = dynres.getRenderWidth();
+        tilingState.screenSize[1] = dynres.getRenderHeight();
+
         // Update the transformation uniform buffer with the new state (this data gets inlined in the command list)
         dyncmd.pushConstants(
             transformUniformBuffer.getGpuAddr(), transformUniformBuffer.getSize(),
@@ -416,23 +590,66 @@ public:
             lightingUniformBuffer.getGpuAddr(), lightingUniformBuffer.getSize(),
             0, sizeof(lightingState), &lightingState);
 
-        // Finish off the dynamic command list (which also submits it to the queue)
-        queue.submitCommands(dynmem.end(dyncmd));
+        // Update the tiling uniform buffer with the new state
+        dyncmd.pushConstants(
+            tilingUniformBuffer.getGpuAddr(), tilingUniformBuffer.getSize(),
+            0, sizeof(tilingState), &tilingState);
+
+        // Write this frame's copy of the lights, and bind it for both the light culling and the composition steps.
+        // The data gets written by the CPU, so make sure the GPU does not see stale cached contents.
+        lightArena.begin();
+        auto lightData = lightArena.push(lights, DK_UNIFORM_BUF_ALIGNMENT);
+        dyncmd.barrier(DkBarrier_None, DkInvalidateFlags_L2Cache);
+        dyncmd.bindStorageBuffer(DkStage_Compute, 0, lightData.getGpuAddr(), lightData.getSize());
+        dyncmd.bindStorageBuffer(DkStage_Fragment, 0, lightData.getGpuAddr(), lightData.getSize());
+
+        // Submit the dynamic commands so far, ending with the timestamp marking the start of the g-buffer pass
+        profiler.begin(dyncmd, profGBuffer);
+        queue.submitCommands(dyncmd.finishList());
 
         // Run the main rendering command list
         queue.submitCommands(render_cmdlist);
 
+        // Timestamp the end of the g-buffer pass, and the start of the light culling pass
+        profiler.end(dyncmd, profGBuffer);
+        profiler.begin(dyncmd, profLightCulling);
+        queue.submitCommands(dyncmd.finishList());
+
+        // Run the light culling command list
+        queue.submitCommands(culling_cmdlist);
+
+        // Timestamp the end of the light culling pass
+        profiler.end(dyncmd, profLightCulling);
+        queue.submitCommands(dyncmd.finishList());
+
         // Acquire a framebuffer from the swapchain
         int slot = queue.acquireImage(swapchain);
 
+        // Timestamp the start of the composition pass (after waiting for the framebuffer to be available)
+        profiler.begin(dyncmd, profComposition);
+        queue.submitCommands(dyncmd.finishList());
+
         // Submit the command list that binds the correct framebuffer
         queue.submitCommands(framebuffer_cmdlists[slot]);
 
         // Submit the command list used for performing the composition
         queue.submitCommands(composition_cmdlist);
 
+        // Timestamp the end of the composition pass, then finish off the dynamic command list
+        profiler.end(dyncmd, profComposition);
+        profiler.endFrame(dyncmd);
+        lightArena.end(dyncmd);
+        queue.submitCommands(dynmem.end(dyncmd));
+
+        // Only the rendered area of the framebuffer gets presented, upscaled to the whole screen
+        dynres.setCrop(swapchain);
+
         // Now that we are done rendering, present it to the screen (this also flushes the queue)
         queue.presentImage(swapchain, slot);
+
+        // Periodically report the rolling GPU timings (visible through nxlink)
+        if (++frameCount % ProfilerPrintInterval == 0 && !bench.isActive())
+            profiler.printStats();
     }
 
     void onOperationMode(AppletOperationMode mode) override
@@ -443,6 +660,17 @@ public:
         // Choose framebuffer size
         chooseFramebufferSize(framebufferWidth, framebufferHeight, mode);
 
+        // The framebuffers are the largest size we render at, start off at full resolution
+        dynres.setFullSize(framebufferWidth, framebufferHeight);
+        dynres.reset();
+
+        // Results would not be comparable across resolutions, so abort any sweep in progress
+        if (bench.isActive())
+        {
+            bench.stop();
+            config = DefaultConfig;
+        }
+
         // Recreate the framebuffers and its associated resources
         createFramebufferResources();
     }
@@ -454,6 +682,16 @@ public:
         if (kDown & KEY_PLUS)
             return false;
 
+        // Start the benchmark sweep, or advance it according to the GPU time of the latest frame
+        if ((kDown & KEY_A) && !bench.isActive())
+        {
+            printf("[bench] Running %u configurations at %ux%u...\n", NumBenchConfigs, framebufferWidth, framebufferHeight);
+            bench.start(NumBenchConfigs);
+            applyConfig(GetBenchConfig(0));
+        }
+        else if (bench.update(getFrameGpuNs()))
+            applyConfig(bench.isActive() ? GetBenchConfig(bench.getConfig()) : DefaultConfig);
+
         float time = ns / 1000000000.0; // double precision division; followed by implicit cast to single precision
         float tau = glm::two_pi<float>();
 
@@ -470,6 +708,24 @@ public:
         transformState.mdlvMtx = glm::rotate(transformState.mdlvMtx, -period1 * tau, glm::vec3{0.0f, 1.0f, 0.0f});
         transformState.mdlvMtx = glm::translate(transformState.mdlvMtx, glm::vec3{0.0f, -0.5f, 0.0f});
 
+        // Move the lights around, in rings of different sizes orbiting the area occupied by the teapot
+        for (unsigned i = 0; i < NumLights; i ++)
+        {
+            float hue = float(i) / NumLights;
+            float ring = fractf(i * 0.618034f);
+            float angle = (hue + period1 * (ring < 0.5f ? 1.0f : -1.0f)) * tau;
+            float orbit = 0.4f + 1.2f*ring;
+            float height = sinf((hue*7.0f + period2) * tau) * 0.8f;
+
+            lights[i].posRadius = glm::vec4{orbit*cosf(angle), height, -3.0f + orbit*sinf(angle), 0.5f};
+            lights[i].color = glm::vec4{
+                0.5f + 0.5f*cosf((hue + 0.0f/3.0f) * tau),
+                0.5f + 0.5f*cosf((hue + 1.0f/3.0f) * tau),
+                0.5f + 0.5f*cosf((hue + 2.0f/3.0f) * tau),
+                1.0f,
+            } * 0.5f;
+        }
+
         render();
         return true;
     }
@@ -8,6 +8,8 @@
 ** - Dispatching compute jobs
 ** - Using a primitive barrier to ensure ordering of items
 ** - Drawing geometry generated dynamically by the GPU itself
+** - Optionally (toggled with A): running the compute job on a dedicated queue, overlapped with rendering,
+**   using fences for synchronization between queues and double buffered geometry
 */
 
 // Sample Framework headers
@@ -68,9 +70,11 @@ class CExample09 final : public CApplication
     static constexpr unsigned StaticCmdSize = 0x10000;
     static constexpr unsigned DynamicCmdSize = 0x10000;
     static constexpr unsigned NumVertices = 256;
+    static constexpr unsigned NumVertexBuffers = 2;
 
     dk::UniqueDevice device;
     dk::UniqueQueue queue;
+    dk::UniqueQueue computeQueue;
 
     std::optional<CMemPool> pool_images;
     std::optional<CMemPool> pool_code;
@@ -79,6 +83,8 @@ class CExample09 final : public CApplication
     dk::UniqueCmdBuf cmdbuf;
     dk::UniqueCmdBuf dyncmd;
     CCmdMemRing<NumFramebuffers> dynmem;
+    dk::UniqueCmdBuf computecmd;
+    CCmdMemRing<NumVertexBuffers> computemem;
 
     GeneratorParams params;
     CMemPool::Handle paramsUniformBuffer;
@@ -87,17 +93,21 @@ class CExample09 final : public CApplication
     CShader vertexShader;
     CShader fragmentShader;
 
-    CMemPool::Handle vertexBuffer;
+    CMemPool::Handle vertexBuffers[NumVertexBuffers];
+    dk::Fence computeDoneFences[NumVertexBuffers];
+    dk::Fence renderDoneFences[NumVertexBuffers];
+    unsigned curVertexBuffer;
+    bool asyncCompute;
 
     CMemPool::Handle framebuffers_mem[NumFramebuffers];
     dk::Image framebuffers[NumFramebuffers];
     DkCmdList framebuffer_cmdlists[NumFramebuffers];
     dk::UniqueSwapchain swapchain;
 
-    DkCmdList compute_cmdlist, render_cmdlist;
+    DkCmdList compute_cmdlists[NumVertexBuffers], render_cmdlists[NumVertexBuffers];
 
 public:
-    CExample09()
+    CExample09() : curVertexBuffer{}, asyncCompute{}
     {
         // Create the deko3d device
         device = dk::DeviceMaker{}.create();
@@ -105,6 +115,9 @@ public:
         // Create the main queue
         queue = dk::QueueMaker{device}.setFlags(DkQueueFlags_Graphics | DkQueueFlags_Compute).create();
 
+        // Create the dedicated compute queue, used in async compute mode
+        computeQueue = dk::QueueMaker{device}.setFlags(DkQueueFlags_Compute).create();
+
         // Create the memory pools
         pool_images.emplace(device, DkMemBlockFlags_GpuCached | DkMemBlockFlags_Image, 16*1024*1024);
         pool_code.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached | DkMemBlockFlags_Code, 128*1024);
@@ -119,6 +132,10 @@ public:
         dyncmd = dk::CmdBufMaker{device}.create();
         dynmem.allocate(*pool_data, DynamicCmdSize);
 
+        // Create the dynamic command buffer used with the compute queue, and allocate memory for it
+        computecmd = dk::CmdBufMaker{device}.create();
+        computemem.allocate(*pool_data, DynamicCmdSize);
+
         // Load the shaders
         computeShader.load(*pool_code, "romfs:/shaders/sinewave.dksh");
         vertexShader.load(*pool_code, "romfs:/shaders/basic_vsh.dksh");
@@ -133,8 +150,9 @@ public:
         params.offset = 0.0f;
         params.scale  = 1.0f;
 
-        // Allocate memory for the vertex buffer
-        vertexBuffer = pool_data->allocate(sizeof(Vertex)*NumVertices, alignof(Vertex));
+        // Allocate memory for the vertex buffers (the second one is only used in async compute mode)
+        for (unsigned i = 0; i < NumVertexBuffers; i ++)
+            vertexBuffers[i] = pool_data->allocate(sizeof(Vertex)*NumVertices, alignof(Vertex));
 
         // Create the framebuffer resources
         createFramebufferResources();
@@ -142,11 +160,15 @@ public:
 
     ~CExample09()
     {
+        // Go back to serial mode, which waits for the compute queue to be idle
+        setAsyncCompute(false);
+
         // Destroy the framebuffer resources
         destroyFramebufferResources();
 
-        // Destroy the vertex buffer (not strictly needed in this case)
-        vertexBuffer.destroy();
+        // Destroy the vertex buffers (not strictly needed in this case)
+        for (unsigned i = 0; i < NumVertexBuffers; i ++)
+            vertexBuffers[i].destroy();
 
         // Destroy the uniform buffer (not strictly needed in this case)
         paramsUniformBuffer.destroy();
@@ -193,7 +215,8 @@ public:
         // Return early if we have nothing to destroy
         if (!swapchain) return;
 
-        // Make sure the queue is idle before destroying anything
+        // Make sure the queues are idle before destroying anything
+        computeQueue.waitIdle();
         queue.waitIdle();
 
         // Clear the static cmdbuf, destroying the static cmdlists in the process
@@ -209,19 +232,23 @@ public:
 
     void recordStaticCommands()
     {
-        // Bind state required for running the compute job
-        cmdbuf.bindShaders(DkStageFlag_Compute, { computeShader });
-        cmdbuf.bindUniformBuffer(DkStage_Compute, 0, paramsUniformBuffer.getGpuAddr(), paramsUniformBuffer.getSize());
-        cmdbuf.bindStorageBuffer(DkStage_Compute, 0, vertexBuffer.getGpuAddr(), vertexBuffer.getSize());
+        // Generate a compute command list for each of the vertex buffers
+        for (unsigned i = 0; i < NumVertexBuffers; i ++)
+        {
+            // Bind state required for running the compute job
+            cmdbuf.bindShaders(DkStageFlag_Compute, { computeShader });
+            cmdbuf.bindUniformBuffer(DkStage_Compute, 0, paramsUniformBuffer.getGpuAddr(), paramsUniformBuffer.getSize());
+            cmdbuf.bindStorageBuffer(DkStage_Compute, 0, vertexBuffers[i].getGpuAddr(), vertexBuffers[i].getSize());
 
-        // Run the compute job
-        cmdbuf.dispatchCompute(NumVertices/32, 1, 1);
+            // Run the compute job
+            cmdbuf.dispatchCompute(NumVertices/32, 1, 1);
 
-        // Place a barrier
-        cmdbuf.barrier(DkBarrier_Primitives, 0);
+            // Place a barrier
+            cmdbuf.barrier(DkBarrier_Primitives, 0);
 
-        // Finish off this command list
-        compute_cmdlist = cmdbuf.finishList();
+            // Finish off this command list
+            compute_cmdlists[i] = cmdbuf.finishList();
+        }
 
         // Initialize state structs with deko3d defaults
         dk::RasterizerState rasterizerState;
@@ -235,46 +262,112 @@ public:
         // Configure color state: enable blending (needed for polygon smoothing since it generates alpha values)
         colorState.setBlendEnable(0, true);
 
-        // Configure viewport and scissor
-        cmdbuf.setViewports(0, { { 0.0f, 0.0f, FramebufferWidth, FramebufferHeight, 0.0f, 1.0f } });
-        cmdbuf.setScissors(0, { { 0, 0, FramebufferWidth, FramebufferHeight } });
-
-        // Clear the color buffer
-        cmdbuf.clearColor(0, DkColorMask_RGBA, 0.0f, 0.0f, 0.0f, 0.0f);
-
-        // Bind state required for drawing the triangle
-        cmdbuf.bindShaders(DkStageFlag_GraphicsMask, { vertexShader, fragmentShader });
-        cmdbuf.bindRasterizerState(rasterizerState);
-        cmdbuf.bindColorState(colorState);
-        cmdbuf.bindColorWriteState(colorWriteState);
-        cmdbuf.bindBlendStates(0, blendState);
-        cmdbuf.bindVtxBuffer(0, vertexBuffer.getGpuAddr(), vertexBuffer.getSize());
-        cmdbuf.bindVtxAttribState(VertexAttribState);
-        cmdbuf.bindVtxBufferState(VertexBufferState);
-        cmdbuf.setLineWidth(16.0f);
-
-        // Draw the line
-        cmdbuf.draw(DkPrimitive_LineStrip, NumVertices, 1, 0, 0);
-
-        // Finish off this command list
-        render_cmdlist = cmdbuf.finishList();
+        // Generate a rendering command list for each of the vertex buffers
+        for (unsigned i = 0; i < NumVertexBuffers; i ++)
+        {
+            // Configure viewport and scissor
+            cmdbuf.setViewports(0, { { 0.0f, 0.0f, FramebufferWidth, FramebufferHeight, 0.0f, 1.0f } });
+            cmdbuf.setScissors(0, { { 0, 0, FramebufferWidth, FramebufferHeight } });
+
+            // Clear the color buffer
+            cmdbuf.clearColor(0, DkColorMask_RGBA, 0.0f, 0.0f, 0.0f, 0.0f);
+
+            // Bind state required for drawing the triangle
+            cmdbuf.bindShaders(DkStageFlag_GraphicsMask, { vertexShader, fragmentShader });
+            cmdbuf.bindRasterizerState(rasterizerState);
+            cmdbuf.bindColorState(colorState);
+            cmdbuf.bindColorWriteState(colorWriteState);
+            cmdbuf.bindBlendStates(0, blendState);
+            cmdbuf.bindVtxBuffer(0, vertexBuffers[i].getGpuAddr(), vertexBuffers[i].getSize());
+            cmdbuf.bindVtxAttribState(VertexAttribState);
+            cmdbuf.bindVtxBufferState(VertexBufferState);
+            cmdbuf.setLineWidth(16.0f);
+
+            // Draw the line
+            cmdbuf.draw(DkPrimitive_LineStrip, NumVertices, 1, 0, 0);
+
+            // Finish off this command list
+            render_cmdlists[i] = cmdbuf.finishList();
+        }
     }
 
-    void render()
+    void submitCompute(dk::Queue target, DkCmdList paramsList, unsigned buffer)
+    {
+        // Update the uniform buffer, then run the compute job generating the contents of the given vertex buffer
+        target.submitCommands(paramsList);
+        target.submitCommands(compute_cmdlists[buffer]);
+    }
+
+    template <unsigned NumSlices>
+    DkCmdList recordParams(dk::CmdBuf cmd, CCmdMemRing<NumSlices>& mem)
     {
         // Begin generating the dynamic command list, for commands that need to be sent only this frame specifically
-        dynmem.begin(dyncmd);
+        mem.begin(cmd);
 
         // Update the uniform buffer with the new state (this data gets inlined in the command list)
-        dyncmd.pushConstants(
+        cmd.pushConstants(
             paramsUniformBuffer.getGpuAddr(), paramsUniformBuffer.getSize(),
             0, sizeof(params), &params);
 
-        // Finish off the dynamic command list (which also submits it to the queue)
-        queue.submitCommands(dynmem.end(dyncmd));
+        // Finish off the dynamic command list
+        return mem.end(cmd);
+    }
 
-        // Run the compute command list
-        queue.submitCommands(compute_cmdlist);
+    void setAsyncCompute(bool enable)
+    {
+        if (enable == asyncCompute)
+            return;
+
+        // Drain both queues before switching modes
+        computeQueue.waitIdle();
+        queue.waitIdle();
+        asyncCompute = enable;
+        curVertexBuffer = 0;
+        if (!enable)
+            return;
+
+        // None of the vertex buffers are being read by the graphics queue right now
+        for (unsigned i = 0; i < NumVertexBuffers; i ++)
+            queue.signalFence(renderDoneFences[i], true);
+
+        // Generate the geometry for the first frame ahead of time, so that the pipeline is primed
+        submitCompute(computeQueue, recordParams(computecmd, computemem), curVertexBuffer);
+        computeQueue.signalFence(computeDoneFences[curVertexBuffer], true);
+    }
+
+    void render()
+    {
+        if (!asyncCompute)
+        {
+            // Serial mode: the compute job runs on the graphics queue, right before the rendering that consumes its output
+            submitCompute(queue, recordParams(dyncmd, dynmem), 0);
+
+            // Acquire a framebuffer from the swapchain (and wait for it to be available)
+            int slot = queue.acquireImage(swapchain);
+
+            // Run the command list that attaches said framebuffer to the queue
+            queue.submitCommands(framebuffer_cmdlists[slot]);
+
+            // Run the main rendering command list
+            queue.submitCommands(render_cmdlists[0]);
+
+            // Now that we are done rendering, present it to the screen
+            queue.presentImage(swapchain, slot);
+            return;
+        }
+
+        // Async compute mode: the compute queue generates the geometry of the next frame while
+        // the graphics queue draws the geometry of the current frame, which was generated last frame
+        unsigned nextVertexBuffer = (curVertexBuffer + 1) % NumVertexBuffers;
+
+        // Compute queue: wait for the graphics queue to be done drawing the buffer we are about to overwrite,
+        // generate the next frame's geometry, and let the graphics queue know when it is ready
+        computeQueue.waitFence(renderDoneFences[nextVertexBuffer]);
+        submitCompute(computeQueue, recordParams(computecmd, computemem), nextVertexBuffer);
+        computeQueue.signalFence(computeDoneFences[nextVertexBuffer], true);
+
+        // Graphics queue: wait for the current frame's geometry to be generated
+        queue.waitFence(computeDoneFences[curVertexBuffer]);
 
         // Acquire a framebuffer from the swapchain (and wait for it to be available)
         int slot = queue.acquireImage(swapchain);
@@ -282,11 +375,14 @@ public:
         // Run the command list that attaches said framebuffer to the queue
         queue.submitCommands(framebuffer_cmdlists[slot]);
 
-        // Run the main rendering command list
-        queue.submitCommands(render_cmdlist);
+        // Run the main rendering command list, and signal that we are done reading the vertex buffer
+        queue.submitCommands(render_cmdlists[curVertexBuffer]);
+        queue.signalFence(renderDoneFences[curVertexBuffer], false);
 
         // Now that we are done rendering, present it to the screen
         queue.presentImage(swapchain, slot);
+
+        curVertexBuffer = nextVertexBuffer;
     }
 
     bool onFrame(u64 ns) override
@@ -295,6 +391,8 @@ public:
         u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
         if (kDown & KEY_PLUS)
             return false;
+        if (kDown & KEY_A)
+            setAsyncCompute(!asyncCompute);
 
         float time = ns / 1000000000.0; // double precision division; followed by implicit cast to single precision
         float tau = glm::two_pi<float>();
@@ -0,0 +1,692 @@
+/*
+** deko3d Example 10: GPU-Driven Culling (Indirect Draws)
+** This example shows how to let the GPU itself decide what to draw, removing per-object work from the CPU.
+** New concepts in this example:
+** - Frustum culling per-instance bounding spheres in a compute shader
+** - Compacting the visible instances into a list using atomic operations
+** - Having a compute shader write the parameters of a draw call
+** - Issuing indirect draw calls whose parameters are sourced from GPU memory
+** - Reading per-instance data from storage buffers in the vertex shader
+** - Occlusion culling against a depth pyramid (Hi-Z) built by a compute shader from the previous frame's depth
+** - Loading the mesh on an I/O thread (CAsyncFileLoader) while the rest of the setup runs
+**
+** Press A to toggle occlusion culling. The number of instances drawn is printed every second
+** (visible through nxlink): seen from low above the grid, most teapots are hidden behind closer ones,
+** and are skipped before any of their vertices or fragments are processed.
+*/
+
+// Sample Framework headers
+#include "SampleFramework/CApplication.h"
+#include "SampleFramework/CMemPool.h"
+#include "SampleFramework/CShader.h"
+#include "SampleFramework/CCmdMemRing.h"
+#include "SampleFramework/CDescriptorSet.h"
+#include "SampleFramework/FileLoader.h"
+
+// C++ standard library headers
+#include <algorithm>
+#include <array>
+#include <optional>
+
+// GLM headers
+#define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES // Enforces GLSL std140/std430 alignment rules for glm types
+#define GLM_FORCE_INTRINSICS               // Enables usage of SIMD CPU instructions (requiring the above as well)
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace
+{
+    struct Vertex
+    {
+        float position[3];
+        float normal[3];
+    };
+
+    constexpr std::array VertexAttribState =
+    {
+        DkVtxAttribState{ 0, 0, offsetof(Vertex, position), DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
+        DkVtxAttribState{ 0, 0, offsetof(Vertex, normal),   DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
+    };
+
+    constexpr std::array VertexBufferState =
+    {
+        DkVtxBufferState{ sizeof(Vertex), 0 },
+    };
+
+    struct Instance
+    {
+        glm::vec4 posScale; // xyz is position, w is scale
+        glm::vec4 params;   // x is rotation around the Y axis
+    };
+
+    struct Transformation
+    {
+        glm::mat4 viewMtx;
+        glm::mat4 projMtx;
+    };
+
+    struct Culling
+    {
+        glm::vec4 planes[6];
+        glm::vec4 meshSphere;
+        glm::mat4 prevViewProj;
+        glm::vec4 hizParams; // xy is the size of the depth buffer, z is the number of pyramid levels, w enables the test
+        uint32_t numInstances;
+        uint32_t padding[3];
+    };
+
+    struct HiZLevel
+    {
+        int32_t srcSize[2];
+        int32_t dstSize[2];
+    };
+
+    constexpr uint32_t HiZLevelStride = (sizeof(HiZLevel) + DK_UNIFORM_BUF_ALIGNMENT - 1) &~ (DK_UNIFORM_BUF_ALIGNMENT - 1);
+
+    struct Lighting
+    {
+        glm::vec4 lightPos; // if w=0 this is lightDir
+        glm::vec3 ambient;
+        glm::vec3 diffuse;
+        glm::vec4 specular; // w is shininess
+    };
+
+    inline float fractf(float x)
+    {
+        return x - floorf(x);
+    }
+
+    // Extracts the frustum planes (pointing inwards) out of a view-projection matrix with [0,1] depth range
+    void extractFrustumPlanes(glm::vec4 planes[6], glm::mat4 const& m)
+    {
+        glm::vec4 row0 { m[0][0], m[1][0], m[2][0], m[3][0] };
+        glm::vec4 row1 { m[0][1], m[1][1], m[2][1], m[3][1] };
+        glm::vec4 row2 { m[0][2], m[1][2], m[2][2], m[3][2] };
+        glm::vec4 row3 { m[0][3], m[1][3], m[2][3], m[3][3] };
+
+        planes[0] = row3 + row0; // left
+        planes[1] = row3 - row0; // right
+        planes[2] = row3 + row1; // bottom
+        planes[3] = row3 - row1; // top
+        planes[4] = row2;        // near
+        planes[5] = row3 - row2; // far
+
+        for (unsigned i = 0; i < 6; i ++)
+            planes[i] /= glm::length(glm::vec3{planes[i]});
+    }
+}
+
+class CExample10 final : public CApplication
+{
+    static constexpr unsigned NumFramebuffers = 2;
+    static constexpr unsigned StaticCmdSize = 0x10000;
+    static constexpr unsigned DynamicCmdSize = 0x10000;
+    static constexpr unsigned GridSize = 128;
+    static constexpr unsigned NumInstances = GridSize*GridSize;
+    static constexpr float GridSpacing = 3.0f;
+    static constexpr unsigned CullingGroupSize = 64;
+    static constexpr unsigned HiZGroupSize = 8;
+    static constexpr unsigned MaxHiZLevels = 12;
+
+    // Image descriptors: the depth buffer, the whole pyramid, then each level of the pyramid for
+    // reading it (as a texture) and for writing it (as an image)
+    static constexpr unsigned DepthDescriptor = 0;
+    static constexpr unsigned HiZDescriptor = 1;
+    static constexpr unsigned HiZLevelTexDescriptors = 2;
+    static constexpr unsigned HiZLevelImgDescriptors = HiZLevelTexDescriptors + MaxHiZLevels;
+    static constexpr unsigned MaxImages = HiZLevelImgDescriptors + MaxHiZLevels;
+    static constexpr unsigned MaxSamplers = 1;
+
+    dk::UniqueDevice device;
+    dk::UniqueQueue queue;
+
+    std::optional<CMemPool> pool_images;
+    std::optional<CMemPool> pool_code;
+    std::optional<CMemPool> pool_data;
+
+    CAsyncFileLoader loader;
+    CFileLoadRequest vertexRequest, indexRequest;
+
+    dk::UniqueCmdBuf cmdbuf;
+    dk::UniqueCmdBuf dyncmd;
+    CCmdMemRing<NumFramebuffers> dynmem;
+
+    CDescriptorSet<MaxImages> imageDescriptorSet;
+    CDescriptorSet<MaxSamplers> samplerDescriptorSet;
+
+    CShader hizShader;
+    CShader cullingShader;
+    CShader vertexShader;
+    CShader fragmentShader;
+
+    Transformation transformState;
+    CMemPool::Handle transformUniformBuffer;
+
+    Culling cullingState;
+    CMemPool::Handle cullingUniformBuffer;
+
+    Lighting lightingState;
+    CMemPool::Handle lightingUniformBuffer;
+
+    CMemPool::Handle vertexBuffer;
+    CMemPool::Handle indexBuffer;
+    CMemPool::Handle instanceBuffer;
+    CMemPool::Handle visibleBuffer;
+    CMemPool::Handle drawArgsBuffer;
+
+    // Occlusion culling tests against the depth of the previous frame, as seen by its camera
+    bool occlusionCulling;
+    bool hizValid;
+    glm::mat4 lastViewProj;
+
+    // One instance count per slice of the dynamic command memory ring, which is only read back once
+    // the GPU is done with the frame that wrote it
+    CMemPool::Handle visibleCountsBuffer;
+    unsigned statsSlot;
+    u64 statsFrames, statsVisible;
+    u64 lastReportNs;
+
+    uint32_t framebufferWidth;
+    uint32_t framebufferHeight;
+
+    CMemPool::Handle depthBuffer_mem;
+    CMemPool::Handle hizImage_mem;
+    CMemPool::Handle hizLevelsBuffer;
+    CMemPool::Handle framebuffers_mem[NumFramebuffers];
+
+    uint32_t hizWidth;
+    uint32_t hizHeight;
+    unsigned hizLevels;
+
+    dk::Image depthBuffer;
+    dk::Image hizImage;
+    dk::Image framebuffers[NumFramebuffers];
+    DkCmdList framebuffer_cmdlists[NumFramebuffers];
+    dk::UniqueSwapchain swapchain;
+
+    DkCmdList hiz_cmdlist, culling_cmdlist, render_cmdlist;
+
+public:
+    CExample10() : occlusionCulling{true}, hizValid{}, statsSlot{}, statsFrames{}, statsVisible{}, lastReportNs{}
+    {
+        // Create the deko3d device
+        device = dk::DeviceMaker{}.create();
+
+        // Create the main queue, with compute support
+        queue = dk::QueueMaker{device}.setFlags(DkQueueFlags_Graphics | DkQueueFlags_Compute).create();
+
+        // Create the memory pools. The data pool is in concurrent mode, since the file loader allocates from it
+        // on its own thread.
+        pool_images.emplace(device, DkMemBlockFlags_GpuCached | DkMemBlockFlags_Image, 32*1024*1024);
+        pool_code.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached | DkMemBlockFlags_Code, 128*1024);
+        pool_data.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached, 1*1024*1024, true);
+
+        // Start loading the teapot mesh on the I/O thread, while everything else is set up below
+        loader.start();
+        loader.submit(vertexRequest, *pool_data, "romfs:/teapot-vtx.bin", alignof(Vertex));
+        loader.submit(indexRequest, *pool_data, "romfs:/teapot-idx.bin", alignof(u16));
+
+        // Create the static command buffer and feed it freshly allocated memory
+        cmdbuf = dk::CmdBufMaker{device}.create();
+        CMemPool::Handle cmdmem = pool_data->allocate(StaticCmdSize);
+        cmdbuf.addMemory(cmdmem.getMemBlock(), cmdmem.getOffset(), cmdmem.getSize());
+
+        // Create the dynamic command buffer and allocate memory for it
+        dyncmd = dk::CmdBufMaker{device}.create();
+        dynmem.allocate(*pool_data, DynamicCmdSize);
+
+        // Create the image and sampler descriptor sets
+        imageDescriptorSet.allocate(*pool_data);
+        samplerDescriptorSet.allocate(*pool_data);
+
+        // Load the shaders
+        hizShader.load(*pool_code, "romfs:/shaders/hiz_downsample.dksh");
+        cullingShader.load(*pool_code, "romfs:/shaders/cull_instances.dksh");
+        vertexShader.load(*pool_code, "romfs:/shaders/instanced_normal_vsh.dksh");
+        fragmentShader.load(*pool_code, "romfs:/shaders/basic_lighting_fsh.dksh");
+
+        // Create the uniform buffers
+        transformUniformBuffer = pool_data->allocate(sizeof(transformState), DK_UNIFORM_BUF_ALIGNMENT);
+        cullingUniformBuffer = pool_data->allocate(sizeof(cullingState), DK_UNIFORM_BUF_ALIGNMENT);
+        lightingUniformBuffer = pool_data->allocate(sizeof(lightingState), DK_UNIFORM_BUF_ALIGNMENT);
+
+        // Initialize the lighting state
+        lightingState.lightPos = glm::vec4{0.0f, 4.0f, 1.0f, 1.0f};
+        lightingState.ambient = glm::vec3{0.046227f,0.028832f,0.003302f};
+        lightingState.diffuse = glm::vec3{0.564963f,0.367818f,0.051293f};
+        lightingState.specular = glm::vec4{24.0f*glm::vec3{0.394737f,0.308916f,0.134004f}, 64.0f};
+
+        // Initialize the culling state (the bounding sphere encloses the teapot mesh)
+        cullingState.meshSphere = glm::vec4{0.0f, 0.5f, 0.0f, 1.25f};
+        cullingState.numInstances = NumInstances;
+
+        // Create the instance buffer, placing the teapots in a grid with varying size and orientation
+        instanceBuffer = pool_data->allocate(NumInstances*sizeof(Instance), alignof(Instance));
+        Instance* instances = (Instance*)instanceBuffer.getCpuAddr();
+        for (unsigned i = 0; i < NumInstances; i ++)
+        {
+            float x = (float(i % GridSize) - GridSize/2.0f) * GridSpacing;
+            float z = (float(i / GridSize) - GridSize/2.0f) * GridSpacing;
+            float scale = 0.5f + 0.5f*fractf(i * 0.618034f);
+            float angle = fractf(i * 0.414214f) * glm::two_pi<float>();
+            instances[i].posScale = glm::vec4{x, 0.0f, z, scale};
+            instances[i].params = glm::vec4{angle, 0.0f, 0.0f, 0.0f};
+        }
+
+        // Create the buffer receiving the compacted list of visible instances
+        visibleBuffer = pool_data->allocate(NumInstances*sizeof(uint32_t), alignof(uint32_t));
+
+        // Create the buffer containing the parameters of the indirect draw call
+        drawArgsBuffer = pool_data->allocate(sizeof(DkDrawIndexedIndirectData), alignof(DkDrawIndexedIndirectData));
+
+        // Create the buffer receiving the number of instances drawn by each frame
+        visibleCountsBuffer = pool_data->allocate(NumFramebuffers*sizeof(uint32_t), alignof(uint32_t));
+        memset(visibleCountsBuffer.getCpuAddr(), 0, visibleCountsBuffer.getSize());
+
+        // Configure persistent state in the queue
+        {
+            // Bind the image and sampler descriptor sets
+            imageDescriptorSet.bindForImages(cmdbuf);
+            samplerDescriptorSet.bindForSamplers(cmdbuf);
+
+            // Upload the sampler descriptor (the depth pyramid is only read with texelFetch)
+            dk::Sampler sampler;
+            dk::SamplerDescriptor samplerDescriptor;
+            samplerDescriptor.initialize(sampler);
+            samplerDescriptorSet.update(cmdbuf, 0, samplerDescriptor);
+
+            // Submit the configuration commands to the queue
+            queue.submitCommands(cmdbuf.finishList());
+            queue.waitIdle();
+            cmdbuf.clear();
+        }
+
+        // The command lists bind the teapot mesh, so it has to be there by now
+        vertexRequest.wait();
+        indexRequest.wait();
+        vertexBuffer = vertexRequest.takeResult();
+        indexBuffer = indexRequest.takeResult();
+        loader.stop();
+    }
+
+    ~CExample10()
+    {
+        // Destroy the framebuffer resources
+        destroyFramebufferResources();
+
+        // Destroy the GPU-driven culling buffers (not strictly needed in this case)
+        visibleCountsBuffer.destroy();
+        drawArgsBuffer.destroy();
+        visibleBuffer.destroy();
+        instanceBuffer.destroy();
+
+        // Destroy the index buffer (not strictly needed in this case)
+        indexBuffer.destroy();
+
+        // Destroy the vertex buffer (not strictly needed in this case)
+        vertexBuffer.destroy();
+
+        // Destroy the uniform buffers (not strictly needed in this case)
+        lightingUniformBuffer.destroy();
+        cullingUniformBuffer.destroy();
+        transformUniformBuffer.destroy();
+    }
+
+    void createFramebufferResources()
+    {
+        // Create layout for the depth buffer
+        dk::ImageLayout layout_depthbuffer;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageRender | DkImageFlags_HwCompression)
+            .setFormat(DkImageFormat_Z24S8)
+            .setDimensions(framebufferWidth, framebufferHeight)
+            .initialize(layout_depthbuffer);
+
+        // Create the depth buffer
+        depthBuffer_mem = pool_images->allocate(layout_depthbuffer.getSize(), layout_depthbuffer.getAlignment());
+        depthBuffer.initialize(layout_depthbuffer, depthBuffer_mem.getMemBlock(), depthBuffer_mem.getOffset());
+
+        // Create layout for the depth pyramid, whose first level has half the size of the depth buffer
+        // (sizes are rounded down, the downsampling job takes care of the odd rows and columns)
+        hizWidth = framebufferWidth / 2;
+        hizHeight = framebufferHeight / 2;
+        hizLevels = 32 - __builtin_clz(hizWidth > hizHeight ? hizWidth : hizHeight);
+        if (hizLevels > MaxHiZLevels)
+            hizLevels = MaxHiZLevels;
+        dk::ImageLayout layout_hiz;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageLoadStore)
+            .setFormat(DkImageFormat_R32_Float)
+            .setDimensions(hizWidth, hizHeight)
+            .setMipLevels(hizLevels)
+            .initialize(layout_hiz);
+
+        // Create the depth pyramid
+        hizImage_mem = pool_images->allocate(layout_hiz.getSize(), layout_hiz.getAlignment());
+        hizImage.initialize(layout_hiz, hizImage_mem.getMemBlock(), hizImage_mem.getOffset());
+
+        // Fill in the sizes used by the downsampling job, one uniform buffer per level
+        hizLevelsBuffer = pool_data->allocate(hizLevels*HiZLevelStride, DK_UNIFORM_BUF_ALIGNMENT);
+        for (unsigned i = 0; i < hizLevels; i ++)
+        {
+            HiZLevel* level = (HiZLevel*)((u8*)hizLevelsBuffer.getCpuAddr() + i*HiZLevelStride);
+            level->srcSize[0] = i ? std::max(hizWidth >> (i-1), 1U) : framebufferWidth;
+            level->srcSize[1] = i ? std::max(hizHeight >> (i-1), 1U) : framebufferHeight;
+            level->dstSize[0] = std::max(hizWidth >> i, 1U);
+            level->dstSize[1] = std::max(hizHeight >> i, 1U);
+        }
+
+        // The pyramid holds nothing meaningful until a frame has been rendered
+        cullingState.hizParams = glm::vec4{ float(framebufferWidth), float(framebufferHeight), float(hizLevels), 0.0f };
+        hizValid = false;
+
+        // Create layout for the framebuffers
+        dk::ImageLayout layout_framebuffer;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageRender | DkImageFlags_UsagePresent | DkImageFlags_HwCompression)
+            .setFormat(DkImageFormat_RGBA8_Unorm_sRGB)
+            .setDimensions(framebufferWidth, framebufferHeight)
+            .initialize(layout_framebuffer);
+
+        // Create the framebuffers
+        std::array<DkImage const*, NumFramebuffers> fb_array;
+        uint64_t fb_size  = layout_framebuffer.getSize();
+        uint32_t fb_align = layout_framebuffer.getAlignment();
+        for (unsigned i = 0; i < NumFramebuffers; i ++)
+        {
+            // Allocate a framebuffer
+            framebuffers_mem[i] = pool_images->allocate(fb_size, fb_align);
+            framebuffers[i].initialize(layout_framebuffer, framebuffers_mem[i].getMemBlock(), framebuffers_mem[i].getOffset());
+
+            // Generate a command list that binds it, together with the depth buffer
+            dk::ImageView colorTarget { framebuffers[i] }, depthTarget { depthBuffer };
+            cmdbuf.bindRenderTargets(&colorTarget, &depthTarget);
+            framebuffer_cmdlists[i] = cmdbuf.finishList();
+
+            // Fill in the array for use later by the swapchain creation code
+            fb_array[i] = &framebuffers[i];
+        }
+
+        // Create the swapchain using the framebuffers
+        swapchain = dk::SwapchainMaker{device, nwindowGetDefault(), fb_array}.create();
+
+        // Generate the main command lists
+        recordStaticCommands();
+
+        // Initialize the projection matrix
+        transformState.projMtx = glm::perspectiveRH_ZO(
+            glm::radians(40.0f),
+            float(framebufferWidth)/float(framebufferHeight),
+            0.01f, 1000.0f);
+    }
+
+    void destroyFramebufferResources()
+    {
+        // Return early if we have nothing to destroy
+        if (!swapchain) return;
+
+        // Make sure the queue is idle before destroying anything
+        queue.waitIdle();
+
+        // Clear the static cmdbuf, destroying the static cmdlists in the process
+        cmdbuf.clear();
+
+        // Destroy the swapchain
+        swapchain.destroy();
+
+        // Destroy the framebuffers
+        for (unsigned i = 0; i < NumFramebuffers; i ++)
+            framebuffers_mem[i].destroy();
+
+        // Destroy the depth pyramid
+        hizLevelsBuffer.destroy();
+        hizImage_mem.destroy();
+
+        // Destroy the depth buffer
+        depthBuffer_mem.destroy();
+    }
+
+    void recordStaticCommands()
+    {
+        // Upload the image descriptors. They only change along with the framebuffer resources, so this is
+        // submitted once right away rather than every frame.
+        dk::ImageView depthView { depthBuffer }, hizView { hizImage };
+        dk::ImageDescriptor descriptor;
+        descriptor.initialize(depthView);
+        imageDescriptorSet.update(cmdbuf, DepthDescriptor, descriptor);
+        descriptor.initialize(hizView);
+        imageDescriptorSet.update(cmdbuf, HiZDescriptor, descriptor);
+        for (unsigned i = 0; i < hizLevels; i ++)
+        {
+            dk::ImageView levelView { hizImage };
+            levelView.setMipLevels(i, 1);
+            descriptor.initialize(levelView);
+            imageDescriptorSet.update(cmdbuf, HiZLevelTexDescriptors + i, descriptor);
+            descriptor.initialize(levelView, true);
+            imageDescriptorSet.update(cmdbuf, HiZLevelImgDescriptors + i, descriptor);
+        }
+        cmdbuf.barrier(DkBarrier_None, DkInvalidateFlags_Descriptors);
+        queue.submitCommands(cmdbuf.finishList());
+
+        // The depth pyramid is only built when occlusion culling is enabled, and once the depth buffer holds a
+        // frame. Make sure the previous frame is done drawing, since it writes the depth buffer the pyramid is
+        // built from, then flush the texture cache so that said depth buffer is seen.
+        cmdbuf.barrier(DkBarrier_Fragments, DkInvalidateFlags_Image);
+
+        // Build the depth pyramid, each level out of the one before it (the first one out of the depth buffer)
+        cmdbuf.bindShaders(DkStageFlag_Compute, { hizShader });
+        for (unsigned i = 0; i < hizLevels; i ++)
+        {
+            uint32_t width = std::max(hizWidth >> i, 1U), height = std::max(hizHeight >> i, 1U);
+            cmdbuf.bindUniformBuffer(DkStage_Compute, 0, hizLevelsBuffer.getGpuAddr() + i*HiZLevelStride, sizeof(HiZLevel));
+            cmdbuf.bindTextures(DkStage_Compute, 0, dkMakeTextureHandle(i ? HiZLevelTexDescriptors + i-1 : DepthDescriptor, 0));
+            cmdbuf.bindImages(DkStage_Compute, 0, dkMakeImageHandle(HiZLevelImgDescriptors + i));
+            cmdbuf.dispatchCompute((width + HiZGroupSize - 1) / HiZGroupSize, (height + HiZGroupSize - 1) / HiZGroupSize, 1);
+
+            // The next level (or the culling job) reads this one through the texture cache
+            cmdbuf.barrier(DkBarrier_Primitives, DkInvalidateFlags_Image);
+        }
+
+        // Finish off this command list
+        hiz_cmdlist = cmdbuf.finishList();
+
+        // Make sure the previous frame is done drawing, since it reads the list of visible instances about
+        // to be overwritten
+        cmdbuf.barrier(DkBarrier_Fragments, 0);
+
+        // Bind state required for running the culling job
+        cmdbuf.bindShaders(DkStageFlag_Compute, { cullingShader });
+        cmdbuf.bindUniformBuffer(DkStage_Compute, 0, cullingUniformBuffer.getGpuAddr(), cullingUniformBuffer.getSize());
+        cmdbuf.bindTextures(DkStage_Compute, 0, dkMakeTextureHandle(HiZDescriptor, 0));
+        cmdbuf.bindStorageBuffers(DkStage_Compute, 0, {
+            { instanceBuffer.getGpuAddr(), instanceBuffer.getSize() },
+            { visibleBuffer.getGpuAddr(), visibleBuffer.getSize() },
+            { drawArgsBuffer.getGpuAddr(), drawArgsBuffer.getSize() },
+        });
+
+        // Run the culling job
+        cmdbuf.dispatchCompute((NumInstances + CullingGroupSize - 1) / CullingGroupSize, 1, 1);
+
+        // Wait for the culling job to be completely done, since the parameters of the draw call are
+        // read by the command processor itself (as opposed to the shaders) when the draw is issued
+        cmdbuf.barrier(DkBarrier_Full, 0);
+
+        // Finish off this command list
+        culling_cmdlist = cmdbuf.finishList();
+
+        // Initialize state structs with deko3d defaults
+        dk::RasterizerState rasterizerState;
+        dk::ColorState colorState;
+        dk::ColorWriteState colorWriteState;
+        dk::DepthStencilState depthStencilState;
+
+        // Configure viewport and scissor
+        cmdbuf.setViewports(0, { { 0.0f, 0.0f, (float)framebufferWidth, (float)framebufferHeight, 0.0f, 1.0f } });
+        cmdbuf.setScissors(0, { { 0, 0, framebufferWidth, framebufferHeight } });
+
+        // Clear the color and depth buffers
+        cmdbuf.clearColor(0, DkColorMask_RGBA, 0.0f, 0.0f, 0.0f, 0.0f);
+        cmdbuf.clearDepthStencil(true, 1.0f, 0xFF, 0);
+
+        // Bind state required for drawing the instances
+        cmdbuf.bindShaders(DkStageFlag_GraphicsMask, { vertexShader, fragmentShader });
+        cmdbuf.bindUniformBuffer(DkStage_Vertex, 0, transformUniformBuffer.getGpuAddr(), transformUniformBuffer.getSize());
+        cmdbuf.bindUniformBuffer(DkStage_Fragment, 0, lightingUniformBuffer.getGpuAddr(), lightingUniformBuffer.getSize());
+        cmdbuf.bindStorageBuffers(DkStage_Vertex, 0, {
+            { instanceBuffer.getGpuAddr(), instanceBuffer.getSize() },
+            { visibleBuffer.getGpuAddr(), visibleBuffer.getSize() },
+        });
+        cmdbuf.bindRasterizerState(rasterizerState);
+        cmdbuf.bindColorState(colorState);
+        cmdbuf.bindColorWriteState(colorWriteState);
+        cmdbuf.bindDepthStencilState(depthStencilState);
+        cmdbuf.bindVtxBuffer(0, vertexBuffer.getGpuAddr(), vertexBuffer.getSize());
+        cmdbuf.bindVtxAttribState(VertexAttribState);
+        cmdbuf.bindVtxBufferState(VertexBufferState);
+        cmdbuf.bindIdxBuffer(DkIdxFormat_Uint16, indexBuffer.getGpuAddr());
+
+        // Draw all visible instances with a single indirect draw call
+        cmdbuf.drawIndexedIndirect(DkPrimitive_Triangles, drawArgsBuffer.getGpuAddr());
+
+        // Note: the depth buffer is not discarded, as the next frame builds its depth pyramid out of it
+
+        // Finish off this command list
+        render_cmdlist = cmdbuf.finishList();
+    }
+
+    void readStats(uint32_t visible, u64 ns)
+    {
+        // Slots not written yet are skipped
+        if (visible)
+        {
+            statsFrames ++;
+            statsVisible += visible;
+        }
+
+        if (ns - lastReportNs < 1000000000UL)
+            return;
+
+        if (statsFrames)
+            printf("[cull] %lu/%u instances drawn per frame, occlusion culling %s\n",
+                statsVisible / statsFrames, NumInstances, occlusionCulling ? "on" : "off");
+
+        statsFrames = statsVisible = 0;
+        lastReportNs = ns;
+    }
+
+    void render(u64 ns, bool testOcclusion)
+    {
+        // Begin generating the dynamic command list, for commands that need to be sent only this frame specifically.
+        // This waits for the frame that last used this slice of command memory, which also wrote the matching count.
+        dynmem.begin(dyncmd);
+        uint32_t* visibleCounts = (uint32_t*)visibleCountsBuffer.getCpuAddr();
+        readStats(visibleCounts[statsSlot], ns);
+
+        // Update the uniform buffers with the new state (this data gets inlined in the command list)
+        dyncmd.pushConstants(
+            transformUniformBuffer.getGpuAddr(), transformUniformBuffer.getSize(),
+            0, sizeof(transformState), &transformState);
+        dyncmd.pushConstants(
+            cullingUniformBuffer.getGpuAddr(), cullingUniformBuffer.getSize(),
+            0, sizeof(cullingState), &cullingState);
+        dyncmd.pushConstants(
+            lightingUniformBuffer.getGpuAddr(), lightingUniformBuffer.getSize(),
+            0, sizeof(lightingState), &lightingState);
+
+        // Reset the parameters of the draw call; the culling job fills in the instance count
+        DkDrawIndexedIndirectData drawArgs = {};
+        drawArgs.indexCount = indexBuffer.getSize() / sizeof(u16);
+        dyncmd.pushData(drawArgsBuffer.getGpuAddr(), &drawArgs, sizeof(drawArgs));
+
+        // Submit the dynamic commands so far
+        queue.submitCommands(dyncmd.finishList());
+
+        // Build the depth pyramid out of the previous frame's depth buffer, if the culling job tests against it
+        if (testOcclusion)
+            queue.submitCommands(hiz_cmdlist);
+
+        // Run the culling command list
+        queue.submitCommands(culling_cmdlist);
+
+        // Acquire a framebuffer from the swapchain
+        int slot = queue.acquireImage(swapchain);
+
+        // Submit the command list that binds the framebuffer
+        queue.submitCommands(framebuffer_cmdlists[slot]);
+
+        // Run the main rendering command list
+        queue.submitCommands(render_cmdlist);
+
+        // Keep the number of instances drawn, then finish off the dynamic command list, so that the fence
+        // signaled at its end covers the copy. The barrier makes the next frame's reset of the draw
+        // parameters wait for the copy.
+        dyncmd.copyBuffer(drawArgsBuffer.getGpuAddr() + offsetof(DkDrawIndexedIndirectData, instanceCount),
+            visibleCountsBuffer.getGpuAddr() + statsSlot*sizeof(uint32_t), sizeof(uint32_t));
+        dyncmd.barrier(DkBarrier_Full, 0);
+        queue.submitCommands(dynmem.end(dyncmd));
+
+        // Now that we are done rendering, present it to the screen (this also flushes the queue)
+        queue.presentImage(swapchain, slot);
+
+        statsSlot = (statsSlot + 1) % NumFramebuffers;
+    }
+
+    void onOperationMode(AppletOperationMode mode) override
+    {
+        // Destroy the framebuffer resources
+        destroyFramebufferResources();
+
+        // Choose framebuffer size
+        chooseFramebufferSize(framebufferWidth, framebufferHeight, mode);
+
+        // Recreate the framebuffers and its associated resources
+        createFramebufferResources();
+    }
+
+    bool onFrame(u64 ns) override
+    {
+        hidScanInput();
+        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+        if (kDown & KEY_PLUS)
+            return false;
+        if (kDown & KEY_A)
+        {
+            // Drop the counts gathered with the previous setting
+            occlusionCulling = !occlusionCulling;
+            statsFrames = statsVisible = 0;
+        }
+
+        float time = ns / 1000000000.0; // double precision division; followed by implicit cast to single precision
+        float tau = glm::two_pi<float>();
+
+        float period = fractf(time/32.0f);
+
+        // Fly the camera in a circle over the grid, looking slightly down and towards the center
+        float radius = GridSize*GridSpacing*0.375f;
+        glm::vec3 eye { radius*cosf(period*tau), 6.0f, radius*sinf(period*tau) };
+        glm::vec3 target { 0.0f, 0.0f, 0.0f };
+        transformState.viewMtx = glm::lookAtRH(eye, target, glm::vec3{0.0f, 1.0f, 0.0f});
+
+        // Calculate the frustum planes used by the culling job
+        glm::mat4 viewProj = transformState.projMtx * transformState.viewMtx;
+        extractFrustumPlanes(cullingState.planes, viewProj);
+
+        // Test against the depth pyramid once the previous frame's depth is there, with the camera it was rendered with
+        cullingState.prevViewProj = lastViewProj;
+        bool testOcclusion = occlusionCulling && hizValid;
+        cullingState.hizParams.w = testOcclusion ? 1.0f : 0.0f;
+
+        render(ns, testOcclusion);
+        lastViewProj = viewProj;
+        hizValid = true;
+        return true;
+    }
+};
+
+void Example10(void)
+{
+    CExample10 app;
+    app.run();
+}
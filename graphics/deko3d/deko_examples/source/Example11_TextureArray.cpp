@@ -0,0 +1,512 @@
+/*
+** deko3d Example 11: Texture Arrays (Batching Materials)
+** This example shows how to draw many objects using different textures with a single draw call.
+** New concepts in this example:
+** - Packing several same-format images into the layers of an array texture
+** - Sourcing per-instance vertex attributes from a vertex buffer (divisor)
+** - Selecting the texture layer per instance instead of rebinding textures between draws
+** - Allocating descriptor slots from growable heaps (CDescriptorHeap) rather than fixed sets
+**
+** Press A to toggle between a single instanced draw and one draw call per object, in order
+** to compare the command processing overhead of both approaches.
+**
+** The texture used in this example was borrowed from https://pixabay.com/photos/cat-animal-pet-cats-close-up-300572/
+*/
+
+// Sample Framework headers
+#include "SampleFramework/CApplication.h"
+#include "SampleFramework/CMemPool.h"
+#include "SampleFramework/CShader.h"
+#include "SampleFramework/CCmdMemRing.h"
+#include "SampleFramework/CDescriptorHeap.h"
+#include "SampleFramework/CImageUploadBatch.h"
+#include "SampleFramework/CTextureArray.h"
+
+// C++ standard library headers
+#include <array>
+#include <optional>
+#include <vector>
+
+// GLM headers
+#define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES // Enforces GLSL std140/std430 alignment rules for glm types
+#define GLM_FORCE_INTRINSICS               // Enables usage of SIMD CPU instructions (requiring the above as well)
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace
+{
+    struct Vertex
+    {
+        float position[3];
+        float texcoord[2];
+    };
+
+    struct Instance
+    {
+        float posScale[4]; // xyz is position, w is scale
+        float params[4];   // x is the rotation phase, y is the texture layer
+    };
+
+    constexpr std::array VertexAttribState =
+    {
+        DkVtxAttribState{ 0, 0, offsetof(Vertex, position),   DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
+        DkVtxAttribState{ 0, 0, offsetof(Vertex, texcoord),   DkVtxAttribSize_2x32, DkVtxAttribType_Float, 0 },
+        DkVtxAttribState{ 1, 0, offsetof(Instance, posScale), DkVtxAttribSize_4x32, DkVtxAttribType_Float, 0 },
+        DkVtxAttribState{ 1, 0, offsetof(Instance, params),   DkVtxAttribSize_4x32, DkVtxAttribType_Float, 0 },
+    };
+
+    constexpr std::array VertexBufferState =
+    {
+        DkVtxBufferState{ sizeof(Vertex), 0 },
+        DkVtxBufferState{ sizeof(Instance), 1 }, // advances once per instance
+    };
+
+    constexpr std::array CubeVertexData =
+    {
+        // +X face
+        Vertex{ { +1.0f, +1.0f, +1.0f }, { 0.0f, 0.0f } },
+        Vertex{ { +1.0f, -1.0f, +1.0f }, { 0.0f, 1.0f } },
+        Vertex{ { +1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f } },
+        Vertex{ { +1.0f, +1.0f, -1.0f }, { 1.0f, 0.0f } },
+
+        // -X face
+        Vertex{ { -1.0f, +1.0f, -1.0f }, { 0.0f, 0.0f } },
+        Vertex{ { -1.0f, -1.0f, -1.0f }, { 0.0f, 1.0f } },
+        Vertex{ { -1.0f, -1.0f, +1.0f }, { 1.0f, 1.0f } },
+        Vertex{ { -1.0f, +1.0f, +1.0f }, { 1.0f, 0.0f } },
+
+        // +Y face
+        Vertex{ { -1.0f, +1.0f, -1.0f }, { 0.0f, 0.0f } },
+        Vertex{ { -1.0f, +1.0f, +1.0f }, { 0.0f, 1.0f } },
+        Vertex{ { +1.0f, +1.0f, +1.0f }, { 1.0f, 1.0f } },
+        Vertex{ { +1.0f, +1.0f, -1.0f }, { 1.0f, 0.0f } },
+
+        // -Y face
+        Vertex{ { -1.0f, -1.0f, +1.0f }, { 0.0f, 0.0f } },
+        Vertex{ { -1.0f, -1.0f, -1.0f }, { 0.0f, 1.0f } },
+        Vertex{ { +1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f } },
+        Vertex{ { +1.0f, -1.0f, +1.0f }, { 1.0f, 0.0f } },
+
+        // +Z face
+        Vertex{ { -1.0f, +1.0f, +1.0f }, { 0.0f, 0.0f } },
+        Vertex{ { -1.0f, -1.0f, +1.0f }, { 0.0f, 1.0f } },
+        Vertex{ { +1.0f, -1.0f, +1.0f }, { 1.0f, 1.0f } },
+        Vertex{ { +1.0f, +1.0f, +1.0f }, { 1.0f, 0.0f } },
+
+        // -Z face
+        Vertex{ { +1.0f, +1.0f, -1.0f }, { 0.0f, 0.0f } },
+        Vertex{ { +1.0f, -1.0f, -1.0f }, { 0.0f, 1.0f } },
+        Vertex{ { -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f } },
+        Vertex{ { -1.0f, +1.0f, -1.0f }, { 1.0f, 0.0f } },
+    };
+
+    struct Transformation
+    {
+        glm::mat4 viewMtx;
+        glm::mat4 projMtx;
+        glm::vec4 time;
+    };
+
+    constexpr unsigned GridSize = 16;
+    constexpr unsigned NumInstances = GridSize*GridSize;
+    constexpr unsigned TextureSize = 256;
+    constexpr unsigned NumLayers = 8;
+
+    inline uint16_t rgb565(unsigned r, unsigned g, unsigned b)
+    {
+        return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    }
+
+    // Generates a BC1 checkerboard made out of solid color 4x4 blocks
+    void GenerateCheckerboard(std::vector<uint8_t>& data, unsigned seed)
+    {
+        const uint16_t colors[2] =
+        {
+            rgb565(64 + 32*(seed & 1), 64 + 32*((seed >> 1) & 1), 64 + 32*((seed >> 2) & 1)),
+            rgb565(255*(seed & 1), 255*((seed >> 1) & 1), 255*((seed >> 2) & 1)),
+        };
+
+        constexpr unsigned NumBlocks = TextureSize/4;
+        const unsigned checkerShift = seed & 1 ? 2 : 3; // in blocks
+        data.resize(NumBlocks*NumBlocks*8);
+        for (unsigned y = 0; y < NumBlocks; y ++)
+        {
+            for (unsigned x = 0; x < NumBlocks; x ++)
+            {
+                uint16_t color = colors[((x >> checkerShift) ^ (y >> checkerShift)) & 1];
+                uint8_t* block = &data[(y*NumBlocks + x)*8];
+                memcpy(&block[0], &color, 2); // color0
+                memcpy(&block[2], &color, 2); // color1
+                memset(&block[4], 0, 4);      // all texels use color0
+            }
+        }
+    }
+
+    inline float fractf(float x)
+    {
+        return x - floorf(x);
+    }
+}
+
+class CExample11 final : public CApplication
+{
+    static constexpr unsigned NumFramebuffers = 2;
+    static constexpr unsigned StaticCmdSize = 0x10000;
+    static constexpr unsigned DynamicCmdSize = 0x10000;
+    static constexpr unsigned InitialDescriptors = 16;
+
+    dk::UniqueDevice device;
+    dk::UniqueQueue queue;
+
+    std::optional<CMemPool> pool_images;
+    std::optional<CMemPool> pool_code;
+    std::optional<CMemPool> pool_data;
+
+    dk::UniqueCmdBuf cmdbuf;
+    dk::UniqueCmdBuf dyncmd;
+    CCmdMemRing<NumFramebuffers> dynmem;
+
+    CDescriptorHeap imageDescriptorHeap;
+    CDescriptorHeap samplerDescriptorHeap;
+    uint32_t texArrayDescriptor;
+    uint32_t samplerDescriptor;
+
+    CShader vertexShader;
+    CShader fragmentShader;
+
+    Transformation transformState;
+    CMemPool::Handle transformUniformBuffer;
+
+    CMemPool::Handle vertexBuffer;
+    CMemPool::Handle instanceBuffer;
+    CTextureArray texArray;
+
+    uint32_t framebufferWidth;
+    uint32_t framebufferHeight;
+
+    CMemPool::Handle depthBuffer_mem;
+    CMemPool::Handle framebuffers_mem[NumFramebuffers];
+
+    dk::Image depthBuffer;
+    dk::Image framebuffers[NumFramebuffers];
+    DkCmdList framebuffer_cmdlists[NumFramebuffers];
+    dk::UniqueSwapchain swapchain;
+
+    DkCmdList render_cmdlists[2];
+    bool batched;
+
+public:
+    CExample11() : texArrayDescriptor{}, samplerDescriptor{}, batched{true}
+    {
+        // Create the deko3d device
+        device = dk::DeviceMaker{}.create();
+
+        // Create the main queue
+        queue = dk::QueueMaker{device}.setFlags(DkQueueFlags_Graphics).create();
+
+        // Create the memory pools
+        pool_images.emplace(device, DkMemBlockFlags_GpuCached | DkMemBlockFlags_Image, 16*1024*1024);
+        pool_code.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached | DkMemBlockFlags_Code, 128*1024);
+        pool_data.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached, 1*1024*1024);
+
+        // Create the static command buffer and feed it freshly allocated memory
+        cmdbuf = dk::CmdBufMaker{device}.create();
+        CMemPool::Handle cmdmem = pool_data->allocate(StaticCmdSize);
+        cmdbuf.addMemory(cmdmem.getMemBlock(), cmdmem.getOffset(), cmdmem.getSize());
+
+        // Create the dynamic command buffer and allocate memory for it
+        dyncmd = dk::CmdBufMaker{device}.create();
+        dynmem.allocate(*pool_data, DynamicCmdSize);
+
+        // Create the image and sampler descriptor heaps (they grow if more slots are needed)
+        imageDescriptorHeap.allocate(*pool_data, InitialDescriptors);
+        samplerDescriptorHeap.allocate(*pool_data, InitialDescriptors);
+
+        // Load the shaders
+        vertexShader.load(*pool_code, "romfs:/shaders/instanced_texarray_vsh.dksh");
+        fragmentShader.load(*pool_code, "romfs:/shaders/texture_array_fsh.dksh");
+
+        // Create the transformation uniform buffer
+        transformUniformBuffer = pool_data->allocate(sizeof(transformState), DK_UNIFORM_BUF_ALIGNMENT);
+
+        // Load the vertex buffer
+        vertexBuffer = pool_data->allocate(sizeof(CubeVertexData), alignof(Vertex));
+        memcpy(vertexBuffer.getCpuAddr(), CubeVertexData.data(), vertexBuffer.getSize());
+
+        // Generate the instance buffer: a grid of cubes, each one using one of the layers ("materials")
+        instanceBuffer = pool_data->allocate(NumInstances*sizeof(Instance), alignof(Instance));
+        Instance* instances = (Instance*)instanceBuffer.getCpuAddr();
+        for (unsigned i = 0; i < NumInstances; i ++)
+        {
+            float x = (float(i % GridSize) - 0.5f*(GridSize-1)) * 1.25f;
+            float z = (float(i / GridSize) - 0.5f*(GridSize-1)) * 1.25f;
+            instances[i] = Instance{
+                { x, 0.0f, z, 0.5f },
+                { float(i) * 0.37f, float((i * 5) % NumLayers), 0.0f, 0.0f },
+            };
+        }
+
+        // Create the texture array and fill in its layers
+        {
+            CImageUploadBatch batch;
+            batch.init(*pool_data, device, queue);
+            texArray.create(*pool_images, device, TextureSize, TextureSize, DkImageFormat_RGB_BC1, NumLayers);
+
+            // The first layer comes from the filesystem, the rest are generated procedurally
+            texArray.addLayer(batch, "romfs:/cat-256x256.bc1");
+            std::vector<uint8_t> layerData;
+            for (unsigned i = 1; i < NumLayers; i ++)
+            {
+                GenerateCheckerboard(layerData, i);
+                texArray.addLayer(batch, layerData.data(), layerData.size());
+            }
+
+            batch.finish();
+        }
+
+        // Configure persistent state in the queue
+        {
+            // Add the image descriptor: all layers are reachable through a single descriptor
+            texArrayDescriptor = imageDescriptorHeap.add(texArray.getDescriptor());
+
+            // Configure a sampler
+            dk::Sampler sampler;
+            sampler.setFilter(DkFilter_Linear, DkFilter_Linear);
+            sampler.setWrapMode(DkWrapMode_ClampToEdge, DkWrapMode_ClampToEdge, DkWrapMode_ClampToEdge);
+
+            // Add the sampler descriptor
+            dk::SamplerDescriptor descriptor;
+            descriptor.initialize(sampler);
+            samplerDescriptor = samplerDescriptorHeap.add(descriptor);
+
+            // Upload the descriptors added above, and bind the heaps
+            imageDescriptorHeap.flush(cmdbuf);
+            samplerDescriptorHeap.flush(cmdbuf);
+            imageDescriptorHeap.bindForImages(cmdbuf);
+            samplerDescriptorHeap.bindForSamplers(cmdbuf);
+
+            // Submit the configuration commands to the queue
+            queue.submitCommands(cmdbuf.finishList());
+            queue.waitIdle();
+            cmdbuf.clear();
+        }
+
+        printf("Texture array: %u layers, %u instances\n", texArray.getNumUsedLayers(), NumInstances);
+        printf("Press A to toggle batching\n");
+    }
+
+    ~CExample11()
+    {
+        // Destroy the framebuffer resources
+        destroyFramebufferResources();
+
+        // Destroy the vertex and instance buffers (not strictly needed in this case)
+        instanceBuffer.destroy();
+        vertexBuffer.destroy();
+
+        // Destroy the uniform buffer (not strictly needed in this case)
+        transformUniformBuffer.destroy();
+    }
+
+    void createFramebufferResources()
+    {
+        // Create layout for the depth buffer
+        dk::ImageLayout layout_depthbuffer;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageRender | DkImageFlags_HwCompression)
+            .setFormat(DkImageFormat_Z24S8)
+            .setDimensions(framebufferWidth, framebufferHeight)
+            .initialize(layout_depthbuffer);
+
+        // Create the depth buffer
+        depthBuffer_mem = pool_images->allocate(layout_depthbuffer.getSize(), layout_depthbuffer.getAlignment());
+        depthBuffer.initialize(layout_depthbuffer, depthBuffer_mem.getMemBlock(), depthBuffer_mem.getOffset());
+
+        // Create layout for the framebuffers
+        dk::ImageLayout layout_framebuffer;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageRender | DkImageFlags_UsagePresent | DkImageFlags_HwCompression)
+            .setFormat(DkImageFormat_RGBA8_Unorm)
+            .setDimensions(framebufferWidth, framebufferHeight)
+            .initialize(layout_framebuffer);
+
+        // Create the framebuffers
+        std::array<DkImage const*, NumFramebuffers> fb_array;
+        uint64_t fb_size  = layout_framebuffer.getSize();
+        uint32_t fb_align = layout_framebuffer.getAlignment();
+        for (unsigned i = 0; i < NumFramebuffers; i ++)
+        {
+            // Allocate a framebuffer
+            framebuffers_mem[i] = pool_images->allocate(fb_size, fb_align);
+            framebuffers[i].initialize(layout_framebuffer, framebuffers_mem[i].getMemBlock(), framebuffers_mem[i].getOffset());
+
+            // Generate a command list that binds it
+            dk::ImageView colorTarget{ framebuffers[i] }, depthTarget { depthBuffer };
+            cmdbuf.bindRenderTargets(&colorTarget, &depthTarget);
+            framebuffer_cmdlists[i] = cmdbuf.finishList();
+
+            // Fill in the array for use later by the swapchain creation code
+            fb_array[i] = &framebuffers[i];
+        }
+
+        // Create the swapchain using the framebuffers
+        swapchain = dk::SwapchainMaker{device, nwindowGetDefault(), fb_array}.create();
+
+        // Generate the main rendering cmdlist
+        recordStaticCommands();
+
+        // Initialize the projection matrix
+        transformState.projMtx = glm::perspectiveRH_ZO(
+            glm::radians(40.0f),
+            float(framebufferWidth)/float(framebufferHeight),
+            0.01f, 1000.0f);
+
+        // Initialize the view matrix, looking down at the grid
+        transformState.viewMtx = glm::lookAt(glm::vec3{0.0f, 9.0f, 14.0f}, glm::vec3{0.0f, 0.0f, 1.0f}, glm::vec3{0.0f, 1.0f, 0.0f});
+    }
+
+    void destroyFramebufferResources()
+    {
+        // Return early if we have nothing to destroy
+        if (!swapchain) return;
+
+        // Make sure the queue is idle before destroying anything
+        queue.waitIdle();
+
+        // Clear the static cmdbuf, destroying the static cmdlists in the process
+        cmdbuf.clear();
+
+        // Destroy the swapchain
+        swapchain.destroy();
+
+        // Destroy the framebuffers
+        for (unsigned i = 0; i < NumFramebuffers; i ++)
+            framebuffers_mem[i].destroy();
+
+        // Destroy the depth buffer
+        depthBuffer_mem.destroy();
+    }
+
+    void recordStaticCommands()
+    {
+        // Initialize state structs with deko3d defaults
+        dk::RasterizerState rasterizerState;
+        dk::ColorState colorState;
+        dk::ColorWriteState colorWriteState;
+        dk::DepthStencilState depthStencilState;
+
+        // Record two versions of the rendering cmdlist: unbatched and batched
+        for (unsigned i = 0; i < 2; i ++)
+        {
+            // Configure viewport and scissor
+            cmdbuf.setViewports(0, { { 0.0f, 0.0f, (float)framebufferWidth, (float)framebufferHeight, 0.0f, 1.0f } });
+            cmdbuf.setScissors(0, { { 0, 0, framebufferWidth, framebufferHeight } });
+
+            // Clear the color and depth buffers
+            cmdbuf.clearColor(0, DkColorMask_RGBA, 0.0f, 0.0f, 0.0f, 0.0f);
+            cmdbuf.clearDepthStencil(true, 1.0f, 0xFF, 0);
+
+            // Bind state required for drawing the cubes
+            cmdbuf.bindShaders(DkStageFlag_GraphicsMask, { vertexShader, fragmentShader });
+            cmdbuf.bindUniformBuffer(DkStage_Vertex, 0, transformUniformBuffer.getGpuAddr(), transformUniformBuffer.getSize());
+            cmdbuf.bindTextures(DkStage_Fragment, 0, dkMakeTextureHandle(texArrayDescriptor, samplerDescriptor));
+            cmdbuf.bindRasterizerState(rasterizerState);
+            cmdbuf.bindColorState(colorState);
+            cmdbuf.bindColorWriteState(colorWriteState);
+            cmdbuf.bindDepthStencilState(depthStencilState);
+            cmdbuf.bindVtxBuffer(0, vertexBuffer.getGpuAddr(), vertexBuffer.getSize());
+            cmdbuf.bindVtxBuffer(1, instanceBuffer.getGpuAddr(), instanceBuffer.getSize());
+            cmdbuf.bindVtxAttribState(VertexAttribState);
+            cmdbuf.bindVtxBufferState(VertexBufferState);
+
+            if (i)
+            {
+                // Draw all cubes at once: the layer is selected by the per-instance attributes,
+                // so no state needs to change between objects using different materials
+                cmdbuf.draw(DkPrimitive_Quads, CubeVertexData.size(), NumInstances, 0, 0);
+            }
+            else
+            {
+                // Draw each cube separately (still fetching its data through firstInstance),
+                // which is what rendering with one texture binding per object boils down to
+                for (unsigned j = 0; j < NumInstances; j ++)
+                    cmdbuf.draw(DkPrimitive_Quads, CubeVertexData.size(), 1, 0, j);
+            }
+
+            // Fragment barrier, to make sure we finish previous work before discarding the depth buffer
+            cmdbuf.barrier(DkBarrier_Fragments, 0);
+
+            // Discard the depth buffer since we don't need it anymore
+            cmdbuf.discardDepthStencil();
+
+            // Finish off this command list
+            render_cmdlists[i] = cmdbuf.finishList();
+        }
+    }
+
+    void render()
+    {
+        // Begin generating the dynamic command list, for commands that need to be sent only this frame specifically
+        dynmem.begin(dyncmd);
+
+        // Update the uniform buffer with the new transformation state (this data gets inlined in the command list)
+        dyncmd.pushConstants(
+            transformUniformBuffer.getGpuAddr(), transformUniformBuffer.getSize(),
+            0, sizeof(transformState), &transformState);
+
+        // Finish off the dynamic command list (which also submits it to the queue)
+        queue.submitCommands(dynmem.end(dyncmd));
+
+        // Acquire a framebuffer from the swapchain (and wait for it to be available)
+        int slot = queue.acquireImage(swapchain);
+
+        // Run the command list that attaches said framebuffer to the queue
+        queue.submitCommands(framebuffer_cmdlists[slot]);
+
+        // Run the main rendering command list
+        queue.submitCommands(render_cmdlists[batched ? 1 : 0]);
+
+        // Now that we are done rendering, present it to the screen
+        queue.presentImage(swapchain, slot);
+    }
+
+    void onOperationMode(AppletOperationMode mode) override
+    {
+        // Destroy the framebuffer resources
+        destroyFramebufferResources();
+
+        // Choose framebuffer size
+        chooseFramebufferSize(framebufferWidth, framebufferHeight, mode);
+
+        // Recreate the framebuffers and its associated resources
+        createFramebufferResources();
+    }
+
+    bool onFrame(u64 ns) override
+    {
+        hidScanInput();
+        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+        if (kDown & KEY_PLUS)
+            return false;
+
+        if (kDown & KEY_A)
+        {
+            batched = !batched;
+            printf("%s\n", batched ? "Batched: 1 draw call" : "Unbatched: 1 draw call per cube");
+        }
+
+        float time = ns / 1000000000.0; // double precision division; followed by implicit cast to single precision
+        transformState.time = glm::vec4{fractf(time/4.0f) * glm::two_pi<float>(), 0.0f, 0.0f, 0.0f};
+
+        render();
+        return true;
+    }
+};
+
+void Example11(void)
+{
+    CExample11 app;
+    app.run();
+}
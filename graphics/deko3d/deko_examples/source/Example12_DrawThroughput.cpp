@@ -0,0 +1,371 @@
+/*
+** deko3d Example 12: Draw Call Throughput
+** This example measures the CPU cost of submitting many small draw calls.
+** New concepts in this example:
+** - Streaming a large amount of commands, by splitting them into batches that are
+**   recorded into and submitted from a ring of command memory slices
+** - Measuring CPU submission time
+**
+** N small triangles are drawn with one draw call each, switching the bound fragment shader
+** every K draws. The example sweeps N from 100 to 100000 and K over 1, 10, 100 and never,
+** then prints a table with the CPU time per frame spent recording and submitting the draws,
+** and the resulting number of draws per second. graphics/opengl/draw_throughput runs the
+** exact same sweep through OpenGL, so that the two tables can be compared directly.
+**
+** Press A to restart the sweep.
+*/
+
+// Sample Framework headers
+#include "SampleFramework/CApplication.h"
+#include "SampleFramework/CMemPool.h"
+#include "SampleFramework/CShader.h"
+#include "SampleFramework/CCmdMemRing.h"
+
+// C++ standard library headers
+#include <array>
+#include <optional>
+
+namespace
+{
+    struct Vertex
+    {
+        float position[3];
+        float color[3];
+    };
+
+    constexpr std::array VertexAttribState =
+    {
+        DkVtxAttribState{ 0, 0, offsetof(Vertex, position), DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
+        DkVtxAttribState{ 0, 0, offsetof(Vertex, color),    DkVtxAttribSize_3x32, DkVtxAttribType_Float, 0 },
+    };
+
+    constexpr std::array VertexBufferState =
+    {
+        DkVtxBufferState{ sizeof(Vertex), 0 },
+    };
+
+    // The sweep, which must match the one in graphics/opengl/draw_throughput
+    constexpr std::array DrawCounts = { 100u, 1000u, 10000u, 100000u };
+    constexpr std::array StateChangeIntervals = { 1u, 10u, 100u, 0u }; // 0: never
+    constexpr unsigned MaxDraws = 100000;
+    constexpr unsigned GridColumns = 400, GridRows = MaxDraws / GridColumns;
+    constexpr unsigned WarmupFrames = 30;
+    constexpr unsigned MeasureFrames = 120;
+}
+
+class CExample12 final : public CApplication
+{
+    static constexpr unsigned NumFramebuffers = 2;
+    static constexpr uint32_t FramebufferWidth = 1280;
+    static constexpr uint32_t FramebufferHeight = 720;
+    static constexpr unsigned StaticCmdSize = 0x10000;
+
+    // Draws are recorded in batches, each of which gets its own slice of command memory.
+    // The slice size is generous: a draw takes a few words, a shader bind a few dozen.
+    // The ring only holds a fraction of a frame at the larger draw counts, so recording has to
+    // wait for the GPU to retire older batches; that time is measured separately from the CPU cost.
+    static constexpr unsigned DrawsPerBatch = 1024;
+    static constexpr unsigned NumBatchSlices = 8;
+    static constexpr unsigned BatchCmdSize = DrawsPerBatch*256;
+
+    static constexpr unsigned NumConfigs = DrawCounts.size()*StateChangeIntervals.size();
+
+    struct SweepResult
+    {
+        u64 cpuNs;
+        u64 waitNs;
+        u64 frameNs;
+    };
+
+    dk::UniqueDevice device;
+    dk::UniqueQueue queue;
+
+    std::optional<CMemPool> pool_images;
+    std::optional<CMemPool> pool_code;
+    std::optional<CMemPool> pool_data;
+
+    dk::UniqueCmdBuf cmdbuf;
+    dk::UniqueCmdBuf dyncmd;
+    CCmdMemRing<NumBatchSlices> dynmem;
+
+    CShader vertexShader;
+    CShader fragmentShaders[2];
+
+    CMemPool::Handle vertexBuffer;
+
+    CMemPool::Handle framebuffers_mem[NumFramebuffers];
+    dk::Image framebuffers[NumFramebuffers];
+    DkCmdList framebuffer_cmdlists[NumFramebuffers];
+    dk::UniqueSwapchain swapchain;
+
+    DkCmdList render_cmdlist;
+
+    SweepResult results[NumConfigs];
+    unsigned curConfig;
+    unsigned curFrame;
+    u64 lastFrameNs;
+    bool sweeping;
+
+public:
+    CExample12() : results{}, curConfig{}, curFrame{}, lastFrameNs{}, sweeping{}
+    {
+        // Create the deko3d device
+        device = dk::DeviceMaker{}.create();
+
+        // Create the main queue
+        queue = dk::QueueMaker{device}.setFlags(DkQueueFlags_Graphics).create();
+
+        // Create the memory pools
+        pool_images.emplace(device, DkMemBlockFlags_GpuCached | DkMemBlockFlags_Image, 16*1024*1024);
+        pool_code.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached | DkMemBlockFlags_Code, 128*1024);
+        pool_data.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached, 16*1024*1024);
+
+        // Create the static command buffer and feed it freshly allocated memory
+        cmdbuf = dk::CmdBufMaker{device}.create();
+        CMemPool::Handle cmdmem = pool_data->allocate(StaticCmdSize);
+        cmdbuf.addMemory(cmdmem.getMemBlock(), cmdmem.getOffset(), cmdmem.getSize());
+
+        // Create the dynamic command buffer and allocate memory for the batches
+        dyncmd = dk::CmdBufMaker{device}.create();
+        dynmem.allocate(*pool_data, BatchCmdSize);
+
+        // Load the shaders. The state change consists in switching between two fragment shaders.
+        vertexShader.load(*pool_code, "romfs:/shaders/basic_vsh.dksh");
+        fragmentShaders[0].load(*pool_code, "romfs:/shaders/color_fsh.dksh");
+        fragmentShaders[1].load(*pool_code, "romfs:/shaders/color_swizzle_fsh.dksh");
+
+        // Create the vertex buffer: a grid of small triangles, one per draw call
+        vertexBuffer = pool_data->allocate(3*MaxDraws*sizeof(Vertex), alignof(Vertex));
+        Vertex* vertices = (Vertex*)vertexBuffer.getCpuAddr();
+        for (unsigned i = 0; i < MaxDraws; i ++)
+        {
+            float cellW = 2.0f / GridColumns, cellH = 2.0f / GridRows;
+            float x = -1.0f + (i % GridColumns) * cellW;
+            float y = +1.0f - (i / GridColumns) * cellH;
+            float t = float(i) / MaxDraws;
+            *vertices++ = Vertex{ { x,             y - cellH, 0.0f }, { 1.0f, t, 0.0f } };
+            *vertices++ = Vertex{ { x + cellW,     y - cellH, 0.0f }, { 0.0f, 1.0f, t } };
+            *vertices++ = Vertex{ { x + cellW/2.0f, y,        0.0f }, { t, 0.0f, 1.0f } };
+        }
+
+        // Create the framebuffer resources
+        createFramebufferResources();
+
+        startSweep();
+    }
+
+    ~CExample12()
+    {
+        // Destroy the framebuffer resources
+        destroyFramebufferResources();
+
+        // Destroy the vertex buffer (not strictly needed in this case)
+        vertexBuffer.destroy();
+    }
+
+    void createFramebufferResources()
+    {
+        // Create layout for the framebuffers
+        dk::ImageLayout layout_framebuffer;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageRender | DkImageFlags_UsagePresent | DkImageFlags_HwCompression)
+            .setFormat(DkImageFormat_RGBA8_Unorm)
+            .setDimensions(FramebufferWidth, FramebufferHeight)
+            .initialize(layout_framebuffer);
+
+        // Create the framebuffers
+        std::array<DkImage const*, NumFramebuffers> fb_array;
+        uint64_t fb_size  = layout_framebuffer.getSize();
+        uint32_t fb_align = layout_framebuffer.getAlignment();
+        for (unsigned i = 0; i < NumFramebuffers; i ++)
+        {
+            // Allocate a framebuffer
+            framebuffers_mem[i] = pool_images->allocate(fb_size, fb_align);
+            framebuffers[i].initialize(layout_framebuffer, framebuffers_mem[i].getMemBlock(), framebuffers_mem[i].getOffset());
+
+            // Generate a command list that binds it
+            dk::ImageView colorTarget{ framebuffers[i] };
+            cmdbuf.bindRenderTargets(&colorTarget);
+            framebuffer_cmdlists[i] = cmdbuf.finishList();
+
+            // Fill in the array for use later by the swapchain creation code
+            fb_array[i] = &framebuffers[i];
+        }
+
+        // Create the swapchain using the framebuffers
+        swapchain = dk::SwapchainMaker{device, nwindowGetDefault(), fb_array}.create();
+
+        // Generate the main rendering cmdlist
+        recordStaticCommands();
+    }
+
+    void destroyFramebufferResources()
+    {
+        // Return early if we have nothing to destroy
+        if (!swapchain) return;
+
+        // Make sure the queue is idle before destroying anything
+        queue.waitIdle();
+
+        // Clear the static cmdbuf, destroying the static cmdlists in the process
+        cmdbuf.clear();
+
+        // Destroy the swapchain
+        swapchain.destroy();
+
+        // Destroy the framebuffers
+        for (unsigned i = 0; i < NumFramebuffers; i ++)
+            framebuffers_mem[i].destroy();
+    }
+
+    void recordStaticCommands()
+    {
+        // Initialize state structs with deko3d defaults
+        dk::RasterizerState rasterizerState;
+        dk::ColorState colorState;
+        dk::ColorWriteState colorWriteState;
+
+        // Configure viewport and scissor
+        cmdbuf.setViewports(0, { { 0.0f, 0.0f, FramebufferWidth, FramebufferHeight, 0.0f, 1.0f } });
+        cmdbuf.setScissors(0, { { 0, 0, FramebufferWidth, FramebufferHeight } });
+
+        // Clear the color buffer
+        cmdbuf.clearColor(0, DkColorMask_RGBA, 0.0f, 0.0f, 0.0f, 0.0f);
+
+        // Bind the state shared by all draws
+        cmdbuf.bindShaders(DkStageFlag_GraphicsMask, { vertexShader, fragmentShaders[0] });
+        cmdbuf.bindRasterizerState(rasterizerState);
+        cmdbuf.bindColorState(colorState);
+        cmdbuf.bindColorWriteState(colorWriteState);
+        cmdbuf.bindVtxBuffer(0, vertexBuffer.getGpuAddr(), vertexBuffer.getSize());
+        cmdbuf.bindVtxAttribState(VertexAttribState);
+        cmdbuf.bindVtxBufferState(VertexBufferState);
+
+        // Finish off this command list
+        render_cmdlist = cmdbuf.finishList();
+    }
+
+    void startSweep()
+    {
+        memset(results, 0, sizeof(results));
+        curConfig = 0;
+        curFrame = 0;
+        sweeping = true;
+        printf("Draw throughput sweep: %u configurations, %u frames each\n", NumConfigs, MeasureFrames);
+    }
+
+    static constexpr unsigned getNumDraws(unsigned config) { return DrawCounts[config / StateChangeIntervals.size()]; }
+    static constexpr unsigned getStateInterval(unsigned config) { return StateChangeIntervals[config % StateChangeIntervals.size()]; }
+
+    void printResults() const
+    {
+        printf("[draws] %8s %8s %12s %14s %10s %10s\n", "N", "K", "cpu ms", "draws/s", "wait ms", "frame ms");
+        for (unsigned i = 0; i < NumConfigs; i ++)
+        {
+            double cpuMs = results[i].cpuNs / (1000000.0 * MeasureFrames);
+            double waitMs = results[i].waitNs / (1000000.0 * MeasureFrames);
+            double frameMs = results[i].frameNs / (1000000.0 * MeasureFrames);
+            char interval[16];
+            if (getStateInterval(i))
+                snprintf(interval, sizeof(interval), "%u", getStateInterval(i));
+            else
+                snprintf(interval, sizeof(interval), "never");
+            printf("[draws] %8u %8s %12.3f %14.0f %10.2f %10.2f\n", getNumDraws(i), interval,
+                cpuMs, getNumDraws(i) / (cpuMs / 1000.0), waitMs, frameMs);
+        }
+    }
+
+    // Records and submits the draws, returning the CPU time spent doing so.
+    // The time spent waiting for a free slice of command memory is excluded, and returned in waitNs.
+    u64 submitDraws(unsigned numDraws, unsigned stateInterval, u64& waitNs)
+    {
+        u64 startTick = armGetSystemTick();
+        u64 waitTicks = 0;
+        unsigned curShader = 0;
+        for (unsigned first = 0; first < numDraws; first += DrawsPerBatch)
+        {
+            unsigned last = first + DrawsPerBatch < numDraws ? first + DrawsPerBatch : numDraws;
+
+            u64 waitTick = armGetSystemTick();
+            dynmem.begin(dyncmd);
+            waitTicks += armGetSystemTick() - waitTick;
+            for (unsigned i = first; i < last; i ++)
+            {
+                if (stateInterval && i && (i % stateInterval) == 0)
+                {
+                    curShader ^= 1;
+                    dyncmd.bindShaders(DkStageFlag_GraphicsMask, { vertexShader, fragmentShaders[curShader] });
+                }
+                dyncmd.draw(DkPrimitive_Triangles, 3, 1, 3*i, 0);
+            }
+
+            queue.submitCommands(dynmem.end(dyncmd));
+        }
+        waitNs = armTicksToNs(waitTicks);
+        return armTicksToNs(armGetSystemTick() - startTick - waitTicks);
+    }
+
+    void render(u64 ns)
+    {
+        unsigned config = sweeping ? curConfig : NumConfigs-1;
+
+        // Acquire a framebuffer from the swapchain (and wait for it to be available)
+        int slot = queue.acquireImage(swapchain);
+
+        // Run the command list that attaches said framebuffer to the queue
+        queue.submitCommands(framebuffer_cmdlists[slot]);
+
+        // Run the command list that clears the screen and sets up the state
+        queue.submitCommands(render_cmdlist);
+
+        // Record and submit the draws
+        u64 waitNs;
+        u64 cpuNs = submitDraws(getNumDraws(config), getStateInterval(config), waitNs);
+
+        // Now that we are done rendering, present it to the screen
+        queue.presentImage(swapchain, slot);
+
+        // Accumulate the measurements, and move on to the next configuration when done
+        u64 frameNs = ns - lastFrameNs;
+        lastFrameNs = ns;
+        if (!sweeping)
+            return;
+
+        if (curFrame >= WarmupFrames)
+        {
+            results[curConfig].cpuNs += cpuNs;
+            results[curConfig].waitNs += waitNs;
+            results[curConfig].frameNs += frameNs;
+        }
+
+        if (++curFrame < WarmupFrames + MeasureFrames)
+            return;
+
+        curFrame = 0;
+        if (++curConfig < NumConfigs)
+            return;
+
+        sweeping = false;
+        printResults();
+    }
+
+    bool onFrame(u64 ns) override
+    {
+        hidScanInput();
+        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+        if (kDown & KEY_PLUS)
+            return false;
+
+        if (kDown & KEY_A)
+            startSweep();
+
+        render(ns);
+        return true;
+    }
+};
+
+void Example12(void)
+{
+    CExample12 app;
+    app.run();
+}
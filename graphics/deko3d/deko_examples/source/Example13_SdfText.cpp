@@ -0,0 +1,720 @@
+/*
+** deko3d Example 13: Signed Distance Field Text (Shared Font)
+** This example shows how to draw resolution independent text out of a single small glyph atlas.
+** New concepts in this example:
+** - Loading the system shared font, and turning its glyphs into signed distance fields
+** - Storing non-color data (distances) in a single channel texture
+** - Generating quads in the vertex shader out of gl_VertexID, with no per-vertex buffer
+** - Streaming per-instance data through a per-frame arena, so that whole strings
+**   (of any length and at any size) are drawn with a single draw call
+**
+** Every glyph is rendered once at load time, and the distance to its outline is stored in the
+** atlas instead of its coverage. Since distances interpolate linearly, the outline can then be
+** reconstructed by the fragment shader at any scale, with antialiasing that stays one pixel wide.
+*/
+
+// Sample Framework headers
+#include "SampleFramework/CApplication.h"
+#include "SampleFramework/CMemPool.h"
+#include "SampleFramework/CShader.h"
+#include "SampleFramework/CCmdMemRing.h"
+#include "SampleFramework/CDescriptorSet.h"
+#include "SampleFramework/CImageUploadBatch.h"
+#include "SampleFramework/CTextureArray.h"
+#include "SampleFramework/CFrameArena.h"
+
+// C++ standard library headers
+#include <array>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include <cmath>
+
+// FreeType headers
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace
+{
+    struct GlyphInstance
+    {
+        float rect[4];  // screen space rectangle (x0, y0, x1, y1), in pixels
+        float uv[4];    // atlas rectangle (u0, v0, u1, v1)
+        float color[4];
+    };
+
+    constexpr std::array VertexAttribState =
+    {
+        DkVtxAttribState{ 0, 0, offsetof(GlyphInstance, rect),  DkVtxAttribSize_4x32, DkVtxAttribType_Float, 0 },
+        DkVtxAttribState{ 0, 0, offsetof(GlyphInstance, uv),    DkVtxAttribSize_4x32, DkVtxAttribType_Float, 0 },
+        DkVtxAttribState{ 0, 0, offsetof(GlyphInstance, color), DkVtxAttribSize_4x32, DkVtxAttribType_Float, 0 },
+    };
+
+    constexpr std::array VertexBufferState =
+    {
+        DkVtxBufferState{ sizeof(GlyphInstance), 1 }, // advances once per instance
+    };
+
+    struct Viewport
+    {
+        float scale[4]; // xy: pixels to NDC scale factors, zw: unused
+    };
+
+    // The glyphs are baked at this size (in pixels per em), with distances stored up to Spread texels away
+    // from the outline. The spread also limits how far the quads extend outside of the glyph's bitmap.
+    constexpr unsigned BakeSize = 48;
+    constexpr unsigned Spread = 6;
+    constexpr unsigned AtlasSize = 1024;
+    constexpr unsigned MaxGlyphInstances = 4096;
+    constexpr float Far = 1e20f;
+
+    struct Glyph
+    {
+        float uv[4];      // atlas rectangle
+        float plane[4];   // left and top offsets from the pen position, then width and height; in ems
+        float advance;    // in ems
+        FT_UInt index;
+    };
+
+    struct Line
+    {
+        const char* text;
+        float size;       // in pixels per em
+        float color[4];
+    };
+
+    constexpr std::array Lines =
+    {
+        Line{ "deko3d: signed distance field text",              64.0f, { 1.0f, 1.0f, 1.0f, 1.0f } },
+        Line{ "One atlas baked at 48 px, drawn at any size.",    32.0f, { 0.8f, 0.9f, 1.0f, 1.0f } },
+        Line{ "12 px: The quick brown fox jumps over the lazy dog.", 12.0f, { 1.0f, 1.0f, 0.6f, 1.0f } },
+        Line{ "16 px: The quick brown fox jumps over the lazy dog.", 16.0f, { 1.0f, 1.0f, 0.6f, 1.0f } },
+        Line{ "24 px: The quick brown fox jumps over the lazy dog.", 24.0f, { 1.0f, 1.0f, 0.6f, 1.0f } },
+        Line{ "Ünïcödé: àéîõü ÀÉÎÕÜ ñ ç ß",                      40.0f, { 0.6f, 1.0f, 0.7f, 1.0f } },
+        Line{ "128 px",                                          128.0f, { 1.0f, 0.5f, 0.4f, 1.0f } },
+    };
+
+    constexpr const char* ZoomText = "Zoom!";
+
+    // Decodes one UTF-8 sequence, returning the number of bytes it takes (0 at the end of the string)
+    unsigned DecodeUtf8(const char* str, uint32_t& codepoint)
+    {
+        const uint8_t* s = (const uint8_t*)str;
+        if (!s[0])
+            return 0;
+        if (s[0] < 0x80)
+        {
+            codepoint = s[0];
+            return 1;
+        }
+
+        unsigned len = (s[0] & 0xE0) == 0xC0 ? 2 : (s[0] & 0xF0) == 0xE0 ? 3 : (s[0] & 0xF8) == 0xF0 ? 4 : 1;
+        codepoint = len == 1 ? '?' : s[0] & (0x7F >> len);
+        for (unsigned i = 1; i < len; i ++)
+        {
+            if ((s[i] & 0xC0) != 0x80)
+            {
+                codepoint = '?';
+                return i;
+            }
+            codepoint = (codepoint << 6) | (s[i] & 0x3F);
+        }
+        return len;
+    }
+
+    // One dimensional squared euclidean distance transform (Felzenszwalb & Huttenlocher),
+    // operating in place on count values placed stride elements apart
+    void EdtPass(float* data, unsigned count, unsigned stride, std::vector<float>& f, std::vector<float>& z, std::vector<unsigned>& v)
+    {
+        for (unsigned i = 0; i < count; i ++)
+            f[i] = data[i*stride];
+
+        unsigned k = 0;
+        v[0] = 0;
+        z[0] = -INFINITY;
+        z[1] = +INFINITY;
+        for (unsigned q = 1; q < count; q ++)
+        {
+            // Find where the parabola rooted at q intersects the lower envelope, dropping
+            // the parabolas it hides completely
+            float s;
+            for (;;)
+            {
+                unsigned r = v[k];
+                s = ((f[q] + float(q*q)) - (f[r] + float(r*r))) / (2.0f*q - 2.0f*r);
+                if (s > z[k] || k == 0)
+                    break;
+                k --;
+            }
+
+            k ++;
+            v[k] = q;
+            z[k] = s;
+            z[k+1] = +INFINITY;
+        }
+
+        k = 0;
+        for (unsigned q = 0; q < count; q ++)
+        {
+            while (z[k+1] < q)
+                k ++;
+            float d = float(q) - float(v[k]);
+            data[q*stride] = d*d + f[v[k]];
+        }
+    }
+
+    // Computes the squared distance of every texel to the nearest texel where the grid is zero.
+    // Texels away from the outline are set to a large finite value rather than infinity, since
+    // the intersection of two infinitely high parabolas is undefined.
+    void Edt(std::vector<float>& grid, unsigned width, unsigned height)
+    {
+        unsigned maxDim = width > height ? width : height;
+        std::vector<float> f(maxDim), z(maxDim+1);
+        std::vector<unsigned> v(maxDim);
+
+        for (unsigned x = 0; x < width; x ++)
+            EdtPass(&grid[x], height, width, f, z, v);
+        for (unsigned y = 0; y < height; y ++)
+            EdtPass(&grid[y*width], width, 1, f, z, v);
+    }
+}
+
+class CExample13 final : public CApplication
+{
+    static constexpr unsigned NumFramebuffers = 2;
+    static constexpr unsigned StaticCmdSize = 0x10000;
+    static constexpr unsigned DynamicCmdSize = 0x10000;
+    static constexpr unsigned MaxImages = 1;
+    static constexpr unsigned MaxSamplers = 1;
+
+    dk::UniqueDevice device;
+    dk::UniqueQueue queue;
+
+    std::optional<CMemPool> pool_images;
+    std::optional<CMemPool> pool_code;
+    std::optional<CMemPool> pool_data;
+
+    dk::UniqueCmdBuf cmdbuf;
+    dk::UniqueCmdBuf dyncmd;
+    CCmdMemRing<NumFramebuffers> dynmem;
+    CFrameArena<NumFramebuffers> instanceArena;
+
+    CDescriptorSet<MaxImages> imageDescriptorSet;
+    CDescriptorSet<MaxSamplers> samplerDescriptorSet;
+
+    CShader vertexShader;
+    CShader fragmentShader;
+
+    Viewport viewportState;
+    CMemPool::Handle viewportUniformBuffer;
+
+    CTextureArray atlas;
+    std::unordered_map<uint32_t, Glyph> glyphs;
+    bool hasKerning;
+    float kerningScale;
+    std::vector<int16_t> kerning; // per glyph index pair of the charset, in font units
+    std::unordered_map<FT_UInt, unsigned> kerningIds;
+    std::vector<GlyphInstance> instances;
+
+    uint32_t framebufferWidth;
+    uint32_t framebufferHeight;
+
+    CMemPool::Handle framebuffers_mem[NumFramebuffers];
+
+    dk::Image framebuffers[NumFramebuffers];
+    DkCmdList framebuffer_cmdlists[NumFramebuffers];
+    dk::UniqueSwapchain swapchain;
+
+    DkCmdList render_cmdlist;
+    float zoomTime;
+
+public:
+    CExample13() : hasKerning{}, kerningScale{}, zoomTime{}
+    {
+        // Create the deko3d device
+        device = dk::DeviceMaker{}.create();
+
+        // Create the main queue
+        queue = dk::QueueMaker{device}.setFlags(DkQueueFlags_Graphics).create();
+
+        // Create the memory pools
+        pool_images.emplace(device, DkMemBlockFlags_GpuCached | DkMemBlockFlags_Image, 16*1024*1024);
+        pool_code.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached | DkMemBlockFlags_Code, 128*1024);
+        pool_data.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached, 4*1024*1024);
+
+        // Create the static command buffer and feed it freshly allocated memory
+        cmdbuf = dk::CmdBufMaker{device}.create();
+        CMemPool::Handle cmdmem = pool_data->allocate(StaticCmdSize);
+        cmdbuf.addMemory(cmdmem.getMemBlock(), cmdmem.getOffset(), cmdmem.getSize());
+
+        // Create the dynamic command buffer and allocate memory for it
+        dyncmd = dk::CmdBufMaker{device}.create();
+        dynmem.allocate(*pool_data, DynamicCmdSize);
+
+        // Allocate the per-frame instance data arena
+        instanceArena.allocate(*pool_data, MaxGlyphInstances*sizeof(GlyphInstance));
+        instances.reserve(MaxGlyphInstances);
+
+        // Create the image and sampler descriptor sets
+        imageDescriptorSet.allocate(*pool_data);
+        samplerDescriptorSet.allocate(*pool_data);
+
+        // Load the shaders
+        vertexShader.load(*pool_code, "romfs:/shaders/sdf_text_vsh.dksh");
+        fragmentShader.load(*pool_code, "romfs:/shaders/sdf_text_fsh.dksh");
+
+        // Create the viewport uniform buffer
+        viewportUniformBuffer = pool_data->allocate(sizeof(viewportState), DK_UNIFORM_BUF_ALIGNMENT);
+
+        // Bake the glyph atlas out of the shared font
+        if (!bakeAtlas())
+            return;
+
+        // Configure persistent state in the queue
+        {
+            // Upload the image descriptor
+            imageDescriptorSet.update(cmdbuf, 0, atlas.getDescriptor());
+
+            // Configure a sampler: the distances need to be interpolated bilinearly
+            dk::Sampler sampler;
+            sampler.setFilter(DkFilter_Linear, DkFilter_Linear);
+            sampler.setWrapMode(DkWrapMode_ClampToEdge, DkWrapMode_ClampToEdge, DkWrapMode_ClampToEdge);
+
+            // Upload the sampler descriptor
+            dk::SamplerDescriptor samplerDescriptor;
+            samplerDescriptor.initialize(sampler);
+            samplerDescriptorSet.update(cmdbuf, 0, samplerDescriptor);
+
+            // Bind the image and sampler descriptor sets
+            imageDescriptorSet.bindForImages(cmdbuf);
+            samplerDescriptorSet.bindForSamplers(cmdbuf);
+
+            // Submit the configuration commands to the queue
+            queue.submitCommands(cmdbuf.finishList());
+            queue.waitIdle();
+            cmdbuf.clear();
+        }
+    }
+
+    ~CExample13()
+    {
+        // Destroy the framebuffer resources
+        destroyFramebufferResources();
+
+        // Destroy the uniform buffer (not strictly needed in this case)
+        viewportUniformBuffer.destroy();
+    }
+
+    bool bakeAtlas()
+    {
+        Result rc = plInitialize(PlServiceType_User);
+        if (R_FAILED(rc))
+        {
+            printf("plInitialize() failed: 0x%x\n", rc);
+            return false;
+        }
+
+        // The font data is only needed until the atlas is baked, after which the service can be closed
+        PlFontData font;
+        rc = plGetSharedFontByType(&font, PlSharedFontType_Standard);
+        if (R_FAILED(rc))
+        {
+            printf("plGetSharedFontByType() failed: 0x%x\n", rc);
+            plExit();
+            return false;
+        }
+
+        FT_Library library;
+        FT_Face face;
+        FT_Error ret = FT_Init_FreeType(&library);
+        if (ret)
+        {
+            printf("FT_Init_FreeType() failed: %d\n", ret);
+            plExit();
+            return false;
+        }
+
+        ret = FT_New_Memory_Face(library, (const FT_Byte*)font.address, font.size, 0, &face);
+        if (ret == 0)
+            ret = FT_Set_Pixel_Sizes(face, 0, BakeSize);
+        if (ret)
+        {
+            printf("FT_New_Memory_Face() failed: %d\n", ret);
+            FT_Done_FreeType(library);
+            plExit();
+            return false;
+        }
+
+        // The charset is printable ASCII, plus anything else used by the strings we draw
+        std::vector<uint32_t> charset;
+        for (uint32_t c = 0x20; c < 0x7F; c ++)
+            charset.push_back(c);
+        for (auto& line : Lines)
+        {
+            uint32_t codepoint;
+            for (const char* p = line.text; unsigned len = DecodeUtf8(p, codepoint); p += len)
+                if (codepoint >= 0x80)
+                    charset.push_back(codepoint);
+        }
+
+        std::vector<uint8_t> atlasData(AtlasSize*AtlasSize);
+        std::vector<float> inside, outside;
+        unsigned shelfX = 0, shelfY = 0, shelfHeight = 0;
+        for (uint32_t codepoint : charset)
+        {
+            if (glyphs.count(codepoint))
+                continue;
+
+            FT_UInt index = FT_Get_Char_Index(face, codepoint);
+            if (FT_Load_Glyph(face, index, FT_LOAD_RENDER))
+                continue;
+
+            FT_GlyphSlot slot = face->glyph;
+            FT_Bitmap* bitmap = &slot->bitmap;
+            Glyph& glyph = glyphs[codepoint];
+            glyph = Glyph{};
+            glyph.advance = float(slot->advance.x) / (64.0f*BakeSize);
+            glyph.index = index;
+
+            // Blank glyphs (such as spaces) only need their advance
+            if (bitmap->pixel_mode != FT_PIXEL_MODE_GRAY || !bitmap->width || !bitmap->rows)
+                continue;
+
+            // Find room in the atlas, leaving space for the spread all around the bitmap
+            unsigned width = bitmap->width + 2*Spread, height = bitmap->rows + 2*Spread;
+            if (shelfX + width > AtlasSize)
+            {
+                shelfX = 0;
+                shelfY += shelfHeight;
+                shelfHeight = 0;
+            }
+            if (shelfY + height > AtlasSize)
+            {
+                printf("Glyph atlas is full, U+%04X and later glyphs are missing\n", codepoint);
+                glyphs.erase(codepoint);
+                break;
+            }
+
+            // Threshold the coverage into inside/outside, and compute the distance to the nearest
+            // texel of the other kind for each of them
+            inside.assign(width*height, Far);
+            outside.assign(width*height, 0.0f);
+            for (unsigned y = 0; y < bitmap->rows; y ++)
+            {
+                const uint8_t* row = &bitmap->buffer[y*bitmap->pitch];
+                for (unsigned x = 0; x < bitmap->width; x ++)
+                {
+                    if (row[x] < 128)
+                        continue;
+                    unsigned i = (y+Spread)*width + x+Spread;
+                    inside[i] = 0.0f;
+                    outside[i] = Far;
+                }
+            }
+            Edt(inside, width, height);
+            Edt(outside, width, height);
+
+            // Map the signed distance (positive inside) from [-Spread, +Spread] to [0, 1], centered on 0.5
+            for (unsigned y = 0; y < height; y ++)
+            {
+                uint8_t* dst = &atlasData[(shelfY+y)*AtlasSize + shelfX];
+                for (unsigned x = 0; x < width; x ++)
+                {
+                    unsigned i = y*width + x;
+                    float dist = sqrtf(outside[i]) - sqrtf(inside[i]);
+                    float value = 0.5f + dist / (2.0f*Spread);
+                    dst[x] = uint8_t(value <= 0.0f ? 0 : value >= 1.0f ? 255 : lrintf(value*255.0f));
+                }
+            }
+
+            glyph.uv[0] = float(shelfX) / AtlasSize;
+            glyph.uv[1] = float(shelfY) / AtlasSize;
+            glyph.uv[2] = float(shelfX + width) / AtlasSize;
+            glyph.uv[3] = float(shelfY + height) / AtlasSize;
+            glyph.plane[0] = float(slot->bitmap_left - int(Spread)) / BakeSize;
+            glyph.plane[1] = float(slot->bitmap_top + int(Spread)) / BakeSize;
+            glyph.plane[2] = float(width) / BakeSize;
+            glyph.plane[3] = float(height) / BakeSize;
+
+            shelfX += width;
+            if (height > shelfHeight)
+                shelfHeight = height;
+        }
+
+        // Kerning is looked up when laying out every frame, so precompute it for all pairs of the charset
+        hasKerning = FT_HAS_KERNING(face);
+        if (hasKerning)
+        {
+            for (auto& [codepoint, glyph] : glyphs)
+                kerningIds.emplace(glyph.index, kerningIds.size());
+
+            unsigned numIds = kerningIds.size();
+            kerning.assign(numIds*numIds, 0);
+            for (auto& [left, leftId] : kerningIds)
+            {
+                for (auto& [right, rightId] : kerningIds)
+                {
+                    FT_Vector delta = { 0, 0 };
+                    FT_Get_Kerning(face, left, right, FT_KERNING_UNSCALED, &delta);
+                    kerning[leftId*numIds + rightId] = int16_t(delta.x);
+                }
+            }
+
+            // Unscaled kerning is in font units, which get converted to ems when laying out
+            kerningScale = 1.0f / face->units_per_EM;
+        }
+
+        printf("Baked %u glyphs into a %ux%u atlas (%u%% used)\n", (unsigned)glyphs.size(), AtlasSize, AtlasSize,
+            (shelfY + shelfHeight) * 100 / AtlasSize);
+
+        FT_Done_Face(face);
+        FT_Done_FreeType(library);
+        plExit();
+
+        // Upload the atlas as the single layer of an array texture
+        CImageUploadBatch batch;
+        batch.init(*pool_data, device, queue);
+        atlas.create(*pool_images, device, AtlasSize, AtlasSize, DkImageFormat_R8_Unorm, 1);
+        atlas.addLayer(batch, atlasData.data(), atlasData.size());
+        batch.finish();
+        return true;
+    }
+
+    float getKerning(FT_UInt left, FT_UInt right)
+    {
+        if (!hasKerning || !left)
+            return 0.0f;
+
+        auto l = kerningIds.find(left), r = kerningIds.find(right);
+        if (l == kerningIds.end() || r == kerningIds.end())
+            return 0.0f;
+        return kerning[l->second*kerningIds.size() + r->second] * kerningScale;
+    }
+
+    // Appends one instance per visible glyph of the string, with its baseline starting at (x, y)
+    void layoutText(const char* text, float x, float y, float size, const float color[4])
+    {
+        FT_UInt prevIndex = 0;
+        uint32_t codepoint;
+        for (const char* p = text; unsigned len = DecodeUtf8(p, codepoint); p += len)
+        {
+            auto it = glyphs.find(codepoint);
+            if (it == glyphs.end())
+                it = glyphs.find('?');
+            if (it == glyphs.end())
+                continue;
+
+            const Glyph& glyph = it->second;
+            x += getKerning(prevIndex, glyph.index) * size;
+            prevIndex = glyph.index;
+
+            if (glyph.plane[2] > 0.0f && instances.size() < MaxGlyphInstances)
+            {
+                float x0 = x + glyph.plane[0]*size;
+                float y0 = y - glyph.plane[1]*size;
+                instances.push_back(GlyphInstance{
+                    { x0, y0, x0 + glyph.plane[2]*size, y0 + glyph.plane[3]*size },
+                    { glyph.uv[0], glyph.uv[1], glyph.uv[2], glyph.uv[3] },
+                    { color[0], color[1], color[2], color[3] },
+                });
+            }
+
+            x += glyph.advance*size;
+        }
+    }
+
+    void createFramebufferResources()
+    {
+        // Create layout for the framebuffers
+        dk::ImageLayout layout_framebuffer;
+        dk::ImageLayoutMaker{device}
+            .setFlags(DkImageFlags_UsageRender | DkImageFlags_UsagePresent | DkImageFlags_HwCompression)
+            .setFormat(DkImageFormat_RGBA8_Unorm)
+            .setDimensions(framebufferWidth, framebufferHeight)
+            .initialize(layout_framebuffer);
+
+        // Create the framebuffers
+        std::array<DkImage const*, NumFramebuffers> fb_array;
+        uint64_t fb_size  = layout_framebuffer.getSize();
+        uint32_t fb_align = layout_framebuffer.getAlignment();
+        for (unsigned i = 0; i < NumFramebuffers; i ++)
+        {
+            // Allocate a framebuffer
+            framebuffers_mem[i] = pool_images->allocate(fb_size, fb_align);
+            framebuffers[i].initialize(layout_framebuffer, framebuffers_mem[i].getMemBlock(), framebuffers_mem[i].getOffset());
+
+            // Generate a command list that binds it
+            dk::ImageView colorTarget{ framebuffers[i] };
+            cmdbuf.bindRenderTargets(&colorTarget);
+            framebuffer_cmdlists[i] = cmdbuf.finishList();
+
+            // Fill in the array for use later by the swapchain creation code
+            fb_array[i] = &framebuffers[i];
+        }
+
+        // Create the swapchain using the framebuffers
+        swapchain = dk::SwapchainMaker{device, nwindowGetDefault(), fb_array}.create();
+
+        // Generate the main rendering cmdlist
+        recordStaticCommands();
+
+        // Text is laid out in pixels, with the origin in the upper left corner
+        viewportState.scale[0] = 2.0f / framebufferWidth;
+        viewportState.scale[1] = 2.0f / framebufferHeight;
+        viewportState.scale[2] = 0.0f;
+        viewportState.scale[3] = 0.0f;
+    }
+
+    void destroyFramebufferResources()
+    {
+        // Return early if we have nothing to destroy
+        if (!swapchain) return;
+
+        // Make sure the queue is idle before destroying anything
+        queue.waitIdle();
+
+        // Clear the static cmdbuf, destroying the static cmdlists in the process
+        cmdbuf.clear();
+
+        // Destroy the swapchain
+        swapchain.destroy();
+
+        // Destroy the framebuffers
+        for (unsigned i = 0; i < NumFramebuffers; i ++)
+            framebuffers_mem[i].destroy();
+    }
+
+    void recordStaticCommands()
+    {
+        // Initialize state structs with deko3d defaults
+        dk::RasterizerState rasterizerState;
+        dk::ColorState colorState;
+        dk::ColorWriteState colorWriteState;
+        dk::BlendState blendState;
+
+        // The quads are built in screen space, so there is no point in culling them
+        rasterizerState.setCullMode(DkFace_None);
+
+        // Configure color state: enable blending, since the glyph edges are antialiased through their alpha values
+        colorState.setBlendEnable(0, true);
+
+        // Configure viewport and scissor
+        cmdbuf.setViewports(0, { { 0.0f, 0.0f, (float)framebufferWidth, (float)framebufferHeight, 0.0f, 1.0f } });
+        cmdbuf.setScissors(0, { { 0, 0, framebufferWidth, framebufferHeight } });
+
+        // Clear the color buffer
+        cmdbuf.clearColor(0, DkColorMask_RGBA, 0.1f, 0.1f, 0.15f, 1.0f);
+
+        // Bind state required for drawing the text. The instance buffer itself changes every frame,
+        // so it is bound by the dynamic command list instead.
+        cmdbuf.bindShaders(DkStageFlag_GraphicsMask, { vertexShader, fragmentShader });
+        cmdbuf.bindUniformBuffer(DkStage_Vertex, 0, viewportUniformBuffer.getGpuAddr(), viewportUniformBuffer.getSize());
+        cmdbuf.bindTextures(DkStage_Fragment, 0, dkMakeTextureHandle(0, 0));
+        cmdbuf.bindRasterizerState(rasterizerState);
+        cmdbuf.bindColorState(colorState);
+        cmdbuf.bindColorWriteState(colorWriteState);
+        cmdbuf.bindBlendStates(0, blendState);
+        cmdbuf.bindVtxAttribState(VertexAttribState);
+        cmdbuf.bindVtxBufferState(VertexBufferState);
+
+        // Finish off this command list
+        render_cmdlist = cmdbuf.finishList();
+    }
+
+    void layoutFrame()
+    {
+        instances.clear();
+
+        float y = 16.0f;
+        for (auto& line : Lines)
+        {
+            y += line.size * 1.15f;
+            layoutText(line.text, 32.0f, y, line.size, line.color);
+        }
+
+        // A string continuously zooming between 8 and 256 pixels per em, to show off the scaling
+        float zoom = 8.0f * exp2f(2.5f + 2.5f * sinf(zoomTime));
+        static constexpr float zoomColor[4] = { 1.0f, 0.8f, 0.3f, 1.0f };
+        layoutText(ZoomText, framebufferWidth * 0.55f, framebufferHeight * 0.75f + zoom * 0.35f, zoom, zoomColor);
+    }
+
+    void render()
+    {
+        // Lay out the text for this frame on the CPU
+        layoutFrame();
+
+        // Begin generating the dynamic command list, for commands that need to be sent only this frame specifically
+        dynmem.begin(dyncmd);
+
+        // Update the uniform buffer with the viewport state (this data gets inlined in the command list)
+        dyncmd.pushConstants(
+            viewportUniformBuffer.getGpuAddr(), viewportUniformBuffer.getSize(),
+            0, sizeof(viewportState), &viewportState);
+
+        // Acquire a framebuffer from the swapchain (and wait for it to be available)
+        int slot = queue.acquireImage(swapchain);
+
+        // Run the command list that attaches said framebuffer to the queue
+        queue.submitCommands(framebuffer_cmdlists[slot]);
+
+        // Run the command list that clears the framebuffer and binds the text rendering state
+        queue.submitCommands(render_cmdlist);
+
+        // Copy this frame's instances into the arena. The data gets written by the CPU,
+        // so make sure the GPU does not see stale cached contents.
+        instanceArena.begin();
+        if (!instances.empty())
+        {
+            auto instanceData = instanceArena.alloc(instances.size()*sizeof(GlyphInstance), alignof(GlyphInstance));
+            memcpy(instanceData.getCpuAddr(), instances.data(), instanceData.getSize());
+            dyncmd.barrier(DkBarrier_None, DkInvalidateFlags_L2Cache);
+            dyncmd.bindVtxBuffer(0, instanceData.getGpuAddr(), instanceData.getSize());
+
+            // Draw every glyph of every string at once
+            dyncmd.draw(DkPrimitive_Quads, 4, instances.size(), 0, 0);
+        }
+
+        // Finish off the dynamic command list (which also submits it to the queue)
+        instanceArena.end(dyncmd);
+        queue.submitCommands(dynmem.end(dyncmd));
+
+        // Now that we are done rendering, present it to the screen
+        queue.presentImage(swapchain, slot);
+    }
+
+    void onOperationMode(AppletOperationMode mode) override
+    {
+        // Destroy the framebuffer resources
+        destroyFramebufferResources();
+
+        // Choose framebuffer size
+        chooseFramebufferSize(framebufferWidth, framebufferHeight, mode);
+
+        // Recreate the framebuffers and its associated resources
+        createFramebufferResources();
+    }
+
+    bool onFrame(u64 ns) override
+    {
+        hidScanInput();
+        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+        if (kDown & KEY_PLUS)
+            return false;
+
+        // Nothing can be drawn if the font failed to load
+        if (!atlas)
+            return true;
+
+        float time = ns / 1000000000.0; // double precision division; followed by implicit cast to single precision
+        zoomTime = fmodf(time * 0.5f, 2.0f * M_PI);
+
+        render();
+        return true;
+    }
+};
+
+void Example13(void)
+{
+    CExample13 app;
+    app.run();
+}
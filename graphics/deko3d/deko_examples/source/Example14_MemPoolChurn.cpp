@@ -0,0 +1,357 @@
+/*
+** deko3d Example 14: Memory Pool Churn
+** This example compares the free slice indexes of CMemPool under the allocation patterns
+** of the other examples.
+** New concepts in this example:
+** - Selecting the backend of a memory pool (best fit tree or TLSF)
+** - Measuring allocator latency and fragmentation with CMemPool::getStats
+** - Sharing a pool between threads in concurrent mode, with per-thread magazines (CMemPool::ThreadCache)
+**
+** Each pattern replays the same pseudo-random sequence of allocations and frees on a fresh pool
+** of each backend, so the two rows of a pattern are directly comparable:
+** - transient: per frame uniform and staging buffers, freed three frames later
+** - mixed: long and short lived buffers of sizes and alignments spread over 256B to 256KB
+** - streaming: levels of textures and meshes loaded, half of them unloaded, and reloaded
+** The table lists the average and worst time per allocation and per free, and the state of
+** the pool at the end of the pattern: memory blocks, peak size, and fragmentation of the free
+** memory. No GPU work is done; the pools still create real memory blocks.
+**
+** The transient pattern is then run on three cores at once, sharing a single pool in concurrent
+** mode: once with every call taking the pool lock, once with a ThreadCache on each thread, which
+** serves the frees and the allocations of small slices from per-thread magazines instead.
+**
+** Press A to run the benchmark again.
+*/
+
+// Sample Framework headers
+#include "SampleFramework/CApplication.h"
+#include "SampleFramework/CMemPool.h"
+
+// C++ standard library headers
+#include <algorithm>
+#include <array>
+#include <optional>
+
+namespace
+{
+    constexpr uint32_t PoolBlockSize = 4*1024*1024;
+    constexpr unsigned MaxLive = 4096;
+
+    // Same sequence on every run, and for every backend
+    struct Random
+    {
+        uint32_t state;
+
+        uint32_t next()
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+
+        // Roughly log-uniform in [min, max), rounded to 16 bytes
+        uint32_t size(uint32_t min, uint32_t max)
+        {
+            unsigned minShift = 31 - __builtin_clz(min), maxShift = 31 - __builtin_clz(max);
+            unsigned shift = minShift + next() % (maxShift - minShift);
+            return ((1U << shift) + next() % (1U << shift) + 15) &~ 15U;
+        }
+    };
+
+    struct Result
+    {
+        u64 allocTicks, maxAllocTicks, numAllocs;
+        u64 freeTicks, maxFreeTicks, numFrees;
+        u64 peakBytes;
+        CMemPool::Stats stats;
+    };
+
+    class CChurn
+    {
+        CMemPool& m_pool;
+        Result& m_result;
+        CMemPool::Handle m_live[MaxLive];
+        unsigned m_numLive;
+
+        void measurePeak()
+        {
+            CMemPool::Stats stats;
+            m_pool.getStats(stats);
+            if (stats.totalBytes > m_result.peakBytes)
+                m_result.peakBytes = stats.totalBytes;
+        }
+
+    public:
+        CChurn(CMemPool& pool, Result& result) : m_pool{pool}, m_result{result}, m_live{}, m_numLive{} { }
+
+        ~CChurn()
+        {
+            while (m_numLive)
+                release(m_numLive-1);
+        }
+
+        constexpr unsigned numLive() const { return m_numLive; }
+
+        bool alloc(uint32_t size, uint32_t alignment)
+        {
+            if (m_numLive == MaxLive)
+                return false;
+
+            u64 start = armGetSystemTick();
+            CMemPool::Handle handle = m_pool.allocate(size, alignment);
+            u64 ticks = armGetSystemTick() - start;
+            if (!handle)
+                return false;
+
+            m_result.allocTicks += ticks;
+            m_result.numAllocs ++;
+            if (ticks > m_result.maxAllocTicks)
+                m_result.maxAllocTicks = ticks;
+
+            m_live[m_numLive++] = handle;
+            if ((m_result.numAllocs & 255) == 0)
+                measurePeak();
+            return true;
+        }
+
+        // The live allocations stay in the order they were made
+        void release(unsigned id)
+        {
+            u64 start = armGetSystemTick();
+            m_live[id].destroy();
+            u64 ticks = armGetSystemTick() - start;
+
+            m_result.freeTicks += ticks;
+            m_result.numFrees ++;
+            if (ticks > m_result.maxFreeTicks)
+                m_result.maxFreeTicks = ticks;
+
+            m_numLive --;
+            for (unsigned i = id; i < m_numLive; i ++)
+                m_live[i] = m_live[i+1];
+        }
+
+        void finish()
+        {
+            measurePeak();
+            m_pool.getStats(m_result.stats);
+        }
+    };
+
+    void runTransient(CChurn& churn, Random& rng)
+    {
+        // Three frames in flight: the oldest frame's allocations are freed before a new frame starts
+        static constexpr unsigned NumFrames = 2000, AllocsPerFrame = 64, FramesInFlight = 3;
+        unsigned frameCounts[FramesInFlight] = {};
+        for (unsigned frame = 0; frame < NumFrames; frame ++)
+        {
+            for (unsigned i = 0; i < frameCounts[frame % FramesInFlight]; i ++)
+                churn.release(0);
+
+            unsigned before = churn.numLive();
+            for (unsigned i = 0; i < AllocsPerFrame; i ++)
+            {
+                bool uniform = rng.next() & 1;
+                churn.alloc(uniform ? rng.size(256, 1024) : rng.size(1024, 16*1024),
+                    uniform ? DK_UNIFORM_BUF_ALIGNMENT : DK_CMDMEM_ALIGNMENT);
+            }
+            frameCounts[frame % FramesInFlight] = churn.numLive() - before;
+        }
+    }
+
+    void runMixed(CChurn& churn, Random& rng)
+    {
+        static constexpr unsigned NumOps = 100000, TargetLive = 2000;
+        static constexpr uint32_t Alignments[] = { DK_CMDMEM_ALIGNMENT, DK_UNIFORM_BUF_ALIGNMENT, 0x200, 0x1000 };
+        for (unsigned op = 0; op < NumOps; op ++)
+        {
+            if (churn.numLive() && (churn.numLive() >= TargetLive || (rng.next() & 1)))
+                churn.release(rng.next() % churn.numLive());
+            else
+                churn.alloc(rng.size(256, 256*1024), Alignments[rng.next() % 4]);
+        }
+    }
+
+    void runStreaming(CChurn& churn, Random& rng)
+    {
+        static constexpr unsigned NumLevels = 40, AssetsPerLevel = 300;
+        for (unsigned level = 0; level < NumLevels; level ++)
+        {
+            while (churn.numLive() > AssetsPerLevel / 2)
+                churn.release(rng.next() % churn.numLive());
+            while (churn.numLive() < AssetsPerLevel)
+            {
+                bool texture = rng.next() % 3 != 0;
+                if (!churn.alloc(texture ? rng.size(4*1024, 1024*1024) : rng.size(1024, 128*1024), texture ? 0x200 : 0x100))
+                    break;
+            }
+        }
+    }
+
+    struct Pattern
+    {
+        const char* name;
+        void (*func)(CChurn&, Random&);
+    };
+
+    constexpr std::array Patterns =
+    {
+        Pattern{ "transient", runTransient },
+        Pattern{ "mixed",     runMixed     },
+        Pattern{ "streaming", runStreaming },
+    };
+
+    constexpr std::array Backends =
+    {
+        CMemPool::Backend::BestFitTree,
+        CMemPool::Backend::Tlsf,
+    };
+
+    constexpr unsigned NumThreads = 3;
+
+    struct Worker
+    {
+        Thread thread;
+        CMemPool* pool;
+        Result result;
+        uint32_t seed;
+        bool useCache;
+    };
+
+    void workerFunc(void* arg)
+    {
+        Worker& worker = *(Worker*)arg;
+
+        // The magazines are flushed back into the pool when the cache is destroyed, which has to
+        // happen on this thread, after the churn has freed its remaining allocations
+        std::optional<CMemPool::ThreadCache> cache;
+        if (worker.useCache)
+            cache.emplace(*worker.pool);
+
+        CChurn churn{*worker.pool, worker.result};
+        Random rng{worker.seed};
+        runTransient(churn, rng);
+    }
+}
+
+class CExample14 final : public CApplication
+{
+    dk::UniqueDevice device;
+
+    void runBenchmark()
+    {
+        printf("\x1b[2J\n");
+        printf("  deko3d Example 14: Memory Pool Churn\n");
+        printf("  Press PLUS(+) to exit; A to run the benchmark again\n\n");
+        printf("  %-10s %-5s %9s %9s %9s %9s %6s %8s %6s\n", "pattern", "pool", "alloc ns", "max ns", "free ns", "max ns", "blocks", "peak MB", "frag");
+        consoleUpdate(NULL);
+
+        for (auto const& pattern : Patterns)
+        {
+            for (auto backend : Backends)
+            {
+                Result result = {};
+                {
+                    std::optional<CMemPool> pool;
+                    pool.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached, PoolBlockSize, false, backend);
+
+                    CChurn churn{*pool, result};
+                    Random rng{0x9E3779B9};
+                    pattern.func(churn, rng);
+                    churn.finish();
+                }
+
+                bool tlsf = backend == CMemPool::Backend::Tlsf;
+                printf("  %-10s %-5s %9lu %9lu %9lu %9lu %6u %8.1f %5.1f%%\n", pattern.name, tlsf ? "tlsf" : "tree",
+                    result.numAllocs ? armTicksToNs(result.allocTicks / result.numAllocs) : 0, armTicksToNs(result.maxAllocTicks),
+                    result.numFrees ? armTicksToNs(result.freeTicks / result.numFrees) : 0, armTicksToNs(result.maxFreeTicks),
+                    result.stats.numBlocks, result.peakBytes / (1024.0*1024.0), 100.0f * result.stats.fragmentation());
+                consoleUpdate(NULL);
+            }
+        }
+
+        for (bool useCache : { false, true })
+        {
+            Result result = {};
+            {
+                std::optional<CMemPool> pool;
+                pool.emplace(device, DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached, PoolBlockSize, true);
+
+                // One worker per core, each with its own sequence
+                Worker workers[NumThreads] = {};
+                for (unsigned i = 0; i < NumThreads; i ++)
+                {
+                    workers[i].pool = &*pool;
+                    workers[i].seed = 0x9E3779B9 + i;
+                    workers[i].useCache = useCache;
+                    threadCreate(&workers[i].thread, workerFunc, &workers[i], NULL, 0x10000, 0x2C, i);
+                }
+                for (auto& worker : workers)
+                    threadStart(&worker.thread);
+
+                for (auto& worker : workers)
+                {
+                    threadWaitForExit(&worker.thread);
+                    threadClose(&worker.thread);
+
+                    result.allocTicks += worker.result.allocTicks;
+                    result.numAllocs += worker.result.numAllocs;
+                    result.maxAllocTicks = std::max(result.maxAllocTicks, worker.result.maxAllocTicks);
+                    result.freeTicks += worker.result.freeTicks;
+                    result.numFrees += worker.result.numFrees;
+                    result.maxFreeTicks = std::max(result.maxFreeTicks, worker.result.maxFreeTicks);
+                    result.peakBytes = std::max(result.peakBytes, worker.result.peakBytes);
+                }
+                pool->getStats(result.stats);
+            }
+
+            printf("  %-10s %-5s %9lu %9lu %9lu %9lu %6u %8.1f %5.1f%%\n", "transient", useCache ? "cache" : "lock",
+                result.numAllocs ? armTicksToNs(result.allocTicks / result.numAllocs) : 0, armTicksToNs(result.maxAllocTicks),
+                result.numFrees ? armTicksToNs(result.freeTicks / result.numFrees) : 0, armTicksToNs(result.maxFreeTicks),
+                result.stats.numBlocks, result.peakBytes / (1024.0*1024.0), 100.0f * result.stats.fragmentation());
+            consoleUpdate(NULL);
+        }
+
+        printf("\n  Times are per call, as seen by the caller. frag is the share of the free memory\n");
+        printf("  outside of the largest free slice once the pattern is done. The lock and cache\n");
+        printf("  rows are %u threads sharing a concurrent pool, the times are over all of them.\n", NumThreads);
+        consoleUpdate(NULL);
+    }
+
+public:
+    CExample14()
+    {
+        consoleInit(NULL);
+
+        // Create the deko3d device, which is all the pools need
+        device = dk::DeviceMaker{}.create();
+
+        runBenchmark();
+    }
+
+    ~CExample14()
+    {
+        consoleExit(NULL);
+    }
+
+    bool onFrame(u64 ns) override
+    {
+        hidScanInput();
+
+        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+        if (kDown & KEY_PLUS)
+            return false;
+        if (kDown & KEY_A)
+            runBenchmark();
+
+        consoleUpdate(NULL);
+        return true;
+    }
+};
+
+void Example14(void)
+{
+    CExample14 app;
+    app.run();
+}
@@ -3,8 +3,11 @@
 **   CApplication.cpp: Wrapper class containing common application boilerplate
 */
 #include "CApplication.h"
+#include "trace.h"
 
-CApplication::CApplication()
+CApplication::CApplication() :
+    m_operationMode{AppletOperationMode_Handheld}, m_performanceMode{ApmPerformanceMode_Normal},
+    m_renderProfile{}, m_hasRenderProfile{}
 {
     appletLockExit();
     appletSetFocusHandlingMode(AppletFocusHandlingMode_NoSuspend);
@@ -16,16 +19,36 @@ CApplication::~CApplication()
     appletUnlockExit();
 }
 
+void CApplication::_updateRenderProfile()
+{
+    CRenderProfile profile = chooseRenderProfile(m_operationMode, m_performanceMode);
+    unsigned changes = m_hasRenderProfile ? profile.diff(m_renderProfile) : ~0U;
+    m_renderProfile = profile;
+    m_hasRenderProfile = true;
+
+    // Both messages are usually received when docking or undocking, and the second one
+    // might not change anything
+    if (changes)
+        onRenderProfile(profile, changes);
+}
+
 void CApplication::run()
 {
     u64 tick_ref = armGetSystemTick();
     u64 tick_saved = tick_ref;
     bool focused = appletGetFocusState() == AppletFocusState_Focused;
 
-    onOperationMode(appletGetOperationMode());
+    traceSetThreadName("main");
+    m_operationMode = appletGetOperationMode();
+    m_performanceMode = appletGetPerformanceMode();
+    onOperationMode(m_operationMode);
+    onPerformanceMode(m_performanceMode);
+    _updateRenderProfile();
 
     for (;;)
     {
+        TRACE_SCOPE("CApplication::run");
+
         u32 msg = 0;
         Result rc = appletGetMessage(&msg);
         if (R_SUCCEEDED(rc))
@@ -58,12 +81,23 @@ void CApplication::run()
                     break;
                 }
                 case AppletMessage_OperationModeChanged:
-                    onOperationMode(appletGetOperationMode());
+                    m_operationMode = appletGetOperationMode();
+                    onOperationMode(m_operationMode);
+                    _updateRenderProfile();
+                    break;
+                case AppletMessage_PerformanceModeChanged:
+                    m_performanceMode = appletGetPerformanceMode();
+                    onPerformanceMode(m_performanceMode);
+                    _updateRenderProfile();
                     break;
             }
         }
 
-        if (focused && !onFrame(armTicksToNs(armGetSystemTick() - tick_ref)))
-            break;
+        if (focused)
+        {
+            TRACE_SCOPE("onFrame");
+            if (!onFrame(armTicksToNs(armGetSystemTick() - tick_ref)))
+                break;
+        }
     }
 }
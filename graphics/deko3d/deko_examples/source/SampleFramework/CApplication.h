@@ -4,20 +4,45 @@
 */
 #pragma once
 #include "common.h"
+#include "CRenderProfile.h"
 
 class CApplication
 {
+    AppletOperationMode m_operationMode;
+    ApmPerformanceMode m_performanceMode;
+    CRenderProfile m_renderProfile;
+    bool m_hasRenderProfile;
+
+    void _updateRenderProfile();
+
 protected:
     virtual void onFocusState(AppletFocusState) { }
     virtual void onOperationMode(AppletOperationMode) { }
+    virtual void onPerformanceMode(ApmPerformanceMode) { }
     virtual bool onFrame(u64) { return true; }
 
+    // Called with the profile to use when the operation or performance mode changes (and once
+    // before the first frame, with all the change bits set). changes is a mask of
+    // CRenderProfile::Change bits, so that only the resources affected get recreated.
+    virtual void onRenderProfile(CRenderProfile const&, unsigned changes) { }
+
+    // Override to customize the profiles; the default is CRenderProfile::getDefault with the
+    // output size given by chooseFramebufferSize
+    virtual CRenderProfile chooseRenderProfile(AppletOperationMode mode, ApmPerformanceMode perfMode)
+    {
+        CRenderProfile profile = CRenderProfile::getDefault(mode, perfMode);
+        chooseFramebufferSize(profile.outputWidth, profile.outputHeight, mode);
+        return profile;
+    }
+
 public:
     CApplication();
     ~CApplication();
 
     void run();
 
+    constexpr CRenderProfile const& getRenderProfile() const { return m_renderProfile; }
+
     static constexpr void chooseFramebufferSize(uint32_t& width, uint32_t& height, AppletOperationMode mode);
 };
 
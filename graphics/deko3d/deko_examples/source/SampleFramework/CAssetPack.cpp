@@ -0,0 +1,303 @@
+/*
+** Sample Framework for deko3d Applications
+**   CAssetPack.cpp: Reader for asset packs built by tools/mkdkpak.py
+*/
+#include "CAssetPack.h"
+#include "FileLoader.h"
+
+namespace
+{
+    constexpr size_t FileBufferSize = 0x20000;
+
+    uint64_t HashName(const char* name)
+    {
+        uint64_t hash = 0xCBF29CE484222325ULL;
+        for (; *name; name ++)
+            hash = (hash ^ (u8)*name) * 0x100000001B3ULL;
+        return hash;
+    }
+
+    // Decodes an LZ4 block, which must decompress to exactly dstSize bytes
+    bool Lz4Decompress(const u8* src, uint32_t srcSize, u8* dst, uint32_t dstSize)
+    {
+        const u8* ip = src;
+        const u8* iend = src + srcSize;
+        u8* op = dst;
+        u8* oend = dst + dstSize;
+
+        for (;;)
+        {
+            if (ip >= iend)
+                return false;
+            unsigned token = *ip++;
+
+            size_t literals = token >> 4;
+            if (literals == 15)
+            {
+                unsigned b;
+                do
+                {
+                    if (ip >= iend)
+                        return false;
+                    b = *ip++;
+                    literals += b;
+                } while (b == 255);
+            }
+            if (size_t(iend - ip) < literals || size_t(oend - op) < literals)
+                return false;
+            memcpy(op, ip, literals);
+            ip += literals;
+            op += literals;
+
+            // The last sequence only has literals
+            if (ip == iend)
+                break;
+
+            if (iend - ip < 2)
+                return false;
+            size_t offset = ip[0] | (ip[1] << 8);
+            ip += 2;
+            if (offset == 0 || offset > size_t(op - dst))
+                return false;
+
+            size_t length = token & 15;
+            if (length == 15)
+            {
+                unsigned b;
+                do
+                {
+                    if (ip >= iend)
+                        return false;
+                    b = *ip++;
+                    length += b;
+                } while (b == 255);
+            }
+            length += 4;
+            if (size_t(oend - op) < length)
+                return false;
+
+            // The match may overlap the bytes it produces, e.g. a run of one byte
+            const u8* match = op - offset;
+            if (offset >= length)
+                memcpy(op, match, length);
+            else
+                for (size_t i = 0; i < length; i ++)
+                    op[i] = match[i];
+            op += length;
+        }
+
+        return op == oend;
+    }
+}
+
+bool CAssetPack::open(const char* path)
+{
+    close();
+
+    m_file = fopen(path, "rb");
+    if (!m_file)
+        return false;
+
+    // Assets are mostly read in order, a large buffer turns the reads of small ones into few romfs reads
+    m_fileBuffer = (char*)malloc(FileBufferSize);
+    if (m_fileBuffer)
+        setvbuf(m_file, m_fileBuffer, _IOFBF, FileBufferSize);
+
+    if (!fread(&m_header, sizeof(m_header), 1, m_file) || m_header.magic != Magic || m_header.version != Version || !m_header.blockSize)
+        goto _fail;
+
+    {
+        size_t lookupSize = m_header.numEntries * sizeof(Lookup);
+        size_t phasesSize = m_header.numPhases * sizeof(Phase);
+        size_t entriesSize = m_header.numEntries * sizeof(Entry);
+        size_t blocksSize = m_header.numBlocks * sizeof(Block);
+        if (lookupSize + phasesSize + entriesSize + blocksSize + m_header.namesSize != m_header.indexSize || !m_header.namesSize)
+            goto _fail;
+
+        m_index = malloc(m_header.indexSize);
+        m_readBuffer = (u8*)malloc(m_header.blockSize);
+        m_decodeBuffer = (u8*)malloc(m_header.blockSize);
+        if (!m_index || !m_readBuffer || !m_decodeBuffer || !fread(m_index, m_header.indexSize, 1, m_file))
+            goto _fail;
+
+        u8* p = (u8*)m_index;
+        m_lookup = (Lookup const*)p;
+        m_phases = (Phase const*)(p += lookupSize);
+        m_entries = (Entry const*)(p += phasesSize);
+        m_blocks = (Block const*)(p += entriesSize);
+        m_names = (char const*)(p += blocksSize);
+        ((char*)m_names)[m_header.namesSize - 1] = 0;
+    }
+
+    // Only the index is trusted afterwards, so check it once here
+    for (uint32_t i = 0; i < m_header.numEntries; i ++)
+    {
+        Entry const& e = m_entries[i];
+        if (m_lookup[i].entry >= m_header.numEntries || e.nameOffset >= m_header.namesSize ||
+            e.firstBlock > m_header.numBlocks || e.numBlocks > m_header.numBlocks - e.firstBlock ||
+            e.numBlocks != (e.size + m_header.blockSize - 1) / m_header.blockSize)
+            goto _fail;
+    }
+    for (uint32_t i = 0; i < m_header.numBlocks; i ++)
+        if (m_blocks[i].storedSize > m_header.blockSize)
+            goto _fail;
+    for (uint32_t i = 0; i < m_header.numPhases; i ++)
+    {
+        Phase const& ph = m_phases[i];
+        if (ph.nameOffset >= m_header.namesSize || ph.firstEntry > m_header.numEntries || ph.numEntries > m_header.numEntries - ph.firstEntry)
+            goto _fail;
+    }
+
+    m_decodedBlock = NoBlock;
+    return true;
+
+_fail:
+    close();
+    return false;
+}
+
+void CAssetPack::close()
+{
+    if (m_file)
+        fclose(m_file);
+    free(m_fileBuffer);
+    free(m_index);
+    free(m_readBuffer);
+    free(m_decodeBuffer);
+
+    m_file = nullptr;
+    m_fileBuffer = nullptr;
+    m_index = nullptr;
+    m_readBuffer = nullptr;
+    m_decodeBuffer = nullptr;
+    m_header = Header{};
+    m_lookup = nullptr;
+    m_phases = nullptr;
+    m_entries = nullptr;
+    m_blocks = nullptr;
+    m_names = nullptr;
+    m_decodedBlock = NoBlock;
+}
+
+CAssetPack::Entry const* CAssetPack::find(const char* name) const
+{
+    if (!m_file)
+        return nullptr;
+
+    uint64_t hash = HashName(name);
+    uint32_t lo = 0, hi = m_header.numEntries;
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2;
+        if (m_lookup[mid].hash < hash)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    // Names which share a hash are next to each other
+    for (; lo < m_header.numEntries && m_lookup[lo].hash == hash; lo ++)
+    {
+        Entry const* entry = &m_entries[m_lookup[lo].entry];
+        if (strcmp(getName(entry), name) == 0)
+            return entry;
+    }
+    return nullptr;
+}
+
+int CAssetPack::findPhase(const char* name) const
+{
+    for (uint32_t i = 0; i < m_header.numPhases; i ++)
+        if (strcmp(getPhaseName(i), name) == 0)
+            return i;
+    return -1;
+}
+
+bool CAssetPack::_readStored(Block const& block, void* dst)
+{
+    // The offsets of consecutive blocks follow each other, only seek when they don't
+    if ((uint64_t)ftello(m_file) != block.offset && fseeko(m_file, block.offset, SEEK_SET) != 0)
+        return false;
+    return fread(dst, block.storedSize, 1, m_file) == 1;
+}
+
+bool CAssetPack::_decodeBlock(uint32_t index, void* dst, uint32_t size)
+{
+    Block const& block = m_blocks[index];
+    if (!(block.flags & BlockFlag_Lz4))
+        return block.storedSize == size && _readStored(block, dst);
+
+    return _readStored(block, m_readBuffer) && Lz4Decompress(m_readBuffer, block.storedSize, (u8*)dst, size);
+}
+
+bool CAssetPack::read(Entry const* entry, void* dst, uint32_t offset, uint32_t size)
+{
+    if (!m_file || offset > entry->size || size > entry->size - offset)
+        return false;
+
+    u8* out = (u8*)dst;
+    uint32_t blockSize = m_header.blockSize;
+    for (uint32_t i = offset / blockSize; size; i ++)
+    {
+        uint32_t blockStart = i * blockSize;
+        uint32_t blockLen = entry->size - blockStart < blockSize ? entry->size - blockStart : blockSize;
+        uint32_t begin = offset - blockStart;
+        uint32_t len = blockLen - begin < size ? blockLen - begin : size;
+        uint32_t index = entry->firstBlock + i;
+
+        if (begin == 0 && len == blockLen)
+        {
+            // Whole blocks are decompressed straight into the destination
+            if (!_decodeBlock(index, out, blockLen))
+                return false;
+        }
+        else
+        {
+            // Partial ones go through the decode buffer, which is kept for the next read (e.g. a header, then what follows)
+            if (m_decodedBlock != index)
+            {
+                m_decodedBlock = NoBlock;
+                if (!_decodeBlock(index, m_decodeBuffer, blockLen))
+                    return false;
+                m_decodedBlock = index;
+            }
+            memcpy(out, m_decodeBuffer + begin, len);
+        }
+
+        out += len;
+        offset += len;
+        size -= len;
+    }
+    return true;
+}
+
+CMemPool::Handle CAssetPack::load(CMemPool& pool, Entry const* entry, uint32_t alignment)
+{
+    CMemPool::Handle mem = pool.allocate(entry->size, alignment);
+    if (!mem)
+        return nullptr;
+
+    u8* dst = (u8*)mem.getCpuAddr();
+    bool ok = true;
+    if (pool.isCpuCached())
+        ok = read(entry, dst);
+    else
+    {
+        // LZ4 writes a byte at a time, which is very slow on uncached memory: blocks are decoded in cached memory first
+        m_decodedBlock = NoBlock;
+        for (uint32_t pos = 0; ok && pos < entry->size; pos += m_header.blockSize)
+        {
+            uint32_t len = entry->size - pos < m_header.blockSize ? entry->size - pos : m_header.blockSize;
+            ok = _decodeBlock(entry->firstBlock + pos / m_header.blockSize, m_decodeBuffer, len);
+            if (ok)
+                CopyToUncached(dst + pos, m_decodeBuffer, len);
+        }
+    }
+
+    if (!ok)
+    {
+        mem.destroy();
+        return nullptr;
+    }
+    return mem;
+}
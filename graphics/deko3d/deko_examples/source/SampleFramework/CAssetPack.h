@@ -0,0 +1,137 @@
+/*
+** Sample Framework for deko3d Applications
+**   CAssetPack.h: Reader for asset packs built by tools/mkdkpak.py
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+
+// An asset pack holds many small assets in a single romfs file, so that they cost one open
+// instead of one each. The index (a table of name hashes sorted for binary search, the entries
+// and their blocks) is read in one go when the pack is opened. Assets are laid out grouped by
+// load phase, so loading the assets of a phase in order reads the file sequentially.
+//
+// Each asset is split into blocks of blockSize bytes, LZ4-compressed unless that doesn't make them
+// smaller. Blocks are decompressed straight into the destination memory, unless it's CPU-uncached.
+class CAssetPack
+{
+public:
+    static constexpr uint32_t Magic = 0x4B504B44; // DKPK
+    static constexpr uint32_t Version = 1;
+
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t numEntries;
+        uint32_t numPhases;
+        uint32_t numBlocks;
+        uint32_t blockSize;
+        uint32_t indexSize;     // Size of the index, which directly follows the header
+        uint32_t namesSize;     // Size of the name table, at the end of the index
+    };
+
+    // Sorted by hash
+    struct Lookup
+    {
+        uint64_t hash;          // FNV-1a of the name
+        uint32_t entry;
+        uint32_t reserved;
+    };
+
+    struct Phase
+    {
+        uint32_t nameOffset;
+        uint32_t firstEntry;
+        uint32_t numEntries;
+        uint32_t reserved;
+    };
+
+    // In the order of the data, grouped by phase
+    struct Entry
+    {
+        uint32_t nameOffset;
+        uint32_t size;
+        uint32_t firstBlock;
+        uint32_t numBlocks;
+    };
+
+    struct Block
+    {
+        uint64_t offset;        // From the start of the file
+        uint32_t storedSize;
+        uint32_t flags;
+    };
+
+    static constexpr uint32_t BlockFlag_Lz4 = 1U << 0;
+
+private:
+    static constexpr uint32_t NoBlock = UINT32_MAX;
+
+    FILE* m_file;
+    void* m_index;
+    Header m_header;
+    Lookup const* m_lookup;
+    Phase const* m_phases;
+    Entry const* m_entries;
+    Block const* m_blocks;
+    char const* m_names;
+    char* m_fileBuffer;
+    u8* m_readBuffer;           // One compressed block
+    u8* m_decodeBuffer;         // One decompressed block, used for reads which don't cover a whole block
+    uint32_t m_decodedBlock;
+
+    bool _readStored(Block const& block, void* dst);
+    bool _decodeBlock(uint32_t index, void* dst, uint32_t size);
+
+public:
+    CAssetPack() : m_file{}, m_index{}, m_header{}, m_lookup{}, m_phases{}, m_entries{}, m_blocks{}, m_names{},
+        m_fileBuffer{}, m_readBuffer{}, m_decodeBuffer{}, m_decodedBlock{NoBlock} { }
+    ~CAssetPack()
+    {
+        close();
+    }
+
+    CAssetPack(CAssetPack const&) = delete;
+    CAssetPack& operator=(CAssetPack const&) = delete;
+
+    constexpr operator bool() const
+    {
+        return m_file != nullptr;
+    }
+
+    bool open(const char* path);
+    void close();
+
+    Entry const* find(const char* name) const;
+
+    const char* getName(Entry const* entry) const { return m_names + entry->nameOffset; }
+    unsigned getNumEntries() const { return m_header.numEntries; }
+    Entry const* getEntry(unsigned index) const { return &m_entries[index]; }
+
+    unsigned getNumPhases() const { return m_header.numPhases; }
+    const char* getPhaseName(unsigned phase) const { return m_names + m_phases[phase].nameOffset; }
+    int findPhase(const char* name) const;
+
+    // The entries of a phase are consecutive, in the order of their data
+    Entry const* getPhaseEntries(unsigned phase, unsigned& count) const
+    {
+        count = m_phases[phase].numEntries;
+        return &m_entries[m_phases[phase].firstEntry];
+    }
+
+    // Reads size bytes of the asset, starting at offset
+    bool read(Entry const* entry, void* dst, uint32_t offset, uint32_t size);
+    bool read(Entry const* entry, void* dst)
+    {
+        return read(entry, dst, 0, entry->size);
+    }
+
+    // Allocates memory for the whole asset from the pool and reads it there
+    CMemPool::Handle load(CMemPool& pool, Entry const* entry, uint32_t alignment = DK_CMDMEM_ALIGNMENT);
+    CMemPool::Handle load(CMemPool& pool, const char* name, uint32_t alignment = DK_CMDMEM_ALIGNMENT)
+    {
+        Entry const* entry = find(name);
+        return entry ? load(pool, entry, alignment) : nullptr;
+    }
+};
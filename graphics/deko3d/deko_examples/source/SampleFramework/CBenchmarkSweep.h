@@ -0,0 +1,125 @@
+/*
+** Sample Framework for deko3d Applications
+**   CBenchmarkSweep.h: Runs a scene under a series of configurations and reports the GPU time of each
+*/
+#pragma once
+#include "common.h"
+#include <stdio.h>
+#include <string.h>
+
+class CBenchmarkSweep
+{
+public:
+    static constexpr unsigned MaxConfigs = 64;
+    static constexpr unsigned MaxNameLength = 48;
+    static constexpr unsigned DefaultWarmupFrames = 30;
+    static constexpr unsigned DefaultMeasureFrames = 120;
+
+private:
+    struct Result
+    {
+        char name[MaxNameLength];
+        u64 bytesPerFrame;
+        u64 totalNs;
+        u64 minNs;
+        u64 maxNs;
+        unsigned numSamples;
+    };
+
+    Result m_results[MaxConfigs];
+    unsigned m_numConfigs;
+    unsigned m_curConfig;
+    unsigned m_curFrame;
+    unsigned m_warmupFrames;
+    unsigned m_measureFrames;
+    bool m_active;
+
+public:
+    CBenchmarkSweep() : m_results{}, m_numConfigs{}, m_curConfig{}, m_curFrame{}, m_warmupFrames{}, m_measureFrames{}, m_active{} { }
+
+    // Starts the sweep at configuration 0. The warmup frames allow for measurements taken before
+    // the switch (which the GPU profiler reports with some frames of latency) to flush out.
+    bool start(unsigned numConfigs, unsigned warmupFrames = DefaultWarmupFrames, unsigned measureFrames = DefaultMeasureFrames)
+    {
+        if (!numConfigs || numConfigs > MaxConfigs || !measureFrames)
+            return false;
+
+        memset(m_results, 0, sizeof(m_results));
+        m_numConfigs = numConfigs;
+        m_curConfig = 0;
+        m_curFrame = 0;
+        m_warmupFrames = warmupFrames;
+        m_measureFrames = measureFrames;
+        m_active = true;
+        return true;
+    }
+
+    void stop()
+    {
+        m_active = false;
+    }
+
+    constexpr bool isActive() const { return m_active; }
+    constexpr unsigned getConfig() const { return m_curConfig; }
+    constexpr unsigned getNumConfigs() const { return m_numConfigs; }
+
+    // Names the current configuration, and gives an estimate of the memory traffic it generates
+    // every frame (which is used to derive the achieved bandwidth)
+    void describe(const char* name, u64 bytesPerFrame)
+    {
+        Result& r = m_results[m_curConfig];
+        snprintf(r.name, sizeof(r.name), "%s", name);
+        r.bytesPerFrame = bytesPerFrame;
+    }
+
+    // Feeds the GPU time of a frame (0 meaning none is available). Returns true whenever the
+    // sweep moves on to the next configuration or finishes, so that the caller can reconfigure.
+    bool update(u64 gpuNs)
+    {
+        if (!m_active)
+            return false;
+
+        if (m_curFrame++ >= m_warmupFrames && gpuNs)
+        {
+            Result& r = m_results[m_curConfig];
+            if (!r.numSamples || gpuNs < r.minNs) r.minNs = gpuNs;
+            if (gpuNs > r.maxNs) r.maxNs = gpuNs;
+            r.totalNs += gpuNs;
+            r.numSamples ++;
+        }
+
+        if (m_curFrame < m_warmupFrames + m_measureFrames)
+            return false;
+
+        m_curFrame = 0;
+        if (++m_curConfig >= m_numConfigs)
+        {
+            m_curConfig = 0;
+            m_active = false;
+            printResults();
+        }
+        return true;
+    }
+
+    void printResults() const
+    {
+        printf("[bench] %-40s %12s %12s %12s %10s %8s\n", "configuration", "min us", "avg us", "max us", "MB/frame", "GB/s");
+        for (unsigned i = 0; i < m_numConfigs; i ++)
+        {
+            Result const& r = m_results[i];
+            if (!r.numSamples)
+            {
+                printf("[bench] %-40s (no samples)\n", r.name);
+                continue;
+            }
+
+            u64 avgNs = r.totalNs / r.numSamples;
+            printf("[bench] %-40s %8lu.%03lu %8lu.%03lu %8lu.%03lu %10.2f %8.2f\n", r.name,
+                r.minNs / 1000, r.minNs % 1000,
+                avgNs / 1000, avgNs % 1000,
+                r.maxNs / 1000, r.maxNs % 1000,
+                r.bytesPerFrame / (1024.0*1024.0),
+                double(r.bytesPerFrame) / double(avgNs)); // bytes per ns == GB/s
+        }
+    }
+};
@@ -0,0 +1,185 @@
+/*
+** Sample Framework for deko3d Applications
+**   CCmdListCache.h: Frame made of static and dynamic passes, re-recording only what changed
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+#include "CCmdMemRing.h"
+
+// A frame is described as a sequence of passes, submitted in the order they were added:
+// - Static passes are recorded once into their own command memory, and the resulting command
+//   list is replayed every frame until the pass is invalidated (because a resource, a shader or
+//   a setting it uses changed), which makes it get recorded again at the next submit.
+// - Dynamic passes are recorded every frame into the dynamic command buffer, whose memory comes
+//   from a CCmdMemRing. Consecutive dynamic passes are merged into a single command list.
+// GPU state set by a pass carries over to the following ones, so a dynamic pass can for example
+// bind a per-frame buffer used by the draw calls of the static pass following it.
+template <unsigned NumSlices>
+class CCmdListCache
+{
+public:
+    using RecordFunc = void(*)(void* userData, dk::CmdBuf cmdbuf);
+
+    static constexpr unsigned MaxPasses = 16;
+
+    struct Stats
+    {
+        unsigned staticRecords;  // Static passes recorded (or re-recorded)
+        unsigned staticReplays;  // Static passes submitted without re-recording
+        unsigned dynamicRecords;
+        u64 recordNs;            // CPU time spent recording, during the last submit
+    };
+
+private:
+    struct Pass
+    {
+        RecordFunc func;
+        void* userData;
+        dk::UniqueCmdBuf cmdbuf; // Static passes only
+        CMemPool::Handle mem;
+        DkCmdList list;
+        bool dirty;
+    };
+
+    Pass m_passes[MaxPasses];
+    unsigned m_numPasses;
+    Stats m_stats;
+
+    unsigned _add(RecordFunc func, void* userData)
+    {
+        if (m_numPasses == MaxPasses)
+            return ~0U;
+
+        Pass& pass = m_passes[m_numPasses];
+        pass.func = func;
+        pass.userData = userData;
+        pass.list = 0;
+        pass.dirty = true;
+        return m_numPasses++;
+    }
+
+    void _record(Pass& pass)
+    {
+        // The old list is no longer referenced by the queue, so its memory can be reused
+        pass.cmdbuf.clear();
+        pass.cmdbuf.addMemory(pass.mem.getMemBlock(), pass.mem.getOffset(), pass.mem.getSize());
+        pass.func(pass.userData, pass.cmdbuf);
+        pass.list = pass.cmdbuf.finishList();
+        pass.dirty = false;
+        m_stats.staticRecords ++;
+    }
+
+public:
+    CCmdListCache() : m_passes{}, m_numPasses{}, m_stats{} { }
+    ~CCmdListCache()
+    {
+        clear();
+    }
+
+    // Adds a static pass, with its own command memory (cmdSize must hold everything it records).
+    // Returns the id of the pass, or ~0U on failure.
+    unsigned addStatic(dk::Device device, CMemPool& pool, uint32_t cmdSize, RecordFunc func, void* userData)
+    {
+        CMemPool::Handle mem = pool.allocate((cmdSize + DK_CMDMEM_ALIGNMENT - 1) &~ (DK_CMDMEM_ALIGNMENT - 1));
+        if (!mem)
+            return ~0U;
+
+        unsigned id = _add(func, userData);
+        if (id == ~0U)
+        {
+            mem.destroy();
+            return id;
+        }
+
+        m_passes[id].cmdbuf = dk::CmdBufMaker{device}.create();
+        m_passes[id].mem = mem;
+        return id;
+    }
+
+    // Adds a dynamic pass, recorded into the dynamic command buffer every frame
+    unsigned addDynamic(RecordFunc func, void* userData)
+    {
+        return _add(func, userData);
+    }
+
+    // Makes a static pass get recorded again at the next submit
+    void invalidate(unsigned id)
+    {
+        if (id < m_numPasses)
+            m_passes[id].dirty = true;
+    }
+
+    void invalidateAll()
+    {
+        for (unsigned i = 0; i < m_numPasses; i ++)
+            m_passes[i].dirty = true;
+    }
+
+    // Removes all the passes, freeing their command memory. The queue must be idle.
+    void clear()
+    {
+        for (unsigned i = 0; i < m_numPasses; i ++)
+        {
+            if (m_passes[i].cmdbuf)
+                m_passes[i].cmdbuf.destroy();
+            m_passes[i].mem.destroy();
+        }
+        m_numPasses = 0;
+    }
+
+    constexpr Stats const& getStats() const { return m_stats; }
+
+    // Submits every pass in order, using the ring for the dynamic command memory. The fence of
+    // the ring slice is signaled after the last pass, so it covers the whole frame.
+    void submit(dk::Queue queue, dk::CmdBuf dyncmd, CCmdMemRing<NumSlices>& ring)
+    {
+        u64 recordTicks = 0;
+
+        // Static lists might still be in flight: wait for the GPU once before re-recording any
+        // of them. Invalidations are meant to be rare (resizes, settings changes), so this
+        // is not worth tracking per pass.
+        for (unsigned i = 0; i < m_numPasses; i ++)
+        {
+            if (m_passes[i].cmdbuf && m_passes[i].dirty)
+            {
+                queue.waitIdle();
+                break;
+            }
+        }
+
+        ring.begin(dyncmd);
+        bool pendingDynamic = false;
+        for (unsigned i = 0; i < m_numPasses; i ++)
+        {
+            Pass& pass = m_passes[i];
+            u64 start = armGetSystemTick();
+
+            if (!pass.cmdbuf)
+            {
+                pass.func(pass.userData, dyncmd);
+                pendingDynamic = true;
+                m_stats.dynamicRecords ++;
+                recordTicks += armGetSystemTick() - start;
+                continue;
+            }
+
+            if (pass.dirty)
+                _record(pass);
+            else
+                m_stats.staticReplays ++;
+            recordTicks += armGetSystemTick() - start;
+
+            // Dynamic commands recorded so far must run before the static list
+            if (pendingDynamic)
+            {
+                queue.submitCommands(dyncmd.finishList());
+                pendingDynamic = false;
+            }
+            queue.submitCommands(pass.list);
+        }
+
+        queue.submitCommands(ring.end(dyncmd));
+        m_stats.recordNs = armTicksToNs(recordTicks);
+    }
+};
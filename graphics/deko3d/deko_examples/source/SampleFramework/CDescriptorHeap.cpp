@@ -0,0 +1,173 @@
+/*
+** Sample Framework for deko3d Applications
+**   CDescriptorHeap.cpp: Growable image/sampler descriptor heap with free-list slot allocation
+*/
+#include "CDescriptorHeap.h"
+
+CDescriptorHeap::~CDescriptorHeap()
+{
+    _reclaimRetired(true);
+    for (unsigned i = 0; i < m_numRetired; i ++)
+        m_retired[i].destroy();
+    m_mem.destroy();
+    free(m_shadow);
+    free(m_dirty);
+    free(m_freeSlots);
+}
+
+bool CDescriptorHeap::allocate(CMemPool& pool, uint32_t initialCapacity, uint32_t maxCapacity)
+{
+    if (!initialCapacity || initialCapacity > maxCapacity || m_mem)
+        return false;
+
+    m_pool = &pool;
+    m_maxCapacity = maxCapacity;
+    return _grow(initialCapacity);
+}
+
+void CDescriptorHeap::_reclaimRetired(bool wait)
+{
+    if (!m_numFenced)
+        return;
+
+    if (wait)
+        m_retireFence.wait();
+    else if (m_retireFence.wait(0) != DkResult_Success)
+        return;
+
+    for (unsigned i = 0; i < m_numFenced; i ++)
+        m_retired[i].destroy();
+    for (unsigned i = m_numFenced; i < m_numRetired; i ++)
+        m_retired[i - m_numFenced] = m_retired[i];
+    m_numRetired -= m_numFenced;
+    m_numFenced = 0;
+}
+
+bool CDescriptorHeap::_grow(uint32_t minCapacity)
+{
+    uint32_t newCapacity = m_capacity ? 2*m_capacity : 64;
+    if (newCapacity < minCapacity)
+        newCapacity = minCapacity;
+    if (newCapacity > m_maxCapacity)
+        newCapacity = m_maxCapacity;
+    if (newCapacity < minCapacity || newCapacity <= m_capacity)
+        return false;
+
+    if (m_numRetired == MaxRetired)
+    {
+        _reclaimRetired(true);
+        if (m_numRetired == MaxRetired)
+            return false;
+    }
+
+    CMemPool::Handle mem = m_pool->allocate(newCapacity*DescriptorSize, DescriptorAlign);
+    if (!mem || !mem.getCpuAddr())
+    {
+        mem.destroy();
+        return false;
+    }
+
+    uint32_t numWords = (newCapacity + 63) / 64;
+    DkImageDescriptor* shadow = (DkImageDescriptor*)realloc(m_shadow, newCapacity*DescriptorSize);
+    if (shadow) m_shadow = shadow;
+    uint64_t* dirty = (uint64_t*)realloc(m_dirty, numWords*sizeof(uint64_t));
+    if (dirty) m_dirty = dirty;
+    uint32_t* freeSlots = (uint32_t*)realloc(m_freeSlots, newCapacity*sizeof(uint32_t));
+    if (freeSlots) m_freeSlots = freeSlots;
+    if (!shadow || !dirty || !freeSlots)
+    {
+        mem.destroy();
+        return false;
+    }
+
+    // The new memory is not in use by the GPU yet, so we can simply write the current contents
+    // of the heap into it from the CPU. This also takes care of all pending modifications.
+    memset(&m_shadow[m_capacity], 0, (newCapacity - m_capacity)*DescriptorSize);
+    memcpy(mem.getCpuAddr(), m_shadow, newCapacity*DescriptorSize);
+    memset(m_dirty, 0, numWords*sizeof(uint64_t));
+
+    // The old memory might still be read by in-flight commands, so it is only freed once
+    // the fence signalled by the next flush (recorded after those commands) is reached
+    if (m_mem)
+        m_retired[m_numRetired++] = m_mem;
+
+    m_mem = mem;
+    m_capacity = newCapacity;
+    m_needsRebind = true;
+    return true;
+}
+
+uint32_t CDescriptorHeap::alloc()
+{
+    if (m_numFree)
+        return m_freeSlots[--m_numFree];
+
+    if (m_highWater == m_capacity && !_grow(m_capacity + 1))
+        return InvalidIndex;
+
+    return m_highWater++;
+}
+
+void CDescriptorHeap::remove(uint32_t id)
+{
+    if (id >= m_highWater)
+        return;
+    m_freeSlots[m_numFree++] = id;
+}
+
+void CDescriptorHeap::_setRaw(uint32_t id, void const* descriptor)
+{
+    if (id >= m_highWater)
+        return;
+    memcpy(&m_shadow[id], descriptor, DescriptorSize);
+    _markDirty(id);
+}
+
+void CDescriptorHeap::flush(dk::CmdBuf cmdbuf)
+{
+    _reclaimRetired(false);
+
+    uint32_t numWords = (m_highWater + 63) / 64;
+    uint32_t runStart = 0, runEnd = 0;
+    bool inRun = false;
+
+    for (uint32_t w = 0; w < numWords; w ++)
+    {
+        uint64_t bits = m_dirty[w];
+        if (!bits)
+            continue;
+        m_dirty[w] = 0;
+
+        while (bits)
+        {
+            uint32_t id = w*64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+
+            if (inRun && id <= runEnd + MaxMergeGap)
+            {
+                runEnd = id + 1;
+                continue;
+            }
+
+            if (inRun)
+                cmdbuf.pushData(m_mem.getGpuAddr() + runStart*DescriptorSize, &m_shadow[runStart], (runEnd - runStart)*DescriptorSize);
+
+            runStart = id;
+            runEnd = id + 1;
+            inRun = true;
+        }
+    }
+
+    if (inRun)
+        cmdbuf.pushData(m_mem.getGpuAddr() + runStart*DescriptorSize, &m_shadow[runStart], (runEnd - runStart)*DescriptorSize);
+
+    // Updated descriptors must not be served from stale cached copies
+    if (inRun)
+        cmdbuf.barrier(DkBarrier_None, DkInvalidateFlags_Descriptors);
+
+    if (m_numRetired && !m_numFenced)
+    {
+        cmdbuf.signalFence(m_retireFence);
+        m_numFenced = m_numRetired;
+    }
+}
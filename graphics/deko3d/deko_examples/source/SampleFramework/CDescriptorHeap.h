@@ -0,0 +1,102 @@
+/*
+** Sample Framework for deko3d Applications
+**   CDescriptorHeap.h: Growable image/sampler descriptor heap with free-list slot allocation
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+
+class CDescriptorHeap
+{
+    static_assert(sizeof(DkImageDescriptor) == sizeof(DkSamplerDescriptor), "shouldn't happen");
+    static_assert(DK_IMAGE_DESCRIPTOR_ALIGNMENT == DK_SAMPLER_DESCRIPTOR_ALIGNMENT, "shouldn't happen");
+    static constexpr size_t DescriptorSize = sizeof(DkImageDescriptor);
+    static constexpr size_t DescriptorAlign = DK_IMAGE_DESCRIPTOR_ALIGNMENT;
+
+    // Dirty runs separated by at most this many clean slots are merged into a single update
+    static constexpr uint32_t MaxMergeGap = 4;
+
+    // Heap memory replaced by a bigger one, kept alive until the GPU is done with it
+    static constexpr unsigned MaxRetired = 8;
+
+    CMemPool* m_pool;
+    CMemPool::Handle m_mem;
+    CMemPool::Handle m_retired[MaxRetired];
+    unsigned m_numRetired;
+    unsigned m_numFenced;
+    dk::Fence m_retireFence;
+
+    DkImageDescriptor* m_shadow;
+    uint64_t* m_dirty;
+    uint32_t* m_freeSlots;
+    uint32_t m_numFree;
+    uint32_t m_highWater;
+    uint32_t m_capacity;
+    uint32_t m_maxCapacity;
+    bool m_needsRebind;
+
+    bool _grow(uint32_t minCapacity);
+    void _reclaimRetired(bool wait);
+    void _setRaw(uint32_t id, void const* descriptor);
+
+    void _markDirty(uint32_t id)
+    {
+        m_dirty[id / 64] |= UINT64_C(1) << (id % 64);
+    }
+
+public:
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+    CDescriptorHeap() : m_pool{}, m_mem{}, m_retired{}, m_numRetired{}, m_numFenced{}, m_retireFence{},
+        m_shadow{}, m_dirty{}, m_freeSlots{}, m_numFree{}, m_highWater{}, m_capacity{}, m_maxCapacity{}, m_needsRebind{} { }
+    ~CDescriptorHeap();
+
+    CDescriptorHeap(CDescriptorHeap const&) = delete;
+    CDescriptorHeap& operator=(CDescriptorHeap const&) = delete;
+
+    // The pool must be CPU accessible, since growing the heap writes the new memory directly
+    bool allocate(CMemPool& pool, uint32_t initialCapacity, uint32_t maxCapacity = 0x10000);
+
+    constexpr uint32_t getCapacity() const { return m_capacity; }
+    constexpr uint32_t getNumUsed() const { return m_highWater - m_numFree; }
+
+    // True after the heap has grown, until it is bound again (indices stay valid regardless)
+    constexpr bool needsRebind() const { return m_needsRebind; }
+
+    void bindForImages(dk::CmdBuf cmdbuf)
+    {
+        cmdbuf.bindImageDescriptorSet(m_mem.getGpuAddr(), m_capacity);
+        m_needsRebind = false;
+    }
+
+    void bindForSamplers(dk::CmdBuf cmdbuf)
+    {
+        cmdbuf.bindSamplerDescriptorSet(m_mem.getGpuAddr(), m_capacity);
+        m_needsRebind = false;
+    }
+
+    // Allocates a slot and fills it in; the returned index stays stable until the slot is removed
+    template <typename T>
+    uint32_t add(T const& descriptor)
+    {
+        static_assert(sizeof(T) == DescriptorSize);
+        uint32_t id = alloc();
+        if (id != InvalidIndex)
+            _setRaw(id, &descriptor);
+        return id;
+    }
+
+    template <typename T>
+    void update(uint32_t id, T const& descriptor)
+    {
+        static_assert(sizeof(T) == DescriptorSize);
+        _setRaw(id, &descriptor);
+    }
+
+    uint32_t alloc();
+    void remove(uint32_t id);
+
+    // Records the commands that upload every descriptor modified since the last flush,
+    // merging neighbouring modifications into as few updates as possible
+    void flush(dk::CmdBuf cmdbuf);
+};
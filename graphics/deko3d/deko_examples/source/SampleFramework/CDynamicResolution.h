@@ -0,0 +1,145 @@
+/*
+** Sample Framework for deko3d Applications
+**   CDynamicResolution.h: Render scale controller driven by the measured GPU frame time
+*/
+#pragma once
+#include "common.h"
+#include <math.h>
+
+class CDynamicResolution
+{
+    uint32_t m_fullWidth;
+    uint32_t m_fullHeight;
+    u64 m_budgetNs;
+    float m_minScale;
+    float m_maxScale;
+    float m_scale;
+    float m_avgNs;
+    unsigned m_overFrames;
+    unsigned m_underFrames;
+
+    void _setScale(float scale)
+    {
+        if (scale < m_minScale) scale = m_minScale;
+        if (scale > m_maxScale) scale = m_maxScale;
+
+        // GPU time roughly follows the number of pixels, so predict the new frame time in
+        // order to avoid reacting again to measurements taken at the old resolution
+        m_avgNs *= (scale*scale) / (m_scale*m_scale);
+        m_scale = scale;
+    }
+
+public:
+    static constexpr u64 Budget60Hz = 16666667;
+    static constexpr u64 Budget30Hz = 33333333;
+
+    // Hysteresis: drop resolution quickly when going over budget, but only raise it after
+    // the frame time has been comfortably below the budget for a while
+    static constexpr float OverBudget = 0.95f;
+    static constexpr float UnderBudget = 0.80f;
+    static constexpr float TargetLoad = 0.85f;
+    static constexpr unsigned DropDelay = 3;
+    static constexpr unsigned RaiseDelay = 30;
+    static constexpr float RaiseStep = 0.05f;
+    static constexpr float Smoothing = 0.2f;
+
+    // Render sizes are kept a multiple of this, as a trade-off between granularity and tile alignment
+    static constexpr uint32_t SizeGranularity = 8;
+
+    CDynamicResolution(u64 budgetNs = Budget60Hz, float minScale = 0.5f, float maxScale = 1.0f) :
+        m_fullWidth{}, m_fullHeight{}, m_budgetNs{budgetNs}, m_minScale{minScale}, m_maxScale{maxScale},
+        m_scale{maxScale}, m_avgNs{}, m_overFrames{}, m_underFrames{} { }
+
+    // Sets the size of the (oversized) render targets, which corresponds to a scale of 1.0
+    void setFullSize(uint32_t width, uint32_t height)
+    {
+        m_fullWidth = width;
+        m_fullHeight = height;
+    }
+
+    void setBudget(u64 budgetNs)
+    {
+        m_budgetNs = budgetNs;
+        m_overFrames = 0;
+        m_underFrames = 0;
+    }
+
+    void reset()
+    {
+        m_scale = m_maxScale;
+        m_avgNs = 0.0f;
+        m_overFrames = 0;
+        m_underFrames = 0;
+    }
+
+    constexpr float getScale() const { return m_scale; }
+    constexpr u64 getBudget() const { return m_budgetNs; }
+    constexpr float getAverageNs() const { return m_avgNs; }
+
+    uint32_t getRenderWidth() const
+    {
+        uint32_t w = uint32_t(m_fullWidth*m_scale + 0.5f) &~ (SizeGranularity - 1);
+        return w < SizeGranularity ? SizeGranularity : (w > m_fullWidth ? m_fullWidth : w);
+    }
+
+    uint32_t getRenderHeight() const
+    {
+        uint32_t h = uint32_t(m_fullHeight*m_scale + 0.5f) &~ (SizeGranularity - 1);
+        return h < SizeGranularity ? SizeGranularity : (h > m_fullHeight ? m_fullHeight : h);
+    }
+
+    // Feeds a new GPU frame time measurement (0 meaning none is available), and returns
+    // true if the render scale was changed as a result
+    bool update(u64 gpuNs)
+    {
+        if (!gpuNs)
+            return false;
+
+        m_avgNs = m_avgNs != 0.0f ? m_avgNs + (float(gpuNs) - m_avgNs)*Smoothing : float(gpuNs);
+
+        float oldScale = m_scale;
+        if (m_avgNs > m_budgetNs*OverBudget)
+        {
+            m_underFrames = 0;
+            if (++m_overFrames >= DropDelay)
+            {
+                // Jump straight to the scale expected to bring the load down to the target
+                m_overFrames = 0;
+                _setScale(m_scale * sqrtf(m_budgetNs*TargetLoad / m_avgNs));
+            }
+        }
+        else if (m_avgNs < m_budgetNs*UnderBudget)
+        {
+            m_overFrames = 0;
+            if (++m_underFrames >= RaiseDelay)
+            {
+                m_underFrames = 0;
+                _setScale(m_scale + RaiseStep);
+            }
+        }
+        else
+        {
+            m_overFrames = 0;
+            m_underFrames = 0;
+        }
+
+        return m_scale != oldScale;
+    }
+
+    // Restricts rendering to the top-left area of the render targets corresponding to the current scale
+    void setViewports(dk::CmdBuf cmdbuf, unsigned numViewports = 1) const
+    {
+        uint32_t width = getRenderWidth(), height = getRenderHeight();
+        for (unsigned i = 0; i < numViewports; i ++)
+        {
+            cmdbuf.setViewports(i, { { 0.0f, 0.0f, float(width), float(height), 0.0f, 1.0f } });
+            cmdbuf.setScissors(i, { { 0, 0, width, height } });
+        }
+    }
+
+    // Makes the presentation engine upscale the rendered area to the entire screen
+    void setCrop(dk::Swapchain swapchain) const
+    {
+        swapchain.setCrop(0, 0, getRenderWidth(), getRenderHeight());
+    }
+};
@@ -5,15 +5,62 @@
 #include "CExternalImage.h"
 #include "FileLoader.h"
 
+#define DKTX_MAGIC 0x58544B44 // 'DKTX'
+
+struct DktxHeader
+{
+    uint32_t magic; // DKTX_MAGIC
+    uint32_t header_sz; // sizeof(DktxHeader)
+    uint32_t format; // DktxFormat
+    uint32_t width;
+    uint32_t height;
+    uint32_t num_layers;
+    uint32_t num_levels;
+    uint32_t levels_off; // offset of the DktxLevel table
+};
+
+struct DktxLevel
+{
+    uint32_t data_off; // all layers of the level are stored back to back
+    uint32_t data_sz;
+};
+
+namespace
+{
+    constexpr uint32_t DktxMaxLevels = 16;
+
+    // Format identifiers used by the container (kept independent from the DkImageFormat enum values)
+    constexpr DkImageFormat DktxFormats[] =
+    {
+        DkImageFormat_None,
+        DkImageFormat_RGBA8_Unorm,
+        DkImageFormat_RGBA8_Unorm_sRGB,
+        DkImageFormat_RGB_BC1,
+        DkImageFormat_RGBA_BC2,
+        DkImageFormat_RGBA_BC3,
+        DkImageFormat_RGBA_BC7U,
+        DkImageFormat_RGBA_ASTC_4x4,
+    };
+}
+
 bool CExternalImage::load(CMemPool& imagePool, CMemPool& scratchPool, dk::Device device, dk::Queue transferQueue, const char* path, uint32_t width, uint32_t height, DkImageFormat format, uint32_t flags)
 {
-    CMemPool::Handle tempimgmem = LoadFile(scratchPool, path, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
-    if (!tempimgmem)
+    CImageUploadBatch batch;
+    if (!batch.init(scratchPool, device, transferQueue, DK_MEMBLOCK_ALIGNMENT))
+        return false;
+
+    if (!load(batch, imagePool, device, path, width, height, format, flags))
         return false;
 
-    dk::UniqueCmdBuf tempcmdbuf = dk::CmdBufMaker{device}.create();
-    CMemPool::Handle tempcmdmem = scratchPool.allocate(DK_MEMBLOCK_ALIGNMENT);
-    tempcmdbuf.addMemory(tempcmdmem.getMemBlock(), tempcmdmem.getOffset(), tempcmdmem.getSize());
+    batch.finish();
+    return true;
+}
+
+bool CExternalImage::load(CImageUploadBatch& batch, CMemPool& imagePool, dk::Device device, const char* path, uint32_t width, uint32_t height, DkImageFormat format, uint32_t flags)
+{
+    CMemPool::Handle tempimgmem = LoadFile(batch.getScratchPool(), path, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
+    if (!tempimgmem)
+        return false;
 
     dk::ImageLayout layout;
     dk::ImageLayoutMaker{device}
@@ -22,16 +69,163 @@ bool CExternalImage::load(CMemPool& imagePool, CMemPool& scratchPool, dk::Device
         .setDimensions(width, height)
         .initialize(layout);
 
+    m_mem.destroy();
     m_mem = imagePool.allocate(layout.getSize(), layout.getAlignment());
+    if (!m_mem)
+    {
+        tempimgmem.destroy();
+        return false;
+    }
+
     m_image.initialize(layout, m_mem.getMemBlock(), m_mem.getOffset());
     m_descriptor.initialize(m_image);
+    m_numLevels = 1;
+    m_firstLevel = 0;
 
     dk::ImageView imageView{m_image};
-    tempcmdbuf.copyBufferToImage({ tempimgmem.getGpuAddr() }, imageView, { 0, 0, 0, width, height, 1 });
-    transferQueue.submitCommands(tempcmdbuf.finishList());
-    transferQueue.waitIdle();
+    batch.upload(tempimgmem, imageView, { 0, 0, 0, width, height, 1 });
+    return true;
+}
+
+bool CExternalImage::loadContainer(CImageUploadBatch& batch, CMemPool& imagePool, dk::Device device, const char* path, uint32_t flags, uint32_t maxInitialLevels)
+{
+    DktxHeader hdr;
+    DktxLevel levels[DktxMaxLevels];
+
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+
+    if (!fread(&hdr, sizeof(hdr), 1, f) || hdr.magic != DKTX_MAGIC || hdr.header_sz != sizeof(hdr))
+        goto _fail;
+
+    if (!hdr.format || hdr.format >= sizeof(DktxFormats)/sizeof(DktxFormats[0]))
+        goto _fail;
+
+    if (!hdr.width || !hdr.height || !hdr.num_layers || !hdr.num_levels || hdr.num_levels > DktxMaxLevels)
+        goto _fail;
+
+    fseek(f, hdr.levels_off, SEEK_SET);
+    if (!fread(levels, sizeof(DktxLevel)*hdr.num_levels, 1, f))
+        goto _fail;
+
+    {
+        dk::ImageLayout layout;
+        dk::ImageLayoutMaker{device}
+            .setType(hdr.num_layers > 1 ? DkImageType_2DArray : DkImageType_2D)
+            .setFlags(flags)
+            .setFormat(DktxFormats[hdr.format])
+            .setDimensions(hdr.width, hdr.height, hdr.num_layers)
+            .setMipLevels(hdr.num_levels)
+            .initialize(layout);
 
-    tempcmdmem.destroy();
-    tempimgmem.destroy();
+        m_mem.destroy();
+        m_mem = imagePool.allocate(layout.getSize(), layout.getAlignment());
+        if (!m_mem)
+            goto _fail;
+
+        m_image.initialize(layout, m_mem.getMemBlock(), m_mem.getOffset());
+    }
+
+    free(m_streamPath);
+    m_streamPath = nullptr;
+    m_numLevels = hdr.num_levels;
+    m_firstLevel = hdr.num_levels;
+    if (maxInitialLevels && maxInitialLevels < hdr.num_levels)
+    {
+        // Remember where to find the rest of the mip chain
+        m_streamPath = strdup(path);
+        m_firstLevel -= maxInitialLevels;
+    }
+    else
+        m_firstLevel = 0;
+
+    if (!_uploadLevels(batch, f, hdr, levels, m_firstLevel, m_numLevels))
+    {
+        m_mem.destroy();
+        goto _fail;
+    }
+
+    fclose(f);
+    _updateDescriptor();
+    return true;
+
+_fail:
+    fclose(f);
+    return false;
+}
+
+bool CExternalImage::streamLevels(CImageUploadBatch& batch)
+{
+    if (!m_streamPath || !m_firstLevel)
+        return true;
+
+    DktxHeader hdr;
+    DktxLevel levels[DktxMaxLevels];
+
+    FILE* f = fopen(m_streamPath, "rb");
+    if (!f) return false;
+
+    bool ok = fread(&hdr, sizeof(hdr), 1, f) && hdr.num_levels == m_numLevels;
+    if (ok)
+    {
+        fseek(f, hdr.levels_off, SEEK_SET);
+        ok = fread(levels, sizeof(DktxLevel)*hdr.num_levels, 1, f);
+    }
+
+    if (ok)
+        ok = _uploadLevels(batch, f, hdr, levels, 0, m_firstLevel);
+    fclose(f);
+
+    if (!ok)
+        return false;
+
+    free(m_streamPath);
+    m_streamPath = nullptr;
+    m_firstLevel = 0;
+    _updateDescriptor();
     return true;
 }
+
+bool CExternalImage::_uploadLevels(CImageUploadBatch& batch, FILE* f, DktxHeader const& hdr, DktxLevel const* levels, uint32_t first, uint32_t last)
+{
+    static constexpr uint32_t Align = DK_IMAGE_LINEAR_STRIDE_ALIGNMENT;
+
+    // All requested levels are read into a single staging allocation, and copied in one go
+    uint32_t totalSize = 0;
+    for (uint32_t i = first; i < last; i ++)
+        totalSize += (levels[i].data_sz + Align - 1) &~ (Align - 1);
+
+    CMemPool::Handle staging = batch.getScratchPool().allocate(totalSize, Align);
+    if (!staging)
+        return false;
+
+    uint32_t offset = 0;
+    for (uint32_t i = first; i < last; i ++)
+    {
+        fseek(f, levels[i].data_off, SEEK_SET);
+        if (!fread((u8*)staging.getCpuAddr() + offset, levels[i].data_sz, 1, f))
+        {
+            staging.destroy();
+            return false;
+        }
+
+        uint32_t width  = hdr.width  >> i; if (!width)  width  = 1;
+        uint32_t height = hdr.height >> i; if (!height) height = 1;
+
+        dk::ImageView view{m_image};
+        view.setMipLevels(i, 1);
+        batch.copy(staging.getGpuAddr() + offset, view, { 0, 0, 0, width, height, hdr.num_layers });
+        offset += (levels[i].data_sz + Align - 1) &~ (Align - 1);
+    }
+
+    batch.release(staging);
+    return true;
+}
+
+void CExternalImage::_updateDescriptor()
+{
+    // Only expose the levels that have actually been uploaded
+    dk::ImageView view{m_image};
+    view.setMipLevels(m_firstLevel, m_numLevels - m_firstLevel);
+    m_descriptor.initialize(view);
+}
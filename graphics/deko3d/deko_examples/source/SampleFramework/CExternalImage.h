@@ -5,16 +5,25 @@
 #pragma once
 #include "common.h"
 #include "CMemPool.h"
+#include "CImageUploadBatch.h"
 
 class CExternalImage
 {
     dk::Image m_image;
     dk::ImageDescriptor m_descriptor;
     CMemPool::Handle m_mem;
+    char* m_streamPath;
+    uint32_t m_numLevels;
+    uint32_t m_firstLevel;
+
+    bool _uploadLevels(CImageUploadBatch& batch, FILE* f, struct DktxHeader const& hdr, struct DktxLevel const* levels, uint32_t first, uint32_t last);
+    void _updateDescriptor();
+
 public:
-    CExternalImage() : m_image{}, m_descriptor{}, m_mem{} { }
+    CExternalImage() : m_image{}, m_descriptor{}, m_mem{}, m_streamPath{}, m_numLevels{}, m_firstLevel{} { }
     ~CExternalImage()
     {
+        free(m_streamPath);
         m_mem.destroy();
     }
 
@@ -33,5 +42,27 @@ public:
         return m_descriptor;
     }
 
+    constexpr uint32_t getNumLevels() const
+    {
+        return m_numLevels;
+    }
+
+    // Index of the most detailed mip level that has been uploaded so far
+    constexpr uint32_t getFirstResidentLevel() const
+    {
+        return m_firstLevel;
+    }
+
     bool load(CMemPool& imagePool, CMemPool& scratchPool, dk::Device device, dk::Queue transferQueue, const char* path, uint32_t width, uint32_t height, DkImageFormat format, uint32_t flags = 0);
+
+    // Records the upload into the given batch instead of waiting for it; the image
+    // must not be used by the GPU before the batch has been submitted
+    bool load(CImageUploadBatch& batch, CMemPool& imagePool, dk::Device device, const char* path, uint32_t width, uint32_t height, DkImageFormat format, uint32_t flags = 0);
+
+    // Loads a .dktx texture container (see tools/mkdktx.py), which carries the format, dimensions,
+    // array layers and the full mip chain. If maxInitialLevels is non-zero, only that many of the
+    // smallest mip levels are uploaded now, and the descriptor is clamped to them; the rest can be
+    // brought in later with streamLevels(), after which the descriptor must be uploaded again.
+    bool loadContainer(CImageUploadBatch& batch, CMemPool& imagePool, dk::Device device, const char* path, uint32_t flags = 0, uint32_t maxInitialLevels = 0);
+    bool streamLevels(CImageUploadBatch& batch);
 };
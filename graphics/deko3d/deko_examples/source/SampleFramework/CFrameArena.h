@@ -0,0 +1,92 @@
+/*
+** Sample Framework for deko3d Applications
+**   CFrameArena.h: Linear (bump) allocator for transient per-frame GPU data
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+
+template <unsigned NumSlices>
+class CFrameArena
+{
+    static_assert(NumSlices > 0, "Need a non-zero number of slices...");
+    CMemPool::Handle m_mem;
+    uint32_t m_sliceSize;
+    uint32_t m_curOffset;
+    unsigned m_curSlice;
+    dk::Fence m_fences[NumSlices];
+public:
+    class Allocation
+    {
+        void* m_cpuAddr;
+        DkGpuAddr m_gpuAddr;
+        uint32_t m_size;
+    public:
+        constexpr Allocation() : m_cpuAddr{}, m_gpuAddr{DK_GPU_ADDR_INVALID}, m_size{} { }
+        constexpr Allocation(void* cpuAddr, DkGpuAddr gpuAddr, uint32_t size) : m_cpuAddr{cpuAddr}, m_gpuAddr{gpuAddr}, m_size{size} { }
+
+        constexpr operator bool() const { return m_size != 0; }
+        constexpr bool operator!() const { return m_size == 0; }
+
+        constexpr void* getCpuAddr() const { return m_cpuAddr; }
+        constexpr DkGpuAddr getGpuAddr() const { return m_gpuAddr; }
+        constexpr uint32_t getSize() const { return m_size; }
+    };
+
+    CFrameArena() : m_mem{}, m_sliceSize{}, m_curOffset{}, m_curSlice{}, m_fences{} { }
+    ~CFrameArena()
+    {
+        m_mem.destroy();
+    }
+
+    bool allocate(CMemPool& pool, uint32_t sliceSize, uint32_t sliceAlignment = DK_UNIFORM_BUF_ALIGNMENT)
+    {
+        m_sliceSize = (sliceSize + sliceAlignment - 1) &~ (sliceAlignment - 1);
+        m_mem = pool.allocate(NumSlices*m_sliceSize, sliceAlignment);
+        return m_mem;
+    }
+
+    constexpr uint32_t getSliceSize() const { return m_sliceSize; }
+    constexpr uint32_t getUsedSize() const { return m_curOffset; }
+
+    void begin()
+    {
+        // Wait for the GPU to be done with the data previously placed in the current slice,
+        // after which the whole slice can be reused by simply rewinding the bump pointer
+        m_fences[m_curSlice].wait();
+        m_curOffset = 0;
+    }
+
+    void end(dk::CmdBuf cmdbuf)
+    {
+        // Signal the fence corresponding to the current slice once the GPU has consumed
+        // the commands recorded so far (and thus all data allocated during this frame)
+        cmdbuf.signalFence(m_fences[m_curSlice]);
+
+        // Advance the current slice counter; wrapping around when we reach the end
+        m_curSlice = (m_curSlice + 1) % NumSlices;
+    }
+
+    Allocation alloc(uint32_t size, uint32_t alignment = DK_CMDMEM_ALIGNMENT)
+    {
+        if (!size || (alignment & (alignment - 1)))
+            return Allocation{};
+
+        uint32_t offset = (m_curOffset + alignment - 1) &~ (alignment - 1);
+        if (offset > m_sliceSize || size > m_sliceSize - offset)
+            return Allocation{};
+
+        m_curOffset = offset + size;
+        offset += m_curSlice * m_sliceSize;
+        return Allocation{ (u8*)m_mem.getCpuAddr() + offset, m_mem.getGpuAddr() + offset, size };
+    }
+
+    template <typename T>
+    Allocation push(T const& data, uint32_t alignment = alignof(T))
+    {
+        Allocation ret = alloc(sizeof(T), alignment);
+        if (ret)
+            memcpy(ret.getCpuAddr(), &data, sizeof(T));
+        return ret;
+    }
+};
@@ -0,0 +1,135 @@
+/*
+** Sample Framework for deko3d Applications
+**   CFramePipeline.h: Per-frame resource ring allowing the CPU to run ahead of the GPU
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+#include "CFrameArena.h"
+
+template <unsigned MaxFramesInFlight = 3>
+class CFramePipeline
+{
+    static_assert(MaxFramesInFlight >= 1 && MaxFramesInFlight <= 3, "Between 1 and 3 frames can be in flight");
+    CMemPool::Handle m_cmdMem;
+    CMemPool::Handle m_uniformMem;
+    uint32_t m_cmdSliceSize;
+    uint32_t m_uniformSliceSize;
+    uint32_t m_uniformOffset;
+    unsigned m_numFrames;
+    unsigned m_curFrame;
+    dk::Fence m_fences[MaxFramesInFlight];
+public:
+    using Allocation = typename CFrameArena<MaxFramesInFlight>::Allocation;
+
+    CFramePipeline() : m_cmdMem{}, m_uniformMem{}, m_cmdSliceSize{}, m_uniformSliceSize{}, m_uniformOffset{},
+        m_numFrames{MaxFramesInFlight}, m_curFrame{}, m_fences{} { }
+    ~CFramePipeline()
+    {
+        waitIdle();
+        m_uniformMem.destroy();
+        m_cmdMem.destroy();
+    }
+
+    // Allocates per-frame command memory and (optionally) per-frame uniform memory for the
+    // maximum number of frames in flight, so that the actual number can be changed later on
+    bool allocate(CMemPool& pool, uint32_t cmdSize, uint32_t uniformSize = 0)
+    {
+        m_cmdSliceSize = (cmdSize + DK_CMDMEM_ALIGNMENT - 1) &~ (DK_CMDMEM_ALIGNMENT - 1);
+        m_cmdMem = pool.allocate(MaxFramesInFlight*m_cmdSliceSize);
+        if (!m_cmdMem)
+            return false;
+
+        if (uniformSize)
+        {
+            m_uniformSliceSize = (uniformSize + DK_UNIFORM_BUF_ALIGNMENT - 1) &~ (DK_UNIFORM_BUF_ALIGNMENT - 1);
+            m_uniformMem = pool.allocate(MaxFramesInFlight*m_uniformSliceSize, DK_UNIFORM_BUF_ALIGNMENT);
+            if (!m_uniformMem)
+            {
+                m_cmdMem.destroy();
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    constexpr unsigned getFramesInFlight() const { return m_numFrames; }
+    constexpr unsigned getFrameIndex() const { return m_curFrame; }
+    constexpr uint32_t getUniformSliceSize() const { return m_uniformSliceSize; }
+
+    // Waits for the GPU to finish every frame that is still in flight
+    void waitIdle()
+    {
+        for (unsigned i = 0; i < MaxFramesInFlight; i ++)
+            m_fences[i].wait();
+    }
+
+    // Changes how many frames the CPU is allowed to record ahead of the GPU: 1 gives the lowest
+    // latency (the CPU waits for the previous frame), 3 gives the most CPU/GPU overlap
+    void setFramesInFlight(unsigned numFrames)
+    {
+        if (numFrames < 1) numFrames = 1;
+        if (numFrames > MaxFramesInFlight) numFrames = MaxFramesInFlight;
+        if (numFrames == m_numFrames)
+            return;
+
+        // The slot assignment changes, so drain the pipeline first
+        waitIdle();
+        m_numFrames = numFrames;
+        m_curFrame = 0;
+    }
+
+    void begin(dk::CmdBuf cmdbuf)
+    {
+        // Clear/reset the command buffer, which also destroys all command list handles
+        cmdbuf.clear();
+
+        // Wait for the frame that last used this slot, that is, the one submitted
+        // getFramesInFlight() frames ago, and feed its command memory to the command buffer
+        m_fences[m_curFrame].wait();
+        cmdbuf.addMemory(m_cmdMem.getMemBlock(), m_cmdMem.getOffset() + m_curFrame*m_cmdSliceSize, m_cmdSliceSize);
+
+        // Rewind the uniform memory of this slot; since it gets written by the CPU make
+        // sure the GPU does not see stale cached contents from the last time it was used
+        m_uniformOffset = 0;
+        if (m_uniformMem)
+            cmdbuf.barrier(DkBarrier_None, DkInvalidateFlags_L2Cache);
+    }
+
+    DkCmdList end(dk::CmdBuf cmdbuf)
+    {
+        // Signal the fence corresponding to the current slot, covering all commands submitted so far
+        cmdbuf.signalFence(m_fences[m_curFrame]);
+
+        // Advance to the next slot, wrapping around according to the current number of frames in flight
+        m_curFrame = (m_curFrame + 1) % m_numFrames;
+
+        // Finish off the command list, returning it to the caller
+        return cmdbuf.finishList();
+    }
+
+    // Sub-allocates an uniform block valid for the current frame only
+    Allocation allocUniform(uint32_t size)
+    {
+        uint32_t offset = (m_uniformOffset + DK_UNIFORM_BUF_ALIGNMENT - 1) &~ (DK_UNIFORM_BUF_ALIGNMENT - 1);
+        if (!size || size > DK_UNIFORM_BUF_MAX_SIZE || offset > m_uniformSliceSize || size > m_uniformSliceSize - offset)
+            return Allocation{};
+
+        m_uniformOffset = offset + size;
+        offset += m_curFrame*m_uniformSliceSize;
+        return Allocation{ (u8*)m_uniformMem.getCpuAddr() + offset, m_uniformMem.getGpuAddr() + offset, size };
+    }
+
+    template <typename T>
+    Allocation pushUniform(dk::CmdBuf cmdbuf, DkStage stage, uint32_t id, T const& data)
+    {
+        Allocation block = allocUniform(sizeof(T));
+        if (block)
+        {
+            memcpy(block.getCpuAddr(), &data, sizeof(T));
+            cmdbuf.bindUniformBuffer(stage, id, block.getGpuAddr(), block.getSize());
+        }
+        return block;
+    }
+};
@@ -0,0 +1,194 @@
+/*
+** Sample Framework for deko3d Applications
+**   CGpuProfiler.h: GPU timestamp based per-pass profiler
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+
+template <unsigned NumFrames>
+class CGpuProfiler
+{
+    static_assert(NumFrames > 0, "Need a non-zero number of frames...");
+public:
+    static constexpr unsigned MaxPasses = 16;
+    static constexpr unsigned HistorySize = 64;
+    static constexpr unsigned InvalidPass = ~0U;
+
+    struct PassStats
+    {
+        const char* name;
+        u64 minNs;
+        u64 avgNs;
+        u64 maxNs;
+        unsigned numSamples;
+    };
+
+private:
+    // Layout of the data written by DkCounter_Timestamp reports
+    struct Report
+    {
+        u64 value;
+        u64 timestamp;
+    };
+
+    static constexpr uint32_t FrameSize = 2*MaxPasses*sizeof(Report);
+
+    struct Pass
+    {
+        const char* name;
+        u32 history[HistorySize];
+        unsigned head;
+        unsigned count;
+    };
+
+    CMemPool::Handle m_mem;
+    Pass m_passes[MaxPasses];
+    unsigned m_numPasses;
+    unsigned m_curFrame;
+    u32 m_written[NumFrames];
+    dk::Fence m_fences[NumFrames];
+
+    Report* _getReports(unsigned frame) const
+    {
+        return (Report*)((u8*)m_mem.getCpuAddr() + frame*FrameSize);
+    }
+
+    DkGpuAddr _getReportAddr(unsigned pass, bool end) const
+    {
+        return m_mem.getGpuAddr() + m_curFrame*FrameSize + (2*pass + end)*sizeof(Report);
+    }
+
+    static constexpr u64 _ticksToNs(u64 ticks)
+    {
+        // The GPU timer runs at 614.4 MHz
+        return ticks * 625 / 384;
+    }
+
+    void _resolve(unsigned frame)
+    {
+        Report const* reports = _getReports(frame);
+        for (unsigned i = 0; i < m_numPasses; i ++)
+        {
+            if (!(m_written[frame] & (1U << i)))
+                continue;
+
+            Pass& pass = m_passes[i];
+            u64 start = reports[2*i+0].timestamp;
+            u64 end   = reports[2*i+1].timestamp;
+            pass.history[pass.head] = end > start ? _ticksToNs(end - start) : 0;
+            pass.head = (pass.head + 1) % HistorySize;
+            if (pass.count < HistorySize)
+                pass.count ++;
+        }
+        m_written[frame] = 0;
+    }
+
+public:
+    CGpuProfiler() : m_mem{}, m_passes{}, m_numPasses{}, m_curFrame{}, m_written{}, m_fences{} { }
+    ~CGpuProfiler()
+    {
+        m_mem.destroy();
+    }
+
+    // The pool must be CPU accessible, since the results are read back directly
+    bool allocate(CMemPool& pool)
+    {
+        m_mem = pool.allocate(NumFrames*FrameSize, DK_CMDMEM_ALIGNMENT);
+        if (!m_mem || !m_mem.getCpuAddr())
+        {
+            m_mem.destroy();
+            return false;
+        }
+        return true;
+    }
+
+    unsigned registerPass(const char* name)
+    {
+        if (m_numPasses == MaxPasses)
+            return InvalidPass;
+        m_passes[m_numPasses].name = name;
+        return m_numPasses++;
+    }
+
+    constexpr unsigned getNumPasses() const { return m_numPasses; }
+
+    void beginFrame()
+    {
+        // Wait for the GPU to finish the frame that last used this slot (normally this
+        // has happened long ago), and fold its timestamps into the rolling history
+        m_fences[m_curFrame].wait();
+        _resolve(m_curFrame);
+    }
+
+    void endFrame(dk::CmdBuf cmdbuf)
+    {
+        cmdbuf.signalFence(m_fences[m_curFrame]);
+        m_curFrame = (m_curFrame + 1) % NumFrames;
+    }
+
+    // Passes can only be measured once per frame; the commands being measured are those
+    // submitted between the command lists containing the begin and end markers
+    void begin(dk::CmdBuf cmdbuf, unsigned pass)
+    {
+        if (pass >= m_numPasses)
+            return;
+        cmdbuf.reportCounter(DkCounter_Timestamp, _getReportAddr(pass, false));
+    }
+
+    void end(dk::CmdBuf cmdbuf, unsigned pass)
+    {
+        if (pass >= m_numPasses)
+            return;
+        cmdbuf.reportCounter(DkCounter_Timestamp, _getReportAddr(pass, true));
+        m_written[m_curFrame] |= 1U << pass;
+    }
+
+    // Returns the most recently resolved measurement of a pass (or 0 if there is none yet)
+    u64 getLastNs(unsigned pass) const
+    {
+        if (pass >= m_numPasses || !m_passes[pass].count)
+            return 0;
+        Pass const& p = m_passes[pass];
+        return p.history[(p.head + HistorySize - 1) % HistorySize];
+    }
+
+    bool getStats(unsigned pass, PassStats& stats) const
+    {
+        if (pass >= m_numPasses)
+            return false;
+
+        Pass const& p = m_passes[pass];
+        stats.name = p.name;
+        stats.numSamples = p.count;
+        stats.minNs = p.count ? UINT64_MAX : 0;
+        stats.avgNs = 0;
+        stats.maxNs = 0;
+
+        u64 total = 0;
+        for (unsigned i = 0; i < p.count; i ++)
+        {
+            u64 ns = p.history[i];
+            total += ns;
+            if (ns < stats.minNs) stats.minNs = ns;
+            if (ns > stats.maxNs) stats.maxNs = ns;
+        }
+        if (p.count)
+            stats.avgNs = total / p.count;
+        return true;
+    }
+
+    void printStats() const
+    {
+        for (unsigned i = 0; i < m_numPasses; i ++)
+        {
+            PassStats stats;
+            getStats(i, stats);
+            printf("[gpu] %-16s min %6lu.%03lu us  avg %6lu.%03lu us  max %6lu.%03lu us  (%u frames)\n", stats.name,
+                stats.minNs / 1000, stats.minNs % 1000,
+                stats.avgNs / 1000, stats.avgNs % 1000,
+                stats.maxNs / 1000, stats.maxNs % 1000,
+                stats.numSamples);
+        }
+    }
+};
@@ -0,0 +1,113 @@
+/*
+** Sample Framework for deko3d Applications
+**   CImageUploadBatch.cpp: Batches many buffer-to-image copies into a few command lists
+*/
+#include "CImageUploadBatch.h"
+
+bool CImageUploadBatch::init(CMemPool& scratchPool, dk::Device device, dk::Queue transferQueue, uint32_t cmdMemSize)
+{
+    m_scratchPool = &scratchPool;
+    m_queue = transferQueue;
+    m_cmdbuf = dk::CmdBufMaker{device}.create();
+    if (!m_cmdbuf)
+        return false;
+
+    for (unsigned i = 0; i < NumGenerations; i ++)
+    {
+        Generation& gen = m_gens[i];
+        gen.m_cmdmem = scratchPool.allocate(cmdMemSize);
+        if (!gen.m_cmdmem)
+            return false;
+        gen.m_numStaging = 0;
+        gen.m_stagingBytes = 0;
+        gen.m_inFlight = false;
+    }
+
+    m_curGen = 0;
+    _begin();
+    return true;
+}
+
+void CImageUploadBatch::_retire(Generation& gen)
+{
+    if (!gen.m_inFlight)
+        return;
+
+    gen.m_fence.wait();
+    for (unsigned i = 0; i < gen.m_numStaging; i ++)
+        gen.m_staging[i].destroy();
+    gen.m_numStaging = 0;
+    gen.m_stagingBytes = 0;
+    gen.m_inFlight = false;
+}
+
+void CImageUploadBatch::_begin()
+{
+    // Make sure the generation we are about to record into is no longer in use by the GPU,
+    // and feed its command memory to the command buffer
+    Generation& gen = m_gens[m_curGen];
+    _retire(gen);
+
+    m_cmdbuf.clear();
+    m_cmdbuf.addMemory(gen.m_cmdmem.getMemBlock(), gen.m_cmdmem.getOffset(), gen.m_cmdmem.getSize());
+    m_numRecorded = 0;
+}
+
+void CImageUploadBatch::upload(CMemPool::Handle staging, dk::ImageView const& dstView, DkImageRect const& rect, uint32_t flags)
+{
+    copy(staging.getGpuAddr(), dstView, rect, flags);
+    release(staging);
+}
+
+void CImageUploadBatch::copy(DkGpuAddr src, dk::ImageView const& dstView, DkImageRect const& rect, uint32_t flags)
+{
+    m_cmdbuf.copyBufferToImage({ src }, dstView, rect, flags);
+    m_numRecorded ++;
+}
+
+void CImageUploadBatch::release(CMemPool::Handle staging)
+{
+    Generation& gen = m_gens[m_curGen];
+    gen.m_staging[gen.m_numStaging++] = staging;
+    gen.m_stagingBytes += staging.getSize();
+
+    // Kick off the copies early if we have accumulated too much staging memory,
+    // so that a long series of uploads does not exhaust the scratch pool
+    if (gen.m_numStaging == MaxUploadsPerGeneration || gen.m_stagingBytes >= MaxStagingPerGeneration)
+        submit();
+}
+
+void CImageUploadBatch::submit()
+{
+    if (!m_numRecorded)
+        return;
+
+    Generation& gen = m_gens[m_curGen];
+    m_cmdbuf.signalFence(gen.m_fence);
+    m_queue.submitCommands(m_cmdbuf.finishList());
+    m_queue.flush();
+    gen.m_inFlight = true;
+
+    m_curGen = (m_curGen + 1) % NumGenerations;
+    _begin();
+}
+
+void CImageUploadBatch::finish()
+{
+    if (!m_cmdbuf)
+        return;
+
+    submit();
+    for (unsigned i = 0; i < NumGenerations; i ++)
+        _retire(m_gens[i]);
+}
+
+void CImageUploadBatch::reclaim()
+{
+    for (unsigned i = 0; i < NumGenerations; i ++)
+    {
+        Generation& gen = m_gens[i];
+        if (gen.m_inFlight && gen.m_fence.wait(0) == DkResult_Success)
+            _retire(gen);
+    }
+}
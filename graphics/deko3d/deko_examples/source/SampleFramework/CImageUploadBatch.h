@@ -0,0 +1,68 @@
+/*
+** Sample Framework for deko3d Applications
+**   CImageUploadBatch.h: Batches many buffer-to-image copies into a few command lists
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+
+class CImageUploadBatch
+{
+    static constexpr unsigned NumGenerations = 2;
+    static constexpr unsigned MaxUploadsPerGeneration = 128;
+    static constexpr uint64_t MaxStagingPerGeneration = 0x2000000;
+
+    struct Generation
+    {
+        CMemPool::Handle m_cmdmem;
+        CMemPool::Handle m_staging[MaxUploadsPerGeneration];
+        unsigned m_numStaging;
+        uint64_t m_stagingBytes;
+        dk::Fence m_fence;
+        bool m_inFlight;
+    };
+
+    CMemPool* m_scratchPool;
+    dk::Queue m_queue;
+    dk::UniqueCmdBuf m_cmdbuf;
+    Generation m_gens[NumGenerations];
+    unsigned m_curGen;
+    unsigned m_numRecorded;
+
+    void _retire(Generation& gen);
+    void _begin();
+
+public:
+    CImageUploadBatch() : m_scratchPool{}, m_queue{}, m_cmdbuf{}, m_gens{}, m_curGen{}, m_numRecorded{} { }
+    ~CImageUploadBatch()
+    {
+        finish();
+        for (unsigned i = 0; i < NumGenerations; i ++)
+            m_gens[i].m_cmdmem.destroy();
+    }
+
+    CImageUploadBatch(CImageUploadBatch const&) = delete;
+    CImageUploadBatch& operator=(CImageUploadBatch const&) = delete;
+
+    bool init(CMemPool& scratchPool, dk::Device device, dk::Queue transferQueue, uint32_t cmdMemSize = 0x10000);
+
+    constexpr CMemPool& getScratchPool() const { return *m_scratchPool; }
+
+    // Records a copy from the staging memory into the image. The batch takes ownership of
+    // the staging memory, which is freed once the GPU has finished the copy.
+    void upload(CMemPool::Handle staging, dk::ImageView const& dstView, DkImageRect const& rect, uint32_t flags = 0);
+
+    // Lower level interface for uploads sourced from parts of a larger staging allocation:
+    // record any number of copies, then hand over the staging memory with release()
+    void copy(DkGpuAddr src, dk::ImageView const& dstView, DkImageRect const& rect, uint32_t flags = 0);
+    void release(CMemPool::Handle staging);
+
+    // Submits all copies recorded so far, without waiting for them to complete
+    void submit();
+
+    // Submits all pending copies and waits for every upload made through this batch to complete
+    void finish();
+
+    // Frees the staging memory of submitted copies that have completed, without blocking
+    void reclaim();
+};
@@ -4,6 +4,8 @@
 */
 #include "CMemPool.h"
 
+static thread_local CMemPool::ThreadCache* s_threadCaches;
+
 inline auto CMemPool::_newSlice() -> Slice*
 {
     Slice* ret = m_sliceHeap.pop();
@@ -17,6 +19,144 @@ inline void CMemPool::_deleteSlice(Slice* s)
     m_sliceHeap.add(s);
 }
 
+void CMemPool::_initBackend(Backend backend)
+{
+    if (backend == Backend::Tlsf)
+        m_tlsf = (TlsfIndex*)::calloc(1, sizeof(TlsfIndex));
+}
+
+// Sizes below NumSL get first level 0 and one list each. Above that, the first level is the
+// position of the top bit, and the second level is given by the SLBits bits following it.
+inline void CMemPool::tlsfMapping(uint32_t size, unsigned& fl, unsigned& sl)
+{
+    if (size < TlsfIndex::NumSL)
+    {
+        fl = 0;
+        sl = size;
+        return;
+    }
+
+    unsigned msb = 31 - __builtin_clz(size);
+    fl = msb - TlsfIndex::SLBits + 1;
+    sl = (size >> (msb - TlsfIndex::SLBits)) ^ TlsfIndex::NumSL;
+}
+
+// Finds the first non-empty list at or after [fl][sl]
+inline bool CMemPool::_tlsfNextBin(unsigned& fl, unsigned& sl) const
+{
+    if (fl >= TlsfIndex::NumFL)
+        return false;
+
+    uint32_t slMap = sl < TlsfIndex::NumSL ? (m_tlsf->slBitmap[fl] & (~0U << sl)) : 0;
+    if (!slMap)
+    {
+        uint32_t flMap = fl + 1 < TlsfIndex::NumFL ? (m_tlsf->flBitmap & (~0U << (fl + 1))) : 0;
+        if (!flMap)
+            return false;
+        fl = __builtin_ctz(flMap);
+        slMap = m_tlsf->slBitmap[fl];
+    }
+
+    sl = __builtin_ctz(slMap);
+    return true;
+}
+
+auto CMemPool::_tlsfFindInBin(unsigned fl, unsigned sl, uint32_t size, uint32_t alignment) const -> Slice*
+{
+    auto& bin = m_tlsf->bins[fl][sl];
+    for (Slice* slice = bin.first(); slice; slice = bin.next(slice))
+    {
+        uint32_t start_offset = (slice->m_start + alignment - 1) &~ (alignment - 1);
+        if (start_offset + size <= slice->m_end && !slice->m_block->m_evacuating)
+            return slice;
+    }
+    return nullptr;
+}
+
+void CMemPool::_freeInsert(Slice* slice)
+{
+    if (!m_tlsf)
+    {
+        m_freeList.insert(slice, true);
+        return;
+    }
+
+    unsigned fl, sl;
+    tlsfMapping(slice->getSize(), fl, sl);
+    // Added at the head, so that the most recently freed (and likely still cached) memory is reused first
+    m_tlsf->bins[fl][sl].addAfter(nullptr, slice);
+    m_tlsf->flBitmap |= 1U << fl;
+    m_tlsf->slBitmap[fl] |= 1U << sl;
+}
+
+void CMemPool::_freeRemove(Slice* slice)
+{
+    if (!m_tlsf)
+    {
+        m_freeList.remove(slice);
+        return;
+    }
+
+    unsigned fl, sl;
+    tlsfMapping(slice->getSize(), fl, sl);
+    auto& bin = m_tlsf->bins[fl][sl];
+    bin.remove(slice);
+    if (bin.empty())
+    {
+        m_tlsf->slBitmap[fl] &= ~(1U << sl);
+        if (!m_tlsf->slBitmap[fl])
+            m_tlsf->flBitmap &= ~(1U << fl);
+    }
+}
+
+// Returns a free slice able to hold an allocation of the given size and alignment, or null
+auto CMemPool::_freeFind(uint32_t size, uint32_t alignment) -> Slice*
+{
+    if (!m_tlsf)
+    {
+        Slice* slice = m_freeList.find(size, decltype(m_freeList)::LowerBound);
+        while (slice)
+        {
+#ifdef DEBUG_CMEMPOOL
+            printf(" * Checking slice 0x%x - 0x%x\n", slice->m_start, slice->m_end);
+#endif
+            uint32_t start_offset = (slice->m_start + alignment - 1) &~ (alignment - 1);
+            if (start_offset + size <= slice->m_end && !slice->m_block->m_evacuating)
+                break;
+            slice = m_freeList.next(slice);
+        }
+        return slice;
+    }
+
+    // Round the size up to the next list boundary: every slice in that list and the ones after
+    // it is then large enough, and the head of the first non-empty one is normally taken as is
+    unsigned roundedFl = TlsfIndex::NumFL, roundedSl = 0;
+    uint32_t step = size < TlsfIndex::NumSL ? 1 : 1U << (31 - __builtin_clz(size) - TlsfIndex::SLBits);
+    uint64_t rounded = uint64_t(size) + step - 1;
+    if (rounded <= UINT32_MAX)
+    {
+        tlsfMapping(uint32_t(rounded), roundedFl, roundedSl);
+        unsigned fl = roundedFl, sl = roundedSl;
+        while (_tlsfNextBin(fl, sl))
+        {
+            // Slices further down the list are only looked at when the head is misaligned or
+            // belongs to a block being evacuated
+            Slice* slice = _tlsfFindInBin(fl, sl, size, alignment);
+            if (slice)
+                return slice;
+            sl ++;
+        }
+    }
+
+    // Before resorting to a new block, try the list the size itself falls in, which may
+    // contain slices that are large enough too
+    unsigned exactFl, exactSl;
+    tlsfMapping(size, exactFl, exactSl);
+    if (exactFl == roundedFl && exactSl == roundedSl)
+        return nullptr;
+    return _tlsfFindInBin(exactFl, exactSl, size, alignment);
+}
+
 CMemPool::~CMemPool()
 {
     m_memMap.iterate([](Slice* s) { ::free(s); });
@@ -25,6 +165,7 @@ CMemPool::~CMemPool()
         blk->m_obj.destroy();
         ::free(blk);
     });
+    ::free(m_tlsf);
 }
 
 auto CMemPool::allocate(uint32_t size, uint32_t alignment) -> Handle
@@ -32,6 +173,40 @@ auto CMemPool::allocate(uint32_t size, uint32_t alignment) -> Handle
     if (!size) return nullptr;
     if (alignment & (alignment - 1)) return nullptr;
     size = (size + alignment - 1) &~ (alignment - 1);
+
+    u64 tick_start = armGetSystemTick();
+    Slice* slice = nullptr;
+
+    if (!m_concurrent)
+        slice = _allocate(size, alignment);
+    else
+    {
+        // Try the calling thread's magazine first, which does not require taking the lock
+        ThreadCache* cache = ThreadCache::find(this);
+        if (cache)
+            slice = cache->pop(size, alignment);
+
+        if (!slice)
+        {
+            mutexLock(&m_mutex);
+            slice = _allocate(size, alignment);
+            mutexUnlock(&m_mutex);
+        }
+    }
+
+    if (slice)
+    {
+        slice->m_alignment = alignment;
+        slice->m_relocatable = false;
+    }
+
+    _count(m_allocTicks, armGetSystemTick() - tick_start);
+    _count(slice ? m_numAllocs : m_numFailedAllocs, 1);
+    return slice;
+}
+
+auto CMemPool::_allocate(uint32_t size, uint32_t alignment, bool allowNewBlock) -> Slice*
+{
 #ifdef DEBUG_CMEMPOOL
     printf("Allocating size=%u alignment=0x%x\n", size, alignment);
     {
@@ -46,21 +221,13 @@ auto CMemPool::allocate(uint32_t size, uint32_t alignment) -> Handle
 
     uint32_t start_offset = 0;
     uint32_t end_offset = 0;
-    Slice* slice = m_freeList.find(size, decltype(m_freeList)::LowerBound);
-    while (slice)
-    {
-#ifdef DEBUG_CMEMPOOL
-        printf(" * Checking slice 0x%x - 0x%x\n", slice->m_start, slice->m_end);
-#endif
-        start_offset = (slice->m_start + alignment - 1) &~ (alignment - 1);
-        end_offset = start_offset + size;
-        if (end_offset <= slice->m_end)
-            break;
-        slice = m_freeList.next(slice);
-    }
+    Slice* slice = _freeFind(size, alignment);
 
     if (!slice)
     {
+        if (!allowNewBlock)
+            return nullptr;
+
         Block* blk = (Block*)::malloc(sizeof(Block));
         if (!blk)
             return nullptr;
@@ -95,6 +262,8 @@ auto CMemPool::allocate(uint32_t size, uint32_t alignment) -> Handle
 
         blk->m_cpuAddr = blk->m_obj.getCpuAddr();
         blk->m_gpuAddr = blk->m_obj.getGpuAddr();
+        blk->m_size = blkSize;
+        blk->m_evacuating = false;
         m_blocks.add(blk);
 
         start_offset = 0;
@@ -105,7 +274,9 @@ auto CMemPool::allocate(uint32_t size, uint32_t alignment) -> Handle
 #ifdef DEBUG_CMEMPOOL
         printf(" * found it\n");
 #endif
-        m_freeList.remove(slice);
+        _freeRemove(slice);
+        start_offset = (slice->m_start + alignment - 1) &~ (alignment - 1);
+        end_offset = start_offset + size;
     }
 
     if (start_offset != slice->m_start)
@@ -120,7 +291,7 @@ auto CMemPool::allocate(uint32_t size, uint32_t alignment) -> Handle
         printf("-> subdivide left:  %08x-%08x\n", t->m_start, t->m_end);
 #endif
         m_memMap.addBefore(slice, t);
-        m_freeList.insert(t, true);
+        _freeInsert(t);
         slice->m_start = start_offset;
     }
 
@@ -136,7 +307,7 @@ auto CMemPool::allocate(uint32_t size, uint32_t alignment) -> Handle
         printf("-> subdivide right: %08x-%08x\n", t->m_start, t->m_end);
 #endif
         m_memMap.addAfter(slice, t);
-        m_freeList.insert(t, true);
+        _freeInsert(t);
         slice->m_end = end_offset;
     }
 
@@ -144,11 +315,29 @@ auto CMemPool::allocate(uint32_t size, uint32_t alignment) -> Handle
     return slice;
 
 _bad:
-    m_freeList.insert(slice, true);
+    _freeInsert(slice);
     return nullptr;
 }
 
 void CMemPool::_destroy(Slice* slice)
+{
+    _count(m_numFrees, 1);
+
+    if (!m_concurrent)
+        return _free(slice);
+
+    // Stash the slice in the calling thread's magazine if possible, keeping it marked as used
+    // so that it does not get coalesced with its neighbours while it sits in the cache
+    ThreadCache* cache = ThreadCache::find(this);
+    if (cache && cache->push(slice))
+        return;
+
+    mutexLock(&m_mutex);
+    _free(slice);
+    mutexUnlock(&m_mutex);
+}
+
+void CMemPool::_free(Slice* slice)
 {
     slice->m_pool = nullptr;
 
@@ -158,7 +347,7 @@ void CMemPool::_destroy(Slice* slice)
     if (left && left->canCoalesce(*slice))
     {
         slice->m_start = left->m_start;
-        m_freeList.remove(left);
+        _freeRemove(left);
         m_memMap.remove(left);
         _deleteSlice(left);
     }
@@ -166,10 +355,352 @@ void CMemPool::_destroy(Slice* slice)
     if (right && slice->canCoalesce(*right))
     {
         slice->m_end = right->m_end;
-        m_freeList.remove(right);
+        _freeRemove(right);
         m_memMap.remove(right);
         _deleteSlice(right);
     }
 
-    m_freeList.insert(slice, true);
+    _freeInsert(slice);
+}
+
+auto CMemPool::_relocate(Slice* slice, dk::CmdBuf cmdbuf) -> Slice*
+{
+    Block* src = slice->m_block;
+    uint32_t size = slice->getSize();
+
+    Slice* dst = _allocate(size, slice->m_alignment, false);
+    if (!dst)
+        return nullptr;
+
+    // Copy the contents over, using the GPU if possible, and falling back to the CPU otherwise
+    if (src->m_gpuAddr != DK_GPU_ADDR_INVALID && dst->m_block->m_gpuAddr != DK_GPU_ADDR_INVALID)
+        cmdbuf.copyBuffer(src->gpuOffset(slice->m_start), dst->m_block->gpuOffset(dst->m_start), size);
+    else if (src->m_cpuAddr && dst->m_block->m_cpuAddr)
+        memcpy(dst->m_block->cpuOffset(dst->m_start), src->cpuOffset(slice->m_start), size);
+    else
+    {
+        _free(dst);
+        return nullptr;
+    }
+
+    // Handles point to the slice object itself, so we make it describe the new location (and
+    // swap the positions of the two slice objects in the memory map accordingly). This way all
+    // copies of the handle held by the user are patched at once.
+    Slice* marker = _newSlice();
+    if (!marker)
+    {
+        _free(dst);
+        return nullptr;
+    }
+
+    m_memMap.addAfter(slice, marker);
+    m_memMap.remove(slice);
+    m_memMap.addAfter(dst, slice);
+    m_memMap.remove(dst);
+    m_memMap.addAfter(marker, dst);
+    m_memMap.remove(marker);
+    _deleteSlice(marker);
+
+    uint32_t oldStart = slice->m_start, oldEnd = slice->m_end;
+    slice->m_block = dst->m_block;
+    slice->m_start = dst->m_start;
+    slice->m_end   = dst->m_end;
+    dst->m_block = src;
+    dst->m_start = oldStart;
+    dst->m_end   = oldEnd;
+
+    // Release the old location. This is fine even though the copy has not executed yet,
+    // since the evacuated block is excluded from allocation until compaction finishes.
+    // The slice object left behind (possibly coalesced with its neighbours) is returned.
+    _free(dst);
+    return dst;
+}
+
+uint64_t CMemPool::compact(dk::Queue queue, RelocateFunc func, void* userData, float maxOccupancy)
+{
+    static constexpr uint32_t CmdMemSize = 0x10000;
+    static constexpr unsigned MaxCopiesPerList = 256;
+
+    uint64_t freedBytes = 0;
+
+    // Command memory for the copies is taken from a temporary memory block, since the pool's own
+    // memory might not be suitable for it (and allocating from it would defeat the purpose)
+    dk::MemBlock cmdmem = dk::MemBlockMaker{m_dev, CmdMemSize}.setFlags(DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached).create();
+    if (!cmdmem)
+        return 0;
+
+    dk::UniqueCmdBuf cmdbuf = dk::CmdBufMaker{m_dev}.create();
+    cmdbuf.addMemory(cmdmem, 0, CmdMemSize);
+
+    if (m_concurrent)
+        mutexLock(&m_mutex);
+
+    // Pick the blocks to evacuate: sparsely used ones whose live allocations can all be moved.
+    // There is no point in evacuating anything if only one block exists.
+    unsigned numBlocks = 0, numEvacuating = 0;
+    Block* fullestBlk = nullptr;
+    uint64_t fullestBytes = 0;
+    if (m_blocks.first() != m_blocks.last())
+    {
+        m_blocks.iterate([&](Block* blk) {
+            numBlocks ++;
+            uint64_t liveBytes = 0;
+            bool movable = true;
+            m_memMap.iterate([&](Slice* s) {
+                if (s->m_block != blk || !s->m_pool) return;
+                liveBytes += s->getSize();
+                movable = movable && s->m_relocatable;
+            });
+
+            blk->m_evacuating = movable && liveBytes <= uint64_t(maxOccupancy * blk->m_size);
+            if (blk->m_evacuating)
+            {
+                numEvacuating ++;
+                if (!fullestBlk || liveBytes > fullestBytes)
+                {
+                    fullestBlk = blk;
+                    fullestBytes = liveBytes;
+                }
+            }
+        });
+    }
+
+    // Don't evacuate every single block, otherwise there would be nowhere to move things to.
+    // Keep the fullest block as the destination; the others are still evacuated into it as far
+    // as it has room, and the ones that end up (or already were) completely empty are freed.
+    if (numEvacuating && numEvacuating == numBlocks)
+    {
+        fullestBlk->m_evacuating = false;
+        numEvacuating --;
+    }
+
+    if (numEvacuating)
+    {
+        unsigned numCopies = 0;
+        for (Slice* s = m_memMap.first(); s; )
+        {
+            if (!s->m_pool || !s->m_block->m_evacuating)
+            {
+                s = m_memMap.next(s);
+                continue;
+            }
+
+            Slice* hole = _relocate(s, cmdbuf);
+            if (!hole)
+            {
+                s = m_memMap.next(s);
+                continue;
+            }
+
+            if (func)
+                func(userData, Handle{s});
+
+            if (++numCopies == MaxCopiesPerList)
+            {
+                queue.submitCommands(cmdbuf.finishList());
+                queue.waitIdle();
+                cmdbuf.clear();
+                cmdbuf.addMemory(cmdmem, 0, CmdMemSize);
+                numCopies = 0;
+            }
+
+            s = m_memMap.next(hole);
+        }
+
+        if (numCopies)
+            queue.submitCommands(cmdbuf.finishList());
+        queue.waitIdle();
+    }
+
+    // Destroy all blocks that have been completely emptied
+    m_blocks.iterate([&](Block* blk) {
+        bool evacuating = blk->m_evacuating;
+        blk->m_evacuating = false;
+        if (!evacuating)
+            return;
+
+        Slice* s = m_memMap.first();
+        while (s && s->m_block != blk)
+            s = m_memMap.next(s);
+
+        Slice* n = s ? m_memMap.next(s) : nullptr;
+        if (!s || s->m_pool || (n && n->m_block == blk))
+            return;
+
+        _freeRemove(s);
+        m_memMap.remove(s);
+        _deleteSlice(s);
+        m_blocks.remove(blk);
+        freedBytes += blk->m_size;
+        blk->m_obj.destroy();
+        ::free(blk);
+    });
+
+    if (m_concurrent)
+        mutexUnlock(&m_mutex);
+
+    cmdbuf.destroy();
+    cmdmem.destroy();
+    return freedBytes;
+}
+
+CMemPool::ThreadCache::ThreadCache(CMemPool& pool) : m_pool{&pool}, m_next{s_threadCaches}, m_count{}
+{
+    s_threadCaches = this;
+}
+
+CMemPool::ThreadCache::~ThreadCache()
+{
+    flush();
+
+    ThreadCache** pos = &s_threadCaches;
+    while (*pos && *pos != this)
+        pos = &(*pos)->m_next;
+    if (*pos)
+        *pos = m_next;
+}
+
+auto CMemPool::ThreadCache::find(CMemPool* pool) -> ThreadCache*
+{
+    ThreadCache* cache = s_threadCaches;
+    while (cache && cache->m_pool != pool)
+        cache = cache->m_next;
+    return cache;
+}
+
+auto CMemPool::ThreadCache::pop(uint32_t size, uint32_t alignment) -> Slice*
+{
+    if (size > MaxCachedSize)
+        return nullptr;
+
+    // Search the magazine from the most recently freed slice, so that we hand out warm memory first.
+    // Only exact size matches are reused, this way handles report the same size they were asked for.
+    unsigned cls = sizeClass(size);
+    Slice** slices = m_slices[cls];
+    for (unsigned i = m_count[cls]; i --;)
+    {
+        Slice* slice = slices[i];
+        if (slice->getSize() != size || (slice->m_start & (alignment - 1)))
+            continue;
+
+        m_count[cls] --;
+        for (unsigned j = i; j < m_count[cls]; j ++)
+            slices[j] = slices[j+1];
+        return slice;
+    }
+
+    return nullptr;
+}
+
+bool CMemPool::ThreadCache::push(Slice* slice)
+{
+    uint32_t size = slice->getSize();
+    if (size > MaxCachedSize)
+        return false;
+
+    // When the magazine is full, give back its older half to the pool under a single lock
+    unsigned cls = sizeClass(size);
+    if (m_count[cls] == MagazineSize)
+        drain(cls, MagazineSize / 2);
+
+    m_slices[cls][m_count[cls]++] = slice;
+    return true;
+}
+
+void CMemPool::ThreadCache::drain(unsigned cls, unsigned count)
+{
+    Slice** slices = m_slices[cls];
+
+    mutexLock(&m_pool->m_mutex);
+    for (unsigned i = 0; i < count; i ++)
+        m_pool->_free(slices[i]);
+    mutexUnlock(&m_pool->m_mutex);
+
+    m_count[cls] -= count;
+    for (unsigned i = 0; i < m_count[cls]; i ++)
+        slices[i] = slices[i+count];
+}
+
+void CMemPool::ThreadCache::flush()
+{
+    mutexLock(&m_pool->m_mutex);
+    for (unsigned cls = 0; cls < NumClasses; cls ++)
+    {
+        for (unsigned i = 0; i < m_count[cls]; i ++)
+            m_pool->_free(m_slices[cls][i]);
+        m_count[cls] = 0;
+    }
+    mutexUnlock(&m_pool->m_mutex);
+}
+
+void CMemPool::getStats(Stats& stats)
+{
+    memset(&stats, 0, sizeof(stats));
+
+    if (m_concurrent)
+        mutexLock(&m_mutex);
+
+    m_blocks.iterate([&stats](Block*) { stats.numBlocks ++; });
+    m_memMap.iterate([&stats](Slice* s) {
+        uint32_t size = s->getSize();
+        stats.totalBytes += size;
+        if (s->m_pool)
+        {
+            stats.numLiveSlices ++;
+            stats.liveBytes += size;
+            return;
+        }
+
+        stats.numFreeSlices ++;
+        stats.freeBytes += size;
+        if (size > stats.largestFreeSlice)
+            stats.largestFreeSlice = size;
+
+        unsigned bucket = 0;
+        for (size >>= Stats::HistogramMinShift + 1; size && bucket < Stats::NumHistogramBuckets - 1; size >>= 1)
+            bucket ++;
+        stats.freeHistogram[bucket] ++;
+    });
+
+    if (m_concurrent)
+        mutexUnlock(&m_mutex);
+
+    stats.numAllocs = __atomic_load_n(&m_numAllocs, __ATOMIC_RELAXED);
+    stats.numFailedAllocs = __atomic_load_n(&m_numFailedAllocs, __ATOMIC_RELAXED);
+    stats.numFrees = __atomic_load_n(&m_numFrees, __ATOMIC_RELAXED);
+
+    uint64_t numAttempts = stats.numAllocs + stats.numFailedAllocs;
+    if (numAttempts)
+        stats.avgAllocNs = armTicksToNs(__atomic_load_n(&m_allocTicks, __ATOMIC_RELAXED) / numAttempts);
+}
+
+void CMemPool::printStats(const char* name)
+{
+    Stats stats;
+    getStats(stats);
+
+    printf("[%s] backend=%s blocks=%u total=0x%llx live=0x%llx (%u slices) free=0x%llx (%u slices) largest=0x%x frag=%.1f%%\n",
+        name, getBackend() == Backend::Tlsf ? "tlsf" : "tree", stats.numBlocks,
+        (unsigned long long)stats.totalBytes,
+        (unsigned long long)stats.liveBytes, stats.numLiveSlices,
+        (unsigned long long)stats.freeBytes, stats.numFreeSlices,
+        stats.largestFreeSlice, 100.0f * stats.fragmentation());
+    printf("[%s] allocs=%llu failed=%llu frees=%llu avg_alloc=%lluns\n",
+        name,
+        (unsigned long long)stats.numAllocs,
+        (unsigned long long)stats.numFailedAllocs,
+        (unsigned long long)stats.numFrees,
+        (unsigned long long)stats.avgAllocNs);
+    printf("[%s] free histogram:", name);
+    for (unsigned i = 0; i < Stats::NumHistogramBuckets; i ++)
+        printf(" %u", stats.freeHistogram[i]);
+    printf("\n");
+}
+
+void CMemPool::resetCounters()
+{
+    __atomic_store_n(&m_numAllocs, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&m_numFailedAllocs, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&m_numFrees, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&m_allocTicks, 0, __ATOMIC_RELAXED);
 }
@@ -9,9 +9,25 @@
 
 class CMemPool
 {
+public:
+    // How free slices are indexed. BestFitTree keeps them in a tree ordered by size and picks
+    // the smallest one that fits, which is a logarithmic search (plus a walk over the slices of
+    // equal size that cannot be used due to their alignment). Tlsf keeps them in segregated
+    // lists selected by a two-level bitmap (16 lists per power of two), and picks the head of
+    // the first non-empty list whose slices are all large enough: allocating and freeing take
+    // constant time, and the memory wasted by picking a larger slice is bounded to 1/16 of it.
+    enum class Backend
+    {
+        BestFitTree,
+        Tlsf,
+    };
+
+private:
     dk::Device m_dev;
     uint32_t m_flags;
     uint32_t m_blockSize;
+    bool m_concurrent;
+    Mutex m_mutex;
 
     struct Block
     {
@@ -19,6 +35,8 @@ class CMemPool
         dk::MemBlock m_obj;
         void* m_cpuAddr;
         DkGpuAddr m_gpuAddr;
+        uint32_t m_size;
+        bool m_evacuating;
 
         constexpr void* cpuOffset(uint32_t offset) const
         {
@@ -37,10 +55,13 @@ class CMemPool
     {
         CIntrusiveListNode<Slice> m_node;
         CIntrusiveTreeNode m_treenode;
+        CIntrusiveListNode<Slice> m_binNode;
         CMemPool* m_pool;
         Block* m_block;
         uint32_t m_start;
         uint32_t m_end;
+        uint32_t m_alignment;
+        bool m_relocatable;
 
         constexpr uint32_t getSize() const { return m_end - m_start; }
         constexpr bool canCoalesce(Slice const& rhs) const { return m_pool == rhs.m_pool && m_block == rhs.m_block && m_end == rhs.m_start; }
@@ -54,13 +75,99 @@ class CMemPool
     CIntrusiveList<Slice, &Slice::m_node> m_memMap, m_sliceHeap;
     CIntrusiveTree<Slice, &Slice::m_treenode> m_freeList;
 
+    // Free lists of the Tlsf backend, only allocated when it is selected. List [fl][sl] holds
+    // the slices with fl as the first level index and sl as the second level index (see
+    // tlsfMapping), and the bitmaps have a bit set for each list that is non-empty.
+    struct TlsfIndex
+    {
+        static constexpr unsigned SLBits = 4;
+        static constexpr unsigned NumSL = 1U << SLBits;
+        static constexpr unsigned NumFL = 32 - SLBits + 1;
+
+        uint32_t flBitmap;
+        uint16_t slBitmap[NumFL];
+        CIntrusiveList<Slice, &Slice::m_binNode> bins[NumFL][NumSL];
+    };
+
+    TlsfIndex* m_tlsf;
+
+    uint64_t m_numAllocs;
+    uint64_t m_numFailedAllocs;
+    uint64_t m_numFrees;
+    uint64_t m_allocTicks;
+
+    void _count(uint64_t& counter, uint64_t value)
+    {
+        if (m_concurrent)
+            __atomic_fetch_add(&counter, value, __ATOMIC_RELAXED);
+        else
+            counter += value;
+    }
+
     Slice* _newSlice();
     void _deleteSlice(Slice*);
 
+    static void tlsfMapping(uint32_t size, unsigned& fl, unsigned& sl);
+    bool _tlsfNextBin(unsigned& fl, unsigned& sl) const;
+    Slice* _tlsfFindInBin(unsigned fl, unsigned sl, uint32_t size, uint32_t alignment) const;
+
+    void _initBackend(Backend backend);
+    void _freeInsert(Slice* slice);
+    void _freeRemove(Slice* slice);
+    Slice* _freeFind(uint32_t size, uint32_t alignment);
+
+    Slice* _allocate(uint32_t size, uint32_t alignment, bool allowNewBlock = true);
+    void _free(Slice* slice);
     void _destroy(Slice* slice);
 
+    Slice* _relocate(Slice* slice, dk::CmdBuf cmdbuf);
+
 public:
     static constexpr uint32_t DefaultBlockSize = 0x800000;
+
+    // Per-thread magazines of recently freed slices, used when the pool is in concurrent mode.
+    // Create one on the stack of each worker thread that allocates from the pool; while it is
+    // alive, allocations and frees of small slices on that thread are served from the magazine
+    // without taking the pool lock. It must be destroyed on the same thread that created it,
+    // and before the pool itself is destroyed.
+    class ThreadCache
+    {
+        friend class CMemPool;
+
+        static constexpr uint32_t MinClassShift = 8;
+        static constexpr uint32_t MaxCachedSize = 0x10000;
+        static constexpr unsigned NumClasses = 9;
+        static constexpr unsigned MagazineSize = 16;
+
+        CMemPool* m_pool;
+        ThreadCache* m_next;
+        unsigned m_count[NumClasses];
+        Slice* m_slices[NumClasses][MagazineSize];
+
+        static constexpr unsigned sizeClass(uint32_t size)
+        {
+            unsigned cls = 0;
+            for (size = (size - 1) >> MinClassShift; size; size >>= 1)
+                cls ++;
+            return cls;
+        }
+
+        static ThreadCache* find(CMemPool* pool);
+
+        Slice* pop(uint32_t size, uint32_t alignment);
+        bool push(Slice* slice);
+        void drain(unsigned cls, unsigned count);
+
+    public:
+        ThreadCache(CMemPool& pool);
+        ~ThreadCache();
+
+        ThreadCache(ThreadCache const&) = delete;
+        ThreadCache& operator=(ThreadCache const&) = delete;
+
+        void flush();
+    };
+
     class Handle
     {
         Slice* m_slice;
@@ -105,13 +212,81 @@ public:
         {
             return m_slice->m_block->gpuOffset(m_slice->m_start);
         }
+
+        // Allows compact() to move this allocation to a different memory block. Any addresses,
+        // images or descriptors derived from the handle must be recreated after it is moved.
+        void setRelocatable(bool relocatable = true)
+        {
+            m_slice->m_relocatable = relocatable;
+        }
+    };
+
+    // Called by compact() for every allocation that was moved. Note that the data is only
+    // guaranteed to be present at the new location once compact() returns.
+    using RelocateFunc = void(*)(void* userData, Handle handle);
+
+    // Snapshot of the pool's state, as returned by getStats(). Slices sitting in thread caches
+    // are still counted as live, since the pool itself cannot tell them apart from used ones.
+    struct Stats
+    {
+        static constexpr unsigned HistogramMinShift = 8;
+        static constexpr unsigned NumHistogramBuckets = 16;
+
+        uint32_t numBlocks;
+        uint32_t numLiveSlices;
+        uint32_t numFreeSlices;
+        uint32_t largestFreeSlice;
+        uint64_t totalBytes;
+        uint64_t liveBytes;
+        uint64_t freeBytes;
+
+        // Bucket i counts free slices whose size is at least 1<<(i+HistogramMinShift)
+        // (smaller slices land in bucket 0, and the last bucket also holds anything bigger)
+        uint32_t freeHistogram[NumHistogramBuckets];
+
+        uint64_t numAllocs;
+        uint64_t numFailedAllocs;
+        uint64_t numFrees;
+        uint64_t avgAllocNs;
+
+        // Fraction of the free memory not contained in the largest free slice (0 = no fragmentation)
+        constexpr float fragmentation() const
+        {
+            return freeBytes ? 1.0f - float(largestFreeSlice) / float(freeBytes) : 0.0f;
+        }
     };
 
-    CMemPool(dk::Device dev, uint32_t flags = DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached, uint32_t blockSize = DefaultBlockSize) :
-        m_dev{dev}, m_flags{flags}, m_blockSize{blockSize}, m_blocks{}, m_memMap{}, m_sliceHeap{}, m_freeList{} { }
+    CMemPool(dk::Device dev, uint32_t flags = DkMemBlockFlags_CpuUncached | DkMemBlockFlags_GpuCached, uint32_t blockSize = DefaultBlockSize, bool concurrent = false, Backend backend = Backend::BestFitTree) :
+        m_dev{dev}, m_flags{flags}, m_blockSize{blockSize}, m_concurrent{concurrent}, m_mutex{}, m_blocks{}, m_memMap{}, m_sliceHeap{}, m_freeList{}, m_tlsf{},
+        m_numAllocs{}, m_numFailedAllocs{}, m_numFrees{}, m_allocTicks{}
+    {
+        mutexInit(&m_mutex);
+        _initBackend(backend);
+    }
     ~CMemPool();
 
+    CMemPool(CMemPool const&) = delete;
+    CMemPool& operator=(CMemPool const&) = delete;
+
+    // Note that the pool falls back to BestFitTree if the Tlsf free lists could not be allocated
+    constexpr Backend getBackend() const { return m_tlsf ? Backend::Tlsf : Backend::BestFitTree; }
+    constexpr bool isConcurrent() const { return m_concurrent; }
+    constexpr uint32_t getFlags() const { return m_flags; }
+    constexpr bool isCpuCached() const { return (m_flags & DkMemBlockFlags_CpuAccessMask) == DkMemBlockFlags_CpuCached; }
+
     Handle allocate(uint32_t size, uint32_t alignment = DK_CMDMEM_ALIGNMENT);
+
+    // Moves relocatable allocations out of sparsely used memory blocks (those whose occupancy
+    // is at most maxOccupancy) using GPU copy commands submitted to the given queue, and then
+    // destroys the blocks that were emptied in the process. Only allocations marked with
+    // Handle::setRelocatable are moved; blocks containing other live allocations are left alone.
+    // This waits for the queue to become idle; call it at load screens. Returns the amount of
+    // memory given back to the system.
+    uint64_t compact(dk::Queue queue, RelocateFunc func = nullptr, void* userData = nullptr, float maxOccupancy = 0.25f);
+
+    void getStats(Stats& stats);
+    void printStats(const char* name);
+    void resetCounters();
 };
 
 constexpr bool operator<(uint32_t lhs, CMemPool::Slice const& rhs)
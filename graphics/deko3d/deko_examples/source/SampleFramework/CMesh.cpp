@@ -0,0 +1,90 @@
+/*
+** Sample Framework for deko3d Applications
+**   CMesh.cpp: Loader for packed meshes (.dkmesh) produced by tools/mkdkmesh.py
+*/
+#include "CMesh.h"
+
+#define DKMESH_MAGIC 0x534D4B44 // 'DKMS'
+
+struct DkmeshHeader
+{
+    uint32_t magic; // DKMESH_MAGIC
+    uint32_t header_sz; // sizeof(DkmeshHeader)
+    uint32_t flags; // bit 0: 32-bit indices
+    uint32_t num_vertices;
+    uint32_t num_indices;
+    uint32_t num_meshlets;
+    uint32_t vtx_off;
+    uint32_t idx_off;
+    uint32_t meshlets_off;
+    uint32_t reserved;
+    float bounds[4];
+};
+
+void CMesh::destroy()
+{
+    free(m_meshlets);
+    m_mem.destroy();
+
+    m_meshlets = nullptr;
+    m_numVertices = 0;
+    m_numIndices = 0;
+    m_numMeshlets = 0;
+}
+
+bool CMesh::load(CMemPool& pool, const char* path)
+{
+    FILE* f;
+    DkmeshHeader hdr;
+    uint32_t idxSize, dataSize;
+
+    destroy();
+
+    f = fopen(path, "rb");
+    if (!f) return false;
+
+    if (!fread(&hdr, sizeof(hdr), 1, f) || hdr.magic != DKMESH_MAGIC || hdr.header_sz < sizeof(hdr))
+        goto _fail0;
+
+    // Vertex and index data are laid out back to back, so they get loaded with a single read
+    idxSize = hdr.num_indices * ((hdr.flags & 1) ? sizeof(uint32_t) : sizeof(uint16_t));
+    if (hdr.idx_off < hdr.vtx_off + hdr.num_vertices*sizeof(Vertex))
+        goto _fail0;
+    dataSize = hdr.idx_off - hdr.vtx_off + idxSize;
+
+    m_mem = pool.allocate(dataSize, DK_UNIFORM_BUF_ALIGNMENT);
+    if (!m_mem)
+        goto _fail0;
+
+    if (fseek(f, hdr.vtx_off, SEEK_SET) != 0 || !fread(m_mem.getCpuAddr(), dataSize, 1, f))
+        goto _fail1;
+
+    if (hdr.num_meshlets)
+    {
+        m_meshlets = (Meshlet*)malloc(hdr.num_meshlets*sizeof(Meshlet));
+        if (!m_meshlets)
+            goto _fail1;
+
+        if (fseek(f, hdr.meshlets_off, SEEK_SET) != 0 || !fread(m_meshlets, hdr.num_meshlets*sizeof(Meshlet), 1, f))
+            goto _fail2;
+    }
+
+    m_numVertices = hdr.num_vertices;
+    m_numIndices = hdr.num_indices;
+    m_numMeshlets = hdr.num_meshlets;
+    m_idxOffset = hdr.idx_off - hdr.vtx_off;
+    m_idxFormat = (hdr.flags & 1) ? DkIdxFormat_Uint32 : DkIdxFormat_Uint16;
+    memcpy(m_bounds, hdr.bounds, sizeof(m_bounds));
+
+    fclose(f);
+    return true;
+
+_fail2:
+    free(m_meshlets);
+    m_meshlets = nullptr;
+_fail1:
+    m_mem.destroy();
+_fail0:
+    fclose(f);
+    return false;
+}
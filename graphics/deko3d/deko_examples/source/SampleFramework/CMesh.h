@@ -0,0 +1,96 @@
+/*
+** Sample Framework for deko3d Applications
+**   CMesh.h: Loader for packed meshes (.dkmesh) produced by tools/mkdkmesh.py
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+#include <array>
+
+class CMesh
+{
+public:
+    // Packed vertex: half-float position (w=1), octahedral-encoded normal, normalized texture coordinates
+    struct Vertex
+    {
+        uint16_t position[4];
+        int16_t normal[2];
+        uint16_t texcoord[2];
+    };
+
+    struct Meshlet
+    {
+        float center[3];
+        float radius;
+        uint32_t firstIndex;
+        uint32_t numIndices;
+        uint32_t padding[2];
+    };
+
+    // Locations match the non-packed meshes used by the examples (position, normal, attribute),
+    // the only difference being that the vertex shader needs to decode the octahedral normal
+    static constexpr std::array VertexAttribState =
+    {
+        DkVtxAttribState{ 0, 0, offsetof(Vertex, position), DkVtxAttribSize_4x16, DkVtxAttribType_Float, 0 },
+        DkVtxAttribState{ 0, 0, offsetof(Vertex, normal),   DkVtxAttribSize_2x16, DkVtxAttribType_Snorm, 0 },
+        DkVtxAttribState{ 0, 0, offsetof(Vertex, texcoord), DkVtxAttribSize_2x16, DkVtxAttribType_Unorm, 0 },
+    };
+
+    static constexpr std::array VertexBufferState =
+    {
+        DkVtxBufferState{ sizeof(Vertex), 0 },
+    };
+
+private:
+    CMemPool::Handle m_mem;
+    Meshlet* m_meshlets;
+    uint32_t m_numVertices;
+    uint32_t m_numIndices;
+    uint32_t m_numMeshlets;
+    uint32_t m_idxOffset;
+    DkIdxFormat m_idxFormat;
+    float m_bounds[4];
+
+public:
+    CMesh() : m_mem{}, m_meshlets{}, m_numVertices{}, m_numIndices{}, m_numMeshlets{}, m_idxOffset{}, m_idxFormat{DkIdxFormat_Uint16}, m_bounds{} { }
+    ~CMesh()
+    {
+        destroy();
+    }
+
+    constexpr operator bool() const
+    {
+        return m_mem;
+    }
+
+    bool load(CMemPool& pool, const char* path);
+    void destroy();
+
+    constexpr uint32_t getNumVertices() const { return m_numVertices; }
+    constexpr uint32_t getNumIndices() const { return m_numIndices; }
+    constexpr uint32_t getNumMeshlets() const { return m_numMeshlets; }
+    constexpr Meshlet const* getMeshlets() const { return m_meshlets; }
+    constexpr DkIdxFormat getIdxFormat() const { return m_idxFormat; }
+    constexpr float const* getBounds() const { return m_bounds; } // center xyz, radius
+
+    DkGpuAddr getVtxAddr() const { return m_mem.getGpuAddr(); }
+    DkGpuAddr getIdxAddr() const { return m_mem.getGpuAddr() + m_idxOffset; }
+
+    void bind(dk::CmdBuf cmdbuf) const
+    {
+        cmdbuf.bindVtxBuffer(0, getVtxAddr(), m_numVertices*sizeof(Vertex));
+        cmdbuf.bindVtxAttribState(VertexAttribState);
+        cmdbuf.bindVtxBufferState(VertexBufferState);
+        cmdbuf.bindIdxBuffer(m_idxFormat, getIdxAddr());
+    }
+
+    void draw(dk::CmdBuf cmdbuf, uint32_t numInstances = 1) const
+    {
+        cmdbuf.drawIndexed(DkPrimitive_Triangles, m_numIndices, numInstances, 0, 0, 0);
+    }
+
+    void drawMeshlet(dk::CmdBuf cmdbuf, uint32_t id, uint32_t numInstances = 1) const
+    {
+        cmdbuf.drawIndexed(DkPrimitive_Triangles, m_meshlets[id].numIndices, numInstances, m_meshlets[id].firstIndex, 0, 0);
+    }
+};
@@ -0,0 +1,159 @@
+/*
+** Sample Framework for deko3d Applications
+**   CParallelRecorder.h: Splits command recording across worker threads
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+#include "CCmdMemRing.h"
+
+template <unsigned NumSlices>
+class CParallelRecorder
+{
+public:
+    static constexpr unsigned MaxWorkers = 3;
+
+    // Records the commands for items [first, first+count) into the given command buffer.
+    // Called concurrently from several threads, each with its own command buffer.
+    using RecordFunc = void(*)(void* userData, dk::CmdBuf cmdbuf, unsigned worker, unsigned first, unsigned count);
+
+private:
+    static constexpr size_t StackSize = 0x8000;
+
+    struct Worker
+    {
+        CParallelRecorder* parent;
+        Thread thread;
+        UEvent startEvent;
+        UEvent doneEvent;
+        dk::UniqueCmdBuf cmdbuf;
+        CCmdMemRing<NumSlices> cmdmem;
+        unsigned id;
+        unsigned first;
+        unsigned count;
+        DkCmdList list;
+    };
+
+    Worker m_workers[MaxWorkers];
+    unsigned m_numWorkers;
+    RecordFunc m_func;
+    void* m_userData;
+    bool m_exit;
+
+    static void _threadFunc(void* arg)
+    {
+        Worker& w = *(Worker*)arg;
+        for (;;)
+        {
+            waitSingle(waiterForUEvent(&w.startEvent), UINT64_MAX);
+            if (__atomic_load_n(&w.parent->m_exit, __ATOMIC_ACQUIRE))
+                break;
+
+            w.cmdmem.begin(w.cmdbuf);
+            if (w.count)
+                w.parent->m_func(w.parent->m_userData, w.cmdbuf, w.id, w.first, w.count);
+            w.list = w.cmdmem.end(w.cmdbuf);
+
+            ueventSignal(&w.doneEvent);
+        }
+    }
+
+public:
+    CParallelRecorder() : m_workers{}, m_numWorkers{}, m_func{}, m_userData{}, m_exit{} { }
+    ~CParallelRecorder()
+    {
+        destroy();
+    }
+
+    // Worker i runs on core i, so up to three workers can be used (cores 0-2 belong to the application)
+    bool create(dk::Device device, CMemPool& pool, uint32_t cmdSize, unsigned numWorkers = MaxWorkers, int priority = 0x2C)
+    {
+        if (m_numWorkers || !numWorkers || numWorkers > MaxWorkers)
+            return false;
+
+        m_exit = false;
+        for (unsigned i = 0; i < numWorkers; i ++)
+        {
+            Worker& w = m_workers[i];
+            w.parent = this;
+            w.id = i;
+            w.cmdbuf = dk::CmdBufMaker{device}.create();
+            if (!w.cmdmem.allocate(pool, cmdSize))
+                goto _fail;
+
+            ueventCreate(&w.startEvent, true);
+            ueventCreate(&w.doneEvent, true);
+
+            Result rc = threadCreate(&w.thread, _threadFunc, &w, nullptr, StackSize, priority, i);
+            if (R_FAILED(rc))
+                goto _fail;
+
+            rc = threadStart(&w.thread);
+            if (R_FAILED(rc))
+            {
+                threadClose(&w.thread);
+                goto _fail;
+            }
+
+            m_numWorkers++;
+        }
+
+        return true;
+
+    _fail:
+        destroy();
+        return false;
+    }
+
+    void destroy()
+    {
+        __atomic_store_n(&m_exit, true, __ATOMIC_RELEASE);
+        for (unsigned i = 0; i < m_numWorkers; i ++)
+            ueventSignal(&m_workers[i].startEvent);
+
+        for (unsigned i = 0; i < m_numWorkers; i ++)
+        {
+            threadWaitForExit(&m_workers[i].thread);
+            threadClose(&m_workers[i].thread);
+        }
+        m_numWorkers = 0;
+    }
+
+    constexpr unsigned getNumWorkers() const { return m_numWorkers; }
+
+    // Records numItems items split evenly across the workers, and returns the resulting command lists
+    // in item order. The lists remain valid until the next call. Note that GPU state set by previously
+    // submitted commands carries over, so common state can be bound once beforehand.
+    unsigned record(unsigned numItems, RecordFunc func, void* userData, DkCmdList* outLists)
+    {
+        m_func = func;
+        m_userData = userData;
+
+        unsigned first = 0;
+        for (unsigned i = 0; i < m_numWorkers; i ++)
+        {
+            Worker& w = m_workers[i];
+            unsigned count = numItems / m_numWorkers + (i < numItems % m_numWorkers);
+            w.first = first;
+            w.count = count;
+            first += count;
+            ueventSignal(&w.startEvent);
+        }
+
+        for (unsigned i = 0; i < m_numWorkers; i ++)
+        {
+            waitSingle(waiterForUEvent(&m_workers[i].doneEvent), UINT64_MAX);
+            outLists[i] = m_workers[i].list;
+        }
+
+        return m_numWorkers;
+    }
+
+    void recordAndSubmit(dk::Queue queue, unsigned numItems, RecordFunc func, void* userData)
+    {
+        DkCmdList lists[MaxWorkers];
+        unsigned numLists = record(numItems, func, userData, lists);
+        for (unsigned i = 0; i < numLists; i ++)
+            queue.submitCommands(lists[i]);
+    }
+};
@@ -0,0 +1,90 @@
+/*
+** Sample Framework for deko3d Applications
+**   CRenderProfile.h: Rendering settings chosen according to the operation and performance modes
+*/
+#pragma once
+#include "common.h"
+
+struct CRenderProfile
+{
+    enum Quality
+    {
+        Quality_Low,
+        Quality_Medium,
+        Quality_High,
+    };
+
+    // Bits returned by diff(), telling which kind of resources a profile switch affects
+    enum Change
+    {
+        Change_Resolution     = BIT(0), // Render targets and swapchain images
+        Change_Msaa           = BIT(1), // Multisampled render targets only
+        Change_Quality        = BIT(2), // Shader/effect parameters, no resources
+        Change_FramesInFlight = BIT(3), // Per-frame resource rings only
+    };
+
+    const char* name;
+    float resolutionScale;     // Render size relative to the output size (the display upscales the rest)
+    DkMsMode msMode;
+    Quality shadowQuality;
+    Quality effectsQuality;
+    unsigned framesInFlight;
+    uint32_t outputWidth;      // Size of the image handed to the display, see CApplication::chooseFramebufferSize
+    uint32_t outputHeight;
+
+    // Render sizes are kept a multiple of this, as a trade-off between granularity and tile alignment
+    static constexpr uint32_t SizeGranularity = 8;
+
+    constexpr uint32_t getRenderWidth() const
+    {
+        return scaleSize(outputWidth, resolutionScale);
+    }
+
+    constexpr uint32_t getRenderHeight() const
+    {
+        return scaleSize(outputHeight, resolutionScale);
+    }
+
+    constexpr unsigned diff(CRenderProfile const& rhs) const
+    {
+        unsigned changes = 0;
+        if (getRenderWidth() != rhs.getRenderWidth() || getRenderHeight() != rhs.getRenderHeight())
+            changes |= Change_Resolution;
+        if (msMode != rhs.msMode)
+            changes |= Change_Msaa;
+        if (shadowQuality != rhs.shadowQuality || effectsQuality != rhs.effectsQuality)
+            changes |= Change_Quality;
+        if (framesInFlight != rhs.framesInFlight)
+            changes |= Change_FramesInFlight;
+        return changes;
+    }
+
+    static constexpr uint32_t scaleSize(uint32_t size, float scale)
+    {
+        uint32_t scaled = uint32_t(size*scale + 0.5f) &~ (SizeGranularity - 1);
+        return scaled < SizeGranularity ? SizeGranularity : (scaled > size ? size : scaled);
+    }
+
+    // The defaults, leaving the output size to CApplication::chooseRenderProfile. Handheld, the
+    // panel is small and the battery is what runs out first: render at the native resolution
+    // without MSAA, keep effects cheap, and queue only two frames, which also keeps the latency
+    // down. Docked with the boosted clocks, image quality on a large screen is what matters.
+    // Docked at normal clocks (e.g. while the mode switch is in progress) the docked output is
+    // kept, at a lower render scale.
+    static constexpr CRenderProfile getDefault(AppletOperationMode mode, ApmPerformanceMode perfMode)
+    {
+        bool boost = perfMode == ApmPerformanceMode_Boost;
+        switch (mode)
+        {
+            default:
+            case AppletOperationMode_Handheld:
+                return boost
+                    ? CRenderProfile{ "handheld (boost)", 1.0f,  DkMsMode_2x, Quality_Medium, Quality_High,   2, 0, 0 }
+                    : CRenderProfile{ "handheld",         1.0f,  DkMsMode_1x, Quality_Low,    Quality_Medium, 2, 0, 0 };
+            case AppletOperationMode_Docked:
+                return boost
+                    ? CRenderProfile{ "docked",           1.0f,  DkMsMode_4x, Quality_High,   Quality_High,   3, 0, 0 }
+                    : CRenderProfile{ "docked (normal)",  0.75f, DkMsMode_2x, Quality_Medium, Quality_Medium, 3, 0, 0 };
+        }
+    }
+};
@@ -3,6 +3,7 @@
 **   CShader.cpp: Utility class for loading shaders from the filesystem
 */
 #include "CShader.h"
+#include "CAssetPack.h"
 
 struct DkshHeader
 {
@@ -60,3 +61,144 @@ _fail0:
     fclose(f);
     return false;
 }
+
+bool CShader::load(CMemPool& pool, CAssetPack& pack, const char* name)
+{
+    DkshHeader hdr;
+    void* ctrlmem;
+
+    m_codemem.destroy();
+
+    CAssetPack::Entry const* entry = pack.find(name);
+    if (!entry || !pack.read(entry, &hdr, 0, sizeof(hdr)))
+        return false;
+
+    ctrlmem = malloc(hdr.control_sz);
+    if (!ctrlmem)
+        return false;
+
+    // The code directly follows the control section
+    if (!pack.read(entry, ctrlmem, 0, hdr.control_sz))
+        goto _fail0;
+
+    m_codemem = pool.allocate(hdr.code_sz, DK_SHADER_CODE_ALIGNMENT);
+    if (!m_codemem)
+        goto _fail0;
+
+    if (!pack.read(entry, m_codemem.getCpuAddr(), hdr.control_sz, hdr.code_sz))
+        goto _fail1;
+
+    dk::ShaderMaker{m_codemem.getMemBlock(), m_codemem.getOffset()}
+        .setControl(ctrlmem)
+        .setProgramId(0)
+        .initialize(m_shader);
+
+    free(ctrlmem);
+    return true;
+
+_fail1:
+    m_codemem.destroy();
+_fail0:
+    free(ctrlmem);
+    return false;
+}
+
+void CShaderLibrary::destroy()
+{
+    for (unsigned i = 0; i < m_numModules; i ++)
+        free(m_modules[i].m_control);
+    free(m_modules);
+    free(m_shaders);
+    m_codemem.destroy();
+
+    m_modules = nullptr;
+    m_numModules = 0;
+    m_shaders = nullptr;
+    m_numShaders = 0;
+}
+
+bool CShaderLibrary::load(CMemPool& pool, const char* const* paths, unsigned numPaths)
+{
+    destroy();
+    if (!numPaths)
+        return false;
+
+    FILE** files = (FILE**)calloc(numPaths, sizeof(FILE*));
+    m_modules = (Module*)calloc(numPaths, sizeof(Module));
+    if (!files || !m_modules)
+        goto _fail;
+    m_numModules = numPaths;
+
+    // First pass: read the control sections, and lay out the code of every module
+    // back to back within a single allocation
+    {
+        uint32_t codeSize = 0;
+        for (unsigned i = 0; i < numPaths; i ++)
+        {
+            DkshHeader hdr;
+            Module& mod = m_modules[i];
+
+            files[i] = fopen(paths[i], "rb");
+            if (!files[i] || !fread(&hdr, sizeof(hdr), 1, files[i]) || !hdr.num_programs)
+                goto _fail;
+
+            mod.m_control = malloc(hdr.control_sz);
+            if (!mod.m_control)
+                goto _fail;
+
+            rewind(files[i]);
+            if (!fread(mod.m_control, hdr.control_sz, 1, files[i]))
+                goto _fail;
+
+            mod.m_codeOffset = codeSize;
+            mod.m_firstShader = m_numShaders;
+            mod.m_numPrograms = hdr.num_programs;
+            codeSize += (hdr.code_sz + DK_SHADER_CODE_ALIGNMENT - 1) &~ (DK_SHADER_CODE_ALIGNMENT - 1);
+            m_numShaders += hdr.num_programs;
+        }
+
+        m_shaders = (dk::Shader*)calloc(m_numShaders, sizeof(dk::Shader));
+        if (!m_shaders)
+            goto _fail;
+
+        m_codemem = pool.allocate(codeSize, DK_SHADER_CODE_ALIGNMENT);
+        if (!m_codemem)
+            goto _fail;
+    }
+
+    // Second pass: read the code of every module (which directly follows its control section),
+    // and initialize all of its programs
+    for (unsigned i = 0; i < numPaths; i ++)
+    {
+        Module& mod = m_modules[i];
+        DkshHeader const* hdr = (DkshHeader const*)mod.m_control;
+
+        if (!fread((u8*)m_codemem.getCpuAddr() + mod.m_codeOffset, hdr->code_sz, 1, files[i]))
+            goto _fail;
+
+        fclose(files[i]);
+        files[i] = nullptr;
+
+        for (unsigned j = 0; j < mod.m_numPrograms; j ++)
+        {
+            dk::ShaderMaker{m_codemem.getMemBlock(), m_codemem.getOffset() + mod.m_codeOffset}
+                .setControl(mod.m_control)
+                .setProgramId(j)
+                .initialize(m_shaders[mod.m_firstShader + j]);
+        }
+    }
+
+    free(files);
+    return true;
+
+_fail:
+    if (files)
+    {
+        for (unsigned i = 0; i < numPaths; i ++)
+            if (files[i])
+                fclose(files[i]);
+        free(files);
+    }
+    destroy();
+    return false;
+}
@@ -6,6 +6,8 @@
 #include "common.h"
 #include "CMemPool.h"
 
+class CAssetPack;
+
 class CShader
 {
     dk::Shader m_shader;
@@ -28,4 +30,63 @@ public:
     }
 
     bool load(CMemPool& pool, const char* path);
+    bool load(CMemPool& pool, CAssetPack& pack, const char* name);
+};
+
+// Loads several DKSH files (each possibly containing multiple programs) into a single code
+// allocation, and keeps their control sections resident so that shaders can be reinitialized
+class CShaderLibrary
+{
+    struct Module
+    {
+        void* m_control;
+        uint32_t m_codeOffset;
+        uint32_t m_firstShader;
+        uint32_t m_numPrograms;
+    };
+
+    CMemPool::Handle m_codemem;
+    Module* m_modules;
+    unsigned m_numModules;
+    dk::Shader* m_shaders;
+    unsigned m_numShaders;
+
+public:
+    CShaderLibrary() : m_codemem{}, m_modules{}, m_numModules{}, m_shaders{}, m_numShaders{} { }
+    ~CShaderLibrary()
+    {
+        destroy();
+    }
+
+    CShaderLibrary(CShaderLibrary const&) = delete;
+    CShaderLibrary& operator=(CShaderLibrary const&) = delete;
+
+    constexpr operator bool() const
+    {
+        return m_codemem;
+    }
+
+    constexpr unsigned getNumModules() const { return m_numModules; }
+    constexpr unsigned getNumShaders() const { return m_numShaders; }
+
+    unsigned getNumPrograms(unsigned module) const
+    {
+        return module < m_numModules ? m_modules[module].m_numPrograms : 0;
+    }
+
+    // Returns the given program of the given module (i.e. file, in the order passed to load)
+    dk::Shader const* get(unsigned module, unsigned program = 0) const
+    {
+        if (module >= m_numModules || program >= m_modules[module].m_numPrograms)
+            return nullptr;
+        return &m_shaders[m_modules[module].m_firstShader + program];
+    }
+
+    bool load(CMemPool& pool, const char* const* paths, unsigned numPaths);
+    bool load(CMemPool& pool, std::initializer_list<const char*> paths)
+    {
+        return load(pool, paths.begin(), paths.size());
+    }
+
+    void destroy();
 };
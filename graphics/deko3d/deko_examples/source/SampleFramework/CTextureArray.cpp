@@ -0,0 +1,77 @@
+/*
+** Sample Framework for deko3d Applications
+**   CTextureArray.cpp: Packs same-format images into the layers of a single array texture
+*/
+#include "CTextureArray.h"
+#include "FileLoader.h"
+
+bool CTextureArray::create(CMemPool& imagePool, dk::Device device, uint32_t width, uint32_t height, DkImageFormat format, uint32_t numLayers, uint32_t flags)
+{
+    if (!numLayers)
+        return false;
+
+    dk::ImageLayout layout;
+    dk::ImageLayoutMaker{device}
+        .setType(DkImageType_2DArray)
+        .setFlags(flags)
+        .setFormat(format)
+        .setDimensions(width, height, numLayers)
+        .initialize(layout);
+
+    m_mem.destroy();
+    m_mem = imagePool.allocate(layout.getSize(), layout.getAlignment());
+    if (!m_mem)
+        return false;
+
+    m_image.initialize(layout, m_mem.getMemBlock(), m_mem.getOffset());
+    m_descriptor.initialize(m_image);
+    m_width = width;
+    m_height = height;
+    m_numLayers = numLayers;
+    m_numUsed = 0;
+    return true;
+}
+
+bool CTextureArray::uploadLayer(CImageUploadBatch& batch, uint32_t layer, const void* data, uint32_t size)
+{
+    if (layer >= m_numLayers || !size)
+        return false;
+
+    CMemPool::Handle staging = batch.getScratchPool().allocate(size, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
+    if (!staging)
+        return false;
+
+    memcpy(staging.getCpuAddr(), data, size);
+
+    dk::ImageView view{m_image};
+    batch.upload(staging, view, { 0, 0, layer, m_width, m_height, 1 });
+    return true;
+}
+
+bool CTextureArray::uploadLayer(CImageUploadBatch& batch, uint32_t layer, const char* path)
+{
+    if (layer >= m_numLayers)
+        return false;
+
+    CMemPool::Handle staging = LoadFile(batch.getScratchPool(), path, DK_IMAGE_LINEAR_STRIDE_ALIGNMENT);
+    if (!staging)
+        return false;
+
+    dk::ImageView view{m_image};
+    batch.upload(staging, view, { 0, 0, layer, m_width, m_height, 1 });
+    return true;
+}
+
+int CTextureArray::addLayer(CImageUploadBatch& batch, const void* data, uint32_t size)
+{
+    if (m_numUsed >= m_numLayers || !uploadLayer(batch, m_numUsed, data, size))
+        return -1;
+    return m_numUsed++;
+}
+
+int CTextureArray::addLayer(CImageUploadBatch& batch, const char* path)
+{
+    if (m_numUsed >= m_numLayers || !uploadLayer(batch, m_numUsed, path))
+        return -1;
+    return m_numUsed++;
+}
@@ -0,0 +1,54 @@
+/*
+** Sample Framework for deko3d Applications
+**   CTextureArray.h: Packs same-format images into the layers of a single array texture
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+#include "CImageUploadBatch.h"
+
+class CTextureArray
+{
+    dk::Image m_image;
+    dk::ImageDescriptor m_descriptor;
+    CMemPool::Handle m_mem;
+    uint32_t m_width;
+    uint32_t m_height;
+    uint32_t m_numLayers;
+    uint32_t m_numUsed;
+
+public:
+    CTextureArray() : m_image{}, m_descriptor{}, m_mem{}, m_width{}, m_height{}, m_numLayers{}, m_numUsed{} { }
+    ~CTextureArray()
+    {
+        m_mem.destroy();
+    }
+
+    constexpr operator bool() const
+    {
+        return m_mem;
+    }
+
+    constexpr dk::Image& get()
+    {
+        return m_image;
+    }
+
+    constexpr dk::ImageDescriptor const& getDescriptor() const
+    {
+        return m_descriptor;
+    }
+
+    constexpr uint32_t getNumLayers() const { return m_numLayers; }
+    constexpr uint32_t getNumUsedLayers() const { return m_numUsed; }
+
+    bool create(CMemPool& imagePool, dk::Device device, uint32_t width, uint32_t height, DkImageFormat format, uint32_t numLayers, uint32_t flags = 0);
+
+    // Uploads the next free layer from the given data (or file), returning its index or -1 on failure.
+    // The data is expected to be tightly packed, in the same format the array was created with.
+    int addLayer(CImageUploadBatch& batch, const void* data, uint32_t size);
+    int addLayer(CImageUploadBatch& batch, const char* path);
+
+    bool uploadLayer(CImageUploadBatch& batch, uint32_t layer, const void* data, uint32_t size);
+    bool uploadLayer(CImageUploadBatch& batch, uint32_t layer, const char* path);
+};
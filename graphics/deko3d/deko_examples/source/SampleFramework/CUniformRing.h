@@ -0,0 +1,66 @@
+/*
+** Sample Framework for deko3d Applications
+**   CUniformRing.h: Ring of per-draw uniform buffer sub-allocations
+*/
+#pragma once
+#include "common.h"
+#include "CMemPool.h"
+#include "CFrameArena.h"
+
+template <unsigned NumSlices>
+class CUniformRing
+{
+    CFrameArena<NumSlices> m_arena;
+public:
+    using Allocation = typename CFrameArena<NumSlices>::Allocation;
+
+    bool allocate(CMemPool& pool, uint32_t sliceSize)
+    {
+        return m_arena.allocate(pool, sliceSize, DK_UNIFORM_BUF_ALIGNMENT);
+    }
+
+    void begin(dk::CmdBuf cmdbuf)
+    {
+        // Wait for the current slice to be available, and rewind it
+        m_arena.begin();
+
+        // The data gets written by the CPU, so make sure the GPU does not see stale
+        // cached contents left over from the last time this slice was used
+        cmdbuf.barrier(DkBarrier_None, DkInvalidateFlags_L2Cache);
+    }
+
+    void end(dk::CmdBuf cmdbuf)
+    {
+        m_arena.end(cmdbuf);
+    }
+
+    // Reserves an uniform block within the current slice, which can be filled in and bound later
+    Allocation alloc(uint32_t size)
+    {
+        if (size > DK_UNIFORM_BUF_MAX_SIZE)
+            return Allocation{};
+        return m_arena.alloc(size, DK_UNIFORM_BUF_ALIGNMENT);
+    }
+
+    template <typename T>
+    Allocation write(T const& data)
+    {
+        static_assert(sizeof(T) <= DK_UNIFORM_BUF_MAX_SIZE, "Uniform block is too big");
+        return m_arena.push(data, DK_UNIFORM_BUF_ALIGNMENT);
+    }
+
+    static void bind(dk::CmdBuf cmdbuf, DkStage stage, uint32_t id, Allocation const& block)
+    {
+        cmdbuf.bindUniformBuffer(stage, id, block.getGpuAddr(), block.getSize());
+    }
+
+    // Writes the data into a fresh uniform block, and binds it for the upcoming draws
+    template <typename T>
+    bool push(dk::CmdBuf cmdbuf, DkStage stage, uint32_t id, T const& data)
+    {
+        Allocation block = write(data);
+        if (block)
+            bind(cmdbuf, stage, id, block);
+        return block;
+    }
+};
@@ -3,25 +3,313 @@
 **   FileLoader.cpp: Helpers for loading data from the filesystem directly into GPU memory
 */
 #include "FileLoader.h"
+#include "trace.h"
+#include <malloc.h>
 
-CMemPool::Handle LoadFile(CMemPool& pool, const char* path, uint32_t alignment)
+namespace
+{
+    constexpr uint32_t BounceSize = 0x100000;
+
+    // Reads a file in large pieces, through the native fs API if it's on an fs device
+    class CFileReader
+    {
+        FsFile m_file;
+        FILE* m_stdio;
+        uint64_t m_size;
+        bool m_native;
+
+    public:
+        CFileReader() : m_file{}, m_stdio{}, m_size{}, m_native{} { }
+        ~CFileReader()
+        {
+            if (m_native)
+                fsFileClose(&m_file);
+            if (m_stdio)
+                fclose(m_stdio);
+        }
+
+        uint64_t getSize() const { return m_size; }
+
+        bool open(const char* path)
+        {
+            FsFileSystem* fs;
+            char fsPath[FS_MAX_PATH];
+            if (fsdevTranslatePath(path, &fs, fsPath) != -1)
+            {
+                s64 size;
+                if (R_FAILED(fsFsOpenFile(fs, fsPath, FsOpenMode_Read, &m_file)))
+                    return false;
+                m_native = true;
+                if (R_FAILED(fsFileGetSize(&m_file, &size)))
+                    return false;
+                m_size = size;
+                return true;
+            }
+
+            // romfs isn't an fs device; without stdio buffering, its reads go straight to the storage
+            m_stdio = fopen(path, "rb");
+            if (!m_stdio)
+                return false;
+            setvbuf(m_stdio, nullptr, _IONBF, 0);
+
+            fseek(m_stdio, 0, SEEK_END);
+            m_size = ftell(m_stdio);
+            rewind(m_stdio);
+            return true;
+        }
+
+        // Reads are sequential
+        bool read(uint64_t offset, void* dst, uint32_t size)
+        {
+            if (m_native)
+            {
+                u64 bytesRead = 0;
+                return R_SUCCEEDED(fsFileRead(&m_file, offset, dst, size, FsReadOption_None, &bytesRead)) && bytesRead == size;
+            }
+            return fread(dst, 1, size, m_stdio) == size;
+        }
+    };
+
+    // bounce may be null, it's then allocated when needed
+    bool ReadToMemory(CFileReader& file, CMemPool& pool, CMemPool::Handle mem, void* bounce)
+    {
+        TRACE_SCOPE("ReadToMemory");
+        u8* dst = (u8*)mem.getCpuAddr();
+        uint32_t size = file.getSize();
+
+        if (pool.isCpuCached())
+        {
+            for (uint32_t pos = 0; pos < size; pos += BounceSize)
+            {
+                uint32_t chunk = size - pos < BounceSize ? size - pos : BounceSize;
+                if (!file.read(pos, dst + pos, chunk))
+                    return false;
+            }
+            return true;
+        }
+
+        void* temp = nullptr;
+        if (!bounce)
+        {
+            bounce = temp = memalign(0x1000, size < BounceSize ? size : BounceSize);
+            if (!bounce)
+                return false;
+        }
+
+        bool ok = true;
+        for (uint32_t pos = 0; ok && pos < size; pos += BounceSize)
+        {
+            uint32_t chunk = size - pos < BounceSize ? size - pos : BounceSize;
+            ok = file.read(pos, bounce, chunk);
+            if (ok)
+                CopyToUncached(dst + pos, bounce, chunk);
+        }
+
+        free(temp);
+        return ok;
+    }
+}
+
+void CopyToUncached(void* dst, const void* src, size_t size)
 {
-    FILE *f = fopen(path, "rb");
-    if (!f) return nullptr;
+    u8* d = (u8*)dst;
+    const u8* s = (const u8*)src;
+
+    // Up to a 16-byte aligned destination
+    size_t head = -(uintptr_t)d & 15;
+    if (head > size)
+        head = size;
+    memcpy(d, s, head);
+    d += head;
+    s += head;
+    size -= head;
 
-    fseek(f, 0, SEEK_END);
-    uint32_t fsize = ftell(f);
-    rewind(f);
+#ifdef __aarch64__
+    // Whole 64-byte lines at once: pairs of 128-bit non-temporal stores, which the write buffer merges
+    size_t lines = size / 64;
+    if (lines)
+    {
+        __asm__ volatile(
+            "1:\n"
+            "ldp q0, q1, [%[s]]\n"
+            "ldp q2, q3, [%[s], #32]\n"
+            "add %[s], %[s], #64\n"
+            "stnp q0, q1, [%[d]]\n"
+            "stnp q2, q3, [%[d], #32]\n"
+            "add %[d], %[d], #64\n"
+            "subs %[n], %[n], #1\n"
+            "b.ne 1b\n"
+            : [d] "+r"(d), [s] "+r"(s), [n] "+r"(lines)
+            :
+            : "v0", "v1", "v2", "v3", "cc", "memory");
+        size &= 63;
+    }
+#endif
+
+    memcpy(d, s, size);
+}
+
+CMemPool::Handle LoadFile(CMemPool& pool, const char* path, uint32_t alignment)
+{
+    TRACE_SCOPE("LoadFile");
+    CFileReader file;
+    if (!file.open(path))
+        return nullptr;
 
-    CMemPool::Handle mem = pool.allocate(fsize, alignment);
+    CMemPool::Handle mem = pool.allocate(file.getSize(), alignment);
     if (!mem)
+        return nullptr;
+
+    if (!ReadToMemory(file, pool, mem, nullptr))
     {
-        fclose(f);
+        mem.destroy();
         return nullptr;
     }
 
-    fread(mem.getCpuAddr(), fsize, 1, f);
-    fclose(f);
-
     return mem;
 }
+
+bool CAsyncFileLoader::start(int priority, int cpuid)
+{
+    if (m_running)
+        return true;
+
+    mutexInit(&m_mutex);
+    ueventCreate(&m_wakeEvent, true);
+    m_exit = false;
+
+    // Reads for uncached pools go through it, see LoadFile
+    m_bounce = memalign(0x1000, BounceSize);
+    if (!m_bounce)
+        return false;
+
+    Result rc = threadCreate(&m_thread, _threadFunc, this, nullptr, StackSize, priority, cpuid);
+    if (R_SUCCEEDED(rc))
+    {
+        rc = threadStart(&m_thread);
+        if (R_FAILED(rc))
+            threadClose(&m_thread);
+    }
+    if (R_FAILED(rc))
+    {
+        free(m_bounce);
+        m_bounce = nullptr;
+        return false;
+    }
+
+    m_running = true;
+    return true;
+}
+
+void CAsyncFileLoader::stop()
+{
+    if (!m_running)
+        return;
+
+    mutexLock(&m_mutex);
+    m_exit = true;
+    mutexUnlock(&m_mutex);
+    ueventSignal(&m_wakeEvent);
+
+    threadWaitForExit(&m_thread);
+    threadClose(&m_thread);
+    m_running = false;
+    free(m_bounce);
+    m_bounce = nullptr;
+
+    // Fail anything that was still queued up
+    while (CFileLoadRequest* req = m_queue.pop())
+        _complete(*req, CFileLoadRequest::Failed);
+}
+
+bool CAsyncFileLoader::submit(CFileLoadRequest& req, CMemPool& pool, const char* path, uint32_t alignment,
+    CFileLoadRequest::Callback callback, void* userData)
+{
+    if (!m_running || req.isBusy() || !pool.isConcurrent())
+        return false;
+
+    req.m_pool = &pool;
+    req.m_path = path;
+    req.m_alignment = alignment;
+    req.m_mem = nullptr;
+    req.m_callback = callback;
+    req.m_userData = userData;
+    ueventClear(&req.m_event);
+    __atomic_store_n(&req.m_state, CFileLoadRequest::Pending, __ATOMIC_RELEASE);
+
+    mutexLock(&m_mutex);
+    m_queue.add(&req);
+    mutexUnlock(&m_mutex);
+    ueventSignal(&m_wakeEvent);
+    return true;
+}
+
+bool CAsyncFileLoader::cancel(CFileLoadRequest& req)
+{
+    bool cancelled = false;
+
+    mutexLock(&m_mutex);
+    if (req.getState() == CFileLoadRequest::Pending)
+    {
+        m_queue.remove(&req);
+        cancelled = true;
+    }
+    mutexUnlock(&m_mutex);
+
+    if (cancelled)
+        _complete(req, CFileLoadRequest::Failed);
+    return cancelled;
+}
+
+void CAsyncFileLoader::_threadFunc(void* arg)
+{
+    CAsyncFileLoader* self = (CAsyncFileLoader*)arg;
+    traceSetThreadName("CAsyncFileLoader");
+    for (;;)
+    {
+        mutexLock(&self->m_mutex);
+        bool exit = self->m_exit;
+        CFileLoadRequest* req = exit ? nullptr : self->m_queue.pop();
+        if (req)
+            __atomic_store_n(&req->m_state, CFileLoadRequest::Loading, __ATOMIC_RELEASE);
+        mutexUnlock(&self->m_mutex);
+
+        if (exit)
+            break;
+
+        if (req)
+            self->_process(*req);
+        else
+            waitSingle(waiterForUEvent(&self->m_wakeEvent), UINT64_MAX);
+    }
+}
+
+void CAsyncFileLoader::_process(CFileLoadRequest& req)
+{
+    TRACE_SCOPE("CAsyncFileLoader::_process");
+    CFileReader file;
+    if (!file.open(req.m_path))
+        return _complete(req, CFileLoadRequest::Failed);
+
+    CMemPool::Handle mem = req.m_pool->allocate(file.getSize(), req.m_alignment);
+    if (!mem)
+        return _complete(req, CFileLoadRequest::Failed);
+
+    if (!ReadToMemory(file, *req.m_pool, mem, m_bounce))
+    {
+        mem.destroy();
+        return _complete(req, CFileLoadRequest::Failed);
+    }
+
+    req.m_mem = mem;
+    _complete(req, CFileLoadRequest::Done);
+}
+
+void CAsyncFileLoader::_complete(CFileLoadRequest& req, CFileLoadRequest::State state)
+{
+    // The completion event is signalled last, after the callback has run
+    __atomic_store_n(&req.m_state, state, __ATOMIC_RELEASE);
+    if (req.m_callback)
+        req.m_callback(req.m_userData, req);
+    ueventSignal(&req.m_event);
+}
@@ -5,5 +5,111 @@
 #pragma once
 #include "common.h"
 #include "CMemPool.h"
+#include "CIntrusiveList.h"
 
+// Files on an fs device (sdmc:, save:...) are read through the native fs API, romfs through unbuffered stdio, so that
+// either way the storage reads go straight to the destination when the pool is CPU-cached. Uncached memory is slow to
+// write with small stores, and can't be the target of an fs read, so the data then goes through a cached bounce buffer
+// and is copied with CopyToUncached.
 CMemPool::Handle LoadFile(CMemPool& pool, const char* path, uint32_t alignment = DK_CMDMEM_ALIGNMENT);
+
+// Copies to CPU-uncached memory with 64-byte non-temporal stores, rather than the narrower ones of memcpy
+void CopyToUncached(void* dst, const void* src, size_t size);
+
+class CFileLoadRequest
+{
+    friend class CAsyncFileLoader;
+
+public:
+    enum State
+    {
+        Idle,
+        Pending,
+        Loading,
+        Done,
+        Failed,
+    };
+
+    // Called on the I/O thread once the request completes (successfully or not)
+    using Callback = void(*)(void* userData, CFileLoadRequest& req);
+
+private:
+    CIntrusiveListNode<CFileLoadRequest> m_node;
+    CMemPool* m_pool;
+    const char* m_path;
+    uint32_t m_alignment;
+    CMemPool::Handle m_mem;
+    Callback m_callback;
+    void* m_userData;
+    UEvent m_event;
+    State m_state;
+
+public:
+    CFileLoadRequest() : m_node{}, m_pool{}, m_path{}, m_alignment{}, m_mem{}, m_callback{}, m_userData{}, m_event{}, m_state{Idle}
+    {
+        ueventCreate(&m_event, false);
+    }
+
+    State getState() const { return __atomic_load_n(&m_state, __ATOMIC_ACQUIRE); }
+    bool isBusy() const { State state = getState(); return state == Pending || state == Loading; }
+    bool isDone() const { return getState() == Done; }
+
+    // The completion event stays signalled until the request is submitted again. A finished
+    // request must not be reused or destroyed before its event has been signalled.
+    UEvent* getEvent() { return &m_event; }
+    Waiter getWaiter() { return waiterForUEvent(&m_event); }
+
+    bool wait(u64 timeout = UINT64_MAX)
+    {
+        if (getState() == Idle)
+            return false;
+        return R_SUCCEEDED(waitSingle(getWaiter(), timeout)) && isDone();
+    }
+
+    // Ownership of the loaded memory is transferred to the caller
+    CMemPool::Handle takeResult()
+    {
+        CMemPool::Handle mem = m_mem;
+        m_mem = nullptr;
+        return mem;
+    }
+};
+
+// Loads files on a dedicated I/O thread, so that the calling thread is not blocked by slow reads.
+// Since memory is allocated from the I/O thread, the destination pool must be in concurrent mode.
+class CAsyncFileLoader
+{
+    static constexpr size_t StackSize = 0x8000;
+
+    Thread m_thread;
+    Mutex m_mutex;
+    UEvent m_wakeEvent;
+    CIntrusiveList<CFileLoadRequest, &CFileLoadRequest::m_node> m_queue;
+    void* m_bounce;
+    bool m_running;
+    bool m_exit;
+
+    static void _threadFunc(void* arg);
+    void _process(CFileLoadRequest& req);
+    void _complete(CFileLoadRequest& req, CFileLoadRequest::State state);
+
+public:
+    CAsyncFileLoader() : m_thread{}, m_mutex{}, m_wakeEvent{}, m_queue{}, m_bounce{}, m_running{}, m_exit{} { }
+    ~CAsyncFileLoader()
+    {
+        stop();
+    }
+
+    CAsyncFileLoader(CAsyncFileLoader const&) = delete;
+    CAsyncFileLoader& operator=(CAsyncFileLoader const&) = delete;
+
+    bool start(int priority = 0x2C, int cpuid = -2);
+    void stop();
+
+    // The path string must remain valid until the request completes
+    bool submit(CFileLoadRequest& req, CMemPool& pool, const char* path, uint32_t alignment = DK_CMDMEM_ALIGNMENT,
+        CFileLoadRequest::Callback callback = nullptr, void* userData = nullptr);
+
+    // Removes a request that has not yet started loading; returns false if it is too late for that
+    bool cancel(CFileLoadRequest& req);
+};
@@ -4,9 +4,13 @@
 */
 #include "common.h"
 #include <unistd.h>
+#include "trace.h"
 
 //#define DEBUG_NXLINK
 
+// Spans of the framework (and of TRACE_SCOPE in the examples) are written to the file, see trace.h
+//#define DEBUG_TRACE "sdmc:/deko_examples_trace.json"
+
 #ifdef DEBUG_NXLINK
 static int nxlink_sock = -1;
 #endif
@@ -21,10 +25,18 @@ extern "C" void userAppInit(void)
     socketInitializeDefault();
     nxlink_sock = nxlinkStdioForDebug();
 #endif
+
+#ifdef DEBUG_TRACE
+    traceInit(DEBUG_TRACE);
+#endif
 }
 
 extern "C" void userAppExit(void)
 {
+#ifdef DEBUG_TRACE
+    traceExit();
+#endif
+
 #ifdef DEBUG_NXLINK
     if (nxlink_sock != -1)
         close(nxlink_sock);
@@ -1,19 +1,37 @@
 #version 460
 
+#define TILE_SIZE 16
+#define MAX_LIGHTS_PER_TILE 63
+
 layout (location = 0) out vec4 outColor;
 
 layout (binding = 0) uniform sampler2D texAlbedo;
 layout (binding = 1) uniform sampler2D texNormal;
 layout (binding = 2) uniform sampler2D texViewDir;
 
+struct PointLight
+{
+    vec4 posRadius; // xyz is view space position, w is radius of influence
+    vec4 color;
+};
+
 layout (std140, binding = 0) uniform Lighting
 {
-    vec4 lightPos; // if w=0 this is lightDir
-    vec3 ambient;
-    vec3 diffuse;
+    vec4 ambient;
     vec4 specular; // w is shininess
+    uint numTilesX;
 } u;
 
+layout (std430, binding = 0) readonly buffer Lights
+{
+    PointLight lights[];
+} l;
+
+layout (std430, binding = 1) readonly buffer TileLights
+{
+    uint data[];
+} t;
+
 void main()
 {
     // Uncomment the coordinate reversion below to observe the effects of tiled corruption
@@ -23,27 +41,36 @@ void main()
     vec4 albedo = texelFetch(texAlbedo, coord, 0);
     vec3 normal = texelFetch(texNormal, coord, 0).xyz;
     vec3 viewDir = texelFetch(texViewDir, coord, 0).xyz;
-
-    // Calculate light direction (i.e. vector that points *towards* the light source)
-    vec3 lightDir;
-    if (u.lightPos.w != 0.0)
-        lightDir = normalize(u.lightPos.xyz + viewDir);
-    else
-        lightDir = -u.lightPos.xyz;
+    vec3 pos = -viewDir;
     viewDir = normalize(viewDir);
 
-    // Calculate diffuse factor
-    float diffuse = max(0.0, dot(normal,lightDir));
+    // Retrieve the list of lights affecting this tile, as calculated by the light culling pass
+    uvec2 tile = uvec2(coord) / TILE_SIZE;
+    uint base = (tile.y * u.numTilesX + tile.x) * (MAX_LIGHTS_PER_TILE + 1);
+    uint numLights = t.data[base];
+
+    // Accumulate the contribution of each light
+    vec3 color = u.ambient.rgb;
+    for (uint i = 0; i < numLights; i ++)
+    {
+        PointLight light = l.lights[t.data[base + 1 + i]];
+
+        // Calculate light direction (i.e. vector that points *towards* the light source) and attenuation
+        vec3 lightVec = light.posRadius.xyz - pos;
+        float dist = length(lightVec);
+        vec3 lightDir = lightVec / dist;
+        float atten = max(0.0, 1.0 - dist / light.posRadius.w);
+        atten *= atten;
+
+        // Calculate diffuse factor
+        float diffuse = max(0.0, dot(normal,lightDir));
 
-    // Calculate specular factor (Blinn-Phong)
-    vec3 halfwayDir = normalize(lightDir + viewDir);
-    float specular = pow(max(0.0, dot(normal,halfwayDir)), u.specular.w);
+        // Calculate specular factor (Blinn-Phong)
+        vec3 halfwayDir = normalize(lightDir + viewDir);
+        float specular = pow(max(0.0, dot(normal,halfwayDir)), u.specular.w);
 
-    // Calculate the color
-    vec3 color =
-        u.ambient +
-        albedo.rgb*u.diffuse*vec3(diffuse) +
-        u.specular.xyz*vec3(specular);
+        color += atten * light.color.rgb * (albedo.rgb*vec3(diffuse) + u.specular.xyz*vec3(specular));
+    }
 
     // Reinhard tone mapping
     vec3 mappedColor = albedo.a * color / (vec3(1.0) + color);
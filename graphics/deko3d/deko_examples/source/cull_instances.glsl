@@ -0,0 +1,110 @@
+#version 460
+
+layout (local_size_x = 64) in;
+
+struct Instance
+{
+	vec4 posScale; // xyz is position, w is scale
+	vec4 params;   // x is rotation around the Y axis
+};
+
+layout (std140, binding = 0) uniform Culling
+{
+	vec4 planes[6];   // world space frustum planes, pointing inwards
+	vec4 meshSphere;  // bounding sphere of the mesh in model space
+	mat4 prevViewProj; // view-projection matrix the depth pyramid was rendered with
+	vec4 hizParams;   // xy is the size of the depth buffer, z is the number of pyramid levels, w enables the test
+	uint numInstances;
+} u;
+
+// Depth pyramid built from the previous frame's depth buffer, each texel holding the farthest depth below it
+layout (binding = 0) uniform sampler2D hiz;
+
+layout (std430, binding = 0) readonly buffer Instances
+{
+	Instance instances[];
+} i;
+
+layout (std430, binding = 1) writeonly buffer VisibleInstances
+{
+	uint visible[];
+} o;
+
+layout (std430, binding = 2) buffer DrawArgs
+{
+	uint indexCount;
+	uint instanceCount;
+	uint firstIndex;
+	int vertexOffset;
+	uint firstInstance;
+} args;
+
+// Tests the box around a bounding sphere against the depth pyramid, as seen from the previous frame's camera
+bool isOccluded(vec3 center, float radius)
+{
+	vec2 uvMin = vec2(1.0), uvMax = vec2(0.0);
+	float minDepth = 1.0;
+	for (int c = 0; c < 8; c ++)
+	{
+		vec3 corner = center + radius*vec3((c & 1) != 0 ? 1.0 : -1.0, (c & 2) != 0 ? 1.0 : -1.0, (c & 4) != 0 ? 1.0 : -1.0);
+		vec4 clip = u.prevViewProj * vec4(corner, 1.0);
+
+		// The box crosses the camera plane: nothing sensible can be said about it
+		if (clip.w <= 0.0)
+			return false;
+
+		// NDC +Y is the top of the image, which is the first row of the depth buffer
+		vec3 ndc = clip.xyz / clip.w;
+		vec2 uv = vec2(0.5 + 0.5*ndc.x, 0.5 - 0.5*ndc.y);
+		uvMin = min(uvMin, uv);
+		uvMax = max(uvMax, uv);
+		minDepth = min(minDepth, ndc.z);
+	}
+
+	// Partly outside of the previous frame's view: the part that was not rendered might be visible
+	if (any(lessThan(uvMin, vec2(0.0))) || any(greaterThan(uvMax, vec2(1.0))))
+		return false;
+
+	// Pick the level at which the box covers at most 2x2 texels (level 0 has half the size of the depth buffer)
+	vec2 size = (uvMax - uvMin) * u.hizParams.xy * 0.5;
+	int lod = clamp(int(ceil(log2(max(max(size.x, size.y), 1.0)))), 0, int(u.hizParams.z) - 1);
+	ivec2 levelSize = textureSize(hiz, lod);
+	ivec2 texMin = min(ivec2(uvMin * u.hizParams.xy) >> (lod + 1), levelSize - 1);
+	ivec2 texMax = min(ivec2(uvMax * u.hizParams.xy) >> (lod + 1), levelSize - 1);
+
+	float maxDepth = 0.0;
+	for (int y = texMin.y; y <= texMax.y; y ++)
+		for (int x = texMin.x; x <= texMax.x; x ++)
+			maxDepth = max(maxDepth, texelFetch(hiz, ivec2(x, y), lod).r);
+
+	// Occluded if the nearest point of the box lies behind everything that was drawn over it
+	return minDepth > maxDepth;
+}
+
+void main()
+{
+	uint id = gl_GlobalInvocationID.x;
+	if (id >= u.numInstances)
+		return;
+
+	// Calculate the bounding sphere of the instance (the rotation is around the Y axis, so only XZ changes)
+	Instance inst = i.instances[id];
+	float c = cos(inst.params.x), s = sin(inst.params.x);
+	vec3 center = u.meshSphere.xyz;
+	center = vec3(c*center.x + s*center.z, center.y, -s*center.x + c*center.z);
+	center = center*inst.posScale.w + inst.posScale.xyz;
+	float radius = u.meshSphere.w*inst.posScale.w;
+
+	// Test the sphere against each frustum plane
+	for (int p = 0; p < 6; p ++)
+		if (dot(u.planes[p].xyz, center) + u.planes[p].w < -radius)
+			return;
+
+	// Skip the instances hidden behind others in the previous frame
+	if (u.hizParams.w != 0.0 && isOccluded(center, radius))
+		return;
+
+	// The instance is visible: append it to the compacted list, which also bumps the instance count of the draw
+	uint slot = atomicAdd(args.instanceCount, 1);
+	o.visible[slot] = id;
+}
@@ -0,0 +1,33 @@
+#version 460
+
+layout (local_size_x = 8, local_size_y = 8) in;
+
+// The depth buffer for the first level, the previous level of the pyramid for the others
+layout (binding = 0) uniform sampler2D srcDepth;
+layout (binding = 0, r32f) uniform writeonly image2D dstDepth;
+
+layout (std140, binding = 0) uniform Level
+{
+	ivec2 srcSize;
+	ivec2 dstSize;
+} u;
+
+void main()
+{
+	ivec2 dst = ivec2(gl_GlobalInvocationID.xy);
+	if (any(greaterThanEqual(dst, u.dstSize)))
+		return;
+
+	// Each texel keeps the farthest depth of the 2x2 texels below it. Levels are rounded down, so when the
+	// source size is odd the last texel also covers the extra row/column, keeping the pyramid conservative.
+	ivec2 first = dst*2;
+	ivec2 extra = ivec2(equal(dst, u.dstSize - 1)) * (u.srcSize & 1);
+	ivec2 last = min(first + 1 + extra, u.srcSize - 1);
+
+	float depth = 0.0;
+	for (int y = first.y; y <= last.y; y ++)
+		for (int x = first.x; x <= last.x; x ++)
+			depth = max(depth, texelFetch(srcDepth, ivec2(x, y), 0).r);
+
+	imageStore(dstDepth, dst, vec4(depth));
+}
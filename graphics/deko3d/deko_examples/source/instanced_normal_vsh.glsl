@@ -0,0 +1,46 @@
+#version 460
+
+layout (location = 0) in vec3 inPos;
+layout (location = 1) in vec3 inNormal;
+
+layout (location = 0) out vec3 outWorldPos;
+layout (location = 1) out vec3 outNormal;
+
+struct Instance
+{
+    vec4 posScale; // xyz is position, w is scale
+    vec4 params;   // x is rotation around the Y axis
+};
+
+layout (std140, binding = 0) uniform Transformation
+{
+    mat4 viewMtx;
+    mat4 projMtx;
+} u;
+
+layout (std430, binding = 0) readonly buffer Instances
+{
+    Instance instances[];
+} i;
+
+layout (std430, binding = 1) readonly buffer VisibleInstances
+{
+    uint visible[];
+} v;
+
+void main()
+{
+    // Fetch the data of the instance, through the compacted list generated by the culling pass
+    Instance inst = i.instances[v.visible[gl_InstanceIndex]];
+
+    float c = cos(inst.params.x), s = sin(inst.params.x);
+    mat3 rotMtx = mat3(c, 0.0, -s, 0.0, 1.0, 0.0, s, 0.0, c);
+
+    vec3 modelPos = rotMtx * inPos * inst.posScale.w + inst.posScale.xyz;
+    vec4 worldPos = u.viewMtx * vec4(modelPos, 1.0);
+    gl_Position = u.projMtx * worldPos;
+
+    outWorldPos = worldPos.xyz;
+
+    outNormal = normalize(mat3(u.viewMtx) * rotMtx * inNormal);
+}
@@ -0,0 +1,28 @@
+#version 460
+
+layout (location = 0) in vec3 inPos;
+layout (location = 1) in vec2 inTexCoord;
+layout (location = 2) in vec4 inInstPosScale; // xyz is position, w is scale
+layout (location = 3) in vec4 inInstParams;   // x is the rotation phase, y is the texture layer
+
+layout (location = 0) out vec3 outTexCoord;
+
+layout (std140, binding = 0) uniform Transformation
+{
+    mat4 viewMtx;
+    mat4 projMtx;
+    vec4 time;
+} u;
+
+void main()
+{
+    float angle = u.time.x + inInstParams.x;
+    float c = cos(angle), s = sin(angle);
+    mat3 rotMtx = mat3(c, 0.0, -s, 0.0, 1.0, 0.0, s, 0.0, c);
+
+    vec3 modelPos = rotMtx * inPos * inInstPosScale.w + inInstPosScale.xyz;
+    gl_Position = u.projMtx * (u.viewMtx * vec4(modelPos, 1.0));
+
+    // The layer is passed through as the third texture coordinate
+    outTexCoord = vec3(inTexCoord, inInstParams.y);
+}
@@ -0,0 +1,109 @@
+#version 460
+
+#define TILE_SIZE 16
+#define MAX_LIGHTS_PER_TILE 63
+
+layout (local_size_x = TILE_SIZE, local_size_y = TILE_SIZE) in;
+
+struct PointLight
+{
+	vec4 posRadius; // xyz is view space position, w is radius of influence
+	vec4 color;
+};
+
+layout (binding = 2) uniform sampler2D texViewDir;
+
+layout (std140, binding = 0) uniform Tiling
+{
+	uvec2 screenSize;
+	uint numTilesX;
+	uint numLights;
+} u;
+
+layout (std430, binding = 0) readonly buffer Lights
+{
+	PointLight lights[];
+} l;
+
+// Each tile is made out of a light count followed by the list of light indices
+layout (std430, binding = 1) writeonly buffer TileLights
+{
+	uint data[];
+} t;
+
+shared uint tileMin[3];
+shared uint tileMax[3];
+shared uint tileNumLights;
+shared uint tileLights[MAX_LIGHTS_PER_TILE];
+
+// Maps floats to uints in an order preserving way, so that they can be used with atomic min/max
+uint floatToOrdered(float f)
+{
+	uint u = floatBitsToUint(f);
+	return (u & 0x80000000U) != 0 ? ~u : (u | 0x80000000U);
+}
+
+float orderedToFloat(uint u)
+{
+	return uintBitsToFloat((u & 0x80000000U) != 0 ? (u & 0x7FFFFFFFU) : ~u);
+}
+
+void main()
+{
+	uint localId = gl_LocalInvocationIndex;
+	if (localId == 0)
+	{
+		for (int i = 0; i < 3; i ++)
+		{
+			tileMin[i] = 0xFFFFFFFFU;
+			tileMax[i] = 0U;
+		}
+		tileNumLights = 0;
+	}
+	barrier();
+
+	// Calculate the view space bounding box of the surfaces visible in this tile. The view direction
+	// buffer contains the negated view space position, and is cleared to zero where nothing was drawn.
+	ivec2 coord = ivec2(gl_GlobalInvocationID.xy);
+	if (all(lessThan(uvec2(coord), u.screenSize)))
+	{
+		vec3 viewDir = texelFetch(texViewDir, coord, 0).xyz;
+		if (viewDir != vec3(0.0))
+		{
+			vec3 pos = -viewDir;
+			for (int i = 0; i < 3; i ++)
+			{
+				atomicMin(tileMin[i], floatToOrdered(pos[i]));
+				atomicMax(tileMax[i], floatToOrdered(pos[i]));
+			}
+		}
+	}
+	barrier();
+
+	// Test every light against the bounding box (skipping empty tiles), with each thread taking care of a subset
+	bool empty = tileMin[0] > tileMax[0];
+	vec3 boxMin = vec3(orderedToFloat(tileMin[0]), orderedToFloat(tileMin[1]), orderedToFloat(tileMin[2]));
+	vec3 boxMax = vec3(orderedToFloat(tileMax[0]), orderedToFloat(tileMax[1]), orderedToFloat(tileMax[2]));
+	for (uint i = localId; !empty && i < u.numLights; i += TILE_SIZE*TILE_SIZE)
+	{
+		vec4 light = l.lights[i].posRadius;
+		vec3 closest = clamp(light.xyz, boxMin, boxMax);
+		vec3 delta = light.xyz - closest;
+		if (dot(delta, delta) <= light.w*light.w)
+		{
+			uint slot = atomicAdd(tileNumLights, 1);
+			if (slot < MAX_LIGHTS_PER_TILE)
+				tileLights[slot] = i;
+		}
+	}
+	barrier();
+
+	// Write out the list of lights affecting this tile
+	uint tileId = gl_WorkGroupID.y * u.numTilesX + gl_WorkGroupID.x;
+	uint base = tileId * (MAX_LIGHTS_PER_TILE + 1);
+	uint count = min(tileNumLights, MAX_LIGHTS_PER_TILE);
+	if (localId == 0)
+		t.data[base] = count;
+	if (localId < count)
+		t.data[base + 1 + localId] = tileLights[localId];
+}
@@ -17,6 +17,11 @@ void Example06(void);
 void Example07(void);
 void Example08(void);
 void Example09(void);
+void Example10(void);
+void Example11(void);
+void Example12(void);
+void Example13(void);
+void Example14(void);
 
 namespace
 {
@@ -33,11 +38,16 @@ namespace
         Example{ Example02, "02: Triangle"                                                },
         Example{ Example03, "03: Cube"                                                    },
         Example{ Example04, "04: Textured Cube"                                           },
-        Example{ Example05, "05: Simple Tessellation"                                     },
+        Example{ Example05, "05: Tessellation (Adaptive Terrain LOD)"                     },
         Example{ Example06, "06: Simple Multisampling"                                    },
         Example{ Example07, "07: Mesh Loading and Lighting (sRGB)"                        },
         Example{ Example08, "08: Deferred Shading (Multipass Rendering with Tiled Cache)" },
         Example{ Example09, "09: Simple Compute Shader (Geometry Generation)"             },
+        Example{ Example10, "10: GPU-Driven Culling (Indirect Draws, Hi-Z Occlusion)"     },
+        Example{ Example11, "11: Texture Arrays (Batching Materials)"                     },
+        Example{ Example12, "12: Draw Call Throughput (Benchmark)"                        },
+        Example{ Example13, "13: Signed Distance Field Text (Shared Font)"                },
+        Example{ Example14, "14: Memory Pool Churn (Benchmark)"                           },
     };
 }
 
@@ -0,0 +1,18 @@
+#version 460
+
+layout (location = 0) in vec2 inTexCoord;
+layout (location = 1) in vec4 inColor;
+layout (location = 0) out vec4 outColor;
+
+layout (binding = 0) uniform sampler2DArray texture0;
+
+void main()
+{
+    // The atlas stores the signed distance to the outline, with 0.5 lying right on it.
+    // Smoothing over the screen space derivative of the distance keeps the edge one pixel wide
+    // at any scale, which is what makes the text antialiased both when shrunk and magnified.
+    float dist = texture(texture0, vec3(inTexCoord, 0.0)).r;
+    float width = fwidth(dist);
+    float alpha = smoothstep(0.5 - width, 0.5 + width, dist);
+    outColor = vec4(inColor.rgb, inColor.a * alpha);
+}
@@ -0,0 +1,25 @@
+#version 460
+
+layout (location = 0) in vec4 inRect;  // screen space rectangle (x0, y0, x1, y1), in pixels
+layout (location = 1) in vec4 inUv;    // atlas rectangle (u0, v0, u1, v1)
+layout (location = 2) in vec4 inColor;
+
+layout (location = 0) out vec2 outTexCoord;
+layout (location = 1) out vec4 outColor;
+
+layout (std140, binding = 0) uniform Viewport
+{
+    vec4 scale; // xy: pixels to NDC scale factors
+} u;
+
+void main()
+{
+    // Build the corners of the quad out of the vertex index: (0,0) (0,1) (1,1) (1,0)
+    vec2 corner = vec2(gl_VertexID >> 1, (gl_VertexID ^ (gl_VertexID >> 1)) & 1);
+
+    vec2 pos = mix(inRect.xy, inRect.zw, corner);
+    gl_Position = vec4(pos.x * u.scale.x - 1.0, 1.0 - pos.y * u.scale.y, 0.0, 1.0);
+
+    outTexCoord = mix(inUv.xy, inUv.zw, corner);
+    outColor = inColor;
+}
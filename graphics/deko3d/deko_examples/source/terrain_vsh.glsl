@@ -0,0 +1,9 @@
+#version 460
+
+layout (location = 0) in vec3 inPos;
+
+void main()
+{
+    // Patch corners stay in world space: the control shader works out the detail from them
+    gl_Position = vec4(inPos, 1.0);
+}
@@ -0,0 +1,116 @@
+#version 460
+
+layout (vertices = 4) out;
+
+layout (std140, binding = 0) uniform TerrainParams
+{
+    mat4 mdlvMtx;
+    mat4 projMtx;
+    vec4 lodParams;     // x: viewport width, y: viewport height, z: target edge length in pixels, w: max level
+    vec4 terrainParams; // x: height scale, y: fixed level (0 for adaptive)
+} u;
+
+layout (std430, binding = 0) buffer TessStats
+{
+    uint visiblePatches;
+    uint culledPatches;
+    uint triangles;
+} stats;
+
+// Must match the function in tess_terrain_tesh.glsl, returns a value within [0,1]
+float terrainHeight(vec2 p)
+{
+    float h = 0.5;
+    h += 0.25 * sin(p.x * 0.020) * cos(p.y * 0.023);
+    h += 0.15 * sin(p.x * 0.061 + 0.7) * sin(p.y * 0.057);
+    h += 0.08 * sin(p.x * 0.17 + p.y * 0.13);
+    h += 0.02 * sin(p.x * 0.41) * cos(p.y * 0.37);
+    return h;
+}
+
+// The patch's bounding box, spanning every height the terrain can have, is outside the frustum
+// when all of its corners are on the outer side of the same clip plane
+bool patchCulled(vec3 bmin, vec3 bmax)
+{
+    mat4 mvp = u.projMtx * u.mdlvMtx;
+    uint outside[6] = uint[6](0u, 0u, 0u, 0u, 0u, 0u);
+    for (int i = 0; i < 8; i ++)
+    {
+        vec3 corner = vec3((i & 1) != 0 ? bmax.x : bmin.x, (i & 2) != 0 ? bmax.y : bmin.y, (i & 4) != 0 ? bmax.z : bmin.z);
+        vec4 clip = mvp * vec4(corner, 1.0);
+        outside[0] += clip.x < -clip.w ? 1u : 0u;
+        outside[1] += clip.x >  clip.w ? 1u : 0u;
+        outside[2] += clip.y < -clip.w ? 1u : 0u;
+        outside[3] += clip.y >  clip.w ? 1u : 0u;
+        outside[4] += clip.z < 0.0     ? 1u : 0u;
+        outside[5] += clip.z >  clip.w ? 1u : 0u;
+    }
+
+    for (int i = 0; i < 6; i ++)
+        if (outside[i] == 8u)
+            return true;
+    return false;
+}
+
+// The level of an edge only depends on its two endpoints, so that the patches sharing it agree
+// on it (otherwise cracks would appear). The edge is turned into a sphere around it, whose
+// projected diameter is then divided into segments of the target length.
+float edgeLevel(vec3 a, vec3 b)
+{
+    vec3 center = (a + b) * 0.5;
+    float radius = distance(a, b) * 0.5;
+    float depth = max(-(u.mdlvMtx * vec4(center, 1.0)).z, 1e-3);
+    float diameterPixels = 2.0 * radius * u.projMtx[1][1] * 0.5 * u.lodParams.y / depth;
+    return clamp(diameterPixels / u.lodParams.z, 1.0, u.lodParams.w);
+}
+
+void main()
+{
+    if (gl_InvocationID == 0)
+    {
+        vec3 p[4];
+        for (int i = 0; i < 4; i ++)
+        {
+            p[i] = gl_in[i].gl_Position.xyz;
+            p[i].y = terrainHeight(p[i].xz) * u.terrainParams.x;
+        }
+
+        vec4 outer;
+        if (u.terrainParams.y > 0.0)
+            outer = vec4(u.terrainParams.y);
+        else
+        {
+            vec3 bmin = vec3(min(min(p[0].x, p[1].x), min(p[2].x, p[3].x)), 0.0, min(min(p[0].z, p[1].z), min(p[2].z, p[3].z)));
+            vec3 bmax = vec3(max(max(p[0].x, p[1].x), max(p[2].x, p[3].x)), u.terrainParams.x, max(max(p[0].z, p[1].z), max(p[2].z, p[3].z)));
+            if (patchCulled(bmin, bmax))
+                outer = vec4(0.0);
+            else
+            {
+                // Edges of the quad domain: u=0, v=0, u=1, v=1 (see tess_terrain_tesh.glsl for the corner order)
+                outer.x = edgeLevel(p[0], p[3]);
+                outer.y = edgeLevel(p[0], p[1]);
+                outer.z = edgeLevel(p[1], p[2]);
+                outer.w = edgeLevel(p[3], p[2]);
+            }
+        }
+
+        // A level of 0 on any outer edge discards the whole patch
+        gl_TessLevelOuter[0] = outer.x;
+        gl_TessLevelOuter[1] = outer.y;
+        gl_TessLevelOuter[2] = outer.z;
+        gl_TessLevelOuter[3] = outer.w;
+        gl_TessLevelInner[0] = max(outer.y, outer.w);
+        gl_TessLevelInner[1] = max(outer.x, outer.z);
+
+        if (outer.x > 0.0)
+        {
+            // The number of triangles of the patch, approximately (each inner cell is a quad)
+            atomicAdd(stats.visiblePatches, 1u);
+            atomicAdd(stats.triangles, uint(2.0 * ceil(max(outer.y, outer.w)) * ceil(max(outer.x, outer.z))));
+        }
+        else
+            atomicAdd(stats.culledPatches, 1u);
+    }
+
+    gl_out[gl_InvocationID].gl_Position = gl_in[gl_InvocationID].gl_Position;
+}
@@ -0,0 +1,41 @@
+#version 460
+
+layout (quads, fractional_odd_spacing, ccw) in;
+
+layout (location = 0) out vec3 outColor;
+
+layout (std140, binding = 0) uniform TerrainParams
+{
+    mat4 mdlvMtx;
+    mat4 projMtx;
+    vec4 lodParams;
+    vec4 terrainParams;
+} u;
+
+// Must match the function in tess_terrain_tcsh.glsl
+float terrainHeight(vec2 p)
+{
+    float h = 0.5;
+    h += 0.25 * sin(p.x * 0.020) * cos(p.y * 0.023);
+    h += 0.15 * sin(p.x * 0.061 + 0.7) * sin(p.y * 0.057);
+    h += 0.08 * sin(p.x * 0.17 + p.y * 0.13);
+    h += 0.02 * sin(p.x * 0.41) * cos(p.y * 0.37);
+    return h;
+}
+
+void main()
+{
+    // Patch corners: 0 at (u=0,v=0), 1 at (1,0), 2 at (1,1), 3 at (0,1)
+    vec4 pos = mix(
+        mix(gl_in[0].gl_Position, gl_in[1].gl_Position, gl_TessCoord.x),
+        mix(gl_in[3].gl_Position, gl_in[2].gl_Position, gl_TessCoord.x),
+        gl_TessCoord.y);
+
+    float h = terrainHeight(pos.xz);
+    pos.y = h * u.terrainParams.x;
+    gl_Position = u.projMtx * u.mdlvMtx * pos;
+
+    // Grass in the valleys, rock on the slopes, snow on the peaks
+    vec3 grass = vec3(0.25, 0.55, 0.20), rock = vec3(0.50, 0.42, 0.35), snow = vec3(0.95, 0.95, 1.00);
+    outColor = h < 0.6 ? mix(grass, rock, smoothstep(0.3, 0.6, h)) : mix(rock, snow, smoothstep(0.7, 0.85, h));
+}
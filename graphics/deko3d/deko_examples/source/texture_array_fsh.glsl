@@ -0,0 +1,11 @@
+#version 460
+
+layout (location = 0) in vec3 inTexCoord;
+layout (location = 0) out vec4 outColor;
+
+layout (binding = 0) uniform sampler2DArray texture0;
+
+void main()
+{
+    outColor = texture(texture0, inTexCoord);
+}
@@ -0,0 +1,37 @@
+#version 460
+
+layout (location = 0) in vec3 inPos;
+layout (location = 1) in vec2 inOctNormal;
+layout (location = 2) in vec4 inAttrib;
+
+layout (location = 0) out vec3 outWorldPos;
+layout (location = 1) out vec3 outNormal;
+layout (location = 2) out vec4 outAttrib;
+
+layout (std140, binding = 0) uniform Transformation
+{
+    mat4 mdlvMtx;
+    mat4 projMtx;
+} u;
+
+// Decodes a normal stored using octahedral encoding (see tools/mkdkmesh.py)
+vec3 decodeOctahedral(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (n.z < 0.0)
+        n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+    return normalize(n);
+}
+
+void main()
+{
+    vec4 worldPos = u.mdlvMtx * vec4(inPos, 1.0);
+    gl_Position = u.projMtx * worldPos;
+
+    outWorldPos = worldPos.xyz;
+
+    outNormal = normalize(mat3(u.mdlvMtx) * decodeOctahedral(inOctNormal));
+
+    // Pass through the user-defined attribute (the texture coordinates)
+    outAttrib = inAttrib;
+}
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+#
+# mkdkmesh.py: packs meshes into the .dkmesh format read by CMesh::load
+#
+# Usage:
+#   mkdkmesh.py --layout pn -o out.dkmesh mesh-vtx.bin mesh-idx.bin
+#       Converts raw float vertex data (pn: position+normal, pnt: position+normal+texcoord)
+#       and raw 16-bit indices (use --idx32 for 32-bit ones) into a packed mesh.
+#
+# The packed vertices are 16 bytes: half-float position (x,y,z,1), octahedral-encoded
+# snorm16 normal, unorm16 texture coordinates (expected to lie within [0,1]). Triangles
+# are reordered for post-transform vertex cache hits (Forsyth's algorithm), vertices are
+# reordered by first use for fetch locality, and the triangle list is split into meshlets
+# with bounding spheres.
+#
+import argparse
+import math
+import struct
+import sys
+
+DKMESH_MAGIC = 0x534D4B44
+
+HEADER = struct.Struct('<10I4f')
+VERTEX = struct.Struct('<4e2h2H')
+MESHLET = struct.Struct('<4f4I')
+
+LAYOUTS = { 'pn': 6, 'pnt': 8 }
+
+MESHLET_MAX_VERTICES = 64
+MESHLET_MAX_TRIANGLES = 124
+
+# Forsyth's linear-speed vertex cache optimisation
+CACHE_SIZE = 32
+CACHE_DECAY_POWER = 1.5
+LAST_TRI_SCORE = 0.75
+VALENCE_BOOST_SCALE = 2.0
+VALENCE_BOOST_POWER = 0.5
+
+def vertex_score(cache_pos, num_tris):
+    if num_tris == 0:
+        return -1.0
+    score = 0.0
+    if cache_pos >= 0:
+        if cache_pos < 3:
+            score = LAST_TRI_SCORE
+        else:
+            score = (1.0 - (cache_pos - 3) / (CACHE_SIZE - 3)) ** CACHE_DECAY_POWER
+    return score + VALENCE_BOOST_SCALE * (num_tris ** -VALENCE_BOOST_POWER)
+
+def optimize_triangles(indices, num_vertices):
+    num_tris = len(indices) // 3
+    vtx_tris = [[] for _ in range(num_vertices)]
+    for t in range(num_tris):
+        for k in range(3):
+            vtx_tris[indices[3*t+k]].append(t)
+
+    remaining = [len(l) for l in vtx_tris]
+    cache_pos = [-1] * num_vertices
+    vscore = [vertex_score(-1, remaining[v]) for v in range(num_vertices)]
+    tscore = [sum(vscore[indices[3*t+k]] for k in range(3)) for t in range(num_tris)]
+    emitted = [False] * num_tris
+    cache = []
+    out = []
+
+    best = max(range(num_tris), key=lambda t: tscore[t]) if num_tris else -1
+    while len(out) < num_tris:
+        if best < 0:
+            # Cache ran dry, fall back to a full search
+            best = max((t for t in range(num_tris) if not emitted[t]), key=lambda t: tscore[t])
+
+        emitted[best] = True
+        tri = indices[3*best:3*best+3]
+        out.append(best)
+        for v in tri:
+            vtx_tris[v].remove(best)
+            remaining[v] -= 1
+
+        # Move the vertices of the triangle to the front of the cache
+        for v in reversed(tri):
+            if v in cache:
+                cache.remove(v)
+            cache.insert(0, v)
+        evicted = cache[CACHE_SIZE:]
+        del cache[CACHE_SIZE:]
+        for v in evicted:
+            cache_pos[v] = -1
+
+        # Update scores of the vertices in the cache and of their triangles
+        touched = set()
+        for i, v in enumerate(cache):
+            cache_pos[v] = i
+        for v in list(cache) + evicted:
+            vscore[v] = vertex_score(cache_pos[v], remaining[v])
+            touched.update(vtx_tris[v])
+        best, best_score = -1, -1.0
+        for t in touched:
+            tscore[t] = sum(vscore[indices[3*t+k]] for k in range(3))
+            if tscore[t] > best_score:
+                best, best_score = t, tscore[t]
+
+    return [indices[3*t+k] for t in out for k in range(3)]
+
+def bounding_sphere(points):
+    # Ritter's algorithm: good enough for culling purposes
+    p0 = points[0]
+    p1 = max(points, key=lambda p: dist2(p, p0))
+    p2 = max(points, key=lambda p: dist2(p, p1))
+    center = [(a + b) / 2 for a, b in zip(p1, p2)]
+    radius = math.sqrt(dist2(p1, p2)) / 2
+    for p in points:
+        d = math.sqrt(dist2(p, center))
+        if d > radius:
+            radius = (radius + d) / 2
+            center = [c + (q - c) * (d - radius) / d for c, q in zip(center, p)]
+    return center, radius
+
+def dist2(a, b):
+    return sum((x - y) ** 2 for x, y in zip(a, b))
+
+def build_meshlets(indices, positions):
+    meshlets = []
+    first = 0
+    verts = set()
+    for t in range(len(indices) // 3):
+        tri = indices[3*t:3*t+3]
+        new_verts = verts | set(tri)
+        if len(new_verts) > MESHLET_MAX_VERTICES or t - first // 3 >= MESHLET_MAX_TRIANGLES:
+            meshlets.append((first, 3*t - first, verts))
+            first = 3*t
+            new_verts = set(tri)
+        verts = new_verts
+    if len(indices) > first:
+        meshlets.append((first, len(indices) - first, verts))
+
+    out = []
+    for first, count, verts in meshlets:
+        center, radius = bounding_sphere([positions[v] for v in verts])
+        out.append((center, radius, first, count))
+    return out
+
+def encode_octahedral(n):
+    length = abs(n[0]) + abs(n[1]) + abs(n[2])
+    if length == 0.0:
+        return (0, 0)
+    x, y, z = n[0] / length, n[1] / length, n[2] / length
+    if z < 0.0:
+        x, y = (1.0 - abs(y)) * math.copysign(1.0, x), (1.0 - abs(x)) * math.copysign(1.0, y)
+    return (round(max(-1.0, min(1.0, x)) * 32767), round(max(-1.0, min(1.0, y)) * 32767))
+
+def encode_unorm16(x):
+    return round(max(0.0, min(1.0, x)) * 65535)
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack a mesh into the .dkmesh format')
+    parser.add_argument('--layout', choices=sorted(LAYOUTS), default='pn')
+    parser.add_argument('--idx32', action='store_true', help='input indices are 32-bit')
+    parser.add_argument('-o', '--output', required=True)
+    parser.add_argument('vertices')
+    parser.add_argument('indices')
+    args = parser.parse_args()
+
+    floats_per_vtx = LAYOUTS[args.layout]
+    with open(args.vertices, 'rb') as f:
+        data = f.read()
+    if len(data) % (4*floats_per_vtx):
+        sys.exit('%s: size is not a multiple of the vertex size' % args.vertices)
+    num_vertices = len(data) // (4*floats_per_vtx)
+    raw = struct.unpack('<%df' % (num_vertices*floats_per_vtx), data)
+    vertices = [raw[i*floats_per_vtx:(i+1)*floats_per_vtx] for i in range(num_vertices)]
+
+    with open(args.indices, 'rb') as f:
+        data = f.read()
+    fmt = 'I' if args.idx32 else 'H'
+    indices = list(struct.unpack('<%d%s' % (len(data) // struct.calcsize(fmt), fmt), data))
+    if len(indices) % 3 or any(i >= num_vertices for i in indices):
+        sys.exit('%s: invalid triangle list' % args.indices)
+
+    # Reorder triangles for the post-transform cache, then vertices by first use
+    indices = optimize_triangles(indices, num_vertices)
+    remap = {}
+    for i in indices:
+        if i not in remap:
+            remap[i] = len(remap)
+    order = sorted(remap, key=remap.get)
+    vertices = [vertices[v] for v in order]
+    indices = [remap[i] for i in indices]
+    num_vertices = len(vertices)
+
+    positions = [v[0:3] for v in vertices]
+    meshlets = build_meshlets(indices, positions)
+    center, radius = bounding_sphere(positions)
+
+    idx32 = num_vertices > 0x10000
+    vtx_data = b''.join(VERTEX.pack(v[0], v[1], v[2], 1.0, *encode_octahedral(v[3:6]),
+        *((encode_unorm16(v[6]), encode_unorm16(v[7])) if floats_per_vtx > 6 else (0, 0))) for v in vertices)
+    idx_data = struct.pack('<%d%s' % (len(indices), 'I' if idx32 else 'H'), *indices)
+    mlt_data = b''.join(MESHLET.pack(*m[0], m[1], m[2], m[3], 0, 0) for m in meshlets)
+
+    align = lambda x: (x + 0xFF) &~ 0xFF
+    vtx_off = align(HEADER.size)
+    idx_off = align(vtx_off + len(vtx_data))
+    mlt_off = align(idx_off + len(idx_data))
+
+    with open(args.output, 'wb') as f:
+        f.write(HEADER.pack(DKMESH_MAGIC, HEADER.size, 1 if idx32 else 0, num_vertices, len(indices), len(meshlets),
+            vtx_off, idx_off, mlt_off, 0, *center, radius))
+        for off, blob in ((vtx_off, vtx_data), (idx_off, idx_data), (mlt_off, mlt_data)):
+            f.write(b'\0' * (off - f.tell()))
+            f.write(blob)
+
+    in_size = num_vertices * 4 * floats_per_vtx
+    print('%s: %u vertices, %u triangles, %u meshlets, vertex data %u -> %u bytes' % (
+        args.output, num_vertices, len(indices) // 3, len(meshlets), in_size, len(vtx_data)))
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+#
+# mkdkpak.py: packs assets into the .dkpak format read by CAssetPack
+#
+# Usage:
+#   mkdkpak.py [-C romfs] [--block-size 65536] -o out.dkpak assets.lst
+#
+# The list file names the assets, one per line, relative to the -C directory; that relative path
+# is also the name they are found by. [name] lines start a load phase, the assets of a phase are
+# stored together, in the order listed:
+#
+#   [startup]
+#   shaders/basic_vsh.dksh
+#   [scene]
+#   teapot-vtx.bin
+#
+# Assets are split into blocks of --block-size bytes, each compressed with LZ4 (block format)
+# unless that doesn't make it smaller. The index that follows the header holds the name hashes
+# (FNV-1a, sorted), the phases, the entries, the blocks and the names.
+#
+import argparse
+import os
+import struct
+import sys
+
+DKPAK_MAGIC = 0x4B504B44
+DKPAK_VERSION = 1
+BLOCK_FLAG_LZ4 = 1
+
+HEADER = struct.Struct('<8I')
+LOOKUP = struct.Struct('<QI4x')
+PHASE = struct.Struct('<3I4x')
+ENTRY = struct.Struct('<4I')
+BLOCK = struct.Struct('<QII')
+
+LZ4_MIN_MATCH = 4
+LZ4_LAST_LITERALS = 5   # The last 5 bytes are always literals
+LZ4_MF_LIMIT = 12       # and the last match starts at least 12 bytes before the end
+LZ4_MAX_OFFSET = 0xFFFF
+
+def fnv1a(name):
+    h = 0xCBF29CE484222325
+    for b in name.encode('utf-8'):
+        h = ((h ^ b) * 0x100000001B3) & 0xFFFFFFFFFFFFFFFF
+    return h
+
+def lz4_length(out, n):
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+
+def lz4_sequence(out, literals, offset, match_len):
+    lit = len(literals)
+    token = min(lit, 15) << 4
+    if match_len:
+        token |= min(match_len - LZ4_MIN_MATCH, 15)
+    out.append(token)
+    if lit >= 15:
+        lz4_length(out, lit - 15)
+    out += literals
+    if match_len:
+        out += struct.pack('<H', offset)
+        if match_len - LZ4_MIN_MATCH >= 15:
+            lz4_length(out, match_len - LZ4_MIN_MATCH - 15)
+
+# Greedy compressor with a single-entry hash table, good enough for offline packing
+def lz4_compress(src):
+    n = len(src)
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    while i < n - LZ4_MF_LIMIT:
+        key = src[i:i+4]
+        cand = table.get(key)
+        table[key] = i
+        if cand is None or i - cand > LZ4_MAX_OFFSET:
+            i += 1
+            continue
+
+        length = LZ4_MIN_MATCH
+        max_length = n - LZ4_LAST_LITERALS - i
+        while length < max_length and src[cand+length] == src[i+length]:
+            length += 1
+        while i > anchor and cand > 0 and src[i-1] == src[cand-1]:
+            i -= 1
+            cand -= 1
+            length += 1
+
+        lz4_sequence(out, src[anchor:i], i - cand, length)
+        i += length
+        anchor = i
+    lz4_sequence(out, src[anchor:], 0, 0)
+    return bytes(out)
+
+# Reference decoder, to check every block before it's written
+def lz4_decompress(src, size):
+    out = bytearray()
+    i = 0
+    while True:
+        token = src[i]
+        i += 1
+        lit = token >> 4
+        if lit == 15:
+            while True:
+                b = src[i]
+                i += 1
+                lit += b
+                if b != 255:
+                    break
+        out += src[i:i+lit]
+        i += lit
+        if i == len(src):
+            break
+        offset = src[i] | (src[i+1] << 8)
+        i += 2
+        length = token & 15
+        if length == 15:
+            while True:
+                b = src[i]
+                i += 1
+                length += b
+                if b != 255:
+                    break
+        length += LZ4_MIN_MATCH
+        for _ in range(length):
+            out.append(out[-offset])
+    if len(out) != size:
+        raise ValueError('decompressed to %d bytes instead of %d' % (len(out), size))
+    return bytes(out)
+
+def read_list(path):
+    phases = []
+    for lineno, line in enumerate(open(path, encoding='utf-8'), 1):
+        line = line.split('#', 1)[0].strip()
+        if not line:
+            continue
+        if line.startswith('['):
+            if not line.endswith(']') or len(line) < 3:
+                sys.exit('%s:%d: bad phase name' % (path, lineno))
+            phases.append((line[1:-1], []))
+            continue
+        if not phases:
+            phases.append(('default', []))
+        phases[-1][1].append(line.replace('\\', '/'))
+    return phases
+
+def main():
+    parser = argparse.ArgumentParser(description='Packs assets for CAssetPack')
+    parser.add_argument('-C', dest='root', default='.', help='directory the asset names are relative to')
+    parser.add_argument('-o', dest='output', required=True)
+    parser.add_argument('--block-size', type=int, default=0x10000)
+    parser.add_argument('list')
+    args = parser.parse_args()
+
+    if args.block_size < 0x1000 or args.block_size > 0x1000000:
+        sys.exit('block size out of range')
+
+    phases = read_list(args.list)
+
+    names = bytearray()
+    def add_name(name):
+        offset = len(names)
+        names.extend(name.encode('utf-8') + b'\0')
+        return offset
+
+    entries = []    # (name, name offset, size, first block, block count)
+    blocks = []     # (data, flags, uncompressed size)
+    phase_table = []
+    seen = set()
+    for phase_name, assets in phases:
+        phase_table.append((add_name(phase_name), len(entries), len(assets)))
+        for name in assets:
+            if name in seen:
+                sys.exit('%s is listed twice' % name)
+            seen.add(name)
+            data = open(os.path.join(args.root, name), 'rb').read()
+
+            first = len(blocks)
+            for pos in range(0, len(data), args.block_size):
+                chunk = data[pos:pos+args.block_size]
+                packed = lz4_compress(chunk)
+                if len(packed) < len(chunk):
+                    lz4_decompress(packed, len(chunk))
+                    blocks.append((packed, BLOCK_FLAG_LZ4, len(chunk)))
+                else:
+                    blocks.append((chunk, 0, len(chunk)))
+            entries.append((name, add_name(name), len(data), first, len(blocks) - first))
+
+    lookup = sorted((fnv1a(e[0]), i) for i, e in enumerate(entries))
+
+    index_size = LOOKUP.size * len(entries) + PHASE.size * len(phase_table) + ENTRY.size * len(entries) + BLOCK.size * len(blocks) + len(names)
+    offset = HEADER.size + index_size
+
+    index = bytearray()
+    for h, i in lookup:
+        index += LOOKUP.pack(h, i)
+    for p in phase_table:
+        index += PHASE.pack(*p)
+    for e in entries:
+        index += ENTRY.pack(*e[1:])
+    for data, flags, size in blocks:
+        index += BLOCK.pack(offset, len(data), flags)
+        offset += len(data)
+    index += names
+
+    with open(args.output, 'wb') as f:
+        f.write(HEADER.pack(DKPAK_MAGIC, DKPAK_VERSION, len(entries), len(phase_table), len(blocks), args.block_size, index_size, len(names)))
+        f.write(index)
+        for data, flags, size in blocks:
+            f.write(data)
+
+    raw = sum(b[2] for b in blocks)
+    stored = sum(len(b[0]) for b in blocks)
+    print('%s: %d assets in %d phases, %d bytes packed to %d (%.1f%%)' % (args.output, len(entries), len(phase_table),
+        raw, stored, 100.0 * stored / raw if raw else 100.0))
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+#
+# mkdktx.py: packs textures into the .dktx container read by CExternalImage::loadContainer
+#
+# Usage:
+#   mkdktx.py -f bc1 -W 256 -H 256 -o out.dktx level0.bc1 level1.bc1 ...
+#       Packs precompressed (or raw) mip levels, largest first. Array textures
+#       are passed by giving each level file all of its layers back to back.
+#   mkdktx.py -f rgba8 -W 256 -H 256 --gen-mips -o out.dktx image.rgba
+#       Builds a full mip chain from a single raw RGBA8 image with a box filter.
+#   mkdktx.py -f bc1 -W 256 -H 256 --gen-mips -o out.dktx image.bc1
+#       Same, for a single BC1 image: the top level is kept as is, the smaller
+#       levels are decoded, filtered and re-encoded with a simple BC1 encoder.
+#
+import argparse
+import struct
+import sys
+
+DKTX_MAGIC = 0x58544B44
+
+# name: (container id, block width, block height, bytes per block)
+FORMATS = {
+    'rgba8':      (1, 1, 1, 4),
+    'rgba8_srgb': (2, 1, 1, 4),
+    'bc1':        (3, 4, 4, 8),
+    'bc2':        (4, 4, 4, 16),
+    'bc3':        (5, 4, 4, 16),
+    'bc7':        (6, 4, 4, 16),
+    'astc4x4':    (7, 4, 4, 16),
+}
+
+HEADER = struct.Struct('<8I')
+LEVEL = struct.Struct('<2I')
+
+def level_size(fmt, width, height, layers):
+    _, bw, bh, bpb = FORMATS[fmt]
+    return ((width + bw - 1) // bw) * ((height + bh - 1) // bh) * bpb * layers
+
+def downsample_rgba8(data, width, height, layers):
+    nw, nh = max(width // 2, 1), max(height // 2, 1)
+    out = bytearray(nw * nh * 4 * layers)
+    for layer in range(layers):
+        src = layer * width * height * 4
+        dst = layer * nw * nh * 4
+        for y in range(nh):
+            y0 = min(2*y, height-1); y1 = min(2*y+1, height-1)
+            for x in range(nw):
+                x0 = min(2*x, width-1); x1 = min(2*x+1, width-1)
+                for c in range(4):
+                    total = (data[src + (y0*width + x0)*4 + c] + data[src + (y0*width + x1)*4 + c] +
+                             data[src + (y1*width + x0)*4 + c] + data[src + (y1*width + x1)*4 + c])
+                    out[dst + (y*nw + x)*4 + c] = (total + 2) // 4
+    return bytes(out), nw, nh
+
+def unpack565(c):
+    r, g, b = (c >> 11) & 0x1f, (c >> 5) & 0x3f, c & 0x1f
+    return ((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2))
+
+def pack565(r, g, b):
+    return ((r * 31 + 127) // 255) << 11 | ((g * 63 + 127) // 255) << 5 | ((b * 31 + 127) // 255)
+
+def bc1_palette(c0, c1):
+    p0, p1 = unpack565(c0), unpack565(c1)
+    if c0 > c1:
+        return [p0, p1, tuple((2*a + b) // 3 for a, b in zip(p0, p1)), tuple((a + 2*b) // 3 for a, b in zip(p0, p1))]
+    return [p0, p1, tuple((a + b) // 2 for a, b in zip(p0, p1)), (0, 0, 0)]
+
+def decode_bc1(data, width, height, layers):
+    bw, bh = (width + 3) // 4, (height + 3) // 4
+    out = bytearray(width * height * 4 * layers)
+    pos = 0
+    for layer in range(layers):
+        base = layer * width * height * 4
+        for by in range(bh):
+            for bx in range(bw):
+                c0, c1, bits = struct.unpack_from('<HHI', data, pos)
+                pos += 8
+                palette = bc1_palette(c0, c1)
+                for i in range(16):
+                    x, y = bx*4 + (i & 3), by*4 + (i >> 2)
+                    if x < width and y < height:
+                        o = base + (y*width + x)*4
+                        out[o:o+3] = bytes(palette[(bits >> (2*i)) & 3])
+                        out[o+3] = 255
+    return bytes(out)
+
+def encode_bc1(data, width, height, layers):
+    bw, bh = (width + 3) // 4, (height + 3) // 4
+    out = bytearray()
+    for layer in range(layers):
+        base = layer * width * height * 4
+        for by in range(bh):
+            for bx in range(bw):
+                # Blocks hanging off the edge of small levels repeat the edge texels
+                texels = []
+                for i in range(16):
+                    x, y = min(bx*4 + (i & 3), width-1), min(by*4 + (i >> 2), height-1)
+                    o = base + (y*width + x)*4
+                    texels.append(tuple(data[o:o+3]))
+                # Endpoints are the corners of the colour bounding box, always in 4-colour mode
+                c0 = pack565(*(max(t[c] for t in texels) for c in range(3)))
+                c1 = pack565(*(min(t[c] for t in texels) for c in range(3)))
+                if c0 == c1:
+                    out += struct.pack('<HHI', c0, c1, 0)
+                    continue
+                palette = bc1_palette(c0, c1)
+                bits = 0
+                for i, t in enumerate(texels):
+                    best = min(range(4), key=lambda k: sum((a - b)**2 for a, b in zip(t, palette[k])))
+                    bits |= best << (2*i)
+                out += struct.pack('<HHI', c0, c1, bits)
+    return bytes(out)
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack textures into a .dktx container')
+    parser.add_argument('-f', '--format', required=True, choices=sorted(FORMATS))
+    parser.add_argument('-W', '--width', type=int, required=True)
+    parser.add_argument('-H', '--height', type=int, required=True)
+    parser.add_argument('-L', '--layers', type=int, default=1)
+    parser.add_argument('--gen-mips', action='store_true', help='generate the mip chain (rgba8 and bc1 formats only)')
+    parser.add_argument('-o', '--output', required=True)
+    parser.add_argument('levels', nargs='+')
+    args = parser.parse_args()
+
+    levels = [open(path, 'rb').read() for path in args.levels]
+
+    if args.gen_mips:
+        if not (args.format.startswith('rgba8') or args.format == 'bc1') or len(levels) != 1:
+            sys.exit('--gen-mips requires an rgba8 or bc1 format and a single input image')
+        width, height = args.width, args.height
+        data = levels[0]
+        if args.format == 'bc1':
+            data = decode_bc1(data, width, height, args.layers)
+        while width > 1 or height > 1:
+            data, width, height = downsample_rgba8(data, width, height, args.layers)
+            levels.append(encode_bc1(data, width, height, args.layers) if args.format == 'bc1' else data)
+
+    if len(levels) > 16:
+        sys.exit('too many mip levels')
+
+    for i, data in enumerate(levels):
+        expected = level_size(args.format, max(args.width >> i, 1), max(args.height >> i, 1), args.layers)
+        if len(data) != expected:
+            sys.exit('level %d: expected %d bytes, got %d' % (i, expected, len(data)))
+
+    # Level data is aligned so that it can be read straight into GPU-visible staging memory
+    levels_off = HEADER.size
+    data_off = levels_off + LEVEL.size * len(levels)
+    table = []
+    blob = bytearray()
+    for data in levels:
+        pad = (-(data_off + len(blob))) % 0x100
+        blob += b'\0' * pad
+        table.append((data_off + len(blob), len(data)))
+        blob += data
+
+    with open(args.output, 'wb') as f:
+        f.write(HEADER.pack(DKTX_MAGIC, HEADER.size, FORMATS[args.format][0],
+            args.width, args.height, args.layers, len(levels), levels_off))
+        for entry in table:
+            f.write(LEVEL.pack(*entry))
+        f.write(blob)
+
+if __name__ == '__main__':
+    main()
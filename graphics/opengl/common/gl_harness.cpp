@@ -0,0 +1,492 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gl_harness.h"
+
+//-----------------------------------------------------------------------------
+// nxlink support
+//-----------------------------------------------------------------------------
+
+#ifdef ENABLE_NXLINK
+#include "nxlink_log.h"
+
+extern "C" void userAppInit()
+{
+    if (nxlinkLogInit())
+        TRACE("printf output now goes to nxlink server");
+}
+
+extern "C" void userAppExit()
+{
+    nxlinkLogExit();
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+// EGL initialization
+//-----------------------------------------------------------------------------
+
+static EGLDisplay s_display;
+static EGLContext s_context;
+static EGLSurface s_surface;
+
+static bool initEgl(NWindow* win)
+{
+    // Connect to the EGL default display
+    s_display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (!s_display)
+    {
+        TRACE("Could not connect to display! error: %d", eglGetError());
+        goto _fail0;
+    }
+
+    // Initialize the EGL display connection
+    eglInitialize(s_display, nullptr, nullptr);
+
+    // Select OpenGL (Core) as the desired graphics API
+    if (eglBindAPI(EGL_OPENGL_API) == EGL_FALSE)
+    {
+        TRACE("Could not set API! error: %d", eglGetError());
+        goto _fail1;
+    }
+
+    // Get an appropriate EGL framebuffer configuration
+    EGLConfig config;
+    EGLint numConfigs;
+    static const EGLint framebufferAttributeList[] =
+    {
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE,     8,
+        EGL_GREEN_SIZE,   8,
+        EGL_BLUE_SIZE,    8,
+        EGL_ALPHA_SIZE,   8,
+        EGL_DEPTH_SIZE,   24,
+        EGL_STENCIL_SIZE, 8,
+        EGL_NONE
+    };
+    eglChooseConfig(s_display, framebufferAttributeList, &config, 1, &numConfigs);
+    if (numConfigs == 0)
+    {
+        TRACE("No config found! error: %d", eglGetError());
+        goto _fail1;
+    }
+
+    // Create an EGL window surface
+    s_surface = eglCreateWindowSurface(s_display, config, win, nullptr);
+    if (!s_surface)
+    {
+        TRACE("Surface creation failed! error: %d", eglGetError());
+        goto _fail1;
+    }
+
+    // Create an EGL rendering context
+    static const EGLint contextAttributeList[] =
+    {
+        EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+        EGL_CONTEXT_MAJOR_VERSION_KHR, 4,
+        EGL_CONTEXT_MINOR_VERSION_KHR, 3,
+        EGL_NONE
+    };
+    s_context = eglCreateContext(s_display, config, EGL_NO_CONTEXT, contextAttributeList);
+    if (!s_context)
+    {
+        TRACE("Context creation failed! error: %d", eglGetError());
+        goto _fail2;
+    }
+
+    // Connect the context to the surface
+    eglMakeCurrent(s_display, s_surface, s_surface, s_context);
+    return true;
+
+_fail2:
+    eglDestroySurface(s_display, s_surface);
+    s_surface = nullptr;
+_fail1:
+    eglTerminate(s_display);
+    s_display = nullptr;
+_fail0:
+    return false;
+}
+
+static void deinitEgl()
+{
+    if (s_display)
+    {
+        eglMakeCurrent(s_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (s_context)
+        {
+            eglDestroyContext(s_display, s_context);
+            s_context = nullptr;
+        }
+        if (s_surface)
+        {
+            eglDestroySurface(s_display, s_surface);
+            s_surface = nullptr;
+        }
+        eglTerminate(s_display);
+        s_display = nullptr;
+    }
+}
+
+static void setMesaConfig()
+{
+    // Uncomment below to disable error checking and save CPU time (useful for production):
+    //setenv("MESA_NO_ERROR", "1", 1);
+
+    // Uncomment below to enable Mesa logging:
+    //setenv("EGL_LOG_LEVEL", "debug", 1);
+    //setenv("MESA_VERBOSE", "all", 1);
+    //setenv("NOUVEAU_MESA_DEBUG", "1", 1);
+
+    // Uncomment below to enable shader debugging in Nouveau:
+    //setenv("NV50_PROG_OPTIMIZE", "0", 1);
+    //setenv("NV50_PROG_DEBUG", "1", 1);
+    //setenv("NV50_PROG_CHIPSET", "0x120", 1);
+}
+
+//-----------------------------------------------------------------------------
+// Frame statistics
+//-----------------------------------------------------------------------------
+
+enum
+{
+    StatCpu,
+    StatGpu,
+    StatInterval,
+
+    NumStats
+};
+
+static constexpr unsigned HistorySize = 256;    // frames kept for the percentiles and the graph
+static constexpr unsigned ReportInterval = 300; // frames between reports (5 seconds at 60 fps)
+static constexpr unsigned NumQueries = 4;       // GPU timestamps are read back a few frames late, without stalling
+
+static u64 s_history[NumStats][HistorySize];
+static unsigned s_historyPos, s_historyCount;
+static unsigned s_framesSinceReport;
+
+static GLuint s_queries[NumQueries][2];
+static bool s_queryPending[NumQueries];
+static unsigned s_curQuery;
+static u64 s_lastGpuNs;
+
+static bool s_overlay;
+
+static void statsInit()
+{
+    glGenQueries(2*NumQueries, &s_queries[0][0]);
+    memset(s_queryPending, 0, sizeof(s_queryPending));
+    s_curQuery = 0;
+    s_lastGpuNs = 0;
+    s_historyPos = s_historyCount = s_framesSinceReport = 0;
+}
+
+static void statsExit()
+{
+    glDeleteQueries(2*NumQueries, &s_queries[0][0]);
+}
+
+static void statsBeginGpu()
+{
+    // Collect the result of the oldest query pair before reusing it. It was issued a few
+    // frames ago, so it is normally available already.
+    if (s_queryPending[s_curQuery])
+    {
+        GLuint64 begin, end;
+        glGetQueryObjectui64v(s_queries[s_curQuery][0], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(s_queries[s_curQuery][1], GL_QUERY_RESULT, &end);
+        s_lastGpuNs = end - begin;
+        s_queryPending[s_curQuery] = false;
+    }
+
+    glQueryCounter(s_queries[s_curQuery][0], GL_TIMESTAMP);
+}
+
+static void statsEndGpu()
+{
+    glQueryCounter(s_queries[s_curQuery][1], GL_TIMESTAMP);
+    s_queryPending[s_curQuery] = true;
+    s_curQuery = (s_curQuery + 1) % NumQueries;
+}
+
+static void statsPush(u64 cpuNs, u64 gpuNs, u64 intervalNs)
+{
+    s_history[StatCpu][s_historyPos] = cpuNs;
+    s_history[StatGpu][s_historyPos] = gpuNs;
+    s_history[StatInterval][s_historyPos] = intervalNs;
+    s_historyPos = (s_historyPos + 1) % HistorySize;
+    if (s_historyCount < HistorySize)
+        s_historyCount ++;
+}
+
+static int compareU64(const void* a, const void* b)
+{
+    u64 x = *(const u64*)a, y = *(const u64*)b;
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+static void statsReport(const char* label)
+{
+    static const char* const names[NumStats] = { "cpu", "gpu", "swap" };
+    u64 sorted[HistorySize];
+    char line[256];
+    int len = 0;
+
+    for (unsigned i = 0; i < NumStats; i ++)
+    {
+        memcpy(sorted, s_history[i], s_historyCount*sizeof(u64));
+        qsort(sorted, s_historyCount, sizeof(u64), compareU64);
+
+        // Nearest-rank percentiles, in milliseconds
+        auto pct = [&](unsigned p) { return sorted[(s_historyCount-1)*p/100] / 1000000.0; };
+        len += snprintf(line+len, sizeof(line)-len, "%s%s p50 %.2f p90 %.2f p99 %.2f max %.2f",
+            i ? " | " : "", names[i], pct(50), pct(90), pct(99), pct(100));
+    }
+
+    printf("[%s] %s (ms, last %u frames)\n", label, line, s_historyCount);
+}
+
+static void statsDrawOverlay()
+{
+    static constexpr int Left = 16, Top = 16;
+    static constexpr int BarWidth = 1, GraphHeight = 128;
+    static constexpr u64 GraphRangeNs = 33333333; // two 60 fps frames
+
+    EGLint fbHeight = 0;
+    eglQuerySurface(s_display, s_surface, EGL_HEIGHT, &fbHeight);
+
+    // The graph is drawn with scissored clears, which need no shaders or buffers and leave
+    // all other state alone. GL window coordinates start at the bottom left.
+    GLboolean scissorEnabled = glIsEnabled(GL_SCISSOR_TEST);
+    GLint scissorBox[4];
+    GLfloat clearColor[4];
+    glGetIntegerv(GL_SCISSOR_BOX, scissorBox);
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+    glEnable(GL_SCISSOR_TEST);
+
+    auto rect = [](int x, int y, int w, int h, float r, float g, float b)
+    {
+        glScissor(x, y, w, h);
+        glClearColor(r, g, b, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+    };
+
+    int bottom = fbHeight - Top - GraphHeight;
+    rect(Left, bottom, 2*BarWidth*HistorySize, GraphHeight, 0.0f, 0.0f, 0.0f);
+
+    // One column per frame, oldest first: CPU time on the left, GPU time on the right
+    for (unsigned i = 0; i < s_historyCount; i ++)
+    {
+        unsigned pos = (s_historyPos + HistorySize - s_historyCount + i) % HistorySize;
+        int x = Left + 2*BarWidth*i;
+        for (unsigned j = 0; j < 2; j ++)
+        {
+            u64 ns = s_history[j == 0 ? StatCpu : StatGpu][pos];
+            int h = ns >= GraphRangeNs ? GraphHeight : int(ns * GraphHeight / GraphRangeNs);
+            if (h > 0)
+                rect(x + j*BarWidth, bottom, BarWidth, h, j == 0 ? 0.2f : 1.0f, j == 0 ? 1.0f : 0.3f, 0.2f);
+        }
+    }
+
+    // Budget line at 16.7ms
+    rect(Left, bottom + GraphHeight/2, 2*BarWidth*HistorySize, 1, 1.0f, 1.0f, 1.0f);
+
+    glScissor(scissorBox[0], scissorBox[1], scissorBox[2], scissorBox[3]);
+    glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+    if (!scissorEnabled)
+        glDisable(GL_SCISSOR_TEST);
+}
+
+//-----------------------------------------------------------------------------
+// Main loop
+//-----------------------------------------------------------------------------
+
+void harnessSetOverlay(bool enable)
+{
+    s_overlay = enable;
+}
+
+// Runs one iteration of the main loop. Returns false if the user asked to quit.
+// Non-interactive frames (benchmarks) pass no input to the scene, so that every run is the same.
+static bool runFrame(const HarnessCallbacks& cb, bool interactive, u64& lastSwapTick)
+{
+    u64 frameStartTick = armGetSystemTick();
+
+    // Get and process input
+    hidScanInput();
+    u32 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+    u32 kHeld = hidKeysHeld(CONTROLLER_P1_AUTO);
+    if (kDown & KEY_PLUS)
+        return false;
+    if (!interactive)
+        kDown = kHeld = 0;
+    else if (kDown & KEY_MINUS)
+        s_overlay = !s_overlay;
+
+    // Update the scene
+    if (cb.update)
+        cb.update(kDown, kHeld);
+
+    // Render stuff!
+    statsBeginGpu();
+    if (cb.render)
+        cb.render();
+    statsEndGpu();
+    if (interactive && s_overlay)
+        statsDrawOverlay();
+
+    u64 cpuNs = armTicksToNs(armGetSystemTick() - frameStartTick);
+    eglSwapBuffers(s_display, s_surface);
+
+    u64 swapTick = armGetSystemTick();
+    statsPush(cpuNs, s_lastGpuNs, armTicksToNs(swapTick - lastSwapTick));
+    lastSwapTick = swapTick;
+    return true;
+}
+
+int harnessRun(const HarnessCallbacks& cb)
+{
+    // Set mesa configuration (useful for debugging)
+    setMesaConfig();
+
+    // Initialize EGL on the default window
+    if (!initEgl(nwindowGetDefault()))
+        return EXIT_FAILURE;
+
+    // Load OpenGL routines using glad
+    gladLoadGL();
+
+    // Initialize the scene and the frame statistics
+    if (cb.init)
+        cb.init();
+    statsInit();
+
+    // Main graphics loop
+    u64 lastSwapTick = armGetSystemTick();
+    while (appletMainLoop() && runFrame(cb, true, lastSwapTick))
+    {
+        if (++s_framesSinceReport >= ReportInterval)
+        {
+            s_framesSinceReport = 0;
+            statsReport("frame");
+        }
+    }
+
+    // Deinitialize the frame statistics and the scene
+    statsExit();
+    if (cb.exit)
+        cb.exit();
+
+    // Deinitialize EGL
+    deinitEgl();
+    return EXIT_SUCCESS;
+}
+
+//-----------------------------------------------------------------------------
+// Mesa configuration sweep
+//-----------------------------------------------------------------------------
+
+// Driver settings tried by the benchmark. Mesa reads them when the display and context are
+// created, which is why every configuration gets a fresh EGL display and scene.
+static const struct
+{
+    const char* name;
+    const char* vars[5]; // name/value pairs, null terminated
+} s_envSets[] =
+{
+    { "default",           { nullptr } },
+    { "no_error",          { "MESA_NO_ERROR", "1", nullptr } },
+    { "glthread",          { "mesa_glthread", "true", nullptr } },
+    { "no_error+glthread", { "MESA_NO_ERROR", "1", "mesa_glthread", "true", nullptr } },
+};
+
+static const int s_swapIntervals[] = { 1, 0 };
+
+static constexpr unsigned BenchWarmupFrames = 60;
+static constexpr unsigned BenchMeasureFrames = 240; // must fit in the history for the percentiles
+
+static void applyEnvSet(unsigned set)
+{
+    // Start from a clean environment, so that settings do not leak between configurations
+    for (auto& s : s_envSets)
+        for (unsigned i = 0; s.vars[i]; i += 2)
+            unsetenv(s.vars[i]);
+
+    for (unsigned i = 0; s_envSets[set].vars[i]; i += 2)
+        setenv(s_envSets[set].vars[i], s_envSets[set].vars[i+1], 1);
+}
+
+int harnessRunBenchmark(const HarnessCallbacks& cb, const char* csvPath)
+{
+    FILE* csv = fopen(csvPath, "w");
+    if (!csv)
+    {
+        TRACE("Cannot open %s", csvPath);
+        return EXIT_FAILURE;
+    }
+    fprintf(csv, "config,mesa_env,swap_interval,frame,cpu_us,gpu_us,swap_us\n");
+
+    unsigned config = 0;
+    bool quit = false;
+    for (unsigned set = 0; set < sizeof(s_envSets)/sizeof(s_envSets[0]) && !quit; set ++)
+    {
+        for (int swapInterval : s_swapIntervals)
+        {
+            applyEnvSet(set);
+            if (!initEgl(nwindowGetDefault()))
+            {
+                TRACE("%s: EGL initialization failed", s_envSets[set].name);
+                break;
+            }
+            gladLoadGL();
+            eglSwapInterval(s_display, swapInterval);
+
+            if (cb.init)
+                cb.init();
+            statsInit();
+
+            u64 lastSwapTick = armGetSystemTick();
+            for (unsigned frame = 0; frame < BenchWarmupFrames + BenchMeasureFrames; frame ++)
+            {
+                if (!appletMainLoop() || !runFrame(cb, false, lastSwapTick))
+                {
+                    quit = true;
+                    break;
+                }
+
+                // Only the frames after the warmup count, and for the percentiles as well
+                if (frame < BenchWarmupFrames)
+                {
+                    s_historyPos = s_historyCount = 0;
+                    continue;
+                }
+
+                unsigned pos = (s_historyPos + HistorySize - 1) % HistorySize;
+                fprintf(csv, "%u,%s,%d,%u,%lu,%lu,%lu\n", config, s_envSets[set].name, swapInterval,
+                    frame - BenchWarmupFrames, s_history[StatCpu][pos] / 1000,
+                    s_history[StatGpu][pos] / 1000, s_history[StatInterval][pos] / 1000);
+            }
+
+            if (!quit)
+            {
+                char label[64];
+                snprintf(label, sizeof(label), "bench %u: %s, swap interval %d", config, s_envSets[set].name, swapInterval);
+                statsReport(label);
+            }
+
+            statsExit();
+            if (cb.exit)
+                cb.exit();
+            deinitEgl();
+            config ++;
+
+            if (quit)
+                break;
+        }
+    }
+
+    applyEnvSet(0);
+    fclose(csv);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <stdio.h>
+#include <switch.h>
+
+#include <EGL/egl.h>    // EGL library
+#include <EGL/eglext.h> // EGL extensions
+#include <glad/glad.h>  // glad library (OpenGL loader)
+
+// Shared frame harness for the OpenGL examples.
+// It takes care of redirecting stdout to nxlink, configuring Mesa, creating an OpenGL 4.3
+// core context on the default window, and running the main loop. Every frame it measures:
+// - the CPU time, from the start of the frame up to (but not including) the buffer swap
+// - the GPU time of the frame, with timestamp queries that are read back a few frames late
+// - the interval between consecutive buffer swaps, i.e. the effective frame rate
+// Percentiles of these are printed to stdout (nxlink) every few seconds, and a bar graph of
+// the recent frames can be overlaid in the top left corner of the screen by pressing MINUS.
+//
+// nxlink is enabled by adding -DENABLE_NXLINK to the CFLAGS in the Makefile.
+
+#ifndef ENABLE_NXLINK
+#define TRACE(fmt,...) ((void)0)
+#else
+#define TRACE(fmt,...) printf("%s: " fmt "\n", __PRETTY_FUNCTION__, ## __VA_ARGS__)
+#endif
+
+struct HarnessCallbacks
+{
+    // Called once the OpenGL context is ready, and before it is destroyed
+    void (*init)();
+    void (*exit)();
+
+    // Called every frame with the pressed/held buttons, then the scene is rendered.
+    // Either can be left null.
+    void (*update)(u32 kDown, u32 kHeld);
+    void (*render)();
+};
+
+// Runs the example until PLUS is pressed or the applet asks to quit.
+// Returns EXIT_SUCCESS, or EXIT_FAILURE if the OpenGL context could not be created.
+int harnessRun(const HarnessCallbacks& cb);
+
+// Runs the example repeatedly under a matrix of Mesa settings (MESA_NO_ERROR, mesa_glthread)
+// and swap intervals (1 and 0), without passing any input to it. Every configuration gets a
+// fresh EGL context and scene, is warmed up for a second, then measured for 240 frames. The
+// time of each measured frame is written to the given CSV file, and percentiles are printed
+// for each configuration. PLUS aborts the sweep.
+int harnessRunBenchmark(const HarnessCallbacks& cb, const char* csvPath);
+
+// Shows or hides the frame time overlay (hidden by default)
+void harnessSetOverlay(bool enable);
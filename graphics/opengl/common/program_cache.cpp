@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "program_cache.h"
+
+namespace
+{
+    constexpr u32 Magic = 0x48435047; // 'GPCH'
+
+    struct FileHeader
+    {
+        u32 magic;
+        u32 binaryFormat;
+        u32 binarySize;
+        u32 reserved;
+        u64 hash;
+    };
+
+    char s_dir[128];
+    bool s_enabled;
+
+    u64 fnv1a(u64 hash, const char* str)
+    {
+        for (; *str; str ++)
+        {
+            hash ^= (u8)*str;
+            hash *= UINT64_C(0x100000001b3);
+        }
+        return hash;
+    }
+
+    void getPath(char* out, size_t size, u64 hash)
+    {
+        snprintf(out, size, "%s/%016lx.bin", s_dir, hash);
+    }
+}
+
+bool programCacheInit(const char* dir)
+{
+    GLint numFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    s_enabled = numFormats > 0;
+    if (!s_enabled)
+        return false;
+
+    snprintf(s_dir, sizeof(s_dir), "%s", dir);
+
+    // Create every component of the path; existing directories are not an error
+    char path[sizeof(s_dir)];
+    for (char* p = strchr(strcpy(path, s_dir) + 1, '/'); p; p = strchr(p + 1, '/'))
+    {
+        *p = 0;
+        mkdir(path, 0777);
+        *p = '/';
+    }
+    mkdir(path, 0777);
+    return true;
+}
+
+u64 programCacheHash(const char* const* sources, unsigned numSources)
+{
+    // The driver version takes part in the hash, so that updates do not keep hitting stale binaries
+    u64 hash = UINT64_C(0xcbf29ce484222325);
+    hash = fnv1a(hash, (const char*)glGetString(GL_RENDERER));
+    hash = fnv1a(hash, (const char*)glGetString(GL_VERSION));
+    for (unsigned i = 0; i < numSources; i ++)
+        hash = fnv1a(hash, sources[i]);
+    return hash;
+}
+
+GLuint programCacheLoad(u64 hash)
+{
+    if (!s_enabled)
+        return 0;
+
+    char path[sizeof(s_dir) + 32];
+    getPath(path, sizeof(path), hash);
+    FILE* f = fopen(path, "rb");
+    if (!f)
+        return 0;
+
+    GLuint program = 0;
+    void* binary = nullptr;
+    FileHeader hdr;
+    if (fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == Magic && hdr.hash == hash && hdr.binarySize)
+    {
+        binary = malloc(hdr.binarySize);
+        if (binary && fread(binary, hdr.binarySize, 1, f) == 1)
+        {
+            program = glCreateProgram();
+            glProgramBinary(program, hdr.binaryFormat, binary, hdr.binarySize);
+
+            GLint success;
+            glGetProgramiv(program, GL_LINK_STATUS, &success);
+            if (success == GL_FALSE)
+            {
+                glDeleteProgram(program);
+                program = 0;
+            }
+        }
+    }
+    free(binary);
+    fclose(f);
+
+    // Rejected or corrupted binaries get replaced by the next store
+    if (!program)
+        remove(path);
+    return program;
+}
+
+bool programCacheStore(u64 hash, GLuint program)
+{
+    if (!s_enabled)
+        return false;
+
+    GLint success, size = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+    if (success == GL_FALSE || size <= 0)
+        return false;
+
+    void* binary = malloc(size);
+    if (!binary)
+        return false;
+
+    FileHeader hdr = { Magic, 0, 0, 0, hash };
+    GLsizei length = 0;
+    GLenum format = 0;
+    glGetProgramBinary(program, size, &length, &format, binary);
+    hdr.binaryFormat = format;
+    hdr.binarySize = length;
+
+    // Write to a temporary file first, so that an interrupted write never leaves a truncated binary behind
+    char path[sizeof(s_dir) + 32], tmpPath[sizeof(path) + 4];
+    getPath(path, sizeof(path), hash);
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+
+    bool ok = false;
+    FILE* f = length > 0 ? fopen(tmpPath, "wb") : nullptr;
+    if (f)
+    {
+        ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1 && fwrite(binary, length, 1, f) == 1;
+        ok = fclose(f) == 0 && ok;
+        if (ok)
+        {
+            remove(path);
+            ok = rename(tmpPath, path) == 0;
+        }
+        if (!ok)
+            remove(tmpPath);
+    }
+    free(binary);
+    return ok;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <switch.h>
+#include <glad/glad.h>
+
+// Persistent cache of linked GL program binaries.
+// Programs are identified by a hash of their shader sources and of the driver version.
+// A program that was linked on a previous run is restored with glProgramBinary instead
+// of going through the GLSL compiler again; if the driver rejects the binary (e.g. after
+// an update), the cached file is discarded and the caller compiles the program as usual.
+//
+// Usage:
+//     u64 hash = programCacheHash(sources, numSources);
+//     GLuint program = programCacheLoad(hash);
+//     if (!program)
+//     {
+//         // compile and link the program as usual, then:
+//         programCacheStore(hash, program);
+//     }
+
+// Sets the directory the binaries are kept in, creating it if needed. Returns false (and
+// leaves the cache disabled) if the driver does not support program binaries.
+bool programCacheInit(const char* dir);
+
+u64 programCacheHash(const char* const* sources, unsigned numSources);
+
+// Returns a linked program restored from the cache, or 0 if none is usable
+GLuint programCacheLoad(u64 hash);
+
+// Saves the binary of a successfully linked program
+bool programCacheStore(u64 hash, GLuint program);
@@ -0,0 +1,294 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <switch.h>
+
+#include "gl_harness.h"
+
+#include "program_cache.h"
+
+// Draw call throughput benchmark.
+// N small triangles are drawn with one draw call each, switching the bound program every
+// K draws. N is swept from 100 to 100000 and K over 1, 10, 100 and never, then a table with
+// the CPU time per frame spent issuing the draws, and the resulting number of draws per
+// second, is printed over nxlink. deko3d Example 12 (Draw Call Throughput) runs the exact
+// same sweep, so that the two tables can be compared directly.
+// Press A to restart the sweep.
+
+//-----------------------------------------------------------------------------
+// Main program
+//-----------------------------------------------------------------------------
+
+static const char* const vertexShaderSource = R"text(
+    #version 330 core
+
+    layout (location = 0) in vec3 aPos;
+    layout (location = 1) in vec3 aColor;
+
+    out vec3 ourColor;
+
+    void main()
+    {
+        gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);
+        ourColor = aColor;
+    }
+)text";
+
+static const char* const fragmentShaderSource = R"text(
+    #version 330 core
+
+    in vec3 ourColor;
+
+    out vec4 fragColor;
+
+    void main()
+    {
+        fragColor = vec4(ourColor, 1.0f);
+    }
+)text";
+
+static const char* const swizzleFragmentShaderSource = R"text(
+    #version 330 core
+
+    in vec3 ourColor;
+
+    out vec4 fragColor;
+
+    void main()
+    {
+        fragColor = vec4(ourColor.bgr, 1.0f);
+    }
+)text";
+
+static GLuint createAndCompileShader(GLenum type, const char* source)
+{
+    GLint success;
+    GLchar msg[512];
+
+    GLuint handle = glCreateShader(type);
+    if (!handle)
+    {
+        TRACE("%u: cannot create shader", type);
+        return 0;
+    }
+    glShaderSource(handle, 1, &source, nullptr);
+    glCompileShader(handle);
+    glGetShaderiv(handle, GL_COMPILE_STATUS, &success);
+
+    if (!success)
+    {
+        glGetShaderInfoLog(handle, sizeof(msg), nullptr, msg);
+        TRACE("%u: %s\n", type, msg);
+        glDeleteShader(handle);
+        return 0;
+    }
+
+    return handle;
+}
+
+static GLuint createAndLinkProgram(const char* vshSource, const char* fshSource)
+{
+    // Reuse the program binary from a previous run if possible, which skips compiling the shaders
+    const char* const sources[] = { vshSource, fshSource };
+    u64 hash = programCacheHash(sources, 2);
+    GLuint program = programCacheLoad(hash);
+    if (program)
+        return program;
+
+    GLint vsh = createAndCompileShader(GL_VERTEX_SHADER, vshSource);
+    GLint fsh = createAndCompileShader(GL_FRAGMENT_SHADER, fshSource);
+
+    program = glCreateProgram();
+    glAttachShader(program, vsh);
+    glAttachShader(program, fsh);
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(program);
+
+    GLint success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        char buf[512];
+        glGetProgramInfoLog(program, sizeof(buf), nullptr, buf);
+        TRACE("Link error: %s", buf);
+    }
+    glDeleteShader(vsh);
+    glDeleteShader(fsh);
+
+    programCacheStore(hash, program);
+    return program;
+}
+
+// The sweep, which must match the one in deko3d Example 12
+static const unsigned s_drawCounts[] = { 100, 1000, 10000, 100000 };
+static const unsigned s_stateChangeIntervals[] = { 1, 10, 100, 0 }; // 0: never
+
+static constexpr unsigned NumDrawCounts = sizeof(s_drawCounts) / sizeof(s_drawCounts[0]);
+static constexpr unsigned NumIntervals = sizeof(s_stateChangeIntervals) / sizeof(s_stateChangeIntervals[0]);
+static constexpr unsigned NumConfigs = NumDrawCounts * NumIntervals;
+static constexpr unsigned MaxDraws = 100000;
+static constexpr unsigned GridColumns = 400, GridRows = MaxDraws / GridColumns;
+static constexpr unsigned WarmupFrames = 30;
+static constexpr unsigned MeasureFrames = 120;
+
+struct SweepResult
+{
+    u64 cpuNs;
+    u64 frameNs;
+};
+
+static GLuint s_programs[2];
+static GLuint s_vao, s_vbo;
+
+static SweepResult s_results[NumConfigs];
+static unsigned s_curConfig, s_curFrame;
+static bool s_sweeping;
+static u64 s_lastFrameTick;
+
+static unsigned getNumDraws(unsigned config) { return s_drawCounts[config / NumIntervals]; }
+static unsigned getStateInterval(unsigned config) { return s_stateChangeIntervals[config % NumIntervals]; }
+
+static void startSweep()
+{
+    memset(s_results, 0, sizeof(s_results));
+    s_curConfig = 0;
+    s_curFrame = 0;
+    s_sweeping = true;
+    printf("Draw throughput sweep: %u configurations, %u frames each\n", NumConfigs, MeasureFrames);
+}
+
+static void printResults()
+{
+    printf("[draws] %8s %8s %12s %14s %10s\n", "N", "K", "cpu ms", "draws/s", "frame ms");
+    for (unsigned i = 0; i < NumConfigs; i ++)
+    {
+        double cpuMs = s_results[i].cpuNs / (1000000.0 * MeasureFrames);
+        double frameMs = s_results[i].frameNs / (1000000.0 * MeasureFrames);
+        char interval[16];
+        if (getStateInterval(i))
+            snprintf(interval, sizeof(interval), "%u", getStateInterval(i));
+        else
+            snprintf(interval, sizeof(interval), "never");
+        printf("[draws] %8u %8s %12.3f %14.0f %10.2f\n", getNumDraws(i), interval,
+            cpuMs, getNumDraws(i) / (cpuMs / 1000.0), frameMs);
+    }
+}
+
+static void sceneInit()
+{
+    // The state change consists in switching between two programs
+    programCacheInit("sdmc:/switch/.shadercache/draw_throughput");
+    s_programs[0] = createAndLinkProgram(vertexShaderSource, fragmentShaderSource);
+    s_programs[1] = createAndLinkProgram(vertexShaderSource, swizzleFragmentShaderSource);
+
+    struct Vertex
+    {
+        float position[3];
+        float color[3];
+    };
+
+    // A grid of small triangles, one per draw call
+    Vertex* vertices = (Vertex*)malloc(3*MaxDraws*sizeof(Vertex));
+    Vertex* v = vertices;
+    for (unsigned i = 0; i < MaxDraws; i ++)
+    {
+        float cellW = 2.0f / GridColumns, cellH = 2.0f / GridRows;
+        float x = -1.0f + (i % GridColumns) * cellW;
+        float y = +1.0f - (i / GridColumns) * cellH;
+        float t = float(i) / MaxDraws;
+        *v++ = Vertex{ { x,              y - cellH, 0.0f }, { 1.0f, t, 0.0f } };
+        *v++ = Vertex{ { x + cellW,      y - cellH, 0.0f }, { 0.0f, 1.0f, t } };
+        *v++ = Vertex{ { x + cellW/2.0f, y,         0.0f }, { t, 0.0f, 1.0f } };
+    }
+
+    glGenVertexArrays(1, &s_vao);
+    glGenBuffers(1, &s_vbo);
+    glBindVertexArray(s_vao);
+
+    glBindBuffer(GL_ARRAY_BUFFER, s_vbo);
+    glBufferData(GL_ARRAY_BUFFER, 3*MaxDraws*sizeof(Vertex), vertices, GL_STATIC_DRAW);
+    free(vertices);
+
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+    glEnableVertexAttribArray(0);
+
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+    glEnableVertexAttribArray(1);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    s_lastFrameTick = armGetSystemTick();
+    startSweep();
+}
+
+static void sceneUpdate(u32 kDown, u32 kHeld)
+{
+    if (kDown & KEY_A)
+        startSweep();
+}
+
+static void sceneRender()
+{
+    unsigned config = s_sweeping ? s_curConfig : NumConfigs-1;
+    unsigned numDraws = getNumDraws(config), stateInterval = getStateInterval(config);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glBindVertexArray(s_vao);
+
+    // Issue the draws, measuring the CPU time spent in the driver
+    u64 startTick = armGetSystemTick();
+    unsigned curProgram = 0;
+    glUseProgram(s_programs[0]);
+    for (unsigned i = 0; i < numDraws; i ++)
+    {
+        if (stateInterval && i && (i % stateInterval) == 0)
+        {
+            curProgram ^= 1;
+            glUseProgram(s_programs[curProgram]);
+        }
+        glDrawArrays(GL_TRIANGLES, 3*i, 3);
+    }
+    u64 endTick = armGetSystemTick();
+
+    // Accumulate the measurements, and move on to the next configuration when done
+    u64 frameNs = armTicksToNs(endTick - s_lastFrameTick);
+    s_lastFrameTick = endTick;
+    if (!s_sweeping)
+        return;
+
+    if (s_curFrame >= WarmupFrames)
+    {
+        s_results[s_curConfig].cpuNs += armTicksToNs(endTick - startTick);
+        s_results[s_curConfig].frameNs += frameNs;
+    }
+
+    if (++s_curFrame < WarmupFrames + MeasureFrames)
+        return;
+
+    s_curFrame = 0;
+    if (++s_curConfig < NumConfigs)
+        return;
+
+    s_sweeping = false;
+    printResults();
+}
+
+static void sceneExit()
+{
+    glDeleteBuffers(1, &s_vbo);
+    glDeleteVertexArrays(1, &s_vao);
+    glDeleteProgram(s_programs[0]);
+    glDeleteProgram(s_programs[1]);
+}
+
+int main(int argc, char* argv[])
+{
+    // The harness owns EGL and the main loop, and reports frame timings
+    HarnessCallbacks cb = {};
+    cb.init = sceneInit;
+    cb.exit = sceneExit;
+    cb.update = sceneUpdate;
+    cb.render = sceneRender;
+    return harnessRun(cb);
+}
@@ -1,3350 +1,1465 @@
+// Generated by tools/packlenny.py from tools/lenny_soup.c, do not edit
 #include "lenny.h"
 
-const lennyVertex lennyVertices[3345] = 
+const lennyVertex lennyVertices[1176] =
 {
-	{ -0.48246, 0.00967688, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.48245, -0.0384802, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.483443, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.48245, -0.0384802, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.48246, 0.00967688, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.479512, 0.0320617, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.48246, 0.00967688, -0.179352, -0.996298, 0.0859645, -1.59603e-013, },
-	{ -0.479512, 0.0320617, -0.149352, -0.983692, 0.179862, -3.33933e-013, },
-	{ -0.479512, 0.0320617, -0.179352, -0.983692, 0.179862, -3.33933e-013, },
-	{ -0.479512, 0.0320617, -0.149352, -0.983692, 0.179862, -3.33933e-013, },
-	{ -0.48246, 0.00967688, -0.179352, -0.996298, 0.0859645, -1.59603e-013, },
-	{ -0.48246, 0.00967688, -0.149352, -0.996298, 0.0859645, -1.59603e-013, },
-	{ -0.483443, -0.0141747, -0.179352, -1, 0.000179258, -3.32813e-016, },
-	{ -0.48246, 0.00967688, -0.149352, -0.996298, 0.0859645, -1.59603e-013, },
-	{ -0.48246, 0.00967688, -0.179352, -0.996298, 0.0859645, -1.59603e-013, },
-	{ -0.48246, 0.00967688, -0.149352, -0.996298, 0.0859645, -1.59603e-013, },
-	{ -0.483443, -0.0141747, -0.179352, -1, 0.000179258, -3.32813e-016, },
-	{ -0.483443, -0.0141747, -0.149352, -1, 0.000179258, -3.32813e-016, },
-	{ -0.48245, -0.0384802, -0.179352, -0.996318, -0.0857369, 1.5918e-013, },
-	{ -0.483443, -0.0141747, -0.149352, -1, 0.000179258, -3.32813e-016, },
-	{ -0.483443, -0.0141747, -0.179352, -1, 0.000179258, -3.32813e-016, },
-	{ -0.483443, -0.0141747, -0.149352, -1, 0.000179258, -3.32813e-016, },
-	{ -0.48245, -0.0384802, -0.179352, -0.996318, -0.0857369, 1.5918e-013, },
-	{ -0.48245, -0.0384802, -0.149352, -0.996318, -0.0857369, 1.5918e-013, },
-	{ -0.48245, -0.0384802, -0.179352, -0.996318, -0.0857369, 1.5918e-013, },
-	{ -0.479472, -0.0611096, -0.149352, -0.983531, -0.18074, 3.35564e-013, },
-	{ -0.48245, -0.0384802, -0.149352, -0.996318, -0.0857369, 1.5918e-013, },
-	{ -0.479472, -0.0611096, -0.149352, -0.983531, -0.18074, 3.35564e-013, },
-	{ -0.48245, -0.0384802, -0.179352, -0.996318, -0.0857369, 1.5918e-013, },
-	{ -0.479472, -0.0611096, -0.179352, -0.983531, -0.18074, 3.35564e-013, },
-	{ -0.48245, -0.0384802, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.479512, 0.0320617, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.479472, -0.0611096, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.479472, -0.0611096, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.479512, 0.0320617, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.474598, 0.0529799, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.479512, 0.0320617, -0.179352, -0.983692, 0.179862, -3.33933e-013, },
-	{ -0.474598, 0.0529799, -0.149352, -0.959566, 0.281484, -5.22607e-013, },
-	{ -0.474598, 0.0529799, -0.179352, -0.959566, 0.281484, -5.22607e-013, },
-	{ -0.474598, 0.0529799, -0.149352, -0.959566, 0.281484, -5.22607e-013, },
-	{ -0.479512, 0.0320617, -0.179352, -0.983692, 0.179862, -3.33933e-013, },
-	{ -0.479512, 0.0320617, -0.149352, -0.983692, 0.179862, -3.33933e-013, },
-	{ -0.479512, 0.0320617, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.479472, -0.0611096, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.474598, 0.0529799, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.479512, 0.0320617, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.48245, -0.0384802, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.479472, -0.0611096, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.48246, 0.00967688, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.48245, -0.0384802, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.479512, 0.0320617, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.48245, -0.0384802, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.48246, 0.00967688, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.483443, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.474598, 0.0529799, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.479472, -0.0611096, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.474508, -0.0820626, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.479472, -0.0611096, -0.179352, -0.983531, -0.18074, 3.35564e-013, },
-	{ -0.474508, -0.0820626, -0.149352, -0.958441, -0.285291, 5.29675e-013, },
-	{ -0.479472, -0.0611096, -0.149352, -0.983531, -0.18074, 3.35564e-013, },
-	{ -0.474508, -0.0820626, -0.149352, -0.958441, -0.285291, 5.29675e-013, },
-	{ -0.479472, -0.0611096, -0.179352, -0.983531, -0.18074, 3.35564e-013, },
-	{ -0.474508, -0.0820626, -0.179352, -0.958441, -0.285291, 5.29675e-013, },
-	{ -0.479472, -0.0611096, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.474598, 0.0529799, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.474508, -0.0820626, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.474508, -0.0820626, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.474598, 0.0529799, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.467718, 0.0724313, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.474598, 0.0529799, -0.179352, -0.959566, 0.281484, -5.22607e-013, },
-	{ -0.467718, 0.0724313, -0.149352, -0.917564, 0.397588, -7.38167e-013, },
-	{ -0.467718, 0.0724313, -0.179352, -0.917564, 0.397588, -7.38167e-013, },
-	{ -0.467718, 0.0724313, -0.149352, -0.917564, 0.397588, -7.38167e-013, },
-	{ -0.474598, 0.0529799, -0.179352, -0.959566, 0.281484, -5.22607e-013, },
-	{ -0.474598, 0.0529799, -0.149352, -0.959566, 0.281484, -5.22607e-013, },
-	{ -0.474598, 0.0529799, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.474508, -0.0820626, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.467718, 0.0724313, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.467718, 0.0724313, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.474508, -0.0820626, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.467559, -0.101339, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.474508, -0.0820626, -0.179352, -0.958441, -0.285291, 5.29675e-013, },
-	{ -0.467559, -0.101339, -0.149352, -0.915227, -0.402939, 7.48101e-013, },
-	{ -0.474508, -0.0820626, -0.149352, -0.958441, -0.285291, 5.29675e-013, },
-	{ -0.467559, -0.101339, -0.149352, -0.915227, -0.402939, 7.48101e-013, },
-	{ -0.474508, -0.0820626, -0.179352, -0.958441, -0.285291, 5.29675e-013, },
-	{ -0.467559, -0.101339, -0.179352, -0.915227, -0.402939, 7.48101e-013, },
-	{ -0.474508, -0.0820626, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.467718, 0.0724313, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.467559, -0.101339, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.467559, -0.101339, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.467718, 0.0724313, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.448901, 0.10877, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.467718, 0.0724313, -0.179352, -0.917564, 0.397588, -7.38167e-013, },
-	{ -0.448901, 0.10877, -0.149352, -0.849923, 0.526906, -9.78261e-013, },
-	{ -0.448901, 0.10877, -0.179352, -0.849923, 0.526906, -9.78261e-013, },
-	{ -0.448901, 0.10877, -0.149352, -0.849923, 0.526906, -9.78261e-013, },
-	{ -0.467718, 0.0724313, -0.179352, -0.917564, 0.397588, -7.38167e-013, },
-	{ -0.467718, 0.0724313, -0.149352, -0.917564, 0.397588, -7.38167e-013, },
-	{ -0.467718, 0.0724313, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.467559, -0.101339, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.448901, 0.10877, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.448901, 0.10877, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.467559, -0.101339, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.455346, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.448701, -0.137259, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.455346, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.467559, -0.101339, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.455346, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.448701, -0.137259, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.453889, -0.0403161, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.453889, -0.0403161, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.448701, -0.137259, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.449519, -0.0641428, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.449519, -0.0641428, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.448701, -0.137259, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.442675, -0.0862532, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.442675, -0.0862532, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.448701, -0.137259, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423897, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.448701, -0.137259, -0.149352, -0.848931, -0.528503, 9.81225e-013, },
-	{ -0.423897, -0.171263, -0.179352, -0.807895, -0.589327, 1.09415e-012, },
-	{ -0.423897, -0.171263, -0.149352, -0.807895, -0.589327, 1.09415e-012, },
-	{ -0.423897, -0.171263, -0.179352, -0.807895, -0.589327, 1.09415e-012, },
-	{ -0.448701, -0.137259, -0.149352, -0.848931, -0.528503, 9.81225e-013, },
-	{ -0.448701, -0.137259, -0.179352, -0.848931, -0.528503, 9.81225e-013, },
-	{ -0.467559, -0.101339, -0.149352, -0.915227, -0.402939, 7.48101e-013, },
-	{ -0.448701, -0.137259, -0.179352, -0.848931, -0.528503, 9.81225e-013, },
-	{ -0.448701, -0.137259, -0.149352, -0.848931, -0.528503, 9.81225e-013, },
-	{ -0.448701, -0.137259, -0.179352, -0.848931, -0.528503, 9.81225e-013, },
-	{ -0.467559, -0.101339, -0.149352, -0.915227, -0.402939, 7.48101e-013, },
-	{ -0.467559, -0.101339, -0.179352, -0.915227, -0.402939, 7.48101e-013, },
-	{ -0.455346, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.448701, -0.137259, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.467559, -0.101339, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.448701, -0.137259, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.455346, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.453889, -0.0403161, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.455346, -0.0141747, -0.179352, 0.999999, -0.00142961, 2.65423e-015, },
-	{ -0.453889, -0.0403161, -0.149352, 0.992983, 0.118257, -2.19557e-013, },
-	{ -0.453889, -0.0403161, -0.179352, 0.992983, 0.118257, -2.19557e-013, },
-	{ -0.453889, -0.0403161, -0.149352, 0.992983, 0.118257, -2.19557e-013, },
-	{ -0.455346, -0.0141747, -0.179352, 0.999999, -0.00142961, 2.65423e-015, },
-	{ -0.455346, -0.0141747, -0.149352, 0.999999, -0.00142961, 2.65423e-015, },
-	{ -0.45385, 0.0113681, -0.179352, 0.992719, -0.120452, 2.23633e-013, },
-	{ -0.455346, -0.0141747, -0.149352, 0.999999, -0.00142961, 2.65423e-015, },
-	{ -0.455346, -0.0141747, -0.179352, 0.999999, -0.00142961, 2.65423e-015, },
-	{ -0.455346, -0.0141747, -0.149352, 0.999999, -0.00142961, 2.65423e-015, },
-	{ -0.45385, 0.0113681, -0.179352, 0.992719, -0.120452, 2.23633e-013, },
-	{ -0.45385, 0.0113681, -0.149352, 0.992719, -0.120452, 2.23633e-013, },
-	{ -0.44936, 0.0356337, -0.179352, 0.97154, -0.236876, 4.39788e-013, },
-	{ -0.45385, 0.0113681, -0.149352, 0.992719, -0.120452, 2.23633e-013, },
-	{ -0.45385, 0.0113681, -0.179352, 0.992719, -0.120452, 2.23633e-013, },
-	{ -0.45385, 0.0113681, -0.149352, 0.992719, -0.120452, 2.23633e-013, },
-	{ -0.44936, 0.0356337, -0.179352, 0.97154, -0.236876, 4.39788e-013, },
-	{ -0.44936, 0.0356337, -0.149352, 0.97154, -0.236876, 4.39788e-013, },
-	{ -0.442475, 0.058263, -0.179352, 0.940473, -0.339869, 6.31005e-013, },
-	{ -0.44936, 0.0356337, -0.149352, 0.97154, -0.236876, 4.39788e-013, },
-	{ -0.44936, 0.0356337, -0.179352, 0.97154, -0.236876, 4.39788e-013, },
-	{ -0.44936, 0.0356337, -0.149352, 0.97154, -0.236876, 4.39788e-013, },
-	{ -0.442475, 0.058263, -0.179352, 0.940473, -0.339869, 6.31005e-013, },
-	{ -0.442475, 0.058263, -0.149352, 0.940473, -0.339869, 6.31005e-013, },
-	{ -0.433794, 0.0788968, -0.179352, 0.900067, -0.435752, 8.09023e-013, },
-	{ -0.442475, 0.058263, -0.149352, 0.940473, -0.339869, 6.31005e-013, },
-	{ -0.442475, 0.058263, -0.179352, 0.940473, -0.339869, 6.31005e-013, },
-	{ -0.442475, 0.058263, -0.149352, 0.940473, -0.339869, 6.31005e-013, },
-	{ -0.433794, 0.0788968, -0.179352, 0.900067, -0.435752, 8.09023e-013, },
-	{ -0.433794, 0.0788968, -0.149352, 0.900067, -0.435752, 8.09023e-013, },
-	{ -0.423318, 0.0979142, -0.179352, 0.851338, -0.524617, 9.74011e-013, },
-	{ -0.433794, 0.0788968, -0.149352, 0.900067, -0.435752, 8.09023e-013, },
-	{ -0.433794, 0.0788968, -0.179352, 0.900067, -0.435752, 8.09023e-013, },
-	{ -0.433794, 0.0788968, -0.149352, 0.900067, -0.435752, 8.09023e-013, },
-	{ -0.423318, 0.0979142, -0.179352, 0.851338, -0.524617, 9.74011e-013, },
-	{ -0.423318, 0.0979142, -0.149352, 0.851338, -0.524617, 9.74011e-013, },
-	{ -0.412003, 0.114417, -0.179352, 0.782863, -0.622194, 1.15517e-012, },
-	{ -0.423318, 0.0979142, -0.149352, 0.851338, -0.524617, 9.74011e-013, },
-	{ -0.423318, 0.0979142, -0.179352, 0.851338, -0.524617, 9.74011e-013, },
-	{ -0.423318, 0.0979142, -0.149352, 0.851338, -0.524617, 9.74011e-013, },
-	{ -0.412003, 0.114417, -0.179352, 0.782863, -0.622194, 1.15517e-012, },
-	{ -0.412003, 0.114417, -0.149352, 0.782863, -0.622194, 1.15517e-012, },
-	{ -0.387339, 0.141317, -0.179352, 0.737063, -0.675824, 1.25474e-012, },
-	{ -0.412003, 0.114417, -0.149352, 0.782863, -0.622194, 1.15517e-012, },
-	{ -0.412003, 0.114417, -0.179352, 0.782863, -0.622194, 1.15517e-012, },
-	{ -0.412003, 0.114417, -0.149352, 0.782863, -0.622194, 1.15517e-012, },
-	{ -0.387339, 0.141317, -0.179352, 0.737063, -0.675824, 1.25474e-012, },
-	{ -0.387339, 0.141317, -0.149352, 0.737063, -0.675824, 1.25474e-012, },
-	{ -0.387339, 0.141317, -0.179352, 1, 0, -0, },
-	{ -0.387339, 0.142913, -0.149352, 1, 0, -0, },
-	{ -0.387339, 0.141317, -0.149352, 1, 0, -0, },
-	{ -0.387339, 0.142913, -0.149352, 1, 0, -0, },
-	{ -0.387339, 0.141317, -0.179352, 1, 0, -0, },
-	{ -0.387339, 0.142913, -0.179352, 1, 0, -0, },
-	{ -0.412003, 0.114417, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.387339, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.387339, 0.141317, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.412003, 0.114417, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423897, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.387339, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423318, 0.0979142, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423897, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.412003, 0.114417, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.433794, 0.0788968, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423897, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423318, 0.0979142, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.442475, 0.058263, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423897, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.433794, 0.0788968, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.442475, 0.058263, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.448901, 0.10877, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423897, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.44936, 0.0356337, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.448901, 0.10877, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.442475, 0.058263, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.45385, 0.0113681, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.448901, 0.10877, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.44936, 0.0356337, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.455346, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.448901, 0.10877, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.45385, 0.0113681, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.467559, -0.101339, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.448901, 0.10877, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.455346, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.448901, 0.10877, -0.179352, -0.849923, 0.526906, -9.78261e-013, },
-	{ -0.423897, 0.142913, -0.149352, -0.806795, 0.590832, -1.09695e-012, },
-	{ -0.423897, 0.142913, -0.179352, -0.806795, 0.590832, -1.09695e-012, },
-	{ -0.423897, 0.142913, -0.149352, -0.806795, 0.590832, -1.09695e-012, },
-	{ -0.448901, 0.10877, -0.179352, -0.849923, 0.526906, -9.78261e-013, },
-	{ -0.448901, 0.10877, -0.149352, -0.849923, 0.526906, -9.78261e-013, },
-	{ -0.448901, 0.10877, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.442475, 0.058263, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423897, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.448901, 0.10877, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.44936, 0.0356337, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.442475, 0.058263, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.448901, 0.10877, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.45385, 0.0113681, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.44936, 0.0356337, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.448901, 0.10877, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.455346, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.45385, 0.0113681, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423897, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.442475, 0.058263, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.433794, 0.0788968, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423897, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.433794, 0.0788968, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423318, 0.0979142, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423897, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423318, 0.0979142, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.412003, 0.114417, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423897, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.412003, 0.114417, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.387339, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.387339, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.412003, 0.114417, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.387339, 0.141317, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.387339, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
-	{ -0.423897, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
-	{ -0.387339, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
-	{ -0.423897, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
-	{ -0.387339, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
-	{ -0.423897, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
-	{ -0.449519, -0.0641428, -0.149352, 0.971146, 0.238485, -4.42774e-013, },
-	{ -0.453889, -0.0403161, -0.179352, 0.992983, 0.118257, -2.19557e-013, },
-	{ -0.453889, -0.0403161, -0.149352, 0.992983, 0.118257, -2.19557e-013, },
-	{ -0.453889, -0.0403161, -0.179352, 0.992983, 0.118257, -2.19557e-013, },
-	{ -0.449519, -0.0641428, -0.149352, 0.971146, 0.238485, -4.42774e-013, },
-	{ -0.449519, -0.0641428, -0.179352, 0.971146, 0.238485, -4.42774e-013, },
-	{ -0.442675, -0.0862532, -0.149352, 0.939306, 0.343081, -6.36967e-013, },
-	{ -0.449519, -0.0641428, -0.179352, 0.971146, 0.238485, -4.42774e-013, },
-	{ -0.449519, -0.0641428, -0.149352, 0.971146, 0.238485, -4.42774e-013, },
-	{ -0.449519, -0.0641428, -0.179352, 0.971146, 0.238485, -4.42774e-013, },
-	{ -0.442675, -0.0862532, -0.149352, 0.939306, 0.343081, -6.36967e-013, },
-	{ -0.442675, -0.0862532, -0.179352, 0.939306, 0.343081, -6.36967e-013, },
-	{ -0.433794, -0.107246, -0.149352, 0.90003, 0.435828, -8.09163e-013, },
-	{ -0.442675, -0.0862532, -0.179352, 0.939306, 0.343081, -6.36967e-013, },
-	{ -0.442675, -0.0862532, -0.149352, 0.939306, 0.343081, -6.36967e-013, },
-	{ -0.442675, -0.0862532, -0.179352, 0.939306, 0.343081, -6.36967e-013, },
-	{ -0.433794, -0.107246, -0.149352, 0.90003, 0.435828, -8.09163e-013, },
-	{ -0.433794, -0.107246, -0.179352, 0.90003, 0.435828, -8.09163e-013, },
-	{ -0.433794, -0.107246, -0.149352, 0.90003, 0.435828, -8.09163e-013, },
-	{ -0.423537, -0.125944, -0.179352, 0.850957, 0.525236, -9.75159e-013, },
-	{ -0.433794, -0.107246, -0.179352, 0.90003, 0.435828, -8.09163e-013, },
-	{ -0.423537, -0.125944, -0.179352, 0.850957, 0.525236, -9.75159e-013, },
-	{ -0.433794, -0.107246, -0.149352, 0.90003, 0.435828, -8.09163e-013, },
-	{ -0.423537, -0.125944, -0.149352, 0.850957, 0.525236, -9.75159e-013, },
-	{ -0.433794, -0.107246, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423897, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423537, -0.125944, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.442675, -0.0862532, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423897, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.433794, -0.107246, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423537, -0.125944, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423897, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.411923, -0.142767, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.411923, -0.142767, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423897, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.387339, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.423897, -0.171263, -0.179352, 0, -1, 1.85661e-012, },
-	{ -0.387339, -0.171263, -0.149352, 0, -1, 1.85661e-012, },
-	{ -0.423897, -0.171263, -0.149352, 0, -1, 1.85661e-012, },
-	{ -0.387339, -0.171263, -0.149352, 0, -1, 1.85661e-012, },
-	{ -0.423897, -0.171263, -0.179352, 0, -1, 1.85661e-012, },
-	{ -0.387339, -0.171263, -0.179352, 0, -1, 1.85661e-012, },
-	{ -0.423897, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.411923, -0.142767, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.387339, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423897, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423537, -0.125944, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.411923, -0.142767, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423897, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.433794, -0.107246, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423537, -0.125944, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423897, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.442675, -0.0862532, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.433794, -0.107246, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.448701, -0.137259, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.442675, -0.0862532, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423897, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.448701, -0.137259, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.449519, -0.0641428, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.442675, -0.0862532, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.448701, -0.137259, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.453889, -0.0403161, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.449519, -0.0641428, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.423537, -0.125944, -0.179352, 0.850957, 0.525236, -9.75159e-013, },
-	{ -0.411923, -0.142767, -0.149352, 0.782355, 0.622832, -1.15636e-012, },
-	{ -0.411923, -0.142767, -0.179352, 0.782355, 0.622832, -1.15636e-012, },
-	{ -0.411923, -0.142767, -0.149352, 0.782355, 0.622832, -1.15636e-012, },
-	{ -0.423537, -0.125944, -0.179352, 0.850957, 0.525236, -9.75159e-013, },
-	{ -0.423537, -0.125944, -0.149352, 0.850957, 0.525236, -9.75159e-013, },
-	{ -0.387339, -0.169666, -0.149352, 0.738153, 0.674633, -1.25253e-012, },
-	{ -0.411923, -0.142767, -0.179352, 0.782355, 0.622832, -1.15636e-012, },
-	{ -0.411923, -0.142767, -0.149352, 0.782355, 0.622832, -1.15636e-012, },
-	{ -0.411923, -0.142767, -0.179352, 0.782355, 0.622832, -1.15636e-012, },
-	{ -0.387339, -0.169666, -0.149352, 0.738153, 0.674633, -1.25253e-012, },
-	{ -0.387339, -0.169666, -0.179352, 0.738153, 0.674633, -1.25253e-012, },
-	{ -0.387339, -0.171263, -0.149352, 1, 0, -0, },
-	{ -0.387339, -0.169666, -0.179352, 1, 0, -0, },
-	{ -0.387339, -0.169666, -0.149352, 1, 0, -0, },
-	{ -0.387339, -0.169666, -0.179352, 1, 0, -0, },
-	{ -0.387339, -0.171263, -0.149352, 1, 0, -0, },
-	{ -0.387339, -0.171263, -0.179352, 1, 0, -0, },
-	{ -0.387339, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.411923, -0.142767, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.387339, -0.169666, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.411923, -0.142767, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.387339, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.387339, -0.169666, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.29061, 0.109117, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.27511, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.300972, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.27511, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.29061, 0.109117, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.278682, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.29061, 0.109117, -0.179352, -0.766013, 0.642825, -1.19348e-012, },
-	{ -0.278682, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
-	{ -0.278682, 0.121471, -0.179352, -0.66764, 0.744484, -1.38222e-012, },
-	{ -0.278682, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
-	{ -0.29061, 0.109117, -0.179352, -0.766013, 0.642825, -1.19348e-012, },
-	{ -0.29061, 0.109117, -0.149352, -0.766013, 0.642825, -1.19348e-012, },
-	{ -0.300972, 0.0948611, -0.179352, -0.808895, 0.587953, -1.0916e-012, },
-	{ -0.29061, 0.109117, -0.149352, -0.766013, 0.642825, -1.19348e-012, },
-	{ -0.29061, 0.109117, -0.179352, -0.766013, 0.642825, -1.19348e-012, },
-	{ -0.29061, 0.109117, -0.149352, -0.766013, 0.642825, -1.19348e-012, },
-	{ -0.300972, 0.0948611, -0.179352, -0.808895, 0.587953, -1.0916e-012, },
-	{ -0.300972, 0.0948611, -0.149352, -0.808895, 0.587953, -1.0916e-012, },
-	{ -0.300972, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
-	{ -0.27511, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ -0.300972, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ -0.27511, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ -0.300972, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
-	{ -0.27511, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
-	{ -0.257859, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
-	{ -0.27511, 0.0948611, -0.149352, 0.716917, -0.697159, 1.29435e-012, },
-	{ -0.27511, 0.0948611, -0.179352, 0.716917, -0.697159, 1.29435e-012, },
-	{ -0.27511, 0.0948611, -0.149352, 0.716917, -0.697159, 1.29435e-012, },
-	{ -0.257859, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
-	{ -0.257859, 0.112601, -0.149352, 0.609765, -0.792582, 1.47152e-012, },
-	{ -0.257859, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
-	{ -0.235319, 0.125273, -0.149352, 0.379664, -0.925125, 1.71771e-012, },
-	{ -0.257859, 0.112601, -0.149352, 0.609765, -0.792582, 1.47152e-012, },
-	{ -0.235319, 0.125273, -0.149352, 0.379664, -0.925125, 1.71771e-012, },
-	{ -0.257859, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
-	{ -0.235319, 0.125273, -0.179352, 0.379664, -0.925125, 1.71771e-012, },
-	{ -0.257859, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.250126, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.235319, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.257859, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.265187, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.250126, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.27511, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.265187, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.257859, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.27511, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.278682, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.265187, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.278682, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
-	{ -0.265187, 0.131926, -0.179352, -0.554528, 0.832165, -1.54501e-012, },
-	{ -0.278682, 0.121471, -0.179352, -0.66764, 0.744484, -1.38222e-012, },
-	{ -0.265187, 0.131926, -0.179352, -0.554528, 0.832165, -1.54501e-012, },
-	{ -0.278682, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
-	{ -0.265187, 0.131926, -0.149352, -0.554528, 0.832165, -1.54501e-012, },
-	{ -0.278682, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.27511, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.265187, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.29061, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.27511, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.278682, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.27511, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.29061, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.300972, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.265187, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.27511, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.257859, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.265187, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.257859, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.250126, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.250126, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.257859, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.235319, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.250126, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.235319, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.233498, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.233498, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.235319, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.22987, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.235319, 0.125273, -0.149352, 0.379664, -0.925125, 1.71771e-012, },
-	{ -0.207491, 0.132876, -0.149352, 0.170704, -0.985322, 1.82937e-012, },
-	{ -0.22987, 0.126762, -0.149352, 0.263556, -0.964644, 1.79119e-012, },
-	{ -0.235319, 0.125273, -0.179352, 0.379664, -0.925125, 1.71771e-012, },
-	{ -0.207491, 0.132876, -0.149352, 0.170704, -0.985322, 1.82937e-012, },
-	{ -0.235319, 0.125273, -0.149352, 0.379664, -0.925125, 1.71771e-012, },
-	{ -0.207491, 0.132876, -0.149352, 0.170704, -0.985322, 1.82937e-012, },
-	{ -0.235319, 0.125273, -0.179352, 0.379664, -0.925125, 1.71771e-012, },
-	{ -0.207491, 0.132876, -0.179352, 0.170704, -0.985322, 1.82937e-012, },
-	{ -0.235319, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.233498, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.207491, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.235319, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.250126, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.233498, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.250126, 0.140479, -0.149352, -0.433645, 0.901084, -1.67296e-012, },
-	{ -0.233498, 0.147131, -0.179352, -0.312692, 0.949855, -1.76351e-012, },
-	{ -0.250126, 0.140479, -0.179352, -0.433645, 0.901084, -1.67296e-012, },
-	{ -0.233498, 0.147131, -0.179352, -0.312692, 0.949855, -1.76351e-012, },
-	{ -0.250126, 0.140479, -0.149352, -0.433645, 0.901084, -1.67296e-012, },
-	{ -0.233498, 0.147131, -0.149352, -0.312692, 0.949855, -1.76351e-012, },
-	{ -0.233498, 0.147131, -0.149352, -0.312692, 0.949855, -1.76351e-012, },
-	{ -0.215304, 0.151883, -0.179352, -0.198062, 0.98019, -1.81983e-012, },
-	{ -0.233498, 0.147131, -0.179352, -0.312692, 0.949855, -1.76351e-012, },
-	{ -0.215304, 0.151883, -0.179352, -0.198062, 0.98019, -1.81983e-012, },
-	{ -0.233498, 0.147131, -0.149352, -0.312692, 0.949855, -1.76351e-012, },
-	{ -0.215304, 0.151883, -0.149352, -0.198062, 0.98019, -1.81983e-012, },
-	{ -0.233498, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.22987, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.215304, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.215304, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.22987, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.220073, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.220073, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.22987, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.220073, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.208749, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.208749, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.207491, 0.132876, -0.149352, 0.170704, -0.985322, 1.82937e-012, },
-	{ -0.174376, 0.13541, -0.149352, 8.00648e-005, -1, 1.85651e-012, },
-	{ -0.182425, 0.134794, -0.149352, 0.076306, -0.997084, 1.851e-012, },
-	{ -0.207491, 0.132876, -0.179352, 0.170704, -0.985322, 1.82937e-012, },
-	{ -0.174376, 0.13541, -0.149352, 8.00648e-005, -1, 1.85651e-012, },
-	{ -0.207491, 0.132876, -0.149352, 0.170704, -0.985322, 1.82937e-012, },
-	{ -0.174376, 0.13541, -0.149352, 8.00648e-005, -1, 1.85651e-012, },
-	{ -0.207491, 0.132876, -0.179352, 0.170704, -0.985322, 1.82937e-012, },
-	{ -0.174376, 0.13541, -0.179352, 8.00648e-005, -1, 1.85651e-012, },
-	{ -0.207491, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.195543, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.174376, 0.13541, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.207491, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.215304, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.195543, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.207491, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.233498, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.215304, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.215304, 0.151883, -0.149352, -0.198062, 0.98019, -1.81983e-012, },
-	{ -0.195543, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
-	{ -0.215304, 0.151883, -0.179352, -0.198062, 0.98019, -1.81983e-012, },
-	{ -0.195543, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
-	{ -0.215304, 0.151883, -0.149352, -0.198062, 0.98019, -1.81983e-012, },
-	{ -0.195543, 0.154734, -0.149352, -0.0937744, 0.995593, -1.84843e-012, },
-	{ -0.215304, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.208749, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.195543, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.215304, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.220073, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.208749, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.208749, 0.135271, -0.179352, -0.184752, 0.982785, -1.82465e-012, },
-	{ -0.220073, 0.131978, -0.149352, -0.376579, 0.926384, -1.72004e-012, },
-	{ -0.208749, 0.135271, -0.149352, -0.184752, 0.982785, -1.82465e-012, },
-	{ -0.220073, 0.131978, -0.149352, -0.376579, 0.926384, -1.72004e-012, },
-	{ -0.208749, 0.135271, -0.179352, -0.184752, 0.982785, -1.82465e-012, },
-	{ -0.220073, 0.131978, -0.179352, -0.376579, 0.926384, -1.72004e-012, },
-	{ -0.210455, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.220073, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.208749, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.221949, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.220073, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.210455, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.229612, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.220073, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.221949, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.229612, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.23038, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.220073, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.232166, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.23038, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.229612, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.23951, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.23038, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.232166, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.23951, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.239669, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.23038, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.247262, 0.0416702, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.239669, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.23951, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.247262, 0.0416702, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.247352, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.239669, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.2528, 0.0519572, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.247352, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.247262, 0.0416702, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.2528, 0.0519572, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.25284, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.247352, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.256122, 0.0633018, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.25284, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.2528, 0.0519572, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.256122, 0.0633018, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.256132, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.25284, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.256132, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.256122, 0.0633018, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.25723, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.256122, 0.0633018, -0.179352, -0.982569, -0.185898, 3.45141e-013, },
-	{ -0.25723, 0.075704, -0.149352, -1, 6.48887e-005, -1.20473e-016, },
-	{ -0.25723, 0.075704, -0.179352, -1, 6.48887e-005, -1.20473e-016, },
-	{ -0.25723, 0.075704, -0.149352, -1, 6.48887e-005, -1.20473e-016, },
-	{ -0.256122, 0.0633018, -0.179352, -0.982569, -0.185898, 3.45141e-013, },
-	{ -0.256122, 0.0633018, -0.149352, -0.982569, -0.185898, 3.45141e-013, },
-	{ -0.2528, 0.0519572, -0.179352, -0.92515, -0.379603, 7.04775e-013, },
-	{ -0.256122, 0.0633018, -0.149352, -0.982569, -0.185898, 3.45141e-013, },
-	{ -0.256122, 0.0633018, -0.179352, -0.982569, -0.185898, 3.45141e-013, },
-	{ -0.256122, 0.0633018, -0.149352, -0.982569, -0.185898, 3.45141e-013, },
-	{ -0.2528, 0.0519572, -0.179352, -0.92515, -0.379603, 7.04775e-013, },
-	{ -0.2528, 0.0519572, -0.149352, -0.92515, -0.379603, 7.04775e-013, },
-	{ -0.247262, 0.0416702, -0.179352, -0.827451, -0.561538, 1.04256e-012, },
-	{ -0.2528, 0.0519572, -0.149352, -0.92515, -0.379603, 7.04775e-013, },
-	{ -0.2528, 0.0519572, -0.179352, -0.92515, -0.379603, 7.04775e-013, },
-	{ -0.2528, 0.0519572, -0.149352, -0.92515, -0.379603, 7.04775e-013, },
-	{ -0.247262, 0.0416702, -0.179352, -0.827451, -0.561538, 1.04256e-012, },
-	{ -0.247262, 0.0416702, -0.149352, -0.827451, -0.561538, 1.04256e-012, },
-	{ -0.23951, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
-	{ -0.247262, 0.0416702, -0.149352, -0.827451, -0.561538, 1.04256e-012, },
-	{ -0.247262, 0.0416702, -0.179352, -0.827451, -0.561538, 1.04256e-012, },
-	{ -0.247262, 0.0416702, -0.149352, -0.827451, -0.561538, 1.04256e-012, },
-	{ -0.23951, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
-	{ -0.23951, 0.0324409, -0.149352, -0.701877, -0.712298, 1.32246e-012, },
-	{ -0.23951, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
-	{ -0.230171, 0.0248279, -0.149352, -0.552115, -0.833768, 1.54798e-012, },
-	{ -0.23951, 0.0324409, -0.149352, -0.701877, -0.712298, 1.32246e-012, },
-	{ -0.230171, 0.0248279, -0.149352, -0.552115, -0.833768, 1.54798e-012, },
-	{ -0.23951, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
-	{ -0.230171, 0.0248279, -0.179352, -0.552115, -0.833768, 1.54798e-012, },
-	{ -0.232166, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.230171, 0.0248279, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.23951, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.230171, 0.0248279, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.232166, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.229552, 0.0613761, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.232166, 0.075704, -0.179352, 1, 0.000803637, -1.49204e-015, },
-	{ -0.229552, 0.0613761, -0.149352, 0.926569, 0.376125, -6.98317e-013, },
-	{ -0.229552, 0.0613761, -0.179352, 0.926569, 0.376125, -6.98317e-013, },
-	{ -0.229552, 0.0613761, -0.149352, 0.926569, 0.376125, -6.98317e-013, },
-	{ -0.232166, 0.075704, -0.179352, 1, 0.000803637, -1.49204e-015, },
-	{ -0.232166, 0.075704, -0.149352, 1, 0.000803637, -1.49204e-015, },
-	{ -0.229612, 0.0898323, -0.179352, 0.929149, -0.369705, 6.86399e-013, },
-	{ -0.232166, 0.075704, -0.149352, 1, 0.000803637, -1.49204e-015, },
-	{ -0.232166, 0.075704, -0.179352, 1, 0.000803637, -1.49204e-015, },
-	{ -0.232166, 0.075704, -0.149352, 1, 0.000803637, -1.49204e-015, },
-	{ -0.229612, 0.0898323, -0.179352, 0.929149, -0.369705, 6.86399e-013, },
-	{ -0.229612, 0.0898323, -0.149352, 0.929149, -0.369705, 6.86399e-013, },
-	{ -0.221949, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
-	{ -0.229612, 0.0898323, -0.149352, 0.929149, -0.369705, 6.86399e-013, },
-	{ -0.229612, 0.0898323, -0.179352, 0.929149, -0.369705, 6.86399e-013, },
-	{ -0.229612, 0.0898323, -0.149352, 0.929149, -0.369705, 6.86399e-013, },
-	{ -0.221949, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
-	{ -0.221949, 0.101566, -0.149352, 0.715458, -0.698656, 1.29713e-012, },
-	{ -0.221949, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
-	{ -0.210455, 0.109468, -0.149352, 0.383717, -0.923451, 1.71449e-012, },
-	{ -0.221949, 0.101566, -0.149352, 0.715458, -0.698656, 1.29713e-012, },
-	{ -0.210455, 0.109468, -0.149352, 0.383717, -0.923451, 1.71449e-012, },
-	{ -0.221949, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
-	{ -0.210455, 0.109468, -0.179352, 0.383717, -0.923451, 1.71449e-012, },
-	{ -0.210455, 0.109468, -0.179352, 0.383717, -0.923451, 1.71449e-012, },
-	{ -0.196406, 0.112102, -0.149352, 0, -1, 1.85661e-012, },
-	{ -0.210455, 0.109468, -0.149352, 0.383717, -0.923451, 1.71449e-012, },
-	{ -0.196406, 0.112102, -0.149352, 0, -1, 1.85661e-012, },
-	{ -0.210455, 0.109468, -0.179352, 0.383717, -0.923451, 1.71449e-012, },
-	{ -0.196406, 0.112102, -0.179352, 0, -1, 1.85661e-012, },
-	{ -0.210455, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.208749, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.196406, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.196406, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.208749, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.196406, 0.136368, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.208749, 0.135271, -0.149352, -0.184752, 0.982785, -1.82465e-012, },
-	{ -0.196406, 0.136368, -0.179352, -3.20449e-016, 1, -1.85661e-012, },
-	{ -0.208749, 0.135271, -0.179352, -0.184752, 0.982785, -1.82465e-012, },
-	{ -0.196406, 0.136368, -0.179352, -3.20449e-016, 1, -1.85661e-012, },
-	{ -0.208749, 0.135271, -0.149352, -0.184752, 0.982785, -1.82465e-012, },
-	{ -0.196406, 0.136368, -0.149352, -3.20449e-016, 1, -1.85661e-012, },
-	{ -0.195543, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.208749, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.195543, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.184064, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.184064, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.172739, 0.131978, -0.149352, 0.376579, 0.926384, -1.71984e-012, },
-	{ -0.184064, 0.135271, -0.149352, 0.184752, 0.982785, -1.82456e-012, },
-	{ -0.182425, 0.134794, -0.149352, 0.279188, 0.960237, -1.7826e-012, },
-	{ -0.172739, 0.131978, -0.149352, 0.376579, 0.926384, -1.71984e-012, },
-	{ -0.184064, 0.135271, -0.179352, 0.184752, 0.982785, -1.82456e-012, },
-	{ -0.184064, 0.135271, -0.149352, 0.184752, 0.982785, -1.82456e-012, },
-	{ -0.184064, 0.135271, -0.179352, 0.184752, 0.982785, -1.82456e-012, },
-	{ -0.172739, 0.131978, -0.149352, 0.376579, 0.926384, -1.71984e-012, },
-	{ -0.172739, 0.131978, -0.179352, 0.376579, 0.926384, -1.71984e-012, },
-	{ -0.172739, 0.131978, -0.149352, 0.376579, 0.926384, -1.71984e-012, },
-	{ -0.162432, 0.12649, -0.179352, 0.556478, 0.830862, -1.54259e-012, },
-	{ -0.172739, 0.131978, -0.179352, 0.376579, 0.926384, -1.71984e-012, },
-	{ -0.162432, 0.12649, -0.179352, 0.556478, 0.830862, -1.54259e-012, },
-	{ -0.172739, 0.131978, -0.149352, 0.376579, 0.926384, -1.71984e-012, },
-	{ -0.162432, 0.12649, -0.149352, 0.556478, 0.830862, -1.54259e-012, },
-	{ -0.172739, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.170863, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.162432, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.172739, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.182358, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.170863, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.182358, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.172739, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.112102, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.182358, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.112102, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.210455, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.112102, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.221949, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.210455, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.229612, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.221949, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.22987, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.229612, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.23038, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.229612, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.22987, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.23038, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.232166, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.229612, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.23038, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.23951, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.232166, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.239669, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.23951, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.23038, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.239669, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.247262, 0.0416702, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.23951, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.247352, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.247262, 0.0416702, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.239669, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.247352, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.2528, 0.0519572, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.247262, 0.0416702, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.25284, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.2528, 0.0519572, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.247352, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.25284, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.256122, 0.0633018, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.2528, 0.0519572, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.256132, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.256122, 0.0633018, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.25284, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.256122, 0.0633018, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.256132, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.25723, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.256132, 0.0879765, -0.149352, -0.982629, 0.185582, -3.44553e-013, },
-	{ -0.25723, 0.075704, -0.179352, -1, 6.48887e-005, -1.20473e-016, },
-	{ -0.25723, 0.075704, -0.149352, -1, 6.48887e-005, -1.20473e-016, },
-	{ -0.25723, 0.075704, -0.179352, -1, 6.48887e-005, -1.20473e-016, },
-	{ -0.256132, 0.0879765, -0.149352, -0.982629, 0.185582, -3.44553e-013, },
-	{ -0.256132, 0.0879765, -0.179352, -0.982629, 0.185582, -3.44553e-013, },
-	{ -0.25284, 0.0992512, -0.149352, -0.925933, 0.377687, -7.01219e-013, },
-	{ -0.256132, 0.0879765, -0.179352, -0.982629, 0.185582, -3.44553e-013, },
-	{ -0.256132, 0.0879765, -0.149352, -0.982629, 0.185582, -3.44553e-013, },
-	{ -0.256132, 0.0879765, -0.179352, -0.982629, 0.185582, -3.44553e-013, },
-	{ -0.25284, 0.0992512, -0.149352, -0.925933, 0.377687, -7.01219e-013, },
-	{ -0.25284, 0.0992512, -0.179352, -0.925933, 0.377687, -7.01219e-013, },
-	{ -0.247352, 0.109528, -0.149352, -0.830379, 0.557199, -1.0345e-012, },
-	{ -0.25284, 0.0992512, -0.179352, -0.925933, 0.377687, -7.01219e-013, },
-	{ -0.25284, 0.0992512, -0.149352, -0.925933, 0.377687, -7.01219e-013, },
-	{ -0.25284, 0.0992512, -0.179352, -0.925933, 0.377687, -7.01219e-013, },
-	{ -0.247352, 0.109528, -0.149352, -0.830379, 0.557199, -1.0345e-012, },
-	{ -0.247352, 0.109528, -0.179352, -0.830379, 0.557199, -1.0345e-012, },
-	{ -0.239669, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
-	{ -0.247352, 0.109528, -0.179352, -0.830379, 0.557199, -1.0345e-012, },
-	{ -0.247352, 0.109528, -0.149352, -0.830379, 0.557199, -1.0345e-012, },
-	{ -0.247352, 0.109528, -0.179352, -0.830379, 0.557199, -1.0345e-012, },
-	{ -0.239669, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
-	{ -0.239669, 0.118807, -0.179352, -0.70692, 0.707293, -1.31317e-012, },
-	{ -0.239669, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
-	{ -0.23038, 0.12649, -0.179352, -0.556478, 0.830862, -1.5427e-012, },
-	{ -0.239669, 0.118807, -0.179352, -0.70692, 0.707293, -1.31317e-012, },
-	{ -0.23038, 0.12649, -0.179352, -0.556478, 0.830862, -1.5427e-012, },
-	{ -0.239669, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
-	{ -0.23038, 0.12649, -0.149352, -0.556478, 0.830862, -1.5427e-012, },
-	{ -0.220073, 0.131978, -0.149352, -0.376579, 0.926384, -1.72004e-012, },
-	{ -0.23038, 0.12649, -0.179352, -0.556478, 0.830862, -1.5427e-012, },
-	{ -0.23038, 0.12649, -0.149352, -0.556478, 0.830862, -1.5427e-012, },
-	{ -0.23038, 0.12649, -0.179352, -0.556478, 0.830862, -1.5427e-012, },
-	{ -0.220073, 0.131978, -0.149352, -0.376579, 0.926384, -1.72004e-012, },
-	{ -0.220073, 0.131978, -0.179352, -0.376579, 0.926384, -1.72004e-012, },
-	{ -0.220073, 0.131978, -0.149352, -0.376579, 0.926384, -1.72004e-012, },
-	{ -0.23038, 0.12649, -0.149352, -0.556478, 0.830862, -1.5427e-012, },
-	{ -0.22987, 0.126762, -0.149352, -0.469967, 0.882684, -1.63902e-012, },
-	{ -0.230171, 0.0248279, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.232166, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.23951, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.232166, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.230171, 0.0248279, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.229552, 0.0613761, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.229552, 0.0613761, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.230171, 0.0248279, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.219874, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.230171, 0.0248279, -0.179352, -0.552115, -0.833768, 1.54798e-012, },
-	{ -0.219874, 0.0193901, -0.149352, -0.374648, -0.927167, 1.72139e-012, },
-	{ -0.230171, 0.0248279, -0.149352, -0.552115, -0.833768, 1.54798e-012, },
-	{ -0.219874, 0.0193901, -0.149352, -0.374648, -0.927167, 1.72139e-012, },
-	{ -0.230171, 0.0248279, -0.179352, -0.552115, -0.833768, 1.54798e-012, },
-	{ -0.219874, 0.0193901, -0.179352, -0.374648, -0.927167, 1.72139e-012, },
-	{ -0.230171, 0.0248279, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.229552, 0.0613761, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.219874, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.219874, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.229552, 0.0613761, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.22171, 0.0496823, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.229552, 0.0613761, -0.179352, 0.926569, 0.376125, -6.98317e-013, },
-	{ -0.22171, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
-	{ -0.22171, 0.0496823, -0.179352, 0.707819, 0.706394, -1.3115e-012, },
-	{ -0.22171, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
-	{ -0.229552, 0.0613761, -0.179352, 0.926569, 0.376125, -6.98317e-013, },
-	{ -0.229552, 0.0613761, -0.149352, 0.926569, 0.376125, -6.98317e-013, },
-	{ -0.229552, 0.0613761, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.219874, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.22171, 0.0496823, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.22171, 0.0496823, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.219874, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.210155, 0.0418997, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.210155, 0.0418997, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.219874, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.208619, 0.0161274, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.219874, 0.0193901, -0.179352, -0.374648, -0.927167, 1.72139e-012, },
-	{ -0.208619, 0.0161274, -0.149352, -0.184427, -0.982846, 1.82476e-012, },
-	{ -0.219874, 0.0193901, -0.149352, -0.374648, -0.927167, 1.72139e-012, },
-	{ -0.208619, 0.0161274, -0.149352, -0.184427, -0.982846, 1.82476e-012, },
-	{ -0.219874, 0.0193901, -0.179352, -0.374648, -0.927167, 1.72139e-012, },
-	{ -0.208619, 0.0161274, -0.179352, -0.184427, -0.982846, 1.82476e-012, },
-	{ -0.219874, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.210155, 0.0418997, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.208619, 0.0161274, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.219874, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.22171, 0.0496823, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.210155, 0.0418997, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.22171, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
-	{ -0.210155, 0.0418997, -0.179352, 0.379845, 0.92505, -1.71746e-012, },
-	{ -0.22171, 0.0496823, -0.179352, 0.707819, 0.706394, -1.3115e-012, },
-	{ -0.210155, 0.0418997, -0.179352, 0.379845, 0.92505, -1.71746e-012, },
-	{ -0.22171, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
-	{ -0.210155, 0.0418997, -0.149352, 0.379845, 0.92505, -1.71746e-012, },
-	{ -0.210155, 0.0418997, -0.149352, 0.379845, 0.92505, -1.71746e-012, },
-	{ -0.196406, 0.0393055, -0.179352, -0.000116454, 1, -1.85661e-012, },
-	{ -0.210155, 0.0418997, -0.179352, 0.379845, 0.92505, -1.71746e-012, },
-	{ -0.196406, 0.0393055, -0.179352, -0.000116454, 1, -1.85661e-012, },
-	{ -0.210155, 0.0418997, -0.149352, 0.379845, 0.92505, -1.71746e-012, },
-	{ -0.196406, 0.0393055, -0.149352, -0.000116454, 1, -1.85661e-012, },
-	{ -0.210155, 0.0418997, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.208619, 0.0161274, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.208619, 0.0161274, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.0150399, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.208619, 0.0161274, -0.179352, -0.184427, -0.982846, 1.82476e-012, },
-	{ -0.196406, 0.0150399, -0.149352, -6.3234e-005, -1, 1.85661e-012, },
-	{ -0.208619, 0.0161274, -0.149352, -0.184427, -0.982846, 1.82476e-012, },
-	{ -0.196406, 0.0150399, -0.149352, -6.3234e-005, -1, 1.85661e-012, },
-	{ -0.208619, 0.0161274, -0.179352, -0.184427, -0.982846, 1.82476e-012, },
-	{ -0.196406, 0.0150399, -0.179352, -6.3234e-005, -1, 1.85661e-012, },
-	{ -0.208619, 0.0161274, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.196406, 0.0393055, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.196406, 0.0150399, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.208619, 0.0161274, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.210155, 0.0418997, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.196406, 0.0393055, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.196406, 0.0150399, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.196406, 0.0393055, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.182358, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.196406, 0.0393055, -0.149352, -0.000116454, 1, -1.85661e-012, },
-	{ -0.182358, 0.0419596, -0.179352, -0.385978, 0.922508, -1.71274e-012, },
-	{ -0.196406, 0.0393055, -0.179352, -0.000116454, 1, -1.85661e-012, },
-	{ -0.182358, 0.0419596, -0.179352, -0.385978, 0.922508, -1.71274e-012, },
-	{ -0.196406, 0.0393055, -0.149352, -0.000116454, 1, -1.85661e-012, },
-	{ -0.182358, 0.0419596, -0.149352, -0.385978, 0.922508, -1.71274e-012, },
-	{ -0.196406, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.184064, 0.0161374, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.182358, 0.0419596, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.0150399, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.184064, 0.0161374, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.196406, 0.0150399, -0.179352, -6.3234e-005, -1, 1.85661e-012, },
-	{ -0.184064, 0.0161374, -0.149352, 0.184752, -0.982785, 1.82465e-012, },
-	{ -0.196406, 0.0150399, -0.149352, -6.3234e-005, -1, 1.85661e-012, },
-	{ -0.184064, 0.0161374, -0.149352, 0.184752, -0.982785, 1.82465e-012, },
-	{ -0.196406, 0.0150399, -0.179352, -6.3234e-005, -1, 1.85661e-012, },
-	{ -0.184064, 0.0161374, -0.179352, 0.184752, -0.982785, 1.82465e-012, },
-	{ -0.196406, 0.0150399, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.182358, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.184064, 0.0161374, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.184064, 0.0161374, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.182358, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.172739, 0.01943, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.172739, 0.01943, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.182358, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.170863, 0.0499217, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.182358, 0.0419596, -0.149352, -0.385978, 0.922508, -1.71274e-012, },
-	{ -0.170863, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
-	{ -0.182358, 0.0419596, -0.179352, -0.385978, 0.922508, -1.71274e-012, },
-	{ -0.170863, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
-	{ -0.182358, 0.0419596, -0.149352, -0.385978, 0.922508, -1.71274e-012, },
-	{ -0.170863, 0.0499217, -0.149352, -0.716961, 0.697114, -1.29427e-012, },
-	{ -0.182358, 0.0419596, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.172739, 0.01943, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.170863, 0.0499217, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.182358, 0.0419596, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.184064, 0.0161374, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.172739, 0.01943, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.184064, 0.0161374, -0.179352, 0.184752, -0.982785, 1.82465e-012, },
-	{ -0.172739, 0.01943, -0.149352, 0.376579, -0.926384, 1.71994e-012, },
-	{ -0.184064, 0.0161374, -0.149352, 0.184752, -0.982785, 1.82465e-012, },
-	{ -0.172739, 0.01943, -0.149352, 0.376579, -0.926384, 1.71994e-012, },
-	{ -0.184064, 0.0161374, -0.179352, 0.184752, -0.982785, 1.82465e-012, },
-	{ -0.172739, 0.01943, -0.179352, 0.376579, -0.926384, 1.71994e-012, },
-	{ -0.172739, 0.01943, -0.179352, 0.376579, -0.926384, 1.71994e-012, },
-	{ -0.162432, 0.0249177, -0.149352, 0.556478, -0.830862, 1.54259e-012, },
-	{ -0.172739, 0.01943, -0.149352, 0.376579, -0.926384, 1.71994e-012, },
-	{ -0.162432, 0.0249177, -0.149352, 0.556478, -0.830862, 1.54259e-012, },
-	{ -0.172739, 0.01943, -0.179352, 0.376579, -0.926384, 1.71994e-012, },
-	{ -0.162432, 0.0249177, -0.179352, 0.556478, -0.830862, 1.54259e-012, },
-	{ -0.172739, 0.01943, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.170863, 0.0499217, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.162432, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.162432, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.170863, 0.0499217, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.163201, 0.0616754, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.170863, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
-	{ -0.163201, 0.0616754, -0.149352, -0.929063, 0.369922, -6.86802e-013, },
-	{ -0.163201, 0.0616754, -0.179352, -0.929063, 0.369922, -6.86802e-013, },
-	{ -0.163201, 0.0616754, -0.149352, -0.929063, 0.369922, -6.86802e-013, },
-	{ -0.170863, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
-	{ -0.170863, 0.0499217, -0.149352, -0.716961, 0.697114, -1.29427e-012, },
-	{ -0.170863, 0.0499217, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.162432, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.163201, 0.0616754, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.170863, 0.0499217, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.172739, 0.01943, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.162432, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.163201, 0.0616754, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.162432, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.160646, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.160646, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.162432, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.153143, 0.0326005, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.162432, 0.0249177, -0.179352, 0.556478, -0.830862, 1.54259e-012, },
-	{ -0.153143, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
-	{ -0.162432, 0.0249177, -0.149352, 0.556478, -0.830862, 1.54259e-012, },
-	{ -0.153143, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
-	{ -0.162432, 0.0249177, -0.179352, 0.556478, -0.830862, 1.54259e-012, },
-	{ -0.153143, 0.0326005, -0.179352, 0.70692, -0.707293, 1.31317e-012, },
-	{ -0.162432, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.160646, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.153143, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.162432, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.163201, 0.0616754, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.160646, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.163201, 0.0616754, -0.179352, -0.929063, 0.369922, -6.86802e-013, },
-	{ -0.160646, 0.075704, -0.149352, -1, 0.000622437, -1.15562e-015, },
-	{ -0.160646, 0.075704, -0.179352, -1, 0.000622437, -1.15562e-015, },
-	{ -0.160646, 0.075704, -0.149352, -1, 0.000622437, -1.15562e-015, },
-	{ -0.163201, 0.0616754, -0.179352, -0.929063, 0.369922, -6.86802e-013, },
-	{ -0.163201, 0.0616754, -0.149352, -0.929063, 0.369922, -6.86802e-013, },
-	{ -0.163201, 0.0898323, -0.149352, -0.929149, -0.369705, 6.86399e-013, },
-	{ -0.160646, 0.075704, -0.179352, -1, 0.000622437, -1.15562e-015, },
-	{ -0.160646, 0.075704, -0.149352, -1, 0.000622437, -1.15562e-015, },
-	{ -0.160646, 0.075704, -0.179352, -1, 0.000622437, -1.15562e-015, },
-	{ -0.163201, 0.0898323, -0.149352, -0.929149, -0.369705, 6.86399e-013, },
-	{ -0.163201, 0.0898323, -0.179352, -0.929149, -0.369705, 6.86399e-013, },
-	{ -0.170863, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
-	{ -0.163201, 0.0898323, -0.179352, -0.929149, -0.369705, 6.86399e-013, },
-	{ -0.163201, 0.0898323, -0.149352, -0.929149, -0.369705, 6.86399e-013, },
-	{ -0.163201, 0.0898323, -0.179352, -0.929149, -0.369705, 6.86399e-013, },
-	{ -0.170863, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
-	{ -0.170863, 0.101566, -0.179352, -0.715458, -0.698656, 1.29713e-012, },
-	{ -0.170863, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
-	{ -0.182358, 0.109468, -0.179352, -0.383717, -0.923451, 1.71449e-012, },
-	{ -0.170863, 0.101566, -0.179352, -0.715458, -0.698656, 1.29713e-012, },
-	{ -0.182358, 0.109468, -0.179352, -0.383717, -0.923451, 1.71449e-012, },
-	{ -0.170863, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
-	{ -0.182358, 0.109468, -0.149352, -0.383717, -0.923451, 1.71449e-012, },
-	{ -0.182358, 0.109468, -0.149352, -0.383717, -0.923451, 1.71449e-012, },
-	{ -0.196406, 0.112102, -0.179352, 0, -1, 1.85661e-012, },
-	{ -0.182358, 0.109468, -0.179352, -0.383717, -0.923451, 1.71449e-012, },
-	{ -0.196406, 0.112102, -0.179352, 0, -1, 1.85661e-012, },
-	{ -0.182358, 0.109468, -0.149352, -0.383717, -0.923451, 1.71449e-012, },
-	{ -0.196406, 0.112102, -0.149352, 0, -1, 1.85661e-012, },
-	{ -0.196406, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.184064, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.182358, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.196406, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.196406, 0.136368, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.184064, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.196406, 0.136368, -0.149352, -3.20449e-016, 1, -1.85661e-012, },
-	{ -0.184064, 0.135271, -0.179352, 0.184752, 0.982785, -1.82456e-012, },
-	{ -0.196406, 0.136368, -0.179352, -3.20449e-016, 1, -1.85661e-012, },
-	{ -0.184064, 0.135271, -0.179352, 0.184752, 0.982785, -1.82456e-012, },
-	{ -0.196406, 0.136368, -0.149352, -3.20449e-016, 1, -1.85661e-012, },
-	{ -0.184064, 0.135271, -0.149352, 0.184752, 0.982785, -1.82456e-012, },
-	{ -0.182358, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.184064, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.172739, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.182358, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.172739, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.170863, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.170863, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.172739, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.162432, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.170863, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.162432, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.163201, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.163201, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.162432, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.160646, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.160646, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.162432, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.153143, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.162432, 0.12649, -0.149352, 0.556478, 0.830862, -1.54259e-012, },
-	{ -0.153143, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
-	{ -0.162432, 0.12649, -0.179352, 0.556478, 0.830862, -1.54259e-012, },
-	{ -0.153143, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
-	{ -0.162432, 0.12649, -0.149352, 0.556478, 0.830862, -1.54259e-012, },
-	{ -0.153143, 0.118807, -0.149352, 0.70692, 0.707293, -1.31317e-012, },
-	{ -0.162432, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.160646, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.153143, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.162432, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.163201, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.160646, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.162432, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.170863, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.163201, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.153143, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.160646, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.153143, 0.0326005, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.153143, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.153143, 0.0326005, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.14546, 0.0418797, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.153143, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
-	{ -0.14546, 0.0418797, -0.179352, 0.830379, -0.557199, 1.0345e-012, },
-	{ -0.14546, 0.0418797, -0.149352, 0.830379, -0.557199, 1.0345e-012, },
-	{ -0.14546, 0.0418797, -0.179352, 0.830379, -0.557199, 1.0345e-012, },
-	{ -0.153143, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
-	{ -0.153143, 0.0326005, -0.179352, 0.70692, -0.707293, 1.31317e-012, },
-	{ -0.153143, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.14546, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.14546, 0.0418797, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.153143, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.153143, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.14546, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.153143, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.160646, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.153143, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.153143, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
-	{ -0.14546, 0.109528, -0.149352, 0.830379, 0.557199, -1.0345e-012, },
-	{ -0.14546, 0.109528, -0.179352, 0.830379, 0.557199, -1.0345e-012, },
-	{ -0.14546, 0.109528, -0.149352, 0.830379, 0.557199, -1.0345e-012, },
-	{ -0.153143, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
-	{ -0.153143, 0.118807, -0.149352, 0.70692, 0.707293, -1.31317e-012, },
-	{ -0.153143, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.14546, 0.0418797, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.14546, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.14546, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.14546, 0.0418797, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.139973, 0.0521567, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.14546, 0.0418797, -0.149352, 0.830379, -0.557199, 1.0345e-012, },
-	{ -0.139973, 0.0521567, -0.179352, 0.925933, -0.377687, 7.01219e-013, },
-	{ -0.139973, 0.0521567, -0.149352, 0.925933, -0.377687, 7.01219e-013, },
-	{ -0.139973, 0.0521567, -0.179352, 0.925933, -0.377687, 7.01219e-013, },
-	{ -0.14546, 0.0418797, -0.149352, 0.830379, -0.557199, 1.0345e-012, },
-	{ -0.14546, 0.0418797, -0.179352, 0.830379, -0.557199, 1.0345e-012, },
-	{ -0.14546, 0.0418797, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.139973, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.139973, 0.0521567, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.14546, 0.0418797, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.14546, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.139973, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.14546, 0.109528, -0.179352, 0.830379, 0.557199, -1.0345e-012, },
-	{ -0.139973, 0.0992512, -0.149352, 0.925933, 0.377687, -7.01219e-013, },
-	{ -0.139973, 0.0992512, -0.179352, 0.925933, 0.377687, -7.01219e-013, },
-	{ -0.139973, 0.0992512, -0.149352, 0.925933, 0.377687, -7.01219e-013, },
-	{ -0.14546, 0.109528, -0.179352, 0.830379, 0.557199, -1.0345e-012, },
-	{ -0.14546, 0.109528, -0.149352, 0.830379, 0.557199, -1.0345e-012, },
-	{ -0.14546, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.139973, 0.0521567, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.139973, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.139973, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.139973, 0.0521567, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.13668, 0.0634315, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.139973, 0.0521567, -0.149352, 0.925933, -0.377687, 7.01219e-013, },
-	{ -0.13668, 0.0634315, -0.179352, 0.982629, -0.185582, 3.44553e-013, },
-	{ -0.13668, 0.0634315, -0.149352, 0.982629, -0.185582, 3.44553e-013, },
-	{ -0.13668, 0.0634315, -0.179352, 0.982629, -0.185582, 3.44553e-013, },
-	{ -0.139973, 0.0521567, -0.149352, 0.925933, -0.377687, 7.01219e-013, },
-	{ -0.139973, 0.0521567, -0.179352, 0.925933, -0.377687, 7.01219e-013, },
-	{ -0.139973, 0.0521567, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.13668, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.13668, 0.0634315, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.139973, 0.0521567, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.139973, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.13668, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.139973, 0.0992512, -0.179352, 0.925933, 0.377687, -7.01219e-013, },
-	{ -0.13668, 0.0879765, -0.149352, 0.982629, 0.185582, -3.44553e-013, },
-	{ -0.13668, 0.0879765, -0.179352, 0.982629, 0.185582, -3.44553e-013, },
-	{ -0.13668, 0.0879765, -0.149352, 0.982629, 0.185582, -3.44553e-013, },
-	{ -0.139973, 0.0992512, -0.179352, 0.925933, 0.377687, -7.01219e-013, },
-	{ -0.139973, 0.0992512, -0.149352, 0.925933, 0.377687, -7.01219e-013, },
-	{ -0.139973, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.13668, 0.0634315, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.13668, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.13668, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.13668, 0.0634315, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.135582, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.13668, 0.0634315, -0.149352, 0.982629, -0.185582, 3.44553e-013, },
-	{ -0.135582, 0.075704, -0.179352, 1, -1.67198e-016, 3.10422e-028, },
-	{ -0.135582, 0.075704, -0.149352, 1, -1.67198e-016, 3.10422e-028, },
-	{ -0.135582, 0.075704, -0.179352, 1, -1.67198e-016, 3.10422e-028, },
-	{ -0.13668, 0.0634315, -0.149352, 0.982629, -0.185582, 3.44553e-013, },
-	{ -0.13668, 0.0634315, -0.179352, 0.982629, -0.185582, 3.44553e-013, },
-	{ -0.13668, 0.0634315, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.13668, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.135582, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.13668, 0.0879765, -0.179352, 0.982629, 0.185582, -3.44553e-013, },
-	{ -0.135582, 0.075704, -0.149352, 1, -1.67198e-016, 3.10422e-028, },
-	{ -0.135582, 0.075704, -0.179352, 1, -1.67198e-016, 3.10422e-028, },
-	{ -0.135582, 0.075704, -0.149352, 1, -1.67198e-016, 3.10422e-028, },
-	{ -0.13668, 0.0879765, -0.179352, 0.982629, 0.185582, -3.44553e-013, },
-	{ -0.13668, 0.0879765, -0.149352, 0.982629, 0.185582, -3.44553e-013, },
-	{ -0.174216, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.184064, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.195543, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.184064, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.174216, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.174216, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
-	{ -0.195543, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
-	{ -0.195543, 0.154734, -0.149352, -0.0937744, 0.995593, -1.84843e-012, },
-	{ -0.195543, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
-	{ -0.174216, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
-	{ -0.174216, 0.155685, -0.179352, 3.90799e-005, 1, -1.85661e-012, },
-	{ -0.174216, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
-	{ -0.152926, 0.154734, -0.179352, 0.093929, 0.995579, -1.8484e-012, },
-	{ -0.174216, 0.155685, -0.179352, 3.90799e-005, 1, -1.85661e-012, },
-	{ -0.152926, 0.154734, -0.179352, 0.093929, 0.995579, -1.8484e-012, },
-	{ -0.174216, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
-	{ -0.152926, 0.154734, -0.149352, 0.093929, 0.995579, -1.8484e-012, },
-	{ -0.174216, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.14119, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.152926, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.174216, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.174376, 0.13541, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.14119, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.174216, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.174376, 0.13541, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.174376, 0.13541, -0.179352, 8.00648e-005, -1, 1.85651e-012, },
-	{ -0.14119, 0.132876, -0.149352, -0.1704, -0.985375, 1.82946e-012, },
-	{ -0.174376, 0.13541, -0.149352, 8.00648e-005, -1, 1.85651e-012, },
-	{ -0.14119, 0.132876, -0.149352, -0.1704, -0.985375, 1.82946e-012, },
-	{ -0.174376, 0.13541, -0.179352, 8.00648e-005, -1, 1.85651e-012, },
-	{ -0.14119, 0.132876, -0.179352, -0.1704, -0.985375, 1.82946e-012, },
-	{ -0.174376, 0.13541, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.174216, 0.155685, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.14119, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.174376, 0.13541, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.195543, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.174216, 0.155685, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.14119, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.174216, 0.155685, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.152926, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.14119, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.152926, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.133198, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.152926, 0.154734, -0.149352, 0.093929, 0.995579, -1.8484e-012, },
-	{ -0.133198, 0.151883, -0.179352, 0.198356, 0.98013, -1.81972e-012, },
-	{ -0.152926, 0.154734, -0.179352, 0.093929, 0.995579, -1.8484e-012, },
-	{ -0.133198, 0.151883, -0.179352, 0.198356, 0.98013, -1.81972e-012, },
-	{ -0.152926, 0.154734, -0.149352, 0.093929, 0.995579, -1.8484e-012, },
-	{ -0.133198, 0.151883, -0.149352, 0.198356, 0.98013, -1.81972e-012, },
-	{ -0.152926, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.14119, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.133198, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.133198, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.14119, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.113312, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.14119, 0.132876, -0.179352, -0.1704, -0.985375, 1.82946e-012, },
-	{ -0.113312, 0.125273, -0.149352, -0.379191, -0.925318, 1.71796e-012, },
-	{ -0.14119, 0.132876, -0.149352, -0.1704, -0.985375, 1.82946e-012, },
-	{ -0.113312, 0.125273, -0.149352, -0.379191, -0.925318, 1.71796e-012, },
-	{ -0.14119, 0.132876, -0.179352, -0.1704, -0.985375, 1.82946e-012, },
-	{ -0.113312, 0.125273, -0.179352, -0.379191, -0.925318, 1.71796e-012, },
-	{ -0.14119, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.133198, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.113312, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.113312, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.133198, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.115031, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.133198, 0.151883, -0.149352, 0.198356, 0.98013, -1.81972e-012, },
-	{ -0.115031, 0.147131, -0.179352, 0.313088, 0.949724, -1.76327e-012, },
-	{ -0.133198, 0.151883, -0.179352, 0.198356, 0.98013, -1.81972e-012, },
-	{ -0.115031, 0.147131, -0.179352, 0.313088, 0.949724, -1.76327e-012, },
-	{ -0.133198, 0.151883, -0.149352, 0.198356, 0.98013, -1.81972e-012, },
-	{ -0.115031, 0.147131, -0.149352, 0.313088, 0.949724, -1.76327e-012, },
-	{ -0.133198, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.113312, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.115031, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.115031, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.113312, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0984257, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0984257, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.113312, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0907429, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.113312, 0.125273, -0.179352, -0.379191, -0.925318, 1.71796e-012, },
-	{ -0.0907429, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
-	{ -0.113312, 0.125273, -0.149352, -0.379191, -0.925318, 1.71796e-012, },
-	{ -0.0907429, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
-	{ -0.113312, 0.125273, -0.179352, -0.379191, -0.925318, 1.71796e-012, },
-	{ -0.0907429, 0.112601, -0.179352, -0.609426, -0.792843, 1.472e-012, },
-	{ -0.113312, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0984257, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0907429, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.113312, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.115031, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0984257, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.115031, 0.147131, -0.149352, 0.313088, 0.949724, -1.76327e-012, },
-	{ -0.0984257, 0.140479, -0.179352, 0.43408, 0.900874, -1.67257e-012, },
-	{ -0.115031, 0.147131, -0.179352, 0.313088, 0.949724, -1.76327e-012, },
-	{ -0.0984257, 0.140479, -0.179352, 0.43408, 0.900874, -1.67257e-012, },
-	{ -0.115031, 0.147131, -0.149352, 0.313088, 0.949724, -1.76327e-012, },
-	{ -0.0984257, 0.140479, -0.149352, 0.43408, 0.900874, -1.67257e-012, },
-	{ -0.0984257, 0.140479, -0.149352, 0.43408, 0.900874, -1.67257e-012, },
-	{ -0.0833819, 0.131926, -0.179352, 0.554922, 0.831902, -1.54452e-012, },
-	{ -0.0984257, 0.140479, -0.179352, 0.43408, 0.900874, -1.67257e-012, },
-	{ -0.0833819, 0.131926, -0.179352, 0.554922, 0.831902, -1.54452e-012, },
-	{ -0.0984257, 0.140479, -0.149352, 0.43408, 0.900874, -1.67257e-012, },
-	{ -0.0833819, 0.131926, -0.149352, 0.554922, 0.831902, -1.54452e-012, },
-	{ -0.0984257, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0907429, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0833819, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0833819, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0907429, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0734815, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0907429, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
-	{ -0.0734815, 0.0948611, -0.179352, -0.716715, -0.697366, 1.29474e-012, },
-	{ -0.0734815, 0.0948611, -0.149352, -0.716715, -0.697366, 1.29474e-012, },
-	{ -0.0734815, 0.0948611, -0.179352, -0.716715, -0.697366, 1.29474e-012, },
-	{ -0.0907429, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
-	{ -0.0907429, 0.112601, -0.179352, -0.609426, -0.792843, 1.472e-012, },
-	{ -0.0907429, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0833819, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0734815, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0907429, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0984257, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0833819, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0734815, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0833819, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0698996, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0833819, 0.131926, -0.149352, 0.554922, 0.831902, -1.54452e-012, },
-	{ -0.0698996, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
-	{ -0.0833819, 0.131926, -0.179352, 0.554922, 0.831902, -1.54452e-012, },
-	{ -0.0698996, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
-	{ -0.0833819, 0.131926, -0.149352, 0.554922, 0.831902, -1.54452e-012, },
-	{ -0.0698996, 0.121471, -0.149352, 0.667924, 0.74423, -1.38175e-012, },
-	{ -0.0833819, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0734815, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0698996, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0698996, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0734815, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0476195, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0734815, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
-	{ -0.0476195, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ -0.0734815, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ -0.0476195, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ -0.0734815, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
-	{ -0.0476195, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
-	{ -0.0734815, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0698996, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0476195, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0476195, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0698996, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0579788, 0.109117, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0698996, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
-	{ -0.0579788, 0.109117, -0.149352, 0.766151, 0.642661, -1.19317e-012, },
-	{ -0.0579788, 0.109117, -0.179352, 0.766151, 0.642661, -1.19317e-012, },
-	{ -0.0579788, 0.109117, -0.149352, 0.766151, 0.642661, -1.19317e-012, },
-	{ -0.0698996, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
-	{ -0.0698996, 0.121471, -0.149352, 0.667924, 0.74423, -1.38175e-012, },
-	{ -0.0698996, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0476195, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0579788, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0476195, 0.0948611, -0.149352, 0.808963, 0.58786, -1.09143e-012, },
-	{ -0.0579788, 0.109117, -0.179352, 0.766151, 0.642661, -1.19317e-012, },
-	{ -0.0579788, 0.109117, -0.149352, 0.766151, 0.642661, -1.19317e-012, },
-	{ -0.0579788, 0.109117, -0.179352, 0.766151, 0.642661, -1.19317e-012, },
-	{ -0.0476195, 0.0948611, -0.149352, 0.808963, 0.58786, -1.09143e-012, },
-	{ -0.0476195, 0.0948611, -0.179352, 0.808963, 0.58786, -1.09143e-012, },
-	{ -0.250126, 0.140479, -0.179352, -0.433645, 0.901084, -1.67296e-012, },
-	{ -0.265187, 0.131926, -0.149352, -0.554528, 0.832165, -1.54501e-012, },
-	{ -0.250126, 0.140479, -0.149352, -0.433645, 0.901084, -1.67296e-012, },
-	{ -0.265187, 0.131926, -0.149352, -0.554528, 0.832165, -1.54501e-012, },
-	{ -0.250126, 0.140479, -0.179352, -0.433645, 0.901084, -1.67296e-012, },
-	{ -0.265187, 0.131926, -0.179352, -0.554528, 0.832165, -1.54501e-012, },
-	{ -0.118022, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.133522, -0.126451, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.143884, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.133522, -0.126451, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.118022, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.121594, -0.138806, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.121594, -0.138806, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.118022, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.108099, -0.14926, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.108099, -0.14926, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.118022, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.10077, -0.129935, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.118022, -0.112195, -0.179352, 0.716917, 0.697159, -1.29435e-012, },
-	{ -0.10077, -0.129935, -0.149352, 0.609765, 0.792582, -1.47152e-012, },
-	{ -0.10077, -0.129935, -0.179352, 0.609765, 0.792582, -1.47152e-012, },
-	{ -0.10077, -0.129935, -0.149352, 0.609765, 0.792582, -1.47152e-012, },
-	{ -0.118022, -0.112195, -0.179352, 0.716917, 0.697159, -1.29435e-012, },
-	{ -0.118022, -0.112195, -0.149352, 0.716917, 0.697159, -1.29435e-012, },
-	{ -0.118022, -0.112195, -0.179352, 0, 1, -1.85661e-012, },
-	{ -0.143884, -0.112195, -0.149352, 0, 1, -1.85661e-012, },
-	{ -0.118022, -0.112195, -0.149352, 0, 1, -1.85661e-012, },
-	{ -0.143884, -0.112195, -0.149352, 0, 1, -1.85661e-012, },
-	{ -0.118022, -0.112195, -0.179352, 0, 1, -1.85661e-012, },
-	{ -0.143884, -0.112195, -0.179352, 0, 1, -1.85661e-012, },
-	{ -0.133522, -0.126451, -0.179352, -0.766013, -0.642825, 1.19348e-012, },
-	{ -0.143884, -0.112195, -0.149352, -0.808895, -0.587953, 1.0916e-012, },
-	{ -0.143884, -0.112195, -0.179352, -0.808895, -0.587953, 1.0916e-012, },
-	{ -0.143884, -0.112195, -0.149352, -0.808895, -0.587953, 1.0916e-012, },
-	{ -0.133522, -0.126451, -0.179352, -0.766013, -0.642825, 1.19348e-012, },
-	{ -0.133522, -0.126451, -0.149352, -0.766013, -0.642825, 1.19348e-012, },
-	{ -0.121594, -0.138806, -0.179352, -0.66764, -0.744484, 1.38222e-012, },
-	{ -0.133522, -0.126451, -0.149352, -0.766013, -0.642825, 1.19348e-012, },
-	{ -0.133522, -0.126451, -0.179352, -0.766013, -0.642825, 1.19348e-012, },
-	{ -0.133522, -0.126451, -0.149352, -0.766013, -0.642825, 1.19348e-012, },
-	{ -0.121594, -0.138806, -0.179352, -0.66764, -0.744484, 1.38222e-012, },
-	{ -0.121594, -0.138806, -0.149352, -0.66764, -0.744484, 1.38222e-012, },
-	{ -0.121594, -0.138806, -0.179352, -0.66764, -0.744484, 1.38222e-012, },
-	{ -0.108099, -0.14926, -0.149352, -0.554528, -0.832165, 1.54501e-012, },
-	{ -0.121594, -0.138806, -0.149352, -0.66764, -0.744484, 1.38222e-012, },
-	{ -0.108099, -0.14926, -0.149352, -0.554528, -0.832165, 1.54501e-012, },
-	{ -0.121594, -0.138806, -0.179352, -0.66764, -0.744484, 1.38222e-012, },
-	{ -0.108099, -0.14926, -0.179352, -0.554528, -0.832165, 1.54501e-012, },
-	{ -0.108099, -0.14926, -0.179352, -0.554528, -0.832165, 1.54501e-012, },
-	{ -0.0930377, -0.157813, -0.149352, -0.433645, -0.901084, 1.67296e-012, },
-	{ -0.108099, -0.14926, -0.149352, -0.554528, -0.832165, 1.54501e-012, },
-	{ -0.0930377, -0.157813, -0.149352, -0.433645, -0.901084, 1.67296e-012, },
-	{ -0.108099, -0.14926, -0.179352, -0.554528, -0.832165, 1.54501e-012, },
-	{ -0.0930377, -0.157813, -0.179352, -0.433645, -0.901084, 1.67296e-012, },
-	{ -0.108099, -0.14926, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.10077, -0.129935, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0930377, -0.157813, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0930377, -0.157813, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.10077, -0.129935, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0782309, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.10077, -0.129935, -0.149352, 0.609765, 0.792582, -1.47152e-012, },
-	{ -0.0782309, -0.142607, -0.179352, 0.379664, 0.925125, -1.7176e-012, },
-	{ -0.10077, -0.129935, -0.179352, 0.609765, 0.792582, -1.47152e-012, },
-	{ -0.0782309, -0.142607, -0.179352, 0.379664, 0.925125, -1.7176e-012, },
-	{ -0.10077, -0.129935, -0.149352, 0.609765, 0.792582, -1.47152e-012, },
-	{ -0.0782309, -0.142607, -0.149352, 0.379664, 0.925125, -1.7176e-012, },
-	{ -0.10077, -0.129935, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0930377, -0.157813, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0782309, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.10077, -0.129935, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.108099, -0.14926, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0930377, -0.157813, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.118022, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.108099, -0.14926, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.10077, -0.129935, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.118022, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.121594, -0.138806, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.108099, -0.14926, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.118022, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.133522, -0.126451, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.121594, -0.138806, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.133522, -0.126451, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.118022, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.143884, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0782309, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0930377, -0.157813, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.07641, -0.164466, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0930377, -0.157813, -0.179352, -0.433645, -0.901084, 1.67296e-012, },
-	{ -0.07641, -0.164466, -0.149352, -0.312692, -0.949855, 1.76351e-012, },
-	{ -0.0930377, -0.157813, -0.149352, -0.433645, -0.901084, 1.67296e-012, },
-	{ -0.07641, -0.164466, -0.149352, -0.312692, -0.949855, 1.76351e-012, },
-	{ -0.0930377, -0.157813, -0.179352, -0.433645, -0.901084, 1.67296e-012, },
-	{ -0.07641, -0.164466, -0.179352, -0.312692, -0.949855, 1.76351e-012, },
-	{ -0.0930377, -0.157813, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0782309, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.07641, -0.164466, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.07641, -0.164466, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0782309, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0504032, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0782309, -0.142607, -0.149352, 0.379664, 0.925125, -1.7176e-012, },
-	{ -0.0504032, -0.15021, -0.179352, 0.170704, 0.985322, -1.82936e-012, },
-	{ -0.0782309, -0.142607, -0.179352, 0.379664, 0.925125, -1.7176e-012, },
-	{ -0.0504032, -0.15021, -0.179352, 0.170704, 0.985322, -1.82936e-012, },
-	{ -0.0782309, -0.142607, -0.149352, 0.379664, 0.925125, -1.7176e-012, },
-	{ -0.0504032, -0.15021, -0.149352, 0.170704, 0.985322, -1.82936e-012, },
-	{ -0.0782309, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.07641, -0.164466, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0504032, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0504032, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.07641, -0.164466, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0582157, -0.169217, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.07641, -0.164466, -0.179352, -0.312692, -0.949855, 1.76351e-012, },
-	{ -0.0582157, -0.169217, -0.149352, -0.198062, -0.98019, 1.81983e-012, },
-	{ -0.07641, -0.164466, -0.149352, -0.312692, -0.949855, 1.76351e-012, },
-	{ -0.0582157, -0.169217, -0.149352, -0.198062, -0.98019, 1.81983e-012, },
-	{ -0.07641, -0.164466, -0.179352, -0.312692, -0.949855, 1.76351e-012, },
-	{ -0.0582157, -0.169217, -0.179352, -0.198062, -0.98019, 1.81983e-012, },
-	{ -0.07641, -0.164466, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0504032, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0582157, -0.169217, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0582157, -0.169217, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0504032, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.038455, -0.172069, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.038455, -0.172069, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0504032, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0172874, -0.152744, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0504032, -0.15021, -0.149352, 0.170704, 0.985322, -1.82936e-012, },
-	{ -0.0172874, -0.152744, -0.179352, 8.00648e-005, 1, -1.85661e-012, },
-	{ -0.0504032, -0.15021, -0.179352, 0.170704, 0.985322, -1.82936e-012, },
-	{ -0.0172874, -0.152744, -0.179352, 8.00648e-005, 1, -1.85661e-012, },
-	{ -0.0504032, -0.15021, -0.149352, 0.170704, 0.985322, -1.82936e-012, },
-	{ -0.0172874, -0.152744, -0.149352, 8.00648e-005, 1, -1.85661e-012, },
-	{ -0.0504032, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.038455, -0.172069, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0172874, -0.152744, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0504032, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0582157, -0.169217, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.038455, -0.172069, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0582157, -0.169217, -0.179352, -0.198062, -0.98019, 1.81983e-012, },
-	{ -0.038455, -0.172069, -0.149352, -0.0937744, -0.995593, 1.84843e-012, },
-	{ -0.0582157, -0.169217, -0.149352, -0.198062, -0.98019, 1.81983e-012, },
-	{ -0.038455, -0.172069, -0.149352, -0.0937744, -0.995593, 1.84843e-012, },
-	{ -0.0582157, -0.169217, -0.179352, -0.198062, -0.98019, 1.81983e-012, },
-	{ -0.038455, -0.172069, -0.179352, -0.0937744, -0.995593, 1.84843e-012, },
-	{ -0.038455, -0.172069, -0.179352, -0.0937744, -0.995593, 1.84843e-012, },
-	{ -0.0171278, -0.173019, -0.149352, 3.90799e-005, -1, 1.85661e-012, },
-	{ -0.038455, -0.172069, -0.149352, -0.0937744, -0.995593, 1.84843e-012, },
-	{ -0.0171278, -0.173019, -0.149352, 3.90799e-005, -1, 1.85661e-012, },
-	{ -0.038455, -0.172069, -0.179352, -0.0937744, -0.995593, 1.84843e-012, },
-	{ -0.0171278, -0.173019, -0.179352, 3.90799e-005, -1, 1.85661e-012, },
-	{ -0.038455, -0.172069, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0172874, -0.152744, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0171278, -0.173019, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0171278, -0.173019, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0172874, -0.152744, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0158982, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0172874, -0.152744, -0.149352, 8.00648e-005, 1, -1.85661e-012, },
-	{ 0.0158982, -0.15021, -0.179352, -0.1704, 0.985375, -1.82946e-012, },
-	{ -0.0172874, -0.152744, -0.179352, 8.00648e-005, 1, -1.85661e-012, },
-	{ 0.0158982, -0.15021, -0.179352, -0.1704, 0.985375, -1.82946e-012, },
-	{ -0.0172874, -0.152744, -0.149352, 8.00648e-005, 1, -1.85661e-012, },
-	{ 0.0158982, -0.15021, -0.149352, -0.1704, 0.985375, -1.82946e-012, },
-	{ -0.0172874, -0.152744, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0171278, -0.173019, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0158982, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0172874, -0.152744, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.038455, -0.172069, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0171278, -0.173019, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0158982, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0171278, -0.173019, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.00416204, -0.172069, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0171278, -0.173019, -0.179352, 3.90799e-005, -1, 1.85661e-012, },
-	{ 0.00416204, -0.172069, -0.149352, 0.093929, -0.995579, 1.8484e-012, },
-	{ -0.0171278, -0.173019, -0.149352, 3.90799e-005, -1, 1.85661e-012, },
-	{ 0.00416204, -0.172069, -0.149352, 0.093929, -0.995579, 1.8484e-012, },
-	{ -0.0171278, -0.173019, -0.179352, 3.90799e-005, -1, 1.85661e-012, },
-	{ 0.00416204, -0.172069, -0.179352, 0.093929, -0.995579, 1.8484e-012, },
-	{ -0.0171278, -0.173019, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0158982, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.00416204, -0.172069, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.00416204, -0.172069, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0158982, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0238903, -0.169217, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0238903, -0.169217, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0158982, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0437758, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0158982, -0.15021, -0.149352, -0.1704, 0.985375, -1.82946e-012, },
-	{ 0.0437758, -0.142607, -0.179352, -0.379191, 0.925318, -1.71796e-012, },
-	{ 0.0158982, -0.15021, -0.179352, -0.1704, 0.985375, -1.82946e-012, },
-	{ 0.0437758, -0.142607, -0.179352, -0.379191, 0.925318, -1.71796e-012, },
-	{ 0.0158982, -0.15021, -0.149352, -0.1704, 0.985375, -1.82946e-012, },
-	{ 0.0437758, -0.142607, -0.149352, -0.379191, 0.925318, -1.71796e-012, },
-	{ 0.0158982, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0238903, -0.169217, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0437758, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0158982, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.00416204, -0.172069, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0238903, -0.169217, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.00416204, -0.172069, -0.179352, 0.093929, -0.995579, 1.8484e-012, },
-	{ 0.0238903, -0.169217, -0.149352, 0.198356, -0.98013, 1.81972e-012, },
-	{ 0.00416204, -0.172069, -0.149352, 0.093929, -0.995579, 1.8484e-012, },
-	{ 0.0238903, -0.169217, -0.149352, 0.198356, -0.98013, 1.81972e-012, },
-	{ 0.00416204, -0.172069, -0.179352, 0.093929, -0.995579, 1.8484e-012, },
-	{ 0.0238903, -0.169217, -0.179352, 0.198356, -0.98013, 1.81972e-012, },
-	{ 0.0238903, -0.169217, -0.179352, 0.198356, -0.98013, 1.81972e-012, },
-	{ 0.0420572, -0.164466, -0.149352, 0.313088, -0.949724, 1.76327e-012, },
-	{ 0.0238903, -0.169217, -0.149352, 0.198356, -0.98013, 1.81972e-012, },
-	{ 0.0420572, -0.164466, -0.149352, 0.313088, -0.949724, 1.76327e-012, },
-	{ 0.0238903, -0.169217, -0.179352, 0.198356, -0.98013, 1.81972e-012, },
-	{ 0.0420572, -0.164466, -0.179352, 0.313088, -0.949724, 1.76327e-012, },
-	{ 0.0238903, -0.169217, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0437758, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0420572, -0.164466, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0420572, -0.164466, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0437758, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0586625, -0.157813, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0586625, -0.157813, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0437758, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0663452, -0.129935, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0437758, -0.142607, -0.149352, -0.379191, 0.925318, -1.71796e-012, },
-	{ 0.0663452, -0.129935, -0.179352, -0.609426, 0.792843, -1.472e-012, },
-	{ 0.0437758, -0.142607, -0.179352, -0.379191, 0.925318, -1.71796e-012, },
-	{ 0.0663452, -0.129935, -0.179352, -0.609426, 0.792843, -1.472e-012, },
-	{ 0.0437758, -0.142607, -0.149352, -0.379191, 0.925318, -1.71796e-012, },
-	{ 0.0663452, -0.129935, -0.149352, -0.609426, 0.792843, -1.472e-012, },
-	{ 0.0437758, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0586625, -0.157813, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0663452, -0.129935, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0437758, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0420572, -0.164466, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0586625, -0.157813, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0437758, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0238903, -0.169217, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0420572, -0.164466, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0420572, -0.164466, -0.179352, 0.313088, -0.949724, 1.76327e-012, },
-	{ 0.0586625, -0.157813, -0.149352, 0.43408, -0.900874, 1.67257e-012, },
-	{ 0.0420572, -0.164466, -0.149352, 0.313088, -0.949724, 1.76327e-012, },
-	{ 0.0586625, -0.157813, -0.149352, 0.43408, -0.900874, 1.67257e-012, },
-	{ 0.0420572, -0.164466, -0.179352, 0.313088, -0.949724, 1.76327e-012, },
-	{ 0.0586625, -0.157813, -0.179352, 0.43408, -0.900874, 1.67257e-012, },
-	{ 0.0586625, -0.157813, -0.179352, 0.43408, -0.900874, 1.67257e-012, },
-	{ 0.0737063, -0.14926, -0.149352, 0.554922, -0.831902, 1.54452e-012, },
-	{ 0.0586625, -0.157813, -0.149352, 0.43408, -0.900874, 1.67257e-012, },
-	{ 0.0737063, -0.14926, -0.149352, 0.554922, -0.831902, 1.54452e-012, },
-	{ 0.0586625, -0.157813, -0.179352, 0.43408, -0.900874, 1.67257e-012, },
-	{ 0.0737063, -0.14926, -0.179352, 0.554922, -0.831902, 1.54452e-012, },
-	{ 0.0586625, -0.157813, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0663452, -0.129935, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0737063, -0.14926, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0737063, -0.14926, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0663452, -0.129935, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0836066, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0663452, -0.129935, -0.179352, -0.609426, 0.792843, -1.472e-012, },
-	{ 0.0836066, -0.112195, -0.149352, -0.716715, 0.697366, -1.29474e-012, },
-	{ 0.0836066, -0.112195, -0.179352, -0.716715, 0.697366, -1.29474e-012, },
-	{ 0.0836066, -0.112195, -0.149352, -0.716715, 0.697366, -1.29474e-012, },
-	{ 0.0663452, -0.129935, -0.179352, -0.609426, 0.792843, -1.472e-012, },
-	{ 0.0663452, -0.129935, -0.149352, -0.609426, 0.792843, -1.472e-012, },
-	{ 0.0663452, -0.129935, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0737063, -0.14926, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0836066, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0663452, -0.129935, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0586625, -0.157813, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0737063, -0.14926, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0836066, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0737063, -0.14926, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0871886, -0.138806, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0737063, -0.14926, -0.179352, 0.554922, -0.831902, 1.54452e-012, },
-	{ 0.0871886, -0.138806, -0.149352, 0.667924, -0.74423, 1.38175e-012, },
-	{ 0.0737063, -0.14926, -0.149352, 0.554922, -0.831902, 1.54452e-012, },
-	{ 0.0871886, -0.138806, -0.149352, 0.667924, -0.74423, 1.38175e-012, },
-	{ 0.0737063, -0.14926, -0.179352, 0.554922, -0.831902, 1.54452e-012, },
-	{ 0.0871886, -0.138806, -0.179352, 0.667924, -0.74423, 1.38175e-012, },
-	{ 0.0737063, -0.14926, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0836066, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0871886, -0.138806, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0871886, -0.138806, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0836066, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.109469, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0836066, -0.112195, -0.149352, 0, 1, -1.85661e-012, },
-	{ 0.109469, -0.112195, -0.179352, 0, 1, -1.85661e-012, },
-	{ 0.0836066, -0.112195, -0.179352, 0, 1, -1.85661e-012, },
-	{ 0.109469, -0.112195, -0.179352, 0, 1, -1.85661e-012, },
-	{ 0.0836066, -0.112195, -0.149352, 0, 1, -1.85661e-012, },
-	{ 0.109469, -0.112195, -0.149352, 0, 1, -1.85661e-012, },
-	{ 0.0836066, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0871886, -0.138806, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.109469, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.109469, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0871886, -0.138806, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0991094, -0.126451, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0871886, -0.138806, -0.149352, 0.667924, -0.74423, 1.38175e-012, },
-	{ 0.0991094, -0.126451, -0.179352, 0.766151, -0.642661, 1.19317e-012, },
-	{ 0.0991094, -0.126451, -0.149352, 0.766151, -0.642661, 1.19317e-012, },
-	{ 0.0991094, -0.126451, -0.179352, 0.766151, -0.642661, 1.19317e-012, },
-	{ 0.0871886, -0.138806, -0.149352, 0.667924, -0.74423, 1.38175e-012, },
-	{ 0.0871886, -0.138806, -0.179352, 0.667924, -0.74423, 1.38175e-012, },
-	{ 0.0871886, -0.138806, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.109469, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0991094, -0.126451, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.109469, -0.112195, -0.179352, 0.808963, -0.58786, 1.09143e-012, },
-	{ 0.0991094, -0.126451, -0.149352, 0.766151, -0.642661, 1.19317e-012, },
-	{ 0.0991094, -0.126451, -0.179352, 0.766151, -0.642661, 1.19317e-012, },
-	{ 0.0991094, -0.126451, -0.149352, 0.766151, -0.642661, 1.19317e-012, },
-	{ 0.109469, -0.112195, -0.179352, 0.808963, -0.58786, 1.09143e-012, },
-	{ 0.109469, -0.112195, -0.149352, 0.808963, -0.58786, 1.09143e-012, },
-	{ 0.0574252, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0274125, 0.0509594, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0274125, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0274125, 0.0509594, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0574252, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.041461, 0.0509594, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.041461, 0.0509594, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0574252, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0539031, 0.0496224, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0539031, 0.0496224, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0574252, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0574252, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0574252, 0.142913, -0.179352, 1, 0, -0, },
-	{ 0.0574252, 0.075704, -0.149352, 1, 0, -0, },
-	{ 0.0574252, 0.075704, -0.179352, 1, 0, -0, },
-	{ 0.0574252, 0.075704, -0.149352, 1, 0, -0, },
-	{ 0.0574252, 0.142913, -0.179352, 1, 0, -0, },
-	{ 0.0574252, 0.142913, -0.149352, 1, 0, -0, },
-	{ 0.0574252, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
-	{ 0.0274125, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
-	{ 0.0574252, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
-	{ 0.0274125, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
-	{ 0.0574252, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
-	{ 0.0274125, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
-	{ 0.0274125, 0.0509594, -0.179352, -1, 0, -0, },
-	{ 0.0274125, 0.142913, -0.149352, -1, 0, -0, },
-	{ 0.0274125, 0.142913, -0.179352, -1, 0, -0, },
-	{ 0.0274125, 0.142913, -0.149352, -1, 0, -0, },
-	{ 0.0274125, 0.0509594, -0.179352, -1, 0, -0, },
-	{ 0.0274125, 0.0509594, -0.149352, -1, 0, -0, },
-	{ 0.0274125, 0.0509594, -0.179352, 0, -1, 1.85661e-012, },
-	{ 0.041461, 0.0509594, -0.149352, -0.053498, -0.998568, 1.85395e-012, },
-	{ 0.0274125, 0.0509594, -0.149352, 0, -1, 1.85661e-012, },
-	{ 0.041461, 0.0509594, -0.149352, -0.053498, -0.998568, 1.85395e-012, },
-	{ 0.0274125, 0.0509594, -0.179352, 0, -1, 1.85661e-012, },
-	{ 0.041461, 0.0509594, -0.179352, -0.053498, -0.998568, 1.85395e-012, },
-	{ 0.041461, 0.0509594, -0.179352, -0.053498, -0.998568, 1.85395e-012, },
-	{ 0.0539031, 0.0496224, -0.149352, -0.228889, -0.973452, 1.80732e-012, },
-	{ 0.041461, 0.0509594, -0.149352, -0.053498, -0.998568, 1.85395e-012, },
-	{ 0.0539031, 0.0496224, -0.149352, -0.228889, -0.973452, 1.80732e-012, },
-	{ 0.041461, 0.0509594, -0.179352, -0.053498, -0.998568, 1.85395e-012, },
-	{ 0.0539031, 0.0496224, -0.179352, -0.228889, -0.973452, 1.80732e-012, },
-	{ 0.0539031, 0.0496224, -0.179352, -0.228889, -0.973452, 1.80732e-012, },
-	{ 0.0647289, 0.0456114, -0.149352, -0.471825, -0.881692, 1.63696e-012, },
-	{ 0.0539031, 0.0496224, -0.149352, -0.228889, -0.973452, 1.80732e-012, },
-	{ 0.0647289, 0.0456114, -0.149352, -0.471825, -0.881692, 1.63696e-012, },
-	{ 0.0539031, 0.0496224, -0.179352, -0.228889, -0.973452, 1.80732e-012, },
-	{ 0.0647289, 0.0456114, -0.179352, -0.471825, -0.881692, 1.63696e-012, },
-	{ 0.0539031, 0.0496224, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0574252, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0647289, 0.0456114, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0647289, 0.0456114, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0574252, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0725713, 0.0717329, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0574252, 0.075704, -0.149352, 0.253615, 0.967305, -1.79591e-012, },
-	{ 0.0725713, 0.0717329, -0.179352, 0.346952, 0.937883, -1.74128e-012, },
-	{ 0.0574252, 0.075704, -0.179352, 0.253615, 0.967305, -1.79591e-012, },
-	{ 0.0725713, 0.0717329, -0.179352, 0.346952, 0.937883, -1.74128e-012, },
-	{ 0.0574252, 0.075704, -0.149352, 0.253615, 0.967305, -1.79591e-012, },
-	{ 0.0725713, 0.0717329, -0.149352, 0.346952, 0.937883, -1.74128e-012, },
-	{ 0.0574252, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0647289, 0.0456114, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0725713, 0.0717329, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0647289, 0.0456114, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0574252, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0539031, 0.0496224, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0574252, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0539031, 0.0496224, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0574252, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0574252, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.041461, 0.0509594, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0539031, 0.0496224, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0274125, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.041461, 0.0509594, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0574252, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.041461, 0.0509594, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0274125, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0274125, 0.0509594, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0725713, 0.0717329, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0647289, 0.0456114, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0739382, 0.0389264, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0647289, 0.0456114, -0.179352, -0.471825, -0.881692, 1.63696e-012, },
-	{ 0.0739382, 0.0389264, -0.149352, -0.687868, -0.725835, 1.34759e-012, },
-	{ 0.0647289, 0.0456114, -0.149352, -0.471825, -0.881692, 1.63696e-012, },
-	{ 0.0739382, 0.0389264, -0.149352, -0.687868, -0.725835, 1.34759e-012, },
-	{ 0.0647289, 0.0456114, -0.179352, -0.471825, -0.881692, 1.63696e-012, },
-	{ 0.0739382, 0.0389264, -0.179352, -0.687868, -0.725835, 1.34759e-012, },
-	{ 0.0647289, 0.0456114, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0725713, 0.0717329, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0739382, 0.0389264, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0739382, 0.0389264, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0725713, 0.0717329, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0859214, 0.0652474, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0725713, 0.0717329, -0.149352, 0.346952, 0.937883, -1.74128e-012, },
-	{ 0.0859214, 0.0652474, -0.179352, 0.528635, 0.848849, -1.57598e-012, },
-	{ 0.0725713, 0.0717329, -0.179352, 0.346952, 0.937883, -1.74128e-012, },
-	{ 0.0859214, 0.0652474, -0.179352, 0.528635, 0.848849, -1.57598e-012, },
-	{ 0.0725713, 0.0717329, -0.149352, 0.346952, 0.937883, -1.74128e-012, },
-	{ 0.0859214, 0.0652474, -0.149352, 0.528635, 0.848849, -1.57598e-012, },
-	{ 0.0725713, 0.0717329, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0739382, 0.0389264, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0859214, 0.0652474, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0859214, 0.0652474, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0739382, 0.0389264, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0815312, 0.0295673, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0739382, 0.0389264, -0.149352, -0.687868, -0.725835, 1.34759e-012, },
-	{ 0.0815312, 0.0295673, -0.179352, -0.858036, -0.51359, 9.53537e-013, },
-	{ 0.0815312, 0.0295673, -0.149352, -0.858036, -0.51359, 9.53537e-013, },
-	{ 0.0815312, 0.0295673, -0.179352, -0.858036, -0.51359, 9.53537e-013, },
-	{ 0.0739382, 0.0389264, -0.149352, -0.687868, -0.725835, 1.34759e-012, },
-	{ 0.0739382, 0.0389264, -0.179352, -0.687868, -0.725835, 1.34759e-012, },
-	{ 0.0739382, 0.0389264, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0859214, 0.0652474, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0815312, 0.0295673, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0815312, 0.0295673, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0859214, 0.0652474, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0901519, 0.00901337, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0901519, 0.00901337, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0859214, 0.0652474, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0974755, 0.0562476, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0859214, 0.0652474, -0.149352, 0.528635, 0.848849, -1.57598e-012, },
-	{ 0.0974755, 0.0562476, -0.179352, 0.692365, 0.721547, -1.33963e-012, },
-	{ 0.0859214, 0.0652474, -0.179352, 0.528635, 0.848849, -1.57598e-012, },
-	{ 0.0974755, 0.0562476, -0.179352, 0.692365, 0.721547, -1.33963e-012, },
-	{ 0.0859214, 0.0652474, -0.149352, 0.528635, 0.848849, -1.57598e-012, },
-	{ 0.0974755, 0.0562476, -0.149352, 0.692365, 0.721547, -1.33963e-012, },
-	{ 0.0859214, 0.0652474, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0901519, 0.00901337, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0974755, 0.0562476, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0859214, 0.0652474, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0815312, 0.0295673, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0901519, 0.00901337, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0815312, 0.0295673, -0.149352, -0.858036, -0.51359, 9.53537e-013, },
-	{ 0.0901519, 0.00901337, -0.179352, -0.967791, -0.251756, 4.67413e-013, },
-	{ 0.0901519, 0.00901337, -0.149352, -0.967791, -0.251756, 4.67413e-013, },
-	{ 0.0901519, 0.00901337, -0.179352, -0.967791, -0.251756, 4.67413e-013, },
-	{ 0.0815312, 0.0295673, -0.149352, -0.858036, -0.51359, 9.53537e-013, },
-	{ 0.0815312, 0.0295673, -0.179352, -0.858036, -0.51359, 9.53537e-013, },
-	{ 0.0930255, -0.0165693, -0.179352, -0.999998, -0.00195883, 3.63678e-015, },
-	{ 0.0901519, 0.00901337, -0.149352, -0.967791, -0.251756, 4.67413e-013, },
-	{ 0.0901519, 0.00901337, -0.179352, -0.967791, -0.251756, 4.67413e-013, },
-	{ 0.0901519, 0.00901337, -0.149352, -0.967791, -0.251756, 4.67413e-013, },
-	{ 0.0930255, -0.0165693, -0.179352, -0.999998, -0.00195883, 3.63678e-015, },
-	{ 0.0930255, -0.0165693, -0.149352, -0.999998, -0.00195883, 3.63678e-015, },
-	{ 0.0902317, -0.0423516, -0.179352, -0.968748, 0.248046, -4.60525e-013, },
-	{ 0.0930255, -0.0165693, -0.149352, -0.999998, -0.00195883, 3.63678e-015, },
-	{ 0.0930255, -0.0165693, -0.179352, -0.999998, -0.00195883, 3.63678e-015, },
-	{ 0.0930255, -0.0165693, -0.149352, -0.999998, -0.00195883, 3.63678e-015, },
-	{ 0.0902317, -0.0423516, -0.179352, -0.968748, 0.248046, -4.60525e-013, },
-	{ 0.0902317, -0.0423516, -0.149352, -0.968748, 0.248046, -4.60525e-013, },
-	{ 0.0902317, -0.0423516, -0.179352, -0.968748, 0.248046, -4.60525e-013, },
-	{ 0.0818505, -0.0625463, -0.149352, -0.856809, 0.515634, -9.57333e-013, },
-	{ 0.0902317, -0.0423516, -0.149352, -0.968748, 0.248046, -4.60525e-013, },
-	{ 0.0818505, -0.0625463, -0.149352, -0.856809, 0.515634, -9.57333e-013, },
-	{ 0.0902317, -0.0423516, -0.179352, -0.968748, 0.248046, -4.60525e-013, },
-	{ 0.0818505, -0.0625463, -0.179352, -0.856809, 0.515634, -9.57333e-013, },
-	{ 0.0924667, -0.094395, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0818505, -0.0625463, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0902317, -0.0423516, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0778595, -0.102776, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0818505, -0.0625463, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0924667, -0.094395, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0778595, -0.102776, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0742974, -0.0716958, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0818505, -0.0625463, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0778595, -0.102776, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0650482, -0.0782312, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0742974, -0.0716958, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0606979, -0.107805, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0650482, -0.0782312, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0778595, -0.102776, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0606979, -0.107805, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0541027, -0.0821524, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0650482, -0.0782312, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0606979, -0.107805, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.041461, -0.0834595, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0541027, -0.0821524, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0409821, -0.109481, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.041461, -0.0834595, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0606979, -0.107805, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0409821, -0.109481, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0276519, -0.0821025, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.041461, -0.0834595, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0166366, -0.105969, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0276519, -0.0821025, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0409821, -0.109481, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0166366, -0.105969, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0144814, -0.0780317, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0276519, -0.0821025, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0166366, -0.105969, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.00194949, -0.0712468, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0144814, -0.0780317, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0166366, -0.105969, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.00994386, -0.0617481, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.00194949, -0.0712468, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0116999, -0.0954327, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.00994386, -0.0617481, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0166366, -0.105969, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.00994386, -0.0617481, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0116999, -0.0954327, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0116999, -0.0617481, -0.179352, 0, -1.85661e-012, -1, },
-	{ -0.0116999, -0.0954327, -0.149352, -1, 0, -0, },
-	{ -0.0116999, -0.0617481, -0.179352, -1, 0, -0, },
-	{ -0.0116999, -0.0954327, -0.179352, -1, 0, -0, },
-	{ -0.0116999, -0.0617481, -0.179352, -1, 0, -0, },
-	{ -0.0116999, -0.0954327, -0.149352, -1, 0, -0, },
-	{ -0.0116999, -0.0617481, -0.149352, -1, 0, -0, },
-	{ 0.0166366, -0.105969, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0116999, -0.0617481, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0116999, -0.0954327, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.0116999, -0.0617481, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0166366, -0.105969, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.00994386, -0.0617481, -0.149352, 0, 1.85661e-012, 1, },
-	{ -0.00994386, -0.0617481, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0166366, -0.105969, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.00194949, -0.0712468, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.00194949, -0.0712468, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0166366, -0.105969, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0144814, -0.0780317, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0144814, -0.0780317, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0166366, -0.105969, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0276519, -0.0821025, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0276519, -0.0821025, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0166366, -0.105969, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0409821, -0.109481, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0166366, -0.105969, -0.179352, -0.247047, -0.969003, 1.79906e-012, },
-	{ 0.0409821, -0.109481, -0.149352, -0.0292246, -0.999573, 1.85582e-012, },
-	{ 0.0166366, -0.105969, -0.149352, -0.247047, -0.969003, 1.79906e-012, },
-	{ 0.0409821, -0.109481, -0.149352, -0.0292246, -0.999573, 1.85582e-012, },
-	{ 0.0166366, -0.105969, -0.179352, -0.247047, -0.969003, 1.79906e-012, },
-	{ 0.0409821, -0.109481, -0.179352, -0.0292246, -0.999573, 1.85582e-012, },
-	{ 0.0409821, -0.109481, -0.179352, -0.0292246, -0.999573, 1.85582e-012, },
-	{ 0.0606979, -0.107805, -0.149352, 0.183878, -0.982949, 1.82496e-012, },
-	{ 0.0409821, -0.109481, -0.149352, -0.0292246, -0.999573, 1.85582e-012, },
-	{ 0.0606979, -0.107805, -0.149352, 0.183878, -0.982949, 1.82496e-012, },
-	{ 0.0409821, -0.109481, -0.179352, -0.0292246, -0.999573, 1.85582e-012, },
-	{ 0.0606979, -0.107805, -0.179352, 0.183878, -0.982949, 1.82496e-012, },
-	{ 0.0606979, -0.107805, -0.179352, 0.183878, -0.982949, 1.82496e-012, },
-	{ 0.0778595, -0.102776, -0.149352, 0.392158, -0.919898, 1.70789e-012, },
-	{ 0.0606979, -0.107805, -0.149352, 0.183878, -0.982949, 1.82496e-012, },
-	{ 0.0778595, -0.102776, -0.149352, 0.392158, -0.919898, 1.70789e-012, },
-	{ 0.0606979, -0.107805, -0.179352, 0.183878, -0.982949, 1.82496e-012, },
-	{ 0.0778595, -0.102776, -0.179352, 0.392158, -0.919898, 1.70789e-012, },
-	{ 0.0778595, -0.102776, -0.179352, 0.392158, -0.919898, 1.70789e-012, },
-	{ 0.0924667, -0.094395, -0.149352, 0.602351, -0.798231, 1.48201e-012, },
-	{ 0.0778595, -0.102776, -0.149352, 0.392158, -0.919898, 1.70789e-012, },
-	{ 0.0924667, -0.094395, -0.149352, 0.602351, -0.798231, 1.48201e-012, },
-	{ 0.0778595, -0.102776, -0.179352, 0.392158, -0.919898, 1.70789e-012, },
-	{ 0.0924667, -0.094395, -0.179352, 0.602351, -0.798231, 1.48201e-012, },
-	{ 0.0924667, -0.094395, -0.179352, 0.602351, -0.798231, 1.48201e-012, },
-	{ 0.10452, -0.0826613, -0.149352, 0.772924, -0.634498, 1.17802e-012, },
-	{ 0.0924667, -0.094395, -0.149352, 0.602351, -0.798231, 1.48201e-012, },
-	{ 0.10452, -0.0826613, -0.149352, 0.772924, -0.634498, 1.17802e-012, },
-	{ 0.0924667, -0.094395, -0.179352, 0.602351, -0.798231, 1.48201e-012, },
-	{ 0.10452, -0.0826613, -0.179352, 0.772924, -0.634498, 1.17802e-012, },
-	{ 0.0924667, -0.094395, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0930255, -0.0165693, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.10452, -0.0826613, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0924667, -0.094395, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0902317, -0.0423516, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0930255, -0.0165693, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.10452, -0.0826613, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0930255, -0.0165693, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0974755, 0.0562476, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0901519, 0.00901337, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0974755, 0.0562476, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0930255, -0.0165693, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.10452, -0.0826613, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0974755, 0.0562476, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.107234, 0.0447334, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.0974755, 0.0562476, -0.179352, 0.692365, 0.721547, -1.33963e-012, },
-	{ 0.107234, 0.0447334, -0.149352, 0.819356, 0.573286, -1.06437e-012, },
-	{ 0.107234, 0.0447334, -0.179352, 0.819356, 0.573286, -1.06437e-012, },
-	{ 0.107234, 0.0447334, -0.149352, 0.819356, 0.573286, -1.06437e-012, },
-	{ 0.0974755, 0.0562476, -0.179352, 0.692365, 0.721547, -1.33963e-012, },
-	{ 0.0974755, 0.0562476, -0.149352, 0.692365, 0.721547, -1.33963e-012, },
-	{ 0.0974755, 0.0562476, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.10452, -0.0826613, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.107234, 0.0447334, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0930255, -0.0165693, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.10452, -0.0826613, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0974755, 0.0562476, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0930255, -0.0165693, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0924667, -0.094395, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.10452, -0.0826613, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0902317, -0.0423516, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0924667, -0.094395, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0930255, -0.0165693, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0818505, -0.0625463, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0924667, -0.094395, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0902317, -0.0423516, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0818505, -0.0625463, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0778595, -0.102776, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0924667, -0.094395, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0742974, -0.0716958, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0778595, -0.102776, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0818505, -0.0625463, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0650482, -0.0782312, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0778595, -0.102776, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0742974, -0.0716958, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0650482, -0.0782312, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0606979, -0.107805, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0778595, -0.102776, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0541027, -0.0821524, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0606979, -0.107805, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0650482, -0.0782312, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.041461, -0.0834595, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0606979, -0.107805, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0541027, -0.0821524, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.041461, -0.0834595, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0409821, -0.109481, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0606979, -0.107805, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0276519, -0.0821025, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0409821, -0.109481, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.041461, -0.0834595, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.041461, -0.0834595, -0.149352, -0.00253816, 0.999997, -1.85661e-012, },
-	{ 0.0276519, -0.0821025, -0.179352, 0.197556, 0.980292, -1.82002e-012, },
-	{ 0.0276519, -0.0821025, -0.149352, 0.197556, 0.980292, -1.82002e-012, },
-	{ 0.0276519, -0.0821025, -0.179352, 0.197556, 0.980292, -1.82002e-012, },
-	{ 0.041461, -0.0834595, -0.149352, -0.00253816, 0.999997, -1.85661e-012, },
-	{ 0.041461, -0.0834595, -0.179352, -0.00253816, 0.999997, -1.85661e-012, },
-	{ 0.041461, -0.0834595, -0.149352, -0.00253816, 0.999997, -1.85661e-012, },
-	{ 0.0541027, -0.0821524, -0.179352, -0.22166, 0.975124, -1.81043e-012, },
-	{ 0.041461, -0.0834595, -0.179352, -0.00253816, 0.999997, -1.85661e-012, },
-	{ 0.0541027, -0.0821524, -0.179352, -0.22166, 0.975124, -1.81043e-012, },
-	{ 0.041461, -0.0834595, -0.149352, -0.00253816, 0.999997, -1.85661e-012, },
-	{ 0.0541027, -0.0821524, -0.149352, -0.22166, 0.975124, -1.81043e-012, },
-	{ 0.0541027, -0.0821524, -0.149352, -0.22166, 0.975124, -1.81043e-012, },
-	{ 0.0650482, -0.0782312, -0.179352, -0.461395, 0.887195, -1.64718e-012, },
-	{ 0.0541027, -0.0821524, -0.179352, -0.22166, 0.975124, -1.81043e-012, },
-	{ 0.0650482, -0.0782312, -0.179352, -0.461395, 0.887195, -1.64718e-012, },
-	{ 0.0541027, -0.0821524, -0.149352, -0.22166, 0.975124, -1.81043e-012, },
-	{ 0.0650482, -0.0782312, -0.149352, -0.461395, 0.887195, -1.64718e-012, },
-	{ 0.0650482, -0.0782312, -0.149352, -0.461395, 0.887195, -1.64718e-012, },
-	{ 0.0742974, -0.0716958, -0.179352, -0.680107, 0.733113, -1.36111e-012, },
-	{ 0.0650482, -0.0782312, -0.179352, -0.461395, 0.887195, -1.64718e-012, },
-	{ 0.0742974, -0.0716958, -0.179352, -0.680107, 0.733113, -1.36111e-012, },
-	{ 0.0650482, -0.0782312, -0.149352, -0.461395, 0.887195, -1.64718e-012, },
-	{ 0.0742974, -0.0716958, -0.149352, -0.680107, 0.733113, -1.36111e-012, },
-	{ 0.0742974, -0.0716958, -0.149352, -0.680107, 0.733113, -1.36111e-012, },
-	{ 0.0818505, -0.0625463, -0.179352, -0.856809, 0.515634, -9.57333e-013, },
-	{ 0.0742974, -0.0716958, -0.179352, -0.680107, 0.733113, -1.36111e-012, },
-	{ 0.0818505, -0.0625463, -0.179352, -0.856809, 0.515634, -9.57333e-013, },
-	{ 0.0742974, -0.0716958, -0.149352, -0.680107, 0.733113, -1.36111e-012, },
-	{ 0.0818505, -0.0625463, -0.149352, -0.856809, 0.515634, -9.57333e-013, },
-	{ 0.0276519, -0.0821025, -0.179352, 0.197556, 0.980292, -1.82002e-012, },
-	{ 0.0144814, -0.0780317, -0.149352, 0.387572, 0.921839, -1.7115e-012, },
-	{ 0.0276519, -0.0821025, -0.149352, 0.197556, 0.980292, -1.82002e-012, },
-	{ 0.0144814, -0.0780317, -0.149352, 0.387572, 0.921839, -1.7115e-012, },
-	{ 0.0276519, -0.0821025, -0.179352, 0.197556, 0.980292, -1.82002e-012, },
-	{ 0.0144814, -0.0780317, -0.179352, 0.387572, 0.921839, -1.7115e-012, },
-	{ 0.0144814, -0.0780317, -0.179352, 0.387572, 0.921839, -1.7115e-012, },
-	{ 0.00194949, -0.0712468, -0.149352, 0.552258, 0.833674, -1.54781e-012, },
-	{ 0.0144814, -0.0780317, -0.149352, 0.387572, 0.921839, -1.7115e-012, },
-	{ 0.00194949, -0.0712468, -0.149352, 0.552258, 0.833674, -1.54781e-012, },
-	{ 0.0144814, -0.0780317, -0.179352, 0.387572, 0.921839, -1.7115e-012, },
-	{ 0.00194949, -0.0712468, -0.179352, 0.552258, 0.833674, -1.54781e-012, },
-	{ 0.00194949, -0.0712468, -0.179352, 0.552258, 0.833674, -1.54781e-012, },
-	{ -0.00994386, -0.0617481, -0.149352, 0.624055, 0.78138, -1.45072e-012, },
-	{ 0.00194949, -0.0712468, -0.149352, 0.552258, 0.833674, -1.54781e-012, },
-	{ -0.00994386, -0.0617481, -0.149352, 0.624055, 0.78138, -1.45072e-012, },
-	{ 0.00194949, -0.0712468, -0.179352, 0.552258, 0.833674, -1.54781e-012, },
-	{ -0.00994386, -0.0617481, -0.179352, 0.624055, 0.78138, -1.45072e-012, },
-	{ -0.00994386, -0.0617481, -0.179352, 0, 1, -1.85661e-012, },
-	{ -0.0116999, -0.0617481, -0.149352, 0, 1, -1.85661e-012, },
-	{ -0.00994386, -0.0617481, -0.149352, 0, 1, -1.85661e-012, },
-	{ -0.0116999, -0.0617481, -0.149352, 0, 1, -1.85661e-012, },
-	{ -0.00994386, -0.0617481, -0.179352, 0, 1, -1.85661e-012, },
-	{ -0.0116999, -0.0617481, -0.179352, 0, 1, -1.85661e-012, },
-	{ 0.0974755, 0.0562476, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0901519, 0.00901337, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.0930255, -0.0165693, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.107234, 0.0447334, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.10452, -0.0826613, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.11311, -0.0694309, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.10452, -0.0826613, -0.149352, 0.772924, -0.634498, 1.17802e-012, },
-	{ 0.11311, -0.0694309, -0.179352, 0.88826, -0.459341, 8.52819e-013, },
-	{ 0.11311, -0.0694309, -0.149352, 0.88826, -0.459341, 8.52819e-013, },
-	{ 0.11311, -0.0694309, -0.179352, 0.88826, -0.459341, 8.52819e-013, },
-	{ 0.10452, -0.0826613, -0.149352, 0.772924, -0.634498, 1.17802e-012, },
-	{ 0.10452, -0.0826613, -0.179352, 0.772924, -0.634498, 1.17802e-012, },
-	{ 0.10452, -0.0826613, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.107234, 0.0447334, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.11311, -0.0694309, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.11311, -0.0694309, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.107234, 0.0447334, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.114637, 0.0317425, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.107234, 0.0447334, -0.179352, 0.819356, 0.573286, -1.06437e-012, },
-	{ 0.114637, 0.0317425, -0.149352, 0.907575, 0.41989, -7.79573e-013, },
-	{ 0.114637, 0.0317425, -0.179352, 0.907575, 0.41989, -7.79573e-013, },
-	{ 0.114637, 0.0317425, -0.149352, 0.907575, 0.41989, -7.79573e-013, },
-	{ 0.107234, 0.0447334, -0.179352, 0.819356, 0.573286, -1.06437e-012, },
-	{ 0.107234, 0.0447334, -0.149352, 0.819356, 0.573286, -1.06437e-012, },
-	{ 0.107234, 0.0447334, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.11311, -0.0694309, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.114637, 0.0317425, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.114637, 0.0317425, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.11311, -0.0694309, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.119247, -0.0540055, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.11311, -0.0694309, -0.149352, 0.88826, -0.459341, 8.52819e-013, },
-	{ 0.119247, -0.0540055, -0.179352, 0.957585, -0.288152, 5.34986e-013, },
-	{ 0.119247, -0.0540055, -0.149352, 0.957585, -0.288152, 5.34986e-013, },
-	{ 0.119247, -0.0540055, -0.179352, 0.957585, -0.288152, 5.34986e-013, },
-	{ 0.11311, -0.0694309, -0.149352, 0.88826, -0.459341, 8.52819e-013, },
-	{ 0.11311, -0.0694309, -0.179352, 0.88826, -0.459341, 8.52819e-013, },
-	{ 0.11311, -0.0694309, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.114637, 0.0317425, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.119247, -0.0540055, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.119247, -0.0540055, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.114637, 0.0317425, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.119925, 0.017195, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.114637, 0.0317425, -0.179352, 0.907575, 0.41989, -7.79573e-013, },
-	{ 0.119925, 0.017195, -0.149352, 0.963344, 0.268271, -4.98075e-013, },
-	{ 0.119925, 0.017195, -0.179352, 0.963344, 0.268271, -4.98075e-013, },
-	{ 0.119925, 0.017195, -0.149352, 0.963344, 0.268271, -4.98075e-013, },
-	{ 0.114637, 0.0317425, -0.179352, 0.907575, 0.41989, -7.79573e-013, },
-	{ 0.114637, 0.0317425, -0.149352, 0.907575, 0.41989, -7.79573e-013, },
-	{ 0.114637, 0.0317425, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.119247, -0.0540055, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.119925, 0.017195, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.119925, 0.017195, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.119247, -0.0540055, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.122929, -0.0363849, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.119247, -0.0540055, -0.149352, 0.957585, -0.288152, 5.34986e-013, },
-	{ 0.122929, -0.0363849, -0.179352, 0.991046, -0.133519, 2.47893e-013, },
-	{ 0.122929, -0.0363849, -0.149352, 0.991046, -0.133519, 2.47893e-013, },
-	{ 0.122929, -0.0363849, -0.179352, 0.991046, -0.133519, 2.47893e-013, },
-	{ 0.119247, -0.0540055, -0.149352, 0.957585, -0.288152, 5.34986e-013, },
-	{ 0.119247, -0.0540055, -0.179352, 0.957585, -0.288152, 5.34986e-013, },
-	{ 0.119247, -0.0540055, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.119925, 0.017195, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.122929, -0.0363849, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.122929, -0.0363849, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.119925, 0.017195, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.123098, 0.00109111, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.119925, 0.017195, -0.179352, 0.963344, 0.268271, -4.98075e-013, },
-	{ 0.123098, 0.00109111, -0.149352, 0.991924, 0.126832, -2.35479e-013, },
-	{ 0.123098, 0.00109111, -0.179352, 0.991924, 0.126832, -2.35479e-013, },
-	{ 0.123098, 0.00109111, -0.149352, 0.991924, 0.126832, -2.35479e-013, },
-	{ 0.119925, 0.017195, -0.179352, 0.963344, 0.268271, -4.98075e-013, },
-	{ 0.119925, 0.017195, -0.149352, 0.963344, 0.268271, -4.98075e-013, },
-	{ 0.119925, 0.017195, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.122929, -0.0363849, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.123098, 0.00109111, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.123098, 0.00109111, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.122929, -0.0363849, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.124156, -0.0165693, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.122929, -0.0363849, -0.149352, 0.991046, -0.133519, 2.47893e-013, },
-	{ 0.124156, -0.0165693, -0.179352, 0.999999, -0.00101948, 1.89278e-015, },
-	{ 0.124156, -0.0165693, -0.149352, 0.999999, -0.00101948, 1.89278e-015, },
-	{ 0.124156, -0.0165693, -0.179352, 0.999999, -0.00101948, 1.89278e-015, },
-	{ 0.122929, -0.0363849, -0.149352, 0.991046, -0.133519, 2.47893e-013, },
-	{ 0.122929, -0.0363849, -0.179352, 0.991046, -0.133519, 2.47893e-013, },
-	{ 0.122929, -0.0363849, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.123098, 0.00109111, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.124156, -0.0165693, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.123098, 0.00109111, -0.179352, 0.991924, 0.126832, -2.35479e-013, },
-	{ 0.124156, -0.0165693, -0.149352, 0.999999, -0.00101948, 1.89278e-015, },
-	{ 0.124156, -0.0165693, -0.179352, 0.999999, -0.00101948, 1.89278e-015, },
-	{ 0.124156, -0.0165693, -0.149352, 0.999999, -0.00101948, 1.89278e-015, },
-	{ 0.123098, 0.00109111, -0.179352, 0.991924, 0.126832, -2.35479e-013, },
-	{ 0.123098, 0.00109111, -0.149352, 0.991924, 0.126832, -2.35479e-013, },
-	{ 0.0166366, -0.105969, -0.149352, -0.247047, -0.969003, 1.79906e-012, },
-	{ -0.0116999, -0.0954327, -0.179352, -0.348518, -0.937302, 1.74021e-012, },
-	{ 0.0166366, -0.105969, -0.179352, -0.247047, -0.969003, 1.79906e-012, },
-	{ -0.0116999, -0.0954327, -0.179352, -0.348518, -0.937302, 1.74021e-012, },
-	{ 0.0166366, -0.105969, -0.149352, -0.247047, -0.969003, 1.79906e-012, },
-	{ -0.0116999, -0.0954327, -0.149352, -0.348518, -0.937302, 1.74021e-012, },
-	{ 0.218489, 0.109117, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.23399, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.208128, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.23399, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.218489, 0.109117, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.230418, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.218489, 0.109117, -0.179352, -0.766013, 0.642825, -1.19348e-012, },
-	{ 0.230418, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
-	{ 0.230418, 0.121471, -0.179352, -0.66764, 0.744484, -1.38222e-012, },
-	{ 0.230418, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
-	{ 0.218489, 0.109117, -0.179352, -0.766013, 0.642825, -1.19348e-012, },
-	{ 0.218489, 0.109117, -0.149352, -0.766013, 0.642825, -1.19348e-012, },
-	{ 0.208128, 0.0948611, -0.179352, -0.808895, 0.587953, -1.0916e-012, },
-	{ 0.218489, 0.109117, -0.149352, -0.766013, 0.642825, -1.19348e-012, },
-	{ 0.218489, 0.109117, -0.179352, -0.766013, 0.642825, -1.19348e-012, },
-	{ 0.218489, 0.109117, -0.149352, -0.766013, 0.642825, -1.19348e-012, },
-	{ 0.208128, 0.0948611, -0.179352, -0.808895, 0.587953, -1.0916e-012, },
-	{ 0.208128, 0.0948611, -0.149352, -0.808895, 0.587953, -1.0916e-012, },
-	{ 0.208128, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
-	{ 0.23399, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ 0.208128, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ 0.23399, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ 0.208128, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
-	{ 0.23399, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
-	{ 0.251241, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
-	{ 0.23399, 0.0948611, -0.149352, 0.716917, -0.697159, 1.29435e-012, },
-	{ 0.23399, 0.0948611, -0.179352, 0.716917, -0.697159, 1.29435e-012, },
-	{ 0.23399, 0.0948611, -0.149352, 0.716917, -0.697159, 1.29435e-012, },
-	{ 0.251241, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
-	{ 0.251241, 0.112601, -0.149352, 0.609765, -0.792582, 1.47152e-012, },
-	{ 0.251241, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
-	{ 0.273781, 0.125273, -0.149352, 0.379664, -0.925125, 1.71758e-012, },
-	{ 0.251241, 0.112601, -0.149352, 0.609765, -0.792582, 1.47152e-012, },
-	{ 0.273781, 0.125273, -0.149352, 0.379664, -0.925125, 1.71758e-012, },
-	{ 0.251241, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
-	{ 0.273781, 0.125273, -0.179352, 0.379664, -0.925125, 1.71758e-012, },
-	{ 0.251241, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.258974, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.273781, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.251241, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.243912, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.258974, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.23399, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.243912, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.251241, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.23399, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.230418, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.243912, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.230418, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
-	{ 0.243912, 0.131926, -0.179352, -0.554528, 0.832165, -1.54501e-012, },
-	{ 0.230418, 0.121471, -0.179352, -0.66764, 0.744484, -1.38222e-012, },
-	{ 0.243912, 0.131926, -0.179352, -0.554528, 0.832165, -1.54501e-012, },
-	{ 0.230418, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
-	{ 0.243912, 0.131926, -0.149352, -0.554528, 0.832165, -1.54501e-012, },
-	{ 0.230418, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.23399, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.243912, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.218489, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.23399, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.230418, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.23399, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.218489, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.208128, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.243912, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.23399, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.251241, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.243912, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.251241, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.258974, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.258974, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.251241, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.273781, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.258974, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.273781, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.275602, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.275602, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.273781, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.279229, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.273781, 0.125273, -0.149352, 0.379664, -0.925125, 1.71758e-012, },
-	{ 0.301608, 0.132876, -0.149352, 0.170704, -0.985322, 1.82949e-012, },
-	{ 0.279229, 0.126762, -0.149352, 0.263556, -0.964644, 1.79094e-012, },
-	{ 0.273781, 0.125273, -0.179352, 0.379664, -0.925125, 1.71758e-012, },
-	{ 0.301608, 0.132876, -0.149352, 0.170704, -0.985322, 1.82949e-012, },
-	{ 0.273781, 0.125273, -0.149352, 0.379664, -0.925125, 1.71758e-012, },
-	{ 0.301608, 0.132876, -0.149352, 0.170704, -0.985322, 1.82949e-012, },
-	{ 0.273781, 0.125273, -0.179352, 0.379664, -0.925125, 1.71758e-012, },
-	{ 0.301608, 0.132876, -0.179352, 0.170704, -0.985322, 1.82949e-012, },
-	{ 0.273781, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.275602, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.301608, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.273781, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.258974, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.275602, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.258974, 0.140479, -0.149352, -0.433645, 0.901084, -1.67296e-012, },
-	{ 0.275602, 0.147131, -0.179352, -0.312692, 0.949855, -1.76351e-012, },
-	{ 0.258974, 0.140479, -0.179352, -0.433645, 0.901084, -1.67296e-012, },
-	{ 0.275602, 0.147131, -0.179352, -0.312692, 0.949855, -1.76351e-012, },
-	{ 0.258974, 0.140479, -0.149352, -0.433645, 0.901084, -1.67296e-012, },
-	{ 0.275602, 0.147131, -0.149352, -0.312692, 0.949855, -1.76351e-012, },
-	{ 0.275602, 0.147131, -0.149352, -0.312692, 0.949855, -1.76351e-012, },
-	{ 0.293796, 0.151883, -0.179352, -0.198062, 0.98019, -1.81983e-012, },
-	{ 0.275602, 0.147131, -0.179352, -0.312692, 0.949855, -1.76351e-012, },
-	{ 0.293796, 0.151883, -0.179352, -0.198062, 0.98019, -1.81983e-012, },
-	{ 0.275602, 0.147131, -0.149352, -0.312692, 0.949855, -1.76351e-012, },
-	{ 0.293796, 0.151883, -0.149352, -0.198062, 0.98019, -1.81983e-012, },
-	{ 0.275602, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.279229, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.293796, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.293796, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.279229, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.289026, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.289026, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.279229, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.289026, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.300351, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.300351, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.301608, 0.132876, -0.149352, 0.170704, -0.985322, 1.82949e-012, },
-	{ 0.334724, 0.13541, -0.149352, 8.00648e-005, -1, 1.85675e-012, },
-	{ 0.326674, 0.134794, -0.149352, 0.076306, -0.997084, 1.85148e-012, },
-	{ 0.301608, 0.132876, -0.179352, 0.170704, -0.985322, 1.82949e-012, },
-	{ 0.334724, 0.13541, -0.149352, 8.00648e-005, -1, 1.85675e-012, },
-	{ 0.301608, 0.132876, -0.149352, 0.170704, -0.985322, 1.82949e-012, },
-	{ 0.334724, 0.13541, -0.149352, 8.00648e-005, -1, 1.85675e-012, },
-	{ 0.301608, 0.132876, -0.179352, 0.170704, -0.985322, 1.82949e-012, },
-	{ 0.334724, 0.13541, -0.179352, 8.00648e-005, -1, 1.85675e-012, },
-	{ 0.301608, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.313556, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.334724, 0.13541, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.301608, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.293796, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.313556, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.301608, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.275602, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.293796, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.293796, 0.151883, -0.149352, -0.198062, 0.98019, -1.81983e-012, },
-	{ 0.313556, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
-	{ 0.293796, 0.151883, -0.179352, -0.198062, 0.98019, -1.81983e-012, },
-	{ 0.313556, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
-	{ 0.293796, 0.151883, -0.149352, -0.198062, 0.98019, -1.81983e-012, },
-	{ 0.313556, 0.154734, -0.149352, -0.0937744, 0.995593, -1.84843e-012, },
-	{ 0.293796, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.300351, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.313556, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.293796, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.289026, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.300351, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.300351, 0.135271, -0.179352, -0.184752, 0.982785, -1.82465e-012, },
-	{ 0.289026, 0.131978, -0.149352, -0.376579, 0.926384, -1.71994e-012, },
-	{ 0.300351, 0.135271, -0.149352, -0.184752, 0.982785, -1.82465e-012, },
-	{ 0.289026, 0.131978, -0.149352, -0.376579, 0.926384, -1.71994e-012, },
-	{ 0.300351, 0.135271, -0.179352, -0.184752, 0.982785, -1.82465e-012, },
-	{ 0.289026, 0.131978, -0.179352, -0.376579, 0.926384, -1.71994e-012, },
-	{ 0.298645, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.289026, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.300351, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.287151, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.289026, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.298645, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.279488, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.289026, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.287151, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.279488, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.27872, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.289026, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.276934, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.27872, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.279488, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.26959, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.27872, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.276934, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.26959, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.26943, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.27872, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.261837, 0.0416702, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.26943, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.26959, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.261837, 0.0416702, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.261748, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.26943, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.2563, 0.0519572, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.261748, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.261837, 0.0416702, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.2563, 0.0519572, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.25626, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.261748, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.252977, 0.0633018, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.25626, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.2563, 0.0519572, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.252977, 0.0633018, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.252967, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.25626, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.252967, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.252977, 0.0633018, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.25187, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.252977, 0.0633018, -0.179352, -0.982569, -0.185898, 3.45141e-013, },
-	{ 0.25187, 0.075704, -0.149352, -1, 6.48887e-005, -1.20473e-016, },
-	{ 0.25187, 0.075704, -0.179352, -1, 6.48887e-005, -1.20473e-016, },
-	{ 0.25187, 0.075704, -0.149352, -1, 6.48887e-005, -1.20473e-016, },
-	{ 0.252977, 0.0633018, -0.179352, -0.982569, -0.185898, 3.45141e-013, },
-	{ 0.252977, 0.0633018, -0.149352, -0.982569, -0.185898, 3.45141e-013, },
-	{ 0.2563, 0.0519572, -0.179352, -0.92515, -0.379603, 7.04775e-013, },
-	{ 0.252977, 0.0633018, -0.149352, -0.982569, -0.185898, 3.45141e-013, },
-	{ 0.252977, 0.0633018, -0.179352, -0.982569, -0.185898, 3.45141e-013, },
-	{ 0.252977, 0.0633018, -0.149352, -0.982569, -0.185898, 3.45141e-013, },
-	{ 0.2563, 0.0519572, -0.179352, -0.92515, -0.379603, 7.04775e-013, },
-	{ 0.2563, 0.0519572, -0.149352, -0.92515, -0.379603, 7.04775e-013, },
-	{ 0.261837, 0.0416702, -0.179352, -0.827451, -0.561538, 1.04256e-012, },
-	{ 0.2563, 0.0519572, -0.149352, -0.92515, -0.379603, 7.04775e-013, },
-	{ 0.2563, 0.0519572, -0.179352, -0.92515, -0.379603, 7.04775e-013, },
-	{ 0.2563, 0.0519572, -0.149352, -0.92515, -0.379603, 7.04775e-013, },
-	{ 0.261837, 0.0416702, -0.179352, -0.827451, -0.561538, 1.04256e-012, },
-	{ 0.261837, 0.0416702, -0.149352, -0.827451, -0.561538, 1.04256e-012, },
-	{ 0.26959, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
-	{ 0.261837, 0.0416702, -0.149352, -0.827451, -0.561538, 1.04256e-012, },
-	{ 0.261837, 0.0416702, -0.179352, -0.827451, -0.561538, 1.04256e-012, },
-	{ 0.261837, 0.0416702, -0.149352, -0.827451, -0.561538, 1.04256e-012, },
-	{ 0.26959, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
-	{ 0.26959, 0.0324409, -0.149352, -0.701877, -0.712298, 1.32246e-012, },
-	{ 0.26959, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
-	{ 0.278929, 0.0248279, -0.149352, -0.552115, -0.833768, 1.54798e-012, },
-	{ 0.26959, 0.0324409, -0.149352, -0.701877, -0.712298, 1.32246e-012, },
-	{ 0.278929, 0.0248279, -0.149352, -0.552115, -0.833768, 1.54798e-012, },
-	{ 0.26959, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
-	{ 0.278929, 0.0248279, -0.179352, -0.552115, -0.833768, 1.54798e-012, },
-	{ 0.276934, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.278929, 0.0248279, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.26959, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.278929, 0.0248279, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.276934, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.279548, 0.0613761, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.276934, 0.075704, -0.179352, 1, 0.000803637, -1.49204e-015, },
-	{ 0.279548, 0.0613761, -0.149352, 0.926569, 0.376125, -6.98317e-013, },
-	{ 0.279548, 0.0613761, -0.179352, 0.926569, 0.376125, -6.98317e-013, },
-	{ 0.279548, 0.0613761, -0.149352, 0.926569, 0.376125, -6.98317e-013, },
-	{ 0.276934, 0.075704, -0.179352, 1, 0.000803637, -1.49204e-015, },
-	{ 0.276934, 0.075704, -0.149352, 1, 0.000803637, -1.49204e-015, },
-	{ 0.279488, 0.0898323, -0.179352, 0.929149, -0.369705, 6.86399e-013, },
-	{ 0.276934, 0.075704, -0.149352, 1, 0.000803637, -1.49204e-015, },
-	{ 0.276934, 0.075704, -0.179352, 1, 0.000803637, -1.49204e-015, },
-	{ 0.276934, 0.075704, -0.149352, 1, 0.000803637, -1.49204e-015, },
-	{ 0.279488, 0.0898323, -0.179352, 0.929149, -0.369705, 6.86399e-013, },
-	{ 0.279488, 0.0898323, -0.149352, 0.929149, -0.369705, 6.86399e-013, },
-	{ 0.287151, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
-	{ 0.279488, 0.0898323, -0.149352, 0.929149, -0.369705, 6.86399e-013, },
-	{ 0.279488, 0.0898323, -0.179352, 0.929149, -0.369705, 6.86399e-013, },
-	{ 0.279488, 0.0898323, -0.149352, 0.929149, -0.369705, 6.86399e-013, },
-	{ 0.287151, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
-	{ 0.287151, 0.101566, -0.149352, 0.715458, -0.698656, 1.29713e-012, },
-	{ 0.287151, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
-	{ 0.298645, 0.109468, -0.149352, 0.383717, -0.923451, 1.71449e-012, },
-	{ 0.287151, 0.101566, -0.149352, 0.715458, -0.698656, 1.29713e-012, },
-	{ 0.298645, 0.109468, -0.149352, 0.383717, -0.923451, 1.71449e-012, },
-	{ 0.287151, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
-	{ 0.298645, 0.109468, -0.179352, 0.383717, -0.923451, 1.71449e-012, },
-	{ 0.298645, 0.109468, -0.179352, 0.383717, -0.923451, 1.71449e-012, },
-	{ 0.312693, 0.112102, -0.149352, 1.17193e-015, -1, 1.85661e-012, },
-	{ 0.298645, 0.109468, -0.149352, 0.383717, -0.923451, 1.71449e-012, },
-	{ 0.312693, 0.112102, -0.149352, 1.17193e-015, -1, 1.85661e-012, },
-	{ 0.298645, 0.109468, -0.179352, 0.383717, -0.923451, 1.71449e-012, },
-	{ 0.312693, 0.112102, -0.179352, 1.17193e-015, -1, 1.85661e-012, },
-	{ 0.298645, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.300351, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.312693, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.312693, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.300351, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.312693, 0.136368, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.300351, 0.135271, -0.149352, -0.184752, 0.982785, -1.82465e-012, },
-	{ 0.312693, 0.136368, -0.179352, -3.20449e-016, 1, -1.85661e-012, },
-	{ 0.300351, 0.135271, -0.179352, -0.184752, 0.982785, -1.82465e-012, },
-	{ 0.312693, 0.136368, -0.179352, -3.20449e-016, 1, -1.85661e-012, },
-	{ 0.300351, 0.135271, -0.149352, -0.184752, 0.982785, -1.82465e-012, },
-	{ 0.312693, 0.136368, -0.149352, -3.20449e-016, 1, -1.85661e-012, },
-	{ 0.313556, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.300351, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.313556, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.325036, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.325036, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.334884, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.325036, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.313556, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.325036, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.334884, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.334884, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
-	{ 0.313556, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
-	{ 0.313556, 0.154734, -0.149352, -0.0937744, 0.995593, -1.84843e-012, },
-	{ 0.313556, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
-	{ 0.334884, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
-	{ 0.334884, 0.155685, -0.179352, 3.90799e-005, 1, -1.85661e-012, },
-	{ 0.334884, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
-	{ 0.356174, 0.154734, -0.179352, 0.093929, 0.995579, -1.8484e-012, },
-	{ 0.334884, 0.155685, -0.179352, 3.90799e-005, 1, -1.85661e-012, },
-	{ 0.356174, 0.154734, -0.179352, 0.093929, 0.995579, -1.8484e-012, },
-	{ 0.334884, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
-	{ 0.356174, 0.154734, -0.149352, 0.093929, 0.995579, -1.8484e-012, },
-	{ 0.334884, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.36791, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.356174, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.334884, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.334724, 0.13541, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.36791, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.334884, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.334724, 0.13541, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.334724, 0.13541, -0.179352, 8.00648e-005, -1, 1.85675e-012, },
-	{ 0.36791, 0.132876, -0.149352, -0.1704, -0.985375, 1.82946e-012, },
-	{ 0.334724, 0.13541, -0.149352, 8.00648e-005, -1, 1.85675e-012, },
-	{ 0.36791, 0.132876, -0.149352, -0.1704, -0.985375, 1.82946e-012, },
-	{ 0.334724, 0.13541, -0.179352, 8.00648e-005, -1, 1.85675e-012, },
-	{ 0.36791, 0.132876, -0.179352, -0.1704, -0.985375, 1.82946e-012, },
-	{ 0.334724, 0.13541, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.334884, 0.155685, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.36791, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.334724, 0.13541, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.313556, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.334884, 0.155685, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.36791, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.334884, 0.155685, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.356174, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.36791, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.356174, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.375902, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.356174, 0.154734, -0.149352, 0.093929, 0.995579, -1.8484e-012, },
-	{ 0.375902, 0.151883, -0.179352, 0.198356, 0.98013, -1.81972e-012, },
-	{ 0.356174, 0.154734, -0.179352, 0.093929, 0.995579, -1.8484e-012, },
-	{ 0.375902, 0.151883, -0.179352, 0.198356, 0.98013, -1.81972e-012, },
-	{ 0.356174, 0.154734, -0.149352, 0.093929, 0.995579, -1.8484e-012, },
-	{ 0.375902, 0.151883, -0.149352, 0.198356, 0.98013, -1.81972e-012, },
-	{ 0.356174, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.36791, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.375902, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.375902, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.36791, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.395787, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.36791, 0.132876, -0.179352, -0.1704, -0.985375, 1.82946e-012, },
-	{ 0.395787, 0.125273, -0.149352, -0.379191, -0.925318, 1.71796e-012, },
-	{ 0.36791, 0.132876, -0.149352, -0.1704, -0.985375, 1.82946e-012, },
-	{ 0.395787, 0.125273, -0.149352, -0.379191, -0.925318, 1.71796e-012, },
-	{ 0.36791, 0.132876, -0.179352, -0.1704, -0.985375, 1.82946e-012, },
-	{ 0.395787, 0.125273, -0.179352, -0.379191, -0.925318, 1.71796e-012, },
-	{ 0.36791, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.375902, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.395787, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.395787, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.375902, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.394069, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.375902, 0.151883, -0.149352, 0.198356, 0.98013, -1.81972e-012, },
-	{ 0.394069, 0.147131, -0.179352, 0.313088, 0.949724, -1.76312e-012, },
-	{ 0.375902, 0.151883, -0.179352, 0.198356, 0.98013, -1.81972e-012, },
-	{ 0.394069, 0.147131, -0.179352, 0.313088, 0.949724, -1.76312e-012, },
-	{ 0.375902, 0.151883, -0.149352, 0.198356, 0.98013, -1.81972e-012, },
-	{ 0.394069, 0.147131, -0.149352, 0.313088, 0.949724, -1.76312e-012, },
-	{ 0.375902, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.395787, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.394069, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.394069, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.395787, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.401455, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.401455, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.395787, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.401455, 0.141317, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.418357, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.401455, 0.141317, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.395787, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.401455, 0.141317, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.418357, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.418357, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.435618, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.418357, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
-	{ 0.435618, 0.0948611, -0.179352, -0.716715, -0.697366, 1.29474e-012, },
-	{ 0.435618, 0.0948611, -0.149352, -0.716715, -0.697366, 1.29474e-012, },
-	{ 0.435618, 0.0948611, -0.179352, -0.716715, -0.697366, 1.29474e-012, },
-	{ 0.418357, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
-	{ 0.418357, 0.112601, -0.179352, -0.609426, -0.792843, 1.472e-012, },
-	{ 0.418357, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
-	{ 0.395787, 0.125273, -0.179352, -0.379191, -0.925318, 1.71796e-012, },
-	{ 0.418357, 0.112601, -0.179352, -0.609426, -0.792843, 1.472e-012, },
-	{ 0.395787, 0.125273, -0.179352, -0.379191, -0.925318, 1.71796e-012, },
-	{ 0.418357, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
-	{ 0.395787, 0.125273, -0.149352, -0.379191, -0.925318, 1.71796e-012, },
-	{ 0.395787, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.410674, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.418357, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.395787, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.394069, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.410674, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.394069, 0.147131, -0.149352, 0.313088, 0.949724, -1.76312e-012, },
-	{ 0.410674, 0.140479, -0.179352, 0.43408, 0.900874, -1.67242e-012, },
-	{ 0.394069, 0.147131, -0.179352, 0.313088, 0.949724, -1.76312e-012, },
-	{ 0.410674, 0.140479, -0.179352, 0.43408, 0.900874, -1.67242e-012, },
-	{ 0.394069, 0.147131, -0.149352, 0.313088, 0.949724, -1.76312e-012, },
-	{ 0.404597, 0.142913, -0.149352, 0.371896, 0.928275, -1.72314e-012, },
-	{ 0.394069, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.401455, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.404597, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.401455, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.404597, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.401455, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.401455, 0.141317, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.401455, 0.142913, -0.149352, -1, 0, -0, },
-	{ 0.401455, 0.141317, -0.179352, -1, 0, -0, },
-	{ 0.401455, 0.141317, -0.149352, -1, 0, -0, },
-	{ 0.401455, 0.141317, -0.179352, -1, 0, -0, },
-	{ 0.401455, 0.142913, -0.149352, -1, 0, -0, },
-	{ 0.401455, 0.142913, -0.179352, -1, 0, -0, },
-	{ 0.401455, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
-	{ 0.438013, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
-	{ 0.401455, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
-	{ 0.438013, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
-	{ 0.401455, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
-	{ 0.438013, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
-	{ 0.438013, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
-	{ 0.401455, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
-	{ 0.404597, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
-	{ 0.410674, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.438013, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.404597, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.438013, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.410674, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.425718, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.425718, 0.131926, -0.179352, 0.554922, 0.831902, -1.54452e-012, },
-	{ 0.410674, 0.140479, -0.149352, 0.43408, 0.900874, -1.67242e-012, },
-	{ 0.425718, 0.131926, -0.149352, 0.554922, 0.831902, -1.54452e-012, },
-	{ 0.410674, 0.140479, -0.149352, 0.43408, 0.900874, -1.67242e-012, },
-	{ 0.425718, 0.131926, -0.179352, 0.554922, 0.831902, -1.54452e-012, },
-	{ 0.410674, 0.140479, -0.179352, 0.43408, 0.900874, -1.67242e-012, },
-	{ 0.418357, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.410674, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.425718, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.418357, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.425718, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.435618, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.435618, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.425718, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.4392, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.425718, 0.131926, -0.149352, 0.554922, 0.831902, -1.54452e-012, },
-	{ 0.4392, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
-	{ 0.425718, 0.131926, -0.179352, 0.554922, 0.831902, -1.54452e-012, },
-	{ 0.4392, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
-	{ 0.425718, 0.131926, -0.149352, 0.554922, 0.831902, -1.54452e-012, },
-	{ 0.4392, 0.121471, -0.149352, 0.667924, 0.74423, -1.38175e-012, },
-	{ 0.425718, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.410674, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.425718, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.404597, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.410674, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.410674, 0.140479, -0.149352, 0.43408, 0.900874, -1.67242e-012, },
-	{ 0.410674, 0.140479, -0.179352, 0.43408, 0.900874, -1.67242e-012, },
-	{ 0.404597, 0.142913, -0.149352, 0.371896, 0.928275, -1.72314e-012, },
-	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.437534, 0.0976947, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.435618, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.437534, 0.0976947, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.437534, 0.0976947, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.435618, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.439098, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.435618, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ 0.46148, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ 0.439098, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ 0.435618, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
-	{ 0.46148, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ 0.435618, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ 0.46148, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
-	{ 0.435618, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
-	{ 0.46148, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
-	{ 0.435618, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.4392, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.46148, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.46148, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.4392, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.451121, 0.109117, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.4392, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
-	{ 0.451121, 0.109117, -0.149352, 0.766151, 0.642661, -1.19317e-012, },
-	{ 0.451121, 0.109117, -0.179352, 0.766151, 0.642661, -1.19317e-012, },
-	{ 0.451121, 0.109117, -0.149352, 0.766151, 0.642661, -1.19317e-012, },
-	{ 0.4392, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
-	{ 0.4392, 0.121471, -0.149352, 0.667924, 0.74423, -1.38175e-012, },
-	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.451121, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.439098, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.437534, 0.0976947, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.439098, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.437534, 0.0976947, -0.179352, -0.84969, -0.527283, 9.78809e-013, },
-	{ 0.439098, 0.0948611, -0.149352, -0.875469, -0.483274, 8.96952e-013, },
-	{ 0.437534, 0.0976947, -0.149352, -0.84969, -0.527283, 9.78809e-013, },
-	{ 0.447911, 0.0788968, -0.179352, -0.899286, -0.43736, 8.11858e-013, },
-	{ 0.439098, 0.0948611, -0.149352, -0.875469, -0.483274, 8.96952e-013, },
-	{ 0.437534, 0.0976947, -0.179352, -0.84969, -0.527283, 9.78809e-013, },
-	{ 0.439098, 0.0948611, -0.149352, -0.875469, -0.483274, 8.96952e-013, },
-	{ 0.447911, 0.0788968, -0.179352, -0.899286, -0.43736, 8.11858e-013, },
-	{ 0.447911, 0.0788968, -0.149352, -0.899286, -0.43736, 8.11858e-013, },
-	{ 0.456691, 0.0581832, -0.179352, -0.939981, -0.341227, 6.33526e-013, },
-	{ 0.447911, 0.0788968, -0.149352, -0.899286, -0.43736, 8.11858e-013, },
-	{ 0.447911, 0.0788968, -0.179352, -0.899286, -0.43736, 8.11858e-013, },
-	{ 0.447911, 0.0788968, -0.149352, -0.899286, -0.43736, 8.11858e-013, },
-	{ 0.456691, 0.0581832, -0.179352, -0.939981, -0.341227, 6.33526e-013, },
-	{ 0.456691, 0.0581832, -0.149352, -0.939981, -0.341227, 6.33526e-013, },
-	{ 0.463555, 0.0356337, -0.179352, -0.971732, -0.236086, 4.3832e-013, },
-	{ 0.456691, 0.0581832, -0.149352, -0.939981, -0.341227, 6.33526e-013, },
-	{ 0.456691, 0.0581832, -0.179352, -0.939981, -0.341227, 6.33526e-013, },
-	{ 0.456691, 0.0581832, -0.149352, -0.939981, -0.341227, 6.33526e-013, },
-	{ 0.463555, 0.0356337, -0.179352, -0.971732, -0.236086, 4.3832e-013, },
-	{ 0.463555, 0.0356337, -0.149352, -0.971732, -0.236086, 4.3832e-013, },
-	{ 0.467986, 0.0114479, -0.179352, -0.992885, -0.119081, 2.21088e-013, },
-	{ 0.463555, 0.0356337, -0.149352, -0.971732, -0.236086, 4.3832e-013, },
-	{ 0.463555, 0.0356337, -0.179352, -0.971732, -0.236086, 4.3832e-013, },
-	{ 0.463555, 0.0356337, -0.149352, -0.971732, -0.236086, 4.3832e-013, },
-	{ 0.467986, 0.0114479, -0.179352, -0.992885, -0.119081, 2.21088e-013, },
-	{ 0.467986, 0.0114479, -0.149352, -0.992885, -0.119081, 2.21088e-013, },
-	{ 0.469462, -0.0141747, -0.179352, -1, -0.000498049, 9.24684e-016, },
-	{ 0.467986, 0.0114479, -0.149352, -0.992885, -0.119081, 2.21088e-013, },
-	{ 0.467986, 0.0114479, -0.179352, -0.992885, -0.119081, 2.21088e-013, },
-	{ 0.467986, 0.0114479, -0.149352, -0.992885, -0.119081, 2.21088e-013, },
-	{ 0.469462, -0.0141747, -0.179352, -1, -0.000498049, 9.24684e-016, },
-	{ 0.469462, -0.0141747, -0.149352, -1, -0.000498049, 9.24684e-016, },
-	{ 0.468006, -0.0398971, -0.179352, -0.992938, 0.118632, -2.20254e-013, },
-	{ 0.469462, -0.0141747, -0.149352, -1, -0.000498049, 9.24684e-016, },
-	{ 0.469462, -0.0141747, -0.179352, -1, -0.000498049, 9.24684e-016, },
-	{ 0.469462, -0.0141747, -0.149352, -1, -0.000498049, 9.24684e-016, },
-	{ 0.468006, -0.0398971, -0.179352, -0.992938, 0.118632, -2.20254e-013, },
-	{ 0.468006, -0.0398971, -0.149352, -0.992938, 0.118632, -2.20254e-013, },
-	{ 0.468006, -0.0398971, -0.179352, -0.992938, 0.118632, -2.20254e-013, },
-	{ 0.463635, -0.0637437, -0.149352, -0.971494, 0.237063, -4.40134e-013, },
-	{ 0.468006, -0.0398971, -0.149352, -0.992938, 0.118632, -2.20254e-013, },
-	{ 0.463635, -0.0637437, -0.149352, -0.971494, 0.237063, -4.40134e-013, },
-	{ 0.468006, -0.0398971, -0.179352, -0.992938, 0.118632, -2.20254e-013, },
-	{ 0.463635, -0.0637437, -0.179352, -0.971494, 0.237063, -4.40134e-013, },
-	{ 0.481755, -0.100861, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.463635, -0.0637437, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.468006, -0.0398971, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.462917, -0.137139, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.463635, -0.0637437, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.481755, -0.100861, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.462917, -0.137139, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.456791, -0.0860736, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.463635, -0.0637437, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.462917, -0.137139, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.447911, -0.107246, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.456791, -0.0860736, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.438013, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.447911, -0.107246, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.462917, -0.137139, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.438013, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.437853, -0.125745, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.447911, -0.107246, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.438013, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.426199, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.437853, -0.125745, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.401455, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.426199, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.438013, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.426199, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.401455, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.401455, -0.169666, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.401455, -0.171263, -0.179352, -1, 0, -0, },
-	{ 0.401455, -0.169666, -0.149352, -1, 0, -0, },
-	{ 0.401455, -0.169666, -0.179352, -1, 0, -0, },
-	{ 0.401455, -0.169666, -0.149352, -1, 0, -0, },
-	{ 0.401455, -0.171263, -0.179352, -1, 0, -0, },
-	{ 0.401455, -0.171263, -0.149352, -1, 0, -0, },
-	{ 0.401455, -0.171263, -0.179352, 0, -1, 1.85661e-012, },
-	{ 0.438013, -0.171263, -0.149352, 0, -1, 1.85661e-012, },
-	{ 0.401455, -0.171263, -0.149352, 0, -1, 1.85661e-012, },
-	{ 0.438013, -0.171263, -0.149352, 0, -1, 1.85661e-012, },
-	{ 0.401455, -0.171263, -0.179352, 0, -1, 1.85661e-012, },
-	{ 0.438013, -0.171263, -0.179352, 0, -1, 1.85661e-012, },
-	{ 0.462917, -0.137139, -0.179352, 0.85006, -0.526686, 9.77851e-013, },
-	{ 0.438013, -0.171263, -0.149352, 0.807754, -0.589519, 1.09451e-012, },
-	{ 0.438013, -0.171263, -0.179352, 0.807754, -0.589519, 1.09451e-012, },
-	{ 0.438013, -0.171263, -0.149352, 0.807754, -0.589519, 1.09451e-012, },
-	{ 0.462917, -0.137139, -0.179352, 0.85006, -0.526686, 9.77851e-013, },
-	{ 0.462917, -0.137139, -0.149352, 0.85006, -0.526686, 9.77851e-013, },
-	{ 0.481755, -0.100861, -0.179352, 0.916945, -0.399013, 7.40812e-013, },
-	{ 0.462917, -0.137139, -0.149352, 0.85006, -0.526686, 9.77851e-013, },
-	{ 0.462917, -0.137139, -0.179352, 0.85006, -0.526686, 9.77851e-013, },
-	{ 0.462917, -0.137139, -0.149352, 0.85006, -0.526686, 9.77851e-013, },
-	{ 0.481755, -0.100861, -0.179352, 0.916945, -0.399013, 7.40812e-013, },
-	{ 0.481755, -0.100861, -0.149352, 0.916945, -0.399013, 7.40812e-013, },
-	{ 0.488669, -0.081434, -0.179352, 0.959132, -0.28296, 5.25347e-013, },
-	{ 0.481755, -0.100861, -0.149352, 0.916945, -0.399013, 7.40812e-013, },
-	{ 0.481755, -0.100861, -0.179352, 0.916945, -0.399013, 7.40812e-013, },
-	{ 0.481755, -0.100861, -0.149352, 0.916945, -0.399013, 7.40812e-013, },
-	{ 0.488669, -0.081434, -0.179352, 0.959132, -0.28296, 5.25347e-013, },
-	{ 0.488669, -0.081434, -0.149352, 0.959132, -0.28296, 5.25347e-013, },
-	{ 0.493608, -0.0605109, -0.179352, 0.983554, -0.180615, 3.35331e-013, },
-	{ 0.488669, -0.081434, -0.149352, 0.959132, -0.28296, 5.25347e-013, },
-	{ 0.488669, -0.081434, -0.179352, 0.959132, -0.28296, 5.25347e-013, },
-	{ 0.488669, -0.081434, -0.149352, 0.959132, -0.28296, 5.25347e-013, },
-	{ 0.493608, -0.0605109, -0.179352, 0.983554, -0.180615, 3.35331e-013, },
-	{ 0.493608, -0.0605109, -0.149352, 0.983554, -0.180615, 3.35331e-013, },
-	{ 0.496572, -0.0380911, -0.179352, 0.996274, -0.0862391, 1.60112e-013, },
-	{ 0.493608, -0.0605109, -0.149352, 0.983554, -0.180615, 3.35331e-013, },
-	{ 0.493608, -0.0605109, -0.179352, 0.983554, -0.180615, 3.35331e-013, },
-	{ 0.493608, -0.0605109, -0.149352, 0.983554, -0.180615, 3.35331e-013, },
-	{ 0.496572, -0.0380911, -0.179352, 0.996274, -0.0862391, 1.60112e-013, },
-	{ 0.496572, -0.0380911, -0.149352, 0.996274, -0.0862391, 1.60112e-013, },
-	{ 0.497559, -0.0141747, -0.179352, 1, -7.64695e-006, 1.41974e-017, },
-	{ 0.496572, -0.0380911, -0.149352, 0.996274, -0.0862391, 1.60112e-013, },
-	{ 0.496572, -0.0380911, -0.179352, 0.996274, -0.0862391, 1.60112e-013, },
-	{ 0.496572, -0.0380911, -0.149352, 0.996274, -0.0862391, 1.60112e-013, },
-	{ 0.497559, -0.0141747, -0.179352, 1, -7.64695e-006, 1.41974e-017, },
-	{ 0.497559, -0.0141747, -0.149352, 1, -7.64695e-006, 1.41974e-017, },
-	{ 0.496567, 0.00987145, -0.179352, 0.996264, 0.0863563, -1.6033e-013, },
-	{ 0.497559, -0.0141747, -0.149352, 1, -7.64695e-006, 1.41974e-017, },
-	{ 0.497559, -0.0141747, -0.179352, 1, -7.64695e-006, 1.41974e-017, },
-	{ 0.497559, -0.0141747, -0.149352, 1, -7.64695e-006, 1.41974e-017, },
-	{ 0.496567, 0.00987145, -0.179352, 0.996264, 0.0863563, -1.6033e-013, },
-	{ 0.496567, 0.00987145, -0.149352, 0.996264, 0.0863563, -1.6033e-013, },
-	{ 0.493588, 0.0323611, -0.179352, 0.983439, 0.18124, -3.36493e-013, },
-	{ 0.496567, 0.00987145, -0.149352, 0.996264, 0.0863563, -1.6033e-013, },
-	{ 0.496567, 0.00987145, -0.179352, 0.996264, 0.0863563, -1.6033e-013, },
-	{ 0.496567, 0.00987145, -0.149352, 0.996264, 0.0863563, -1.6033e-013, },
-	{ 0.493588, 0.0323611, -0.179352, 0.983439, 0.18124, -3.36493e-013, },
-	{ 0.493588, 0.0323611, -0.149352, 0.983439, 0.18124, -3.36493e-013, },
-	{ 0.488624, 0.0532942, -0.179352, 0.958645, 0.284606, -5.28403e-013, },
-	{ 0.493588, 0.0323611, -0.149352, 0.983439, 0.18124, -3.36493e-013, },
-	{ 0.493588, 0.0323611, -0.179352, 0.983439, 0.18124, -3.36493e-013, },
-	{ 0.493588, 0.0323611, -0.149352, 0.983439, 0.18124, -3.36493e-013, },
-	{ 0.488624, 0.0532942, -0.179352, 0.958645, 0.284606, -5.28403e-013, },
-	{ 0.488624, 0.0532942, -0.149352, 0.958645, 0.284606, -5.28403e-013, },
-	{ 0.481675, 0.0726708, -0.179352, 0.916106, 0.400937, -7.44384e-013, },
-	{ 0.488624, 0.0532942, -0.149352, 0.958645, 0.284606, -5.28403e-013, },
-	{ 0.488624, 0.0532942, -0.179352, 0.958645, 0.284606, -5.28403e-013, },
-	{ 0.488624, 0.0532942, -0.149352, 0.958645, 0.284606, -5.28403e-013, },
-	{ 0.481675, 0.0726708, -0.179352, 0.916106, 0.400937, -7.44384e-013, },
-	{ 0.481675, 0.0726708, -0.149352, 0.916106, 0.400937, -7.44384e-013, },
-	{ 0.462817, 0.10883, -0.179352, 0.849946, 0.52687, -9.78193e-013, },
-	{ 0.481675, 0.0726708, -0.149352, 0.916106, 0.400937, -7.44384e-013, },
-	{ 0.481675, 0.0726708, -0.179352, 0.916106, 0.400937, -7.44384e-013, },
-	{ 0.481675, 0.0726708, -0.149352, 0.916106, 0.400937, -7.44384e-013, },
-	{ 0.462817, 0.10883, -0.179352, 0.849946, 0.52687, -9.78193e-013, },
-	{ 0.462817, 0.10883, -0.149352, 0.849946, 0.52687, -9.78193e-013, },
-	{ 0.438013, 0.142913, -0.179352, 0.808552, 0.588425, -1.09248e-012, },
-	{ 0.462817, 0.10883, -0.149352, 0.849946, 0.52687, -9.78193e-013, },
-	{ 0.462817, 0.10883, -0.179352, 0.849946, 0.52687, -9.78193e-013, },
-	{ 0.462817, 0.10883, -0.149352, 0.849946, 0.52687, -9.78193e-013, },
-	{ 0.438013, 0.142913, -0.179352, 0.808552, 0.588425, -1.09248e-012, },
-	{ 0.438013, 0.142913, -0.149352, 0.808552, 0.588425, -1.09248e-012, },
-	{ 0.438013, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.462817, 0.10883, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.438013, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.425718, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.462817, 0.10883, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.451121, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.462817, 0.10883, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.451121, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.46148, 0.0948611, -0.149352, 0.808963, 0.58786, -1.09143e-012, },
-	{ 0.451121, 0.109117, -0.179352, 0.766151, 0.642661, -1.19317e-012, },
-	{ 0.451121, 0.109117, -0.149352, 0.766151, 0.642661, -1.19317e-012, },
-	{ 0.451121, 0.109117, -0.179352, 0.766151, 0.642661, -1.19317e-012, },
-	{ 0.46148, 0.0948611, -0.149352, 0.808963, 0.58786, -1.09143e-012, },
-	{ 0.46148, 0.0948611, -0.179352, 0.808963, 0.58786, -1.09143e-012, },
-	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.463555, 0.0356337, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.462817, 0.10883, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.456691, 0.0581832, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.463555, 0.0356337, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.447911, 0.0788968, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.456691, 0.0581832, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.447911, 0.0788968, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.439098, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.462817, 0.10883, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.463555, 0.0356337, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.481675, 0.0726708, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.481675, 0.0726708, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.463555, 0.0356337, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.467986, 0.0114479, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.481675, 0.0726708, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.467986, 0.0114479, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.469462, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.469462, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.481755, -0.100861, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.481675, 0.0726708, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.468006, -0.0398971, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.481755, -0.100861, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.469462, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.463635, -0.0637437, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.481755, -0.100861, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.468006, -0.0398971, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.463635, -0.0637437, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.462917, -0.137139, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.481755, -0.100861, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.456791, -0.0860736, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.462917, -0.137139, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.463635, -0.0637437, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.447911, -0.107246, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.462917, -0.137139, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.456791, -0.0860736, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.447911, -0.107246, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.438013, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.462917, -0.137139, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.437853, -0.125745, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.438013, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.447911, -0.107246, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.426199, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.438013, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.437853, -0.125745, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.401455, -0.169666, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.438013, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.426199, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.438013, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.401455, -0.169666, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.401455, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.426199, -0.142607, -0.149352, -0.782115, 0.623134, -1.15692e-012, },
-	{ 0.401455, -0.169666, -0.179352, -0.737967, 0.674837, -1.25291e-012, },
-	{ 0.401455, -0.169666, -0.149352, -0.737967, 0.674837, -1.25291e-012, },
-	{ 0.401455, -0.169666, -0.179352, -0.737967, 0.674837, -1.25291e-012, },
-	{ 0.426199, -0.142607, -0.149352, -0.782115, 0.623134, -1.15692e-012, },
-	{ 0.426199, -0.142607, -0.179352, -0.782115, 0.623134, -1.15692e-012, },
-	{ 0.437853, -0.125745, -0.149352, -0.85181, 0.52385, -9.72587e-013, },
-	{ 0.426199, -0.142607, -0.179352, -0.782115, 0.623134, -1.15692e-012, },
-	{ 0.426199, -0.142607, -0.149352, -0.782115, 0.623134, -1.15692e-012, },
-	{ 0.426199, -0.142607, -0.179352, -0.782115, 0.623134, -1.15692e-012, },
-	{ 0.437853, -0.125745, -0.149352, -0.85181, 0.52385, -9.72587e-013, },
-	{ 0.437853, -0.125745, -0.179352, -0.85181, 0.52385, -9.72587e-013, },
-	{ 0.447911, -0.107246, -0.149352, -0.901507, 0.432766, -8.03478e-013, },
-	{ 0.437853, -0.125745, -0.179352, -0.85181, 0.52385, -9.72587e-013, },
-	{ 0.437853, -0.125745, -0.149352, -0.85181, 0.52385, -9.72587e-013, },
-	{ 0.437853, -0.125745, -0.179352, -0.85181, 0.52385, -9.72587e-013, },
-	{ 0.447911, -0.107246, -0.149352, -0.901507, 0.432766, -8.03478e-013, },
-	{ 0.447911, -0.107246, -0.179352, -0.901507, 0.432766, -8.03478e-013, },
-	{ 0.447911, -0.107246, -0.149352, -0.901507, 0.432766, -8.03478e-013, },
-	{ 0.456791, -0.0860736, -0.179352, -0.940302, 0.340342, -6.31884e-013, },
-	{ 0.447911, -0.107246, -0.179352, -0.901507, 0.432766, -8.03478e-013, },
-	{ 0.456791, -0.0860736, -0.179352, -0.940302, 0.340342, -6.31884e-013, },
-	{ 0.447911, -0.107246, -0.149352, -0.901507, 0.432766, -8.03478e-013, },
-	{ 0.456791, -0.0860736, -0.149352, -0.940302, 0.340342, -6.31884e-013, },
-	{ 0.456791, -0.0860736, -0.149352, -0.940302, 0.340342, -6.31884e-013, },
-	{ 0.463635, -0.0637437, -0.179352, -0.971494, 0.237063, -4.40134e-013, },
-	{ 0.456791, -0.0860736, -0.179352, -0.940302, 0.340342, -6.31884e-013, },
-	{ 0.463635, -0.0637437, -0.179352, -0.971494, 0.237063, -4.40134e-013, },
-	{ 0.456791, -0.0860736, -0.149352, -0.940302, 0.340342, -6.31884e-013, },
-	{ 0.463635, -0.0637437, -0.149352, -0.971494, 0.237063, -4.40134e-013, },
-	{ 0.481675, 0.0726708, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.481755, -0.100861, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.488624, 0.0532942, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.488624, 0.0532942, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.481755, -0.100861, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.488669, -0.081434, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.488624, 0.0532942, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.488669, -0.081434, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.493588, 0.0323611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.493588, 0.0323611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.488669, -0.081434, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.493608, -0.0605109, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.493588, 0.0323611, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.493608, -0.0605109, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.496567, 0.00987145, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.496567, 0.00987145, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.493608, -0.0605109, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.496572, -0.0380911, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.496567, 0.00987145, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.496572, -0.0380911, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.497559, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.447911, 0.0788968, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.438013, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.462817, 0.10883, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.437534, 0.0976947, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.438013, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.447911, 0.0788968, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.42588, 0.114497, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.438013, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.437534, 0.0976947, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.401455, 0.141317, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.438013, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.42588, 0.114497, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.438013, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.401455, 0.141317, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.401455, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.42588, 0.114497, -0.179352, -0.782232, -0.622987, 1.15665e-012, },
-	{ 0.401455, 0.141317, -0.149352, -0.739342, -0.67333, 1.25011e-012, },
-	{ 0.401455, 0.141317, -0.179352, -0.739342, -0.67333, 1.25011e-012, },
-	{ 0.401455, 0.141317, -0.149352, -0.739342, -0.67333, 1.25011e-012, },
-	{ 0.42588, 0.114497, -0.179352, -0.782232, -0.622987, 1.15665e-012, },
-	{ 0.42588, 0.114497, -0.149352, -0.782232, -0.622987, 1.15665e-012, },
-	{ 0.437534, 0.0976947, -0.179352, -0.84969, -0.527283, 9.78809e-013, },
-	{ 0.42588, 0.114497, -0.149352, -0.782232, -0.622987, 1.15665e-012, },
-	{ 0.42588, 0.114497, -0.179352, -0.782232, -0.622987, 1.15665e-012, },
-	{ 0.42588, 0.114497, -0.149352, -0.782232, -0.622987, 1.15665e-012, },
-	{ 0.437534, 0.0976947, -0.179352, -0.84969, -0.527283, 9.78809e-013, },
-	{ 0.437534, 0.0976947, -0.149352, -0.84969, -0.527283, 9.78809e-013, },
-	{ 0.447911, 0.0788968, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.462817, 0.10883, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.456691, 0.0581832, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.456691, 0.0581832, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.462817, 0.10883, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.463555, 0.0356337, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.463555, 0.0356337, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.462817, 0.10883, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.481675, 0.0726708, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.463555, 0.0356337, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.481675, 0.0726708, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.467986, 0.0114479, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.467986, 0.0114479, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.481675, 0.0726708, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.469462, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.481755, -0.100861, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.469462, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.481675, 0.0726708, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.481755, -0.100861, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.468006, -0.0398971, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.469462, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.481755, -0.100861, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.481675, 0.0726708, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.488624, 0.0532942, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.481755, -0.100861, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.488624, 0.0532942, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.488669, -0.081434, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.488669, -0.081434, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.488624, 0.0532942, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.493588, 0.0323611, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.488669, -0.081434, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.493588, 0.0323611, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.493608, -0.0605109, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.493608, -0.0605109, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.493588, 0.0323611, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.496567, 0.00987145, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.493608, -0.0605109, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.496567, 0.00987145, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.496572, -0.0380911, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.496572, -0.0380911, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.496567, 0.00987145, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.497559, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.33636, 0.131978, -0.149352, 0.376579, 0.926384, -1.71998e-012, },
-	{ 0.325036, 0.135271, -0.149352, 0.184752, 0.982785, -1.82469e-012, },
-	{ 0.326674, 0.134794, -0.149352, 0.279188, 0.960237, -1.78287e-012, },
-	{ 0.33636, 0.131978, -0.149352, 0.376579, 0.926384, -1.71998e-012, },
-	{ 0.325036, 0.135271, -0.179352, 0.184752, 0.982785, -1.82469e-012, },
-	{ 0.325036, 0.135271, -0.149352, 0.184752, 0.982785, -1.82469e-012, },
-	{ 0.325036, 0.135271, -0.179352, 0.184752, 0.982785, -1.82469e-012, },
-	{ 0.33636, 0.131978, -0.149352, 0.376579, 0.926384, -1.71998e-012, },
-	{ 0.33636, 0.131978, -0.179352, 0.376579, 0.926384, -1.71998e-012, },
-	{ 0.33636, 0.131978, -0.149352, 0.376579, 0.926384, -1.71998e-012, },
-	{ 0.346667, 0.12649, -0.179352, 0.556478, 0.830862, -1.54259e-012, },
-	{ 0.33636, 0.131978, -0.179352, 0.376579, 0.926384, -1.71998e-012, },
-	{ 0.346667, 0.12649, -0.179352, 0.556478, 0.830862, -1.54259e-012, },
-	{ 0.33636, 0.131978, -0.149352, 0.376579, 0.926384, -1.71998e-012, },
-	{ 0.346667, 0.12649, -0.149352, 0.556478, 0.830862, -1.54259e-012, },
-	{ 0.33636, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.338236, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.346667, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.33636, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.326742, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.338236, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.326742, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.33636, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.112102, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.326742, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.112102, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.298645, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.112102, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.287151, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.298645, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.279488, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.287151, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.279229, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.279488, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.27872, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.279488, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.279229, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.27872, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.276934, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.279488, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.27872, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.26959, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.276934, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.26943, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.26959, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.27872, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.26943, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.261837, 0.0416702, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.26959, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.261748, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.261837, 0.0416702, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.26943, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.261748, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.2563, 0.0519572, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.261837, 0.0416702, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.25626, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.2563, 0.0519572, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.261748, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.25626, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.252977, 0.0633018, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.2563, 0.0519572, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.252967, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.252977, 0.0633018, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.25626, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.252977, 0.0633018, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.252967, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.25187, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.252967, 0.0879765, -0.149352, -0.982629, 0.185582, -3.44553e-013, },
-	{ 0.25187, 0.075704, -0.179352, -1, 6.48887e-005, -1.20473e-016, },
-	{ 0.25187, 0.075704, -0.149352, -1, 6.48887e-005, -1.20473e-016, },
-	{ 0.25187, 0.075704, -0.179352, -1, 6.48887e-005, -1.20473e-016, },
-	{ 0.252967, 0.0879765, -0.149352, -0.982629, 0.185582, -3.44553e-013, },
-	{ 0.252967, 0.0879765, -0.179352, -0.982629, 0.185582, -3.44553e-013, },
-	{ 0.25626, 0.0992512, -0.149352, -0.925933, 0.377687, -7.01219e-013, },
-	{ 0.252967, 0.0879765, -0.179352, -0.982629, 0.185582, -3.44553e-013, },
-	{ 0.252967, 0.0879765, -0.149352, -0.982629, 0.185582, -3.44553e-013, },
-	{ 0.252967, 0.0879765, -0.179352, -0.982629, 0.185582, -3.44553e-013, },
-	{ 0.25626, 0.0992512, -0.149352, -0.925933, 0.377687, -7.01219e-013, },
-	{ 0.25626, 0.0992512, -0.179352, -0.925933, 0.377687, -7.01219e-013, },
-	{ 0.261748, 0.109528, -0.149352, -0.830379, 0.557199, -1.0345e-012, },
-	{ 0.25626, 0.0992512, -0.179352, -0.925933, 0.377687, -7.01219e-013, },
-	{ 0.25626, 0.0992512, -0.149352, -0.925933, 0.377687, -7.01219e-013, },
-	{ 0.25626, 0.0992512, -0.179352, -0.925933, 0.377687, -7.01219e-013, },
-	{ 0.261748, 0.109528, -0.149352, -0.830379, 0.557199, -1.0345e-012, },
-	{ 0.261748, 0.109528, -0.179352, -0.830379, 0.557199, -1.0345e-012, },
-	{ 0.26943, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
-	{ 0.261748, 0.109528, -0.179352, -0.830379, 0.557199, -1.0345e-012, },
-	{ 0.261748, 0.109528, -0.149352, -0.830379, 0.557199, -1.0345e-012, },
-	{ 0.261748, 0.109528, -0.179352, -0.830379, 0.557199, -1.0345e-012, },
-	{ 0.26943, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
-	{ 0.26943, 0.118807, -0.179352, -0.70692, 0.707293, -1.31317e-012, },
-	{ 0.26943, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
-	{ 0.27872, 0.12649, -0.179352, -0.556478, 0.830862, -1.54259e-012, },
-	{ 0.26943, 0.118807, -0.179352, -0.70692, 0.707293, -1.31317e-012, },
-	{ 0.27872, 0.12649, -0.179352, -0.556478, 0.830862, -1.54259e-012, },
-	{ 0.26943, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
-	{ 0.27872, 0.12649, -0.149352, -0.556478, 0.830862, -1.54259e-012, },
-	{ 0.289026, 0.131978, -0.149352, -0.376579, 0.926384, -1.71994e-012, },
-	{ 0.27872, 0.12649, -0.179352, -0.556478, 0.830862, -1.54259e-012, },
-	{ 0.27872, 0.12649, -0.149352, -0.556478, 0.830862, -1.54259e-012, },
-	{ 0.27872, 0.12649, -0.179352, -0.556478, 0.830862, -1.54259e-012, },
-	{ 0.289026, 0.131978, -0.149352, -0.376579, 0.926384, -1.71994e-012, },
-	{ 0.289026, 0.131978, -0.179352, -0.376579, 0.926384, -1.71994e-012, },
-	{ 0.289026, 0.131978, -0.149352, -0.376579, 0.926384, -1.71994e-012, },
-	{ 0.27872, 0.12649, -0.149352, -0.556478, 0.830862, -1.54259e-012, },
-	{ 0.279229, 0.126762, -0.149352, -0.469967, 0.882684, -1.63881e-012, },
-	{ 0.278929, 0.0248279, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.276934, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.26959, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.276934, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.278929, 0.0248279, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.279548, 0.0613761, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.279548, 0.0613761, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.278929, 0.0248279, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.289226, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.278929, 0.0248279, -0.179352, -0.552115, -0.833768, 1.54798e-012, },
-	{ 0.289226, 0.0193901, -0.149352, -0.374648, -0.927167, 1.72139e-012, },
-	{ 0.278929, 0.0248279, -0.149352, -0.552115, -0.833768, 1.54798e-012, },
-	{ 0.289226, 0.0193901, -0.149352, -0.374648, -0.927167, 1.72139e-012, },
-	{ 0.278929, 0.0248279, -0.179352, -0.552115, -0.833768, 1.54798e-012, },
-	{ 0.289226, 0.0193901, -0.179352, -0.374648, -0.927167, 1.72139e-012, },
-	{ 0.278929, 0.0248279, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.279548, 0.0613761, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.289226, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.289226, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.279548, 0.0613761, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.28739, 0.0496823, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.279548, 0.0613761, -0.179352, 0.926569, 0.376125, -6.98317e-013, },
-	{ 0.28739, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
-	{ 0.28739, 0.0496823, -0.179352, 0.707819, 0.706394, -1.3115e-012, },
-	{ 0.28739, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
-	{ 0.279548, 0.0613761, -0.179352, 0.926569, 0.376125, -6.98317e-013, },
-	{ 0.279548, 0.0613761, -0.149352, 0.926569, 0.376125, -6.98317e-013, },
-	{ 0.279548, 0.0613761, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.289226, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.28739, 0.0496823, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.28739, 0.0496823, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.289226, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.298944, 0.0418997, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.298944, 0.0418997, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.289226, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.300481, 0.0161274, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.289226, 0.0193901, -0.179352, -0.374648, -0.927167, 1.72139e-012, },
-	{ 0.300481, 0.0161274, -0.149352, -0.184427, -0.982846, 1.82476e-012, },
-	{ 0.289226, 0.0193901, -0.149352, -0.374648, -0.927167, 1.72139e-012, },
-	{ 0.300481, 0.0161274, -0.149352, -0.184427, -0.982846, 1.82476e-012, },
-	{ 0.289226, 0.0193901, -0.179352, -0.374648, -0.927167, 1.72139e-012, },
-	{ 0.300481, 0.0161274, -0.179352, -0.184427, -0.982846, 1.82476e-012, },
-	{ 0.289226, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.298944, 0.0418997, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.300481, 0.0161274, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.289226, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.28739, 0.0496823, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.298944, 0.0418997, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.28739, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
-	{ 0.298944, 0.0418997, -0.179352, 0.379845, 0.92505, -1.71746e-012, },
-	{ 0.28739, 0.0496823, -0.179352, 0.707819, 0.706394, -1.3115e-012, },
-	{ 0.298944, 0.0418997, -0.179352, 0.379845, 0.92505, -1.71746e-012, },
-	{ 0.28739, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
-	{ 0.298944, 0.0418997, -0.149352, 0.379845, 0.92505, -1.71746e-012, },
-	{ 0.298944, 0.0418997, -0.149352, 0.379845, 0.92505, -1.71746e-012, },
-	{ 0.312693, 0.0393055, -0.179352, -0.000116454, 1, -1.85661e-012, },
-	{ 0.298944, 0.0418997, -0.179352, 0.379845, 0.92505, -1.71746e-012, },
-	{ 0.312693, 0.0393055, -0.179352, -0.000116454, 1, -1.85661e-012, },
-	{ 0.298944, 0.0418997, -0.149352, 0.379845, 0.92505, -1.71746e-012, },
-	{ 0.312693, 0.0393055, -0.149352, -0.000116454, 1, -1.85661e-012, },
-	{ 0.298944, 0.0418997, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.300481, 0.0161274, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.300481, 0.0161274, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.0150399, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.300481, 0.0161274, -0.179352, -0.184427, -0.982846, 1.82476e-012, },
-	{ 0.312693, 0.0150399, -0.149352, -6.3234e-005, -1, 1.85661e-012, },
-	{ 0.300481, 0.0161274, -0.149352, -0.184427, -0.982846, 1.82476e-012, },
-	{ 0.312693, 0.0150399, -0.149352, -6.3234e-005, -1, 1.85661e-012, },
-	{ 0.300481, 0.0161274, -0.179352, -0.184427, -0.982846, 1.82476e-012, },
-	{ 0.312693, 0.0150399, -0.179352, -6.3234e-005, -1, 1.85661e-012, },
-	{ 0.300481, 0.0161274, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.312693, 0.0393055, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.312693, 0.0150399, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.300481, 0.0161274, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.298944, 0.0418997, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.312693, 0.0393055, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.312693, 0.0150399, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.312693, 0.0393055, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.326742, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.312693, 0.0393055, -0.149352, -0.000116454, 1, -1.85661e-012, },
-	{ 0.326742, 0.0419596, -0.179352, -0.385978, 0.922508, -1.71274e-012, },
-	{ 0.312693, 0.0393055, -0.179352, -0.000116454, 1, -1.85661e-012, },
-	{ 0.326742, 0.0419596, -0.179352, -0.385978, 0.922508, -1.71274e-012, },
-	{ 0.312693, 0.0393055, -0.149352, -0.000116454, 1, -1.85661e-012, },
-	{ 0.326742, 0.0419596, -0.149352, -0.385978, 0.922508, -1.71274e-012, },
-	{ 0.312693, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.325036, 0.0161374, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.326742, 0.0419596, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.0150399, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.325036, 0.0161374, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.312693, 0.0150399, -0.179352, -6.3234e-005, -1, 1.85661e-012, },
-	{ 0.325036, 0.0161374, -0.149352, 0.184752, -0.982785, 1.82465e-012, },
-	{ 0.312693, 0.0150399, -0.149352, -6.3234e-005, -1, 1.85661e-012, },
-	{ 0.325036, 0.0161374, -0.149352, 0.184752, -0.982785, 1.82465e-012, },
-	{ 0.312693, 0.0150399, -0.179352, -6.3234e-005, -1, 1.85661e-012, },
-	{ 0.325036, 0.0161374, -0.179352, 0.184752, -0.982785, 1.82465e-012, },
-	{ 0.312693, 0.0150399, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.326742, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.325036, 0.0161374, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.325036, 0.0161374, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.326742, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.33636, 0.01943, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.33636, 0.01943, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.326742, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.338236, 0.0499217, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.326742, 0.0419596, -0.149352, -0.385978, 0.922508, -1.71274e-012, },
-	{ 0.338236, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
-	{ 0.326742, 0.0419596, -0.179352, -0.385978, 0.922508, -1.71274e-012, },
-	{ 0.338236, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
-	{ 0.326742, 0.0419596, -0.149352, -0.385978, 0.922508, -1.71274e-012, },
-	{ 0.338236, 0.0499217, -0.149352, -0.716961, 0.697114, -1.29427e-012, },
-	{ 0.326742, 0.0419596, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.33636, 0.01943, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.338236, 0.0499217, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.326742, 0.0419596, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.325036, 0.0161374, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.33636, 0.01943, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.325036, 0.0161374, -0.179352, 0.184752, -0.982785, 1.82465e-012, },
-	{ 0.33636, 0.01943, -0.149352, 0.376579, -0.926384, 1.71994e-012, },
-	{ 0.325036, 0.0161374, -0.149352, 0.184752, -0.982785, 1.82465e-012, },
-	{ 0.33636, 0.01943, -0.149352, 0.376579, -0.926384, 1.71994e-012, },
-	{ 0.325036, 0.0161374, -0.179352, 0.184752, -0.982785, 1.82465e-012, },
-	{ 0.33636, 0.01943, -0.179352, 0.376579, -0.926384, 1.71994e-012, },
-	{ 0.33636, 0.01943, -0.179352, 0.376579, -0.926384, 1.71994e-012, },
-	{ 0.346667, 0.0249177, -0.149352, 0.556478, -0.830862, 1.54259e-012, },
-	{ 0.33636, 0.01943, -0.149352, 0.376579, -0.926384, 1.71994e-012, },
-	{ 0.346667, 0.0249177, -0.149352, 0.556478, -0.830862, 1.54259e-012, },
-	{ 0.33636, 0.01943, -0.179352, 0.376579, -0.926384, 1.71994e-012, },
-	{ 0.346667, 0.0249177, -0.179352, 0.556478, -0.830862, 1.54259e-012, },
-	{ 0.33636, 0.01943, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.338236, 0.0499217, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.346667, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.346667, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.338236, 0.0499217, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.345899, 0.0616754, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.338236, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
-	{ 0.345899, 0.0616754, -0.149352, -0.929063, 0.369922, -6.86802e-013, },
-	{ 0.345899, 0.0616754, -0.179352, -0.929063, 0.369922, -6.86802e-013, },
-	{ 0.345899, 0.0616754, -0.149352, -0.929063, 0.369922, -6.86802e-013, },
-	{ 0.338236, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
-	{ 0.338236, 0.0499217, -0.149352, -0.716961, 0.697114, -1.29427e-012, },
-	{ 0.338236, 0.0499217, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.346667, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.345899, 0.0616754, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.338236, 0.0499217, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.33636, 0.01943, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.346667, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.345899, 0.0616754, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.346667, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.348453, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.348453, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.346667, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.355957, 0.0326005, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.346667, 0.0249177, -0.179352, 0.556478, -0.830862, 1.54259e-012, },
-	{ 0.355957, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
-	{ 0.346667, 0.0249177, -0.149352, 0.556478, -0.830862, 1.54259e-012, },
-	{ 0.355957, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
-	{ 0.346667, 0.0249177, -0.179352, 0.556478, -0.830862, 1.54259e-012, },
-	{ 0.355957, 0.0326005, -0.179352, 0.70692, -0.707293, 1.31317e-012, },
-	{ 0.346667, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.348453, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.355957, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.346667, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.345899, 0.0616754, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.348453, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.345899, 0.0616754, -0.179352, -0.929063, 0.369922, -6.86802e-013, },
-	{ 0.348453, 0.075704, -0.149352, -1, 0.000622437, -1.15562e-015, },
-	{ 0.348453, 0.075704, -0.179352, -1, 0.000622437, -1.15562e-015, },
-	{ 0.348453, 0.075704, -0.149352, -1, 0.000622437, -1.15562e-015, },
-	{ 0.345899, 0.0616754, -0.179352, -0.929063, 0.369922, -6.86802e-013, },
-	{ 0.345899, 0.0616754, -0.149352, -0.929063, 0.369922, -6.86802e-013, },
-	{ 0.345899, 0.0898323, -0.149352, -0.929149, -0.369705, 6.86399e-013, },
-	{ 0.348453, 0.075704, -0.179352, -1, 0.000622437, -1.15562e-015, },
-	{ 0.348453, 0.075704, -0.149352, -1, 0.000622437, -1.15562e-015, },
-	{ 0.348453, 0.075704, -0.179352, -1, 0.000622437, -1.15562e-015, },
-	{ 0.345899, 0.0898323, -0.149352, -0.929149, -0.369705, 6.86399e-013, },
-	{ 0.345899, 0.0898323, -0.179352, -0.929149, -0.369705, 6.86399e-013, },
-	{ 0.338236, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
-	{ 0.345899, 0.0898323, -0.179352, -0.929149, -0.369705, 6.86399e-013, },
-	{ 0.345899, 0.0898323, -0.149352, -0.929149, -0.369705, 6.86399e-013, },
-	{ 0.345899, 0.0898323, -0.179352, -0.929149, -0.369705, 6.86399e-013, },
-	{ 0.338236, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
-	{ 0.338236, 0.101566, -0.179352, -0.715458, -0.698656, 1.29713e-012, },
-	{ 0.338236, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
-	{ 0.326742, 0.109468, -0.179352, -0.383717, -0.923451, 1.71449e-012, },
-	{ 0.338236, 0.101566, -0.179352, -0.715458, -0.698656, 1.29713e-012, },
-	{ 0.326742, 0.109468, -0.179352, -0.383717, -0.923451, 1.71449e-012, },
-	{ 0.338236, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
-	{ 0.326742, 0.109468, -0.149352, -0.383717, -0.923451, 1.71449e-012, },
-	{ 0.326742, 0.109468, -0.149352, -0.383717, -0.923451, 1.71449e-012, },
-	{ 0.312693, 0.112102, -0.179352, 1.17193e-015, -1, 1.85661e-012, },
-	{ 0.326742, 0.109468, -0.179352, -0.383717, -0.923451, 1.71449e-012, },
-	{ 0.312693, 0.112102, -0.179352, 1.17193e-015, -1, 1.85661e-012, },
-	{ 0.326742, 0.109468, -0.149352, -0.383717, -0.923451, 1.71449e-012, },
-	{ 0.312693, 0.112102, -0.149352, 1.17193e-015, -1, 1.85661e-012, },
-	{ 0.312693, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.325036, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.326742, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.312693, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.312693, 0.136368, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.325036, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.312693, 0.136368, -0.149352, -3.20449e-016, 1, -1.85661e-012, },
-	{ 0.325036, 0.135271, -0.179352, 0.184752, 0.982785, -1.82469e-012, },
-	{ 0.312693, 0.136368, -0.179352, -3.20449e-016, 1, -1.85661e-012, },
-	{ 0.325036, 0.135271, -0.179352, 0.184752, 0.982785, -1.82469e-012, },
-	{ 0.312693, 0.136368, -0.149352, -3.20449e-016, 1, -1.85661e-012, },
-	{ 0.325036, 0.135271, -0.149352, 0.184752, 0.982785, -1.82469e-012, },
-	{ 0.326742, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.325036, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.33636, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.326742, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.33636, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.338236, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.338236, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.33636, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.346667, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.338236, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.346667, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.345899, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.345899, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.346667, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.348453, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.348453, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.346667, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.355957, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.346667, 0.12649, -0.149352, 0.556478, 0.830862, -1.54259e-012, },
-	{ 0.355957, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
-	{ 0.346667, 0.12649, -0.179352, 0.556478, 0.830862, -1.54259e-012, },
-	{ 0.355957, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
-	{ 0.346667, 0.12649, -0.149352, 0.556478, 0.830862, -1.54259e-012, },
-	{ 0.355957, 0.118807, -0.149352, 0.70692, 0.707293, -1.31317e-012, },
-	{ 0.346667, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.348453, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.355957, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.346667, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.345899, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.348453, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.346667, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.338236, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.345899, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.355957, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.348453, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.355957, 0.0326005, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.355957, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.355957, 0.0326005, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.363639, 0.0418797, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.355957, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
-	{ 0.363639, 0.0418797, -0.179352, 0.830379, -0.557199, 1.0345e-012, },
-	{ 0.363639, 0.0418797, -0.149352, 0.830379, -0.557199, 1.0345e-012, },
-	{ 0.363639, 0.0418797, -0.179352, 0.830379, -0.557199, 1.0345e-012, },
-	{ 0.355957, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
-	{ 0.355957, 0.0326005, -0.179352, 0.70692, -0.707293, 1.31317e-012, },
-	{ 0.355957, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.363639, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.363639, 0.0418797, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.355957, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.355957, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.363639, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.355957, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.348453, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.355957, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.355957, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
-	{ 0.363639, 0.109528, -0.149352, 0.830379, 0.557199, -1.0345e-012, },
-	{ 0.363639, 0.109528, -0.179352, 0.830379, 0.557199, -1.0345e-012, },
-	{ 0.363639, 0.109528, -0.149352, 0.830379, 0.557199, -1.0345e-012, },
-	{ 0.355957, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
-	{ 0.355957, 0.118807, -0.149352, 0.70692, 0.707293, -1.31317e-012, },
-	{ 0.355957, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.363639, 0.0418797, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.363639, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.363639, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.363639, 0.0418797, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.369127, 0.0521567, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.363639, 0.0418797, -0.149352, 0.830379, -0.557199, 1.0345e-012, },
-	{ 0.369127, 0.0521567, -0.179352, 0.925933, -0.377687, 7.01219e-013, },
-	{ 0.369127, 0.0521567, -0.149352, 0.925933, -0.377687, 7.01219e-013, },
-	{ 0.369127, 0.0521567, -0.179352, 0.925933, -0.377687, 7.01219e-013, },
-	{ 0.363639, 0.0418797, -0.149352, 0.830379, -0.557199, 1.0345e-012, },
-	{ 0.363639, 0.0418797, -0.179352, 0.830379, -0.557199, 1.0345e-012, },
-	{ 0.363639, 0.0418797, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.369127, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.369127, 0.0521567, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.363639, 0.0418797, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.363639, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.369127, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.363639, 0.109528, -0.179352, 0.830379, 0.557199, -1.0345e-012, },
-	{ 0.369127, 0.0992512, -0.149352, 0.925933, 0.377687, -7.01219e-013, },
-	{ 0.369127, 0.0992512, -0.179352, 0.925933, 0.377687, -7.01219e-013, },
-	{ 0.369127, 0.0992512, -0.149352, 0.925933, 0.377687, -7.01219e-013, },
-	{ 0.363639, 0.109528, -0.179352, 0.830379, 0.557199, -1.0345e-012, },
-	{ 0.363639, 0.109528, -0.149352, 0.830379, 0.557199, -1.0345e-012, },
-	{ 0.363639, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.369127, 0.0521567, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.369127, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.369127, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.369127, 0.0521567, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.37242, 0.0634315, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.369127, 0.0521567, -0.149352, 0.925933, -0.377687, 7.01219e-013, },
-	{ 0.37242, 0.0634315, -0.179352, 0.982629, -0.185582, 3.44553e-013, },
-	{ 0.37242, 0.0634315, -0.149352, 0.982629, -0.185582, 3.44553e-013, },
-	{ 0.37242, 0.0634315, -0.179352, 0.982629, -0.185582, 3.44553e-013, },
-	{ 0.369127, 0.0521567, -0.149352, 0.925933, -0.377687, 7.01219e-013, },
-	{ 0.369127, 0.0521567, -0.179352, 0.925933, -0.377687, 7.01219e-013, },
-	{ 0.369127, 0.0521567, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.37242, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.37242, 0.0634315, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.369127, 0.0521567, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.369127, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.37242, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.369127, 0.0992512, -0.179352, 0.925933, 0.377687, -7.01219e-013, },
-	{ 0.37242, 0.0879765, -0.149352, 0.982629, 0.185582, -3.44553e-013, },
-	{ 0.37242, 0.0879765, -0.179352, 0.982629, 0.185582, -3.44553e-013, },
-	{ 0.37242, 0.0879765, -0.149352, 0.982629, 0.185582, -3.44553e-013, },
-	{ 0.369127, 0.0992512, -0.179352, 0.925933, 0.377687, -7.01219e-013, },
-	{ 0.369127, 0.0992512, -0.149352, 0.925933, 0.377687, -7.01219e-013, },
-	{ 0.369127, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.37242, 0.0634315, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.37242, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.37242, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.37242, 0.0634315, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.373517, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
-	{ 0.37242, 0.0634315, -0.149352, 0.982629, -0.185582, 3.44553e-013, },
-	{ 0.373517, 0.075704, -0.179352, 1, -1.60231e-016, 2.97488e-028, },
-	{ 0.373517, 0.075704, -0.149352, 1, -1.60231e-016, 2.97488e-028, },
-	{ 0.373517, 0.075704, -0.179352, 1, -1.60231e-016, 2.97488e-028, },
-	{ 0.37242, 0.0634315, -0.149352, 0.982629, -0.185582, 3.44553e-013, },
-	{ 0.37242, 0.0634315, -0.179352, 0.982629, -0.185582, 3.44553e-013, },
-	{ 0.37242, 0.0634315, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.37242, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.373517, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
-	{ 0.37242, 0.0879765, -0.179352, 0.982629, 0.185582, -3.44553e-013, },
-	{ 0.373517, 0.075704, -0.149352, 1, -1.60231e-016, 2.97488e-028, },
-	{ 0.373517, 0.075704, -0.179352, 1, -1.60231e-016, 2.97488e-028, },
-	{ 0.373517, 0.075704, -0.149352, 1, -1.60231e-016, 2.97488e-028, },
-	{ 0.37242, 0.0879765, -0.179352, 0.982629, 0.185582, -3.44553e-013, },
-	{ 0.37242, 0.0879765, -0.149352, 0.982629, 0.185582, -3.44553e-013, },
-	{ 0.258974, 0.140479, -0.179352, -0.433645, 0.901084, -1.67296e-012, },
-	{ 0.243912, 0.131926, -0.149352, -0.554528, 0.832165, -1.54501e-012, },
-	{ 0.258974, 0.140479, -0.149352, -0.433645, 0.901084, -1.67296e-012, },
-	{ 0.243912, 0.131926, -0.149352, -0.554528, 0.832165, -1.54501e-012, },
-	{ 0.258974, 0.140479, -0.179352, -0.433645, 0.901084, -1.67296e-012, },
-	{ 0.243912, 0.131926, -0.179352, -0.554528, 0.832165, -1.54501e-012, },
+	{ 0xb7b8, 0x20f4, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb7b8, 0xa8ed, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb7bc, 0xa342, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb7ac, 0x281b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb7b8, 0x20f4, 0xb1bd, 0x3c00, 0x0000b203 },
+	{ 0xb7ac, 0x281b, 0xb0c7, 0x3c00, 0x00017209 },
+	{ 0xb7ac, 0x281b, 0xb1bd, 0x3c00, 0x00017209 },
+	{ 0xb7b8, 0x20f4, 0xb0c7, 0x3c00, 0x0000b203 },
+	{ 0xb7bc, 0xa342, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0xb7bc, 0xa342, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0xb7b8, 0xa8ed, 0xb1bd, 0x3c00, 0x000f5203 },
+	{ 0xb7b8, 0xa8ed, 0xb0c7, 0x3c00, 0x000f5203 },
+	{ 0xb7ac, 0xabd2, 0xb0c7, 0x3c00, 0x000e9209 },
+	{ 0xb7ac, 0xabd2, 0xb1bd, 0x3c00, 0x000e9209 },
+	{ 0xb7ac, 0xabd2, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb798, 0x2ac8, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb798, 0x2ac8, 0xb0c7, 0x3c00, 0x00024216 },
+	{ 0xb798, 0x2ac8, 0xb1bd, 0x3c00, 0x00024216 },
+	{ 0xb7ac, 0x281b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb7ac, 0xabd2, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb798, 0x2ac8, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb7b8, 0xa8ed, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb7b8, 0x20f4, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb7bc, 0xa342, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb798, 0xad41, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb798, 0xad41, 0xb0c7, 0x3c00, 0x000dba16 },
+	{ 0xb798, 0xad41, 0xb1bd, 0x3c00, 0x000dba16 },
+	{ 0xb798, 0xad41, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb77c, 0x2ca3, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb77c, 0x2ca3, 0xb0c7, 0x3c00, 0x00032e2b },
+	{ 0xb77c, 0x2ca3, 0xb1bd, 0x3c00, 0x00032e2b },
+	{ 0xb77c, 0x2ca3, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb77b, 0xae7c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb77b, 0xae7c, 0xb0c7, 0x3c00, 0x000cca2c },
+	{ 0xb77b, 0xae7c, 0xb1bd, 0x3c00, 0x000cca2c },
+	{ 0xb77b, 0xae7c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb72f, 0x2ef6, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb72f, 0x2ef6, 0xb0c7, 0x3c00, 0x0004364e },
+	{ 0xb72f, 0x2ef6, 0xb1bd, 0x3c00, 0x0004364e },
+	{ 0xb72f, 0x2ef6, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb749, 0xa342, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb72e, 0xb064, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb743, 0xa929, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb731, 0xac1b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb715, 0xad85, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb6c8, 0xb17b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb72e, 0xb064, 0xb0c7, 0x3c00, 0x000bca4e },
+	{ 0xb6c8, 0xb17b, 0xb1bd, 0x3c00, 0x000b4e63 },
+	{ 0xb6c8, 0xb17b, 0xb0c7, 0x3c00, 0x000b4e63 },
+	{ 0xb72e, 0xb064, 0xb1bd, 0x3c00, 0x000bca4e },
+	{ 0xb749, 0xa342, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb72e, 0xb064, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb743, 0xa929, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb749, 0xa342, 0xb1bd, 0x3c00, 0x000ffdff },
+	{ 0xb743, 0xa929, 0xb0c7, 0x3c00, 0x0000f1fb },
+	{ 0xb743, 0xa929, 0xb1bd, 0x3c00, 0x0000f1fb },
+	{ 0xb749, 0xa342, 0xb0c7, 0x3c00, 0x000ffdff },
+	{ 0xb743, 0x21d2, 0xb1bd, 0x3c00, 0x000f09fb },
+	{ 0xb743, 0x21d2, 0xb0c7, 0x3c00, 0x000f09fb },
+	{ 0xb731, 0x2890, 0xb1bd, 0x3c00, 0x000e1df0 },
+	{ 0xb731, 0x2890, 0xb0c7, 0x3c00, 0x000e1df0 },
+	{ 0xb714, 0x2b75, 0xb1bd, 0x3c00, 0x000d49e1 },
+	{ 0xb714, 0x2b75, 0xb0c7, 0x3c00, 0x000d49e1 },
+	{ 0xb6f1, 0x2d0d, 0xb1bd, 0x3c00, 0x000c85cc },
+	{ 0xb6f1, 0x2d0d, 0xb0c7, 0x3c00, 0x000c85cc },
+	{ 0xb6c6, 0x2e44, 0xb1bd, 0x3c00, 0x000bd1b3 },
+	{ 0xb6c6, 0x2e44, 0xb0c7, 0x3c00, 0x000bd1b3 },
+	{ 0xb698, 0x2f53, 0xb1bd, 0x3c00, 0x000b0990 },
+	{ 0xb698, 0x2f53, 0xb0c7, 0x3c00, 0x000b0990 },
+	{ 0xb633, 0x3086, 0xb1bd, 0x3c00, 0x000a9d79 },
+	{ 0xb633, 0x3086, 0xb0c7, 0x3c00, 0x000a9d79 },
+	{ 0xb633, 0x3086, 0xb1bd, 0x3c00, 0x000001ff },
+	{ 0xb633, 0x3093, 0xb0c7, 0x3c00, 0x000001ff },
+	{ 0xb633, 0x3086, 0xb0c7, 0x3c00, 0x000001ff },
+	{ 0xb633, 0x3093, 0xb1bd, 0x3c00, 0x000001ff },
+	{ 0xb698, 0x2f53, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb633, 0x3093, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb633, 0x3086, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb6c8, 0x3093, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb6c6, 0x2e44, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb6f1, 0x2d0d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb714, 0x2b75, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb731, 0x2890, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb743, 0x21d2, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb6c8, 0x3093, 0xb0c7, 0x3c00, 0x0004ba64 },
+	{ 0xb6c8, 0x3093, 0xb1bd, 0x3c00, 0x0004ba64 },
+	{ 0xb714, 0x2b75, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb6c8, 0x3093, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb731, 0x2890, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb743, 0x21d2, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb6f1, 0x2d0d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb6c6, 0x2e44, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb698, 0x2f53, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb633, 0x3093, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb633, 0x3086, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb633, 0x3093, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0xb6c8, 0x3093, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0xb633, 0x3093, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0xb6c8, 0x3093, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0xb731, 0xac1b, 0xb0c7, 0x3c00, 0x0001e9f0 },
+	{ 0xb731, 0xac1b, 0xb1bd, 0x3c00, 0x0001e9f0 },
+	{ 0xb715, 0xad85, 0xb0c7, 0x3c00, 0x0002bde0 },
+	{ 0xb715, 0xad85, 0xb1bd, 0x3c00, 0x0002bde0 },
+	{ 0xb6f1, 0xaedd, 0xb0c7, 0x3c00, 0x00037dcc },
+	{ 0xb6f1, 0xaedd, 0xb1bd, 0x3c00, 0x00037dcc },
+	{ 0xb6c7, 0xb008, 0xb1bd, 0x3c00, 0x000431b3 },
+	{ 0xb6c7, 0xb008, 0xb0c7, 0x3c00, 0x000431b3 },
+	{ 0xb6f1, 0xaedd, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb6c7, 0xb008, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb697, 0xb092, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb633, 0xb17b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb6c8, 0xb17b, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0xb633, 0xb17b, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0xb6c8, 0xb17b, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0xb633, 0xb17b, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0xb6c8, 0xb17b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb697, 0xb092, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb633, 0xb17b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb6c7, 0xb008, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb6f1, 0xaedd, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb715, 0xad85, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb731, 0xac1b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb697, 0xb092, 0xb0c7, 0x3c00, 0x0004f990 },
+	{ 0xb697, 0xb092, 0xb1bd, 0x3c00, 0x0004f990 },
+	{ 0xb633, 0xb16e, 0xb0c7, 0x3c00, 0x00056579 },
+	{ 0xb633, 0xb16e, 0xb1bd, 0x3c00, 0x00056579 },
+	{ 0xb633, 0xb17b, 0xb0c7, 0x3c00, 0x000001ff },
+	{ 0xb633, 0xb16e, 0xb1bd, 0x3c00, 0x000001ff },
+	{ 0xb633, 0xb16e, 0xb0c7, 0x3c00, 0x000001ff },
+	{ 0xb633, 0xb17b, 0xb1bd, 0x3c00, 0x000001ff },
+	{ 0xb633, 0xb16e, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb633, 0xb16e, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb4a6, 0x2efc, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb467, 0x2e12, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb4d1, 0x2e12, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb475, 0x2fc6, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb4a6, 0x2efc, 0xb1bd, 0x3c00, 0x00052279 },
+	{ 0xb475, 0x2fc6, 0xb0c7, 0x3c00, 0x0005f2ab },
+	{ 0xb475, 0x2fc6, 0xb1bd, 0x3c00, 0x0005f2ab },
+	{ 0xb4a6, 0x2efc, 0xb0c7, 0x3c00, 0x00052279 },
+	{ 0xb4d1, 0x2e12, 0xb1bd, 0x3c00, 0x0004b263 },
+	{ 0xb4d1, 0x2e12, 0xb0c7, 0x3c00, 0x0004b263 },
+	{ 0xb4d1, 0x2e12, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0xb467, 0x2e12, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0xb4d1, 0x2e12, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0xb467, 0x2e12, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0xb420, 0x2f35, 0xb1bd, 0x3c00, 0x0009ad38 },
+	{ 0xb467, 0x2e12, 0xb0c7, 0x3c00, 0x000a716e },
+	{ 0xb467, 0x2e12, 0xb1bd, 0x3c00, 0x000a716e },
+	{ 0xb420, 0x2f35, 0xb0c7, 0x3c00, 0x0009ad38 },
+	{ 0xb388, 0x3002, 0xb0c7, 0x3c00, 0x00089cc2 },
+	{ 0xb388, 0x3002, 0xb1bd, 0x3c00, 0x00089cc2 },
+	{ 0xb420, 0x2f35, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb401, 0x307f, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb388, 0x3002, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb43e, 0x3039, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb43e, 0x3039, 0xb1bd, 0x3c00, 0x0006a6e5 },
+	{ 0xb43e, 0x3039, 0xb0c7, 0x3c00, 0x0006a6e5 },
+	{ 0xb475, 0x2fc6, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb467, 0x2e12, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb43e, 0x3039, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb4a6, 0x2efc, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb4d1, 0x2e12, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb420, 0x2f35, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb401, 0x307f, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb388, 0x3002, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb379, 0x30b5, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb35b, 0x300e, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb2a4, 0x3041, 0xb0c7, 0x3c00, 0x00082457 },
+	{ 0xb35b, 0x300e, 0xb0c7, 0x3c00, 0x00084c87 },
+	{ 0xb2a4, 0x3041, 0xb1bd, 0x3c00, 0x00082457 },
+	{ 0xb379, 0x30b5, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb2a4, 0x3041, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb401, 0x307f, 0xb0c7, 0x3c00, 0x00073322 },
+	{ 0xb379, 0x30b5, 0xb1bd, 0x3c00, 0x00079760 },
+	{ 0xb401, 0x307f, 0xb1bd, 0x3c00, 0x00073322 },
+	{ 0xb379, 0x30b5, 0xb0c7, 0x3c00, 0x00079760 },
+	{ 0xb2e4, 0x30dc, 0xb1bd, 0x3c00, 0x0007d79b },
+	{ 0xb2e4, 0x30dc, 0xb0c7, 0x3c00, 0x0007d79b },
+	{ 0xb2e4, 0x30dc, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb30b, 0x3039, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb2a4, 0x3041, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb2ae, 0x3054, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb249, 0x305d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb1d6, 0x3050, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb194, 0x3055, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0xb1d6, 0x3050, 0xb0c7, 0x3c00, 0x00080827 },
+	{ 0xb194, 0x3055, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0xb242, 0x30f4, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb194, 0x3055, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb2e4, 0x30dc, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb242, 0x30f4, 0xb1bd, 0x3c00, 0x0007f7d0 },
+	{ 0xb242, 0x30f4, 0xb0c7, 0x3c00, 0x0007f7d0 },
+	{ 0xb242, 0x30f4, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb2ae, 0x3054, 0xb1bd, 0x3c00, 0x0007dba2 },
+	{ 0xb30b, 0x3039, 0xb0c7, 0x3c00, 0x00076740 },
+	{ 0xb2ae, 0x3054, 0xb0c7, 0x3c00, 0x0007dba2 },
+	{ 0xb30b, 0x3039, 0xb1bd, 0x3c00, 0x00076740 },
+	{ 0xb2bc, 0x2f02, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb30b, 0x3039, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb2ae, 0x3054, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb31a, 0x2e80, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb359, 0x2dc0, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb35f, 0x300c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb36e, 0x2cd8, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb3aa, 0x2827, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb3ab, 0x2f9b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb3ea, 0x2955, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb3ea, 0x2f03, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb40b, 0x2aa7, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb40c, 0x2e5a, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb419, 0x2c0d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb419, 0x2da1, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb41e, 0x2cd8, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb419, 0x2c0d, 0xb1bd, 0x3c00, 0x000e860a },
+	{ 0xb41e, 0x2cd8, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0xb41e, 0x2cd8, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0xb419, 0x2c0d, 0xb0c7, 0x3c00, 0x000e860a },
+	{ 0xb40b, 0x2aa7, 0xb1bd, 0x3c00, 0x000cfa27 },
+	{ 0xb40b, 0x2aa7, 0xb0c7, 0x3c00, 0x000cfa27 },
+	{ 0xb3ea, 0x2955, 0xb1bd, 0x3c00, 0x000b8659 },
+	{ 0xb3ea, 0x2955, 0xb0c7, 0x3c00, 0x000b8659 },
+	{ 0xb3aa, 0x2827, 0xb1bd, 0x3c00, 0x000a5299 },
+	{ 0xb3aa, 0x2827, 0xb0c7, 0x3c00, 0x000a5299 },
+	{ 0xb35e, 0x265b, 0xb0c7, 0x3c00, 0x00095ae6 },
+	{ 0xb35e, 0x265b, 0xb1bd, 0x3c00, 0x00095ae6 },
+	{ 0xb35e, 0x265b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb358, 0x2bdb, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb36e, 0x2cd8, 0xb1bd, 0x3c00, 0x000001ff },
+	{ 0xb358, 0x2bdb, 0xb0c7, 0x3c00, 0x000301d9 },
+	{ 0xb358, 0x2bdb, 0xb1bd, 0x3c00, 0x000301d9 },
+	{ 0xb36e, 0x2cd8, 0xb0c7, 0x3c00, 0x000001ff },
+	{ 0xb359, 0x2dc0, 0xb1bd, 0x3c00, 0x000d0ddb },
+	{ 0xb359, 0x2dc0, 0xb0c7, 0x3c00, 0x000d0ddb },
+	{ 0xb31a, 0x2e80, 0xb1bd, 0x3c00, 0x000a6d6e },
+	{ 0xb31a, 0x2e80, 0xb0c7, 0x3c00, 0x000a6d6e },
+	{ 0xb2bc, 0x2f02, 0xb0c7, 0x3c00, 0x0008a0c4 },
+	{ 0xb2bc, 0x2f02, 0xb1bd, 0x3c00, 0x0008a0c4 },
+	{ 0xb249, 0x2f2d, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0xb249, 0x2f2d, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0xb249, 0x2f2d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb249, 0x305d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb249, 0x305d, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0xb249, 0x305d, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0xb1e4, 0x3054, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb187, 0x3039, 0xb0c7, 0x3c00, 0x000764c0 },
+	{ 0xb1e4, 0x3054, 0xb0c7, 0x3c00, 0x0007d85e },
+	{ 0xb1d6, 0x3050, 0xb0c7, 0x3c00, 0x0007ac8f },
+	{ 0xb1e4, 0x3054, 0xb1bd, 0x3c00, 0x0007d85e },
+	{ 0xb187, 0x3039, 0xb1bd, 0x3c00, 0x000764c0 },
+	{ 0xb133, 0x300c, 0xb1bd, 0x3c00, 0x0006a51c },
+	{ 0xb133, 0x300c, 0xb0c7, 0x3c00, 0x0006a51c },
+	{ 0xb187, 0x3039, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb178, 0x2e80, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb133, 0x300c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb1d6, 0x2f02, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb249, 0x2f2d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb2bc, 0x2f02, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb31a, 0x2e80, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb359, 0x2dc0, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb35f, 0x300c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb36e, 0x2cd8, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb3aa, 0x2827, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb3ab, 0x2f9b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb3ea, 0x2955, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb3ea, 0x2f03, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb40b, 0x2aa7, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb40c, 0x2e5a, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb419, 0x2c0d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb419, 0x2da1, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb41e, 0x2cd8, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb419, 0x2da1, 0xb0c7, 0x3c00, 0x00017e0a },
+	{ 0xb419, 0x2da1, 0xb1bd, 0x3c00, 0x00017e0a },
+	{ 0xb40c, 0x2e5a, 0xb0c7, 0x3c00, 0x00030627 },
+	{ 0xb40c, 0x2e5a, 0xb1bd, 0x3c00, 0x00030627 },
+	{ 0xb3ea, 0x2f03, 0xb0c7, 0x3c00, 0x00047658 },
+	{ 0xb3ea, 0x2f03, 0xb1bd, 0x3c00, 0x00047658 },
+	{ 0xb3ab, 0x2f9b, 0xb0c7, 0x3c00, 0x0005a697 },
+	{ 0xb3ab, 0x2f9b, 0xb1bd, 0x3c00, 0x0005a697 },
+	{ 0xb35f, 0x300c, 0xb1bd, 0x3c00, 0x0006a6e4 },
+	{ 0xb35f, 0x300c, 0xb0c7, 0x3c00, 0x0006a6e4 },
+	{ 0xb35b, 0x300e, 0xb0c7, 0x3c00, 0x00070f10 },
+	{ 0xb35e, 0x265b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb358, 0x2bdb, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb309, 0x24f7, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb309, 0x24f7, 0xb0c7, 0x3c00, 0x00089b41 },
+	{ 0xb309, 0x24f7, 0xb1bd, 0x3c00, 0x00089b41 },
+	{ 0xb309, 0x24f7, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb318, 0x2a5c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb318, 0x2a5c, 0xb0c7, 0x3c00, 0x0005a56a },
+	{ 0xb318, 0x2a5c, 0xb1bd, 0x3c00, 0x0005a56a },
+	{ 0xb318, 0x2a5c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb2ba, 0x295d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb2ad, 0x2421, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb2ad, 0x2421, 0xb0c7, 0x3c00, 0x00082ba2 },
+	{ 0xb2ad, 0x2421, 0xb1bd, 0x3c00, 0x00082ba2 },
+	{ 0xb2ba, 0x295d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb2ad, 0x2421, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb2ba, 0x295d, 0xb1bd, 0x3c00, 0x000764c2 },
+	{ 0xb2ba, 0x295d, 0xb0c7, 0x3c00, 0x000764c2 },
+	{ 0xb249, 0x2908, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0xb249, 0x2908, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0xb249, 0x2908, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb249, 0x23b3, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb249, 0x23b3, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0xb249, 0x23b3, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0xb249, 0x2908, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb249, 0x23b3, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb1d6, 0x295f, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb1d6, 0x295f, 0xb1bd, 0x3c00, 0x00075f3b },
+	{ 0xb1d6, 0x295f, 0xb0c7, 0x3c00, 0x00075f3b },
+	{ 0xb1e4, 0x2422, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb1d6, 0x295f, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb1e4, 0x2422, 0xb0c7, 0x3c00, 0x0008285e },
+	{ 0xb1e4, 0x2422, 0xb1bd, 0x3c00, 0x0008285e },
+	{ 0xb1e4, 0x2422, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb187, 0x24f9, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb178, 0x2a64, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb178, 0x2a64, 0xb1bd, 0x3c00, 0x00059292 },
+	{ 0xb178, 0x2a64, 0xb0c7, 0x3c00, 0x00059292 },
+	{ 0xb187, 0x24f9, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb178, 0x2a64, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb187, 0x24f9, 0xb0c7, 0x3c00, 0x00089cc0 },
+	{ 0xb187, 0x24f9, 0xb1bd, 0x3c00, 0x00089cc0 },
+	{ 0xb133, 0x2661, 0xb0c7, 0x3c00, 0x00095d1c },
+	{ 0xb133, 0x2661, 0xb1bd, 0x3c00, 0x00095d1c },
+	{ 0xb133, 0x2661, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb139, 0x2be5, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb139, 0x2be5, 0xb0c7, 0x3c00, 0x0002f625 },
+	{ 0xb139, 0x2be5, 0xb1bd, 0x3c00, 0x0002f625 },
+	{ 0xb133, 0x2661, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb139, 0x2be5, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb124, 0x2cd8, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb0e7, 0x282c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb0e7, 0x282c, 0xb0c7, 0x3c00, 0x000a5d69 },
+	{ 0xb0e7, 0x282c, 0xb1bd, 0x3c00, 0x000a5d69 },
+	{ 0xb124, 0x2cd8, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb0e7, 0x282c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb124, 0x2cd8, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0xb124, 0x2cd8, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0xb139, 0x2dc0, 0xb0c7, 0x3c00, 0x000d0e25 },
+	{ 0xb139, 0x2dc0, 0xb1bd, 0x3c00, 0x000d0e25 },
+	{ 0xb178, 0x2e80, 0xb0c7, 0x3c00, 0x000a6e92 },
+	{ 0xb178, 0x2e80, 0xb1bd, 0x3c00, 0x000a6e92 },
+	{ 0xb1d6, 0x2f02, 0xb1bd, 0x3c00, 0x0008a33c },
+	{ 0xb1d6, 0x2f02, 0xb0c7, 0x3c00, 0x0008a33c },
+	{ 0xb1e4, 0x3054, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb1d6, 0x2f02, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb187, 0x3039, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb178, 0x2e80, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb133, 0x300c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb139, 0x2dc0, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb0e7, 0x2f9b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb0e7, 0x2f9b, 0xb1bd, 0x3c00, 0x0005a569 },
+	{ 0xb0e7, 0x2f9b, 0xb0c7, 0x3c00, 0x0005a569 },
+	{ 0xb0e7, 0x2f9b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb139, 0x2dc0, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb0a8, 0x295c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb0a8, 0x295c, 0xb1bd, 0x3c00, 0x000b8da8 },
+	{ 0xb0a8, 0x295c, 0xb0c7, 0x3c00, 0x000b8da8 },
+	{ 0xb0a8, 0x2f03, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb0a8, 0x295c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb0a8, 0x2f03, 0xb0c7, 0x3c00, 0x000475a8 },
+	{ 0xb0a8, 0x2f03, 0xb1bd, 0x3c00, 0x000475a8 },
+	{ 0xb0a8, 0x2f03, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb07b, 0x2aad, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb07b, 0x2aad, 0xb1bd, 0x3c00, 0x000cfdd9 },
+	{ 0xb07b, 0x2aad, 0xb0c7, 0x3c00, 0x000cfdd9 },
+	{ 0xb07b, 0x2e5a, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb07b, 0x2aad, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb07b, 0x2e5a, 0xb0c7, 0x3c00, 0x000305d9 },
+	{ 0xb07b, 0x2e5a, 0xb1bd, 0x3c00, 0x000305d9 },
+	{ 0xb07b, 0x2e5a, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb060, 0x2c0f, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb060, 0x2c0f, 0xb1bd, 0x3c00, 0x000e85f6 },
+	{ 0xb060, 0x2c0f, 0xb0c7, 0x3c00, 0x000e85f6 },
+	{ 0xb060, 0x2da1, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb060, 0x2c0f, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb060, 0x2da1, 0xb0c7, 0x3c00, 0x00017df6 },
+	{ 0xb060, 0x2da1, 0xb1bd, 0x3c00, 0x00017df6 },
+	{ 0xb060, 0x2da1, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb057, 0x2cd8, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb057, 0x2cd8, 0xb1bd, 0x3c00, 0x000001ff },
+	{ 0xb057, 0x2cd8, 0xb0c7, 0x3c00, 0x000001ff },
+	{ 0xb057, 0x2cd8, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb193, 0x30fb, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb193, 0x30fb, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0xb193, 0x30fb, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0xb0e5, 0x30f4, 0xb1bd, 0x3c00, 0x0007f430 },
+	{ 0xb0e5, 0x30f4, 0xb0c7, 0x3c00, 0x0007f430 },
+	{ 0xb085, 0x3041, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb0e5, 0x30f4, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb194, 0x3055, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb085, 0x3041, 0xb0c7, 0x3c00, 0x000823a9 },
+	{ 0xb085, 0x3041, 0xb1bd, 0x3c00, 0x000823a9 },
+	{ 0xb193, 0x30fb, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb085, 0x3041, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb0e5, 0x30f4, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb043, 0x30dc, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb043, 0x30dc, 0xb1bd, 0x3c00, 0x0007d465 },
+	{ 0xb043, 0x30dc, 0xb0c7, 0x3c00, 0x0007d465 },
+	{ 0xb043, 0x30dc, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xaf41, 0x3002, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xaf41, 0x3002, 0xb0c7, 0x3c00, 0x00089f3e },
+	{ 0xaf41, 0x3002, 0xb1bd, 0x3c00, 0x00089f3e },
+	{ 0xaf41, 0x3002, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xaf5d, 0x30b5, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xaf5d, 0x30b5, 0xb1bd, 0x3c00, 0x000794a0 },
+	{ 0xaf5d, 0x30b5, 0xb0c7, 0x3c00, 0x000794a0 },
+	{ 0xaf5d, 0x30b5, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xae4d, 0x307f, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xadcf, 0x2f35, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xadcf, 0x2f35, 0xb0c7, 0x3c00, 0x0009aec9 },
+	{ 0xadcf, 0x2f35, 0xb1bd, 0x3c00, 0x0009aec9 },
+	{ 0xae4d, 0x307f, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xadcf, 0x2f35, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xae4d, 0x307f, 0xb1bd, 0x3c00, 0x000730de },
+	{ 0xae4d, 0x307f, 0xb0c7, 0x3c00, 0x000730de },
+	{ 0xad56, 0x3039, 0xb1bd, 0x3c00, 0x0006a51c },
+	{ 0xad56, 0x3039, 0xb0c7, 0x3c00, 0x0006a51c },
+	{ 0xad56, 0x3039, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xacb4, 0x2e12, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xacb4, 0x2e12, 0xb1bd, 0x3c00, 0x000a7292 },
+	{ 0xacb4, 0x2e12, 0xb0c7, 0x3c00, 0x000a7292 },
+	{ 0xad56, 0x3039, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xacb4, 0x2e12, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xac79, 0x2fc6, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xac79, 0x2fc6, 0xb1bd, 0x3c00, 0x0005f155 },
+	{ 0xac79, 0x2fc6, 0xb0c7, 0x3c00, 0x0005f155 },
+	{ 0xac79, 0x2fc6, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xaa18, 0x2e12, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xacb4, 0x2e12, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0xaa18, 0x2e12, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0xacb4, 0x2e12, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0xaa18, 0x2e12, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0xaa18, 0x2e12, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xab6c, 0x2efc, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xab6c, 0x2efc, 0xb0c7, 0x3c00, 0x00052188 },
+	{ 0xab6c, 0x2efc, 0xb1bd, 0x3c00, 0x00052188 },
+	{ 0xab6c, 0x2efc, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xaa18, 0x2e12, 0xb0c7, 0x3c00, 0x0004b19d },
+	{ 0xaa18, 0x2e12, 0xb1bd, 0x3c00, 0x0004b19d },
+	{ 0xaf8e, 0xaf2e, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb046, 0xb00c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xb09b, 0xaf2e, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xafc8, 0xb071, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xaeeb, 0xb0c7, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xae73, 0xb028, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xaf8e, 0xaf2e, 0xb1bd, 0x3c00, 0x0005916e },
+	{ 0xae73, 0xb028, 0xb0c7, 0x3c00, 0x00065538 },
+	{ 0xae73, 0xb028, 0xb1bd, 0x3c00, 0x00065538 },
+	{ 0xaf8e, 0xaf2e, 0xb0c7, 0x3c00, 0x0005916e },
+	{ 0xaf8e, 0xaf2e, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0xb09b, 0xaf2e, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0xaf8e, 0xaf2e, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0xb09b, 0xaf2e, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0xb046, 0xb00c, 0xb1bd, 0x3c00, 0x000ae279 },
+	{ 0xb09b, 0xaf2e, 0xb0c7, 0x3c00, 0x000b5263 },
+	{ 0xb09b, 0xaf2e, 0xb1bd, 0x3c00, 0x000b5263 },
+	{ 0xb046, 0xb00c, 0xb0c7, 0x3c00, 0x000ae279 },
+	{ 0xafc8, 0xb071, 0xb1bd, 0x3c00, 0x000a12ab },
+	{ 0xafc8, 0xb071, 0xb0c7, 0x3c00, 0x000a12ab },
+	{ 0xaeeb, 0xb0c7, 0xb0c7, 0x3c00, 0x00095ee5 },
+	{ 0xaeeb, 0xb0c7, 0xb1bd, 0x3c00, 0x00095ee5 },
+	{ 0xadf4, 0xb10d, 0xb0c7, 0x3c00, 0x0008d322 },
+	{ 0xadf4, 0xb10d, 0xb1bd, 0x3c00, 0x0008d322 },
+	{ 0xadf4, 0xb10d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xad02, 0xb090, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xad02, 0xb090, 0xb1bd, 0x3c00, 0x000764c2 },
+	{ 0xad02, 0xb090, 0xb0c7, 0x3c00, 0x000764c2 },
+	{ 0xae73, 0xb028, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xadf4, 0xb10d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xad02, 0xb090, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xaeeb, 0xb0c7, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xaf8e, 0xaf2e, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xafc8, 0xb071, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb046, 0xb00c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xb09b, 0xaf2e, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xace4, 0xb143, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xace4, 0xb143, 0xb0c7, 0x3c00, 0x00086f60 },
+	{ 0xace4, 0xb143, 0xb1bd, 0x3c00, 0x00086f60 },
+	{ 0xace4, 0xb143, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xaa74, 0xb0cf, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xaa74, 0xb0cf, 0xb1bd, 0x3c00, 0x0007dc57 },
+	{ 0xaa74, 0xb0cf, 0xb0c7, 0x3c00, 0x0007dc57 },
+	{ 0xaa74, 0xb0cf, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xab74, 0xb16a, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xab74, 0xb16a, 0xb0c7, 0x3c00, 0x00082f9b },
+	{ 0xab74, 0xb16a, 0xb1bd, 0x3c00, 0x00082f9b },
+	{ 0xab74, 0xb16a, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xa8ec, 0xb182, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xa46d, 0xb0e3, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xa46d, 0xb0e3, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0xa46d, 0xb0e3, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0xa8ec, 0xb182, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xa46d, 0xb0e3, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xa8ec, 0xb182, 0xb0c7, 0x3c00, 0x00080fd0 },
+	{ 0xa8ec, 0xb182, 0xb1bd, 0x3c00, 0x00080fd0 },
+	{ 0xa462, 0xb189, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0xa462, 0xb189, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0xa462, 0xb189, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2412, 0xb0cf, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2412, 0xb0cf, 0xb1bd, 0x3c00, 0x0007e3a9 },
+	{ 0x2412, 0xb0cf, 0xb0c7, 0x3c00, 0x0007e3a9 },
+	{ 0xa462, 0xb189, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2412, 0xb0cf, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x1c43, 0xb182, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x1c43, 0xb182, 0xb0c7, 0x3c00, 0x00080c30 },
+	{ 0x1c43, 0xb182, 0xb1bd, 0x3c00, 0x00080c30 },
+	{ 0x1c43, 0xb182, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x261e, 0xb16a, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x299a, 0xb090, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x299a, 0xb090, 0xb1bd, 0x3c00, 0x0007673e },
+	{ 0x299a, 0xb090, 0xb0c7, 0x3c00, 0x0007673e },
+	{ 0x261e, 0xb16a, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x299a, 0xb090, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x261e, 0xb16a, 0xb0c7, 0x3c00, 0x00082c65 },
+	{ 0x261e, 0xb16a, 0xb1bd, 0x3c00, 0x00082c65 },
+	{ 0x2962, 0xb143, 0xb0c7, 0x3c00, 0x00086ca0 },
+	{ 0x2962, 0xb143, 0xb1bd, 0x3c00, 0x00086ca0 },
+	{ 0x2962, 0xb143, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2b82, 0xb10d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2c3f, 0xb028, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2c3f, 0xb028, 0xb1bd, 0x3c00, 0x000656c9 },
+	{ 0x2c3f, 0xb028, 0xb0c7, 0x3c00, 0x000656c9 },
+	{ 0x2b82, 0xb10d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2c3f, 0xb028, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2962, 0xb143, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2b82, 0xb10d, 0xb0c7, 0x3c00, 0x0008d0de },
+	{ 0x2b82, 0xb10d, 0xb1bd, 0x3c00, 0x0008d0de },
+	{ 0x2cb8, 0xb0c7, 0xb0c7, 0x3c00, 0x00095d1c },
+	{ 0x2cb8, 0xb0c7, 0xb1bd, 0x3c00, 0x00095d1c },
+	{ 0x2cb8, 0xb0c7, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2d5a, 0xaf2e, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2d5a, 0xaf2e, 0xb0c7, 0x3c00, 0x00059292 },
+	{ 0x2d5a, 0xaf2e, 0xb1bd, 0x3c00, 0x00059292 },
+	{ 0x2cb8, 0xb0c7, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2d5a, 0xaf2e, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2d94, 0xb071, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2d94, 0xb071, 0xb0c7, 0x3c00, 0x000a1155 },
+	{ 0x2d94, 0xb071, 0xb1bd, 0x3c00, 0x000a1155 },
+	{ 0x2d94, 0xb071, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2f02, 0xaf2e, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2d5a, 0xaf2e, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0x2f02, 0xaf2e, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0x2d5a, 0xaf2e, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0x2f02, 0xaf2e, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0x2f02, 0xaf2e, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2e58, 0xb00c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2e58, 0xb00c, 0xb1bd, 0x3c00, 0x000ae188 },
+	{ 0x2e58, 0xb00c, 0xb0c7, 0x3c00, 0x000ae188 },
+	{ 0x2e58, 0xb00c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2f02, 0xaf2e, 0xb1bd, 0x3c00, 0x000b519d },
+	{ 0x2f02, 0xaf2e, 0xb0c7, 0x3c00, 0x000b519d },
+	{ 0x2b5a, 0x3093, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2705, 0x2a86, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2705, 0x3093, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x294f, 0x2a86, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2ae6, 0x2a5a, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2b5a, 0x2cd8, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2b5a, 0x3093, 0xb1bd, 0x3c00, 0x000001ff },
+	{ 0x2b5a, 0x2cd8, 0xb0c7, 0x3c00, 0x000001ff },
+	{ 0x2b5a, 0x2cd8, 0xb1bd, 0x3c00, 0x000001ff },
+	{ 0x2b5a, 0x3093, 0xb0c7, 0x3c00, 0x000001ff },
+	{ 0x2b5a, 0x3093, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0x2705, 0x3093, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0x2b5a, 0x3093, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0x2705, 0x3093, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0x2705, 0x2a86, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0x2705, 0x3093, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0x2705, 0x3093, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0x2705, 0x2a86, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0x2705, 0x2a86, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0x294f, 0x2a86, 0xb0c7, 0x3c00, 0x00080be5 },
+	{ 0x2705, 0x2a86, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0x294f, 0x2a86, 0xb1bd, 0x3c00, 0x00080be5 },
+	{ 0x2ae6, 0x2a5a, 0xb0c7, 0x3c00, 0x00083f8b },
+	{ 0x2ae6, 0x2a5a, 0xb1bd, 0x3c00, 0x00083f8b },
+	{ 0x2c25, 0x29d7, 0xb0c7, 0x3c00, 0x0008f70f },
+	{ 0x2c25, 0x29d7, 0xb1bd, 0x3c00, 0x0008f70f },
+	{ 0x2c25, 0x29d7, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2ca5, 0x2c97, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2b5a, 0x2cd8, 0xb0c7, 0x3c00, 0x0007b882 },
+	{ 0x2ca5, 0x2c97, 0xb1bd, 0x3c00, 0x00077cb1 },
+	{ 0x2b5a, 0x2cd8, 0xb1bd, 0x3c00, 0x0007b882 },
+	{ 0x2ca5, 0x2c97, 0xb0c7, 0x3c00, 0x00077cb1 },
+	{ 0x2b5a, 0x2cd8, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2c25, 0x29d7, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2ca5, 0x2c97, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2ae6, 0x2a5a, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2b5a, 0x3093, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x294f, 0x2a86, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2705, 0x3093, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2705, 0x2a86, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2cbb, 0x28fc, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2cbb, 0x28fc, 0xb0c7, 0x3c00, 0x000a36a0 },
+	{ 0x2cbb, 0x28fc, 0xb1bd, 0x3c00, 0x000a36a0 },
+	{ 0x2cbb, 0x28fc, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2d80, 0x2c2d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2d80, 0x2c2d, 0xb1bd, 0x3c00, 0x0006c90e },
+	{ 0x2d80, 0x2c2d, 0xb0c7, 0x3c00, 0x0006c90e },
+	{ 0x2d80, 0x2c2d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2d38, 0x2792, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2d38, 0x2792, 0xb1bd, 0x3c00, 0x000bea4a },
+	{ 0x2d38, 0x2792, 0xb0c7, 0x3c00, 0x000bea4a },
+	{ 0x2d38, 0x2792, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2dc5, 0x209d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2e3d, 0x2b33, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2e3d, 0x2b33, 0xb1bd, 0x3c00, 0x0005c562 },
+	{ 0x2e3d, 0x2b33, 0xb0c7, 0x3c00, 0x0005c562 },
+	{ 0x2dc5, 0x209d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2e3d, 0x2b33, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2dc5, 0x209d, 0xb1bd, 0x3c00, 0x000dfe11 },
+	{ 0x2dc5, 0x209d, 0xb0c7, 0x3c00, 0x000dfe11 },
+	{ 0x2df4, 0xa43e, 0xb1bd, 0x3c00, 0x000ffe01 },
+	{ 0x2df4, 0xa43e, 0xb0c7, 0x3c00, 0x000ffe01 },
+	{ 0x2dc6, 0xa96c, 0xb1bd, 0x3c00, 0x0001fe11 },
+	{ 0x2dc6, 0xa96c, 0xb0c7, 0x3c00, 0x0001fe11 },
+	{ 0x2d3d, 0xac01, 0xb0c7, 0x3c00, 0x00041e4a },
+	{ 0x2d3d, 0xac01, 0xb1bd, 0x3c00, 0x00041e4a },
+	{ 0x2deb, 0xae0b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2d3d, 0xac01, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2dc6, 0xa96c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2cfc, 0xae94, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2cc1, 0xac97, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2c2a, 0xad02, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2bc5, 0xaee6, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2aed, 0xad42, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x294f, 0xad57, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x293f, 0xaf02, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2714, 0xad41, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2442, 0xaec8, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x236a, 0xacfe, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x17fc, 0xac8f, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xa117, 0xabe7, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xa1fe, 0xae1c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xa1fe, 0xabe7, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xa1fe, 0xae1c, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0xa1fe, 0xabe7, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0xa1fe, 0xae1c, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0xa1fe, 0xabe7, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0x2442, 0xaec8, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xa1fe, 0xabe7, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xa1fe, 0xae1c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0xa117, 0xabe7, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x17fc, 0xac8f, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x236a, 0xacfe, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2714, 0xad41, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x293f, 0xaf02, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2442, 0xaec8, 0xb1bd, 0x3c00, 0x00084782 },
+	{ 0x293f, 0xaf02, 0xb0c7, 0x3c00, 0x000807f1 },
+	{ 0x2442, 0xaec8, 0xb0c7, 0x3c00, 0x00084782 },
+	{ 0x293f, 0xaf02, 0xb1bd, 0x3c00, 0x000807f1 },
+	{ 0x2bc5, 0xaee6, 0xb0c7, 0x3c00, 0x0008285e },
+	{ 0x2bc5, 0xaee6, 0xb1bd, 0x3c00, 0x0008285e },
+	{ 0x2cfc, 0xae94, 0xb0c7, 0x3c00, 0x0008a8c8 },
+	{ 0x2cfc, 0xae94, 0xb1bd, 0x3c00, 0x0008a8c8 },
+	{ 0x2deb, 0xae0b, 0xb0c7, 0x3c00, 0x0009a134 },
+	{ 0x2deb, 0xae0b, 0xb1bd, 0x3c00, 0x0009a134 },
+	{ 0x2eb0, 0xad4a, 0xb0c7, 0x3c00, 0x000af18b },
+	{ 0x2eb0, 0xad4a, 0xb1bd, 0x3c00, 0x000af18b },
+	{ 0x2df4, 0xa43e, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2eb0, 0xad4a, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2edd, 0x29ba, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2edd, 0x29ba, 0xb0c7, 0x3c00, 0x000495a3 },
+	{ 0x2edd, 0x29ba, 0xb1bd, 0x3c00, 0x000495a3 },
+	{ 0x2eb0, 0xad4a, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2edd, 0x29ba, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2df4, 0xa43e, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2deb, 0xae0b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2dc6, 0xa96c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2d3d, 0xac01, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2cfc, 0xae94, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2cc1, 0xac97, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2c2a, 0xad02, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2bc5, 0xaee6, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2aed, 0xad42, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x294f, 0xad57, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x294f, 0xad57, 0xb0c7, 0x3c00, 0x0007ffff },
+	{ 0x2714, 0xad41, 0xb1bd, 0x3c00, 0x0007d465 },
+	{ 0x2714, 0xad41, 0xb0c7, 0x3c00, 0x0007d465 },
+	{ 0x294f, 0xad57, 0xb1bd, 0x3c00, 0x0007ffff },
+	{ 0x2aed, 0xad42, 0xb1bd, 0x3c00, 0x0007cb8f },
+	{ 0x2aed, 0xad42, 0xb0c7, 0x3c00, 0x0007cb8f },
+	{ 0x2c2a, 0xad02, 0xb1bd, 0x3c00, 0x00071714 },
+	{ 0x2c2a, 0xad02, 0xb0c7, 0x3c00, 0x00071714 },
+	{ 0x2cc1, 0xac97, 0xb1bd, 0x3c00, 0x0005dea4 },
+	{ 0x2cc1, 0xac97, 0xb0c7, 0x3c00, 0x0005dea4 },
+	{ 0x236a, 0xacfe, 0xb0c7, 0x3c00, 0x00075cc6 },
+	{ 0x236a, 0xacfe, 0xb1bd, 0x3c00, 0x00075cc6 },
+	{ 0x17fc, 0xac8f, 0xb0c7, 0x3c00, 0x0006a91a },
+	{ 0x17fc, 0xac8f, 0xb1bd, 0x3c00, 0x0006a91a },
+	{ 0xa117, 0xabe7, 0xb0c7, 0x3c00, 0x00063d3f },
+	{ 0xa117, 0xabe7, 0xb1bd, 0x3c00, 0x00063d3f },
+	{ 0xa117, 0xabe7, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0xa1fe, 0xabe7, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0xa117, 0xabe7, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0xa1fe, 0xabe7, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0x2f3d, 0xac72, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2f3d, 0xac72, 0xb1bd, 0x3c00, 0x000c55c6 },
+	{ 0x2f3d, 0xac72, 0xb0c7, 0x3c00, 0x000c55c6 },
+	{ 0x2f3d, 0xac72, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2f56, 0x2810, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2f56, 0x2810, 0xb0c7, 0x3c00, 0x00035dd0 },
+	{ 0x2f56, 0x2810, 0xb1bd, 0x3c00, 0x00035dd0 },
+	{ 0x2f56, 0x2810, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2fa2, 0xaaea, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2fa2, 0xaaea, 0xb1bd, 0x3c00, 0x000db5e9 },
+	{ 0x2fa2, 0xaaea, 0xb0c7, 0x3c00, 0x000db5e9 },
+	{ 0x2fa2, 0xaaea, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2fad, 0x2467, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2fad, 0x2467, 0xb0c7, 0x3c00, 0x000225ec },
+	{ 0x2fad, 0x2467, 0xb1bd, 0x3c00, 0x000225ec },
+	{ 0x2fad, 0x2467, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2fde, 0xa8a8, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2fde, 0xa8a8, 0xb1bd, 0x3c00, 0x000ef1fa },
+	{ 0x2fde, 0xa8a8, 0xb0c7, 0x3c00, 0x000ef1fa },
+	{ 0x2fde, 0xa8a8, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2fe1, 0x1478, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x2fe1, 0x1478, 0xb0c7, 0x3c00, 0x000105fb },
+	{ 0x2fe1, 0x1478, 0xb1bd, 0x3c00, 0x000105fb },
+	{ 0x2fe1, 0x1478, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2ff2, 0xa43e, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x2ff2, 0xa43e, 0xb1bd, 0x3c00, 0x000ffdff },
+	{ 0x2ff2, 0xa43e, 0xb0c7, 0x3c00, 0x000ffdff },
+	{ 0x2ff2, 0xa43e, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0xa1fe, 0xae1c, 0xb1bd, 0x3c00, 0x0008874e },
+	{ 0xa1fe, 0xae1c, 0xb0c7, 0x3c00, 0x0008874e },
+	{ 0x32fe, 0x2efc, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x337d, 0x2e12, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x32a9, 0x2e12, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3360, 0x2fc6, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x32fe, 0x2efc, 0xb1bd, 0x3c00, 0x00052279 },
+	{ 0x3360, 0x2fc6, 0xb0c7, 0x3c00, 0x0005f2ab },
+	{ 0x3360, 0x2fc6, 0xb1bd, 0x3c00, 0x0005f2ab },
+	{ 0x32fe, 0x2efc, 0xb0c7, 0x3c00, 0x00052279 },
+	{ 0x32a9, 0x2e12, 0xb1bd, 0x3c00, 0x0004b263 },
+	{ 0x32a9, 0x2e12, 0xb0c7, 0x3c00, 0x0004b263 },
+	{ 0x32a9, 0x2e12, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0x337d, 0x2e12, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0x32a9, 0x2e12, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0x337d, 0x2e12, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0x3405, 0x2f35, 0xb1bd, 0x3c00, 0x0009ad38 },
+	{ 0x337d, 0x2e12, 0xb0c7, 0x3c00, 0x000a716e },
+	{ 0x337d, 0x2e12, 0xb1bd, 0x3c00, 0x000a716e },
+	{ 0x3405, 0x2f35, 0xb0c7, 0x3c00, 0x0009ad38 },
+	{ 0x3461, 0x3002, 0xb0c7, 0x3c00, 0x00089cc2 },
+	{ 0x3461, 0x3002, 0xb1bd, 0x3c00, 0x00089cc2 },
+	{ 0x3405, 0x2f35, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3425, 0x307f, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3461, 0x3002, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x33ce, 0x3039, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x33ce, 0x3039, 0xb1bd, 0x3c00, 0x0006a6e5 },
+	{ 0x33ce, 0x3039, 0xb0c7, 0x3c00, 0x0006a6e5 },
+	{ 0x3360, 0x2fc6, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x337d, 0x2e12, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x33ce, 0x3039, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x32fe, 0x2efc, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x32a9, 0x2e12, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3405, 0x2f35, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3425, 0x307f, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3461, 0x3002, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3469, 0x30b5, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3478, 0x300e, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x34d3, 0x3041, 0xb0c7, 0x3c00, 0x00082457 },
+	{ 0x3478, 0x300e, 0xb0c7, 0x3c00, 0x00084c87 },
+	{ 0x34d3, 0x3041, 0xb1bd, 0x3c00, 0x00082457 },
+	{ 0x3469, 0x30b5, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x34d3, 0x3041, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3425, 0x307f, 0xb0c7, 0x3c00, 0x00073322 },
+	{ 0x3469, 0x30b5, 0xb1bd, 0x3c00, 0x00079760 },
+	{ 0x3425, 0x307f, 0xb1bd, 0x3c00, 0x00073322 },
+	{ 0x3469, 0x30b5, 0xb0c7, 0x3c00, 0x00079760 },
+	{ 0x34b3, 0x30dc, 0xb1bd, 0x3c00, 0x0007d79b },
+	{ 0x34b3, 0x30dc, 0xb0c7, 0x3c00, 0x0007d79b },
+	{ 0x34b3, 0x30dc, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x34a0, 0x3039, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x34d3, 0x3041, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x34ce, 0x3054, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3501, 0x305d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x353a, 0x3050, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x355b, 0x3055, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0x353a, 0x3050, 0xb0c7, 0x3c00, 0x00080827 },
+	{ 0x355b, 0x3055, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0x3504, 0x30f4, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x355b, 0x3055, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x34b3, 0x30dc, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3504, 0x30f4, 0xb1bd, 0x3c00, 0x0007f7d0 },
+	{ 0x3504, 0x30f4, 0xb0c7, 0x3c00, 0x0007f7d0 },
+	{ 0x3504, 0x30f4, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x34ce, 0x3054, 0xb1bd, 0x3c00, 0x0007dba2 },
+	{ 0x34a0, 0x3039, 0xb0c7, 0x3c00, 0x00076740 },
+	{ 0x34ce, 0x3054, 0xb0c7, 0x3c00, 0x0007dba2 },
+	{ 0x34a0, 0x3039, 0xb1bd, 0x3c00, 0x00076740 },
+	{ 0x34c7, 0x2f02, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x34a0, 0x3039, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x34ce, 0x3054, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3498, 0x2e80, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3479, 0x2dc0, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3476, 0x300c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x346e, 0x2cd8, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3450, 0x2827, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3450, 0x2f9b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3430, 0x2955, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3430, 0x2f03, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x341a, 0x2aa7, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x341a, 0x2e5a, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x340c, 0x2c0d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x340c, 0x2da1, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3408, 0x2cd8, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x340c, 0x2c0d, 0xb1bd, 0x3c00, 0x000e860a },
+	{ 0x3408, 0x2cd8, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0x3408, 0x2cd8, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0x340c, 0x2c0d, 0xb0c7, 0x3c00, 0x000e860a },
+	{ 0x341a, 0x2aa7, 0xb1bd, 0x3c00, 0x000cfa27 },
+	{ 0x341a, 0x2aa7, 0xb0c7, 0x3c00, 0x000cfa27 },
+	{ 0x3430, 0x2955, 0xb1bd, 0x3c00, 0x000b8659 },
+	{ 0x3430, 0x2955, 0xb0c7, 0x3c00, 0x000b8659 },
+	{ 0x3450, 0x2827, 0xb1bd, 0x3c00, 0x000a5299 },
+	{ 0x3450, 0x2827, 0xb0c7, 0x3c00, 0x000a5299 },
+	{ 0x3476, 0x265b, 0xb0c7, 0x3c00, 0x00095ae6 },
+	{ 0x3476, 0x265b, 0xb1bd, 0x3c00, 0x00095ae6 },
+	{ 0x3476, 0x265b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3479, 0x2bdb, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x346e, 0x2cd8, 0xb1bd, 0x3c00, 0x000001ff },
+	{ 0x3479, 0x2bdb, 0xb0c7, 0x3c00, 0x000301d9 },
+	{ 0x3479, 0x2bdb, 0xb1bd, 0x3c00, 0x000301d9 },
+	{ 0x346e, 0x2cd8, 0xb0c7, 0x3c00, 0x000001ff },
+	{ 0x3479, 0x2dc0, 0xb1bd, 0x3c00, 0x000d0ddb },
+	{ 0x3479, 0x2dc0, 0xb0c7, 0x3c00, 0x000d0ddb },
+	{ 0x3498, 0x2e80, 0xb1bd, 0x3c00, 0x000a6d6e },
+	{ 0x3498, 0x2e80, 0xb0c7, 0x3c00, 0x000a6d6e },
+	{ 0x34c7, 0x2f02, 0xb0c7, 0x3c00, 0x0008a0c4 },
+	{ 0x34c7, 0x2f02, 0xb1bd, 0x3c00, 0x0008a0c4 },
+	{ 0x3501, 0x2f2d, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0x3501, 0x2f2d, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0x3501, 0x2f2d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3501, 0x305d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3501, 0x305d, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0x3501, 0x305d, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0x3533, 0x3054, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x355c, 0x30fb, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x355c, 0x30fb, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0x355c, 0x30fb, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0x35b3, 0x30f4, 0xb1bd, 0x3c00, 0x0007f430 },
+	{ 0x35b3, 0x30f4, 0xb0c7, 0x3c00, 0x0007f430 },
+	{ 0x35e3, 0x3041, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x35b3, 0x30f4, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x355b, 0x3055, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x35e3, 0x3041, 0xb0c7, 0x3c00, 0x000823a9 },
+	{ 0x35e3, 0x3041, 0xb1bd, 0x3c00, 0x000823a9 },
+	{ 0x355c, 0x30fb, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x35e3, 0x3041, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x35b3, 0x30f4, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3604, 0x30dc, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3604, 0x30dc, 0xb1bd, 0x3c00, 0x0007d465 },
+	{ 0x3604, 0x30dc, 0xb0c7, 0x3c00, 0x0007d465 },
+	{ 0x3604, 0x30dc, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3655, 0x3002, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3655, 0x3002, 0xb0c7, 0x3c00, 0x00089f3e },
+	{ 0x3655, 0x3002, 0xb1bd, 0x3c00, 0x00089f3e },
+	{ 0x3655, 0x3002, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x364e, 0x30b5, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x364e, 0x30b5, 0xb1bd, 0x3c00, 0x000794a0 },
+	{ 0x364e, 0x30b5, 0xb0c7, 0x3c00, 0x000794a0 },
+	{ 0x364e, 0x30b5, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x366c, 0x3093, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x366c, 0x3086, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x36b2, 0x2f35, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x36d0, 0x2f54, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x36f8, 0x2e12, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x36b2, 0x2f35, 0xb0c7, 0x3c00, 0x0009aec9 },
+	{ 0x36f8, 0x2e12, 0xb1bd, 0x3c00, 0x000a7292 },
+	{ 0x36f8, 0x2e12, 0xb0c7, 0x3c00, 0x000a7292 },
+	{ 0x36b2, 0x2f35, 0xb1bd, 0x3c00, 0x0009aec9 },
+	{ 0x3692, 0x307f, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x36b2, 0x2f35, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3692, 0x307f, 0xb1bd, 0x3c00, 0x000730de },
+	{ 0x3679, 0x3093, 0xb0c7, 0x3c00, 0x000768be },
+	{ 0x3679, 0x3093, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x366c, 0x3093, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0x366c, 0x3086, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0x366c, 0x3086, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0x366c, 0x3093, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0x366c, 0x3093, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0x3702, 0x3093, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0x366c, 0x3093, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0x3702, 0x3093, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0x3679, 0x3093, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0x3692, 0x307f, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3702, 0x3093, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x36d0, 0x3039, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x36d0, 0x3039, 0xb1bd, 0x3c00, 0x0006a51c },
+	{ 0x3692, 0x307f, 0xb0c7, 0x3c00, 0x000730de },
+	{ 0x36d0, 0x3039, 0xb0c7, 0x3c00, 0x0006a51c },
+	{ 0x36d0, 0x3039, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x36f8, 0x2e12, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3707, 0x2fc6, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3707, 0x2fc6, 0xb1bd, 0x3c00, 0x0005f155 },
+	{ 0x3707, 0x2fc6, 0xb0c7, 0x3c00, 0x0005f155 },
+	{ 0x3707, 0x2fc6, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3700, 0x2e41, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3707, 0x2e12, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x36f8, 0x2e12, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0x3762, 0x2e12, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0x3707, 0x2e12, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0x36f8, 0x2e12, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0x3762, 0x2e12, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0x3762, 0x2e12, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3738, 0x2efc, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3738, 0x2efc, 0xb0c7, 0x3c00, 0x00052188 },
+	{ 0x3738, 0x2efc, 0xb1bd, 0x3c00, 0x00052188 },
+	{ 0x3762, 0x2e12, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3738, 0x2efc, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3700, 0x2e41, 0xb1bd, 0x3c00, 0x000bce4e },
+	{ 0x3707, 0x2e12, 0xb0c7, 0x3c00, 0x000c2641 },
+	{ 0x3700, 0x2e41, 0xb0c7, 0x3c00, 0x000bce4e },
+	{ 0x372b, 0x2d0d, 0xb1bd, 0x3c00, 0x000c8634 },
+	{ 0x372b, 0x2d0d, 0xb0c7, 0x3c00, 0x000c8634 },
+	{ 0x374f, 0x2b73, 0xb1bd, 0x3c00, 0x000d4a20 },
+	{ 0x374f, 0x2b73, 0xb0c7, 0x3c00, 0x000d4a20 },
+	{ 0x376b, 0x2890, 0xb1bd, 0x3c00, 0x000e1e0f },
+	{ 0x376b, 0x2890, 0xb0c7, 0x3c00, 0x000e1e0f },
+	{ 0x377d, 0x21dc, 0xb1bd, 0x3c00, 0x000f0e05 },
+	{ 0x377d, 0x21dc, 0xb0c7, 0x3c00, 0x000f0e05 },
+	{ 0x3783, 0xa342, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0x3783, 0xa342, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0x377d, 0xa91b, 0xb1bd, 0x3c00, 0x0000f605 },
+	{ 0x377d, 0xa91b, 0xb0c7, 0x3c00, 0x0000f605 },
+	{ 0x376b, 0xac14, 0xb0c7, 0x3c00, 0x0001e610 },
+	{ 0x376b, 0xac14, 0xb1bd, 0x3c00, 0x0001e610 },
+	{ 0x37b5, 0xae75, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x376b, 0xac14, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x377d, 0xa91b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3768, 0xb063, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x374f, 0xad82, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x372b, 0xaedd, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3702, 0xb17b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3701, 0xb006, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x36d2, 0xb090, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x366c, 0xb17b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x366c, 0xb16e, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x366c, 0xb17b, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0x366c, 0xb16e, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0x366c, 0xb16e, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0x366c, 0xb17b, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0x366c, 0xb17b, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0x3702, 0xb17b, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0x366c, 0xb17b, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0x3702, 0xb17b, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0x3768, 0xb063, 0xb1bd, 0x3c00, 0x000bcdb2 },
+	{ 0x3702, 0xb17b, 0xb0c7, 0x3c00, 0x000b4d9d },
+	{ 0x3702, 0xb17b, 0xb1bd, 0x3c00, 0x000b4d9d },
+	{ 0x3768, 0xb063, 0xb0c7, 0x3c00, 0x000bcdb2 },
+	{ 0x37b5, 0xae75, 0xb1bd, 0x3c00, 0x000cd1d5 },
+	{ 0x37b5, 0xae75, 0xb0c7, 0x3c00, 0x000cd1d5 },
+	{ 0x37d2, 0xad36, 0xb1bd, 0x3c00, 0x000dbdea },
+	{ 0x37d2, 0xad36, 0xb0c7, 0x3c00, 0x000dbdea },
+	{ 0x37e6, 0xabbf, 0xb1bd, 0x3c00, 0x000e91f7 },
+	{ 0x37e6, 0xabbf, 0xb0c7, 0x3c00, 0x000e91f7 },
+	{ 0x37f2, 0xa8e0, 0xb1bd, 0x3c00, 0x000f51fd },
+	{ 0x37f2, 0xa8e0, 0xb0c7, 0x3c00, 0x000f51fd },
+	{ 0x37f6, 0xa342, 0xb1bd, 0x3c00, 0x000001ff },
+	{ 0x37f6, 0xa342, 0xb0c7, 0x3c00, 0x000001ff },
+	{ 0x37f2, 0x210e, 0xb1bd, 0x3c00, 0x0000b1fd },
+	{ 0x37f2, 0x210e, 0xb0c7, 0x3c00, 0x0000b1fd },
+	{ 0x37e6, 0x2824, 0xb1bd, 0x3c00, 0x000175f7 },
+	{ 0x37e6, 0x2824, 0xb0c7, 0x3c00, 0x000175f7 },
+	{ 0x37d1, 0x2ad2, 0xb1bd, 0x3c00, 0x000245ea },
+	{ 0x37d1, 0x2ad2, 0xb0c7, 0x3c00, 0x000245ea },
+	{ 0x37b5, 0x2ca7, 0xb1bd, 0x3c00, 0x000335d4 },
+	{ 0x37b5, 0x2ca7, 0xb0c7, 0x3c00, 0x000335d4 },
+	{ 0x3768, 0x2ef7, 0xb1bd, 0x3c00, 0x000435b2 },
+	{ 0x3768, 0x2ef7, 0xb0c7, 0x3c00, 0x000435b2 },
+	{ 0x3702, 0x3093, 0xb1bd, 0x3c00, 0x0004b59d },
+	{ 0x3702, 0x3093, 0xb0c7, 0x3c00, 0x0004b59d },
+	{ 0x3768, 0x2ef7, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3762, 0x2e12, 0xb0c7, 0x3c00, 0x0004b19d },
+	{ 0x3762, 0x2e12, 0xb1bd, 0x3c00, 0x0004b19d },
+	{ 0x376b, 0x2890, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x374f, 0x2b73, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x372b, 0x2d0d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x37b5, 0x2ca7, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x377d, 0x21dc, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3783, 0xa342, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x37b5, 0xae75, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x377d, 0xa91b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x376b, 0xac14, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3768, 0xb063, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x374f, 0xad82, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x372b, 0xaedd, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3702, 0xb17b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3701, 0xb006, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x36d2, 0xb090, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x366c, 0xb16e, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x366c, 0xb17b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x36d2, 0xb090, 0xb0c7, 0x3c00, 0x0004fa70 },
+	{ 0x366c, 0xb16e, 0xb1bd, 0x3c00, 0x00056687 },
+	{ 0x366c, 0xb16e, 0xb0c7, 0x3c00, 0x00056687 },
+	{ 0x36d2, 0xb090, 0xb1bd, 0x3c00, 0x0004fa70 },
+	{ 0x3701, 0xb006, 0xb0c7, 0x3c00, 0x0004324d },
+	{ 0x3701, 0xb006, 0xb1bd, 0x3c00, 0x0004324d },
+	{ 0x372b, 0xaedd, 0xb0c7, 0x3c00, 0x00037633 },
+	{ 0x372b, 0xaedd, 0xb1bd, 0x3c00, 0x00037633 },
+	{ 0x374f, 0xad82, 0xb1bd, 0x3c00, 0x0002ba20 },
+	{ 0x374f, 0xad82, 0xb0c7, 0x3c00, 0x0002ba20 },
+	{ 0x37d1, 0x2ad2, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x37d2, 0xad36, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x37e6, 0x2824, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x37e6, 0xabbf, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x37f2, 0x210e, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x37f2, 0xa8e0, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x37f6, 0xa342, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x372b, 0x2d0d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3702, 0x3093, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3768, 0x2ef7, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3700, 0x2e41, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x36d0, 0x2f54, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x366c, 0x3086, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x366c, 0x3093, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x36d0, 0x2f54, 0xb1bd, 0x3c00, 0x000b0a70 },
+	{ 0x366c, 0x3086, 0xb0c7, 0x3c00, 0x000aa286 },
+	{ 0x366c, 0x3086, 0xb1bd, 0x3c00, 0x000aa286 },
+	{ 0x36d0, 0x2f54, 0xb0c7, 0x3c00, 0x000b0a70 },
+	{ 0x374f, 0x2b73, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x376b, 0x2890, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x37b5, 0x2ca7, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x377d, 0x21dc, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3783, 0xa342, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x37d1, 0x2ad2, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x37d2, 0xad36, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x37e6, 0x2824, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x37e6, 0xabbf, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x37f2, 0x210e, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x37f2, 0xa8e0, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x37f6, 0xa342, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3562, 0x3039, 0xb0c7, 0x3c00, 0x000764c0 },
+	{ 0x3533, 0x3054, 0xb0c7, 0x3c00, 0x0007d85e },
+	{ 0x353a, 0x3050, 0xb0c7, 0x3c00, 0x0007ac8f },
+	{ 0x3533, 0x3054, 0xb1bd, 0x3c00, 0x0007d85e },
+	{ 0x3562, 0x3039, 0xb1bd, 0x3c00, 0x000764c0 },
+	{ 0x358c, 0x300c, 0xb1bd, 0x3c00, 0x0006a51c },
+	{ 0x358c, 0x300c, 0xb0c7, 0x3c00, 0x0006a51c },
+	{ 0x3562, 0x3039, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3569, 0x2e80, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x358c, 0x300c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x353a, 0x2f02, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3501, 0x2f2d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x34c7, 0x2f02, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3498, 0x2e80, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3479, 0x2dc0, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3476, 0x300c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x346e, 0x2cd8, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3450, 0x2827, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3450, 0x2f9b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3430, 0x2955, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3430, 0x2f03, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x341a, 0x2aa7, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x341a, 0x2e5a, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x340c, 0x2c0d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x340c, 0x2da1, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3408, 0x2cd8, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x340c, 0x2da1, 0xb0c7, 0x3c00, 0x00017e0a },
+	{ 0x340c, 0x2da1, 0xb1bd, 0x3c00, 0x00017e0a },
+	{ 0x341a, 0x2e5a, 0xb0c7, 0x3c00, 0x00030627 },
+	{ 0x341a, 0x2e5a, 0xb1bd, 0x3c00, 0x00030627 },
+	{ 0x3430, 0x2f03, 0xb0c7, 0x3c00, 0x00047658 },
+	{ 0x3430, 0x2f03, 0xb1bd, 0x3c00, 0x00047658 },
+	{ 0x3450, 0x2f9b, 0xb0c7, 0x3c00, 0x0005a697 },
+	{ 0x3450, 0x2f9b, 0xb1bd, 0x3c00, 0x0005a697 },
+	{ 0x3476, 0x300c, 0xb1bd, 0x3c00, 0x0006a6e4 },
+	{ 0x3476, 0x300c, 0xb0c7, 0x3c00, 0x0006a6e4 },
+	{ 0x3478, 0x300e, 0xb0c7, 0x3c00, 0x00070f10 },
+	{ 0x3476, 0x265b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3479, 0x2bdb, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x34a1, 0x24f7, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x34a1, 0x24f7, 0xb0c7, 0x3c00, 0x00089b41 },
+	{ 0x34a1, 0x24f7, 0xb1bd, 0x3c00, 0x00089b41 },
+	{ 0x34a1, 0x24f7, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3499, 0x2a5c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3499, 0x2a5c, 0xb0c7, 0x3c00, 0x0005a56a },
+	{ 0x3499, 0x2a5c, 0xb1bd, 0x3c00, 0x0005a56a },
+	{ 0x3499, 0x2a5c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x34c8, 0x295d, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x34cf, 0x2421, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x34cf, 0x2421, 0xb0c7, 0x3c00, 0x00082ba2 },
+	{ 0x34cf, 0x2421, 0xb1bd, 0x3c00, 0x00082ba2 },
+	{ 0x34c8, 0x295d, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x34cf, 0x2421, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x34c8, 0x295d, 0xb1bd, 0x3c00, 0x000764c2 },
+	{ 0x34c8, 0x295d, 0xb0c7, 0x3c00, 0x000764c2 },
+	{ 0x3501, 0x2908, 0xb1bd, 0x3c00, 0x0007fc00 },
+	{ 0x3501, 0x2908, 0xb0c7, 0x3c00, 0x0007fc00 },
+	{ 0x3501, 0x2908, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3501, 0x23b3, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3501, 0x23b3, 0xb0c7, 0x3c00, 0x00080400 },
+	{ 0x3501, 0x23b3, 0xb1bd, 0x3c00, 0x00080400 },
+	{ 0x3501, 0x2908, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3501, 0x23b3, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x353a, 0x295f, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x353a, 0x295f, 0xb1bd, 0x3c00, 0x00075f3b },
+	{ 0x353a, 0x295f, 0xb0c7, 0x3c00, 0x00075f3b },
+	{ 0x3533, 0x2422, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x353a, 0x295f, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3533, 0x2422, 0xb0c7, 0x3c00, 0x0008285e },
+	{ 0x3533, 0x2422, 0xb1bd, 0x3c00, 0x0008285e },
+	{ 0x3533, 0x2422, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3562, 0x24f9, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3569, 0x2a64, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3569, 0x2a64, 0xb1bd, 0x3c00, 0x00059292 },
+	{ 0x3569, 0x2a64, 0xb0c7, 0x3c00, 0x00059292 },
+	{ 0x3562, 0x24f9, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3569, 0x2a64, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3562, 0x24f9, 0xb0c7, 0x3c00, 0x00089cc0 },
+	{ 0x3562, 0x24f9, 0xb1bd, 0x3c00, 0x00089cc0 },
+	{ 0x358c, 0x2661, 0xb0c7, 0x3c00, 0x00095d1c },
+	{ 0x358c, 0x2661, 0xb1bd, 0x3c00, 0x00095d1c },
+	{ 0x358c, 0x2661, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3589, 0x2be5, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3589, 0x2be5, 0xb0c7, 0x3c00, 0x0002f625 },
+	{ 0x3589, 0x2be5, 0xb1bd, 0x3c00, 0x0002f625 },
+	{ 0x358c, 0x2661, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3589, 0x2be5, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3593, 0x2cd8, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x35b2, 0x282c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x35b2, 0x282c, 0xb0c7, 0x3c00, 0x000a5d69 },
+	{ 0x35b2, 0x282c, 0xb1bd, 0x3c00, 0x000a5d69 },
+	{ 0x3593, 0x2cd8, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x35b2, 0x282c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3593, 0x2cd8, 0xb0c7, 0x3c00, 0x00000201 },
+	{ 0x3593, 0x2cd8, 0xb1bd, 0x3c00, 0x00000201 },
+	{ 0x3589, 0x2dc0, 0xb0c7, 0x3c00, 0x000d0e25 },
+	{ 0x3589, 0x2dc0, 0xb1bd, 0x3c00, 0x000d0e25 },
+	{ 0x3569, 0x2e80, 0xb0c7, 0x3c00, 0x000a6e92 },
+	{ 0x3569, 0x2e80, 0xb1bd, 0x3c00, 0x000a6e92 },
+	{ 0x353a, 0x2f02, 0xb1bd, 0x3c00, 0x0008a33c },
+	{ 0x353a, 0x2f02, 0xb0c7, 0x3c00, 0x0008a33c },
+	{ 0x3533, 0x3054, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x353a, 0x2f02, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3562, 0x3039, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3569, 0x2e80, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x358c, 0x300c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x3589, 0x2dc0, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x35b2, 0x2f9b, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x35b2, 0x2f9b, 0xb1bd, 0x3c00, 0x0005a569 },
+	{ 0x35b2, 0x2f9b, 0xb0c7, 0x3c00, 0x0005a569 },
+	{ 0x35b2, 0x2f9b, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x3589, 0x2dc0, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x35d1, 0x295c, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x35d1, 0x295c, 0xb1bd, 0x3c00, 0x000b8da8 },
+	{ 0x35d1, 0x295c, 0xb0c7, 0x3c00, 0x000b8da8 },
+	{ 0x35d1, 0x2f03, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x35d1, 0x295c, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x35d1, 0x2f03, 0xb0c7, 0x3c00, 0x000475a8 },
+	{ 0x35d1, 0x2f03, 0xb1bd, 0x3c00, 0x000475a8 },
+	{ 0x35d1, 0x2f03, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x35e8, 0x2aad, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x35e8, 0x2aad, 0xb1bd, 0x3c00, 0x000cfdd9 },
+	{ 0x35e8, 0x2aad, 0xb0c7, 0x3c00, 0x000cfdd9 },
+	{ 0x35e8, 0x2e5a, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x35e8, 0x2aad, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x35e8, 0x2e5a, 0xb0c7, 0x3c00, 0x000305d9 },
+	{ 0x35e8, 0x2e5a, 0xb1bd, 0x3c00, 0x000305d9 },
+	{ 0x35e8, 0x2e5a, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x35f5, 0x2c0f, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x35f5, 0x2c0f, 0xb1bd, 0x3c00, 0x000e85f6 },
+	{ 0x35f5, 0x2c0f, 0xb0c7, 0x3c00, 0x000e85f6 },
+	{ 0x35f5, 0x2da1, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x35f5, 0x2c0f, 0xb1bd, 0x3c00, 0x20100000 },
+	{ 0x35f5, 0x2da1, 0xb0c7, 0x3c00, 0x00017df6 },
+	{ 0x35f5, 0x2da1, 0xb1bd, 0x3c00, 0x00017df6 },
+	{ 0x35f5, 0x2da1, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x35fa, 0x2cd8, 0xb0c7, 0x3c00, 0x1ff00000 },
+	{ 0x35fa, 0x2cd8, 0xb1bd, 0x3c00, 0x000001ff },
+	{ 0x35fa, 0x2cd8, 0xb0c7, 0x3c00, 0x000001ff },
+	{ 0x35fa, 0x2cd8, 0xb1bd, 0x3c00, 0x20100000 },
+};
+
+const uint16_t lennyIndices[3345] =
+{
+	0, 1, 2, 1, 0, 3, 4, 5, 6, 5, 4, 7,
+	8, 7, 4, 7, 8, 9, 10, 9, 8, 9, 10, 11,
+	10, 12, 11, 12, 10, 13, 1, 3, 14, 14, 3, 15,
+	6, 16, 17, 16, 6, 5, 18, 19, 20, 18, 21, 19,
+	22, 21, 18, 21, 22, 23, 20, 19, 24, 13, 25, 12,
+	25, 13, 26, 14, 15, 27, 27, 15, 28, 17, 29, 30,
+	29, 17, 16, 20, 24, 31, 31, 24, 32, 26, 33, 25,
+	33, 26, 34, 27, 28, 35, 35, 28, 36, 30, 37, 38,
+	37, 30, 29, 31, 32, 39, 39, 32, 40, 41, 40, 32,
+	40, 41, 42, 42, 41, 43, 43, 41, 44, 44, 41, 45,
+	46, 47, 48, 47, 46, 49, 33, 49, 46, 49, 33, 34,
+	50, 51, 35, 51, 50, 52, 53, 54, 55, 54, 53, 56,
+	57, 56, 53, 56, 57, 58, 59, 58, 57, 58, 59, 60,
+	61, 60, 59, 60, 61, 62, 63, 62, 61, 62, 63, 64,
+	65, 64, 63, 64, 65, 66, 67, 66, 65, 66, 67, 68,
+	69, 68, 67, 68, 69, 70, 71, 72, 73, 72, 71, 74,
+	75, 76, 77, 75, 78, 76, 79, 78, 75, 80, 78, 79,
+	81, 78, 80, 81, 36, 78, 82, 36, 81, 83, 36, 82,
+	50, 36, 83, 35, 36, 50, 38, 84, 85, 84, 38, 37,
+	39, 86, 87, 39, 88, 86, 39, 89, 88, 39, 40, 89,
+	87, 86, 90, 87, 90, 91, 87, 91, 92, 87, 92, 93,
+	93, 92, 94, 95, 96, 97, 96, 95, 98, 99, 55, 54,
+	55, 99, 100, 101, 100, 99, 100, 101, 102, 103, 102, 101,
+	102, 103, 104, 103, 105, 104, 105, 103, 106, 107, 45, 108,
+	44, 45, 107, 108, 45, 109, 109, 45, 110, 111, 112, 113,
+	112, 111, 114, 115, 116, 117, 115, 118, 116, 115, 119, 118,
+	115, 120, 119, 51, 120, 115, 51, 121, 120, 51, 52, 121,
+	105, 122, 123, 122, 105, 106, 124, 123, 122, 123, 124, 125,
+	126, 127, 128, 127, 126, 129, 117, 116, 130, 109, 110, 131,
+	132, 133, 134, 133, 132, 135, 136, 137, 138, 137, 136, 139,
+	140, 139, 136, 139, 140, 141, 142, 143, 144, 143, 142, 145,
+	146, 147, 148, 147, 146, 149, 146, 150, 149, 150, 146, 151,
+	152, 153, 154, 152, 155, 153, 133, 155, 152, 133, 135, 155,
+	137, 156, 138, 156, 137, 157, 158, 159, 160, 161, 159, 158,
+	159, 161, 162, 160, 159, 163, 160, 163, 164, 164, 163, 165,
+	164, 165, 166, 166, 165, 167, 150, 168, 169, 151, 168, 150,
+	168, 151, 170, 154, 171, 172, 154, 153, 171, 173, 174, 175,
+	174, 173, 176, 176, 177, 174, 177, 176, 178, 166, 167, 179,
+	179, 167, 180, 181, 180, 167, 180, 181, 182, 182, 181, 183,
+	183, 181, 184, 168, 185, 186, 170, 185, 168, 185, 170, 187,
+	172, 188, 189, 172, 190, 188, 172, 171, 190, 178, 191, 177,
+	191, 178, 192, 179, 182, 193, 179, 180, 182, 194, 195, 196,
+	195, 194, 197, 198, 199, 200, 201, 199, 198, 202, 199, 201,
+	202, 203, 199, 204, 203, 202, 205, 203, 204, 205, 206, 203,
+	207, 206, 205, 207, 208, 206, 209, 208, 207, 209, 210, 208,
+	211, 210, 209, 211, 212, 210, 212, 211, 213, 214, 215, 216,
+	215, 214, 217, 218, 217, 214, 217, 218, 219, 220, 219, 218,
+	219, 220, 221, 222, 221, 220, 221, 222, 223, 222, 224, 223,
+	224, 222, 225, 204, 226, 205, 226, 204, 227, 228, 229, 230,
+	229, 228, 231, 232, 231, 228, 231, 232, 233, 234, 233, 232,
+	233, 234, 235, 234, 236, 235, 236, 234, 237, 237, 238, 236,
+	238, 237, 239, 198, 200, 240, 240, 200, 241, 196, 242, 194,
+	242, 196, 243, 193, 182, 183, 193, 183, 244, 183, 184, 244,
+	245, 246, 247, 245, 248, 246, 248, 245, 249, 245, 250, 249,
+	250, 245, 251, 252, 253, 254, 252, 255, 253, 184, 255, 252,
+	184, 256, 255, 181, 256, 184, 181, 257, 256, 181, 258, 257,
+	181, 259, 258, 167, 259, 181, 260, 259, 167, 260, 261, 259,
+	260, 262, 261, 263, 262, 260, 263, 264, 262, 265, 264, 263,
+	265, 266, 264, 267, 266, 265, 267, 268, 266, 269, 268, 267,
+	268, 269, 270, 271, 216, 215, 216, 271, 272, 273, 272, 271,
+	272, 273, 274, 275, 274, 273, 274, 275, 276, 277, 276, 275,
+	276, 277, 278, 277, 279, 278, 279, 277, 280, 195, 279, 280,
+	279, 195, 197, 195, 280, 281, 282, 261, 262, 261, 282, 283,
+	283, 282, 284, 225, 285, 224, 285, 225, 286, 226, 227, 287,
+	287, 227, 288, 230, 289, 290, 289, 230, 229, 283, 284, 291,
+	291, 284, 292, 292, 284, 293, 286, 294, 285, 294, 286, 295,
+	287, 296, 297, 287, 288, 296, 289, 298, 290, 298, 289, 299,
+	299, 300, 298, 300, 299, 301, 292, 293, 302, 302, 293, 303,
+	295, 304, 294, 304, 295, 305, 297, 306, 307, 297, 296, 306,
+	307, 306, 308, 301, 309, 300, 309, 301, 310, 302, 311, 312,
+	302, 303, 311, 305, 313, 304, 313, 305, 314, 307, 308, 315,
+	315, 308, 316, 316, 308, 317, 310, 318, 309, 318, 310, 319,
+	312, 320, 321, 312, 311, 320, 314, 322, 313, 322, 314, 323,
+	323, 324, 322, 324, 323, 325, 316, 317, 326, 326, 317, 327,
+	318, 328, 329, 328, 318, 319, 321, 330, 331, 321, 320, 330,
+	331, 330, 332, 332, 330, 333, 325, 334, 324, 334, 325, 335,
+	326, 336, 337, 326, 327, 336, 329, 338, 339, 338, 329, 328,
+	340, 339, 338, 339, 340, 341, 342, 341, 340, 341, 342, 343,
+	342, 344, 343, 344, 342, 345, 345, 239, 344, 239, 345, 238,
+	240, 346, 347, 240, 241, 346, 243, 248, 242, 248, 243, 246,
+	347, 346, 348, 347, 348, 349, 349, 348, 350, 349, 350, 351,
+	351, 350, 336, 336, 350, 352, 251, 353, 250, 353, 251, 354,
+	254, 332, 355, 254, 356, 332, 254, 253, 356, 355, 332, 333,
+	355, 333, 357, 334, 358, 359, 358, 334, 335, 337, 360, 361,
+	337, 352, 360, 337, 336, 352, 353, 362, 363, 362, 353, 354,
+	355, 357, 364, 364, 357, 365, 359, 366, 367, 366, 359, 358,
+	361, 368, 369, 361, 360, 368, 363, 370, 371, 370, 363, 362,
+	364, 365, 372, 372, 365, 373, 367, 374, 375, 374, 367, 366,
+	369, 376, 377, 369, 368, 376, 371, 378, 379, 378, 371, 370,
+	372, 373, 380, 380, 373, 381, 375, 382, 383, 382, 375, 374,
+	377, 376, 384, 379, 383, 382, 383, 379, 378, 385, 244, 184,
+	193, 244, 385, 386, 191, 192, 191, 386, 387, 386, 388, 387,
+	388, 386, 389, 385, 390, 391, 385, 392, 390, 385, 184, 392,
+	187, 393, 185, 393, 187, 394, 189, 395, 396, 189, 188, 395,
+	396, 395, 397, 396, 397, 398, 389, 399, 388, 399, 389, 400,
+	391, 390, 401, 401, 390, 402, 394, 403, 393, 403, 394, 404,
+	396, 398, 405, 405, 398, 406, 400, 407, 399, 407, 400, 408,
+	401, 402, 409, 409, 402, 410, 410, 402, 411, 404, 412, 403,
+	412, 404, 413, 405, 414, 415, 405, 406, 414, 408, 416, 407,
+	416, 408, 417, 417, 418, 416, 418, 417, 419, 410, 411, 420,
+	420, 411, 421, 412, 422, 423, 422, 412, 413, 415, 424, 425,
+	415, 414, 424, 425, 424, 426, 419, 427, 418, 427, 419, 428,
+	420, 421, 429, 429, 421, 430, 431, 432, 433, 432, 431, 434,
+	425, 426, 435, 435, 426, 436, 427, 437, 438, 437, 427, 428,
+	429, 430, 439, 440, 438, 437, 438, 440, 441, 175, 157, 173,
+	157, 175, 156, 442, 443, 444, 443, 442, 445, 445, 442, 446,
+	446, 442, 447, 448, 449, 450, 449, 448, 451, 452, 453, 454,
+	453, 452, 455, 456, 457, 458, 457, 456, 459, 460, 459, 456,
+	459, 460, 461, 460, 462, 461, 462, 460, 463, 463, 464, 462,
+	464, 463, 465, 446, 447, 466, 466, 447, 467, 449, 468, 450,
+	468, 449, 469, 470, 471, 472, 470, 473, 471, 474, 473, 470,
+	474, 475, 473, 474, 476, 475, 476, 474, 477, 472, 471, 478,
+	465, 479, 464, 479, 465, 480, 466, 467, 481, 481, 467, 482,
+	469, 483, 468, 483, 469, 484, 472, 478, 485, 485, 478, 486,
+	480, 487, 479, 487, 480, 488, 481, 482, 489, 489, 482, 490,
+	490, 482, 491, 484, 492, 483, 492, 484, 493, 485, 494, 495,
+	485, 486, 494, 488, 496, 487, 496, 488, 497, 497, 498, 496,
+	498, 497, 499, 490, 491, 500, 500, 491, 501, 493, 502, 492,
+	502, 493, 503, 495, 504, 505, 495, 494, 504, 505, 504, 506,
+	499, 507, 498, 507, 499, 508, 500, 501, 509, 509, 501, 510,
+	510, 501, 511, 503, 512, 502, 512, 503, 513, 505, 514, 515,
+	505, 506, 514, 508, 516, 507, 516, 508, 517, 517, 518, 516,
+	518, 517, 519, 510, 511, 520, 520, 511, 521, 521, 511, 522,
+	513, 523, 512, 523, 513, 524, 515, 525, 526, 515, 527, 525,
+	515, 514, 527, 519, 528, 518, 528, 519, 529, 529, 530, 528,
+	530, 529, 531, 521, 522, 532, 532, 522, 533, 523, 534, 535,
+	534, 523, 524, 526, 536, 537, 526, 525, 536, 537, 536, 538,
+	531, 539, 530, 539, 531, 540, 532, 533, 541, 541, 533, 542,
+	543, 544, 545, 544, 543, 546, 537, 538, 547, 547, 538, 548,
+	539, 549, 550, 549, 539, 540, 541, 542, 551, 552, 550, 549,
+	550, 552, 553, 554, 555, 556, 555, 554, 557, 557, 554, 558,
+	558, 554, 559, 560, 561, 562, 561, 560, 563, 564, 565, 566,
+	565, 564, 567, 568, 569, 570, 569, 568, 571, 572, 573, 574,
+	573, 572, 575, 575, 576, 573, 576, 575, 577, 577, 578, 576,
+	578, 577, 579, 558, 559, 580, 580, 559, 581, 582, 583, 584,
+	583, 582, 585, 586, 587, 588, 587, 586, 589, 590, 589, 586,
+	590, 591, 589, 592, 591, 590, 591, 592, 593, 588, 587, 594,
+	579, 595, 578, 595, 579, 596, 580, 581, 597, 597, 581, 598,
+	585, 599, 583, 599, 585, 600, 588, 594, 601, 601, 594, 602,
+	595, 603, 604, 603, 595, 596, 597, 598, 605, 605, 598, 606,
+	606, 598, 607, 600, 608, 599, 608, 600, 609, 601, 610, 611,
+	601, 602, 610, 604, 612, 613, 612, 604, 603, 614, 613, 612,
+	613, 614, 615, 616, 615, 614, 615, 616, 617, 616, 618, 617,
+	618, 616, 619, 620, 621, 622, 623, 621, 620, 623, 624, 621,
+	623, 625, 624, 626, 625, 623, 626, 627, 625, 626, 628, 627,
+	629, 628, 626, 629, 630, 628, 631, 630, 629, 631, 632, 630,
+	631, 633, 632, 631, 634, 633, 635, 634, 631, 634, 635, 636,
+	637, 638, 639, 638, 637, 640, 641, 642, 643, 642, 641, 644,
+	644, 641, 645, 645, 641, 646, 646, 641, 647, 647, 641, 648,
+	649, 650, 651, 650, 649, 652, 652, 653, 650, 653, 652, 654,
+	654, 655, 653, 655, 654, 656, 656, 657, 655, 657, 656, 658,
+	658, 659, 657, 659, 658, 660, 620, 661, 662, 620, 622, 661,
+	662, 661, 607, 606, 607, 661, 662, 607, 663, 608, 664, 665,
+	664, 608, 609, 611, 666, 667, 668, 666, 611, 668, 669, 666,
+	670, 669, 668, 671, 669, 670, 671, 672, 669, 673, 672, 671,
+	674, 672, 673, 674, 675, 672, 676, 675, 674, 677, 675, 676,
+	677, 648, 675, 647, 648, 677, 678, 679, 680, 679, 678, 681,
+	678, 682, 681, 682, 678, 683, 683, 684, 682, 684, 683, 685,
+	685, 686, 684, 686, 685, 687, 687, 619, 686, 619, 687, 618,
+	679, 688, 680, 688, 679, 689, 689, 690, 688, 690, 689, 691,
+	691, 692, 690, 692, 691, 693, 694, 695, 696, 695, 694, 697,
+	611, 610, 668, 667, 666, 698, 659, 699, 700, 699, 659, 660,
+	662, 663, 701, 701, 663, 702, 665, 703, 704, 703, 665, 664,
+	667, 698, 705, 705, 698, 706, 700, 707, 708, 707, 700, 699,
+	701, 702, 709, 709, 702, 710, 704, 711, 712, 711, 704, 703,
+	705, 706, 713, 713, 706, 714, 708, 715, 716, 715, 708, 707,
+	709, 710, 717, 717, 710, 718, 712, 719, 720, 719, 712, 711,
+	713, 714, 721, 721, 714, 722, 716, 723, 724, 723, 716, 715,
+	717, 718, 725, 720, 724, 723, 724, 720, 719, 651, 726, 649,
+	726, 651, 727, 728, 729, 730, 729, 728, 731, 732, 733, 734,
+	733, 732, 735, 736, 735, 732, 735, 736, 737, 738, 739, 740,
+	739, 738, 741, 742, 743, 744, 743, 742, 745, 742, 746, 745,
+	746, 742, 747, 748, 749, 750, 748, 751, 749, 729, 751, 748,
+	729, 731, 751, 733, 752, 734, 752, 733, 753, 754, 755, 756,
+	757, 755, 754, 755, 757, 758, 756, 755, 759, 756, 759, 760,
+	760, 759, 761, 760, 761, 762, 762, 761, 763, 746, 764, 765,
+	747, 764, 746, 764, 747, 766, 750, 767, 768, 750, 749, 767,
+	769, 770, 771, 770, 769, 772, 772, 773, 770, 773, 772, 774,
+	762, 763, 775, 775, 763, 776, 777, 776, 763, 776, 777, 778,
+	778, 777, 779, 779, 777, 780, 764, 781, 782, 766, 781, 764,
+	781, 766, 783, 768, 784, 785, 768, 786, 784, 768, 767, 786,
+	774, 787, 773, 787, 774, 788, 775, 778, 789, 775, 776, 778,
+	790, 791, 792, 791, 790, 793, 794, 795, 796, 797, 795, 794,
+	798, 795, 797, 798, 799, 795, 800, 799, 798, 801, 799, 800,
+	801, 802, 799, 803, 802, 801, 803, 804, 802, 805, 804, 803,
+	805, 806, 804, 807, 806, 805, 807, 808, 806, 808, 807, 809,
+	810, 811, 812, 811, 810, 813, 814, 813, 810, 813, 814, 815,
+	816, 815, 814, 815, 816, 817, 818, 817, 816, 817, 818, 819,
+	818, 820, 819, 820, 818, 821, 800, 822, 801, 822, 800, 823,
+	824, 825, 826, 825, 824, 827, 828, 827, 824, 827, 828, 829,
+	830, 829, 828, 829, 830, 831, 830, 832, 831, 832, 830, 833,
+	833, 834, 832, 834, 833, 835, 794, 796, 836, 836, 796, 837,
+	792, 838, 790, 838, 792, 839, 789, 778, 779, 789, 779, 840,
+	779, 780, 840, 841, 840, 780, 789, 840, 841, 842, 787, 788,
+	787, 842, 843, 842, 844, 843, 844, 842, 845, 841, 846, 847,
+	841, 848, 846, 841, 780, 848, 783, 849, 781, 849, 783, 850,
+	785, 851, 852, 785, 784, 851, 852, 851, 853, 852, 853, 854,
+	845, 855, 844, 855, 845, 856, 847, 846, 857, 857, 846, 858,
+	850, 859, 849, 859, 850, 860, 852, 854, 861, 861, 854, 862,
+	856, 863, 855, 863, 856, 864, 857, 858, 865, 865, 858, 866,
+	866, 858, 867, 868, 867, 858, 867, 868, 869, 869, 868, 870,
+	871, 872, 873, 872, 871, 874, 871, 860, 874, 860, 871, 859,
+	861, 875, 876, 861, 862, 875, 864, 877, 863, 877, 864, 878,
+	865, 866, 879, 866, 869, 879, 869, 866, 867, 880, 881, 882,
+	881, 880, 883, 884, 885, 886, 885, 884, 887, 887, 884, 888,
+	889, 890, 879, 890, 889, 891, 892, 893, 894, 893, 892, 877,
+	876, 875, 895, 876, 895, 896, 896, 895, 897, 894, 898, 892,
+	898, 894, 899, 891, 869, 900, 889, 869, 891, 879, 869, 889,
+	893, 877, 878, 900, 869, 901, 869, 870, 901, 901, 870, 902,
+	903, 904, 905, 906, 904, 903, 904, 906, 907, 896, 897, 908,
+	908, 897, 909, 898, 910, 911, 910, 898, 899, 900, 912, 913,
+	900, 902, 912, 900, 901, 902, 914, 915, 916, 917, 915, 914,
+	915, 917, 918, 919, 918, 917, 918, 919, 920, 921, 920, 919,
+	920, 921, 922, 923, 922, 921, 922, 923, 924, 925, 924, 923,
+	924, 925, 926, 927, 926, 925, 926, 927, 928, 927, 929, 928,
+	929, 927, 930, 931, 932, 933, 934, 932, 931, 934, 935, 932,
+	934, 936, 935, 937, 936, 934, 937, 938, 936, 937, 939, 938,
+	940, 939, 937, 939, 940, 941, 942, 943, 944, 943, 942, 945,
+	946, 947, 948, 947, 946, 949, 950, 951, 952, 951, 950, 953,
+	954, 953, 950, 953, 954, 955, 956, 955, 954, 955, 956, 957,
+	958, 957, 956, 957, 958, 959, 960, 959, 958, 959, 960, 961,
+	962, 961, 960, 961, 962, 963, 964, 963, 962, 963, 964, 965,
+	966, 965, 964, 965, 966, 967, 968, 967, 966, 967, 968, 969,
+	970, 969, 968, 969, 970, 971, 972, 971, 970, 971, 972, 973,
+	974, 973, 972, 973, 974, 975, 890, 900, 976, 890, 891, 900,
+	976, 900, 913, 976, 913, 912, 977, 911, 910, 911, 977, 978,
+	912, 979, 976, 912, 980, 979, 912, 981, 980, 981, 912, 902,
+	976, 979, 982, 982, 979, 983, 982, 983, 984, 984, 985, 982,
+	986, 985, 984, 987, 985, 986, 987, 988, 985, 989, 988, 987,
+	990, 988, 989, 990, 991, 988, 992, 991, 990, 993, 991, 992,
+	994, 991, 993, 991, 994, 995, 996, 997, 998, 997, 996, 999,
+	1000, 999, 996, 999, 1000, 1001, 1002, 1001, 1000, 1001, 1002, 1003,
+	1002, 1004, 1003, 1004, 1002, 1005, 1005, 930, 1004, 930, 1005, 929,
+	982, 985, 1006, 1006, 985, 1007, 1006, 1007, 1008, 1008, 1007, 1009,
+	1008, 1009, 1010, 1010, 1009, 1011, 1010, 1011, 1012, 1013, 1014, 1015,
+	1016, 1014, 1013, 1017, 1014, 1016, 1018, 1014, 1017, 1014, 1018, 1019,
+	1020, 1021, 1022, 1021, 1020, 1023, 914, 1023, 1020, 1023, 914, 916,
+	1013, 1015, 1024, 1024, 1015, 1025, 1025, 1015, 1026, 1025, 1026, 1027,
+	1027, 1026, 1028, 931, 1028, 1026, 931, 933, 1028, 931, 1026, 1029,
+	931, 1029, 1030, 1030, 1029, 1031, 1030, 1031, 1032, 1032, 1031, 1033,
+	1032, 1033, 1034, 1034, 1033, 1035, 1036, 1037, 1038, 1036, 1039, 1037,
+	1039, 1036, 1040, 1036, 1041, 1040, 1041, 1036, 1042, 1043, 1044, 1045,
+	1043, 1046, 1044, 780, 1046, 1043, 780, 1047, 1046, 777, 1047, 780,
+	777, 1048, 1047, 777, 1049, 1048, 777, 1050, 1049, 763, 1050, 777,
+	1051, 1050, 763, 1051, 1052, 1050, 1051, 1053, 1052, 1054, 1053, 1051,
+	1054, 1055, 1053, 1056, 1055, 1054, 1056, 1057, 1055, 1058, 1057, 1056,
+	1058, 1059, 1057, 1060, 1059, 1058, 1059, 1060, 1061, 1062, 812, 811,
+	812, 1062, 1063, 1064, 1063, 1062, 1063, 1064, 1065, 1066, 1065, 1064,
+	1065, 1066, 1067, 1068, 1067, 1066, 1067, 1068, 1069, 1068, 1070, 1069,
+	1070, 1068, 1071, 791, 1070, 1071, 1070, 791, 793, 791, 1071, 1072,
+	1073, 1052, 1053, 1052, 1073, 1074, 1074, 1073, 1075, 821, 1076, 820,
+	1076, 821, 1077, 822, 823, 1078, 1078, 823, 1079, 826, 1080, 1081,
+	1080, 826, 825, 1074, 1075, 1082, 1082, 1075, 1083, 1083, 1075, 1084,
+	1077, 1085, 1076, 1085, 1077, 1086, 1078, 1087, 1088, 1078, 1079, 1087,
+	1080, 1089, 1081, 1089, 1080, 1090, 1090, 1091, 1089, 1091, 1090, 1092,
+	1083, 1084, 1093, 1093, 1084, 1094, 1086, 1095, 1085, 1095, 1086, 1096,
+	1088, 1097, 1098, 1088, 1087, 1097, 1098, 1097, 1099, 1092, 1100, 1091,
+	1100, 1092, 1101, 1093, 1102, 1103, 1093, 1094, 1102, 1096, 1104, 1095,
+	1104, 1096, 1105, 1098, 1099, 1106, 1106, 1099, 1107, 1107, 1099, 1108,
+	1101, 1109, 1100, 1109, 1101, 1110, 1103, 1111, 1112, 1103, 1102, 1111,
+	1105, 1113, 1104, 1113, 1105, 1114, 1114, 1115, 1113, 1115, 1114, 1116,
+	1107, 1108, 1117, 1117, 1108, 1118, 1109, 1119, 1120, 1119, 1109, 1110,
+	1112, 1121, 1122, 1112, 1111, 1121, 1122, 1121, 1123, 1123, 1121, 1124,
+	1116, 1125, 1115, 1125, 1116, 1126, 1117, 1127, 1128, 1117, 1118, 1127,
+	1120, 1129, 1130, 1129, 1120, 1119, 1131, 1130, 1129, 1130, 1131, 1132,
+	1133, 1132, 1131, 1132, 1133, 1134, 1133, 1135, 1134, 1135, 1133, 1136,
+	1136, 835, 1135, 835, 1136, 834, 836, 1137, 1138, 836, 837, 1137,
+	839, 1039, 838, 1039, 839, 1037, 1138, 1137, 1139, 1138, 1139, 1140,
+	1140, 1139, 1141, 1140, 1141, 1142, 1142, 1141, 1127, 1127, 1141, 1143,
+	1042, 1144, 1041, 1144, 1042, 1145, 1045, 1123, 1146, 1045, 1147, 1123,
+	1045, 1044, 1147, 1146, 1123, 1124, 1146, 1124, 1148, 1125, 1149, 1150,
+	1149, 1125, 1126, 1128, 1151, 1152, 1128, 1143, 1151, 1128, 1127, 1143,
+	1144, 1153, 1154, 1153, 1144, 1145, 1146, 1148, 1155, 1155, 1148, 1156,
+	1150, 1157, 1158, 1157, 1150, 1149, 1152, 1159, 1160, 1152, 1151, 1159,
+	1154, 1161, 1162, 1161, 1154, 1153, 1155, 1156, 1163, 1163, 1156, 1164,
+	1158, 1165, 1166, 1165, 1158, 1157, 1160, 1167, 1168, 1160, 1159, 1167,
+	1162, 1169, 1170, 1169, 1162, 1161, 1163, 1164, 1171, 1171, 1164, 1172,
+	1166, 1173, 1174, 1173, 1166, 1165, 1168, 1167, 1175, 1170, 1174, 1173,
+	1174, 1170, 1169, 771, 753, 769, 753, 771, 752,
 };
@@ -1,19 +1,23 @@
 #pragma once
+#include <stdint.h>
 
+// Packed vertex, see tools/packlenny.py
 typedef struct
 {
-	float x, y, z;
-	float nx, ny, nz;
+	uint16_t x, y, z, w; // half-float position
+	uint32_t normal;     // GL_INT_2_10_10_10_REV normal
 } lennyVertex;
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-extern const lennyVertex lennyVertices[3345];
+extern const lennyVertex lennyVertices[1176];
+extern const uint16_t lennyIndices[3345];
 
 #ifdef __cplusplus
 }
 #endif
 
 #define lennyVerticesCount (sizeof(lennyVertices)/sizeof(lennyVertices[0]))
+#define lennyIndicesCount (sizeof(lennyIndices)/sizeof(lennyIndices[0]))
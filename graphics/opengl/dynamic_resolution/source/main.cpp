@@ -3,9 +3,7 @@
 #include <string.h>
 #include <switch.h>
 
-#include <EGL/egl.h>    // EGL library
-#include <EGL/eglext.h> // EGL extensions
-#include <glad/glad.h>  // glad library (OpenGL loader)
+#include "gl_harness.h"
 
 // GLM headers
 #define GLM_FORCE_PURE
@@ -20,187 +18,63 @@
 // ( ͡° ͜ʖ ͡°) mesh data
 #include "lenny.h"
 
+// GPU time driven render resolution controller
+#include "resolution_scaler.h"
+#include "program_cache.h"
+
 constexpr uint32_t NUMOBJECTS = 64;
+constexpr uint32_t MAXANIMATEDOBJECTS = 128*1024;
 constexpr auto TAU = glm::two_pi<float>();
 
 //-----------------------------------------------------------------------------
-// nxlink support
-//-----------------------------------------------------------------------------
-
-#ifndef ENABLE_NXLINK
-#define TRACE(fmt,...) ((void)0)
-#else
-#include <unistd.h>
-#define TRACE(fmt,...) printf("%s: " fmt "\n", __PRETTY_FUNCTION__, ## __VA_ARGS__)
-
-static int s_nxlinkSock = -1;
-
-static void initNxLink()
-{
-    if (R_FAILED(socketInitializeDefault()))
-        return;
-
-    s_nxlinkSock = nxlinkStdio();
-    if (s_nxlinkSock >= 0)
-        TRACE("printf output now goes to nxlink server");
-    else
-        socketExit();
-}
-
-static void deinitNxLink()
-{
-    if (s_nxlinkSock >= 0)
-    {
-        close(s_nxlinkSock);
-        socketExit();
-        s_nxlinkSock = -1;
-    }
-}
-
-extern "C" void userAppInit()
-{
-    initNxLink();
-}
-
-extern "C" void userAppExit()
-{
-    deinitNxLink();
-}
-
-#endif
-
-//-----------------------------------------------------------------------------
-// EGL initialization
+// Main program
 //-----------------------------------------------------------------------------
 
-static EGLDisplay s_display;
-static EGLContext s_context;
-static EGLSurface s_surface;
-
-static bool initEgl(NWindow* win)
-{
-    // Connect to the EGL default display
-    s_display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
-    if (!s_display)
-    {
-        TRACE("Could not connect to display! error: %d", eglGetError());
-        goto _fail0;
-    }
-
-    // Initialize the EGL display connection
-    eglInitialize(s_display, nullptr, nullptr);
+static const char* const vertexShaderSource = R"text(
+    #version 330 core
 
-    // Select OpenGL (Core) as the desired graphics API
-    if (eglBindAPI(EGL_OPENGL_API) == EGL_FALSE)
-    {
-        TRACE("Could not set API! error: %d", eglGetError());
-        goto _fail1;
-    }
+    layout (location = 0) in vec3 inPos;
+    layout (location = 1) in vec3 inNormal;
+    layout (location = 2) in mat4 inMdlMtx;
 
-    // Get an appropriate EGL framebuffer configuration
-    EGLConfig config;
-    EGLint numConfigs;
-    static const EGLint framebufferAttributeList[] =
-    {
-        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
-        EGL_RED_SIZE,     8,
-        EGL_GREEN_SIZE,   8,
-        EGL_BLUE_SIZE,    8,
-        EGL_ALPHA_SIZE,   8,
-        EGL_DEPTH_SIZE,   24,
-        EGL_STENCIL_SIZE, 8,
-        EGL_NONE
-    };
-    eglChooseConfig(s_display, framebufferAttributeList, &config, 1, &numConfigs);
-    if (numConfigs == 0)
-    {
-        TRACE("No config found! error: %d", eglGetError());
-        goto _fail1;
-    }
+    out vec4 vtxColor;
+    out vec4 vtxNormalQuat;
+    out vec3 vtxView;
 
-    // Create an EGL window surface
-    s_surface = eglCreateWindowSurface(s_display, config, win, nullptr);
-    if (!s_surface)
-    {
-        TRACE("Surface creation failed! error: %d", eglGetError());
-        goto _fail1;
-    }
+    uniform mat4 mdlvMtx;
+    uniform mat4 projMtx;
 
-    // Create an EGL rendering context
-    static const EGLint contextAttributeList[] =
-    {
-        EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
-        EGL_CONTEXT_MAJOR_VERSION_KHR, 4,
-        EGL_CONTEXT_MINOR_VERSION_KHR, 3,
-        EGL_NONE
-    };
-    s_context = eglCreateContext(s_display, config, EGL_NO_CONTEXT, contextAttributeList);
-    if (!s_context)
+    void main()
     {
-        TRACE("Context creation failed! error: %d", eglGetError());
-        goto _fail2;
-    }
-
-    // Connect the context to the surface
-    eglMakeCurrent(s_display, s_surface, s_surface, s_context);
-    return true;
-
-_fail2:
-    eglDestroySurface(s_display, s_surface);
-    s_surface = nullptr;
-_fail1:
-    eglTerminate(s_display);
-    s_display = nullptr;
-_fail0:
-    return false;
-}
+        // Calculate position
+        vec4 pos = mdlvMtx * inMdlMtx * vec4(inPos, 1.0);
+        vtxView = -pos.xyz;
+        gl_Position = projMtx * pos;
 
-static void deinitEgl()
-{
-    if (s_display)
-    {
-        eglMakeCurrent(s_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
-        if (s_context)
-        {
-            eglDestroyContext(s_display, s_context);
-            s_context = nullptr;
-        }
-        if (s_surface)
+        // Calculate normalquat
+        vec3 normal = normalize(mat3(mdlvMtx) * inNormal);
+        float z = (1.0 + normal.z) / 2.0;
+        vtxNormalQuat = vec4(1.0, 0.0, 0.0, 0.0);
+        if (z > 0.0)
         {
-            eglDestroySurface(s_display, s_surface);
-            s_surface = nullptr;
+            vtxNormalQuat.z = sqrt(z);
+            vtxNormalQuat.xy = normal.xy / (2.0 * vtxNormalQuat.z);
         }
-        eglTerminate(s_display);
-        s_display = nullptr;
-    }
-}
 
-//-----------------------------------------------------------------------------
-// Main program
-//-----------------------------------------------------------------------------
-
-static void setMesaConfig()
-{
-    // Uncomment below to disable error checking and save CPU time (useful for production):
-    //setenv("MESA_NO_ERROR", "1", 1);
-
-    // Uncomment below to enable Mesa logging:
-    //setenv("EGL_LOG_LEVEL", "debug", 1);
-    //setenv("MESA_VERBOSE", "all", 1);
-    //setenv("NOUVEAU_MESA_DEBUG", "1", 1);
-
-    // Uncomment below to enable shader debugging in Nouveau:
-    //setenv("NV50_PROG_OPTIMIZE", "0", 1);
-    //setenv("NV50_PROG_DEBUG", "1", 1);
-    //setenv("NV50_PROG_CHIPSET", "0x120", 1);
-}
+        // Calculate color
+        vtxColor = vec4(1.0);
+    }
+)text";
 
-static const char* const vertexShaderSource = R"text(
+// Vertex shader used in the GPU animated mode: the model transform of each instance is
+// computed on the fly from a few compact parameters, instead of being fetched as a matrix
+static const char* const animatedVertexShaderSource = R"text(
     #version 330 core
 
     layout (location = 0) in vec3 inPos;
     layout (location = 1) in vec3 inNormal;
-    layout (location = 2) in mat4 inMdlMtx;
+    layout (location = 2) in vec3 inInstPos;
+    layout (location = 3) in vec2 inInstParams; // x: rotation speed (turns per second), y: phase (turns)
 
     out vec4 vtxColor;
     out vec4 vtxNormalQuat;
@@ -208,16 +82,22 @@ static const char* const vertexShaderSource = R"text(
 
     uniform mat4 mdlvMtx;
     uniform mat4 projMtx;
+    uniform float time;
 
     void main()
     {
+        // Calculate the rotation of the instance around the Y axis
+        float angle = (inInstParams.y + time*inInstParams.x) * 6.28318530718;
+        float c = cos(angle), s = sin(angle);
+        mat3 rotMtx = mat3(c, 0.0, -s, 0.0, 1.0, 0.0, s, 0.0, c);
+
         // Calculate position
-        vec4 pos = mdlvMtx * inMdlMtx * vec4(inPos, 1.0);
+        vec4 pos = mdlvMtx * vec4(rotMtx * (2.0 * inPos) + inInstPos, 1.0);
         vtxView = -pos.xyz;
         gl_Position = projMtx * pos;
 
         // Calculate normalquat
-        vec3 normal = normalize(mat3(mdlvMtx) * inNormal);
+        vec3 normal = normalize(mat3(mdlvMtx) * (rotMtx * inNormal));
         float z = (1.0 + normal.z) / 2.0;
         vtxNormalQuat = vec4(1.0, 0.0, 0.0, 0.0);
         if (z > 0.0)
@@ -306,58 +186,97 @@ struct Instance
     glm::mat4 mdlMtx;
 };
 
-static GLuint s_program;
-static GLuint s_vao, s_vbo, s_instance_vbo;
+// Compact per-instance data used in the GPU animated mode (16 bytes instead of 64)
+struct AnimatedInstance
+{
+    float pos[3];
+    __fp16 params[2]; // rotation speed, phase
+};
+
+static GLuint s_program, s_animProgram;
+static GLuint s_vao, s_vbo, s_ibo, s_instance_vbo;
+static GLuint s_animVao, s_animInstance_vbo;
+
+static GLint loc_mdlvMtx;
+static GLint loc_anim_mdlvMtx, loc_anim_time;
 
-static GLint loc_mdlvMtx, loc_projMtx;
-static GLint loc_lightPos, loc_ambient, loc_diffuse, loc_specular;
+static bool s_animated = false;
+static uint32_t s_numAnimated = 4096;
 
 static u64 s_startTicks;
 
-static void sceneInit()
+static GLuint createAndLinkProgram(const char* vshSource, const char* fshSource)
 {
-    GLint vsh = createAndCompileShader(GL_VERTEX_SHADER, vertexShaderSource);
-    GLint fsh = createAndCompileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
-
-    s_program = glCreateProgram();
-    glAttachShader(s_program, vsh);
-    glAttachShader(s_program, fsh);
-    glLinkProgram(s_program);
+    // Reuse the program binary from a previous run if possible, which skips compiling the shaders
+    const char* const sources[] = { vshSource, fshSource };
+    u64 hash = programCacheHash(sources, 2);
+    GLuint program = programCacheLoad(hash);
+    if (program)
+        return program;
+
+    GLint vsh = createAndCompileShader(GL_VERTEX_SHADER, vshSource);
+    GLint fsh = createAndCompileShader(GL_FRAGMENT_SHADER, fshSource);
+
+    program = glCreateProgram();
+    glAttachShader(program, vsh);
+    glAttachShader(program, fsh);
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(program);
 
     GLint success;
-    glGetProgramiv(s_program, GL_LINK_STATUS, &success);
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
     if (success == GL_FALSE)
     {
         char buf[512];
-        glGetProgramInfoLog(s_program, sizeof(buf), nullptr, buf);
+        glGetProgramInfoLog(program, sizeof(buf), nullptr, buf);
         TRACE("Link error: %s", buf);
     }
     glDeleteShader(vsh);
     glDeleteShader(fsh);
 
+    programCacheStore(hash, program);
+    return program;
+}
+
+static void setupVertexAttribs()
+{
+    glBindBuffer(GL_ARRAY_BUFFER, s_vbo);
+
+    // The mesh is packed: half-float positions and 2_10_10_10 signed normalized normals
+    glVertexAttribPointer(0, 4, GL_HALF_FLOAT, GL_FALSE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, x));
+    glEnableVertexAttribArray(0);
+
+    glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, normal));
+    glEnableVertexAttribArray(1);
+
+    // The index buffer binding is part of the VAO state
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, s_ibo);
+}
+
+static void sceneInit()
+{
+    programCacheInit("sdmc:/switch/.shadercache/dynamic_resolution");
+    s_program = createAndLinkProgram(vertexShaderSource, fragmentShaderSource);
+    s_animProgram = createAndLinkProgram(animatedVertexShaderSource, fragmentShaderSource);
+
     loc_mdlvMtx = glGetUniformLocation(s_program, "mdlvMtx");
-    loc_projMtx = glGetUniformLocation(s_program, "projMtx");
-    loc_lightPos = glGetUniformLocation(s_program, "lightPos");
-    loc_ambient = glGetUniformLocation(s_program, "ambient");
-    loc_diffuse = glGetUniformLocation(s_program, "diffuse");
-    loc_specular = glGetUniformLocation(s_program, "specular");
+    loc_anim_mdlvMtx = glGetUniformLocation(s_animProgram, "mdlvMtx");
+    loc_anim_time = glGetUniformLocation(s_animProgram, "time");
 
     glEnable(GL_DEPTH_TEST);
     glDepthFunc(GL_LESS);
 
     glGenVertexArrays(1, &s_vao);
     glGenBuffers(1, &s_vbo);
+    glGenBuffers(1, &s_ibo);
     // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
     glBindVertexArray(s_vao);
 
     glBindBuffer(GL_ARRAY_BUFFER, s_vbo);
     glBufferData(GL_ARRAY_BUFFER, sizeof(lennyVertices), lennyVertices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, x));
-    glEnableVertexAttribArray(0);
-
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, nx));
-    glEnableVertexAttribArray(1);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, s_ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(lennyIndices), lennyIndices, GL_STATIC_DRAW);
+    setupVertexAttribs();
 
     glGenBuffers(1, &s_instance_vbo);
     glBindBuffer(GL_ARRAY_BUFFER, s_instance_vbo);
@@ -397,14 +316,53 @@ static void sceneInit()
     // VAOs requires a call to glBindVertexArray anyways so we generally don't unbind VAOs (nor VBOs) when it's not directly necessary.
     glBindVertexArray(0);
 
-    // Uniforms
-    glUseProgram(s_program);
+    // Set up the VAO used by the GPU animated mode, sharing the mesh buffers
+    glGenVertexArrays(1, &s_animVao);
+    glGenBuffers(1, &s_animInstance_vbo);
+    glBindVertexArray(s_animVao);
+    setupVertexAttribs();
+
+    // Generate the compact per-instance data: the instances are laid out in a sunflower
+    // spiral, so that drawing any number of them (from the start) always covers a disc
+    AnimatedInstance* animInstances = new AnimatedInstance[MAXANIMATEDOBJECTS];
+    for (size_t i = 0; i < MAXANIMATEDOBJECTS; i ++)
+    {
+        float r = 0.8f * sqrtf(float(i));
+        float theta = float(i) * 2.39996323f; // golden angle
+        animInstances[i].pos[0] = r * cosf(theta);
+        animInstances[i].pos[1] = -1.0f + 0.5f*sinf(r * 0.5f);
+        animInstances[i].pos[2] = -4.0f + r * sinf(theta);
+        animInstances[i].params[0] = 0.1f + 0.4f*fmodf(float(i) * 0.618034f, 1.0f);
+        animInstances[i].params[1] = fmodf(float(i) * 0.381966f, 1.0f);
+    }
+
+    // Upload the compact instance data
+    glBindBuffer(GL_ARRAY_BUFFER, s_animInstance_vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(AnimatedInstance)*MAXANIMATEDOBJECTS, animInstances, GL_STATIC_DRAW);
+    delete[] animInstances;
+
+    // Set up per-instance attributes
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(AnimatedInstance), (void*)offsetof(AnimatedInstance, pos));
+    glVertexAttribPointer(3, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(AnimatedInstance), (void*)offsetof(AnimatedInstance, params));
+    glVertexAttribDivisor(2, 1);
+    glVertexAttribDivisor(3, 1);
+    glEnableVertexAttribArray(2);
+    glEnableVertexAttribArray(3);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    // Uniforms (shared by both programs)
     auto projMtx = glm::perspective(40.0f*TAU/360.0f, 16.0f/9.0f, 0.01f, 1000.0f);
-    glUniformMatrix4fv(loc_projMtx, 1, GL_FALSE, glm::value_ptr(projMtx));
-    glUniform4f(loc_lightPos, 0.0f, 0.0f, -0.5f, 1.0f);
-    glUniform3f(loc_ambient, 0.1f, 0.1f, 0.1f);
-    glUniform3f(loc_diffuse, 0.4f, 0.4f, 0.4f);
-    glUniform4f(loc_specular, 0.5f, 0.5f, 0.5f, 20.0f);
+    for (GLuint program : { s_animProgram, s_program })
+    {
+        glUseProgram(program);
+        glUniformMatrix4fv(glGetUniformLocation(program, "projMtx"), 1, GL_FALSE, glm::value_ptr(projMtx));
+        glUniform4f(glGetUniformLocation(program, "lightPos"), 0.0f, 0.0f, -0.5f, 1.0f);
+        glUniform3f(glGetUniformLocation(program, "ambient"), 0.1f, 0.1f, 0.1f);
+        glUniform3f(glGetUniformLocation(program, "diffuse"), 0.4f, 0.4f, 0.4f);
+        glUniform4f(glGetUniformLocation(program, "specular"), 0.5f, 0.5f, 0.5f, 20.0f);
+    }
     s_startTicks = armGetSystemTick();
 }
 
@@ -447,45 +405,47 @@ static void sceneUpdate(u32 kHeld)
     mdlvMtx = glm::rotate(mdlvMtx, s_cameraAngle * TAU, glm::vec3{0.0f, 1.0f, 0.0f});
     mdlvMtx = glm::translate(mdlvMtx, -s_cameraPos);
 
-    glUniformMatrix4fv(loc_mdlvMtx, 1, GL_FALSE, glm::value_ptr(mdlvMtx));
+    if (s_animated)
+    {
+        // All the animation happens in the vertex shader, only the time needs updating
+        glUseProgram(s_animProgram);
+        glUniformMatrix4fv(loc_anim_mdlvMtx, 1, GL_FALSE, glm::value_ptr(mdlvMtx));
+        glUniform1f(loc_anim_time, curTime);
+    }
+    else
+    {
+        glUseProgram(s_program);
+        glUniformMatrix4fv(loc_mdlvMtx, 1, GL_FALSE, glm::value_ptr(mdlvMtx));
+    }
 }
 
+static ResolutionScaler s_scaler;
+
 static void configureResolution(NWindow* win, bool halved)
 {
-    int width, height;
-
-    // Calculate the target resolution depending on the operation mode:
-    // - In handheld mode, we render at 720p (which is the native screen resolution).
-    // - In docked mode, we render at full 1080p (which is outputted to a compatible HDTV screen).
+    // Calculate the full resolution depending on the operation mode:
+    // - In handheld mode, we render at most at 720p (which is the native screen resolution).
+    // - In docked mode, we render at most at 1080p (which is outputted to a compatible HDTV screen).
+    // The framebuffer itself is always 1080p; other areas remain unused when rendering at a lower resolution.
     switch (appletGetOperationMode())
     {
         default:
         case AppletOperationMode_Handheld:
-            width = 1280;
-            height = 720;
+            s_scaler.setFullSize(1280, 720, 1080);
             break;
         case AppletOperationMode_Docked:
-            width = 1920;
-            height = 1080;
+            s_scaler.setFullSize(1920, 1080, 1080);
             break;
     }
 
     // As an additional demonstration, we also demonstrate what happens
     // when the rendering resolution doesn't match the native display resolution
-    // by allowing the user to hold A to halve the rendering resolution.
-    if (halved)
-    {
-        width /= 2;
-        height /= 2;
-    }
+    // by allowing the user to hold A to force half the rendering resolution.
+    // Otherwise the scaler picks the resolution according to the measured GPU time.
+    s_scaler.forceScale(halved ? 0.5f : -1.0f);
 
     // Apply the resolution, and configure the correct GL viewport.
-    // We want to render to the top left corner of the framebuffer (other areas will
-    // remain unused when rendering at a smaller resolution than the framebuffer).
-    // Note that glViewport expects the coordinates of the bottom-left corner of
-    // the viewport, so we have to calculate that too.
-    nwindowSetCrop(win, 0, 0, width, height);
-    glViewport(0, 1080-height, width, height);
+    s_scaler.beginFrame(win);
 }
 
 static void sceneRender()
@@ -494,67 +454,90 @@ static void sceneRender()
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
     // draw our ( ͡° ͜ʖ ͡°) world
-    glBindVertexArray(s_vao); // seeing as we only have a single VAO there's no need to bind it every time, but we'll do so to keep things a bit more organized
-    glDrawArraysInstanced(GL_TRIANGLES, 0, lennyVerticesCount, NUMOBJECTS);
+    if (s_animated)
+    {
+        glBindVertexArray(s_animVao);
+        glDrawElementsInstanced(GL_TRIANGLES, lennyIndicesCount, GL_UNSIGNED_SHORT, nullptr, s_numAnimated);
+    }
+    else
+    {
+        glBindVertexArray(s_vao);
+        glDrawElementsInstanced(GL_TRIANGLES, lennyIndicesCount, GL_UNSIGNED_SHORT, nullptr, NUMOBJECTS);
+    }
 }
 
 static void sceneExit()
 {
+    glDeleteBuffers(1, &s_animInstance_vbo);
     glDeleteBuffers(1, &s_instance_vbo);
+    glDeleteBuffers(1, &s_ibo);
     glDeleteBuffers(1, &s_vbo);
+    glDeleteVertexArrays(1, &s_animVao);
     glDeleteVertexArrays(1, &s_vao);
+    glDeleteProgram(s_animProgram);
     glDeleteProgram(s_program);
 }
 
-int main(int argc, char* argv[])
+static void appInit()
 {
-    // Set mesa configuration (useful for debugging)
-    setMesaConfig();
-
-    // Retrieve the default window and configure its dimensions (1080p)
-    NWindow* win = nwindowGetDefault();
-    nwindowSetDimensions(win, 1920, 1080);
-
-    // Initialize EGL on the default window
-    if (!initEgl(win))
-        return EXIT_FAILURE;
-
-    // Load OpenGL routines using glad
-    gladLoadGL();
-
-    // Initialize our scene
     sceneInit();
 
-    // Main graphics loop
-    while (appletMainLoop())
-    {
-        // Get and process input
-        hidScanInput();
-        u32 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
-        u32 kHeld = hidKeysHeld(CONTROLLER_P1_AUTO);
-        if (kDown & KEY_PLUS)
-            break;
-
-        bool shouldHalveResolution = !!(kHeld & KEY_A);
-
-        // Configure the resolution used to render the scene, which
-        // will be different in handheld mode/docked mode.
-        // As an additional demonstration, when holding A we render the scene
-        // at half the original resolution.
-        configureResolution(win, shouldHalveResolution);
+    // Initialize the resolution scaler, aiming to stay within a 60 fps frame
+    s_scaler.init(ResolutionScaler::Budget60Hz, 0.5f, 1.0f);
+}
 
-        // Update our scene
-        sceneUpdate(kHeld);
+static void appExit()
+{
+    s_scaler.exit();
+    sceneExit();
+}
 
-        // Render stuff!
-        sceneRender();
-        eglSwapBuffers(s_display, s_surface);
-    }
+static void appUpdate(u32 kDown, u32 kHeld)
+{
+    bool shouldHalveResolution = !!(kHeld & KEY_A);
+
+    // Press B to toggle between static per-instance matrices and GPU animated instances,
+    // and ZL/ZR to change the number of animated instances
+    if (kDown & KEY_B)
+        s_animated = !s_animated;
+    if ((kDown & KEY_ZL) && s_numAnimated > NUMOBJECTS)
+        s_numAnimated /= 2;
+    if ((kDown & KEY_ZR) && s_numAnimated < MAXANIMATEDOBJECTS)
+        s_numAnimated *= 2;
+    if (kDown & (KEY_B|KEY_ZL|KEY_ZR))
+        TRACE("%s, %u instances", s_animated ? "GPU animated" : "static matrices", s_animated ? s_numAnimated : NUMOBJECTS);
+
+    // Configure the resolution used to render the scene, which
+    // will be different in handheld mode/docked mode, and which
+    // is scaled down automatically whenever the GPU can't keep up.
+    // As an additional demonstration, when holding A we render the scene
+    // at half the original resolution.
+    configureResolution(nwindowGetDefault(), shouldHalveResolution);
+
+    // Update our scene
+    sceneUpdate(kHeld);
+}
 
-    // Deinitialize our scene
-    sceneExit();
+static void appRender()
+{
+    sceneRender();
+    s_scaler.endFrame();
+}
 
-    // Deinitialize EGL
-    deinitEgl();
-    return EXIT_SUCCESS;
+int main(int argc, char* argv[])
+{
+    // Configure the dimensions of the default window (1080p)
+    nwindowSetDimensions(nwindowGetDefault(), 1920, 1080);
+
+    // The harness owns EGL and the main loop, and reports frame timings
+    HarnessCallbacks cb = {};
+    cb.init = appInit;
+    cb.exit = appExit;
+    cb.update = appUpdate;
+    cb.render = appRender;
+
+    // Launch with --bench (e.g. through nxlink) to sweep the Mesa settings instead
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0)
+        return harnessRunBenchmark(cb, "sdmc:/switch/dynamic_resolution_mesa_sweep.csv");
+    return harnessRun(cb);
 }
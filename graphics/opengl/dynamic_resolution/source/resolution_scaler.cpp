@@ -0,0 +1,137 @@
+#include <math.h>
+#include "resolution_scaler.h"
+
+bool ResolutionScaler::init(u64 budgetNs, float minScale, float maxScale)
+{
+    glGenQueries(NumQueries, m_queries);
+    for (unsigned i = 0; i < NumQueries; i ++)
+        m_pending[i] = false;
+
+    m_curQuery = 0;
+    m_budgetNs = budgetNs;
+    m_minScale = minScale;
+    m_maxScale = maxScale;
+    m_scale = maxScale;
+    m_forcedScale = -1.0f;
+    m_avgNs = 0.0f;
+    m_overFrames = 0;
+    m_underFrames = 0;
+    m_fullWidth = m_fullHeight = m_fbHeight = 0;
+    return glGetError() == GL_NO_ERROR;
+}
+
+void ResolutionScaler::exit()
+{
+    glDeleteQueries(NumQueries, m_queries);
+}
+
+void ResolutionScaler::setFullSize(int width, int height, int framebufferHeight)
+{
+    m_fullWidth = width;
+    m_fullHeight = height;
+    m_fbHeight = framebufferHeight;
+}
+
+void ResolutionScaler::forceScale(float scale)
+{
+    m_forcedScale = scale;
+}
+
+int ResolutionScaler::getRenderWidth() const
+{
+    int w = int(m_fullWidth*getScale() + 0.5f) &~ (SizeGranularity - 1);
+    return w < SizeGranularity ? SizeGranularity : (w > m_fullWidth ? m_fullWidth : w);
+}
+
+int ResolutionScaler::getRenderHeight() const
+{
+    int h = int(m_fullHeight*getScale() + 0.5f) &~ (SizeGranularity - 1);
+    return h < SizeGranularity ? SizeGranularity : (h > m_fullHeight ? m_fullHeight : h);
+}
+
+void ResolutionScaler::setScale(float scale)
+{
+    if (scale < m_minScale) scale = m_minScale;
+    if (scale > m_maxScale) scale = m_maxScale;
+
+    // GPU time roughly follows the number of pixels, so predict the new frame time in
+    // order to avoid reacting again to measurements taken at the old resolution
+    m_avgNs *= (scale*scale) / (m_scale*m_scale);
+    m_scale = scale;
+}
+
+void ResolutionScaler::update(u64 gpuNs)
+{
+    m_avgNs = m_avgNs != 0.0f ? m_avgNs + (float(gpuNs) - m_avgNs)*Smoothing : float(gpuNs);
+
+    if (m_avgNs > m_budgetNs*OverBudget)
+    {
+        m_underFrames = 0;
+        if (++m_overFrames >= DropDelay)
+        {
+            // Jump straight to the scale expected to bring the load down to the target
+            m_overFrames = 0;
+            setScale(m_scale * sqrtf(m_budgetNs*TargetLoad / m_avgNs));
+        }
+    }
+    else if (m_avgNs < m_budgetNs*UnderBudget)
+    {
+        m_overFrames = 0;
+        if (++m_underFrames >= RaiseDelay)
+        {
+            m_underFrames = 0;
+            setScale(m_scale + RaiseStep);
+        }
+    }
+    else
+    {
+        m_overFrames = 0;
+        m_underFrames = 0;
+    }
+}
+
+void ResolutionScaler::beginFrame(NWindow* win)
+{
+    // Consume the timings of earlier frames whose results have landed (oldest first)
+    for (unsigned i = 0; i < NumQueries; i ++)
+    {
+        unsigned id = (m_curQuery + i) % NumQueries;
+        if (!m_pending[id])
+            continue;
+
+        GLint available = 0;
+        glGetQueryObjectiv(m_queries[id], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+            break;
+
+        GLuint64 ns = 0;
+        glGetQueryObjectui64v(m_queries[id], GL_QUERY_RESULT, &ns);
+        m_pending[id] = false;
+
+        // Measurements taken while the scale was forced do not reflect the automatic scale
+        if (m_forcedScale < 0.0f && ns)
+            update(ns);
+    }
+
+    // Apply the resolution, and configure the correct GL viewport.
+    // Note that glViewport expects the coordinates of the bottom-left corner of
+    // the viewport, so we have to calculate that too.
+    int width = getRenderWidth(), height = getRenderHeight();
+    nwindowSetCrop(win, 0, 0, width, height);
+    glViewport(0, m_fbHeight-height, width, height);
+
+    // If the query slot is still in flight (the GPU is more than NumQueries frames behind),
+    // skip measuring this frame rather than stalling
+    if (!m_pending[m_curQuery])
+        glBeginQuery(GL_TIME_ELAPSED, m_queries[m_curQuery]);
+}
+
+void ResolutionScaler::endFrame()
+{
+    if (m_pending[m_curQuery])
+        return;
+
+    glEndQuery(GL_TIME_ELAPSED);
+    m_pending[m_curQuery] = true;
+    m_curQuery = (m_curQuery + 1) % NumQueries;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <switch.h>
+#include <glad/glad.h>
+
+// Closed-loop render resolution controller.
+// The GPU time of each frame is measured with timer queries, and the render size is
+// stepped between a minimum and a maximum fraction of the full output resolution in
+// order to keep that time within a budget. The rendered area is presented upscaled
+// to the whole screen by cropping the window (nwindowSetCrop).
+class ResolutionScaler
+{
+public:
+    static constexpr u64 Budget60Hz = 16666667;
+    static constexpr unsigned NumQueries = 4; // results are read back a few frames late, without stalling
+
+    // Hysteresis: drop resolution quickly when going over budget, but only raise it after
+    // the frame time has been comfortably below the budget for a while
+    static constexpr float OverBudget = 0.95f;
+    static constexpr float UnderBudget = 0.80f;
+    static constexpr float TargetLoad = 0.85f;
+    static constexpr unsigned DropDelay = 3;
+    static constexpr unsigned RaiseDelay = 30;
+    static constexpr float RaiseStep = 0.025f;
+    static constexpr float Smoothing = 0.2f;
+
+    // Render sizes are kept a multiple of this
+    static constexpr int SizeGranularity = 8;
+
+    bool init(u64 budgetNs = Budget60Hz, float minScale = 0.5f, float maxScale = 1.0f);
+    void exit();
+
+    // Sets the full output resolution (which corresponds to a scale of 1.0), and the
+    // height of the framebuffer (needed for placing the viewport at the top left corner)
+    void setFullSize(int width, int height, int framebufferHeight);
+
+    // Collects the available GPU timings, updates the scale and applies the resulting
+    // render size through the window crop and the GL viewport. Call before rendering.
+    void beginFrame(NWindow* win);
+
+    // Marks the end of the GPU work measured for this frame. Call before swapping buffers.
+    void endFrame();
+
+    // Forces a fixed scale (disabling the automatic control), or returns to automatic control with a negative value
+    void forceScale(float scale);
+
+    float getScale() const { return m_forcedScale >= 0.0f ? m_forcedScale : m_scale; }
+    float getAverageNs() const { return m_avgNs; }
+    int getRenderWidth() const;
+    int getRenderHeight() const;
+
+private:
+    GLuint m_queries[NumQueries];
+    bool m_pending[NumQueries];
+    unsigned m_curQuery;
+    u64 m_budgetNs;
+    float m_minScale, m_maxScale;
+    float m_scale, m_forcedScale;
+    float m_avgNs;
+    unsigned m_overFrames, m_underFrames;
+    int m_fullWidth, m_fullHeight, m_fbHeight;
+
+    void update(u64 gpuNs);
+    void setScale(float scale);
+};
@@ -41,6 +41,16 @@
  * September 9th, 2018
  */
 
+/*
+ * Press A to switch between the original rendering path (one draw call per
+ * triangle strip, matrices calculated on the CPU for every gear) and a single
+ * draw call path: the strips of all gears are merged into one indexed mesh
+ * separated by primitive restart indices, and each gear is placed and rotated
+ * by the vertex shader using per-gear data kept in a uniform buffer. The
+ * latter requires an OpenGL ES 3.0 context, which is also compatible with the
+ * original ES 2.0 shaders.
+ */
+
 #define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
@@ -49,7 +59,7 @@
 #include <switch.h>
 
 #include <EGL/egl.h>    // EGL library
-#include <GLES2/gl2.h>  // OpenGL ES 2.0 library
+#include <GLES3/gl3.h>  // OpenGL ES 3.0 library (a superset of OpenGL ES 2.0)
 
 //-----------------------------------------------------------------------------
 // nxlink support
@@ -58,41 +68,18 @@
 #ifndef ENABLE_NXLINK
 #define TRACE(fmt,...) ((void)0)
 #else
-#include <unistd.h>
+#include "nxlink_log.h"
 #define TRACE(fmt,...) printf("%s: " fmt "\n", __PRETTY_FUNCTION__, ## __VA_ARGS__)
 
-static int s_nxlinkSock = -1;
-
-static void initNxLink()
-{
-	if (R_FAILED(socketInitializeDefault()))
-		return;
-
-	s_nxlinkSock = nxlinkStdio();
-	if (s_nxlinkSock >= 0)
-		TRACE("printf output now goes to nxlink server");
-	else
-		socketExit();
-}
-
-static void deinitNxLink()
-{
-	if (s_nxlinkSock >= 0)
-	{
-		close(s_nxlinkSock);
-		socketExit();
-		s_nxlinkSock = -1;
-	}
-}
-
 void userAppInit()
 {
-	initNxLink();
+	if (nxlinkLogInit())
+		TRACE("printf output now goes to nxlink server");
 }
 
 void userAppExit()
 {
-	deinitNxLink();
+	nxlinkLogExit();
 }
 
 #endif
@@ -149,7 +136,7 @@ static bool initEgl(NWindow* win)
     // Create an EGL rendering context
     static const EGLint contextAttributeList[] =
     {
-        EGL_CONTEXT_CLIENT_VERSION, 2, // request OpenGL ES 2.x
+        EGL_CONTEXT_CLIENT_VERSION, 3, // request OpenGL ES 3.x, needed by the single draw path
         EGL_NONE
     };
     s_context = eglCreateContext(s_display, config, EGL_NO_CONTEXT, contextAttributeList);
@@ -261,6 +248,36 @@ static GLuint ModelViewProjectionMatrix_location,
 static GLfloat ProjectionMatrix[16];
 /** The direction of the directional light for the scene */
 static const GLfloat LightSourcePosition[4] = { 5.0, 5.0, 10.0, 1.0};
+/** The colors of the gears */
+static const GLfloat red[4] = { 0.8, 0.1, 0.0, 1.0 };
+static const GLfloat green[4] = { 0.0, 0.8, 0.2, 1.0 };
+static const GLfloat blue[4] = { 0.2, 0.2, 1.0, 1.0 };
+
+/** Whether the single draw call path is in use */
+static bool single_draw = false;
+/** The shader program used by the original path */
+static GLuint gears_program;
+
+/**
+ * Per-gear data used by the single draw path (std140 layout).
+ */
+struct gear_params {
+   /** x, y: position of the gear, z: rotation speed factor, w: rotation offset (degrees) */
+   GLfloat placement[4];
+   /** The color of the gear */
+   GLfloat color[4];
+};
+
+/** The state used by the single draw path */
+static struct {
+   GLuint program;
+   GLuint vao;
+   GLuint vbo, id_vbo, ibo, ubo;
+   GLsizei nindices;
+   GLint ViewMatrix_location,
+         ProjectionMatrix_location,
+         Angle_location;
+} merged;
 
 /**
  * Fills a gear vertex.
@@ -675,9 +692,6 @@ draw_gear(struct gear *gear, GLfloat *transform,
 static void
 gears_draw(void)
 {
-   const static GLfloat red[4] = { 0.8, 0.1, 0.0, 1.0 };
-   const static GLfloat green[4] = { 0.0, 0.8, 0.2, 1.0 };
-   const static GLfloat blue[4] = { 0.2, 0.2, 1.0, 1.0 };
    GLfloat transform[16];
    identity(transform);
 
@@ -690,7 +704,22 @@ gears_draw(void)
    rotate(transform, 2 * M_PI * view_rot[1] / 360.0, 0, 1, 0);
    rotate(transform, 2 * M_PI * view_rot[2] / 360.0, 0, 0, 1);
 
+   if (single_draw) {
+      /* The gears are placed by the vertex shader, only the view and the angle are needed */
+      glUseProgram(merged.program);
+      glUniformMatrix4fv(merged.ViewMatrix_location, 1, GL_FALSE, transform);
+      glUniformMatrix4fv(merged.ProjectionMatrix_location, 1, GL_FALSE, ProjectionMatrix);
+      glUniform1f(merged.Angle_location, angle);
+
+      /* Draw all the strips of all the gears at once */
+      glBindVertexArray(merged.vao);
+      glDrawElements(GL_TRIANGLE_STRIP, merged.nindices, GL_UNSIGNED_SHORT, NULL);
+      glBindVertexArray(0);
+      return;
+   }
+
    /* Draw the gears */
+   glUseProgram(gears_program);
    draw_gear(gear1, transform, -3.0, -2.0, angle, red);
    draw_gear(gear2, transform, 3.1, -2.0, -2 * angle - 9.0, green);
    draw_gear(gear3, transform, -3.1, 4.2, -2 * angle - 25.0, blue);
@@ -787,6 +816,174 @@ static const char fragment_shader[] =
 "    gl_FragColor = Color;\n"
 "}";
 
+static const char merged_vertex_shader[] =
+"#version 300 es\n"
+"layout (location = 0) in vec3 position;\n"
+"layout (location = 1) in vec3 normal;\n"
+"layout (location = 2) in uint gear_id;\n"
+"\n"
+"struct Gear {\n"
+"    vec4 placement; // xy: position, z: rotation speed factor, w: rotation offset\n"
+"    vec4 color;\n"
+"};\n"
+"\n"
+"layout (std140) uniform Gears {\n"
+"    Gear gears[3];\n"
+"};\n"
+"\n"
+"uniform mat4 ViewMatrix;\n"
+"uniform mat4 ProjectionMatrix;\n"
+"uniform float Angle;\n"
+"uniform vec4 LightSourcePosition;\n"
+"\n"
+"out vec4 Color;\n"
+"\n"
+"void main(void)\n"
+"{\n"
+"    Gear g = gears[gear_id];\n"
+"\n"
+"    // Rotate the gear around the Z axis, then move it into place\n"
+"    float a = radians(Angle * g.placement.z + g.placement.w);\n"
+"    mat2 rot = mat2(cos(a), sin(a), -sin(a), cos(a));\n"
+"    vec3 P = vec3(rot * position.xy + g.placement.xy, position.z);\n"
+"\n"
+"    // The view matrix is a rigid transformation, so it can transform normals as well\n"
+"    vec3 N = normalize(mat3(ViewMatrix) * vec3(rot * normal.xy, normal.z));\n"
+"    vec3 L = normalize(LightSourcePosition.xyz);\n"
+"    float diffuse = max(dot(N, L), 0.0);\n"
+"    Color = diffuse * g.color;\n"
+"\n"
+"    gl_Position = ProjectionMatrix * (ViewMatrix * vec4(P, 1.0));\n"
+"}";
+
+static const char merged_fragment_shader[] =
+"#version 300 es\n"
+"precision mediump float;\n"
+"in vec4 Color;\n"
+"out vec4 FragColor;\n"
+"\n"
+"void main(void)\n"
+"{\n"
+"    FragColor = Color;\n"
+"}";
+
+/**
+ * Creates the merged mesh and the shaders used by the single draw path.
+ */
+static void
+merged_init(void)
+{
+   struct gear *gears[3] = { gear1, gear2, gear3 };
+   static const struct gear_params params[3] = {
+      { { -3.0, -2.0,  1.0,   0.0 }, { 0.8, 0.1, 0.0, 1.0 } },
+      { {  3.1, -2.0, -2.0,  -9.0 }, { 0.0, 0.8, 0.2, 1.0 } },
+      { { -3.1,  4.2, -2.0, -25.0 }, { 0.2, 0.2, 1.0, 1.0 } },
+   };
+   GLuint v, f;
+   const char *p;
+   char msg[512];
+   int i, n, k;
+
+   /* Compile and link the shaders */
+   p = merged_vertex_shader;
+   v = glCreateShader(GL_VERTEX_SHADER);
+   glShaderSource(v, 1, &p, NULL);
+   glCompileShader(v);
+   glGetShaderInfoLog(v, sizeof msg, NULL, msg);
+   printf("merged vertex shader info: %s\n", msg);
+
+   p = merged_fragment_shader;
+   f = glCreateShader(GL_FRAGMENT_SHADER);
+   glShaderSource(f, 1, &p, NULL);
+   glCompileShader(f);
+   glGetShaderInfoLog(f, sizeof msg, NULL, msg);
+   printf("merged fragment shader info: %s\n", msg);
+
+   merged.program = glCreateProgram();
+   glAttachShader(merged.program, v);
+   glAttachShader(merged.program, f);
+   glLinkProgram(merged.program);
+   glGetProgramInfoLog(merged.program, sizeof msg, NULL, msg);
+   printf("merged info: %s\n", msg);
+   glDeleteShader(v);
+   glDeleteShader(f);
+
+   glUseProgram(merged.program);
+   merged.ViewMatrix_location = glGetUniformLocation(merged.program, "ViewMatrix");
+   merged.ProjectionMatrix_location = glGetUniformLocation(merged.program, "ProjectionMatrix");
+   merged.Angle_location = glGetUniformLocation(merged.program, "Angle");
+   glUniform4fv(glGetUniformLocation(merged.program, "LightSourcePosition"), 1, LightSourcePosition);
+
+   /* Upload the per-gear data, which never changes */
+   glGenBuffers(1, &merged.ubo);
+   glBindBuffer(GL_UNIFORM_BUFFER, merged.ubo);
+   glBufferData(GL_UNIFORM_BUFFER, sizeof(params), params, GL_STATIC_DRAW);
+   glUniformBlockBinding(merged.program, glGetUniformBlockIndex(merged.program, "Gears"), 0);
+   glBindBufferBase(GL_UNIFORM_BUFFER, 0, merged.ubo);
+
+   /* Concatenate the vertices of all gears, along with the id of the gear each belongs to */
+   int nvertices = 0, nindices = 0;
+   for (i = 0; i < 3; i++) {
+      nvertices += gears[i]->nvertices;
+      for (n = 0; n < gears[i]->nstrips; n++)
+         nindices += gears[i]->strips[n].count + 1;
+   }
+
+   GearVertex *vertices = malloc(nvertices * sizeof(GearVertex));
+   GLubyte *ids = malloc(nvertices);
+   GLushort *indices = malloc(nindices * sizeof(GLushort));
+   GLushort *idx = indices;
+   int base = 0;
+   for (i = 0; i < 3; i++) {
+      memcpy(&vertices[base], gears[i]->vertices, gears[i]->nvertices * sizeof(GearVertex));
+      memset(&ids[base], i, gears[i]->nvertices);
+
+      /* Each strip is terminated by a restart index, so that they can all be drawn at once */
+      for (n = 0; n < gears[i]->nstrips; n++) {
+         for (k = 0; k < gears[i]->strips[n].count; k++)
+            *idx++ = base + gears[i]->strips[n].first + k;
+         *idx++ = 0xFFFF;
+      }
+      base += gears[i]->nvertices;
+   }
+   merged.nindices = nindices;
+
+   /* Set up the vertex array object */
+   glGenVertexArrays(1, &merged.vao);
+   glBindVertexArray(merged.vao);
+
+   glGenBuffers(1, &merged.vbo);
+   glBindBuffer(GL_ARRAY_BUFFER, merged.vbo);
+   glBufferData(GL_ARRAY_BUFFER, nvertices * sizeof(GearVertex), vertices, GL_STATIC_DRAW);
+   glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), NULL);
+   glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLfloat *) 0 + 3);
+   glEnableVertexAttribArray(0);
+   glEnableVertexAttribArray(1);
+
+   glGenBuffers(1, &merged.id_vbo);
+   glBindBuffer(GL_ARRAY_BUFFER, merged.id_vbo);
+   glBufferData(GL_ARRAY_BUFFER, nvertices, ids, GL_STATIC_DRAW);
+   glVertexAttribIPointer(2, 1, GL_UNSIGNED_BYTE, 0, NULL);
+   glEnableVertexAttribArray(2);
+
+   glGenBuffers(1, &merged.ibo);
+   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, merged.ibo);
+   glBufferData(GL_ELEMENT_ARRAY_BUFFER, nindices * sizeof(GLushort), indices, GL_STATIC_DRAW);
+
+   glBindVertexArray(0);
+   glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+   free(indices);
+   free(ids);
+   free(vertices);
+
+   /* Index 0xFFFF restarts the strip (the fixed index for GL_UNSIGNED_SHORT) */
+   glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+
+   printf("single draw path: %d vertices, %d indices (%d strips)\n", nvertices, nindices,
+         gear1->nstrips + gear2->nstrips + gear3->nstrips);
+}
+
 static void
 gears_init(void)
 {
@@ -826,6 +1023,7 @@ gears_init(void)
 
    /* Enable the shaders */
    glUseProgram(program);
+   gears_program = program;
 
    /* Get the locations of the uniforms so we can access them */
    ModelViewProjectionMatrix_location = glGetUniformLocation(program, "ModelViewProjectionMatrix");
@@ -840,6 +1038,9 @@ gears_init(void)
    gear1 = create_gear(1.0, 4.0, 1.0, 20, 0.7);
    gear2 = create_gear(0.5, 2.0, 2.0, 10, 0.7);
    gear3 = create_gear(1.3, 2.0, 0.5, 10, 0.7);
+
+   /* make the merged mesh for the single draw path */
+   merged_init();
 }
 
 int main(int argc, char* argv[])
@@ -864,6 +1065,13 @@ int main(int argc, char* argv[])
         if (kDown & KEY_PLUS)
             break;
 
+        // Toggle the single draw call path
+        if (kDown & KEY_A)
+        {
+            single_draw = !single_draw;
+            printf("%s\n", single_draw ? "single draw call path" : "one draw call per strip path");
+        }
+
         // Render stuff!
         gears_draw();
         eglSwapBuffers(s_display, s_surface);
@@ -2,16 +2,33 @@
 // Please note that this implementation is incomplete, and only normal/bold colors are implemented.
 // Reverse colors, faint colors, underline or strikethrough are not implemented.
 // Nevertheless, it should suffice for most purposes.
+//
+// Only the rows of the tilemap modified since the previous frame are uploaded, and frames in
+// which nothing changed are not redrawn nor swapped at all (unless disabled through
+// gpuConsoleSetSkipUnchangedFrames); the console then just waits for the next vsync.
+// The tilemap rows form a ring buffer, so that scrolling the whole console only needs to
+// update a single row and the base row passed to the vertex shader.
+//
+// stdout goes through the buffered writer of console_writer.h, which hands runs of plain
+// characters to drawRun: their tilemap entries are generated in one pass, with the colors
+// resolved once per run.
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <switch.h>
 
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
 #include <EGL/egl.h>    // EGL library
 #include <EGL/eglext.h> // EGL extensions
 #include <glad/glad.h>  // glad library (OpenGL loader)
 
+#include "gpu_console.h"
+#include "console_writer.h"
+
 #define TRACE(...) ((void)0)
 
 static const char* const vertexShaderSource = R"text(
@@ -30,6 +47,7 @@ layout (location = 0) out vec4 outColor;
 layout (location = 1) out vec3 outUV;
 
 uniform ivec2 dimensions;
+uniform int baseRow;
 uniform vec4 palettes[16] = vec4[](
 	vec4(0.0, 0.0, 0.0, 1.0),
 	vec4(0.5, 0.0, 0.0, 1.0),
@@ -71,6 +89,7 @@ void main()
 	// Position
 	float tileRow = floor(float(gl_InstanceID) / dimensions.x);
 	float tileCol = float(gl_InstanceID) - tileRow*dimensions.x;
+	tileRow = mod(tileRow - float(baseRow) + float(dimensions.y), float(dimensions.y));
 	vec2 basePos;
 	basePos.x = 2.0 * tileCol / dimensions.x - 1.0;
 	basePos.y = 2.0 * (1.0 - tileRow / dimensions.y) - 1.0;
@@ -123,12 +142,21 @@ struct GpuConsole : public ConsoleRenderer
 		s_display{}, s_context{}, s_surface{},
 		s_tilemapVsh{}, s_tilemapFsh{}, s_tilemapPipeline{},
 		s_tilemapVao{}, s_tilemapVbo{}, s_tilemap{},
-		s_tilesetTex{}
+		s_tilesetTex{},
+		s_baseRow{}, s_baseRowLoc{}, s_uploadedBaseRow{},
+		s_dirtyFirstRow{}, s_dirtyEndRow{}, s_skipUnchanged{true},
+		s_vsyncDisplay{}, s_vsyncEvent{}, s_hasVsyncEvent{}
 	{ }
 
+	void setSkipUnchangedFrames(bool enable)
+	{
+		s_skipUnchanged = enable;
+	}
+
 	bool init(PrintConsole* con);
 	void deinit(PrintConsole* con);
 	void drawChar(PrintConsole* con, int x, int y, int c);
+	void drawRun(PrintConsole* con, int x, int y, const char* str, int len);
 	void scrollWindow(PrintConsole* con);
 	void flushAndSwap(PrintConsole* con);
 
@@ -153,6 +181,11 @@ private:
 		_get(con)->drawChar(con, x, y, c);
 	}
 
+	static void _drawRun(PrintConsole* con, int x, int y, const char* str, int len)
+	{
+		_get(con)->drawRun(con, x, y, str, len);
+	}
+
 	static void _scrollWindow(PrintConsole* con)
 	{
 		_get(con)->scrollWindow(con);
@@ -176,6 +209,42 @@ private:
 	uint16_t* s_tilemap;
 
 	GLuint s_tilesetTex;
+
+	// Row of the tilemap holding the first console row, and the value last given to the shader
+	int s_baseRow;
+	GLint s_baseRowLoc;
+	int s_uploadedBaseRow;
+
+	static int resolvePalette(PrintConsole* con);
+
+	int tilemapRow(PrintConsole* con, int y) const
+	{
+		int row = y + s_baseRow;
+		return row < con->consoleHeight ? row : row - con->consoleHeight;
+	}
+
+	// Range of tilemap rows modified since the last upload
+	int s_dirtyFirstRow, s_dirtyEndRow;
+	bool s_skipUnchanged;
+
+	void markDirty(int firstRow, int endRow)
+	{
+		if (s_dirtyFirstRow == s_dirtyEndRow)
+		{
+			s_dirtyFirstRow = firstRow;
+			s_dirtyEndRow = endRow;
+			return;
+		}
+		if (firstRow < s_dirtyFirstRow)
+			s_dirtyFirstRow = firstRow;
+		if (endRow > s_dirtyEndRow)
+			s_dirtyEndRow = endRow;
+	}
+
+	// Used for pacing when a frame is skipped, as there is no eglSwapBuffers call to block on
+	ViDisplay s_vsyncDisplay;
+	Event s_vsyncEvent;
+	bool s_hasVsyncEvent;
 };
 
 constexpr uint16_t MakeTilemapEntry(unsigned tileId, bool hFlip, bool vFlip, unsigned palId)
@@ -225,6 +294,9 @@ bool GpuConsole::init(PrintConsole* con)
 	glProgramUniform2i(s_tilemapVsh, glGetUniformLocation(s_tilemapVsh, "dimensions"),
 		con->consoleWidth, con->consoleHeight
 	);
+	s_baseRowLoc = glGetUniformLocation(s_tilemapVsh, "baseRow");
+	s_baseRow = s_uploadedBaseRow = 0;
+	glProgramUniform1i(s_tilemapVsh, s_baseRowLoc, 0);
 
 	// Create a program pipeline and attach the programs to their respective stages
 	glGenProgramPipelines(1, &s_tilemapPipeline);
@@ -249,9 +321,19 @@ bool GpuConsole::init(PrintConsole* con)
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 	glBindVertexArray(0);
 
-	// Allocate the tilemap and clear it
+	// Allocate the tilemap and clear it, making sure the first frame gets uploaded and drawn
 	s_tilemap = new uint16_t[con->consoleWidth*con->consoleHeight];
 	memset(s_tilemap, 0, sizeof(uint16_t)*con->consoleWidth*con->consoleHeight);
+	s_dirtyFirstRow = 0;
+	s_dirtyEndRow = con->consoleHeight;
+
+	// Retrieve the vsync event of the default display
+	s_hasVsyncEvent = R_SUCCEEDED(viOpenDefaultDisplay(&s_vsyncDisplay));
+	if (s_hasVsyncEvent && R_FAILED(viGetDisplayVsyncEvent(&s_vsyncDisplay, &s_vsyncEvent)))
+	{
+		viCloseDisplay(&s_vsyncDisplay);
+		s_hasVsyncEvent = false;
+	}
 
 	// Unpack 1bpp tileset into a texture image OpenGL can load
 	uint8_t* tileset = new uint8_t[con->font.numChars*con->font.tileWidth*con->font.tileHeight];
@@ -298,11 +380,15 @@ bool GpuConsole::init(PrintConsole* con)
 	// Configure viewport
 	glViewport(0, 0, 1280, 720);
 
+	// Take over stdout, so that printing goes through drawRun a run of characters at a time
+	consoleWriterInit(con, _drawRun);
+
 	return true;
 }
 
 void GpuConsole::deinit(PrintConsole* con)
 {
+	consoleWriterExit();
 	glDeleteTextures(1, &s_tilesetTex);
 	glDeleteBuffers(1, &s_tilemapVbo);
 	glDeleteVertexArrays(1, &s_tilemapVao);
@@ -310,10 +396,15 @@ void GpuConsole::deinit(PrintConsole* con)
 	glDeleteProgram(s_tilemapFsh);
 	glDeleteProgram(s_tilemapVsh);
 	delete[] s_tilemap;
+	if (s_hasVsyncEvent)
+	{
+		viCloseDisplay(&s_vsyncDisplay);
+		s_hasVsyncEvent = false;
+	}
 	deinitEgl();
 }
 
-void GpuConsole::drawChar(PrintConsole* con, int x, int y, int c)
+int GpuConsole::resolvePalette(PrintConsole* con)
 {
 	int writingColor = con->fg;
 	int screenColor = con->bg;
@@ -331,28 +422,122 @@ void GpuConsole::drawChar(PrintConsole* con, int x, int y, int c)
 		screenColor = tmp;
 	}
 
-	s_tilemap[y*con->consoleWidth+x] = MakeTilemapEntry(c, false, false, writingColor);
+	return writingColor;
+}
+
+void GpuConsole::drawChar(PrintConsole* con, int x, int y, int c)
+{
+	uint16_t ent = MakeTilemapEntry(c, false, false, resolvePalette(con));
+	int row = tilemapRow(con, y);
+	uint16_t& tile = s_tilemap[row*con->consoleWidth+x];
+	if (tile != ent)
+	{
+		tile = ent;
+		markDirty(row, row+1);
+	}
+}
+
+void GpuConsole::drawRun(PrintConsole* con, int x, int y, const char* str, int len)
+{
+	// Same attributes for the whole run: the palette is resolved once
+	uint16_t base = MakeTilemapEntry(0, false, false, resolvePalette(con));
+	int row = tilemapRow(con, y);
+	uint16_t* tiles = &s_tilemap[row*con->consoleWidth+x];
+	uint8_t offset = con->font.asciiOffset;
+	uint16_t changed = 0;
+	int i = 0;
+
+#ifdef __ARM_NEON
+	// Widen 8 characters at a time into tile ids, and merge in the palette
+	uint16x8_t bases = vdupq_n_u16(base);
+	uint8x8_t offsets = vdup_n_u8(offset);
+	uint16x8_t changes = vdupq_n_u16(0);
+	for (; i + 8 <= len; i += 8)
+	{
+		uint16x8_t ent = vorrq_u16(vmovl_u8(vsub_u8(vld1_u8((const uint8_t*)&str[i]), offsets)), bases);
+		changes = vorrq_u16(changes, veorq_u16(ent, vld1q_u16(&tiles[i])));
+		vst1q_u16(&tiles[i], ent);
+	}
+	changed = vmaxvq_u16(changes);
+#endif
+
+	for (; i < len; i ++)
+	{
+		uint16_t ent = base | (((uint8_t)str[i] - offset) & 0x3FF);
+		changed |= ent ^ tiles[i];
+		tiles[i] = ent;
+	}
+
+	if (changed)
+		markDirty(row, row+1);
 }
 
 void GpuConsole::scrollWindow(PrintConsole* con)
 {
+	if (con->windowX == 0 && con->windowY == 0 &&
+		con->windowWidth == con->consoleWidth && con->windowHeight == con->consoleHeight)
+	{
+		// The window covers the whole console, so just rotate the ring of rows. The row that
+		// wraps around to the bottom takes over the contents of the previous bottom row.
+		int oldLastRow = tilemapRow(con, con->consoleHeight-1);
+		s_baseRow = tilemapRow(con, 1);
+		int lastRow = tilemapRow(con, con->consoleHeight-1);
+		memcpy(
+			&s_tilemap[lastRow*con->consoleWidth],
+			&s_tilemap[oldLastRow*con->consoleWidth],
+			sizeof(uint16_t)*con->consoleWidth);
+		markDirty(lastRow, lastRow+1);
+		return;
+	}
+
 	for (int y = 0; y < con->windowHeight-1; y ++)
+	{
+		int row = tilemapRow(con, con->windowY+y+0);
 		memcpy(
-			&s_tilemap[(con->windowY+y+0)*con->consoleWidth + con->windowX],
-			&s_tilemap[(con->windowY+y+1)*con->consoleWidth + con->windowX],
+			&s_tilemap[row*con->consoleWidth + con->windowX],
+			&s_tilemap[tilemapRow(con, con->windowY+y+1)*con->consoleWidth + con->windowX],
 			sizeof(uint16_t)*con->windowWidth);
+		markDirty(row, row+1);
+	}
 }
 
 void GpuConsole::flushAndSwap(PrintConsole* con)
 {
+	// Draw what is left in the stdout buffer, so that it shows up in this frame
+	consoleWriterFlush();
+
+	bool dirty = s_dirtyFirstRow != s_dirtyEndRow;
+	if (!dirty && s_skipUnchanged)
+	{
+		// Nothing changed: keep presenting the previous frame, and pace ourselves to the display
+		if (s_hasVsyncEvent)
+			eventWait(&s_vsyncEvent, UINT64_MAX);
+		else
+			svcSleepThread(16666667);
+		return;
+	}
+
 	// Clear the framebuffer
 	glClearColor(0x10/255.0f, 0x10/255.0f, 0x10/255.0f, 1.0f);
 	glClear(GL_COLOR_BUFFER_BIT);
 
-	// Update tilemap
-	glBindBuffer(GL_ARRAY_BUFFER, s_tilemapVbo);
-	glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(uint16_t)*con->consoleWidth*con->consoleHeight, s_tilemap);
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	// Update the rows of the tilemap that changed
+	if (dirty)
+	{
+		size_t offset = s_dirtyFirstRow*con->consoleWidth;
+		size_t count = (s_dirtyEndRow-s_dirtyFirstRow)*con->consoleWidth;
+		glBindBuffer(GL_ARRAY_BUFFER, s_tilemapVbo);
+		glBufferSubData(GL_ARRAY_BUFFER, sizeof(uint16_t)*offset, sizeof(uint16_t)*count, &s_tilemap[offset]);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		s_dirtyFirstRow = s_dirtyEndRow = 0;
+	}
+
+	// Update the base row of the ring buffer
+	if (s_uploadedBaseRow != s_baseRow)
+	{
+		glProgramUniform1i(s_tilemapVsh, s_baseRowLoc, s_baseRow);
+		s_uploadedBaseRow = s_baseRow;
+	}
 
 	// Draw the tilemap
 	glBindProgramPipeline(s_tilemapPipeline);
@@ -460,8 +645,14 @@ void GpuConsole::deinitEgl()
 	}
 }
 
+static GpuConsole s_gpuConsole;
+
 extern "C" ConsoleRenderer* getDefaultConsoleRenderer(void)
 {
-	static GpuConsole s_gpuConsole;
 	return &s_gpuConsole;
 }
+
+extern "C" void gpuConsoleSetSkipUnchangedFrames(bool enable)
+{
+	s_gpuConsole.setSkipUnchangedFrames(enable);
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Enables (default) or disables skipping the redraw and buffer swap of frames in which the console contents did not change
+void gpuConsoleSetSkipUnchangedFrames(bool enable);
+
+#ifdef __cplusplus
+}
+#endif
@@ -3,9 +3,7 @@
 #include <string.h>
 #include <switch.h>
 
-#include <EGL/egl.h>    // EGL library
-#include <EGL/eglext.h> // EGL extensions
-#include <glad/glad.h>  // glad library (OpenGL loader)
+#include "gl_harness.h"
 
 // GLM headers
 #define GLM_FORCE_PURE
@@ -17,181 +15,14 @@
 
 // ( ͡° ͜ʖ ͡°) mesh data
 #include "lenny.h"
+#include "program_cache.h"
 
 constexpr auto TAU = glm::two_pi<float>();
 
-//-----------------------------------------------------------------------------
-// nxlink support
-//-----------------------------------------------------------------------------
-
-#ifndef ENABLE_NXLINK
-#define TRACE(fmt,...) ((void)0)
-#else
-#include <unistd.h>
-#define TRACE(fmt,...) printf("%s: " fmt "\n", __PRETTY_FUNCTION__, ## __VA_ARGS__)
-
-static int s_nxlinkSock = -1;
-
-static void initNxLink()
-{
-    if (R_FAILED(socketInitializeDefault()))
-        return;
-
-    s_nxlinkSock = nxlinkStdio();
-    if (s_nxlinkSock >= 0)
-        TRACE("printf output now goes to nxlink server");
-    else
-        socketExit();
-}
-
-static void deinitNxLink()
-{
-    if (s_nxlinkSock >= 0)
-    {
-        close(s_nxlinkSock);
-        socketExit();
-        s_nxlinkSock = -1;
-    }
-}
-
-extern "C" void userAppInit()
-{
-    initNxLink();
-}
-
-extern "C" void userAppExit()
-{
-    deinitNxLink();
-}
-
-#endif
-
-//-----------------------------------------------------------------------------
-// EGL initialization
-//-----------------------------------------------------------------------------
-
-static EGLDisplay s_display;
-static EGLContext s_context;
-static EGLSurface s_surface;
-
-static bool initEgl(NWindow* win)
-{
-    // Connect to the EGL default display
-    s_display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
-    if (!s_display)
-    {
-        TRACE("Could not connect to display! error: %d", eglGetError());
-        goto _fail0;
-    }
-
-    // Initialize the EGL display connection
-    eglInitialize(s_display, nullptr, nullptr);
-
-    // Select OpenGL (Core) as the desired graphics API
-    if (eglBindAPI(EGL_OPENGL_API) == EGL_FALSE)
-    {
-        TRACE("Could not set API! error: %d", eglGetError());
-        goto _fail1;
-    }
-
-    // Get an appropriate EGL framebuffer configuration
-    EGLConfig config;
-    EGLint numConfigs;
-    static const EGLint framebufferAttributeList[] =
-    {
-        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
-        EGL_RED_SIZE,     8,
-        EGL_GREEN_SIZE,   8,
-        EGL_BLUE_SIZE,    8,
-        EGL_ALPHA_SIZE,   8,
-        EGL_DEPTH_SIZE,   24,
-        EGL_STENCIL_SIZE, 8,
-        EGL_NONE
-    };
-    eglChooseConfig(s_display, framebufferAttributeList, &config, 1, &numConfigs);
-    if (numConfigs == 0)
-    {
-        TRACE("No config found! error: %d", eglGetError());
-        goto _fail1;
-    }
-
-    // Create an EGL window surface
-    s_surface = eglCreateWindowSurface(s_display, config, win, nullptr);
-    if (!s_surface)
-    {
-        TRACE("Surface creation failed! error: %d", eglGetError());
-        goto _fail1;
-    }
-
-    // Create an EGL rendering context
-    static const EGLint contextAttributeList[] =
-    {
-        EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
-        EGL_CONTEXT_MAJOR_VERSION_KHR, 4,
-        EGL_CONTEXT_MINOR_VERSION_KHR, 3,
-        EGL_NONE
-    };
-    s_context = eglCreateContext(s_display, config, EGL_NO_CONTEXT, contextAttributeList);
-    if (!s_context)
-    {
-        TRACE("Context creation failed! error: %d", eglGetError());
-        goto _fail2;
-    }
-
-    // Connect the context to the surface
-    eglMakeCurrent(s_display, s_surface, s_surface, s_context);
-    return true;
-
-_fail2:
-    eglDestroySurface(s_display, s_surface);
-    s_surface = nullptr;
-_fail1:
-    eglTerminate(s_display);
-    s_display = nullptr;
-_fail0:
-    return false;
-}
-
-static void deinitEgl()
-{
-    if (s_display)
-    {
-        eglMakeCurrent(s_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
-        if (s_context)
-        {
-            eglDestroyContext(s_display, s_context);
-            s_context = nullptr;
-        }
-        if (s_surface)
-        {
-            eglDestroySurface(s_display, s_surface);
-            s_surface = nullptr;
-        }
-        eglTerminate(s_display);
-        s_display = nullptr;
-    }
-}
-
 //-----------------------------------------------------------------------------
 // Main program
 //-----------------------------------------------------------------------------
 
-static void setMesaConfig()
-{
-    // Uncomment below to disable error checking and save CPU time (useful for production):
-    //setenv("MESA_NO_ERROR", "1", 1);
-
-    // Uncomment below to enable Mesa logging:
-    //setenv("EGL_LOG_LEVEL", "debug", 1);
-    //setenv("MESA_VERBOSE", "all", 1);
-    //setenv("NOUVEAU_MESA_DEBUG", "1", 1);
-
-    // Uncomment below to enable shader debugging in Nouveau:
-    //setenv("NV50_PROG_OPTIMIZE", "0", 1);
-    //setenv("NV50_PROG_DEBUG", "1", 1);
-    //setenv("NV50_PROG_CHIPSET", "0x120", 1);
-}
-
 static const char* const vertexShaderSource = R"text(
     #version 330 core
 
@@ -297,7 +128,7 @@ static GLuint createAndCompileShader(GLenum type, const char* source)
 }
 
 static GLuint s_program;
-static GLuint s_vao, s_vbo;
+static GLuint s_vao, s_vbo, s_ibo;
 
 static GLint loc_mdlvMtx, loc_projMtx;
 static GLint loc_lightPos, loc_ambient, loc_diffuse, loc_specular;
@@ -306,24 +137,34 @@ static u64 s_startTicks;
 
 static void sceneInit()
 {
-    GLint vsh = createAndCompileShader(GL_VERTEX_SHADER, vertexShaderSource);
-    GLint fsh = createAndCompileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
-
-    s_program = glCreateProgram();
-    glAttachShader(s_program, vsh);
-    glAttachShader(s_program, fsh);
-    glLinkProgram(s_program);
-
-    GLint success;
-    glGetProgramiv(s_program, GL_LINK_STATUS, &success);
-    if (success == GL_FALSE)
+    // Reuse the program binary from a previous run if possible, which skips compiling the shaders
+    programCacheInit("sdmc:/switch/.shadercache/lenny");
+    const char* const shaderSources[] = { vertexShaderSource, fragmentShaderSource };
+    u64 programHash = programCacheHash(shaderSources, 2);
+    s_program = programCacheLoad(programHash);
+    if (!s_program)
     {
-        char buf[512];
-        glGetProgramInfoLog(s_program, sizeof(buf), nullptr, buf);
-        TRACE("Link error: %s", buf);
+        GLint vsh = createAndCompileShader(GL_VERTEX_SHADER, vertexShaderSource);
+        GLint fsh = createAndCompileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
+
+        s_program = glCreateProgram();
+        glAttachShader(s_program, vsh);
+        glAttachShader(s_program, fsh);
+        glProgramParameteri(s_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        glLinkProgram(s_program);
+
+        GLint success;
+        glGetProgramiv(s_program, GL_LINK_STATUS, &success);
+        if (success == GL_FALSE)
+        {
+            char buf[512];
+            glGetProgramInfoLog(s_program, sizeof(buf), nullptr, buf);
+            TRACE("Link error: %s", buf);
+        }
+        glDeleteShader(vsh);
+        glDeleteShader(fsh);
+        programCacheStore(programHash, s_program);
     }
-    glDeleteShader(vsh);
-    glDeleteShader(fsh);
 
     loc_mdlvMtx = glGetUniformLocation(s_program, "mdlvMtx");
     loc_projMtx = glGetUniformLocation(s_program, "projMtx");
@@ -337,18 +178,24 @@ static void sceneInit()
 
     glGenVertexArrays(1, &s_vao);
     glGenBuffers(1, &s_vbo);
+    glGenBuffers(1, &s_ibo);
     // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
     glBindVertexArray(s_vao);
 
     glBindBuffer(GL_ARRAY_BUFFER, s_vbo);
     glBufferData(GL_ARRAY_BUFFER, sizeof(lennyVertices), lennyVertices, GL_STATIC_DRAW);
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, x));
+    // The mesh is packed: half-float positions and 2_10_10_10 signed normalized normals
+    glVertexAttribPointer(0, 4, GL_HALF_FLOAT, GL_FALSE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, x));
     glEnableVertexAttribArray(0);
 
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, nx));
+    glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(lennyVertex), (void*)offsetof(lennyVertex, normal));
     glEnableVertexAttribArray(1);
 
+    // The index buffer binding is part of the VAO state
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, s_ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(lennyIndices), lennyIndices, GL_STATIC_DRAW);
+
     // note that this is allowed, the call to glVertexAttribPointer registered VBO as the vertex attribute's bound vertex buffer object so afterwards we can safely unbind
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 
@@ -389,11 +236,12 @@ static void sceneRender()
 
     // draw our ( ͡° ͜ʖ ͡°)
     glBindVertexArray(s_vao); // seeing as we only have a single VAO there's no need to bind it every time, but we'll do so to keep things a bit more organized
-    glDrawArrays(GL_TRIANGLES, 0, lennyVerticesCount);
+    glDrawElements(GL_TRIANGLES, lennyIndicesCount, GL_UNSIGNED_SHORT, nullptr);
 }
 
 static void sceneExit()
 {
+    glDeleteBuffers(1, &s_ibo);
     glDeleteBuffers(1, &s_vbo);
     glDeleteVertexArrays(1, &s_vao);
     glDeleteProgram(s_program);
@@ -401,40 +249,15 @@ static void sceneExit()
 
 int main(int argc, char* argv[])
 {
-    // Set mesa configuration (useful for debugging)
-    setMesaConfig();
-
-    // Initialize EGL on the default window
-    if (!initEgl(nwindowGetDefault()))
-        return EXIT_FAILURE;
-
-    // Load OpenGL routines using glad
-    gladLoadGL();
-
-    // Initialize our scene
-    sceneInit();
-
-    // Main graphics loop
-    while (appletMainLoop())
-    {
-        // Get and process input
-        hidScanInput();
-        u32 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
-        if (kDown & KEY_PLUS)
-            break;
-
-        // Update our scene
-        sceneUpdate();
-
-        // Render stuff!
-        sceneRender();
-        eglSwapBuffers(s_display, s_surface);
-    }
-
-    // Deinitialize our scene
-    sceneExit();
-
-    // Deinitialize EGL
-    deinitEgl();
-    return EXIT_SUCCESS;
+    // The harness owns EGL and the main loop, and reports frame timings
+    HarnessCallbacks cb = {};
+    cb.init = sceneInit;
+    cb.exit = sceneExit;
+    cb.update = [](u32 kDown, u32 kHeld) { sceneUpdate(); };
+    cb.render = sceneRender;
+
+    // Launch with --bench (e.g. through nxlink) to sweep the Mesa settings instead
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0)
+        return harnessRunBenchmark(cb, "sdmc:/switch/lenny_mesa_sweep.csv");
+    return harnessRun(cb);
 }
@@ -0,0 +1,3350 @@
+#include "lenny.h"
+
+const lennyVertex lennyVertices[3345] = 
+{
+	{ -0.48246, 0.00967688, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.48245, -0.0384802, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.483443, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.48245, -0.0384802, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.48246, 0.00967688, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.479512, 0.0320617, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.48246, 0.00967688, -0.179352, -0.996298, 0.0859645, -1.59603e-013, },
+	{ -0.479512, 0.0320617, -0.149352, -0.983692, 0.179862, -3.33933e-013, },
+	{ -0.479512, 0.0320617, -0.179352, -0.983692, 0.179862, -3.33933e-013, },
+	{ -0.479512, 0.0320617, -0.149352, -0.983692, 0.179862, -3.33933e-013, },
+	{ -0.48246, 0.00967688, -0.179352, -0.996298, 0.0859645, -1.59603e-013, },
+	{ -0.48246, 0.00967688, -0.149352, -0.996298, 0.0859645, -1.59603e-013, },
+	{ -0.483443, -0.0141747, -0.179352, -1, 0.000179258, -3.32813e-016, },
+	{ -0.48246, 0.00967688, -0.149352, -0.996298, 0.0859645, -1.59603e-013, },
+	{ -0.48246, 0.00967688, -0.179352, -0.996298, 0.0859645, -1.59603e-013, },
+	{ -0.48246, 0.00967688, -0.149352, -0.996298, 0.0859645, -1.59603e-013, },
+	{ -0.483443, -0.0141747, -0.179352, -1, 0.000179258, -3.32813e-016, },
+	{ -0.483443, -0.0141747, -0.149352, -1, 0.000179258, -3.32813e-016, },
+	{ -0.48245, -0.0384802, -0.179352, -0.996318, -0.0857369, 1.5918e-013, },
+	{ -0.483443, -0.0141747, -0.149352, -1, 0.000179258, -3.32813e-016, },
+	{ -0.483443, -0.0141747, -0.179352, -1, 0.000179258, -3.32813e-016, },
+	{ -0.483443, -0.0141747, -0.149352, -1, 0.000179258, -3.32813e-016, },
+	{ -0.48245, -0.0384802, -0.179352, -0.996318, -0.0857369, 1.5918e-013, },
+	{ -0.48245, -0.0384802, -0.149352, -0.996318, -0.0857369, 1.5918e-013, },
+	{ -0.48245, -0.0384802, -0.179352, -0.996318, -0.0857369, 1.5918e-013, },
+	{ -0.479472, -0.0611096, -0.149352, -0.983531, -0.18074, 3.35564e-013, },
+	{ -0.48245, -0.0384802, -0.149352, -0.996318, -0.0857369, 1.5918e-013, },
+	{ -0.479472, -0.0611096, -0.149352, -0.983531, -0.18074, 3.35564e-013, },
+	{ -0.48245, -0.0384802, -0.179352, -0.996318, -0.0857369, 1.5918e-013, },
+	{ -0.479472, -0.0611096, -0.179352, -0.983531, -0.18074, 3.35564e-013, },
+	{ -0.48245, -0.0384802, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.479512, 0.0320617, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.479472, -0.0611096, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.479472, -0.0611096, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.479512, 0.0320617, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.474598, 0.0529799, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.479512, 0.0320617, -0.179352, -0.983692, 0.179862, -3.33933e-013, },
+	{ -0.474598, 0.0529799, -0.149352, -0.959566, 0.281484, -5.22607e-013, },
+	{ -0.474598, 0.0529799, -0.179352, -0.959566, 0.281484, -5.22607e-013, },
+	{ -0.474598, 0.0529799, -0.149352, -0.959566, 0.281484, -5.22607e-013, },
+	{ -0.479512, 0.0320617, -0.179352, -0.983692, 0.179862, -3.33933e-013, },
+	{ -0.479512, 0.0320617, -0.149352, -0.983692, 0.179862, -3.33933e-013, },
+	{ -0.479512, 0.0320617, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.479472, -0.0611096, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.474598, 0.0529799, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.479512, 0.0320617, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.48245, -0.0384802, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.479472, -0.0611096, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.48246, 0.00967688, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.48245, -0.0384802, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.479512, 0.0320617, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.48245, -0.0384802, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.48246, 0.00967688, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.483443, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.474598, 0.0529799, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.479472, -0.0611096, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.474508, -0.0820626, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.479472, -0.0611096, -0.179352, -0.983531, -0.18074, 3.35564e-013, },
+	{ -0.474508, -0.0820626, -0.149352, -0.958441, -0.285291, 5.29675e-013, },
+	{ -0.479472, -0.0611096, -0.149352, -0.983531, -0.18074, 3.35564e-013, },
+	{ -0.474508, -0.0820626, -0.149352, -0.958441, -0.285291, 5.29675e-013, },
+	{ -0.479472, -0.0611096, -0.179352, -0.983531, -0.18074, 3.35564e-013, },
+	{ -0.474508, -0.0820626, -0.179352, -0.958441, -0.285291, 5.29675e-013, },
+	{ -0.479472, -0.0611096, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.474598, 0.0529799, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.474508, -0.0820626, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.474508, -0.0820626, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.474598, 0.0529799, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.467718, 0.0724313, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.474598, 0.0529799, -0.179352, -0.959566, 0.281484, -5.22607e-013, },
+	{ -0.467718, 0.0724313, -0.149352, -0.917564, 0.397588, -7.38167e-013, },
+	{ -0.467718, 0.0724313, -0.179352, -0.917564, 0.397588, -7.38167e-013, },
+	{ -0.467718, 0.0724313, -0.149352, -0.917564, 0.397588, -7.38167e-013, },
+	{ -0.474598, 0.0529799, -0.179352, -0.959566, 0.281484, -5.22607e-013, },
+	{ -0.474598, 0.0529799, -0.149352, -0.959566, 0.281484, -5.22607e-013, },
+	{ -0.474598, 0.0529799, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.474508, -0.0820626, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.467718, 0.0724313, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.467718, 0.0724313, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.474508, -0.0820626, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.467559, -0.101339, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.474508, -0.0820626, -0.179352, -0.958441, -0.285291, 5.29675e-013, },
+	{ -0.467559, -0.101339, -0.149352, -0.915227, -0.402939, 7.48101e-013, },
+	{ -0.474508, -0.0820626, -0.149352, -0.958441, -0.285291, 5.29675e-013, },
+	{ -0.467559, -0.101339, -0.149352, -0.915227, -0.402939, 7.48101e-013, },
+	{ -0.474508, -0.0820626, -0.179352, -0.958441, -0.285291, 5.29675e-013, },
+	{ -0.467559, -0.101339, -0.179352, -0.915227, -0.402939, 7.48101e-013, },
+	{ -0.474508, -0.0820626, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.467718, 0.0724313, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.467559, -0.101339, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.467559, -0.101339, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.467718, 0.0724313, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.448901, 0.10877, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.467718, 0.0724313, -0.179352, -0.917564, 0.397588, -7.38167e-013, },
+	{ -0.448901, 0.10877, -0.149352, -0.849923, 0.526906, -9.78261e-013, },
+	{ -0.448901, 0.10877, -0.179352, -0.849923, 0.526906, -9.78261e-013, },
+	{ -0.448901, 0.10877, -0.149352, -0.849923, 0.526906, -9.78261e-013, },
+	{ -0.467718, 0.0724313, -0.179352, -0.917564, 0.397588, -7.38167e-013, },
+	{ -0.467718, 0.0724313, -0.149352, -0.917564, 0.397588, -7.38167e-013, },
+	{ -0.467718, 0.0724313, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.467559, -0.101339, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.448901, 0.10877, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.448901, 0.10877, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.467559, -0.101339, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.455346, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.448701, -0.137259, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.455346, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.467559, -0.101339, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.455346, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.448701, -0.137259, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.453889, -0.0403161, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.453889, -0.0403161, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.448701, -0.137259, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.449519, -0.0641428, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.449519, -0.0641428, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.448701, -0.137259, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.442675, -0.0862532, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.442675, -0.0862532, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.448701, -0.137259, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423897, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.448701, -0.137259, -0.149352, -0.848931, -0.528503, 9.81225e-013, },
+	{ -0.423897, -0.171263, -0.179352, -0.807895, -0.589327, 1.09415e-012, },
+	{ -0.423897, -0.171263, -0.149352, -0.807895, -0.589327, 1.09415e-012, },
+	{ -0.423897, -0.171263, -0.179352, -0.807895, -0.589327, 1.09415e-012, },
+	{ -0.448701, -0.137259, -0.149352, -0.848931, -0.528503, 9.81225e-013, },
+	{ -0.448701, -0.137259, -0.179352, -0.848931, -0.528503, 9.81225e-013, },
+	{ -0.467559, -0.101339, -0.149352, -0.915227, -0.402939, 7.48101e-013, },
+	{ -0.448701, -0.137259, -0.179352, -0.848931, -0.528503, 9.81225e-013, },
+	{ -0.448701, -0.137259, -0.149352, -0.848931, -0.528503, 9.81225e-013, },
+	{ -0.448701, -0.137259, -0.179352, -0.848931, -0.528503, 9.81225e-013, },
+	{ -0.467559, -0.101339, -0.149352, -0.915227, -0.402939, 7.48101e-013, },
+	{ -0.467559, -0.101339, -0.179352, -0.915227, -0.402939, 7.48101e-013, },
+	{ -0.455346, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.448701, -0.137259, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.467559, -0.101339, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.448701, -0.137259, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.455346, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.453889, -0.0403161, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.455346, -0.0141747, -0.179352, 0.999999, -0.00142961, 2.65423e-015, },
+	{ -0.453889, -0.0403161, -0.149352, 0.992983, 0.118257, -2.19557e-013, },
+	{ -0.453889, -0.0403161, -0.179352, 0.992983, 0.118257, -2.19557e-013, },
+	{ -0.453889, -0.0403161, -0.149352, 0.992983, 0.118257, -2.19557e-013, },
+	{ -0.455346, -0.0141747, -0.179352, 0.999999, -0.00142961, 2.65423e-015, },
+	{ -0.455346, -0.0141747, -0.149352, 0.999999, -0.00142961, 2.65423e-015, },
+	{ -0.45385, 0.0113681, -0.179352, 0.992719, -0.120452, 2.23633e-013, },
+	{ -0.455346, -0.0141747, -0.149352, 0.999999, -0.00142961, 2.65423e-015, },
+	{ -0.455346, -0.0141747, -0.179352, 0.999999, -0.00142961, 2.65423e-015, },
+	{ -0.455346, -0.0141747, -0.149352, 0.999999, -0.00142961, 2.65423e-015, },
+	{ -0.45385, 0.0113681, -0.179352, 0.992719, -0.120452, 2.23633e-013, },
+	{ -0.45385, 0.0113681, -0.149352, 0.992719, -0.120452, 2.23633e-013, },
+	{ -0.44936, 0.0356337, -0.179352, 0.97154, -0.236876, 4.39788e-013, },
+	{ -0.45385, 0.0113681, -0.149352, 0.992719, -0.120452, 2.23633e-013, },
+	{ -0.45385, 0.0113681, -0.179352, 0.992719, -0.120452, 2.23633e-013, },
+	{ -0.45385, 0.0113681, -0.149352, 0.992719, -0.120452, 2.23633e-013, },
+	{ -0.44936, 0.0356337, -0.179352, 0.97154, -0.236876, 4.39788e-013, },
+	{ -0.44936, 0.0356337, -0.149352, 0.97154, -0.236876, 4.39788e-013, },
+	{ -0.442475, 0.058263, -0.179352, 0.940473, -0.339869, 6.31005e-013, },
+	{ -0.44936, 0.0356337, -0.149352, 0.97154, -0.236876, 4.39788e-013, },
+	{ -0.44936, 0.0356337, -0.179352, 0.97154, -0.236876, 4.39788e-013, },
+	{ -0.44936, 0.0356337, -0.149352, 0.97154, -0.236876, 4.39788e-013, },
+	{ -0.442475, 0.058263, -0.179352, 0.940473, -0.339869, 6.31005e-013, },
+	{ -0.442475, 0.058263, -0.149352, 0.940473, -0.339869, 6.31005e-013, },
+	{ -0.433794, 0.0788968, -0.179352, 0.900067, -0.435752, 8.09023e-013, },
+	{ -0.442475, 0.058263, -0.149352, 0.940473, -0.339869, 6.31005e-013, },
+	{ -0.442475, 0.058263, -0.179352, 0.940473, -0.339869, 6.31005e-013, },
+	{ -0.442475, 0.058263, -0.149352, 0.940473, -0.339869, 6.31005e-013, },
+	{ -0.433794, 0.0788968, -0.179352, 0.900067, -0.435752, 8.09023e-013, },
+	{ -0.433794, 0.0788968, -0.149352, 0.900067, -0.435752, 8.09023e-013, },
+	{ -0.423318, 0.0979142, -0.179352, 0.851338, -0.524617, 9.74011e-013, },
+	{ -0.433794, 0.0788968, -0.149352, 0.900067, -0.435752, 8.09023e-013, },
+	{ -0.433794, 0.0788968, -0.179352, 0.900067, -0.435752, 8.09023e-013, },
+	{ -0.433794, 0.0788968, -0.149352, 0.900067, -0.435752, 8.09023e-013, },
+	{ -0.423318, 0.0979142, -0.179352, 0.851338, -0.524617, 9.74011e-013, },
+	{ -0.423318, 0.0979142, -0.149352, 0.851338, -0.524617, 9.74011e-013, },
+	{ -0.412003, 0.114417, -0.179352, 0.782863, -0.622194, 1.15517e-012, },
+	{ -0.423318, 0.0979142, -0.149352, 0.851338, -0.524617, 9.74011e-013, },
+	{ -0.423318, 0.0979142, -0.179352, 0.851338, -0.524617, 9.74011e-013, },
+	{ -0.423318, 0.0979142, -0.149352, 0.851338, -0.524617, 9.74011e-013, },
+	{ -0.412003, 0.114417, -0.179352, 0.782863, -0.622194, 1.15517e-012, },
+	{ -0.412003, 0.114417, -0.149352, 0.782863, -0.622194, 1.15517e-012, },
+	{ -0.387339, 0.141317, -0.179352, 0.737063, -0.675824, 1.25474e-012, },
+	{ -0.412003, 0.114417, -0.149352, 0.782863, -0.622194, 1.15517e-012, },
+	{ -0.412003, 0.114417, -0.179352, 0.782863, -0.622194, 1.15517e-012, },
+	{ -0.412003, 0.114417, -0.149352, 0.782863, -0.622194, 1.15517e-012, },
+	{ -0.387339, 0.141317, -0.179352, 0.737063, -0.675824, 1.25474e-012, },
+	{ -0.387339, 0.141317, -0.149352, 0.737063, -0.675824, 1.25474e-012, },
+	{ -0.387339, 0.141317, -0.179352, 1, 0, -0, },
+	{ -0.387339, 0.142913, -0.149352, 1, 0, -0, },
+	{ -0.387339, 0.141317, -0.149352, 1, 0, -0, },
+	{ -0.387339, 0.142913, -0.149352, 1, 0, -0, },
+	{ -0.387339, 0.141317, -0.179352, 1, 0, -0, },
+	{ -0.387339, 0.142913, -0.179352, 1, 0, -0, },
+	{ -0.412003, 0.114417, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.387339, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.387339, 0.141317, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.412003, 0.114417, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423897, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.387339, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423318, 0.0979142, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423897, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.412003, 0.114417, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.433794, 0.0788968, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423897, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423318, 0.0979142, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.442475, 0.058263, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423897, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.433794, 0.0788968, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.442475, 0.058263, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.448901, 0.10877, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423897, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.44936, 0.0356337, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.448901, 0.10877, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.442475, 0.058263, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.45385, 0.0113681, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.448901, 0.10877, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.44936, 0.0356337, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.455346, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.448901, 0.10877, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.45385, 0.0113681, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.467559, -0.101339, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.448901, 0.10877, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.455346, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.448901, 0.10877, -0.179352, -0.849923, 0.526906, -9.78261e-013, },
+	{ -0.423897, 0.142913, -0.149352, -0.806795, 0.590832, -1.09695e-012, },
+	{ -0.423897, 0.142913, -0.179352, -0.806795, 0.590832, -1.09695e-012, },
+	{ -0.423897, 0.142913, -0.149352, -0.806795, 0.590832, -1.09695e-012, },
+	{ -0.448901, 0.10877, -0.179352, -0.849923, 0.526906, -9.78261e-013, },
+	{ -0.448901, 0.10877, -0.149352, -0.849923, 0.526906, -9.78261e-013, },
+	{ -0.448901, 0.10877, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.442475, 0.058263, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423897, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.448901, 0.10877, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.44936, 0.0356337, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.442475, 0.058263, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.448901, 0.10877, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.45385, 0.0113681, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.44936, 0.0356337, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.448901, 0.10877, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.455346, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.45385, 0.0113681, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423897, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.442475, 0.058263, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.433794, 0.0788968, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423897, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.433794, 0.0788968, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423318, 0.0979142, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423897, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423318, 0.0979142, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.412003, 0.114417, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423897, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.412003, 0.114417, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.387339, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.387339, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.412003, 0.114417, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.387339, 0.141317, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.387339, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
+	{ -0.423897, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
+	{ -0.387339, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
+	{ -0.423897, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
+	{ -0.387339, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
+	{ -0.423897, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
+	{ -0.449519, -0.0641428, -0.149352, 0.971146, 0.238485, -4.42774e-013, },
+	{ -0.453889, -0.0403161, -0.179352, 0.992983, 0.118257, -2.19557e-013, },
+	{ -0.453889, -0.0403161, -0.149352, 0.992983, 0.118257, -2.19557e-013, },
+	{ -0.453889, -0.0403161, -0.179352, 0.992983, 0.118257, -2.19557e-013, },
+	{ -0.449519, -0.0641428, -0.149352, 0.971146, 0.238485, -4.42774e-013, },
+	{ -0.449519, -0.0641428, -0.179352, 0.971146, 0.238485, -4.42774e-013, },
+	{ -0.442675, -0.0862532, -0.149352, 0.939306, 0.343081, -6.36967e-013, },
+	{ -0.449519, -0.0641428, -0.179352, 0.971146, 0.238485, -4.42774e-013, },
+	{ -0.449519, -0.0641428, -0.149352, 0.971146, 0.238485, -4.42774e-013, },
+	{ -0.449519, -0.0641428, -0.179352, 0.971146, 0.238485, -4.42774e-013, },
+	{ -0.442675, -0.0862532, -0.149352, 0.939306, 0.343081, -6.36967e-013, },
+	{ -0.442675, -0.0862532, -0.179352, 0.939306, 0.343081, -6.36967e-013, },
+	{ -0.433794, -0.107246, -0.149352, 0.90003, 0.435828, -8.09163e-013, },
+	{ -0.442675, -0.0862532, -0.179352, 0.939306, 0.343081, -6.36967e-013, },
+	{ -0.442675, -0.0862532, -0.149352, 0.939306, 0.343081, -6.36967e-013, },
+	{ -0.442675, -0.0862532, -0.179352, 0.939306, 0.343081, -6.36967e-013, },
+	{ -0.433794, -0.107246, -0.149352, 0.90003, 0.435828, -8.09163e-013, },
+	{ -0.433794, -0.107246, -0.179352, 0.90003, 0.435828, -8.09163e-013, },
+	{ -0.433794, -0.107246, -0.149352, 0.90003, 0.435828, -8.09163e-013, },
+	{ -0.423537, -0.125944, -0.179352, 0.850957, 0.525236, -9.75159e-013, },
+	{ -0.433794, -0.107246, -0.179352, 0.90003, 0.435828, -8.09163e-013, },
+	{ -0.423537, -0.125944, -0.179352, 0.850957, 0.525236, -9.75159e-013, },
+	{ -0.433794, -0.107246, -0.149352, 0.90003, 0.435828, -8.09163e-013, },
+	{ -0.423537, -0.125944, -0.149352, 0.850957, 0.525236, -9.75159e-013, },
+	{ -0.433794, -0.107246, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423897, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423537, -0.125944, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.442675, -0.0862532, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423897, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.433794, -0.107246, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423537, -0.125944, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423897, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.411923, -0.142767, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.411923, -0.142767, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423897, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.387339, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.423897, -0.171263, -0.179352, 0, -1, 1.85661e-012, },
+	{ -0.387339, -0.171263, -0.149352, 0, -1, 1.85661e-012, },
+	{ -0.423897, -0.171263, -0.149352, 0, -1, 1.85661e-012, },
+	{ -0.387339, -0.171263, -0.149352, 0, -1, 1.85661e-012, },
+	{ -0.423897, -0.171263, -0.179352, 0, -1, 1.85661e-012, },
+	{ -0.387339, -0.171263, -0.179352, 0, -1, 1.85661e-012, },
+	{ -0.423897, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.411923, -0.142767, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.387339, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423897, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423537, -0.125944, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.411923, -0.142767, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423897, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.433794, -0.107246, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423537, -0.125944, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423897, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.442675, -0.0862532, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.433794, -0.107246, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.448701, -0.137259, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.442675, -0.0862532, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423897, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.448701, -0.137259, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.449519, -0.0641428, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.442675, -0.0862532, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.448701, -0.137259, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.453889, -0.0403161, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.449519, -0.0641428, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.423537, -0.125944, -0.179352, 0.850957, 0.525236, -9.75159e-013, },
+	{ -0.411923, -0.142767, -0.149352, 0.782355, 0.622832, -1.15636e-012, },
+	{ -0.411923, -0.142767, -0.179352, 0.782355, 0.622832, -1.15636e-012, },
+	{ -0.411923, -0.142767, -0.149352, 0.782355, 0.622832, -1.15636e-012, },
+	{ -0.423537, -0.125944, -0.179352, 0.850957, 0.525236, -9.75159e-013, },
+	{ -0.423537, -0.125944, -0.149352, 0.850957, 0.525236, -9.75159e-013, },
+	{ -0.387339, -0.169666, -0.149352, 0.738153, 0.674633, -1.25253e-012, },
+	{ -0.411923, -0.142767, -0.179352, 0.782355, 0.622832, -1.15636e-012, },
+	{ -0.411923, -0.142767, -0.149352, 0.782355, 0.622832, -1.15636e-012, },
+	{ -0.411923, -0.142767, -0.179352, 0.782355, 0.622832, -1.15636e-012, },
+	{ -0.387339, -0.169666, -0.149352, 0.738153, 0.674633, -1.25253e-012, },
+	{ -0.387339, -0.169666, -0.179352, 0.738153, 0.674633, -1.25253e-012, },
+	{ -0.387339, -0.171263, -0.149352, 1, 0, -0, },
+	{ -0.387339, -0.169666, -0.179352, 1, 0, -0, },
+	{ -0.387339, -0.169666, -0.149352, 1, 0, -0, },
+	{ -0.387339, -0.169666, -0.179352, 1, 0, -0, },
+	{ -0.387339, -0.171263, -0.149352, 1, 0, -0, },
+	{ -0.387339, -0.171263, -0.179352, 1, 0, -0, },
+	{ -0.387339, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.411923, -0.142767, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.387339, -0.169666, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.411923, -0.142767, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.387339, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.387339, -0.169666, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.29061, 0.109117, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.27511, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.300972, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.27511, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.29061, 0.109117, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.278682, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.29061, 0.109117, -0.179352, -0.766013, 0.642825, -1.19348e-012, },
+	{ -0.278682, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
+	{ -0.278682, 0.121471, -0.179352, -0.66764, 0.744484, -1.38222e-012, },
+	{ -0.278682, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
+	{ -0.29061, 0.109117, -0.179352, -0.766013, 0.642825, -1.19348e-012, },
+	{ -0.29061, 0.109117, -0.149352, -0.766013, 0.642825, -1.19348e-012, },
+	{ -0.300972, 0.0948611, -0.179352, -0.808895, 0.587953, -1.0916e-012, },
+	{ -0.29061, 0.109117, -0.149352, -0.766013, 0.642825, -1.19348e-012, },
+	{ -0.29061, 0.109117, -0.179352, -0.766013, 0.642825, -1.19348e-012, },
+	{ -0.29061, 0.109117, -0.149352, -0.766013, 0.642825, -1.19348e-012, },
+	{ -0.300972, 0.0948611, -0.179352, -0.808895, 0.587953, -1.0916e-012, },
+	{ -0.300972, 0.0948611, -0.149352, -0.808895, 0.587953, -1.0916e-012, },
+	{ -0.300972, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
+	{ -0.27511, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ -0.300972, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ -0.27511, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ -0.300972, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
+	{ -0.27511, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
+	{ -0.257859, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
+	{ -0.27511, 0.0948611, -0.149352, 0.716917, -0.697159, 1.29435e-012, },
+	{ -0.27511, 0.0948611, -0.179352, 0.716917, -0.697159, 1.29435e-012, },
+	{ -0.27511, 0.0948611, -0.149352, 0.716917, -0.697159, 1.29435e-012, },
+	{ -0.257859, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
+	{ -0.257859, 0.112601, -0.149352, 0.609765, -0.792582, 1.47152e-012, },
+	{ -0.257859, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
+	{ -0.235319, 0.125273, -0.149352, 0.379664, -0.925125, 1.71771e-012, },
+	{ -0.257859, 0.112601, -0.149352, 0.609765, -0.792582, 1.47152e-012, },
+	{ -0.235319, 0.125273, -0.149352, 0.379664, -0.925125, 1.71771e-012, },
+	{ -0.257859, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
+	{ -0.235319, 0.125273, -0.179352, 0.379664, -0.925125, 1.71771e-012, },
+	{ -0.257859, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.250126, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.235319, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.257859, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.265187, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.250126, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.27511, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.265187, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.257859, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.27511, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.278682, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.265187, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.278682, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
+	{ -0.265187, 0.131926, -0.179352, -0.554528, 0.832165, -1.54501e-012, },
+	{ -0.278682, 0.121471, -0.179352, -0.66764, 0.744484, -1.38222e-012, },
+	{ -0.265187, 0.131926, -0.179352, -0.554528, 0.832165, -1.54501e-012, },
+	{ -0.278682, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
+	{ -0.265187, 0.131926, -0.149352, -0.554528, 0.832165, -1.54501e-012, },
+	{ -0.278682, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.27511, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.265187, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.29061, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.27511, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.278682, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.27511, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.29061, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.300972, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.265187, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.27511, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.257859, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.265187, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.257859, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.250126, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.250126, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.257859, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.235319, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.250126, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.235319, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.233498, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.233498, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.235319, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.22987, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.235319, 0.125273, -0.149352, 0.379664, -0.925125, 1.71771e-012, },
+	{ -0.207491, 0.132876, -0.149352, 0.170704, -0.985322, 1.82937e-012, },
+	{ -0.22987, 0.126762, -0.149352, 0.263556, -0.964644, 1.79119e-012, },
+	{ -0.235319, 0.125273, -0.179352, 0.379664, -0.925125, 1.71771e-012, },
+	{ -0.207491, 0.132876, -0.149352, 0.170704, -0.985322, 1.82937e-012, },
+	{ -0.235319, 0.125273, -0.149352, 0.379664, -0.925125, 1.71771e-012, },
+	{ -0.207491, 0.132876, -0.149352, 0.170704, -0.985322, 1.82937e-012, },
+	{ -0.235319, 0.125273, -0.179352, 0.379664, -0.925125, 1.71771e-012, },
+	{ -0.207491, 0.132876, -0.179352, 0.170704, -0.985322, 1.82937e-012, },
+	{ -0.235319, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.233498, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.207491, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.235319, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.250126, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.233498, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.250126, 0.140479, -0.149352, -0.433645, 0.901084, -1.67296e-012, },
+	{ -0.233498, 0.147131, -0.179352, -0.312692, 0.949855, -1.76351e-012, },
+	{ -0.250126, 0.140479, -0.179352, -0.433645, 0.901084, -1.67296e-012, },
+	{ -0.233498, 0.147131, -0.179352, -0.312692, 0.949855, -1.76351e-012, },
+	{ -0.250126, 0.140479, -0.149352, -0.433645, 0.901084, -1.67296e-012, },
+	{ -0.233498, 0.147131, -0.149352, -0.312692, 0.949855, -1.76351e-012, },
+	{ -0.233498, 0.147131, -0.149352, -0.312692, 0.949855, -1.76351e-012, },
+	{ -0.215304, 0.151883, -0.179352, -0.198062, 0.98019, -1.81983e-012, },
+	{ -0.233498, 0.147131, -0.179352, -0.312692, 0.949855, -1.76351e-012, },
+	{ -0.215304, 0.151883, -0.179352, -0.198062, 0.98019, -1.81983e-012, },
+	{ -0.233498, 0.147131, -0.149352, -0.312692, 0.949855, -1.76351e-012, },
+	{ -0.215304, 0.151883, -0.149352, -0.198062, 0.98019, -1.81983e-012, },
+	{ -0.233498, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.22987, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.215304, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.215304, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.22987, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.220073, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.220073, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.22987, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.220073, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.208749, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.208749, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.207491, 0.132876, -0.149352, 0.170704, -0.985322, 1.82937e-012, },
+	{ -0.174376, 0.13541, -0.149352, 8.00648e-005, -1, 1.85651e-012, },
+	{ -0.182425, 0.134794, -0.149352, 0.076306, -0.997084, 1.851e-012, },
+	{ -0.207491, 0.132876, -0.179352, 0.170704, -0.985322, 1.82937e-012, },
+	{ -0.174376, 0.13541, -0.149352, 8.00648e-005, -1, 1.85651e-012, },
+	{ -0.207491, 0.132876, -0.149352, 0.170704, -0.985322, 1.82937e-012, },
+	{ -0.174376, 0.13541, -0.149352, 8.00648e-005, -1, 1.85651e-012, },
+	{ -0.207491, 0.132876, -0.179352, 0.170704, -0.985322, 1.82937e-012, },
+	{ -0.174376, 0.13541, -0.179352, 8.00648e-005, -1, 1.85651e-012, },
+	{ -0.207491, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.195543, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.174376, 0.13541, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.207491, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.215304, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.195543, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.207491, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.233498, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.215304, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.215304, 0.151883, -0.149352, -0.198062, 0.98019, -1.81983e-012, },
+	{ -0.195543, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
+	{ -0.215304, 0.151883, -0.179352, -0.198062, 0.98019, -1.81983e-012, },
+	{ -0.195543, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
+	{ -0.215304, 0.151883, -0.149352, -0.198062, 0.98019, -1.81983e-012, },
+	{ -0.195543, 0.154734, -0.149352, -0.0937744, 0.995593, -1.84843e-012, },
+	{ -0.215304, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.208749, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.195543, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.215304, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.220073, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.208749, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.208749, 0.135271, -0.179352, -0.184752, 0.982785, -1.82465e-012, },
+	{ -0.220073, 0.131978, -0.149352, -0.376579, 0.926384, -1.72004e-012, },
+	{ -0.208749, 0.135271, -0.149352, -0.184752, 0.982785, -1.82465e-012, },
+	{ -0.220073, 0.131978, -0.149352, -0.376579, 0.926384, -1.72004e-012, },
+	{ -0.208749, 0.135271, -0.179352, -0.184752, 0.982785, -1.82465e-012, },
+	{ -0.220073, 0.131978, -0.179352, -0.376579, 0.926384, -1.72004e-012, },
+	{ -0.210455, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.220073, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.208749, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.221949, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.220073, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.210455, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.229612, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.220073, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.221949, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.229612, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.23038, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.220073, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.232166, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.23038, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.229612, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.23951, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.23038, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.232166, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.23951, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.239669, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.23038, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.247262, 0.0416702, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.239669, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.23951, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.247262, 0.0416702, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.247352, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.239669, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.2528, 0.0519572, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.247352, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.247262, 0.0416702, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.2528, 0.0519572, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.25284, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.247352, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.256122, 0.0633018, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.25284, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.2528, 0.0519572, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.256122, 0.0633018, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.256132, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.25284, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.256132, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.256122, 0.0633018, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.25723, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.256122, 0.0633018, -0.179352, -0.982569, -0.185898, 3.45141e-013, },
+	{ -0.25723, 0.075704, -0.149352, -1, 6.48887e-005, -1.20473e-016, },
+	{ -0.25723, 0.075704, -0.179352, -1, 6.48887e-005, -1.20473e-016, },
+	{ -0.25723, 0.075704, -0.149352, -1, 6.48887e-005, -1.20473e-016, },
+	{ -0.256122, 0.0633018, -0.179352, -0.982569, -0.185898, 3.45141e-013, },
+	{ -0.256122, 0.0633018, -0.149352, -0.982569, -0.185898, 3.45141e-013, },
+	{ -0.2528, 0.0519572, -0.179352, -0.92515, -0.379603, 7.04775e-013, },
+	{ -0.256122, 0.0633018, -0.149352, -0.982569, -0.185898, 3.45141e-013, },
+	{ -0.256122, 0.0633018, -0.179352, -0.982569, -0.185898, 3.45141e-013, },
+	{ -0.256122, 0.0633018, -0.149352, -0.982569, -0.185898, 3.45141e-013, },
+	{ -0.2528, 0.0519572, -0.179352, -0.92515, -0.379603, 7.04775e-013, },
+	{ -0.2528, 0.0519572, -0.149352, -0.92515, -0.379603, 7.04775e-013, },
+	{ -0.247262, 0.0416702, -0.179352, -0.827451, -0.561538, 1.04256e-012, },
+	{ -0.2528, 0.0519572, -0.149352, -0.92515, -0.379603, 7.04775e-013, },
+	{ -0.2528, 0.0519572, -0.179352, -0.92515, -0.379603, 7.04775e-013, },
+	{ -0.2528, 0.0519572, -0.149352, -0.92515, -0.379603, 7.04775e-013, },
+	{ -0.247262, 0.0416702, -0.179352, -0.827451, -0.561538, 1.04256e-012, },
+	{ -0.247262, 0.0416702, -0.149352, -0.827451, -0.561538, 1.04256e-012, },
+	{ -0.23951, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
+	{ -0.247262, 0.0416702, -0.149352, -0.827451, -0.561538, 1.04256e-012, },
+	{ -0.247262, 0.0416702, -0.179352, -0.827451, -0.561538, 1.04256e-012, },
+	{ -0.247262, 0.0416702, -0.149352, -0.827451, -0.561538, 1.04256e-012, },
+	{ -0.23951, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
+	{ -0.23951, 0.0324409, -0.149352, -0.701877, -0.712298, 1.32246e-012, },
+	{ -0.23951, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
+	{ -0.230171, 0.0248279, -0.149352, -0.552115, -0.833768, 1.54798e-012, },
+	{ -0.23951, 0.0324409, -0.149352, -0.701877, -0.712298, 1.32246e-012, },
+	{ -0.230171, 0.0248279, -0.149352, -0.552115, -0.833768, 1.54798e-012, },
+	{ -0.23951, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
+	{ -0.230171, 0.0248279, -0.179352, -0.552115, -0.833768, 1.54798e-012, },
+	{ -0.232166, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.230171, 0.0248279, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.23951, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.230171, 0.0248279, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.232166, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.229552, 0.0613761, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.232166, 0.075704, -0.179352, 1, 0.000803637, -1.49204e-015, },
+	{ -0.229552, 0.0613761, -0.149352, 0.926569, 0.376125, -6.98317e-013, },
+	{ -0.229552, 0.0613761, -0.179352, 0.926569, 0.376125, -6.98317e-013, },
+	{ -0.229552, 0.0613761, -0.149352, 0.926569, 0.376125, -6.98317e-013, },
+	{ -0.232166, 0.075704, -0.179352, 1, 0.000803637, -1.49204e-015, },
+	{ -0.232166, 0.075704, -0.149352, 1, 0.000803637, -1.49204e-015, },
+	{ -0.229612, 0.0898323, -0.179352, 0.929149, -0.369705, 6.86399e-013, },
+	{ -0.232166, 0.075704, -0.149352, 1, 0.000803637, -1.49204e-015, },
+	{ -0.232166, 0.075704, -0.179352, 1, 0.000803637, -1.49204e-015, },
+	{ -0.232166, 0.075704, -0.149352, 1, 0.000803637, -1.49204e-015, },
+	{ -0.229612, 0.0898323, -0.179352, 0.929149, -0.369705, 6.86399e-013, },
+	{ -0.229612, 0.0898323, -0.149352, 0.929149, -0.369705, 6.86399e-013, },
+	{ -0.221949, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
+	{ -0.229612, 0.0898323, -0.149352, 0.929149, -0.369705, 6.86399e-013, },
+	{ -0.229612, 0.0898323, -0.179352, 0.929149, -0.369705, 6.86399e-013, },
+	{ -0.229612, 0.0898323, -0.149352, 0.929149, -0.369705, 6.86399e-013, },
+	{ -0.221949, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
+	{ -0.221949, 0.101566, -0.149352, 0.715458, -0.698656, 1.29713e-012, },
+	{ -0.221949, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
+	{ -0.210455, 0.109468, -0.149352, 0.383717, -0.923451, 1.71449e-012, },
+	{ -0.221949, 0.101566, -0.149352, 0.715458, -0.698656, 1.29713e-012, },
+	{ -0.210455, 0.109468, -0.149352, 0.383717, -0.923451, 1.71449e-012, },
+	{ -0.221949, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
+	{ -0.210455, 0.109468, -0.179352, 0.383717, -0.923451, 1.71449e-012, },
+	{ -0.210455, 0.109468, -0.179352, 0.383717, -0.923451, 1.71449e-012, },
+	{ -0.196406, 0.112102, -0.149352, 0, -1, 1.85661e-012, },
+	{ -0.210455, 0.109468, -0.149352, 0.383717, -0.923451, 1.71449e-012, },
+	{ -0.196406, 0.112102, -0.149352, 0, -1, 1.85661e-012, },
+	{ -0.210455, 0.109468, -0.179352, 0.383717, -0.923451, 1.71449e-012, },
+	{ -0.196406, 0.112102, -0.179352, 0, -1, 1.85661e-012, },
+	{ -0.210455, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.208749, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.196406, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.196406, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.208749, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.196406, 0.136368, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.208749, 0.135271, -0.149352, -0.184752, 0.982785, -1.82465e-012, },
+	{ -0.196406, 0.136368, -0.179352, -3.20449e-016, 1, -1.85661e-012, },
+	{ -0.208749, 0.135271, -0.179352, -0.184752, 0.982785, -1.82465e-012, },
+	{ -0.196406, 0.136368, -0.179352, -3.20449e-016, 1, -1.85661e-012, },
+	{ -0.208749, 0.135271, -0.149352, -0.184752, 0.982785, -1.82465e-012, },
+	{ -0.196406, 0.136368, -0.149352, -3.20449e-016, 1, -1.85661e-012, },
+	{ -0.195543, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.208749, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.195543, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.184064, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.184064, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.172739, 0.131978, -0.149352, 0.376579, 0.926384, -1.71984e-012, },
+	{ -0.184064, 0.135271, -0.149352, 0.184752, 0.982785, -1.82456e-012, },
+	{ -0.182425, 0.134794, -0.149352, 0.279188, 0.960237, -1.7826e-012, },
+	{ -0.172739, 0.131978, -0.149352, 0.376579, 0.926384, -1.71984e-012, },
+	{ -0.184064, 0.135271, -0.179352, 0.184752, 0.982785, -1.82456e-012, },
+	{ -0.184064, 0.135271, -0.149352, 0.184752, 0.982785, -1.82456e-012, },
+	{ -0.184064, 0.135271, -0.179352, 0.184752, 0.982785, -1.82456e-012, },
+	{ -0.172739, 0.131978, -0.149352, 0.376579, 0.926384, -1.71984e-012, },
+	{ -0.172739, 0.131978, -0.179352, 0.376579, 0.926384, -1.71984e-012, },
+	{ -0.172739, 0.131978, -0.149352, 0.376579, 0.926384, -1.71984e-012, },
+	{ -0.162432, 0.12649, -0.179352, 0.556478, 0.830862, -1.54259e-012, },
+	{ -0.172739, 0.131978, -0.179352, 0.376579, 0.926384, -1.71984e-012, },
+	{ -0.162432, 0.12649, -0.179352, 0.556478, 0.830862, -1.54259e-012, },
+	{ -0.172739, 0.131978, -0.149352, 0.376579, 0.926384, -1.71984e-012, },
+	{ -0.162432, 0.12649, -0.149352, 0.556478, 0.830862, -1.54259e-012, },
+	{ -0.172739, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.170863, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.162432, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.172739, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.182358, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.170863, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.182358, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.172739, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.112102, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.182358, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.112102, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.210455, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.112102, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.221949, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.210455, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.229612, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.221949, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.22987, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.229612, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.207491, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.23038, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.229612, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.22987, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.23038, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.232166, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.229612, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.23038, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.23951, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.232166, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.239669, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.23951, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.23038, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.239669, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.247262, 0.0416702, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.23951, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.247352, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.247262, 0.0416702, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.239669, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.247352, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.2528, 0.0519572, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.247262, 0.0416702, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.25284, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.2528, 0.0519572, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.247352, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.25284, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.256122, 0.0633018, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.2528, 0.0519572, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.256132, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.256122, 0.0633018, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.25284, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.256122, 0.0633018, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.256132, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.25723, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.256132, 0.0879765, -0.149352, -0.982629, 0.185582, -3.44553e-013, },
+	{ -0.25723, 0.075704, -0.179352, -1, 6.48887e-005, -1.20473e-016, },
+	{ -0.25723, 0.075704, -0.149352, -1, 6.48887e-005, -1.20473e-016, },
+	{ -0.25723, 0.075704, -0.179352, -1, 6.48887e-005, -1.20473e-016, },
+	{ -0.256132, 0.0879765, -0.149352, -0.982629, 0.185582, -3.44553e-013, },
+	{ -0.256132, 0.0879765, -0.179352, -0.982629, 0.185582, -3.44553e-013, },
+	{ -0.25284, 0.0992512, -0.149352, -0.925933, 0.377687, -7.01219e-013, },
+	{ -0.256132, 0.0879765, -0.179352, -0.982629, 0.185582, -3.44553e-013, },
+	{ -0.256132, 0.0879765, -0.149352, -0.982629, 0.185582, -3.44553e-013, },
+	{ -0.256132, 0.0879765, -0.179352, -0.982629, 0.185582, -3.44553e-013, },
+	{ -0.25284, 0.0992512, -0.149352, -0.925933, 0.377687, -7.01219e-013, },
+	{ -0.25284, 0.0992512, -0.179352, -0.925933, 0.377687, -7.01219e-013, },
+	{ -0.247352, 0.109528, -0.149352, -0.830379, 0.557199, -1.0345e-012, },
+	{ -0.25284, 0.0992512, -0.179352, -0.925933, 0.377687, -7.01219e-013, },
+	{ -0.25284, 0.0992512, -0.149352, -0.925933, 0.377687, -7.01219e-013, },
+	{ -0.25284, 0.0992512, -0.179352, -0.925933, 0.377687, -7.01219e-013, },
+	{ -0.247352, 0.109528, -0.149352, -0.830379, 0.557199, -1.0345e-012, },
+	{ -0.247352, 0.109528, -0.179352, -0.830379, 0.557199, -1.0345e-012, },
+	{ -0.239669, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
+	{ -0.247352, 0.109528, -0.179352, -0.830379, 0.557199, -1.0345e-012, },
+	{ -0.247352, 0.109528, -0.149352, -0.830379, 0.557199, -1.0345e-012, },
+	{ -0.247352, 0.109528, -0.179352, -0.830379, 0.557199, -1.0345e-012, },
+	{ -0.239669, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
+	{ -0.239669, 0.118807, -0.179352, -0.70692, 0.707293, -1.31317e-012, },
+	{ -0.239669, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
+	{ -0.23038, 0.12649, -0.179352, -0.556478, 0.830862, -1.5427e-012, },
+	{ -0.239669, 0.118807, -0.179352, -0.70692, 0.707293, -1.31317e-012, },
+	{ -0.23038, 0.12649, -0.179352, -0.556478, 0.830862, -1.5427e-012, },
+	{ -0.239669, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
+	{ -0.23038, 0.12649, -0.149352, -0.556478, 0.830862, -1.5427e-012, },
+	{ -0.220073, 0.131978, -0.149352, -0.376579, 0.926384, -1.72004e-012, },
+	{ -0.23038, 0.12649, -0.179352, -0.556478, 0.830862, -1.5427e-012, },
+	{ -0.23038, 0.12649, -0.149352, -0.556478, 0.830862, -1.5427e-012, },
+	{ -0.23038, 0.12649, -0.179352, -0.556478, 0.830862, -1.5427e-012, },
+	{ -0.220073, 0.131978, -0.149352, -0.376579, 0.926384, -1.72004e-012, },
+	{ -0.220073, 0.131978, -0.179352, -0.376579, 0.926384, -1.72004e-012, },
+	{ -0.220073, 0.131978, -0.149352, -0.376579, 0.926384, -1.72004e-012, },
+	{ -0.23038, 0.12649, -0.149352, -0.556478, 0.830862, -1.5427e-012, },
+	{ -0.22987, 0.126762, -0.149352, -0.469967, 0.882684, -1.63902e-012, },
+	{ -0.230171, 0.0248279, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.232166, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.23951, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.232166, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.230171, 0.0248279, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.229552, 0.0613761, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.229552, 0.0613761, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.230171, 0.0248279, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.219874, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.230171, 0.0248279, -0.179352, -0.552115, -0.833768, 1.54798e-012, },
+	{ -0.219874, 0.0193901, -0.149352, -0.374648, -0.927167, 1.72139e-012, },
+	{ -0.230171, 0.0248279, -0.149352, -0.552115, -0.833768, 1.54798e-012, },
+	{ -0.219874, 0.0193901, -0.149352, -0.374648, -0.927167, 1.72139e-012, },
+	{ -0.230171, 0.0248279, -0.179352, -0.552115, -0.833768, 1.54798e-012, },
+	{ -0.219874, 0.0193901, -0.179352, -0.374648, -0.927167, 1.72139e-012, },
+	{ -0.230171, 0.0248279, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.229552, 0.0613761, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.219874, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.219874, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.229552, 0.0613761, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.22171, 0.0496823, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.229552, 0.0613761, -0.179352, 0.926569, 0.376125, -6.98317e-013, },
+	{ -0.22171, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
+	{ -0.22171, 0.0496823, -0.179352, 0.707819, 0.706394, -1.3115e-012, },
+	{ -0.22171, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
+	{ -0.229552, 0.0613761, -0.179352, 0.926569, 0.376125, -6.98317e-013, },
+	{ -0.229552, 0.0613761, -0.149352, 0.926569, 0.376125, -6.98317e-013, },
+	{ -0.229552, 0.0613761, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.219874, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.22171, 0.0496823, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.22171, 0.0496823, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.219874, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.210155, 0.0418997, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.210155, 0.0418997, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.219874, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.208619, 0.0161274, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.219874, 0.0193901, -0.179352, -0.374648, -0.927167, 1.72139e-012, },
+	{ -0.208619, 0.0161274, -0.149352, -0.184427, -0.982846, 1.82476e-012, },
+	{ -0.219874, 0.0193901, -0.149352, -0.374648, -0.927167, 1.72139e-012, },
+	{ -0.208619, 0.0161274, -0.149352, -0.184427, -0.982846, 1.82476e-012, },
+	{ -0.219874, 0.0193901, -0.179352, -0.374648, -0.927167, 1.72139e-012, },
+	{ -0.208619, 0.0161274, -0.179352, -0.184427, -0.982846, 1.82476e-012, },
+	{ -0.219874, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.210155, 0.0418997, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.208619, 0.0161274, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.219874, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.22171, 0.0496823, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.210155, 0.0418997, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.22171, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
+	{ -0.210155, 0.0418997, -0.179352, 0.379845, 0.92505, -1.71746e-012, },
+	{ -0.22171, 0.0496823, -0.179352, 0.707819, 0.706394, -1.3115e-012, },
+	{ -0.210155, 0.0418997, -0.179352, 0.379845, 0.92505, -1.71746e-012, },
+	{ -0.22171, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
+	{ -0.210155, 0.0418997, -0.149352, 0.379845, 0.92505, -1.71746e-012, },
+	{ -0.210155, 0.0418997, -0.149352, 0.379845, 0.92505, -1.71746e-012, },
+	{ -0.196406, 0.0393055, -0.179352, -0.000116454, 1, -1.85661e-012, },
+	{ -0.210155, 0.0418997, -0.179352, 0.379845, 0.92505, -1.71746e-012, },
+	{ -0.196406, 0.0393055, -0.179352, -0.000116454, 1, -1.85661e-012, },
+	{ -0.210155, 0.0418997, -0.149352, 0.379845, 0.92505, -1.71746e-012, },
+	{ -0.196406, 0.0393055, -0.149352, -0.000116454, 1, -1.85661e-012, },
+	{ -0.210155, 0.0418997, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.208619, 0.0161274, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.208619, 0.0161274, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.0150399, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.208619, 0.0161274, -0.179352, -0.184427, -0.982846, 1.82476e-012, },
+	{ -0.196406, 0.0150399, -0.149352, -6.3234e-005, -1, 1.85661e-012, },
+	{ -0.208619, 0.0161274, -0.149352, -0.184427, -0.982846, 1.82476e-012, },
+	{ -0.196406, 0.0150399, -0.149352, -6.3234e-005, -1, 1.85661e-012, },
+	{ -0.208619, 0.0161274, -0.179352, -0.184427, -0.982846, 1.82476e-012, },
+	{ -0.196406, 0.0150399, -0.179352, -6.3234e-005, -1, 1.85661e-012, },
+	{ -0.208619, 0.0161274, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.196406, 0.0393055, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.196406, 0.0150399, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.208619, 0.0161274, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.210155, 0.0418997, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.196406, 0.0393055, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.196406, 0.0150399, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.196406, 0.0393055, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.182358, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.196406, 0.0393055, -0.149352, -0.000116454, 1, -1.85661e-012, },
+	{ -0.182358, 0.0419596, -0.179352, -0.385978, 0.922508, -1.71274e-012, },
+	{ -0.196406, 0.0393055, -0.179352, -0.000116454, 1, -1.85661e-012, },
+	{ -0.182358, 0.0419596, -0.179352, -0.385978, 0.922508, -1.71274e-012, },
+	{ -0.196406, 0.0393055, -0.149352, -0.000116454, 1, -1.85661e-012, },
+	{ -0.182358, 0.0419596, -0.149352, -0.385978, 0.922508, -1.71274e-012, },
+	{ -0.196406, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.184064, 0.0161374, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.182358, 0.0419596, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.0150399, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.184064, 0.0161374, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.196406, 0.0150399, -0.179352, -6.3234e-005, -1, 1.85661e-012, },
+	{ -0.184064, 0.0161374, -0.149352, 0.184752, -0.982785, 1.82465e-012, },
+	{ -0.196406, 0.0150399, -0.149352, -6.3234e-005, -1, 1.85661e-012, },
+	{ -0.184064, 0.0161374, -0.149352, 0.184752, -0.982785, 1.82465e-012, },
+	{ -0.196406, 0.0150399, -0.179352, -6.3234e-005, -1, 1.85661e-012, },
+	{ -0.184064, 0.0161374, -0.179352, 0.184752, -0.982785, 1.82465e-012, },
+	{ -0.196406, 0.0150399, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.182358, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.184064, 0.0161374, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.184064, 0.0161374, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.182358, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.172739, 0.01943, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.172739, 0.01943, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.182358, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.170863, 0.0499217, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.182358, 0.0419596, -0.149352, -0.385978, 0.922508, -1.71274e-012, },
+	{ -0.170863, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
+	{ -0.182358, 0.0419596, -0.179352, -0.385978, 0.922508, -1.71274e-012, },
+	{ -0.170863, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
+	{ -0.182358, 0.0419596, -0.149352, -0.385978, 0.922508, -1.71274e-012, },
+	{ -0.170863, 0.0499217, -0.149352, -0.716961, 0.697114, -1.29427e-012, },
+	{ -0.182358, 0.0419596, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.172739, 0.01943, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.170863, 0.0499217, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.182358, 0.0419596, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.184064, 0.0161374, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.172739, 0.01943, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.184064, 0.0161374, -0.179352, 0.184752, -0.982785, 1.82465e-012, },
+	{ -0.172739, 0.01943, -0.149352, 0.376579, -0.926384, 1.71994e-012, },
+	{ -0.184064, 0.0161374, -0.149352, 0.184752, -0.982785, 1.82465e-012, },
+	{ -0.172739, 0.01943, -0.149352, 0.376579, -0.926384, 1.71994e-012, },
+	{ -0.184064, 0.0161374, -0.179352, 0.184752, -0.982785, 1.82465e-012, },
+	{ -0.172739, 0.01943, -0.179352, 0.376579, -0.926384, 1.71994e-012, },
+	{ -0.172739, 0.01943, -0.179352, 0.376579, -0.926384, 1.71994e-012, },
+	{ -0.162432, 0.0249177, -0.149352, 0.556478, -0.830862, 1.54259e-012, },
+	{ -0.172739, 0.01943, -0.149352, 0.376579, -0.926384, 1.71994e-012, },
+	{ -0.162432, 0.0249177, -0.149352, 0.556478, -0.830862, 1.54259e-012, },
+	{ -0.172739, 0.01943, -0.179352, 0.376579, -0.926384, 1.71994e-012, },
+	{ -0.162432, 0.0249177, -0.179352, 0.556478, -0.830862, 1.54259e-012, },
+	{ -0.172739, 0.01943, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.170863, 0.0499217, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.162432, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.162432, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.170863, 0.0499217, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.163201, 0.0616754, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.170863, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
+	{ -0.163201, 0.0616754, -0.149352, -0.929063, 0.369922, -6.86802e-013, },
+	{ -0.163201, 0.0616754, -0.179352, -0.929063, 0.369922, -6.86802e-013, },
+	{ -0.163201, 0.0616754, -0.149352, -0.929063, 0.369922, -6.86802e-013, },
+	{ -0.170863, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
+	{ -0.170863, 0.0499217, -0.149352, -0.716961, 0.697114, -1.29427e-012, },
+	{ -0.170863, 0.0499217, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.162432, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.163201, 0.0616754, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.170863, 0.0499217, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.172739, 0.01943, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.162432, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.163201, 0.0616754, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.162432, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.160646, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.160646, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.162432, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.153143, 0.0326005, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.162432, 0.0249177, -0.179352, 0.556478, -0.830862, 1.54259e-012, },
+	{ -0.153143, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
+	{ -0.162432, 0.0249177, -0.149352, 0.556478, -0.830862, 1.54259e-012, },
+	{ -0.153143, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
+	{ -0.162432, 0.0249177, -0.179352, 0.556478, -0.830862, 1.54259e-012, },
+	{ -0.153143, 0.0326005, -0.179352, 0.70692, -0.707293, 1.31317e-012, },
+	{ -0.162432, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.160646, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.153143, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.162432, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.163201, 0.0616754, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.160646, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.163201, 0.0616754, -0.179352, -0.929063, 0.369922, -6.86802e-013, },
+	{ -0.160646, 0.075704, -0.149352, -1, 0.000622437, -1.15562e-015, },
+	{ -0.160646, 0.075704, -0.179352, -1, 0.000622437, -1.15562e-015, },
+	{ -0.160646, 0.075704, -0.149352, -1, 0.000622437, -1.15562e-015, },
+	{ -0.163201, 0.0616754, -0.179352, -0.929063, 0.369922, -6.86802e-013, },
+	{ -0.163201, 0.0616754, -0.149352, -0.929063, 0.369922, -6.86802e-013, },
+	{ -0.163201, 0.0898323, -0.149352, -0.929149, -0.369705, 6.86399e-013, },
+	{ -0.160646, 0.075704, -0.179352, -1, 0.000622437, -1.15562e-015, },
+	{ -0.160646, 0.075704, -0.149352, -1, 0.000622437, -1.15562e-015, },
+	{ -0.160646, 0.075704, -0.179352, -1, 0.000622437, -1.15562e-015, },
+	{ -0.163201, 0.0898323, -0.149352, -0.929149, -0.369705, 6.86399e-013, },
+	{ -0.163201, 0.0898323, -0.179352, -0.929149, -0.369705, 6.86399e-013, },
+	{ -0.170863, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
+	{ -0.163201, 0.0898323, -0.179352, -0.929149, -0.369705, 6.86399e-013, },
+	{ -0.163201, 0.0898323, -0.149352, -0.929149, -0.369705, 6.86399e-013, },
+	{ -0.163201, 0.0898323, -0.179352, -0.929149, -0.369705, 6.86399e-013, },
+	{ -0.170863, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
+	{ -0.170863, 0.101566, -0.179352, -0.715458, -0.698656, 1.29713e-012, },
+	{ -0.170863, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
+	{ -0.182358, 0.109468, -0.179352, -0.383717, -0.923451, 1.71449e-012, },
+	{ -0.170863, 0.101566, -0.179352, -0.715458, -0.698656, 1.29713e-012, },
+	{ -0.182358, 0.109468, -0.179352, -0.383717, -0.923451, 1.71449e-012, },
+	{ -0.170863, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
+	{ -0.182358, 0.109468, -0.149352, -0.383717, -0.923451, 1.71449e-012, },
+	{ -0.182358, 0.109468, -0.149352, -0.383717, -0.923451, 1.71449e-012, },
+	{ -0.196406, 0.112102, -0.179352, 0, -1, 1.85661e-012, },
+	{ -0.182358, 0.109468, -0.179352, -0.383717, -0.923451, 1.71449e-012, },
+	{ -0.196406, 0.112102, -0.179352, 0, -1, 1.85661e-012, },
+	{ -0.182358, 0.109468, -0.149352, -0.383717, -0.923451, 1.71449e-012, },
+	{ -0.196406, 0.112102, -0.149352, 0, -1, 1.85661e-012, },
+	{ -0.196406, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.184064, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.182358, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.196406, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.196406, 0.136368, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.184064, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.196406, 0.136368, -0.149352, -3.20449e-016, 1, -1.85661e-012, },
+	{ -0.184064, 0.135271, -0.179352, 0.184752, 0.982785, -1.82456e-012, },
+	{ -0.196406, 0.136368, -0.179352, -3.20449e-016, 1, -1.85661e-012, },
+	{ -0.184064, 0.135271, -0.179352, 0.184752, 0.982785, -1.82456e-012, },
+	{ -0.196406, 0.136368, -0.149352, -3.20449e-016, 1, -1.85661e-012, },
+	{ -0.184064, 0.135271, -0.149352, 0.184752, 0.982785, -1.82456e-012, },
+	{ -0.182358, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.184064, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.172739, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.182358, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.172739, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.170863, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.170863, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.172739, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.162432, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.170863, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.162432, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.163201, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.163201, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.162432, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.160646, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.160646, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.162432, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.153143, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.162432, 0.12649, -0.149352, 0.556478, 0.830862, -1.54259e-012, },
+	{ -0.153143, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
+	{ -0.162432, 0.12649, -0.179352, 0.556478, 0.830862, -1.54259e-012, },
+	{ -0.153143, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
+	{ -0.162432, 0.12649, -0.149352, 0.556478, 0.830862, -1.54259e-012, },
+	{ -0.153143, 0.118807, -0.149352, 0.70692, 0.707293, -1.31317e-012, },
+	{ -0.162432, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.160646, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.153143, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.162432, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.163201, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.160646, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.162432, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.170863, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.163201, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.153143, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.160646, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.153143, 0.0326005, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.153143, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.153143, 0.0326005, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.14546, 0.0418797, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.153143, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
+	{ -0.14546, 0.0418797, -0.179352, 0.830379, -0.557199, 1.0345e-012, },
+	{ -0.14546, 0.0418797, -0.149352, 0.830379, -0.557199, 1.0345e-012, },
+	{ -0.14546, 0.0418797, -0.179352, 0.830379, -0.557199, 1.0345e-012, },
+	{ -0.153143, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
+	{ -0.153143, 0.0326005, -0.179352, 0.70692, -0.707293, 1.31317e-012, },
+	{ -0.153143, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.14546, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.14546, 0.0418797, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.153143, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.153143, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.14546, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.153143, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.160646, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.153143, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.153143, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
+	{ -0.14546, 0.109528, -0.149352, 0.830379, 0.557199, -1.0345e-012, },
+	{ -0.14546, 0.109528, -0.179352, 0.830379, 0.557199, -1.0345e-012, },
+	{ -0.14546, 0.109528, -0.149352, 0.830379, 0.557199, -1.0345e-012, },
+	{ -0.153143, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
+	{ -0.153143, 0.118807, -0.149352, 0.70692, 0.707293, -1.31317e-012, },
+	{ -0.153143, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.14546, 0.0418797, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.14546, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.14546, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.14546, 0.0418797, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.139973, 0.0521567, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.14546, 0.0418797, -0.149352, 0.830379, -0.557199, 1.0345e-012, },
+	{ -0.139973, 0.0521567, -0.179352, 0.925933, -0.377687, 7.01219e-013, },
+	{ -0.139973, 0.0521567, -0.149352, 0.925933, -0.377687, 7.01219e-013, },
+	{ -0.139973, 0.0521567, -0.179352, 0.925933, -0.377687, 7.01219e-013, },
+	{ -0.14546, 0.0418797, -0.149352, 0.830379, -0.557199, 1.0345e-012, },
+	{ -0.14546, 0.0418797, -0.179352, 0.830379, -0.557199, 1.0345e-012, },
+	{ -0.14546, 0.0418797, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.139973, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.139973, 0.0521567, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.14546, 0.0418797, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.14546, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.139973, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.14546, 0.109528, -0.179352, 0.830379, 0.557199, -1.0345e-012, },
+	{ -0.139973, 0.0992512, -0.149352, 0.925933, 0.377687, -7.01219e-013, },
+	{ -0.139973, 0.0992512, -0.179352, 0.925933, 0.377687, -7.01219e-013, },
+	{ -0.139973, 0.0992512, -0.149352, 0.925933, 0.377687, -7.01219e-013, },
+	{ -0.14546, 0.109528, -0.179352, 0.830379, 0.557199, -1.0345e-012, },
+	{ -0.14546, 0.109528, -0.149352, 0.830379, 0.557199, -1.0345e-012, },
+	{ -0.14546, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.139973, 0.0521567, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.139973, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.139973, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.139973, 0.0521567, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.13668, 0.0634315, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.139973, 0.0521567, -0.149352, 0.925933, -0.377687, 7.01219e-013, },
+	{ -0.13668, 0.0634315, -0.179352, 0.982629, -0.185582, 3.44553e-013, },
+	{ -0.13668, 0.0634315, -0.149352, 0.982629, -0.185582, 3.44553e-013, },
+	{ -0.13668, 0.0634315, -0.179352, 0.982629, -0.185582, 3.44553e-013, },
+	{ -0.139973, 0.0521567, -0.149352, 0.925933, -0.377687, 7.01219e-013, },
+	{ -0.139973, 0.0521567, -0.179352, 0.925933, -0.377687, 7.01219e-013, },
+	{ -0.139973, 0.0521567, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.13668, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.13668, 0.0634315, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.139973, 0.0521567, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.139973, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.13668, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.139973, 0.0992512, -0.179352, 0.925933, 0.377687, -7.01219e-013, },
+	{ -0.13668, 0.0879765, -0.149352, 0.982629, 0.185582, -3.44553e-013, },
+	{ -0.13668, 0.0879765, -0.179352, 0.982629, 0.185582, -3.44553e-013, },
+	{ -0.13668, 0.0879765, -0.149352, 0.982629, 0.185582, -3.44553e-013, },
+	{ -0.139973, 0.0992512, -0.179352, 0.925933, 0.377687, -7.01219e-013, },
+	{ -0.139973, 0.0992512, -0.149352, 0.925933, 0.377687, -7.01219e-013, },
+	{ -0.139973, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.13668, 0.0634315, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.13668, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.13668, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.13668, 0.0634315, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.135582, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.13668, 0.0634315, -0.149352, 0.982629, -0.185582, 3.44553e-013, },
+	{ -0.135582, 0.075704, -0.179352, 1, -1.67198e-016, 3.10422e-028, },
+	{ -0.135582, 0.075704, -0.149352, 1, -1.67198e-016, 3.10422e-028, },
+	{ -0.135582, 0.075704, -0.179352, 1, -1.67198e-016, 3.10422e-028, },
+	{ -0.13668, 0.0634315, -0.149352, 0.982629, -0.185582, 3.44553e-013, },
+	{ -0.13668, 0.0634315, -0.179352, 0.982629, -0.185582, 3.44553e-013, },
+	{ -0.13668, 0.0634315, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.13668, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.135582, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.13668, 0.0879765, -0.179352, 0.982629, 0.185582, -3.44553e-013, },
+	{ -0.135582, 0.075704, -0.149352, 1, -1.67198e-016, 3.10422e-028, },
+	{ -0.135582, 0.075704, -0.179352, 1, -1.67198e-016, 3.10422e-028, },
+	{ -0.135582, 0.075704, -0.149352, 1, -1.67198e-016, 3.10422e-028, },
+	{ -0.13668, 0.0879765, -0.179352, 0.982629, 0.185582, -3.44553e-013, },
+	{ -0.13668, 0.0879765, -0.149352, 0.982629, 0.185582, -3.44553e-013, },
+	{ -0.174216, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.184064, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.195543, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.184064, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.174216, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.174216, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
+	{ -0.195543, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
+	{ -0.195543, 0.154734, -0.149352, -0.0937744, 0.995593, -1.84843e-012, },
+	{ -0.195543, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
+	{ -0.174216, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
+	{ -0.174216, 0.155685, -0.179352, 3.90799e-005, 1, -1.85661e-012, },
+	{ -0.174216, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
+	{ -0.152926, 0.154734, -0.179352, 0.093929, 0.995579, -1.8484e-012, },
+	{ -0.174216, 0.155685, -0.179352, 3.90799e-005, 1, -1.85661e-012, },
+	{ -0.152926, 0.154734, -0.179352, 0.093929, 0.995579, -1.8484e-012, },
+	{ -0.174216, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
+	{ -0.152926, 0.154734, -0.149352, 0.093929, 0.995579, -1.8484e-012, },
+	{ -0.174216, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.14119, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.152926, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.174216, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.174376, 0.13541, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.14119, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.174216, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.182425, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.174376, 0.13541, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.174376, 0.13541, -0.179352, 8.00648e-005, -1, 1.85651e-012, },
+	{ -0.14119, 0.132876, -0.149352, -0.1704, -0.985375, 1.82946e-012, },
+	{ -0.174376, 0.13541, -0.149352, 8.00648e-005, -1, 1.85651e-012, },
+	{ -0.14119, 0.132876, -0.149352, -0.1704, -0.985375, 1.82946e-012, },
+	{ -0.174376, 0.13541, -0.179352, 8.00648e-005, -1, 1.85651e-012, },
+	{ -0.14119, 0.132876, -0.179352, -0.1704, -0.985375, 1.82946e-012, },
+	{ -0.174376, 0.13541, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.174216, 0.155685, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.14119, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.174376, 0.13541, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.195543, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.174216, 0.155685, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.14119, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.174216, 0.155685, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.152926, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.14119, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.152926, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.133198, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.152926, 0.154734, -0.149352, 0.093929, 0.995579, -1.8484e-012, },
+	{ -0.133198, 0.151883, -0.179352, 0.198356, 0.98013, -1.81972e-012, },
+	{ -0.152926, 0.154734, -0.179352, 0.093929, 0.995579, -1.8484e-012, },
+	{ -0.133198, 0.151883, -0.179352, 0.198356, 0.98013, -1.81972e-012, },
+	{ -0.152926, 0.154734, -0.149352, 0.093929, 0.995579, -1.8484e-012, },
+	{ -0.133198, 0.151883, -0.149352, 0.198356, 0.98013, -1.81972e-012, },
+	{ -0.152926, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.14119, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.133198, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.133198, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.14119, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.113312, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.14119, 0.132876, -0.179352, -0.1704, -0.985375, 1.82946e-012, },
+	{ -0.113312, 0.125273, -0.149352, -0.379191, -0.925318, 1.71796e-012, },
+	{ -0.14119, 0.132876, -0.149352, -0.1704, -0.985375, 1.82946e-012, },
+	{ -0.113312, 0.125273, -0.149352, -0.379191, -0.925318, 1.71796e-012, },
+	{ -0.14119, 0.132876, -0.179352, -0.1704, -0.985375, 1.82946e-012, },
+	{ -0.113312, 0.125273, -0.179352, -0.379191, -0.925318, 1.71796e-012, },
+	{ -0.14119, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.133198, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.113312, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.113312, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.133198, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.115031, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.133198, 0.151883, -0.149352, 0.198356, 0.98013, -1.81972e-012, },
+	{ -0.115031, 0.147131, -0.179352, 0.313088, 0.949724, -1.76327e-012, },
+	{ -0.133198, 0.151883, -0.179352, 0.198356, 0.98013, -1.81972e-012, },
+	{ -0.115031, 0.147131, -0.179352, 0.313088, 0.949724, -1.76327e-012, },
+	{ -0.133198, 0.151883, -0.149352, 0.198356, 0.98013, -1.81972e-012, },
+	{ -0.115031, 0.147131, -0.149352, 0.313088, 0.949724, -1.76327e-012, },
+	{ -0.133198, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.113312, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.115031, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.115031, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.113312, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0984257, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0984257, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.113312, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0907429, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.113312, 0.125273, -0.179352, -0.379191, -0.925318, 1.71796e-012, },
+	{ -0.0907429, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
+	{ -0.113312, 0.125273, -0.149352, -0.379191, -0.925318, 1.71796e-012, },
+	{ -0.0907429, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
+	{ -0.113312, 0.125273, -0.179352, -0.379191, -0.925318, 1.71796e-012, },
+	{ -0.0907429, 0.112601, -0.179352, -0.609426, -0.792843, 1.472e-012, },
+	{ -0.113312, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0984257, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0907429, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.113312, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.115031, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0984257, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.115031, 0.147131, -0.149352, 0.313088, 0.949724, -1.76327e-012, },
+	{ -0.0984257, 0.140479, -0.179352, 0.43408, 0.900874, -1.67257e-012, },
+	{ -0.115031, 0.147131, -0.179352, 0.313088, 0.949724, -1.76327e-012, },
+	{ -0.0984257, 0.140479, -0.179352, 0.43408, 0.900874, -1.67257e-012, },
+	{ -0.115031, 0.147131, -0.149352, 0.313088, 0.949724, -1.76327e-012, },
+	{ -0.0984257, 0.140479, -0.149352, 0.43408, 0.900874, -1.67257e-012, },
+	{ -0.0984257, 0.140479, -0.149352, 0.43408, 0.900874, -1.67257e-012, },
+	{ -0.0833819, 0.131926, -0.179352, 0.554922, 0.831902, -1.54452e-012, },
+	{ -0.0984257, 0.140479, -0.179352, 0.43408, 0.900874, -1.67257e-012, },
+	{ -0.0833819, 0.131926, -0.179352, 0.554922, 0.831902, -1.54452e-012, },
+	{ -0.0984257, 0.140479, -0.149352, 0.43408, 0.900874, -1.67257e-012, },
+	{ -0.0833819, 0.131926, -0.149352, 0.554922, 0.831902, -1.54452e-012, },
+	{ -0.0984257, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0907429, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0833819, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0833819, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0907429, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0734815, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0907429, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
+	{ -0.0734815, 0.0948611, -0.179352, -0.716715, -0.697366, 1.29474e-012, },
+	{ -0.0734815, 0.0948611, -0.149352, -0.716715, -0.697366, 1.29474e-012, },
+	{ -0.0734815, 0.0948611, -0.179352, -0.716715, -0.697366, 1.29474e-012, },
+	{ -0.0907429, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
+	{ -0.0907429, 0.112601, -0.179352, -0.609426, -0.792843, 1.472e-012, },
+	{ -0.0907429, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0833819, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0734815, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0907429, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0984257, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0833819, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0734815, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0833819, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0698996, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0833819, 0.131926, -0.149352, 0.554922, 0.831902, -1.54452e-012, },
+	{ -0.0698996, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
+	{ -0.0833819, 0.131926, -0.179352, 0.554922, 0.831902, -1.54452e-012, },
+	{ -0.0698996, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
+	{ -0.0833819, 0.131926, -0.149352, 0.554922, 0.831902, -1.54452e-012, },
+	{ -0.0698996, 0.121471, -0.149352, 0.667924, 0.74423, -1.38175e-012, },
+	{ -0.0833819, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0734815, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0698996, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0698996, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0734815, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0476195, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0734815, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
+	{ -0.0476195, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ -0.0734815, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ -0.0476195, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ -0.0734815, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
+	{ -0.0476195, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
+	{ -0.0734815, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0698996, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0476195, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0476195, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0698996, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0579788, 0.109117, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0698996, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
+	{ -0.0579788, 0.109117, -0.149352, 0.766151, 0.642661, -1.19317e-012, },
+	{ -0.0579788, 0.109117, -0.179352, 0.766151, 0.642661, -1.19317e-012, },
+	{ -0.0579788, 0.109117, -0.149352, 0.766151, 0.642661, -1.19317e-012, },
+	{ -0.0698996, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
+	{ -0.0698996, 0.121471, -0.149352, 0.667924, 0.74423, -1.38175e-012, },
+	{ -0.0698996, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0476195, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0579788, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0476195, 0.0948611, -0.149352, 0.808963, 0.58786, -1.09143e-012, },
+	{ -0.0579788, 0.109117, -0.179352, 0.766151, 0.642661, -1.19317e-012, },
+	{ -0.0579788, 0.109117, -0.149352, 0.766151, 0.642661, -1.19317e-012, },
+	{ -0.0579788, 0.109117, -0.179352, 0.766151, 0.642661, -1.19317e-012, },
+	{ -0.0476195, 0.0948611, -0.149352, 0.808963, 0.58786, -1.09143e-012, },
+	{ -0.0476195, 0.0948611, -0.179352, 0.808963, 0.58786, -1.09143e-012, },
+	{ -0.250126, 0.140479, -0.179352, -0.433645, 0.901084, -1.67296e-012, },
+	{ -0.265187, 0.131926, -0.149352, -0.554528, 0.832165, -1.54501e-012, },
+	{ -0.250126, 0.140479, -0.149352, -0.433645, 0.901084, -1.67296e-012, },
+	{ -0.265187, 0.131926, -0.149352, -0.554528, 0.832165, -1.54501e-012, },
+	{ -0.250126, 0.140479, -0.179352, -0.433645, 0.901084, -1.67296e-012, },
+	{ -0.265187, 0.131926, -0.179352, -0.554528, 0.832165, -1.54501e-012, },
+	{ -0.118022, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.133522, -0.126451, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.143884, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.133522, -0.126451, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.118022, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.121594, -0.138806, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.121594, -0.138806, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.118022, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.108099, -0.14926, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.108099, -0.14926, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.118022, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.10077, -0.129935, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.118022, -0.112195, -0.179352, 0.716917, 0.697159, -1.29435e-012, },
+	{ -0.10077, -0.129935, -0.149352, 0.609765, 0.792582, -1.47152e-012, },
+	{ -0.10077, -0.129935, -0.179352, 0.609765, 0.792582, -1.47152e-012, },
+	{ -0.10077, -0.129935, -0.149352, 0.609765, 0.792582, -1.47152e-012, },
+	{ -0.118022, -0.112195, -0.179352, 0.716917, 0.697159, -1.29435e-012, },
+	{ -0.118022, -0.112195, -0.149352, 0.716917, 0.697159, -1.29435e-012, },
+	{ -0.118022, -0.112195, -0.179352, 0, 1, -1.85661e-012, },
+	{ -0.143884, -0.112195, -0.149352, 0, 1, -1.85661e-012, },
+	{ -0.118022, -0.112195, -0.149352, 0, 1, -1.85661e-012, },
+	{ -0.143884, -0.112195, -0.149352, 0, 1, -1.85661e-012, },
+	{ -0.118022, -0.112195, -0.179352, 0, 1, -1.85661e-012, },
+	{ -0.143884, -0.112195, -0.179352, 0, 1, -1.85661e-012, },
+	{ -0.133522, -0.126451, -0.179352, -0.766013, -0.642825, 1.19348e-012, },
+	{ -0.143884, -0.112195, -0.149352, -0.808895, -0.587953, 1.0916e-012, },
+	{ -0.143884, -0.112195, -0.179352, -0.808895, -0.587953, 1.0916e-012, },
+	{ -0.143884, -0.112195, -0.149352, -0.808895, -0.587953, 1.0916e-012, },
+	{ -0.133522, -0.126451, -0.179352, -0.766013, -0.642825, 1.19348e-012, },
+	{ -0.133522, -0.126451, -0.149352, -0.766013, -0.642825, 1.19348e-012, },
+	{ -0.121594, -0.138806, -0.179352, -0.66764, -0.744484, 1.38222e-012, },
+	{ -0.133522, -0.126451, -0.149352, -0.766013, -0.642825, 1.19348e-012, },
+	{ -0.133522, -0.126451, -0.179352, -0.766013, -0.642825, 1.19348e-012, },
+	{ -0.133522, -0.126451, -0.149352, -0.766013, -0.642825, 1.19348e-012, },
+	{ -0.121594, -0.138806, -0.179352, -0.66764, -0.744484, 1.38222e-012, },
+	{ -0.121594, -0.138806, -0.149352, -0.66764, -0.744484, 1.38222e-012, },
+	{ -0.121594, -0.138806, -0.179352, -0.66764, -0.744484, 1.38222e-012, },
+	{ -0.108099, -0.14926, -0.149352, -0.554528, -0.832165, 1.54501e-012, },
+	{ -0.121594, -0.138806, -0.149352, -0.66764, -0.744484, 1.38222e-012, },
+	{ -0.108099, -0.14926, -0.149352, -0.554528, -0.832165, 1.54501e-012, },
+	{ -0.121594, -0.138806, -0.179352, -0.66764, -0.744484, 1.38222e-012, },
+	{ -0.108099, -0.14926, -0.179352, -0.554528, -0.832165, 1.54501e-012, },
+	{ -0.108099, -0.14926, -0.179352, -0.554528, -0.832165, 1.54501e-012, },
+	{ -0.0930377, -0.157813, -0.149352, -0.433645, -0.901084, 1.67296e-012, },
+	{ -0.108099, -0.14926, -0.149352, -0.554528, -0.832165, 1.54501e-012, },
+	{ -0.0930377, -0.157813, -0.149352, -0.433645, -0.901084, 1.67296e-012, },
+	{ -0.108099, -0.14926, -0.179352, -0.554528, -0.832165, 1.54501e-012, },
+	{ -0.0930377, -0.157813, -0.179352, -0.433645, -0.901084, 1.67296e-012, },
+	{ -0.108099, -0.14926, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.10077, -0.129935, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0930377, -0.157813, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0930377, -0.157813, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.10077, -0.129935, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0782309, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.10077, -0.129935, -0.149352, 0.609765, 0.792582, -1.47152e-012, },
+	{ -0.0782309, -0.142607, -0.179352, 0.379664, 0.925125, -1.7176e-012, },
+	{ -0.10077, -0.129935, -0.179352, 0.609765, 0.792582, -1.47152e-012, },
+	{ -0.0782309, -0.142607, -0.179352, 0.379664, 0.925125, -1.7176e-012, },
+	{ -0.10077, -0.129935, -0.149352, 0.609765, 0.792582, -1.47152e-012, },
+	{ -0.0782309, -0.142607, -0.149352, 0.379664, 0.925125, -1.7176e-012, },
+	{ -0.10077, -0.129935, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0930377, -0.157813, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0782309, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.10077, -0.129935, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.108099, -0.14926, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0930377, -0.157813, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.118022, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.108099, -0.14926, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.10077, -0.129935, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.118022, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.121594, -0.138806, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.108099, -0.14926, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.118022, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.133522, -0.126451, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.121594, -0.138806, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.133522, -0.126451, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.118022, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.143884, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0782309, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0930377, -0.157813, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.07641, -0.164466, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0930377, -0.157813, -0.179352, -0.433645, -0.901084, 1.67296e-012, },
+	{ -0.07641, -0.164466, -0.149352, -0.312692, -0.949855, 1.76351e-012, },
+	{ -0.0930377, -0.157813, -0.149352, -0.433645, -0.901084, 1.67296e-012, },
+	{ -0.07641, -0.164466, -0.149352, -0.312692, -0.949855, 1.76351e-012, },
+	{ -0.0930377, -0.157813, -0.179352, -0.433645, -0.901084, 1.67296e-012, },
+	{ -0.07641, -0.164466, -0.179352, -0.312692, -0.949855, 1.76351e-012, },
+	{ -0.0930377, -0.157813, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0782309, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.07641, -0.164466, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.07641, -0.164466, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0782309, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0504032, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0782309, -0.142607, -0.149352, 0.379664, 0.925125, -1.7176e-012, },
+	{ -0.0504032, -0.15021, -0.179352, 0.170704, 0.985322, -1.82936e-012, },
+	{ -0.0782309, -0.142607, -0.179352, 0.379664, 0.925125, -1.7176e-012, },
+	{ -0.0504032, -0.15021, -0.179352, 0.170704, 0.985322, -1.82936e-012, },
+	{ -0.0782309, -0.142607, -0.149352, 0.379664, 0.925125, -1.7176e-012, },
+	{ -0.0504032, -0.15021, -0.149352, 0.170704, 0.985322, -1.82936e-012, },
+	{ -0.0782309, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.07641, -0.164466, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0504032, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0504032, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.07641, -0.164466, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0582157, -0.169217, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.07641, -0.164466, -0.179352, -0.312692, -0.949855, 1.76351e-012, },
+	{ -0.0582157, -0.169217, -0.149352, -0.198062, -0.98019, 1.81983e-012, },
+	{ -0.07641, -0.164466, -0.149352, -0.312692, -0.949855, 1.76351e-012, },
+	{ -0.0582157, -0.169217, -0.149352, -0.198062, -0.98019, 1.81983e-012, },
+	{ -0.07641, -0.164466, -0.179352, -0.312692, -0.949855, 1.76351e-012, },
+	{ -0.0582157, -0.169217, -0.179352, -0.198062, -0.98019, 1.81983e-012, },
+	{ -0.07641, -0.164466, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0504032, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0582157, -0.169217, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0582157, -0.169217, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0504032, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.038455, -0.172069, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.038455, -0.172069, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0504032, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0172874, -0.152744, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0504032, -0.15021, -0.149352, 0.170704, 0.985322, -1.82936e-012, },
+	{ -0.0172874, -0.152744, -0.179352, 8.00648e-005, 1, -1.85661e-012, },
+	{ -0.0504032, -0.15021, -0.179352, 0.170704, 0.985322, -1.82936e-012, },
+	{ -0.0172874, -0.152744, -0.179352, 8.00648e-005, 1, -1.85661e-012, },
+	{ -0.0504032, -0.15021, -0.149352, 0.170704, 0.985322, -1.82936e-012, },
+	{ -0.0172874, -0.152744, -0.149352, 8.00648e-005, 1, -1.85661e-012, },
+	{ -0.0504032, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.038455, -0.172069, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0172874, -0.152744, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0504032, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0582157, -0.169217, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.038455, -0.172069, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0582157, -0.169217, -0.179352, -0.198062, -0.98019, 1.81983e-012, },
+	{ -0.038455, -0.172069, -0.149352, -0.0937744, -0.995593, 1.84843e-012, },
+	{ -0.0582157, -0.169217, -0.149352, -0.198062, -0.98019, 1.81983e-012, },
+	{ -0.038455, -0.172069, -0.149352, -0.0937744, -0.995593, 1.84843e-012, },
+	{ -0.0582157, -0.169217, -0.179352, -0.198062, -0.98019, 1.81983e-012, },
+	{ -0.038455, -0.172069, -0.179352, -0.0937744, -0.995593, 1.84843e-012, },
+	{ -0.038455, -0.172069, -0.179352, -0.0937744, -0.995593, 1.84843e-012, },
+	{ -0.0171278, -0.173019, -0.149352, 3.90799e-005, -1, 1.85661e-012, },
+	{ -0.038455, -0.172069, -0.149352, -0.0937744, -0.995593, 1.84843e-012, },
+	{ -0.0171278, -0.173019, -0.149352, 3.90799e-005, -1, 1.85661e-012, },
+	{ -0.038455, -0.172069, -0.179352, -0.0937744, -0.995593, 1.84843e-012, },
+	{ -0.0171278, -0.173019, -0.179352, 3.90799e-005, -1, 1.85661e-012, },
+	{ -0.038455, -0.172069, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0172874, -0.152744, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0171278, -0.173019, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0171278, -0.173019, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0172874, -0.152744, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0158982, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0172874, -0.152744, -0.149352, 8.00648e-005, 1, -1.85661e-012, },
+	{ 0.0158982, -0.15021, -0.179352, -0.1704, 0.985375, -1.82946e-012, },
+	{ -0.0172874, -0.152744, -0.179352, 8.00648e-005, 1, -1.85661e-012, },
+	{ 0.0158982, -0.15021, -0.179352, -0.1704, 0.985375, -1.82946e-012, },
+	{ -0.0172874, -0.152744, -0.149352, 8.00648e-005, 1, -1.85661e-012, },
+	{ 0.0158982, -0.15021, -0.149352, -0.1704, 0.985375, -1.82946e-012, },
+	{ -0.0172874, -0.152744, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0171278, -0.173019, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0158982, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0172874, -0.152744, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.038455, -0.172069, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0171278, -0.173019, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0158982, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0171278, -0.173019, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.00416204, -0.172069, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0171278, -0.173019, -0.179352, 3.90799e-005, -1, 1.85661e-012, },
+	{ 0.00416204, -0.172069, -0.149352, 0.093929, -0.995579, 1.8484e-012, },
+	{ -0.0171278, -0.173019, -0.149352, 3.90799e-005, -1, 1.85661e-012, },
+	{ 0.00416204, -0.172069, -0.149352, 0.093929, -0.995579, 1.8484e-012, },
+	{ -0.0171278, -0.173019, -0.179352, 3.90799e-005, -1, 1.85661e-012, },
+	{ 0.00416204, -0.172069, -0.179352, 0.093929, -0.995579, 1.8484e-012, },
+	{ -0.0171278, -0.173019, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0158982, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.00416204, -0.172069, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.00416204, -0.172069, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0158982, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0238903, -0.169217, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0238903, -0.169217, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0158982, -0.15021, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0437758, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0158982, -0.15021, -0.149352, -0.1704, 0.985375, -1.82946e-012, },
+	{ 0.0437758, -0.142607, -0.179352, -0.379191, 0.925318, -1.71796e-012, },
+	{ 0.0158982, -0.15021, -0.179352, -0.1704, 0.985375, -1.82946e-012, },
+	{ 0.0437758, -0.142607, -0.179352, -0.379191, 0.925318, -1.71796e-012, },
+	{ 0.0158982, -0.15021, -0.149352, -0.1704, 0.985375, -1.82946e-012, },
+	{ 0.0437758, -0.142607, -0.149352, -0.379191, 0.925318, -1.71796e-012, },
+	{ 0.0158982, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0238903, -0.169217, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0437758, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0158982, -0.15021, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.00416204, -0.172069, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0238903, -0.169217, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.00416204, -0.172069, -0.179352, 0.093929, -0.995579, 1.8484e-012, },
+	{ 0.0238903, -0.169217, -0.149352, 0.198356, -0.98013, 1.81972e-012, },
+	{ 0.00416204, -0.172069, -0.149352, 0.093929, -0.995579, 1.8484e-012, },
+	{ 0.0238903, -0.169217, -0.149352, 0.198356, -0.98013, 1.81972e-012, },
+	{ 0.00416204, -0.172069, -0.179352, 0.093929, -0.995579, 1.8484e-012, },
+	{ 0.0238903, -0.169217, -0.179352, 0.198356, -0.98013, 1.81972e-012, },
+	{ 0.0238903, -0.169217, -0.179352, 0.198356, -0.98013, 1.81972e-012, },
+	{ 0.0420572, -0.164466, -0.149352, 0.313088, -0.949724, 1.76327e-012, },
+	{ 0.0238903, -0.169217, -0.149352, 0.198356, -0.98013, 1.81972e-012, },
+	{ 0.0420572, -0.164466, -0.149352, 0.313088, -0.949724, 1.76327e-012, },
+	{ 0.0238903, -0.169217, -0.179352, 0.198356, -0.98013, 1.81972e-012, },
+	{ 0.0420572, -0.164466, -0.179352, 0.313088, -0.949724, 1.76327e-012, },
+	{ 0.0238903, -0.169217, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0437758, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0420572, -0.164466, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0420572, -0.164466, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0437758, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0586625, -0.157813, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0586625, -0.157813, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0437758, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0663452, -0.129935, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0437758, -0.142607, -0.149352, -0.379191, 0.925318, -1.71796e-012, },
+	{ 0.0663452, -0.129935, -0.179352, -0.609426, 0.792843, -1.472e-012, },
+	{ 0.0437758, -0.142607, -0.179352, -0.379191, 0.925318, -1.71796e-012, },
+	{ 0.0663452, -0.129935, -0.179352, -0.609426, 0.792843, -1.472e-012, },
+	{ 0.0437758, -0.142607, -0.149352, -0.379191, 0.925318, -1.71796e-012, },
+	{ 0.0663452, -0.129935, -0.149352, -0.609426, 0.792843, -1.472e-012, },
+	{ 0.0437758, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0586625, -0.157813, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0663452, -0.129935, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0437758, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0420572, -0.164466, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0586625, -0.157813, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0437758, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0238903, -0.169217, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0420572, -0.164466, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0420572, -0.164466, -0.179352, 0.313088, -0.949724, 1.76327e-012, },
+	{ 0.0586625, -0.157813, -0.149352, 0.43408, -0.900874, 1.67257e-012, },
+	{ 0.0420572, -0.164466, -0.149352, 0.313088, -0.949724, 1.76327e-012, },
+	{ 0.0586625, -0.157813, -0.149352, 0.43408, -0.900874, 1.67257e-012, },
+	{ 0.0420572, -0.164466, -0.179352, 0.313088, -0.949724, 1.76327e-012, },
+	{ 0.0586625, -0.157813, -0.179352, 0.43408, -0.900874, 1.67257e-012, },
+	{ 0.0586625, -0.157813, -0.179352, 0.43408, -0.900874, 1.67257e-012, },
+	{ 0.0737063, -0.14926, -0.149352, 0.554922, -0.831902, 1.54452e-012, },
+	{ 0.0586625, -0.157813, -0.149352, 0.43408, -0.900874, 1.67257e-012, },
+	{ 0.0737063, -0.14926, -0.149352, 0.554922, -0.831902, 1.54452e-012, },
+	{ 0.0586625, -0.157813, -0.179352, 0.43408, -0.900874, 1.67257e-012, },
+	{ 0.0737063, -0.14926, -0.179352, 0.554922, -0.831902, 1.54452e-012, },
+	{ 0.0586625, -0.157813, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0663452, -0.129935, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0737063, -0.14926, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0737063, -0.14926, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0663452, -0.129935, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0836066, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0663452, -0.129935, -0.179352, -0.609426, 0.792843, -1.472e-012, },
+	{ 0.0836066, -0.112195, -0.149352, -0.716715, 0.697366, -1.29474e-012, },
+	{ 0.0836066, -0.112195, -0.179352, -0.716715, 0.697366, -1.29474e-012, },
+	{ 0.0836066, -0.112195, -0.149352, -0.716715, 0.697366, -1.29474e-012, },
+	{ 0.0663452, -0.129935, -0.179352, -0.609426, 0.792843, -1.472e-012, },
+	{ 0.0663452, -0.129935, -0.149352, -0.609426, 0.792843, -1.472e-012, },
+	{ 0.0663452, -0.129935, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0737063, -0.14926, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0836066, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0663452, -0.129935, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0586625, -0.157813, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0737063, -0.14926, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0836066, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0737063, -0.14926, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0871886, -0.138806, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0737063, -0.14926, -0.179352, 0.554922, -0.831902, 1.54452e-012, },
+	{ 0.0871886, -0.138806, -0.149352, 0.667924, -0.74423, 1.38175e-012, },
+	{ 0.0737063, -0.14926, -0.149352, 0.554922, -0.831902, 1.54452e-012, },
+	{ 0.0871886, -0.138806, -0.149352, 0.667924, -0.74423, 1.38175e-012, },
+	{ 0.0737063, -0.14926, -0.179352, 0.554922, -0.831902, 1.54452e-012, },
+	{ 0.0871886, -0.138806, -0.179352, 0.667924, -0.74423, 1.38175e-012, },
+	{ 0.0737063, -0.14926, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0836066, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0871886, -0.138806, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0871886, -0.138806, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0836066, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.109469, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0836066, -0.112195, -0.149352, 0, 1, -1.85661e-012, },
+	{ 0.109469, -0.112195, -0.179352, 0, 1, -1.85661e-012, },
+	{ 0.0836066, -0.112195, -0.179352, 0, 1, -1.85661e-012, },
+	{ 0.109469, -0.112195, -0.179352, 0, 1, -1.85661e-012, },
+	{ 0.0836066, -0.112195, -0.149352, 0, 1, -1.85661e-012, },
+	{ 0.109469, -0.112195, -0.149352, 0, 1, -1.85661e-012, },
+	{ 0.0836066, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0871886, -0.138806, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.109469, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.109469, -0.112195, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0871886, -0.138806, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0991094, -0.126451, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0871886, -0.138806, -0.149352, 0.667924, -0.74423, 1.38175e-012, },
+	{ 0.0991094, -0.126451, -0.179352, 0.766151, -0.642661, 1.19317e-012, },
+	{ 0.0991094, -0.126451, -0.149352, 0.766151, -0.642661, 1.19317e-012, },
+	{ 0.0991094, -0.126451, -0.179352, 0.766151, -0.642661, 1.19317e-012, },
+	{ 0.0871886, -0.138806, -0.149352, 0.667924, -0.74423, 1.38175e-012, },
+	{ 0.0871886, -0.138806, -0.179352, 0.667924, -0.74423, 1.38175e-012, },
+	{ 0.0871886, -0.138806, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.109469, -0.112195, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0991094, -0.126451, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.109469, -0.112195, -0.179352, 0.808963, -0.58786, 1.09143e-012, },
+	{ 0.0991094, -0.126451, -0.149352, 0.766151, -0.642661, 1.19317e-012, },
+	{ 0.0991094, -0.126451, -0.179352, 0.766151, -0.642661, 1.19317e-012, },
+	{ 0.0991094, -0.126451, -0.149352, 0.766151, -0.642661, 1.19317e-012, },
+	{ 0.109469, -0.112195, -0.179352, 0.808963, -0.58786, 1.09143e-012, },
+	{ 0.109469, -0.112195, -0.149352, 0.808963, -0.58786, 1.09143e-012, },
+	{ 0.0574252, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0274125, 0.0509594, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0274125, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0274125, 0.0509594, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0574252, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.041461, 0.0509594, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.041461, 0.0509594, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0574252, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0539031, 0.0496224, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0539031, 0.0496224, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0574252, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0574252, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0574252, 0.142913, -0.179352, 1, 0, -0, },
+	{ 0.0574252, 0.075704, -0.149352, 1, 0, -0, },
+	{ 0.0574252, 0.075704, -0.179352, 1, 0, -0, },
+	{ 0.0574252, 0.075704, -0.149352, 1, 0, -0, },
+	{ 0.0574252, 0.142913, -0.179352, 1, 0, -0, },
+	{ 0.0574252, 0.142913, -0.149352, 1, 0, -0, },
+	{ 0.0574252, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
+	{ 0.0274125, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
+	{ 0.0574252, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
+	{ 0.0274125, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
+	{ 0.0574252, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
+	{ 0.0274125, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
+	{ 0.0274125, 0.0509594, -0.179352, -1, 0, -0, },
+	{ 0.0274125, 0.142913, -0.149352, -1, 0, -0, },
+	{ 0.0274125, 0.142913, -0.179352, -1, 0, -0, },
+	{ 0.0274125, 0.142913, -0.149352, -1, 0, -0, },
+	{ 0.0274125, 0.0509594, -0.179352, -1, 0, -0, },
+	{ 0.0274125, 0.0509594, -0.149352, -1, 0, -0, },
+	{ 0.0274125, 0.0509594, -0.179352, 0, -1, 1.85661e-012, },
+	{ 0.041461, 0.0509594, -0.149352, -0.053498, -0.998568, 1.85395e-012, },
+	{ 0.0274125, 0.0509594, -0.149352, 0, -1, 1.85661e-012, },
+	{ 0.041461, 0.0509594, -0.149352, -0.053498, -0.998568, 1.85395e-012, },
+	{ 0.0274125, 0.0509594, -0.179352, 0, -1, 1.85661e-012, },
+	{ 0.041461, 0.0509594, -0.179352, -0.053498, -0.998568, 1.85395e-012, },
+	{ 0.041461, 0.0509594, -0.179352, -0.053498, -0.998568, 1.85395e-012, },
+	{ 0.0539031, 0.0496224, -0.149352, -0.228889, -0.973452, 1.80732e-012, },
+	{ 0.041461, 0.0509594, -0.149352, -0.053498, -0.998568, 1.85395e-012, },
+	{ 0.0539031, 0.0496224, -0.149352, -0.228889, -0.973452, 1.80732e-012, },
+	{ 0.041461, 0.0509594, -0.179352, -0.053498, -0.998568, 1.85395e-012, },
+	{ 0.0539031, 0.0496224, -0.179352, -0.228889, -0.973452, 1.80732e-012, },
+	{ 0.0539031, 0.0496224, -0.179352, -0.228889, -0.973452, 1.80732e-012, },
+	{ 0.0647289, 0.0456114, -0.149352, -0.471825, -0.881692, 1.63696e-012, },
+	{ 0.0539031, 0.0496224, -0.149352, -0.228889, -0.973452, 1.80732e-012, },
+	{ 0.0647289, 0.0456114, -0.149352, -0.471825, -0.881692, 1.63696e-012, },
+	{ 0.0539031, 0.0496224, -0.179352, -0.228889, -0.973452, 1.80732e-012, },
+	{ 0.0647289, 0.0456114, -0.179352, -0.471825, -0.881692, 1.63696e-012, },
+	{ 0.0539031, 0.0496224, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0574252, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0647289, 0.0456114, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0647289, 0.0456114, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0574252, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0725713, 0.0717329, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0574252, 0.075704, -0.149352, 0.253615, 0.967305, -1.79591e-012, },
+	{ 0.0725713, 0.0717329, -0.179352, 0.346952, 0.937883, -1.74128e-012, },
+	{ 0.0574252, 0.075704, -0.179352, 0.253615, 0.967305, -1.79591e-012, },
+	{ 0.0725713, 0.0717329, -0.179352, 0.346952, 0.937883, -1.74128e-012, },
+	{ 0.0574252, 0.075704, -0.149352, 0.253615, 0.967305, -1.79591e-012, },
+	{ 0.0725713, 0.0717329, -0.149352, 0.346952, 0.937883, -1.74128e-012, },
+	{ 0.0574252, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0647289, 0.0456114, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0725713, 0.0717329, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0647289, 0.0456114, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0574252, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0539031, 0.0496224, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0574252, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0539031, 0.0496224, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0574252, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0574252, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.041461, 0.0509594, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0539031, 0.0496224, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0274125, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.041461, 0.0509594, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0574252, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.041461, 0.0509594, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0274125, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0274125, 0.0509594, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0725713, 0.0717329, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0647289, 0.0456114, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0739382, 0.0389264, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0647289, 0.0456114, -0.179352, -0.471825, -0.881692, 1.63696e-012, },
+	{ 0.0739382, 0.0389264, -0.149352, -0.687868, -0.725835, 1.34759e-012, },
+	{ 0.0647289, 0.0456114, -0.149352, -0.471825, -0.881692, 1.63696e-012, },
+	{ 0.0739382, 0.0389264, -0.149352, -0.687868, -0.725835, 1.34759e-012, },
+	{ 0.0647289, 0.0456114, -0.179352, -0.471825, -0.881692, 1.63696e-012, },
+	{ 0.0739382, 0.0389264, -0.179352, -0.687868, -0.725835, 1.34759e-012, },
+	{ 0.0647289, 0.0456114, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0725713, 0.0717329, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0739382, 0.0389264, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0739382, 0.0389264, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0725713, 0.0717329, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0859214, 0.0652474, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0725713, 0.0717329, -0.149352, 0.346952, 0.937883, -1.74128e-012, },
+	{ 0.0859214, 0.0652474, -0.179352, 0.528635, 0.848849, -1.57598e-012, },
+	{ 0.0725713, 0.0717329, -0.179352, 0.346952, 0.937883, -1.74128e-012, },
+	{ 0.0859214, 0.0652474, -0.179352, 0.528635, 0.848849, -1.57598e-012, },
+	{ 0.0725713, 0.0717329, -0.149352, 0.346952, 0.937883, -1.74128e-012, },
+	{ 0.0859214, 0.0652474, -0.149352, 0.528635, 0.848849, -1.57598e-012, },
+	{ 0.0725713, 0.0717329, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0739382, 0.0389264, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0859214, 0.0652474, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0859214, 0.0652474, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0739382, 0.0389264, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0815312, 0.0295673, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0739382, 0.0389264, -0.149352, -0.687868, -0.725835, 1.34759e-012, },
+	{ 0.0815312, 0.0295673, -0.179352, -0.858036, -0.51359, 9.53537e-013, },
+	{ 0.0815312, 0.0295673, -0.149352, -0.858036, -0.51359, 9.53537e-013, },
+	{ 0.0815312, 0.0295673, -0.179352, -0.858036, -0.51359, 9.53537e-013, },
+	{ 0.0739382, 0.0389264, -0.149352, -0.687868, -0.725835, 1.34759e-012, },
+	{ 0.0739382, 0.0389264, -0.179352, -0.687868, -0.725835, 1.34759e-012, },
+	{ 0.0739382, 0.0389264, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0859214, 0.0652474, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0815312, 0.0295673, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0815312, 0.0295673, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0859214, 0.0652474, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0901519, 0.00901337, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0901519, 0.00901337, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0859214, 0.0652474, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0974755, 0.0562476, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0859214, 0.0652474, -0.149352, 0.528635, 0.848849, -1.57598e-012, },
+	{ 0.0974755, 0.0562476, -0.179352, 0.692365, 0.721547, -1.33963e-012, },
+	{ 0.0859214, 0.0652474, -0.179352, 0.528635, 0.848849, -1.57598e-012, },
+	{ 0.0974755, 0.0562476, -0.179352, 0.692365, 0.721547, -1.33963e-012, },
+	{ 0.0859214, 0.0652474, -0.149352, 0.528635, 0.848849, -1.57598e-012, },
+	{ 0.0974755, 0.0562476, -0.149352, 0.692365, 0.721547, -1.33963e-012, },
+	{ 0.0859214, 0.0652474, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0901519, 0.00901337, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0974755, 0.0562476, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0859214, 0.0652474, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0815312, 0.0295673, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0901519, 0.00901337, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0815312, 0.0295673, -0.149352, -0.858036, -0.51359, 9.53537e-013, },
+	{ 0.0901519, 0.00901337, -0.179352, -0.967791, -0.251756, 4.67413e-013, },
+	{ 0.0901519, 0.00901337, -0.149352, -0.967791, -0.251756, 4.67413e-013, },
+	{ 0.0901519, 0.00901337, -0.179352, -0.967791, -0.251756, 4.67413e-013, },
+	{ 0.0815312, 0.0295673, -0.149352, -0.858036, -0.51359, 9.53537e-013, },
+	{ 0.0815312, 0.0295673, -0.179352, -0.858036, -0.51359, 9.53537e-013, },
+	{ 0.0930255, -0.0165693, -0.179352, -0.999998, -0.00195883, 3.63678e-015, },
+	{ 0.0901519, 0.00901337, -0.149352, -0.967791, -0.251756, 4.67413e-013, },
+	{ 0.0901519, 0.00901337, -0.179352, -0.967791, -0.251756, 4.67413e-013, },
+	{ 0.0901519, 0.00901337, -0.149352, -0.967791, -0.251756, 4.67413e-013, },
+	{ 0.0930255, -0.0165693, -0.179352, -0.999998, -0.00195883, 3.63678e-015, },
+	{ 0.0930255, -0.0165693, -0.149352, -0.999998, -0.00195883, 3.63678e-015, },
+	{ 0.0902317, -0.0423516, -0.179352, -0.968748, 0.248046, -4.60525e-013, },
+	{ 0.0930255, -0.0165693, -0.149352, -0.999998, -0.00195883, 3.63678e-015, },
+	{ 0.0930255, -0.0165693, -0.179352, -0.999998, -0.00195883, 3.63678e-015, },
+	{ 0.0930255, -0.0165693, -0.149352, -0.999998, -0.00195883, 3.63678e-015, },
+	{ 0.0902317, -0.0423516, -0.179352, -0.968748, 0.248046, -4.60525e-013, },
+	{ 0.0902317, -0.0423516, -0.149352, -0.968748, 0.248046, -4.60525e-013, },
+	{ 0.0902317, -0.0423516, -0.179352, -0.968748, 0.248046, -4.60525e-013, },
+	{ 0.0818505, -0.0625463, -0.149352, -0.856809, 0.515634, -9.57333e-013, },
+	{ 0.0902317, -0.0423516, -0.149352, -0.968748, 0.248046, -4.60525e-013, },
+	{ 0.0818505, -0.0625463, -0.149352, -0.856809, 0.515634, -9.57333e-013, },
+	{ 0.0902317, -0.0423516, -0.179352, -0.968748, 0.248046, -4.60525e-013, },
+	{ 0.0818505, -0.0625463, -0.179352, -0.856809, 0.515634, -9.57333e-013, },
+	{ 0.0924667, -0.094395, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0818505, -0.0625463, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0902317, -0.0423516, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0778595, -0.102776, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0818505, -0.0625463, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0924667, -0.094395, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0778595, -0.102776, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0742974, -0.0716958, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0818505, -0.0625463, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0778595, -0.102776, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0650482, -0.0782312, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0742974, -0.0716958, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0606979, -0.107805, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0650482, -0.0782312, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0778595, -0.102776, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0606979, -0.107805, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0541027, -0.0821524, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0650482, -0.0782312, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0606979, -0.107805, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.041461, -0.0834595, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0541027, -0.0821524, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0409821, -0.109481, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.041461, -0.0834595, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0606979, -0.107805, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0409821, -0.109481, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0276519, -0.0821025, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.041461, -0.0834595, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0166366, -0.105969, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0276519, -0.0821025, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0409821, -0.109481, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0166366, -0.105969, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0144814, -0.0780317, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0276519, -0.0821025, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0166366, -0.105969, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.00194949, -0.0712468, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0144814, -0.0780317, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0166366, -0.105969, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.00994386, -0.0617481, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.00194949, -0.0712468, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0116999, -0.0954327, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.00994386, -0.0617481, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0166366, -0.105969, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.00994386, -0.0617481, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0116999, -0.0954327, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0116999, -0.0617481, -0.179352, 0, -1.85661e-012, -1, },
+	{ -0.0116999, -0.0954327, -0.149352, -1, 0, -0, },
+	{ -0.0116999, -0.0617481, -0.179352, -1, 0, -0, },
+	{ -0.0116999, -0.0954327, -0.179352, -1, 0, -0, },
+	{ -0.0116999, -0.0617481, -0.179352, -1, 0, -0, },
+	{ -0.0116999, -0.0954327, -0.149352, -1, 0, -0, },
+	{ -0.0116999, -0.0617481, -0.149352, -1, 0, -0, },
+	{ 0.0166366, -0.105969, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0116999, -0.0617481, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0116999, -0.0954327, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.0116999, -0.0617481, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0166366, -0.105969, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.00994386, -0.0617481, -0.149352, 0, 1.85661e-012, 1, },
+	{ -0.00994386, -0.0617481, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0166366, -0.105969, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.00194949, -0.0712468, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.00194949, -0.0712468, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0166366, -0.105969, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0144814, -0.0780317, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0144814, -0.0780317, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0166366, -0.105969, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0276519, -0.0821025, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0276519, -0.0821025, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0166366, -0.105969, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0409821, -0.109481, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0166366, -0.105969, -0.179352, -0.247047, -0.969003, 1.79906e-012, },
+	{ 0.0409821, -0.109481, -0.149352, -0.0292246, -0.999573, 1.85582e-012, },
+	{ 0.0166366, -0.105969, -0.149352, -0.247047, -0.969003, 1.79906e-012, },
+	{ 0.0409821, -0.109481, -0.149352, -0.0292246, -0.999573, 1.85582e-012, },
+	{ 0.0166366, -0.105969, -0.179352, -0.247047, -0.969003, 1.79906e-012, },
+	{ 0.0409821, -0.109481, -0.179352, -0.0292246, -0.999573, 1.85582e-012, },
+	{ 0.0409821, -0.109481, -0.179352, -0.0292246, -0.999573, 1.85582e-012, },
+	{ 0.0606979, -0.107805, -0.149352, 0.183878, -0.982949, 1.82496e-012, },
+	{ 0.0409821, -0.109481, -0.149352, -0.0292246, -0.999573, 1.85582e-012, },
+	{ 0.0606979, -0.107805, -0.149352, 0.183878, -0.982949, 1.82496e-012, },
+	{ 0.0409821, -0.109481, -0.179352, -0.0292246, -0.999573, 1.85582e-012, },
+	{ 0.0606979, -0.107805, -0.179352, 0.183878, -0.982949, 1.82496e-012, },
+	{ 0.0606979, -0.107805, -0.179352, 0.183878, -0.982949, 1.82496e-012, },
+	{ 0.0778595, -0.102776, -0.149352, 0.392158, -0.919898, 1.70789e-012, },
+	{ 0.0606979, -0.107805, -0.149352, 0.183878, -0.982949, 1.82496e-012, },
+	{ 0.0778595, -0.102776, -0.149352, 0.392158, -0.919898, 1.70789e-012, },
+	{ 0.0606979, -0.107805, -0.179352, 0.183878, -0.982949, 1.82496e-012, },
+	{ 0.0778595, -0.102776, -0.179352, 0.392158, -0.919898, 1.70789e-012, },
+	{ 0.0778595, -0.102776, -0.179352, 0.392158, -0.919898, 1.70789e-012, },
+	{ 0.0924667, -0.094395, -0.149352, 0.602351, -0.798231, 1.48201e-012, },
+	{ 0.0778595, -0.102776, -0.149352, 0.392158, -0.919898, 1.70789e-012, },
+	{ 0.0924667, -0.094395, -0.149352, 0.602351, -0.798231, 1.48201e-012, },
+	{ 0.0778595, -0.102776, -0.179352, 0.392158, -0.919898, 1.70789e-012, },
+	{ 0.0924667, -0.094395, -0.179352, 0.602351, -0.798231, 1.48201e-012, },
+	{ 0.0924667, -0.094395, -0.179352, 0.602351, -0.798231, 1.48201e-012, },
+	{ 0.10452, -0.0826613, -0.149352, 0.772924, -0.634498, 1.17802e-012, },
+	{ 0.0924667, -0.094395, -0.149352, 0.602351, -0.798231, 1.48201e-012, },
+	{ 0.10452, -0.0826613, -0.149352, 0.772924, -0.634498, 1.17802e-012, },
+	{ 0.0924667, -0.094395, -0.179352, 0.602351, -0.798231, 1.48201e-012, },
+	{ 0.10452, -0.0826613, -0.179352, 0.772924, -0.634498, 1.17802e-012, },
+	{ 0.0924667, -0.094395, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0930255, -0.0165693, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.10452, -0.0826613, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0924667, -0.094395, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0902317, -0.0423516, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0930255, -0.0165693, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.10452, -0.0826613, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0930255, -0.0165693, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0974755, 0.0562476, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0901519, 0.00901337, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0974755, 0.0562476, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0930255, -0.0165693, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.10452, -0.0826613, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0974755, 0.0562476, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.107234, 0.0447334, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.0974755, 0.0562476, -0.179352, 0.692365, 0.721547, -1.33963e-012, },
+	{ 0.107234, 0.0447334, -0.149352, 0.819356, 0.573286, -1.06437e-012, },
+	{ 0.107234, 0.0447334, -0.179352, 0.819356, 0.573286, -1.06437e-012, },
+	{ 0.107234, 0.0447334, -0.149352, 0.819356, 0.573286, -1.06437e-012, },
+	{ 0.0974755, 0.0562476, -0.179352, 0.692365, 0.721547, -1.33963e-012, },
+	{ 0.0974755, 0.0562476, -0.149352, 0.692365, 0.721547, -1.33963e-012, },
+	{ 0.0974755, 0.0562476, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.10452, -0.0826613, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.107234, 0.0447334, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0930255, -0.0165693, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.10452, -0.0826613, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0974755, 0.0562476, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0930255, -0.0165693, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0924667, -0.094395, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.10452, -0.0826613, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0902317, -0.0423516, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0924667, -0.094395, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0930255, -0.0165693, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0818505, -0.0625463, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0924667, -0.094395, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0902317, -0.0423516, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0818505, -0.0625463, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0778595, -0.102776, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0924667, -0.094395, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0742974, -0.0716958, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0778595, -0.102776, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0818505, -0.0625463, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0650482, -0.0782312, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0778595, -0.102776, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0742974, -0.0716958, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0650482, -0.0782312, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0606979, -0.107805, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0778595, -0.102776, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0541027, -0.0821524, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0606979, -0.107805, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0650482, -0.0782312, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.041461, -0.0834595, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0606979, -0.107805, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0541027, -0.0821524, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.041461, -0.0834595, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0409821, -0.109481, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0606979, -0.107805, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0276519, -0.0821025, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0409821, -0.109481, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.041461, -0.0834595, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.041461, -0.0834595, -0.149352, -0.00253816, 0.999997, -1.85661e-012, },
+	{ 0.0276519, -0.0821025, -0.179352, 0.197556, 0.980292, -1.82002e-012, },
+	{ 0.0276519, -0.0821025, -0.149352, 0.197556, 0.980292, -1.82002e-012, },
+	{ 0.0276519, -0.0821025, -0.179352, 0.197556, 0.980292, -1.82002e-012, },
+	{ 0.041461, -0.0834595, -0.149352, -0.00253816, 0.999997, -1.85661e-012, },
+	{ 0.041461, -0.0834595, -0.179352, -0.00253816, 0.999997, -1.85661e-012, },
+	{ 0.041461, -0.0834595, -0.149352, -0.00253816, 0.999997, -1.85661e-012, },
+	{ 0.0541027, -0.0821524, -0.179352, -0.22166, 0.975124, -1.81043e-012, },
+	{ 0.041461, -0.0834595, -0.179352, -0.00253816, 0.999997, -1.85661e-012, },
+	{ 0.0541027, -0.0821524, -0.179352, -0.22166, 0.975124, -1.81043e-012, },
+	{ 0.041461, -0.0834595, -0.149352, -0.00253816, 0.999997, -1.85661e-012, },
+	{ 0.0541027, -0.0821524, -0.149352, -0.22166, 0.975124, -1.81043e-012, },
+	{ 0.0541027, -0.0821524, -0.149352, -0.22166, 0.975124, -1.81043e-012, },
+	{ 0.0650482, -0.0782312, -0.179352, -0.461395, 0.887195, -1.64718e-012, },
+	{ 0.0541027, -0.0821524, -0.179352, -0.22166, 0.975124, -1.81043e-012, },
+	{ 0.0650482, -0.0782312, -0.179352, -0.461395, 0.887195, -1.64718e-012, },
+	{ 0.0541027, -0.0821524, -0.149352, -0.22166, 0.975124, -1.81043e-012, },
+	{ 0.0650482, -0.0782312, -0.149352, -0.461395, 0.887195, -1.64718e-012, },
+	{ 0.0650482, -0.0782312, -0.149352, -0.461395, 0.887195, -1.64718e-012, },
+	{ 0.0742974, -0.0716958, -0.179352, -0.680107, 0.733113, -1.36111e-012, },
+	{ 0.0650482, -0.0782312, -0.179352, -0.461395, 0.887195, -1.64718e-012, },
+	{ 0.0742974, -0.0716958, -0.179352, -0.680107, 0.733113, -1.36111e-012, },
+	{ 0.0650482, -0.0782312, -0.149352, -0.461395, 0.887195, -1.64718e-012, },
+	{ 0.0742974, -0.0716958, -0.149352, -0.680107, 0.733113, -1.36111e-012, },
+	{ 0.0742974, -0.0716958, -0.149352, -0.680107, 0.733113, -1.36111e-012, },
+	{ 0.0818505, -0.0625463, -0.179352, -0.856809, 0.515634, -9.57333e-013, },
+	{ 0.0742974, -0.0716958, -0.179352, -0.680107, 0.733113, -1.36111e-012, },
+	{ 0.0818505, -0.0625463, -0.179352, -0.856809, 0.515634, -9.57333e-013, },
+	{ 0.0742974, -0.0716958, -0.149352, -0.680107, 0.733113, -1.36111e-012, },
+	{ 0.0818505, -0.0625463, -0.149352, -0.856809, 0.515634, -9.57333e-013, },
+	{ 0.0276519, -0.0821025, -0.179352, 0.197556, 0.980292, -1.82002e-012, },
+	{ 0.0144814, -0.0780317, -0.149352, 0.387572, 0.921839, -1.7115e-012, },
+	{ 0.0276519, -0.0821025, -0.149352, 0.197556, 0.980292, -1.82002e-012, },
+	{ 0.0144814, -0.0780317, -0.149352, 0.387572, 0.921839, -1.7115e-012, },
+	{ 0.0276519, -0.0821025, -0.179352, 0.197556, 0.980292, -1.82002e-012, },
+	{ 0.0144814, -0.0780317, -0.179352, 0.387572, 0.921839, -1.7115e-012, },
+	{ 0.0144814, -0.0780317, -0.179352, 0.387572, 0.921839, -1.7115e-012, },
+	{ 0.00194949, -0.0712468, -0.149352, 0.552258, 0.833674, -1.54781e-012, },
+	{ 0.0144814, -0.0780317, -0.149352, 0.387572, 0.921839, -1.7115e-012, },
+	{ 0.00194949, -0.0712468, -0.149352, 0.552258, 0.833674, -1.54781e-012, },
+	{ 0.0144814, -0.0780317, -0.179352, 0.387572, 0.921839, -1.7115e-012, },
+	{ 0.00194949, -0.0712468, -0.179352, 0.552258, 0.833674, -1.54781e-012, },
+	{ 0.00194949, -0.0712468, -0.179352, 0.552258, 0.833674, -1.54781e-012, },
+	{ -0.00994386, -0.0617481, -0.149352, 0.624055, 0.78138, -1.45072e-012, },
+	{ 0.00194949, -0.0712468, -0.149352, 0.552258, 0.833674, -1.54781e-012, },
+	{ -0.00994386, -0.0617481, -0.149352, 0.624055, 0.78138, -1.45072e-012, },
+	{ 0.00194949, -0.0712468, -0.179352, 0.552258, 0.833674, -1.54781e-012, },
+	{ -0.00994386, -0.0617481, -0.179352, 0.624055, 0.78138, -1.45072e-012, },
+	{ -0.00994386, -0.0617481, -0.179352, 0, 1, -1.85661e-012, },
+	{ -0.0116999, -0.0617481, -0.149352, 0, 1, -1.85661e-012, },
+	{ -0.00994386, -0.0617481, -0.149352, 0, 1, -1.85661e-012, },
+	{ -0.0116999, -0.0617481, -0.149352, 0, 1, -1.85661e-012, },
+	{ -0.00994386, -0.0617481, -0.179352, 0, 1, -1.85661e-012, },
+	{ -0.0116999, -0.0617481, -0.179352, 0, 1, -1.85661e-012, },
+	{ 0.0974755, 0.0562476, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0901519, 0.00901337, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.0930255, -0.0165693, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.107234, 0.0447334, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.10452, -0.0826613, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.11311, -0.0694309, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.10452, -0.0826613, -0.149352, 0.772924, -0.634498, 1.17802e-012, },
+	{ 0.11311, -0.0694309, -0.179352, 0.88826, -0.459341, 8.52819e-013, },
+	{ 0.11311, -0.0694309, -0.149352, 0.88826, -0.459341, 8.52819e-013, },
+	{ 0.11311, -0.0694309, -0.179352, 0.88826, -0.459341, 8.52819e-013, },
+	{ 0.10452, -0.0826613, -0.149352, 0.772924, -0.634498, 1.17802e-012, },
+	{ 0.10452, -0.0826613, -0.179352, 0.772924, -0.634498, 1.17802e-012, },
+	{ 0.10452, -0.0826613, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.107234, 0.0447334, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.11311, -0.0694309, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.11311, -0.0694309, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.107234, 0.0447334, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.114637, 0.0317425, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.107234, 0.0447334, -0.179352, 0.819356, 0.573286, -1.06437e-012, },
+	{ 0.114637, 0.0317425, -0.149352, 0.907575, 0.41989, -7.79573e-013, },
+	{ 0.114637, 0.0317425, -0.179352, 0.907575, 0.41989, -7.79573e-013, },
+	{ 0.114637, 0.0317425, -0.149352, 0.907575, 0.41989, -7.79573e-013, },
+	{ 0.107234, 0.0447334, -0.179352, 0.819356, 0.573286, -1.06437e-012, },
+	{ 0.107234, 0.0447334, -0.149352, 0.819356, 0.573286, -1.06437e-012, },
+	{ 0.107234, 0.0447334, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.11311, -0.0694309, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.114637, 0.0317425, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.114637, 0.0317425, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.11311, -0.0694309, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.119247, -0.0540055, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.11311, -0.0694309, -0.149352, 0.88826, -0.459341, 8.52819e-013, },
+	{ 0.119247, -0.0540055, -0.179352, 0.957585, -0.288152, 5.34986e-013, },
+	{ 0.119247, -0.0540055, -0.149352, 0.957585, -0.288152, 5.34986e-013, },
+	{ 0.119247, -0.0540055, -0.179352, 0.957585, -0.288152, 5.34986e-013, },
+	{ 0.11311, -0.0694309, -0.149352, 0.88826, -0.459341, 8.52819e-013, },
+	{ 0.11311, -0.0694309, -0.179352, 0.88826, -0.459341, 8.52819e-013, },
+	{ 0.11311, -0.0694309, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.114637, 0.0317425, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.119247, -0.0540055, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.119247, -0.0540055, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.114637, 0.0317425, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.119925, 0.017195, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.114637, 0.0317425, -0.179352, 0.907575, 0.41989, -7.79573e-013, },
+	{ 0.119925, 0.017195, -0.149352, 0.963344, 0.268271, -4.98075e-013, },
+	{ 0.119925, 0.017195, -0.179352, 0.963344, 0.268271, -4.98075e-013, },
+	{ 0.119925, 0.017195, -0.149352, 0.963344, 0.268271, -4.98075e-013, },
+	{ 0.114637, 0.0317425, -0.179352, 0.907575, 0.41989, -7.79573e-013, },
+	{ 0.114637, 0.0317425, -0.149352, 0.907575, 0.41989, -7.79573e-013, },
+	{ 0.114637, 0.0317425, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.119247, -0.0540055, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.119925, 0.017195, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.119925, 0.017195, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.119247, -0.0540055, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.122929, -0.0363849, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.119247, -0.0540055, -0.149352, 0.957585, -0.288152, 5.34986e-013, },
+	{ 0.122929, -0.0363849, -0.179352, 0.991046, -0.133519, 2.47893e-013, },
+	{ 0.122929, -0.0363849, -0.149352, 0.991046, -0.133519, 2.47893e-013, },
+	{ 0.122929, -0.0363849, -0.179352, 0.991046, -0.133519, 2.47893e-013, },
+	{ 0.119247, -0.0540055, -0.149352, 0.957585, -0.288152, 5.34986e-013, },
+	{ 0.119247, -0.0540055, -0.179352, 0.957585, -0.288152, 5.34986e-013, },
+	{ 0.119247, -0.0540055, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.119925, 0.017195, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.122929, -0.0363849, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.122929, -0.0363849, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.119925, 0.017195, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.123098, 0.00109111, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.119925, 0.017195, -0.179352, 0.963344, 0.268271, -4.98075e-013, },
+	{ 0.123098, 0.00109111, -0.149352, 0.991924, 0.126832, -2.35479e-013, },
+	{ 0.123098, 0.00109111, -0.179352, 0.991924, 0.126832, -2.35479e-013, },
+	{ 0.123098, 0.00109111, -0.149352, 0.991924, 0.126832, -2.35479e-013, },
+	{ 0.119925, 0.017195, -0.179352, 0.963344, 0.268271, -4.98075e-013, },
+	{ 0.119925, 0.017195, -0.149352, 0.963344, 0.268271, -4.98075e-013, },
+	{ 0.119925, 0.017195, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.122929, -0.0363849, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.123098, 0.00109111, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.123098, 0.00109111, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.122929, -0.0363849, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.124156, -0.0165693, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.122929, -0.0363849, -0.149352, 0.991046, -0.133519, 2.47893e-013, },
+	{ 0.124156, -0.0165693, -0.179352, 0.999999, -0.00101948, 1.89278e-015, },
+	{ 0.124156, -0.0165693, -0.149352, 0.999999, -0.00101948, 1.89278e-015, },
+	{ 0.124156, -0.0165693, -0.179352, 0.999999, -0.00101948, 1.89278e-015, },
+	{ 0.122929, -0.0363849, -0.149352, 0.991046, -0.133519, 2.47893e-013, },
+	{ 0.122929, -0.0363849, -0.179352, 0.991046, -0.133519, 2.47893e-013, },
+	{ 0.122929, -0.0363849, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.123098, 0.00109111, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.124156, -0.0165693, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.123098, 0.00109111, -0.179352, 0.991924, 0.126832, -2.35479e-013, },
+	{ 0.124156, -0.0165693, -0.149352, 0.999999, -0.00101948, 1.89278e-015, },
+	{ 0.124156, -0.0165693, -0.179352, 0.999999, -0.00101948, 1.89278e-015, },
+	{ 0.124156, -0.0165693, -0.149352, 0.999999, -0.00101948, 1.89278e-015, },
+	{ 0.123098, 0.00109111, -0.179352, 0.991924, 0.126832, -2.35479e-013, },
+	{ 0.123098, 0.00109111, -0.149352, 0.991924, 0.126832, -2.35479e-013, },
+	{ 0.0166366, -0.105969, -0.149352, -0.247047, -0.969003, 1.79906e-012, },
+	{ -0.0116999, -0.0954327, -0.179352, -0.348518, -0.937302, 1.74021e-012, },
+	{ 0.0166366, -0.105969, -0.179352, -0.247047, -0.969003, 1.79906e-012, },
+	{ -0.0116999, -0.0954327, -0.179352, -0.348518, -0.937302, 1.74021e-012, },
+	{ 0.0166366, -0.105969, -0.149352, -0.247047, -0.969003, 1.79906e-012, },
+	{ -0.0116999, -0.0954327, -0.149352, -0.348518, -0.937302, 1.74021e-012, },
+	{ 0.218489, 0.109117, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.23399, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.208128, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.23399, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.218489, 0.109117, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.230418, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.218489, 0.109117, -0.179352, -0.766013, 0.642825, -1.19348e-012, },
+	{ 0.230418, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
+	{ 0.230418, 0.121471, -0.179352, -0.66764, 0.744484, -1.38222e-012, },
+	{ 0.230418, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
+	{ 0.218489, 0.109117, -0.179352, -0.766013, 0.642825, -1.19348e-012, },
+	{ 0.218489, 0.109117, -0.149352, -0.766013, 0.642825, -1.19348e-012, },
+	{ 0.208128, 0.0948611, -0.179352, -0.808895, 0.587953, -1.0916e-012, },
+	{ 0.218489, 0.109117, -0.149352, -0.766013, 0.642825, -1.19348e-012, },
+	{ 0.218489, 0.109117, -0.179352, -0.766013, 0.642825, -1.19348e-012, },
+	{ 0.218489, 0.109117, -0.149352, -0.766013, 0.642825, -1.19348e-012, },
+	{ 0.208128, 0.0948611, -0.179352, -0.808895, 0.587953, -1.0916e-012, },
+	{ 0.208128, 0.0948611, -0.149352, -0.808895, 0.587953, -1.0916e-012, },
+	{ 0.208128, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
+	{ 0.23399, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ 0.208128, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ 0.23399, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ 0.208128, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
+	{ 0.23399, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
+	{ 0.251241, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
+	{ 0.23399, 0.0948611, -0.149352, 0.716917, -0.697159, 1.29435e-012, },
+	{ 0.23399, 0.0948611, -0.179352, 0.716917, -0.697159, 1.29435e-012, },
+	{ 0.23399, 0.0948611, -0.149352, 0.716917, -0.697159, 1.29435e-012, },
+	{ 0.251241, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
+	{ 0.251241, 0.112601, -0.149352, 0.609765, -0.792582, 1.47152e-012, },
+	{ 0.251241, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
+	{ 0.273781, 0.125273, -0.149352, 0.379664, -0.925125, 1.71758e-012, },
+	{ 0.251241, 0.112601, -0.149352, 0.609765, -0.792582, 1.47152e-012, },
+	{ 0.273781, 0.125273, -0.149352, 0.379664, -0.925125, 1.71758e-012, },
+	{ 0.251241, 0.112601, -0.179352, 0.609765, -0.792582, 1.47152e-012, },
+	{ 0.273781, 0.125273, -0.179352, 0.379664, -0.925125, 1.71758e-012, },
+	{ 0.251241, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.258974, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.273781, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.251241, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.243912, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.258974, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.23399, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.243912, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.251241, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.23399, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.230418, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.243912, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.230418, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
+	{ 0.243912, 0.131926, -0.179352, -0.554528, 0.832165, -1.54501e-012, },
+	{ 0.230418, 0.121471, -0.179352, -0.66764, 0.744484, -1.38222e-012, },
+	{ 0.243912, 0.131926, -0.179352, -0.554528, 0.832165, -1.54501e-012, },
+	{ 0.230418, 0.121471, -0.149352, -0.66764, 0.744484, -1.38222e-012, },
+	{ 0.243912, 0.131926, -0.149352, -0.554528, 0.832165, -1.54501e-012, },
+	{ 0.230418, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.23399, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.243912, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.218489, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.23399, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.230418, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.23399, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.218489, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.208128, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.243912, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.23399, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.251241, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.243912, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.251241, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.258974, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.258974, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.251241, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.273781, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.258974, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.273781, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.275602, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.275602, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.273781, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.279229, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.273781, 0.125273, -0.149352, 0.379664, -0.925125, 1.71758e-012, },
+	{ 0.301608, 0.132876, -0.149352, 0.170704, -0.985322, 1.82949e-012, },
+	{ 0.279229, 0.126762, -0.149352, 0.263556, -0.964644, 1.79094e-012, },
+	{ 0.273781, 0.125273, -0.179352, 0.379664, -0.925125, 1.71758e-012, },
+	{ 0.301608, 0.132876, -0.149352, 0.170704, -0.985322, 1.82949e-012, },
+	{ 0.273781, 0.125273, -0.149352, 0.379664, -0.925125, 1.71758e-012, },
+	{ 0.301608, 0.132876, -0.149352, 0.170704, -0.985322, 1.82949e-012, },
+	{ 0.273781, 0.125273, -0.179352, 0.379664, -0.925125, 1.71758e-012, },
+	{ 0.301608, 0.132876, -0.179352, 0.170704, -0.985322, 1.82949e-012, },
+	{ 0.273781, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.275602, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.301608, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.273781, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.258974, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.275602, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.258974, 0.140479, -0.149352, -0.433645, 0.901084, -1.67296e-012, },
+	{ 0.275602, 0.147131, -0.179352, -0.312692, 0.949855, -1.76351e-012, },
+	{ 0.258974, 0.140479, -0.179352, -0.433645, 0.901084, -1.67296e-012, },
+	{ 0.275602, 0.147131, -0.179352, -0.312692, 0.949855, -1.76351e-012, },
+	{ 0.258974, 0.140479, -0.149352, -0.433645, 0.901084, -1.67296e-012, },
+	{ 0.275602, 0.147131, -0.149352, -0.312692, 0.949855, -1.76351e-012, },
+	{ 0.275602, 0.147131, -0.149352, -0.312692, 0.949855, -1.76351e-012, },
+	{ 0.293796, 0.151883, -0.179352, -0.198062, 0.98019, -1.81983e-012, },
+	{ 0.275602, 0.147131, -0.179352, -0.312692, 0.949855, -1.76351e-012, },
+	{ 0.293796, 0.151883, -0.179352, -0.198062, 0.98019, -1.81983e-012, },
+	{ 0.275602, 0.147131, -0.149352, -0.312692, 0.949855, -1.76351e-012, },
+	{ 0.293796, 0.151883, -0.149352, -0.198062, 0.98019, -1.81983e-012, },
+	{ 0.275602, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.279229, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.293796, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.293796, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.279229, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.289026, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.289026, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.279229, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.289026, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.300351, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.300351, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.301608, 0.132876, -0.149352, 0.170704, -0.985322, 1.82949e-012, },
+	{ 0.334724, 0.13541, -0.149352, 8.00648e-005, -1, 1.85675e-012, },
+	{ 0.326674, 0.134794, -0.149352, 0.076306, -0.997084, 1.85148e-012, },
+	{ 0.301608, 0.132876, -0.179352, 0.170704, -0.985322, 1.82949e-012, },
+	{ 0.334724, 0.13541, -0.149352, 8.00648e-005, -1, 1.85675e-012, },
+	{ 0.301608, 0.132876, -0.149352, 0.170704, -0.985322, 1.82949e-012, },
+	{ 0.334724, 0.13541, -0.149352, 8.00648e-005, -1, 1.85675e-012, },
+	{ 0.301608, 0.132876, -0.179352, 0.170704, -0.985322, 1.82949e-012, },
+	{ 0.334724, 0.13541, -0.179352, 8.00648e-005, -1, 1.85675e-012, },
+	{ 0.301608, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.313556, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.334724, 0.13541, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.301608, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.293796, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.313556, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.301608, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.275602, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.293796, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.293796, 0.151883, -0.149352, -0.198062, 0.98019, -1.81983e-012, },
+	{ 0.313556, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
+	{ 0.293796, 0.151883, -0.179352, -0.198062, 0.98019, -1.81983e-012, },
+	{ 0.313556, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
+	{ 0.293796, 0.151883, -0.149352, -0.198062, 0.98019, -1.81983e-012, },
+	{ 0.313556, 0.154734, -0.149352, -0.0937744, 0.995593, -1.84843e-012, },
+	{ 0.293796, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.300351, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.313556, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.293796, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.289026, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.300351, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.300351, 0.135271, -0.179352, -0.184752, 0.982785, -1.82465e-012, },
+	{ 0.289026, 0.131978, -0.149352, -0.376579, 0.926384, -1.71994e-012, },
+	{ 0.300351, 0.135271, -0.149352, -0.184752, 0.982785, -1.82465e-012, },
+	{ 0.289026, 0.131978, -0.149352, -0.376579, 0.926384, -1.71994e-012, },
+	{ 0.300351, 0.135271, -0.179352, -0.184752, 0.982785, -1.82465e-012, },
+	{ 0.289026, 0.131978, -0.179352, -0.376579, 0.926384, -1.71994e-012, },
+	{ 0.298645, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.289026, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.300351, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.287151, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.289026, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.298645, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.279488, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.289026, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.287151, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.279488, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.27872, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.289026, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.276934, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.27872, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.279488, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.26959, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.27872, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.276934, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.26959, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.26943, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.27872, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.261837, 0.0416702, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.26943, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.26959, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.261837, 0.0416702, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.261748, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.26943, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.2563, 0.0519572, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.261748, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.261837, 0.0416702, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.2563, 0.0519572, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.25626, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.261748, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.252977, 0.0633018, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.25626, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.2563, 0.0519572, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.252977, 0.0633018, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.252967, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.25626, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.252967, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.252977, 0.0633018, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.25187, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.252977, 0.0633018, -0.179352, -0.982569, -0.185898, 3.45141e-013, },
+	{ 0.25187, 0.075704, -0.149352, -1, 6.48887e-005, -1.20473e-016, },
+	{ 0.25187, 0.075704, -0.179352, -1, 6.48887e-005, -1.20473e-016, },
+	{ 0.25187, 0.075704, -0.149352, -1, 6.48887e-005, -1.20473e-016, },
+	{ 0.252977, 0.0633018, -0.179352, -0.982569, -0.185898, 3.45141e-013, },
+	{ 0.252977, 0.0633018, -0.149352, -0.982569, -0.185898, 3.45141e-013, },
+	{ 0.2563, 0.0519572, -0.179352, -0.92515, -0.379603, 7.04775e-013, },
+	{ 0.252977, 0.0633018, -0.149352, -0.982569, -0.185898, 3.45141e-013, },
+	{ 0.252977, 0.0633018, -0.179352, -0.982569, -0.185898, 3.45141e-013, },
+	{ 0.252977, 0.0633018, -0.149352, -0.982569, -0.185898, 3.45141e-013, },
+	{ 0.2563, 0.0519572, -0.179352, -0.92515, -0.379603, 7.04775e-013, },
+	{ 0.2563, 0.0519572, -0.149352, -0.92515, -0.379603, 7.04775e-013, },
+	{ 0.261837, 0.0416702, -0.179352, -0.827451, -0.561538, 1.04256e-012, },
+	{ 0.2563, 0.0519572, -0.149352, -0.92515, -0.379603, 7.04775e-013, },
+	{ 0.2563, 0.0519572, -0.179352, -0.92515, -0.379603, 7.04775e-013, },
+	{ 0.2563, 0.0519572, -0.149352, -0.92515, -0.379603, 7.04775e-013, },
+	{ 0.261837, 0.0416702, -0.179352, -0.827451, -0.561538, 1.04256e-012, },
+	{ 0.261837, 0.0416702, -0.149352, -0.827451, -0.561538, 1.04256e-012, },
+	{ 0.26959, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
+	{ 0.261837, 0.0416702, -0.149352, -0.827451, -0.561538, 1.04256e-012, },
+	{ 0.261837, 0.0416702, -0.179352, -0.827451, -0.561538, 1.04256e-012, },
+	{ 0.261837, 0.0416702, -0.149352, -0.827451, -0.561538, 1.04256e-012, },
+	{ 0.26959, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
+	{ 0.26959, 0.0324409, -0.149352, -0.701877, -0.712298, 1.32246e-012, },
+	{ 0.26959, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
+	{ 0.278929, 0.0248279, -0.149352, -0.552115, -0.833768, 1.54798e-012, },
+	{ 0.26959, 0.0324409, -0.149352, -0.701877, -0.712298, 1.32246e-012, },
+	{ 0.278929, 0.0248279, -0.149352, -0.552115, -0.833768, 1.54798e-012, },
+	{ 0.26959, 0.0324409, -0.179352, -0.701877, -0.712298, 1.32246e-012, },
+	{ 0.278929, 0.0248279, -0.179352, -0.552115, -0.833768, 1.54798e-012, },
+	{ 0.276934, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.278929, 0.0248279, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.26959, 0.0324409, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.278929, 0.0248279, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.276934, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.279548, 0.0613761, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.276934, 0.075704, -0.179352, 1, 0.000803637, -1.49204e-015, },
+	{ 0.279548, 0.0613761, -0.149352, 0.926569, 0.376125, -6.98317e-013, },
+	{ 0.279548, 0.0613761, -0.179352, 0.926569, 0.376125, -6.98317e-013, },
+	{ 0.279548, 0.0613761, -0.149352, 0.926569, 0.376125, -6.98317e-013, },
+	{ 0.276934, 0.075704, -0.179352, 1, 0.000803637, -1.49204e-015, },
+	{ 0.276934, 0.075704, -0.149352, 1, 0.000803637, -1.49204e-015, },
+	{ 0.279488, 0.0898323, -0.179352, 0.929149, -0.369705, 6.86399e-013, },
+	{ 0.276934, 0.075704, -0.149352, 1, 0.000803637, -1.49204e-015, },
+	{ 0.276934, 0.075704, -0.179352, 1, 0.000803637, -1.49204e-015, },
+	{ 0.276934, 0.075704, -0.149352, 1, 0.000803637, -1.49204e-015, },
+	{ 0.279488, 0.0898323, -0.179352, 0.929149, -0.369705, 6.86399e-013, },
+	{ 0.279488, 0.0898323, -0.149352, 0.929149, -0.369705, 6.86399e-013, },
+	{ 0.287151, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
+	{ 0.279488, 0.0898323, -0.149352, 0.929149, -0.369705, 6.86399e-013, },
+	{ 0.279488, 0.0898323, -0.179352, 0.929149, -0.369705, 6.86399e-013, },
+	{ 0.279488, 0.0898323, -0.149352, 0.929149, -0.369705, 6.86399e-013, },
+	{ 0.287151, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
+	{ 0.287151, 0.101566, -0.149352, 0.715458, -0.698656, 1.29713e-012, },
+	{ 0.287151, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
+	{ 0.298645, 0.109468, -0.149352, 0.383717, -0.923451, 1.71449e-012, },
+	{ 0.287151, 0.101566, -0.149352, 0.715458, -0.698656, 1.29713e-012, },
+	{ 0.298645, 0.109468, -0.149352, 0.383717, -0.923451, 1.71449e-012, },
+	{ 0.287151, 0.101566, -0.179352, 0.715458, -0.698656, 1.29713e-012, },
+	{ 0.298645, 0.109468, -0.179352, 0.383717, -0.923451, 1.71449e-012, },
+	{ 0.298645, 0.109468, -0.179352, 0.383717, -0.923451, 1.71449e-012, },
+	{ 0.312693, 0.112102, -0.149352, 1.17193e-015, -1, 1.85661e-012, },
+	{ 0.298645, 0.109468, -0.149352, 0.383717, -0.923451, 1.71449e-012, },
+	{ 0.312693, 0.112102, -0.149352, 1.17193e-015, -1, 1.85661e-012, },
+	{ 0.298645, 0.109468, -0.179352, 0.383717, -0.923451, 1.71449e-012, },
+	{ 0.312693, 0.112102, -0.179352, 1.17193e-015, -1, 1.85661e-012, },
+	{ 0.298645, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.300351, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.312693, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.312693, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.300351, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.312693, 0.136368, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.300351, 0.135271, -0.149352, -0.184752, 0.982785, -1.82465e-012, },
+	{ 0.312693, 0.136368, -0.179352, -3.20449e-016, 1, -1.85661e-012, },
+	{ 0.300351, 0.135271, -0.179352, -0.184752, 0.982785, -1.82465e-012, },
+	{ 0.312693, 0.136368, -0.179352, -3.20449e-016, 1, -1.85661e-012, },
+	{ 0.300351, 0.135271, -0.149352, -0.184752, 0.982785, -1.82465e-012, },
+	{ 0.312693, 0.136368, -0.149352, -3.20449e-016, 1, -1.85661e-012, },
+	{ 0.313556, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.300351, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.313556, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.325036, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.136368, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.325036, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.334884, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.325036, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.313556, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.325036, 0.135271, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.334884, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.334884, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
+	{ 0.313556, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
+	{ 0.313556, 0.154734, -0.149352, -0.0937744, 0.995593, -1.84843e-012, },
+	{ 0.313556, 0.154734, -0.179352, -0.0937744, 0.995593, -1.84843e-012, },
+	{ 0.334884, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
+	{ 0.334884, 0.155685, -0.179352, 3.90799e-005, 1, -1.85661e-012, },
+	{ 0.334884, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
+	{ 0.356174, 0.154734, -0.179352, 0.093929, 0.995579, -1.8484e-012, },
+	{ 0.334884, 0.155685, -0.179352, 3.90799e-005, 1, -1.85661e-012, },
+	{ 0.356174, 0.154734, -0.179352, 0.093929, 0.995579, -1.8484e-012, },
+	{ 0.334884, 0.155685, -0.149352, 3.90799e-005, 1, -1.85661e-012, },
+	{ 0.356174, 0.154734, -0.149352, 0.093929, 0.995579, -1.8484e-012, },
+	{ 0.334884, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.36791, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.356174, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.334884, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.334724, 0.13541, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.36791, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.334884, 0.155685, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.334724, 0.13541, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.334724, 0.13541, -0.179352, 8.00648e-005, -1, 1.85675e-012, },
+	{ 0.36791, 0.132876, -0.149352, -0.1704, -0.985375, 1.82946e-012, },
+	{ 0.334724, 0.13541, -0.149352, 8.00648e-005, -1, 1.85675e-012, },
+	{ 0.36791, 0.132876, -0.149352, -0.1704, -0.985375, 1.82946e-012, },
+	{ 0.334724, 0.13541, -0.179352, 8.00648e-005, -1, 1.85675e-012, },
+	{ 0.36791, 0.132876, -0.179352, -0.1704, -0.985375, 1.82946e-012, },
+	{ 0.334724, 0.13541, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.334884, 0.155685, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.36791, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.334724, 0.13541, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.313556, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.334884, 0.155685, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.36791, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.334884, 0.155685, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.356174, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.36791, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.356174, 0.154734, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.375902, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.356174, 0.154734, -0.149352, 0.093929, 0.995579, -1.8484e-012, },
+	{ 0.375902, 0.151883, -0.179352, 0.198356, 0.98013, -1.81972e-012, },
+	{ 0.356174, 0.154734, -0.179352, 0.093929, 0.995579, -1.8484e-012, },
+	{ 0.375902, 0.151883, -0.179352, 0.198356, 0.98013, -1.81972e-012, },
+	{ 0.356174, 0.154734, -0.149352, 0.093929, 0.995579, -1.8484e-012, },
+	{ 0.375902, 0.151883, -0.149352, 0.198356, 0.98013, -1.81972e-012, },
+	{ 0.356174, 0.154734, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.36791, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.375902, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.375902, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.36791, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.395787, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.36791, 0.132876, -0.179352, -0.1704, -0.985375, 1.82946e-012, },
+	{ 0.395787, 0.125273, -0.149352, -0.379191, -0.925318, 1.71796e-012, },
+	{ 0.36791, 0.132876, -0.149352, -0.1704, -0.985375, 1.82946e-012, },
+	{ 0.395787, 0.125273, -0.149352, -0.379191, -0.925318, 1.71796e-012, },
+	{ 0.36791, 0.132876, -0.179352, -0.1704, -0.985375, 1.82946e-012, },
+	{ 0.395787, 0.125273, -0.179352, -0.379191, -0.925318, 1.71796e-012, },
+	{ 0.36791, 0.132876, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.375902, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.395787, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.395787, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.375902, 0.151883, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.394069, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.375902, 0.151883, -0.149352, 0.198356, 0.98013, -1.81972e-012, },
+	{ 0.394069, 0.147131, -0.179352, 0.313088, 0.949724, -1.76312e-012, },
+	{ 0.375902, 0.151883, -0.179352, 0.198356, 0.98013, -1.81972e-012, },
+	{ 0.394069, 0.147131, -0.179352, 0.313088, 0.949724, -1.76312e-012, },
+	{ 0.375902, 0.151883, -0.149352, 0.198356, 0.98013, -1.81972e-012, },
+	{ 0.394069, 0.147131, -0.149352, 0.313088, 0.949724, -1.76312e-012, },
+	{ 0.375902, 0.151883, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.395787, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.394069, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.394069, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.395787, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.401455, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.401455, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.395787, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.401455, 0.141317, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.418357, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.401455, 0.141317, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.395787, 0.125273, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.401455, 0.141317, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.418357, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.418357, 0.112601, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.435618, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.418357, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
+	{ 0.435618, 0.0948611, -0.179352, -0.716715, -0.697366, 1.29474e-012, },
+	{ 0.435618, 0.0948611, -0.149352, -0.716715, -0.697366, 1.29474e-012, },
+	{ 0.435618, 0.0948611, -0.179352, -0.716715, -0.697366, 1.29474e-012, },
+	{ 0.418357, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
+	{ 0.418357, 0.112601, -0.179352, -0.609426, -0.792843, 1.472e-012, },
+	{ 0.418357, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
+	{ 0.395787, 0.125273, -0.179352, -0.379191, -0.925318, 1.71796e-012, },
+	{ 0.418357, 0.112601, -0.179352, -0.609426, -0.792843, 1.472e-012, },
+	{ 0.395787, 0.125273, -0.179352, -0.379191, -0.925318, 1.71796e-012, },
+	{ 0.418357, 0.112601, -0.149352, -0.609426, -0.792843, 1.472e-012, },
+	{ 0.395787, 0.125273, -0.149352, -0.379191, -0.925318, 1.71796e-012, },
+	{ 0.395787, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.410674, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.418357, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.395787, 0.125273, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.394069, 0.147131, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.410674, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.394069, 0.147131, -0.149352, 0.313088, 0.949724, -1.76312e-012, },
+	{ 0.410674, 0.140479, -0.179352, 0.43408, 0.900874, -1.67242e-012, },
+	{ 0.394069, 0.147131, -0.179352, 0.313088, 0.949724, -1.76312e-012, },
+	{ 0.410674, 0.140479, -0.179352, 0.43408, 0.900874, -1.67242e-012, },
+	{ 0.394069, 0.147131, -0.149352, 0.313088, 0.949724, -1.76312e-012, },
+	{ 0.404597, 0.142913, -0.149352, 0.371896, 0.928275, -1.72314e-012, },
+	{ 0.394069, 0.147131, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.401455, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.404597, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.401455, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.404597, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.401455, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.401455, 0.141317, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.401455, 0.142913, -0.149352, -1, 0, -0, },
+	{ 0.401455, 0.141317, -0.179352, -1, 0, -0, },
+	{ 0.401455, 0.141317, -0.149352, -1, 0, -0, },
+	{ 0.401455, 0.141317, -0.179352, -1, 0, -0, },
+	{ 0.401455, 0.142913, -0.149352, -1, 0, -0, },
+	{ 0.401455, 0.142913, -0.179352, -1, 0, -0, },
+	{ 0.401455, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
+	{ 0.438013, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
+	{ 0.401455, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
+	{ 0.438013, 0.142913, -0.179352, 0, 1, -1.85661e-012, },
+	{ 0.401455, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
+	{ 0.438013, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
+	{ 0.438013, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
+	{ 0.401455, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
+	{ 0.404597, 0.142913, -0.149352, 0, 1, -1.85661e-012, },
+	{ 0.410674, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.438013, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.404597, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.438013, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.410674, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.425718, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.425718, 0.131926, -0.179352, 0.554922, 0.831902, -1.54452e-012, },
+	{ 0.410674, 0.140479, -0.149352, 0.43408, 0.900874, -1.67242e-012, },
+	{ 0.425718, 0.131926, -0.149352, 0.554922, 0.831902, -1.54452e-012, },
+	{ 0.410674, 0.140479, -0.149352, 0.43408, 0.900874, -1.67242e-012, },
+	{ 0.425718, 0.131926, -0.179352, 0.554922, 0.831902, -1.54452e-012, },
+	{ 0.410674, 0.140479, -0.179352, 0.43408, 0.900874, -1.67242e-012, },
+	{ 0.418357, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.410674, 0.140479, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.425718, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.418357, 0.112601, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.425718, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.435618, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.435618, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.425718, 0.131926, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.4392, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.425718, 0.131926, -0.149352, 0.554922, 0.831902, -1.54452e-012, },
+	{ 0.4392, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
+	{ 0.425718, 0.131926, -0.179352, 0.554922, 0.831902, -1.54452e-012, },
+	{ 0.4392, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
+	{ 0.425718, 0.131926, -0.149352, 0.554922, 0.831902, -1.54452e-012, },
+	{ 0.4392, 0.121471, -0.149352, 0.667924, 0.74423, -1.38175e-012, },
+	{ 0.425718, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.410674, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.425718, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.404597, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.410674, 0.140479, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.410674, 0.140479, -0.149352, 0.43408, 0.900874, -1.67242e-012, },
+	{ 0.410674, 0.140479, -0.179352, 0.43408, 0.900874, -1.67242e-012, },
+	{ 0.404597, 0.142913, -0.149352, 0.371896, 0.928275, -1.72314e-012, },
+	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.437534, 0.0976947, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.42588, 0.114497, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.435618, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.437534, 0.0976947, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.437534, 0.0976947, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.435618, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.439098, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.435618, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ 0.46148, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ 0.439098, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ 0.435618, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
+	{ 0.46148, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ 0.435618, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ 0.46148, 0.0948611, -0.149352, 0, -1, 1.85661e-012, },
+	{ 0.435618, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
+	{ 0.46148, 0.0948611, -0.179352, 0, -1, 1.85661e-012, },
+	{ 0.435618, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.4392, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.46148, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.46148, 0.0948611, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.4392, 0.121471, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.451121, 0.109117, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.4392, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
+	{ 0.451121, 0.109117, -0.149352, 0.766151, 0.642661, -1.19317e-012, },
+	{ 0.451121, 0.109117, -0.179352, 0.766151, 0.642661, -1.19317e-012, },
+	{ 0.451121, 0.109117, -0.149352, 0.766151, 0.642661, -1.19317e-012, },
+	{ 0.4392, 0.121471, -0.179352, 0.667924, 0.74423, -1.38175e-012, },
+	{ 0.4392, 0.121471, -0.149352, 0.667924, 0.74423, -1.38175e-012, },
+	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.451121, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.439098, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.437534, 0.0976947, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.439098, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.437534, 0.0976947, -0.179352, -0.84969, -0.527283, 9.78809e-013, },
+	{ 0.439098, 0.0948611, -0.149352, -0.875469, -0.483274, 8.96952e-013, },
+	{ 0.437534, 0.0976947, -0.149352, -0.84969, -0.527283, 9.78809e-013, },
+	{ 0.447911, 0.0788968, -0.179352, -0.899286, -0.43736, 8.11858e-013, },
+	{ 0.439098, 0.0948611, -0.149352, -0.875469, -0.483274, 8.96952e-013, },
+	{ 0.437534, 0.0976947, -0.179352, -0.84969, -0.527283, 9.78809e-013, },
+	{ 0.439098, 0.0948611, -0.149352, -0.875469, -0.483274, 8.96952e-013, },
+	{ 0.447911, 0.0788968, -0.179352, -0.899286, -0.43736, 8.11858e-013, },
+	{ 0.447911, 0.0788968, -0.149352, -0.899286, -0.43736, 8.11858e-013, },
+	{ 0.456691, 0.0581832, -0.179352, -0.939981, -0.341227, 6.33526e-013, },
+	{ 0.447911, 0.0788968, -0.149352, -0.899286, -0.43736, 8.11858e-013, },
+	{ 0.447911, 0.0788968, -0.179352, -0.899286, -0.43736, 8.11858e-013, },
+	{ 0.447911, 0.0788968, -0.149352, -0.899286, -0.43736, 8.11858e-013, },
+	{ 0.456691, 0.0581832, -0.179352, -0.939981, -0.341227, 6.33526e-013, },
+	{ 0.456691, 0.0581832, -0.149352, -0.939981, -0.341227, 6.33526e-013, },
+	{ 0.463555, 0.0356337, -0.179352, -0.971732, -0.236086, 4.3832e-013, },
+	{ 0.456691, 0.0581832, -0.149352, -0.939981, -0.341227, 6.33526e-013, },
+	{ 0.456691, 0.0581832, -0.179352, -0.939981, -0.341227, 6.33526e-013, },
+	{ 0.456691, 0.0581832, -0.149352, -0.939981, -0.341227, 6.33526e-013, },
+	{ 0.463555, 0.0356337, -0.179352, -0.971732, -0.236086, 4.3832e-013, },
+	{ 0.463555, 0.0356337, -0.149352, -0.971732, -0.236086, 4.3832e-013, },
+	{ 0.467986, 0.0114479, -0.179352, -0.992885, -0.119081, 2.21088e-013, },
+	{ 0.463555, 0.0356337, -0.149352, -0.971732, -0.236086, 4.3832e-013, },
+	{ 0.463555, 0.0356337, -0.179352, -0.971732, -0.236086, 4.3832e-013, },
+	{ 0.463555, 0.0356337, -0.149352, -0.971732, -0.236086, 4.3832e-013, },
+	{ 0.467986, 0.0114479, -0.179352, -0.992885, -0.119081, 2.21088e-013, },
+	{ 0.467986, 0.0114479, -0.149352, -0.992885, -0.119081, 2.21088e-013, },
+	{ 0.469462, -0.0141747, -0.179352, -1, -0.000498049, 9.24684e-016, },
+	{ 0.467986, 0.0114479, -0.149352, -0.992885, -0.119081, 2.21088e-013, },
+	{ 0.467986, 0.0114479, -0.179352, -0.992885, -0.119081, 2.21088e-013, },
+	{ 0.467986, 0.0114479, -0.149352, -0.992885, -0.119081, 2.21088e-013, },
+	{ 0.469462, -0.0141747, -0.179352, -1, -0.000498049, 9.24684e-016, },
+	{ 0.469462, -0.0141747, -0.149352, -1, -0.000498049, 9.24684e-016, },
+	{ 0.468006, -0.0398971, -0.179352, -0.992938, 0.118632, -2.20254e-013, },
+	{ 0.469462, -0.0141747, -0.149352, -1, -0.000498049, 9.24684e-016, },
+	{ 0.469462, -0.0141747, -0.179352, -1, -0.000498049, 9.24684e-016, },
+	{ 0.469462, -0.0141747, -0.149352, -1, -0.000498049, 9.24684e-016, },
+	{ 0.468006, -0.0398971, -0.179352, -0.992938, 0.118632, -2.20254e-013, },
+	{ 0.468006, -0.0398971, -0.149352, -0.992938, 0.118632, -2.20254e-013, },
+	{ 0.468006, -0.0398971, -0.179352, -0.992938, 0.118632, -2.20254e-013, },
+	{ 0.463635, -0.0637437, -0.149352, -0.971494, 0.237063, -4.40134e-013, },
+	{ 0.468006, -0.0398971, -0.149352, -0.992938, 0.118632, -2.20254e-013, },
+	{ 0.463635, -0.0637437, -0.149352, -0.971494, 0.237063, -4.40134e-013, },
+	{ 0.468006, -0.0398971, -0.179352, -0.992938, 0.118632, -2.20254e-013, },
+	{ 0.463635, -0.0637437, -0.179352, -0.971494, 0.237063, -4.40134e-013, },
+	{ 0.481755, -0.100861, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.463635, -0.0637437, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.468006, -0.0398971, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.462917, -0.137139, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.463635, -0.0637437, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.481755, -0.100861, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.462917, -0.137139, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.456791, -0.0860736, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.463635, -0.0637437, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.462917, -0.137139, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.447911, -0.107246, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.456791, -0.0860736, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.438013, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.447911, -0.107246, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.462917, -0.137139, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.438013, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.437853, -0.125745, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.447911, -0.107246, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.438013, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.426199, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.437853, -0.125745, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.401455, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.426199, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.438013, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.426199, -0.142607, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.401455, -0.171263, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.401455, -0.169666, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.401455, -0.171263, -0.179352, -1, 0, -0, },
+	{ 0.401455, -0.169666, -0.149352, -1, 0, -0, },
+	{ 0.401455, -0.169666, -0.179352, -1, 0, -0, },
+	{ 0.401455, -0.169666, -0.149352, -1, 0, -0, },
+	{ 0.401455, -0.171263, -0.179352, -1, 0, -0, },
+	{ 0.401455, -0.171263, -0.149352, -1, 0, -0, },
+	{ 0.401455, -0.171263, -0.179352, 0, -1, 1.85661e-012, },
+	{ 0.438013, -0.171263, -0.149352, 0, -1, 1.85661e-012, },
+	{ 0.401455, -0.171263, -0.149352, 0, -1, 1.85661e-012, },
+	{ 0.438013, -0.171263, -0.149352, 0, -1, 1.85661e-012, },
+	{ 0.401455, -0.171263, -0.179352, 0, -1, 1.85661e-012, },
+	{ 0.438013, -0.171263, -0.179352, 0, -1, 1.85661e-012, },
+	{ 0.462917, -0.137139, -0.179352, 0.85006, -0.526686, 9.77851e-013, },
+	{ 0.438013, -0.171263, -0.149352, 0.807754, -0.589519, 1.09451e-012, },
+	{ 0.438013, -0.171263, -0.179352, 0.807754, -0.589519, 1.09451e-012, },
+	{ 0.438013, -0.171263, -0.149352, 0.807754, -0.589519, 1.09451e-012, },
+	{ 0.462917, -0.137139, -0.179352, 0.85006, -0.526686, 9.77851e-013, },
+	{ 0.462917, -0.137139, -0.149352, 0.85006, -0.526686, 9.77851e-013, },
+	{ 0.481755, -0.100861, -0.179352, 0.916945, -0.399013, 7.40812e-013, },
+	{ 0.462917, -0.137139, -0.149352, 0.85006, -0.526686, 9.77851e-013, },
+	{ 0.462917, -0.137139, -0.179352, 0.85006, -0.526686, 9.77851e-013, },
+	{ 0.462917, -0.137139, -0.149352, 0.85006, -0.526686, 9.77851e-013, },
+	{ 0.481755, -0.100861, -0.179352, 0.916945, -0.399013, 7.40812e-013, },
+	{ 0.481755, -0.100861, -0.149352, 0.916945, -0.399013, 7.40812e-013, },
+	{ 0.488669, -0.081434, -0.179352, 0.959132, -0.28296, 5.25347e-013, },
+	{ 0.481755, -0.100861, -0.149352, 0.916945, -0.399013, 7.40812e-013, },
+	{ 0.481755, -0.100861, -0.179352, 0.916945, -0.399013, 7.40812e-013, },
+	{ 0.481755, -0.100861, -0.149352, 0.916945, -0.399013, 7.40812e-013, },
+	{ 0.488669, -0.081434, -0.179352, 0.959132, -0.28296, 5.25347e-013, },
+	{ 0.488669, -0.081434, -0.149352, 0.959132, -0.28296, 5.25347e-013, },
+	{ 0.493608, -0.0605109, -0.179352, 0.983554, -0.180615, 3.35331e-013, },
+	{ 0.488669, -0.081434, -0.149352, 0.959132, -0.28296, 5.25347e-013, },
+	{ 0.488669, -0.081434, -0.179352, 0.959132, -0.28296, 5.25347e-013, },
+	{ 0.488669, -0.081434, -0.149352, 0.959132, -0.28296, 5.25347e-013, },
+	{ 0.493608, -0.0605109, -0.179352, 0.983554, -0.180615, 3.35331e-013, },
+	{ 0.493608, -0.0605109, -0.149352, 0.983554, -0.180615, 3.35331e-013, },
+	{ 0.496572, -0.0380911, -0.179352, 0.996274, -0.0862391, 1.60112e-013, },
+	{ 0.493608, -0.0605109, -0.149352, 0.983554, -0.180615, 3.35331e-013, },
+	{ 0.493608, -0.0605109, -0.179352, 0.983554, -0.180615, 3.35331e-013, },
+	{ 0.493608, -0.0605109, -0.149352, 0.983554, -0.180615, 3.35331e-013, },
+	{ 0.496572, -0.0380911, -0.179352, 0.996274, -0.0862391, 1.60112e-013, },
+	{ 0.496572, -0.0380911, -0.149352, 0.996274, -0.0862391, 1.60112e-013, },
+	{ 0.497559, -0.0141747, -0.179352, 1, -7.64695e-006, 1.41974e-017, },
+	{ 0.496572, -0.0380911, -0.149352, 0.996274, -0.0862391, 1.60112e-013, },
+	{ 0.496572, -0.0380911, -0.179352, 0.996274, -0.0862391, 1.60112e-013, },
+	{ 0.496572, -0.0380911, -0.149352, 0.996274, -0.0862391, 1.60112e-013, },
+	{ 0.497559, -0.0141747, -0.179352, 1, -7.64695e-006, 1.41974e-017, },
+	{ 0.497559, -0.0141747, -0.149352, 1, -7.64695e-006, 1.41974e-017, },
+	{ 0.496567, 0.00987145, -0.179352, 0.996264, 0.0863563, -1.6033e-013, },
+	{ 0.497559, -0.0141747, -0.149352, 1, -7.64695e-006, 1.41974e-017, },
+	{ 0.497559, -0.0141747, -0.179352, 1, -7.64695e-006, 1.41974e-017, },
+	{ 0.497559, -0.0141747, -0.149352, 1, -7.64695e-006, 1.41974e-017, },
+	{ 0.496567, 0.00987145, -0.179352, 0.996264, 0.0863563, -1.6033e-013, },
+	{ 0.496567, 0.00987145, -0.149352, 0.996264, 0.0863563, -1.6033e-013, },
+	{ 0.493588, 0.0323611, -0.179352, 0.983439, 0.18124, -3.36493e-013, },
+	{ 0.496567, 0.00987145, -0.149352, 0.996264, 0.0863563, -1.6033e-013, },
+	{ 0.496567, 0.00987145, -0.179352, 0.996264, 0.0863563, -1.6033e-013, },
+	{ 0.496567, 0.00987145, -0.149352, 0.996264, 0.0863563, -1.6033e-013, },
+	{ 0.493588, 0.0323611, -0.179352, 0.983439, 0.18124, -3.36493e-013, },
+	{ 0.493588, 0.0323611, -0.149352, 0.983439, 0.18124, -3.36493e-013, },
+	{ 0.488624, 0.0532942, -0.179352, 0.958645, 0.284606, -5.28403e-013, },
+	{ 0.493588, 0.0323611, -0.149352, 0.983439, 0.18124, -3.36493e-013, },
+	{ 0.493588, 0.0323611, -0.179352, 0.983439, 0.18124, -3.36493e-013, },
+	{ 0.493588, 0.0323611, -0.149352, 0.983439, 0.18124, -3.36493e-013, },
+	{ 0.488624, 0.0532942, -0.179352, 0.958645, 0.284606, -5.28403e-013, },
+	{ 0.488624, 0.0532942, -0.149352, 0.958645, 0.284606, -5.28403e-013, },
+	{ 0.481675, 0.0726708, -0.179352, 0.916106, 0.400937, -7.44384e-013, },
+	{ 0.488624, 0.0532942, -0.149352, 0.958645, 0.284606, -5.28403e-013, },
+	{ 0.488624, 0.0532942, -0.179352, 0.958645, 0.284606, -5.28403e-013, },
+	{ 0.488624, 0.0532942, -0.149352, 0.958645, 0.284606, -5.28403e-013, },
+	{ 0.481675, 0.0726708, -0.179352, 0.916106, 0.400937, -7.44384e-013, },
+	{ 0.481675, 0.0726708, -0.149352, 0.916106, 0.400937, -7.44384e-013, },
+	{ 0.462817, 0.10883, -0.179352, 0.849946, 0.52687, -9.78193e-013, },
+	{ 0.481675, 0.0726708, -0.149352, 0.916106, 0.400937, -7.44384e-013, },
+	{ 0.481675, 0.0726708, -0.179352, 0.916106, 0.400937, -7.44384e-013, },
+	{ 0.481675, 0.0726708, -0.149352, 0.916106, 0.400937, -7.44384e-013, },
+	{ 0.462817, 0.10883, -0.179352, 0.849946, 0.52687, -9.78193e-013, },
+	{ 0.462817, 0.10883, -0.149352, 0.849946, 0.52687, -9.78193e-013, },
+	{ 0.438013, 0.142913, -0.179352, 0.808552, 0.588425, -1.09248e-012, },
+	{ 0.462817, 0.10883, -0.149352, 0.849946, 0.52687, -9.78193e-013, },
+	{ 0.462817, 0.10883, -0.179352, 0.849946, 0.52687, -9.78193e-013, },
+	{ 0.462817, 0.10883, -0.149352, 0.849946, 0.52687, -9.78193e-013, },
+	{ 0.438013, 0.142913, -0.179352, 0.808552, 0.588425, -1.09248e-012, },
+	{ 0.438013, 0.142913, -0.149352, 0.808552, 0.588425, -1.09248e-012, },
+	{ 0.438013, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.462817, 0.10883, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.438013, 0.142913, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.425718, 0.131926, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.462817, 0.10883, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.4392, 0.121471, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.451121, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.462817, 0.10883, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.451121, 0.109117, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.46148, 0.0948611, -0.149352, 0.808963, 0.58786, -1.09143e-012, },
+	{ 0.451121, 0.109117, -0.179352, 0.766151, 0.642661, -1.19317e-012, },
+	{ 0.451121, 0.109117, -0.149352, 0.766151, 0.642661, -1.19317e-012, },
+	{ 0.451121, 0.109117, -0.179352, 0.766151, 0.642661, -1.19317e-012, },
+	{ 0.46148, 0.0948611, -0.149352, 0.808963, 0.58786, -1.09143e-012, },
+	{ 0.46148, 0.0948611, -0.179352, 0.808963, 0.58786, -1.09143e-012, },
+	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.463555, 0.0356337, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.462817, 0.10883, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.456691, 0.0581832, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.463555, 0.0356337, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.447911, 0.0788968, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.456691, 0.0581832, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.447911, 0.0788968, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.46148, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.439098, 0.0948611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.462817, 0.10883, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.463555, 0.0356337, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.481675, 0.0726708, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.481675, 0.0726708, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.463555, 0.0356337, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.467986, 0.0114479, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.481675, 0.0726708, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.467986, 0.0114479, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.469462, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.469462, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.481755, -0.100861, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.481675, 0.0726708, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.468006, -0.0398971, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.481755, -0.100861, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.469462, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.463635, -0.0637437, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.481755, -0.100861, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.468006, -0.0398971, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.463635, -0.0637437, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.462917, -0.137139, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.481755, -0.100861, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.456791, -0.0860736, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.462917, -0.137139, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.463635, -0.0637437, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.447911, -0.107246, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.462917, -0.137139, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.456791, -0.0860736, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.447911, -0.107246, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.438013, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.462917, -0.137139, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.437853, -0.125745, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.438013, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.447911, -0.107246, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.426199, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.438013, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.437853, -0.125745, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.401455, -0.169666, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.438013, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.426199, -0.142607, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.438013, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.401455, -0.169666, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.401455, -0.171263, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.426199, -0.142607, -0.149352, -0.782115, 0.623134, -1.15692e-012, },
+	{ 0.401455, -0.169666, -0.179352, -0.737967, 0.674837, -1.25291e-012, },
+	{ 0.401455, -0.169666, -0.149352, -0.737967, 0.674837, -1.25291e-012, },
+	{ 0.401455, -0.169666, -0.179352, -0.737967, 0.674837, -1.25291e-012, },
+	{ 0.426199, -0.142607, -0.149352, -0.782115, 0.623134, -1.15692e-012, },
+	{ 0.426199, -0.142607, -0.179352, -0.782115, 0.623134, -1.15692e-012, },
+	{ 0.437853, -0.125745, -0.149352, -0.85181, 0.52385, -9.72587e-013, },
+	{ 0.426199, -0.142607, -0.179352, -0.782115, 0.623134, -1.15692e-012, },
+	{ 0.426199, -0.142607, -0.149352, -0.782115, 0.623134, -1.15692e-012, },
+	{ 0.426199, -0.142607, -0.179352, -0.782115, 0.623134, -1.15692e-012, },
+	{ 0.437853, -0.125745, -0.149352, -0.85181, 0.52385, -9.72587e-013, },
+	{ 0.437853, -0.125745, -0.179352, -0.85181, 0.52385, -9.72587e-013, },
+	{ 0.447911, -0.107246, -0.149352, -0.901507, 0.432766, -8.03478e-013, },
+	{ 0.437853, -0.125745, -0.179352, -0.85181, 0.52385, -9.72587e-013, },
+	{ 0.437853, -0.125745, -0.149352, -0.85181, 0.52385, -9.72587e-013, },
+	{ 0.437853, -0.125745, -0.179352, -0.85181, 0.52385, -9.72587e-013, },
+	{ 0.447911, -0.107246, -0.149352, -0.901507, 0.432766, -8.03478e-013, },
+	{ 0.447911, -0.107246, -0.179352, -0.901507, 0.432766, -8.03478e-013, },
+	{ 0.447911, -0.107246, -0.149352, -0.901507, 0.432766, -8.03478e-013, },
+	{ 0.456791, -0.0860736, -0.179352, -0.940302, 0.340342, -6.31884e-013, },
+	{ 0.447911, -0.107246, -0.179352, -0.901507, 0.432766, -8.03478e-013, },
+	{ 0.456791, -0.0860736, -0.179352, -0.940302, 0.340342, -6.31884e-013, },
+	{ 0.447911, -0.107246, -0.149352, -0.901507, 0.432766, -8.03478e-013, },
+	{ 0.456791, -0.0860736, -0.149352, -0.940302, 0.340342, -6.31884e-013, },
+	{ 0.456791, -0.0860736, -0.149352, -0.940302, 0.340342, -6.31884e-013, },
+	{ 0.463635, -0.0637437, -0.179352, -0.971494, 0.237063, -4.40134e-013, },
+	{ 0.456791, -0.0860736, -0.179352, -0.940302, 0.340342, -6.31884e-013, },
+	{ 0.463635, -0.0637437, -0.179352, -0.971494, 0.237063, -4.40134e-013, },
+	{ 0.456791, -0.0860736, -0.149352, -0.940302, 0.340342, -6.31884e-013, },
+	{ 0.463635, -0.0637437, -0.149352, -0.971494, 0.237063, -4.40134e-013, },
+	{ 0.481675, 0.0726708, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.481755, -0.100861, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.488624, 0.0532942, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.488624, 0.0532942, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.481755, -0.100861, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.488669, -0.081434, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.488624, 0.0532942, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.488669, -0.081434, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.493588, 0.0323611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.493588, 0.0323611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.488669, -0.081434, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.493608, -0.0605109, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.493588, 0.0323611, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.493608, -0.0605109, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.496567, 0.00987145, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.496567, 0.00987145, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.493608, -0.0605109, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.496572, -0.0380911, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.496567, 0.00987145, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.496572, -0.0380911, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.497559, -0.0141747, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.447911, 0.0788968, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.438013, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.462817, 0.10883, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.437534, 0.0976947, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.438013, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.447911, 0.0788968, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.42588, 0.114497, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.438013, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.437534, 0.0976947, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.401455, 0.141317, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.438013, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.42588, 0.114497, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.438013, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.401455, 0.141317, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.401455, 0.142913, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.42588, 0.114497, -0.179352, -0.782232, -0.622987, 1.15665e-012, },
+	{ 0.401455, 0.141317, -0.149352, -0.739342, -0.67333, 1.25011e-012, },
+	{ 0.401455, 0.141317, -0.179352, -0.739342, -0.67333, 1.25011e-012, },
+	{ 0.401455, 0.141317, -0.149352, -0.739342, -0.67333, 1.25011e-012, },
+	{ 0.42588, 0.114497, -0.179352, -0.782232, -0.622987, 1.15665e-012, },
+	{ 0.42588, 0.114497, -0.149352, -0.782232, -0.622987, 1.15665e-012, },
+	{ 0.437534, 0.0976947, -0.179352, -0.84969, -0.527283, 9.78809e-013, },
+	{ 0.42588, 0.114497, -0.149352, -0.782232, -0.622987, 1.15665e-012, },
+	{ 0.42588, 0.114497, -0.179352, -0.782232, -0.622987, 1.15665e-012, },
+	{ 0.42588, 0.114497, -0.149352, -0.782232, -0.622987, 1.15665e-012, },
+	{ 0.437534, 0.0976947, -0.179352, -0.84969, -0.527283, 9.78809e-013, },
+	{ 0.437534, 0.0976947, -0.149352, -0.84969, -0.527283, 9.78809e-013, },
+	{ 0.447911, 0.0788968, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.462817, 0.10883, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.456691, 0.0581832, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.456691, 0.0581832, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.462817, 0.10883, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.463555, 0.0356337, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.463555, 0.0356337, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.462817, 0.10883, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.481675, 0.0726708, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.463555, 0.0356337, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.481675, 0.0726708, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.467986, 0.0114479, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.467986, 0.0114479, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.481675, 0.0726708, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.469462, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.481755, -0.100861, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.469462, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.481675, 0.0726708, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.481755, -0.100861, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.468006, -0.0398971, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.469462, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.481755, -0.100861, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.481675, 0.0726708, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.488624, 0.0532942, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.481755, -0.100861, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.488624, 0.0532942, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.488669, -0.081434, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.488669, -0.081434, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.488624, 0.0532942, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.493588, 0.0323611, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.488669, -0.081434, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.493588, 0.0323611, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.493608, -0.0605109, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.493608, -0.0605109, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.493588, 0.0323611, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.496567, 0.00987145, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.493608, -0.0605109, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.496567, 0.00987145, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.496572, -0.0380911, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.496572, -0.0380911, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.496567, 0.00987145, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.497559, -0.0141747, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.33636, 0.131978, -0.149352, 0.376579, 0.926384, -1.71998e-012, },
+	{ 0.325036, 0.135271, -0.149352, 0.184752, 0.982785, -1.82469e-012, },
+	{ 0.326674, 0.134794, -0.149352, 0.279188, 0.960237, -1.78287e-012, },
+	{ 0.33636, 0.131978, -0.149352, 0.376579, 0.926384, -1.71998e-012, },
+	{ 0.325036, 0.135271, -0.179352, 0.184752, 0.982785, -1.82469e-012, },
+	{ 0.325036, 0.135271, -0.149352, 0.184752, 0.982785, -1.82469e-012, },
+	{ 0.325036, 0.135271, -0.179352, 0.184752, 0.982785, -1.82469e-012, },
+	{ 0.33636, 0.131978, -0.149352, 0.376579, 0.926384, -1.71998e-012, },
+	{ 0.33636, 0.131978, -0.179352, 0.376579, 0.926384, -1.71998e-012, },
+	{ 0.33636, 0.131978, -0.149352, 0.376579, 0.926384, -1.71998e-012, },
+	{ 0.346667, 0.12649, -0.179352, 0.556478, 0.830862, -1.54259e-012, },
+	{ 0.33636, 0.131978, -0.179352, 0.376579, 0.926384, -1.71998e-012, },
+	{ 0.346667, 0.12649, -0.179352, 0.556478, 0.830862, -1.54259e-012, },
+	{ 0.33636, 0.131978, -0.149352, 0.376579, 0.926384, -1.71998e-012, },
+	{ 0.346667, 0.12649, -0.149352, 0.556478, 0.830862, -1.54259e-012, },
+	{ 0.33636, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.338236, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.346667, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.33636, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.326742, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.338236, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.326742, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.33636, 0.131978, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.112102, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.326742, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.112102, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.326674, 0.134794, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.298645, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.112102, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.287151, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.298645, 0.109468, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.279488, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.287151, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.279229, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.279488, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.301608, 0.132876, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.27872, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.279488, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.279229, 0.126762, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.27872, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.276934, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.279488, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.27872, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.26959, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.276934, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.26943, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.26959, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.27872, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.26943, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.261837, 0.0416702, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.26959, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.261748, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.261837, 0.0416702, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.26943, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.261748, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.2563, 0.0519572, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.261837, 0.0416702, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.25626, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.2563, 0.0519572, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.261748, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.25626, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.252977, 0.0633018, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.2563, 0.0519572, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.252967, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.252977, 0.0633018, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.25626, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.252977, 0.0633018, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.252967, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.25187, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.252967, 0.0879765, -0.149352, -0.982629, 0.185582, -3.44553e-013, },
+	{ 0.25187, 0.075704, -0.179352, -1, 6.48887e-005, -1.20473e-016, },
+	{ 0.25187, 0.075704, -0.149352, -1, 6.48887e-005, -1.20473e-016, },
+	{ 0.25187, 0.075704, -0.179352, -1, 6.48887e-005, -1.20473e-016, },
+	{ 0.252967, 0.0879765, -0.149352, -0.982629, 0.185582, -3.44553e-013, },
+	{ 0.252967, 0.0879765, -0.179352, -0.982629, 0.185582, -3.44553e-013, },
+	{ 0.25626, 0.0992512, -0.149352, -0.925933, 0.377687, -7.01219e-013, },
+	{ 0.252967, 0.0879765, -0.179352, -0.982629, 0.185582, -3.44553e-013, },
+	{ 0.252967, 0.0879765, -0.149352, -0.982629, 0.185582, -3.44553e-013, },
+	{ 0.252967, 0.0879765, -0.179352, -0.982629, 0.185582, -3.44553e-013, },
+	{ 0.25626, 0.0992512, -0.149352, -0.925933, 0.377687, -7.01219e-013, },
+	{ 0.25626, 0.0992512, -0.179352, -0.925933, 0.377687, -7.01219e-013, },
+	{ 0.261748, 0.109528, -0.149352, -0.830379, 0.557199, -1.0345e-012, },
+	{ 0.25626, 0.0992512, -0.179352, -0.925933, 0.377687, -7.01219e-013, },
+	{ 0.25626, 0.0992512, -0.149352, -0.925933, 0.377687, -7.01219e-013, },
+	{ 0.25626, 0.0992512, -0.179352, -0.925933, 0.377687, -7.01219e-013, },
+	{ 0.261748, 0.109528, -0.149352, -0.830379, 0.557199, -1.0345e-012, },
+	{ 0.261748, 0.109528, -0.179352, -0.830379, 0.557199, -1.0345e-012, },
+	{ 0.26943, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
+	{ 0.261748, 0.109528, -0.179352, -0.830379, 0.557199, -1.0345e-012, },
+	{ 0.261748, 0.109528, -0.149352, -0.830379, 0.557199, -1.0345e-012, },
+	{ 0.261748, 0.109528, -0.179352, -0.830379, 0.557199, -1.0345e-012, },
+	{ 0.26943, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
+	{ 0.26943, 0.118807, -0.179352, -0.70692, 0.707293, -1.31317e-012, },
+	{ 0.26943, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
+	{ 0.27872, 0.12649, -0.179352, -0.556478, 0.830862, -1.54259e-012, },
+	{ 0.26943, 0.118807, -0.179352, -0.70692, 0.707293, -1.31317e-012, },
+	{ 0.27872, 0.12649, -0.179352, -0.556478, 0.830862, -1.54259e-012, },
+	{ 0.26943, 0.118807, -0.149352, -0.70692, 0.707293, -1.31317e-012, },
+	{ 0.27872, 0.12649, -0.149352, -0.556478, 0.830862, -1.54259e-012, },
+	{ 0.289026, 0.131978, -0.149352, -0.376579, 0.926384, -1.71994e-012, },
+	{ 0.27872, 0.12649, -0.179352, -0.556478, 0.830862, -1.54259e-012, },
+	{ 0.27872, 0.12649, -0.149352, -0.556478, 0.830862, -1.54259e-012, },
+	{ 0.27872, 0.12649, -0.179352, -0.556478, 0.830862, -1.54259e-012, },
+	{ 0.289026, 0.131978, -0.149352, -0.376579, 0.926384, -1.71994e-012, },
+	{ 0.289026, 0.131978, -0.179352, -0.376579, 0.926384, -1.71994e-012, },
+	{ 0.289026, 0.131978, -0.149352, -0.376579, 0.926384, -1.71994e-012, },
+	{ 0.27872, 0.12649, -0.149352, -0.556478, 0.830862, -1.54259e-012, },
+	{ 0.279229, 0.126762, -0.149352, -0.469967, 0.882684, -1.63881e-012, },
+	{ 0.278929, 0.0248279, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.276934, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.26959, 0.0324409, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.276934, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.278929, 0.0248279, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.279548, 0.0613761, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.279548, 0.0613761, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.278929, 0.0248279, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.289226, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.278929, 0.0248279, -0.179352, -0.552115, -0.833768, 1.54798e-012, },
+	{ 0.289226, 0.0193901, -0.149352, -0.374648, -0.927167, 1.72139e-012, },
+	{ 0.278929, 0.0248279, -0.149352, -0.552115, -0.833768, 1.54798e-012, },
+	{ 0.289226, 0.0193901, -0.149352, -0.374648, -0.927167, 1.72139e-012, },
+	{ 0.278929, 0.0248279, -0.179352, -0.552115, -0.833768, 1.54798e-012, },
+	{ 0.289226, 0.0193901, -0.179352, -0.374648, -0.927167, 1.72139e-012, },
+	{ 0.278929, 0.0248279, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.279548, 0.0613761, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.289226, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.289226, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.279548, 0.0613761, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.28739, 0.0496823, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.279548, 0.0613761, -0.179352, 0.926569, 0.376125, -6.98317e-013, },
+	{ 0.28739, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
+	{ 0.28739, 0.0496823, -0.179352, 0.707819, 0.706394, -1.3115e-012, },
+	{ 0.28739, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
+	{ 0.279548, 0.0613761, -0.179352, 0.926569, 0.376125, -6.98317e-013, },
+	{ 0.279548, 0.0613761, -0.149352, 0.926569, 0.376125, -6.98317e-013, },
+	{ 0.279548, 0.0613761, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.289226, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.28739, 0.0496823, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.28739, 0.0496823, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.289226, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.298944, 0.0418997, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.298944, 0.0418997, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.289226, 0.0193901, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.300481, 0.0161274, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.289226, 0.0193901, -0.179352, -0.374648, -0.927167, 1.72139e-012, },
+	{ 0.300481, 0.0161274, -0.149352, -0.184427, -0.982846, 1.82476e-012, },
+	{ 0.289226, 0.0193901, -0.149352, -0.374648, -0.927167, 1.72139e-012, },
+	{ 0.300481, 0.0161274, -0.149352, -0.184427, -0.982846, 1.82476e-012, },
+	{ 0.289226, 0.0193901, -0.179352, -0.374648, -0.927167, 1.72139e-012, },
+	{ 0.300481, 0.0161274, -0.179352, -0.184427, -0.982846, 1.82476e-012, },
+	{ 0.289226, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.298944, 0.0418997, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.300481, 0.0161274, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.289226, 0.0193901, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.28739, 0.0496823, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.298944, 0.0418997, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.28739, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
+	{ 0.298944, 0.0418997, -0.179352, 0.379845, 0.92505, -1.71746e-012, },
+	{ 0.28739, 0.0496823, -0.179352, 0.707819, 0.706394, -1.3115e-012, },
+	{ 0.298944, 0.0418997, -0.179352, 0.379845, 0.92505, -1.71746e-012, },
+	{ 0.28739, 0.0496823, -0.149352, 0.707819, 0.706394, -1.3115e-012, },
+	{ 0.298944, 0.0418997, -0.149352, 0.379845, 0.92505, -1.71746e-012, },
+	{ 0.298944, 0.0418997, -0.149352, 0.379845, 0.92505, -1.71746e-012, },
+	{ 0.312693, 0.0393055, -0.179352, -0.000116454, 1, -1.85661e-012, },
+	{ 0.298944, 0.0418997, -0.179352, 0.379845, 0.92505, -1.71746e-012, },
+	{ 0.312693, 0.0393055, -0.179352, -0.000116454, 1, -1.85661e-012, },
+	{ 0.298944, 0.0418997, -0.149352, 0.379845, 0.92505, -1.71746e-012, },
+	{ 0.312693, 0.0393055, -0.149352, -0.000116454, 1, -1.85661e-012, },
+	{ 0.298944, 0.0418997, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.300481, 0.0161274, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.300481, 0.0161274, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.0150399, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.300481, 0.0161274, -0.179352, -0.184427, -0.982846, 1.82476e-012, },
+	{ 0.312693, 0.0150399, -0.149352, -6.3234e-005, -1, 1.85661e-012, },
+	{ 0.300481, 0.0161274, -0.149352, -0.184427, -0.982846, 1.82476e-012, },
+	{ 0.312693, 0.0150399, -0.149352, -6.3234e-005, -1, 1.85661e-012, },
+	{ 0.300481, 0.0161274, -0.179352, -0.184427, -0.982846, 1.82476e-012, },
+	{ 0.312693, 0.0150399, -0.179352, -6.3234e-005, -1, 1.85661e-012, },
+	{ 0.300481, 0.0161274, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.312693, 0.0393055, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.312693, 0.0150399, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.300481, 0.0161274, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.298944, 0.0418997, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.312693, 0.0393055, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.312693, 0.0150399, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.312693, 0.0393055, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.326742, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.312693, 0.0393055, -0.149352, -0.000116454, 1, -1.85661e-012, },
+	{ 0.326742, 0.0419596, -0.179352, -0.385978, 0.922508, -1.71274e-012, },
+	{ 0.312693, 0.0393055, -0.179352, -0.000116454, 1, -1.85661e-012, },
+	{ 0.326742, 0.0419596, -0.179352, -0.385978, 0.922508, -1.71274e-012, },
+	{ 0.312693, 0.0393055, -0.149352, -0.000116454, 1, -1.85661e-012, },
+	{ 0.326742, 0.0419596, -0.149352, -0.385978, 0.922508, -1.71274e-012, },
+	{ 0.312693, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.325036, 0.0161374, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.326742, 0.0419596, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.0393055, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.0150399, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.325036, 0.0161374, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.312693, 0.0150399, -0.179352, -6.3234e-005, -1, 1.85661e-012, },
+	{ 0.325036, 0.0161374, -0.149352, 0.184752, -0.982785, 1.82465e-012, },
+	{ 0.312693, 0.0150399, -0.149352, -6.3234e-005, -1, 1.85661e-012, },
+	{ 0.325036, 0.0161374, -0.149352, 0.184752, -0.982785, 1.82465e-012, },
+	{ 0.312693, 0.0150399, -0.179352, -6.3234e-005, -1, 1.85661e-012, },
+	{ 0.325036, 0.0161374, -0.179352, 0.184752, -0.982785, 1.82465e-012, },
+	{ 0.312693, 0.0150399, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.326742, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.325036, 0.0161374, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.325036, 0.0161374, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.326742, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.33636, 0.01943, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.33636, 0.01943, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.326742, 0.0419596, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.338236, 0.0499217, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.326742, 0.0419596, -0.149352, -0.385978, 0.922508, -1.71274e-012, },
+	{ 0.338236, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
+	{ 0.326742, 0.0419596, -0.179352, -0.385978, 0.922508, -1.71274e-012, },
+	{ 0.338236, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
+	{ 0.326742, 0.0419596, -0.149352, -0.385978, 0.922508, -1.71274e-012, },
+	{ 0.338236, 0.0499217, -0.149352, -0.716961, 0.697114, -1.29427e-012, },
+	{ 0.326742, 0.0419596, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.33636, 0.01943, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.338236, 0.0499217, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.326742, 0.0419596, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.325036, 0.0161374, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.33636, 0.01943, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.325036, 0.0161374, -0.179352, 0.184752, -0.982785, 1.82465e-012, },
+	{ 0.33636, 0.01943, -0.149352, 0.376579, -0.926384, 1.71994e-012, },
+	{ 0.325036, 0.0161374, -0.149352, 0.184752, -0.982785, 1.82465e-012, },
+	{ 0.33636, 0.01943, -0.149352, 0.376579, -0.926384, 1.71994e-012, },
+	{ 0.325036, 0.0161374, -0.179352, 0.184752, -0.982785, 1.82465e-012, },
+	{ 0.33636, 0.01943, -0.179352, 0.376579, -0.926384, 1.71994e-012, },
+	{ 0.33636, 0.01943, -0.179352, 0.376579, -0.926384, 1.71994e-012, },
+	{ 0.346667, 0.0249177, -0.149352, 0.556478, -0.830862, 1.54259e-012, },
+	{ 0.33636, 0.01943, -0.149352, 0.376579, -0.926384, 1.71994e-012, },
+	{ 0.346667, 0.0249177, -0.149352, 0.556478, -0.830862, 1.54259e-012, },
+	{ 0.33636, 0.01943, -0.179352, 0.376579, -0.926384, 1.71994e-012, },
+	{ 0.346667, 0.0249177, -0.179352, 0.556478, -0.830862, 1.54259e-012, },
+	{ 0.33636, 0.01943, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.338236, 0.0499217, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.346667, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.346667, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.338236, 0.0499217, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.345899, 0.0616754, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.338236, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
+	{ 0.345899, 0.0616754, -0.149352, -0.929063, 0.369922, -6.86802e-013, },
+	{ 0.345899, 0.0616754, -0.179352, -0.929063, 0.369922, -6.86802e-013, },
+	{ 0.345899, 0.0616754, -0.149352, -0.929063, 0.369922, -6.86802e-013, },
+	{ 0.338236, 0.0499217, -0.179352, -0.716961, 0.697114, -1.29427e-012, },
+	{ 0.338236, 0.0499217, -0.149352, -0.716961, 0.697114, -1.29427e-012, },
+	{ 0.338236, 0.0499217, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.346667, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.345899, 0.0616754, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.338236, 0.0499217, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.33636, 0.01943, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.346667, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.345899, 0.0616754, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.346667, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.348453, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.348453, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.346667, 0.0249177, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.355957, 0.0326005, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.346667, 0.0249177, -0.179352, 0.556478, -0.830862, 1.54259e-012, },
+	{ 0.355957, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
+	{ 0.346667, 0.0249177, -0.149352, 0.556478, -0.830862, 1.54259e-012, },
+	{ 0.355957, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
+	{ 0.346667, 0.0249177, -0.179352, 0.556478, -0.830862, 1.54259e-012, },
+	{ 0.355957, 0.0326005, -0.179352, 0.70692, -0.707293, 1.31317e-012, },
+	{ 0.346667, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.348453, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.355957, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.346667, 0.0249177, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.345899, 0.0616754, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.348453, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.345899, 0.0616754, -0.179352, -0.929063, 0.369922, -6.86802e-013, },
+	{ 0.348453, 0.075704, -0.149352, -1, 0.000622437, -1.15562e-015, },
+	{ 0.348453, 0.075704, -0.179352, -1, 0.000622437, -1.15562e-015, },
+	{ 0.348453, 0.075704, -0.149352, -1, 0.000622437, -1.15562e-015, },
+	{ 0.345899, 0.0616754, -0.179352, -0.929063, 0.369922, -6.86802e-013, },
+	{ 0.345899, 0.0616754, -0.149352, -0.929063, 0.369922, -6.86802e-013, },
+	{ 0.345899, 0.0898323, -0.149352, -0.929149, -0.369705, 6.86399e-013, },
+	{ 0.348453, 0.075704, -0.179352, -1, 0.000622437, -1.15562e-015, },
+	{ 0.348453, 0.075704, -0.149352, -1, 0.000622437, -1.15562e-015, },
+	{ 0.348453, 0.075704, -0.179352, -1, 0.000622437, -1.15562e-015, },
+	{ 0.345899, 0.0898323, -0.149352, -0.929149, -0.369705, 6.86399e-013, },
+	{ 0.345899, 0.0898323, -0.179352, -0.929149, -0.369705, 6.86399e-013, },
+	{ 0.338236, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
+	{ 0.345899, 0.0898323, -0.179352, -0.929149, -0.369705, 6.86399e-013, },
+	{ 0.345899, 0.0898323, -0.149352, -0.929149, -0.369705, 6.86399e-013, },
+	{ 0.345899, 0.0898323, -0.179352, -0.929149, -0.369705, 6.86399e-013, },
+	{ 0.338236, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
+	{ 0.338236, 0.101566, -0.179352, -0.715458, -0.698656, 1.29713e-012, },
+	{ 0.338236, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
+	{ 0.326742, 0.109468, -0.179352, -0.383717, -0.923451, 1.71449e-012, },
+	{ 0.338236, 0.101566, -0.179352, -0.715458, -0.698656, 1.29713e-012, },
+	{ 0.326742, 0.109468, -0.179352, -0.383717, -0.923451, 1.71449e-012, },
+	{ 0.338236, 0.101566, -0.149352, -0.715458, -0.698656, 1.29713e-012, },
+	{ 0.326742, 0.109468, -0.149352, -0.383717, -0.923451, 1.71449e-012, },
+	{ 0.326742, 0.109468, -0.149352, -0.383717, -0.923451, 1.71449e-012, },
+	{ 0.312693, 0.112102, -0.179352, 1.17193e-015, -1, 1.85661e-012, },
+	{ 0.326742, 0.109468, -0.179352, -0.383717, -0.923451, 1.71449e-012, },
+	{ 0.312693, 0.112102, -0.179352, 1.17193e-015, -1, 1.85661e-012, },
+	{ 0.326742, 0.109468, -0.149352, -0.383717, -0.923451, 1.71449e-012, },
+	{ 0.312693, 0.112102, -0.149352, 1.17193e-015, -1, 1.85661e-012, },
+	{ 0.312693, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.325036, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.326742, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.312693, 0.112102, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.312693, 0.136368, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.325036, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.312693, 0.136368, -0.149352, -3.20449e-016, 1, -1.85661e-012, },
+	{ 0.325036, 0.135271, -0.179352, 0.184752, 0.982785, -1.82469e-012, },
+	{ 0.312693, 0.136368, -0.179352, -3.20449e-016, 1, -1.85661e-012, },
+	{ 0.325036, 0.135271, -0.179352, 0.184752, 0.982785, -1.82469e-012, },
+	{ 0.312693, 0.136368, -0.149352, -3.20449e-016, 1, -1.85661e-012, },
+	{ 0.325036, 0.135271, -0.149352, 0.184752, 0.982785, -1.82469e-012, },
+	{ 0.326742, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.325036, 0.135271, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.33636, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.326742, 0.109468, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.33636, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.338236, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.338236, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.33636, 0.131978, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.346667, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.338236, 0.101566, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.346667, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.345899, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.345899, 0.0898323, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.346667, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.348453, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.348453, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.346667, 0.12649, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.355957, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.346667, 0.12649, -0.149352, 0.556478, 0.830862, -1.54259e-012, },
+	{ 0.355957, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
+	{ 0.346667, 0.12649, -0.179352, 0.556478, 0.830862, -1.54259e-012, },
+	{ 0.355957, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
+	{ 0.346667, 0.12649, -0.149352, 0.556478, 0.830862, -1.54259e-012, },
+	{ 0.355957, 0.118807, -0.149352, 0.70692, 0.707293, -1.31317e-012, },
+	{ 0.346667, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.348453, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.355957, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.346667, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.345899, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.348453, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.346667, 0.12649, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.338236, 0.101566, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.345899, 0.0898323, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.355957, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.348453, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.355957, 0.0326005, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.355957, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.355957, 0.0326005, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.363639, 0.0418797, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.355957, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
+	{ 0.363639, 0.0418797, -0.179352, 0.830379, -0.557199, 1.0345e-012, },
+	{ 0.363639, 0.0418797, -0.149352, 0.830379, -0.557199, 1.0345e-012, },
+	{ 0.363639, 0.0418797, -0.179352, 0.830379, -0.557199, 1.0345e-012, },
+	{ 0.355957, 0.0326005, -0.149352, 0.70692, -0.707293, 1.31317e-012, },
+	{ 0.355957, 0.0326005, -0.179352, 0.70692, -0.707293, 1.31317e-012, },
+	{ 0.355957, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.363639, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.363639, 0.0418797, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.355957, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.355957, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.363639, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.355957, 0.0326005, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.348453, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.355957, 0.118807, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.355957, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
+	{ 0.363639, 0.109528, -0.149352, 0.830379, 0.557199, -1.0345e-012, },
+	{ 0.363639, 0.109528, -0.179352, 0.830379, 0.557199, -1.0345e-012, },
+	{ 0.363639, 0.109528, -0.149352, 0.830379, 0.557199, -1.0345e-012, },
+	{ 0.355957, 0.118807, -0.179352, 0.70692, 0.707293, -1.31317e-012, },
+	{ 0.355957, 0.118807, -0.149352, 0.70692, 0.707293, -1.31317e-012, },
+	{ 0.355957, 0.118807, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.363639, 0.0418797, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.363639, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.363639, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.363639, 0.0418797, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.369127, 0.0521567, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.363639, 0.0418797, -0.149352, 0.830379, -0.557199, 1.0345e-012, },
+	{ 0.369127, 0.0521567, -0.179352, 0.925933, -0.377687, 7.01219e-013, },
+	{ 0.369127, 0.0521567, -0.149352, 0.925933, -0.377687, 7.01219e-013, },
+	{ 0.369127, 0.0521567, -0.179352, 0.925933, -0.377687, 7.01219e-013, },
+	{ 0.363639, 0.0418797, -0.149352, 0.830379, -0.557199, 1.0345e-012, },
+	{ 0.363639, 0.0418797, -0.179352, 0.830379, -0.557199, 1.0345e-012, },
+	{ 0.363639, 0.0418797, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.369127, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.369127, 0.0521567, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.363639, 0.0418797, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.363639, 0.109528, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.369127, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.363639, 0.109528, -0.179352, 0.830379, 0.557199, -1.0345e-012, },
+	{ 0.369127, 0.0992512, -0.149352, 0.925933, 0.377687, -7.01219e-013, },
+	{ 0.369127, 0.0992512, -0.179352, 0.925933, 0.377687, -7.01219e-013, },
+	{ 0.369127, 0.0992512, -0.149352, 0.925933, 0.377687, -7.01219e-013, },
+	{ 0.363639, 0.109528, -0.179352, 0.830379, 0.557199, -1.0345e-012, },
+	{ 0.363639, 0.109528, -0.149352, 0.830379, 0.557199, -1.0345e-012, },
+	{ 0.363639, 0.109528, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.369127, 0.0521567, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.369127, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.369127, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.369127, 0.0521567, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.37242, 0.0634315, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.369127, 0.0521567, -0.149352, 0.925933, -0.377687, 7.01219e-013, },
+	{ 0.37242, 0.0634315, -0.179352, 0.982629, -0.185582, 3.44553e-013, },
+	{ 0.37242, 0.0634315, -0.149352, 0.982629, -0.185582, 3.44553e-013, },
+	{ 0.37242, 0.0634315, -0.179352, 0.982629, -0.185582, 3.44553e-013, },
+	{ 0.369127, 0.0521567, -0.149352, 0.925933, -0.377687, 7.01219e-013, },
+	{ 0.369127, 0.0521567, -0.179352, 0.925933, -0.377687, 7.01219e-013, },
+	{ 0.369127, 0.0521567, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.37242, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.37242, 0.0634315, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.369127, 0.0521567, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.369127, 0.0992512, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.37242, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.369127, 0.0992512, -0.179352, 0.925933, 0.377687, -7.01219e-013, },
+	{ 0.37242, 0.0879765, -0.149352, 0.982629, 0.185582, -3.44553e-013, },
+	{ 0.37242, 0.0879765, -0.179352, 0.982629, 0.185582, -3.44553e-013, },
+	{ 0.37242, 0.0879765, -0.149352, 0.982629, 0.185582, -3.44553e-013, },
+	{ 0.369127, 0.0992512, -0.179352, 0.925933, 0.377687, -7.01219e-013, },
+	{ 0.369127, 0.0992512, -0.149352, 0.925933, 0.377687, -7.01219e-013, },
+	{ 0.369127, 0.0992512, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.37242, 0.0634315, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.37242, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.37242, 0.0879765, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.37242, 0.0634315, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.373517, 0.075704, -0.149352, 0, 1.85661e-012, 1, },
+	{ 0.37242, 0.0634315, -0.149352, 0.982629, -0.185582, 3.44553e-013, },
+	{ 0.373517, 0.075704, -0.179352, 1, -1.60231e-016, 2.97488e-028, },
+	{ 0.373517, 0.075704, -0.149352, 1, -1.60231e-016, 2.97488e-028, },
+	{ 0.373517, 0.075704, -0.179352, 1, -1.60231e-016, 2.97488e-028, },
+	{ 0.37242, 0.0634315, -0.149352, 0.982629, -0.185582, 3.44553e-013, },
+	{ 0.37242, 0.0634315, -0.179352, 0.982629, -0.185582, 3.44553e-013, },
+	{ 0.37242, 0.0634315, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.37242, 0.0879765, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.373517, 0.075704, -0.179352, 0, -1.85661e-012, -1, },
+	{ 0.37242, 0.0879765, -0.179352, 0.982629, 0.185582, -3.44553e-013, },
+	{ 0.373517, 0.075704, -0.149352, 1, -1.60231e-016, 2.97488e-028, },
+	{ 0.373517, 0.075704, -0.179352, 1, -1.60231e-016, 2.97488e-028, },
+	{ 0.373517, 0.075704, -0.149352, 1, -1.60231e-016, 2.97488e-028, },
+	{ 0.37242, 0.0879765, -0.179352, 0.982629, 0.185582, -3.44553e-013, },
+	{ 0.37242, 0.0879765, -0.149352, 0.982629, 0.185582, -3.44553e-013, },
+	{ 0.258974, 0.140479, -0.179352, -0.433645, 0.901084, -1.67296e-012, },
+	{ 0.243912, 0.131926, -0.149352, -0.554528, 0.832165, -1.54501e-012, },
+	{ 0.258974, 0.140479, -0.149352, -0.433645, 0.901084, -1.67296e-012, },
+	{ 0.243912, 0.131926, -0.149352, -0.554528, 0.832165, -1.54501e-012, },
+	{ 0.258974, 0.140479, -0.179352, -0.433645, 0.901084, -1.67296e-012, },
+	{ 0.243912, 0.131926, -0.179352, -0.554528, 0.832165, -1.54501e-012, },
+};
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+#
+# packlenny.py: converts the unindexed float "triangle soup" in lenny_soup.c into the
+# indexed, quantised mesh compiled in as source/lenny.c
+#
+# Usage:
+#   packlenny.py tools/lenny_soup.c source/lenny.c
+#
+# Vertices are deduplicated after quantisation and emitted in order of first use. Each
+# packed vertex is 12 bytes (versus 24): half-float position (x,y,z,1) and a normal in the
+# GL_INT_2_10_10_10_REV format (signed normalised, w unused).
+#
+import re
+import struct
+import sys
+
+def half_bits(x):
+    return struct.unpack('<H', struct.pack('<e', x))[0]
+
+def snorm10(x):
+    return max(-511, min(511, round(x * 511))) & 0x3FF
+
+def pack_normal(nx, ny, nz):
+    return snorm10(nx) | (snorm10(ny) << 10) | (snorm10(nz) << 20)
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: %s input.c output.c' % sys.argv[0])
+
+    with open(sys.argv[1]) as f:
+        src = f.read()
+    soup = [tuple(float(v) for v in m.group(1).split(',') if v.strip())
+        for m in re.finditer(r'\{([^{}]*)\}', src)]
+    if not soup or any(len(v) != 6 for v in soup) or len(soup) % 3:
+        sys.exit('%s: expected a list of triangles made out of 6-float vertices' % sys.argv[1])
+
+    vertices = []
+    indices = []
+    remap = {}
+    for v in soup:
+        key = (half_bits(v[0]), half_bits(v[1]), half_bits(v[2]), half_bits(1.0), pack_normal(*v[3:6]))
+        if key not in remap:
+            remap[key] = len(vertices)
+            vertices.append(key)
+        indices.append(remap[key])
+    if len(vertices) > 0x10000:
+        sys.exit('too many unique vertices for 16-bit indices')
+
+    with open(sys.argv[2], 'w') as f:
+        f.write('// Generated by tools/packlenny.py from tools/lenny_soup.c, do not edit\n')
+        f.write('#include "lenny.h"\n\n')
+        f.write('const lennyVertex lennyVertices[%u] =\n{\n' % len(vertices))
+        for v in vertices:
+            f.write('\t{ 0x%04x, 0x%04x, 0x%04x, 0x%04x, 0x%08x },\n' % v)
+        f.write('};\n\n')
+        f.write('const uint16_t lennyIndices[%u] =\n{\n' % len(indices))
+        for i in range(0, len(indices), 12):
+            f.write('\t' + ' '.join('%u,' % x for x in indices[i:i+12]) + '\n')
+        f.write('};\n')
+
+    print('%s: %u vertices -> %u unique + %u indices, %u -> %u bytes' % (sys.argv[2],
+        len(soup), len(vertices), len(indices), len(soup)*24, len(vertices)*12 + len(indices)*2))
+
+if __name__ == '__main__':
+    main()
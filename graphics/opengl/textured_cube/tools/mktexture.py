@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+#
+# mktexture.py: converts a PNG into the precompressed, mip-mapped texture compiled in
+# as data/devkitlenny_bc1.bin
+#
+# Usage:
+#   mktexture.py tools/devkitlenny.png data/devkitlenny_bc1.bin
+#
+# The image is flipped vertically (OpenGL expects the bottom row first), a full mip chain
+# is built with a box filter, and every level is encoded as BC1 (DXT1, 4 bits per texel,
+# uploaded with GL_COMPRESSED_RGB_S3TC_DXT1_EXT). Only 8-bit RGB and RGBA images are
+# supported; the alpha channel is dropped.
+#
+# File layout (little endian): header {magic, GL internal format, width, height,
+# number of levels}, followed by one {offset, size} pair per level, followed by the
+# level data.
+#
+import struct
+import sys
+import zlib
+
+TEXTURE_MAGIC = 0x58544C47 # 'GLTX'
+GL_COMPRESSED_RGB_S3TC_DXT1_EXT = 0x83F0
+
+HEADER = struct.Struct('<5I')
+LEVEL = struct.Struct('<2I')
+
+def read_png(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        sys.exit('%s: not a PNG file' % path)
+
+    pos, idat = 8, b''
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos+8])
+        chunk = data[pos+8:pos+8+length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'IDAT':
+            idat += chunk
+    if depth != 8 or color not in (2, 6) or interlace:
+        sys.exit('%s: only non-interlaced 8-bit RGB/RGBA images are supported' % path)
+
+    # Undo the per-scanline filters
+    bpp = 3 if color == 2 else 4
+    stride = width * bpp
+    raw = zlib.decompress(idat)
+    rows, prev = [], bytearray(stride)
+    for y in range(height):
+        ftype = raw[y*(stride+1)]
+        line = bytearray(raw[y*(stride+1)+1:(y+1)*(stride+1)])
+        for i in range(stride):
+            a = line[i-bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i-bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        rows.append(line)
+        prev = line
+
+    pixels = [[tuple(line[x*bpp:x*bpp+3]) for x in range(width)] for line in rows]
+    return width, height, pixels
+
+def downsample(pixels, width, height):
+    nw, nh = max(width // 2, 1), max(height // 2, 1)
+    out = []
+    for y in range(nh):
+        y0, y1 = min(2*y, height-1), min(2*y+1, height-1)
+        row = []
+        for x in range(nw):
+            x0, x1 = min(2*x, width-1), min(2*x+1, width-1)
+            quad = (pixels[y0][x0], pixels[y0][x1], pixels[y1][x0], pixels[y1][x1])
+            row.append(tuple((sum(p[c] for p in quad) + 2) // 4 for c in range(3)))
+        out.append(row)
+    return out, nw, nh
+
+def to_565(c):
+    return ((c[0] * 31 + 127) // 255) << 11 | ((c[1] * 63 + 127) // 255) << 5 | ((c[2] * 31 + 127) // 255)
+
+def from_565(v):
+    r, g, b = v >> 11, (v >> 5) & 0x3F, v & 0x1F
+    return ((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2))
+
+def encode_bc1_block(block):
+    # Pick the endpoints along a diagonal of the colour bounding box, chosen by the sign of
+    # the covariance against the widest channel, and inset them slightly to reduce the
+    # error at the extremes
+    lo = [min(p[c] for p in block) for c in range(3)]
+    hi = [max(p[c] for p in block) for c in range(3)]
+    mean = [sum(p[c] for p in block) / 16.0 for c in range(3)]
+    k = max(range(3), key=lambda c: hi[c] - lo[c])
+    for c in range(3):
+        if c != k and sum((p[k] - mean[k]) * (p[c] - mean[c]) for p in block) < 0:
+            lo[c], hi[c] = hi[c], lo[c]
+    inset = [(h - l) / 16.0 for l, h in zip(lo, hi)]
+    c0 = to_565([max(0, min(255, round(h - d))) for h, d in zip(hi, inset)])
+    c1 = to_565([max(0, min(255, round(l + d))) for l, d in zip(lo, inset)])
+
+    if c0 == c1:
+        return struct.pack('<2HI', c0, c1, 0)
+    if c0 < c1:
+        # The four colour mode needs c0 > c1
+        c0, c1 = c1, c0
+
+    e0, e1 = from_565(c0), from_565(c1)
+    palette = (e0, e1,
+        tuple((2*a + b + 1) // 3 for a, b in zip(e0, e1)),
+        tuple((a + 2*b + 1) // 3 for a, b in zip(e0, e1)))
+    indices = 0
+    for i, p in enumerate(block):
+        best = min(range(4), key=lambda k: sum((p[c] - palette[k][c]) ** 2 for c in range(3)))
+        indices |= best << (2*i)
+    return struct.pack('<2HI', c0, c1, indices)
+
+def encode_bc1(pixels, width, height):
+    out = bytearray()
+    for by in range(0, height, 4):
+        for bx in range(0, width, 4):
+            # Levels smaller than a block replicate their edge texels
+            block = [pixels[min(by+y, height-1)][min(bx+x, width-1)] for y in range(4) for x in range(4)]
+            out += encode_bc1_block(block)
+    return bytes(out)
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: %s input.png output.bin' % sys.argv[0])
+
+    width, height, pixels = read_png(sys.argv[1])
+    pixels.reverse()
+
+    levels = []
+    w, h = width, height
+    while True:
+        levels.append(encode_bc1(pixels, w, h))
+        if w == 1 and h == 1:
+            break
+        pixels, w, h = downsample(pixels, w, h)
+
+    offset = HEADER.size + LEVEL.size * len(levels)
+    table = b''
+    for level in levels:
+        table += LEVEL.pack(offset, len(level))
+        offset += len(level)
+
+    with open(sys.argv[2], 'wb') as f:
+        f.write(HEADER.pack(TEXTURE_MAGIC, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, width, height, len(levels)))
+        f.write(table)
+        for level in levels:
+            f.write(level)
+
+    print('%s: %ux%u, %u levels, %u bytes (RGBA8 level 0 alone: %u bytes)' % (
+        sys.argv[2], width, height, len(levels), offset, width * height * 4))
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,175 @@
+// Console output throughput benchmark.
+// A few fixed corpora are printed to the console, a fixed number of lines per frame, and for
+// each of them the number of characters printed per second and the frame times are reported.
+// The console backend is chosen when building (make RENDERER=software|gl|deko3d), so that the
+// same corpora can be compared across the libnx software console and the GPU renderers.
+// The results are shown once all corpora are done, and are also appended to a CSV file on
+// the SD card. Press A to run the benchmark again, PLUS to exit.
+#include <string.h>
+#include <stdio.h>
+
+#include <switch.h>
+
+#ifndef CONSOLE_RENDERER
+#define CONSOLE_RENDERER "software"
+#endif
+
+#define WARMUP_FRAMES  30
+#define MEASURE_FRAMES 240
+
+#define CSV_PATH "sdmc:/switch/console_benchmark.csv"
+
+// Short log lines, the common case
+static int printShortLine(unsigned i)
+{
+    return printf("[%6u] frame ok\n", i);
+}
+
+// Lines longer than the console, which wrap over several rows
+static int printLongLine(unsigned i)
+{
+    return printf("[%6u] %s%s%s\n", i,
+        "The quick brown fox jumps over the lazy dog, then does it all over again. ",
+        "Pack my box with five dozen liquor jugs, and sphinx of black quartz, judge my vow. ",
+        "How vexingly quick daft zebras jump; the five boxing wizards jump quickly.");
+}
+
+// Colours, attributes and cursor movement, as in the vt52-demo sample
+static int printEscapeLine(unsigned i)
+{
+    int color = 30 + (i & 7);
+    int len = printf(CONSOLE_ESC(%d;1m) "Default "
+        CONSOLE_ESC(1m) "Bold "
+        CONSOLE_ESC(7m) "Reversed "
+        CONSOLE_ESC(0m) CONSOLE_ESC(%dm)
+        CONSOLE_ESC(2m) "Light "
+        CONSOLE_ESC(7m) "Reversed "
+        CONSOLE_ESC(0m), color, color);
+    len += printf(CONSOLE_ESC(s) CONSOLE_ESC(1;60H) CONSOLE_ESC(%dm) "[%6u]" CONSOLE_ESC(u) CONSOLE_ESC(0m) "\n", color, i);
+    return len;
+}
+
+typedef struct {
+    const char* name;
+    unsigned linesPerFrame;
+    int (*printLine)(unsigned i);
+} Corpus;
+
+static const Corpus s_corpora[] = {
+    { "short lines",  64, printShortLine  },
+    { "long lines",   16, printLongLine   },
+    { "escape codes", 32, printEscapeLine },
+};
+
+#define NUM_CORPORA (sizeof(s_corpora)/sizeof(s_corpora[0]))
+
+typedef struct {
+    u64 chars;
+    u64 printNs;   // time spent printing, i.e. in the console renderer
+    u64 updateNs;  // time spent in consoleUpdate, i.e. flushing and presenting the frame
+    u64 frameNs;
+    u64 maxFrameNs;
+} CorpusStats;
+
+static CorpusStats s_stats[NUM_CORPORA];
+
+static void runCorpus(const Corpus* corpus, CorpusStats* stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    printf(CONSOLE_ESC(2J));
+    consoleUpdate(NULL);
+
+    unsigned line = 0;
+    u64 lastTick = armGetSystemTick();
+    for (unsigned frame = 0; frame < WARMUP_FRAMES + MEASURE_FRAMES && appletMainLoop(); frame ++) {
+        u64 chars = 0;
+        u64 startTick = armGetSystemTick();
+        for (unsigned i = 0; i < corpus->linesPerFrame; i ++)
+            chars += corpus->printLine(line++);
+        fflush(stdout);
+        u64 printTick = armGetSystemTick();
+        consoleUpdate(NULL);
+        u64 endTick = armGetSystemTick();
+
+        u64 frameNs = armTicksToNs(endTick - lastTick);
+        lastTick = endTick;
+        if (frame < WARMUP_FRAMES)
+            continue;
+
+        stats->chars += chars;
+        stats->printNs += armTicksToNs(printTick - startTick);
+        stats->updateNs += armTicksToNs(endTick - printTick);
+        stats->frameNs += frameNs;
+        if (frameNs > stats->maxFrameNs)
+            stats->maxFrameNs = frameNs;
+    }
+}
+
+static void printResults(void)
+{
+    printf(CONSOLE_ESC(2J) CONSOLE_ESC(0m));
+    printf("Console benchmark, renderer: %s, %u frames per corpus\n\n", CONSOLE_RENDERER, MEASURE_FRAMES);
+    printf("%-14s %12s %10s %10s %10s %10s\n", "corpus", "chars/s", "print ms", "update ms", "frame ms", "max ms");
+    for (unsigned i = 0; i < NUM_CORPORA; i ++) {
+        const CorpusStats* stats = &s_stats[i];
+        double printSecs = stats->printNs / 1e9;
+        printf("%-14s %12.0f %10.3f %10.3f %10.3f %10.3f\n", s_corpora[i].name,
+            printSecs > 0.0 ? stats->chars / printSecs : 0.0,
+            stats->printNs / (1e6 * MEASURE_FRAMES),
+            stats->updateNs / (1e6 * MEASURE_FRAMES),
+            stats->frameNs / (1e6 * MEASURE_FRAMES),
+            stats->maxFrameNs / 1e6);
+    }
+    printf("\nchars/s only counts the time spent printing.\n");
+
+    // Append the results to the CSV file, writing the header if it is new
+    FILE* f = fopen(CSV_PATH, "a");
+    if (f) {
+        fseek(f, 0, SEEK_END);
+        if (ftell(f) == 0)
+            fprintf(f, "renderer,corpus,chars,print_ns,update_ns,frame_ns,max_frame_ns,frames\n");
+        for (unsigned i = 0; i < NUM_CORPORA; i ++) {
+            const CorpusStats* stats = &s_stats[i];
+            fprintf(f, "%s,%s,%lu,%lu,%lu,%lu,%lu,%u\n", CONSOLE_RENDERER, s_corpora[i].name,
+                stats->chars, stats->printNs, stats->updateNs, stats->frameNs, stats->maxFrameNs, MEASURE_FRAMES);
+        }
+        fclose(f);
+        printf("Results appended to " CSV_PATH "\n");
+    }
+
+    printf("\nPress A to run again, PLUS to exit.\n");
+}
+
+static void runBenchmark(void)
+{
+    for (unsigned i = 0; i < NUM_CORPORA; i ++)
+        runCorpus(&s_corpora[i], &s_stats[i]);
+    printResults();
+}
+
+int main(int argc, char **argv)
+{
+    consoleInit(NULL);
+
+    runBenchmark();
+
+    // Main loop
+    while(appletMainLoop())
+    {
+        //Scan all the inputs. This should be done once for each frame
+        hidScanInput();
+
+        //hidKeysDown returns information about which buttons have been just pressed (and they weren't in the previous frame)
+        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+
+        if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
+
+        if (kDown & KEY_A)
+            runBenchmark();
+
+        consoleUpdate(NULL);
+    }
+
+    consoleExit(NULL);
+    return 0;
+}
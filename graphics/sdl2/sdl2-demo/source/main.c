@@ -42,10 +42,137 @@
 #define SCREEN_W 1280
 #define SCREEN_H 720
 
+// sprite benchmark: the sprite count grows until frames get missed
+#define BENCH_MAX_SPRITES    100000
+#define BENCH_START_SPRITES  100
+#define BENCH_SETTLE_FRAMES  10   // frames ignored after each change of the sprite count
+#define BENCH_MEASURE_FRAMES 120
+#define BENCH_MAX_MISSED     2    // misses tolerated per measurement
+#define FRAME_MS             (1000.0 / 60.0)
+
+typedef struct {
+    SDL_Rect rect;
+    int vel_x, vel_y;
+} Sprite;
+
+typedef struct {
+    int active;
+    int count;       // sprites currently drawn
+    int best;        // highest count which didn't miss frames
+    int frames;
+    int missed;
+    double total_ms;
+    Uint64 last;
+    Sprite *sprites;
+} Benchmark;
+
 int rand_range(int min, int max){
    return min + rand() / (RAND_MAX / (max - min + 1) + 1);
 }
 
+SDL_Renderer *create_renderer(SDL_Window *window, int accelerated) {
+    // let SDL merge consecutive draws sharing the same texture and state into a single GPU draw
+    SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+
+    SDL_Renderer *renderer = accelerated
+        ? SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC)
+        : SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+
+    SDL_RendererInfo info;
+    if (renderer && SDL_GetRendererInfo(renderer, &info) == 0)
+        printf("renderer: %s%s\n", info.name, (info.flags & SDL_RENDERER_PRESENTVSYNC) ? " (vsync)" : "");
+    else if (!renderer)
+        printf("SDL_CreateRenderer: %s\n", SDL_GetError());
+    return renderer;
+}
+
+SDL_Texture *load_texture(SDL_Renderer *renderer, const char *path, SDL_Rect *size) {
+    SDL_Texture *tex = NULL;
+    SDL_Surface *surface = IMG_Load(path);
+    if (surface) {
+        size->w = surface->w;
+        size->h = surface->h;
+        tex = SDL_CreateTextureFromSurface(renderer, surface);
+        SDL_FreeSurface(surface);
+    }
+    return tex;
+}
+
+void bench_set_count(Benchmark *bench, int count, int w, int h) {
+    for (int i = bench->count; i < count; i++) {
+        Sprite *s = &bench->sprites[i];
+        s->rect.w = w;
+        s->rect.h = h;
+        s->rect.x = rand_range(0, SCREEN_W - w);
+        s->rect.y = rand_range(0, SCREEN_H - h);
+        s->vel_x = rand_range(1, 5) * (rand() & 1 ? 1 : -1);
+        s->vel_y = rand_range(1, 5) * (rand() & 1 ? 1 : -1);
+    }
+    bench->count = count;
+    bench->frames = 0;
+    bench->missed = 0;
+    bench->total_ms = 0.0;
+}
+
+void bench_start(Benchmark *bench, int w, int h) {
+    if (!bench->sprites)
+        bench->sprites = malloc(BENCH_MAX_SPRITES * sizeof(Sprite));
+    if (!bench->sprites)
+        return;
+
+    printf("benchmark: starting\n");
+    bench->active = 1;
+    bench->best = 0;
+    bench->count = 0;
+    bench->last = SDL_GetPerformanceCounter();
+    bench_set_count(bench, BENCH_START_SPRITES, w, h);
+}
+
+// called once per presented frame, grows the sprite count after every measurement without missed frames
+void bench_frame(Benchmark *bench, int w, int h) {
+    Uint64 now = SDL_GetPerformanceCounter();
+    double ms = (now - bench->last) * 1000.0 / SDL_GetPerformanceFrequency();
+    bench->last = now;
+
+    if (bench->frames++ < BENCH_SETTLE_FRAMES)
+        return;
+    bench->total_ms += ms;
+    if (ms > FRAME_MS * 1.5)
+        bench->missed++;
+
+    if (bench->missed > BENCH_MAX_MISSED || bench->count == BENCH_MAX_SPRITES) {
+        if (bench->missed <= BENCH_MAX_MISSED)
+            printf("benchmark: %d sprites at 60fps (limit reached)\n", bench->count);
+        else
+            printf("benchmark: %d sprites at 60fps (missed frames at %d sprites, avg %.2f ms)\n",
+                bench->best, bench->count, bench->total_ms / (bench->frames - BENCH_SETTLE_FRAMES));
+        bench->active = 0;
+        return;
+    }
+
+    if (bench->frames == BENCH_SETTLE_FRAMES + BENCH_MEASURE_FRAMES) {
+        printf("benchmark: %d sprites ok, avg %.2f ms\n", bench->count, bench->total_ms / BENCH_MEASURE_FRAMES);
+        bench->best = bench->count;
+        int count = bench->count + bench->count / 4;
+        bench_set_count(bench, count < BENCH_MAX_SPRITES ? count : BENCH_MAX_SPRITES, w, h);
+    }
+}
+
+void bench_draw(Benchmark *bench, SDL_Renderer *renderer, SDL_Texture *tex) {
+    // all sprites use the same texture and color mod, so that the renderer can batch them
+    SDL_SetTextureColorMod(tex, 255, 255, 255);
+    for (int i = 0; i < bench->count; i++) {
+        Sprite *s = &bench->sprites[i];
+        s->rect.x += s->vel_x;
+        s->rect.y += s->vel_y;
+        if (s->rect.x < 0 || s->rect.x + s->rect.w > SCREEN_W)
+            s->vel_x = -s->vel_x;
+        if (s->rect.y < 0 || s->rect.y + s->rect.h > SCREEN_H)
+            s->vel_y = -s->vel_y;
+        SDL_RenderCopy(renderer, tex, NULL, &s->rect);
+    }
+}
+
 
 int main(int argc, char** argv) {
 
@@ -55,6 +182,8 @@ int main(int argc, char** argv) {
     int exit_requested = 0;
     int trail = 0;
     int wait = 25;
+    int accelerated = 1;
+    Benchmark bench = { 0 };
 
     SDL_Texture *switchlogo_tex = NULL, *sdllogo_tex =  NULL;
     SDL_Rect pos = { 0, 0, 0, 0 }, sdl_pos = { 0, 0, 0, 0 };
@@ -83,26 +212,13 @@ int main(int argc, char** argv) {
     IMG_Init(IMG_INIT_PNG);
 
     SDL_Window* window = SDL_CreateWindow("sdl2+mixer+image demo", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, SCREEN_W, SCREEN_H, SDL_WINDOW_SHOWN);
-    SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+    SDL_Renderer* renderer = create_renderer(window, accelerated);
 
     // load logos from file
-    SDL_Surface *sdllogo = IMG_Load("data/sdl.png");
-    if (sdllogo) {
-        sdl_pos.w = sdllogo->w;
-        sdl_pos.h = sdllogo->h;
-        sdllogo_tex = SDL_CreateTextureFromSurface(renderer, sdllogo);
-        SDL_FreeSurface(sdllogo);
-    }
-
-    SDL_Surface *switchlogo = IMG_Load("data/switch.png");
-    if (switchlogo) {
-        pos.x = SCREEN_W / 2 - switchlogo->w / 2;
-        pos.y = SCREEN_H / 2 - switchlogo->h / 2;
-        pos.w = switchlogo->w;
-        pos.h = switchlogo->h;
-        switchlogo_tex = SDL_CreateTextureFromSurface(renderer, switchlogo);
-        SDL_FreeSurface(switchlogo);
-    }
+    sdllogo_tex = load_texture(renderer, "data/sdl.png", &sdl_pos);
+    switchlogo_tex = load_texture(renderer, "data/switch.png", &pos);
+    pos.x = SCREEN_W / 2 - pos.w / 2;
+    pos.y = SCREEN_H / 2 - pos.h / 2;
 
     col = rand_range(0, 7);
 
@@ -145,6 +261,20 @@ int main(int argc, char** argv) {
 
                 if (event.jbutton.button == JOY_B)
                     trail =! trail;
+
+                // switch between the software and the GPU renderer, textures belong to the renderer so reload them
+                if (event.jbutton.button == JOY_X && !bench.active) {
+                    SDL_DestroyTexture(sdllogo_tex);
+                    SDL_DestroyTexture(switchlogo_tex);
+                    SDL_DestroyRenderer(renderer);
+                    accelerated = !accelerated;
+                    renderer = create_renderer(window, accelerated);
+                    sdllogo_tex = load_texture(renderer, "data/sdl.png", &sdl_pos);
+                    switchlogo_tex = load_texture(renderer, "data/switch.png", &pos);
+                }
+
+                if (event.jbutton.button == JOY_Y && !bench.active && switchlogo_tex)
+                    bench_start(&bench, pos.w / 4, pos.h / 4);
             }
         }
 
@@ -189,6 +319,9 @@ int main(int argc, char** argv) {
             SDL_RenderClear(renderer);
         }
 
+        if (bench.active)
+            bench_draw(&bench, renderer, switchlogo_tex);
+
         // put logos on screen
         if (sdllogo_tex)
             SDL_RenderCopy(renderer, sdllogo_tex, NULL, &sdl_pos);
@@ -199,9 +332,15 @@ int main(int argc, char** argv) {
 
         SDL_RenderPresent(renderer);
 
-        SDL_Delay(wait);
+        // the benchmark runs as fast as the renderer allows
+        if (bench.active)
+            bench_frame(&bench, pos.w / 4, pos.h / 4);
+        else
+            SDL_Delay(wait);
     }
 
+    free(bench.sprites);
+
     // stop sounds and free loaded data
     Mix_HaltChannel(-1);
     Mix_FreeMusic(music);
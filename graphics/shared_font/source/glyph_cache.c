@@ -0,0 +1,207 @@
+#include <string.h>
+#include <stdlib.h>
+
+#include "glyph_cache.h"
+
+// Sizes of the lookup tables, which must be powers of two. They are flushed when 3/4 full.
+#define GLYPH_SLOTS   2048
+#define KERNING_SLOTS 4096
+
+static u32 face_size(FT_Face face)
+{
+    return ((u32)face->size->metrics.y_ppem << 16) | face->size->metrics.x_ppem;
+}
+
+static u32 hash_key(FT_Face face, u32 size, u32 a, u32 b)
+{
+    u32 h = (u32)((uintptr_t)face >> 4) * 0x9E3779B1;
+    h = (h ^ size) * 0x85EBCA6B;
+    h = (h ^ a) * 0xC2B2AE35;
+    h = (h ^ b) * 0x9E3779B1;
+    return h ^ (h >> 16);
+}
+
+bool glyph_cache_create(GlyphCache* cache, u32 atlas_width, u32 atlas_height)
+{
+    memset(cache, 0, sizeof(*cache));
+    cache->atlas_width = atlas_width;
+    cache->atlas_height = atlas_height;
+    cache->atlas = (u32*)malloc(atlas_width * atlas_height * sizeof(u32));
+    cache->glyphs = (CachedGlyph*)malloc(GLYPH_SLOTS * sizeof(CachedGlyph));
+    cache->kernings = (CachedKerning*)malloc(KERNING_SLOTS * sizeof(CachedKerning));
+    if (!cache->atlas || !cache->glyphs || !cache->kernings) {
+        glyph_cache_destroy(cache);
+        return false;
+    }
+
+    glyph_cache_flush(cache);
+    cache->num_flushes = 0;
+    return true;
+}
+
+void glyph_cache_destroy(GlyphCache* cache)
+{
+    free(cache->atlas);
+    free(cache->glyphs);
+    free(cache->kernings);
+    memset(cache, 0, sizeof(*cache));
+}
+
+void glyph_cache_flush(GlyphCache* cache)
+{
+    memset(cache->glyphs, 0, GLYPH_SLOTS * sizeof(CachedGlyph));
+    memset(cache->kernings, 0, KERNING_SLOTS * sizeof(CachedKerning));
+    cache->num_glyphs = 0;
+    cache->num_kernings = 0;
+    cache->shelf_x = 0;
+    cache->shelf_y = 0;
+    cache->shelf_height = 0;
+    cache->num_flushes ++;
+}
+
+// Finds room for a width x height rectangle in the atlas
+static bool alloc_rect(GlyphCache* cache, u32 width, u32 height, u32* out_x, u32* out_y)
+{
+    if (width > cache->atlas_width || height > cache->atlas_height)
+        return false;
+
+    // Start a new shelf if the glyph doesn't fit on the current one
+    if (cache->shelf_x + width > cache->atlas_width) {
+        cache->shelf_x = 0;
+        cache->shelf_y += cache->shelf_height;
+        cache->shelf_height = 0;
+    }
+
+    if (cache->shelf_y + height > cache->atlas_height)
+        return false;
+
+    *out_x = cache->shelf_x;
+    *out_y = cache->shelf_y;
+    cache->shelf_x += width;
+    if (height > cache->shelf_height)
+        cache->shelf_height = height;
+    return true;
+}
+
+// Renders a glyph with FreeType, and copies it into the atlas
+static bool render_glyph(GlyphCache* cache, CachedGlyph* glyph)
+{
+    FT_Error ret = FT_Load_Glyph(glyph->face, glyph->index, FT_LOAD_DEFAULT);
+    if (ret == 0)
+        ret = FT_Render_Glyph(glyph->face->glyph, FT_RENDER_MODE_NORMAL);
+    if (ret)
+        return false;
+
+    FT_GlyphSlot slot = glyph->face->glyph;
+    FT_Bitmap* bitmap = &slot->bitmap;
+    glyph->left = slot->bitmap_left;
+    glyph->top = slot->bitmap_top;
+    glyph->advance_x = slot->advance.x >> 6;
+    glyph->advance_y = slot->advance.y >> 6;
+    glyph->width = 0;
+    glyph->height = 0;
+
+    // Only grayscale bitmaps are drawn, anything else is treated as blank
+    if (bitmap->pixel_mode != FT_PIXEL_MODE_GRAY || !bitmap->width || !bitmap->rows)
+        return true;
+
+    u32 x, y;
+    if (!alloc_rect(cache, bitmap->width, bitmap->rows, &x, &y)) {
+        // The atlas is full: start over, keeping only this glyph
+        CachedGlyph tmp = *glyph;
+        glyph_cache_flush(cache);
+        *glyph = tmp;
+        if (!alloc_rect(cache, bitmap->width, bitmap->rows, &x, &y))
+            return true; // too big to ever fit, draw it blank
+    }
+
+    glyph->x = x;
+    glyph->y = y;
+    glyph->width = bitmap->width;
+    glyph->height = bitmap->rows;
+
+    const u8* src = bitmap->buffer;
+    u32* dst = &cache->atlas[y * cache->atlas_width + x];
+    for (u32 tmpy = 0; tmpy < bitmap->rows; tmpy ++) {
+        for (u32 tmpx = 0; tmpx < bitmap->width; tmpx ++)
+            dst[tmpx] = RGBA8_MAXALPHA(src[tmpx], src[tmpx], src[tmpx]);
+        src += bitmap->pitch;
+        dst += cache->atlas_width;
+    }
+    return true;
+}
+
+const CachedGlyph* glyph_cache_get(GlyphCache* cache, FT_Face face, u32 codepoint)
+{
+    u32 size = face_size(face);
+    u32 slot = hash_key(face, size, codepoint, 0) & (GLYPH_SLOTS - 1);
+    for (;; slot = (slot + 1) & (GLYPH_SLOTS - 1)) {
+        CachedGlyph* glyph = &cache->glyphs[slot];
+        if (!glyph->face)
+            break;
+        if (glyph->face == face && glyph->size == size && glyph->codepoint == codepoint)
+            return glyph;
+    }
+
+    // Not cached yet: make room in the table if needed, and render it
+    if (cache->num_glyphs >= GLYPH_SLOTS * 3 / 4) {
+        glyph_cache_flush(cache);
+        slot = hash_key(face, size, codepoint, 0) & (GLYPH_SLOTS - 1);
+    }
+
+    CachedGlyph tmp = { 0 };
+    tmp.face = face;
+    tmp.size = size;
+    tmp.codepoint = codepoint;
+    //If using multiple fonts, you could check for index==0 here and attempt using the FT_Face for the other fonts with FT_Get_Char_Index.
+    tmp.index = FT_Get_Char_Index(face, codepoint);
+
+    u32 flushes = cache->num_flushes;
+    if (!render_glyph(cache, &tmp))
+        return NULL;
+
+    // Rendering may have flushed the cache, in which case the slot must be looked up again
+    if (flushes != cache->num_flushes)
+        slot = hash_key(face, size, codepoint, 0) & (GLYPH_SLOTS - 1);
+    while (cache->glyphs[slot].face)
+        slot = (slot + 1) & (GLYPH_SLOTS - 1);
+
+    cache->glyphs[slot] = tmp;
+    cache->num_glyphs ++;
+    return &cache->glyphs[slot];
+}
+
+s32 glyph_cache_get_kerning(GlyphCache* cache, FT_Face face, FT_UInt left, FT_UInt right)
+{
+    if (!FT_HAS_KERNING(face))
+        return 0;
+
+    u32 size = face_size(face);
+    u32 slot = hash_key(face, size, left, right) & (KERNING_SLOTS - 1);
+    for (;; slot = (slot + 1) & (KERNING_SLOTS - 1)) {
+        CachedKerning* kerning = &cache->kernings[slot];
+        if (!kerning->face)
+            break;
+        if (kerning->face == face && kerning->size == size && kerning->left == left && kerning->right == right)
+            return kerning->kerning_x;
+    }
+
+    FT_Vector delta = { 0, 0 };
+    FT_Get_Kerning(face, left, right, FT_KERNING_DEFAULT, &delta);
+
+    // When the table is full, only the kerning table is flushed: the atlas is still valid
+    if (cache->num_kernings >= KERNING_SLOTS * 3 / 4) {
+        memset(cache->kernings, 0, KERNING_SLOTS * sizeof(CachedKerning));
+        cache->num_kernings = 0;
+        slot = hash_key(face, size, left, right) & (KERNING_SLOTS - 1);
+    }
+
+    CachedKerning* kerning = &cache->kernings[slot];
+    kerning->face = face;
+    kerning->size = size;
+    kerning->left = left;
+    kerning->right = right;
+    kerning->kerning_x = delta.x >> 6;
+    cache->num_kernings ++;
+    return kerning->kerning_x;
+}
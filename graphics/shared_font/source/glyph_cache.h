@@ -0,0 +1,62 @@
+#pragma once
+#include <switch.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+// Cache of rendered glyphs, keyed by (face, size, codepoint).
+// The first time a glyph is requested it is rendered with FreeType, then stored in an atlas
+// already converted to the RGBA8888 pixels drawn to the framebuffer, one glyph per rectangle.
+// Drawing a cached glyph is thus a row by row memcpy out of the atlas. The advance of each
+// glyph is kept along with it, and kerning (for fonts that have it) is cached per glyph pair.
+//
+// The atlas is packed in shelves. When it (or the lookup table) is full, the whole cache is
+// flushed and refilled on demand, which only costs something when the text changes a lot.
+
+typedef struct {
+    FT_Face face;   // NULL for unused entries
+    u32 size;       // x/y pixels per em of the face when it was rendered
+    u32 codepoint;
+    FT_UInt index;
+    u16 x, y;       // position in the atlas
+    u16 width, height;
+    s16 left, top;  // bitmap offset from the pen position
+    s32 advance_x;  // in pixels
+    s32 advance_y;
+} CachedGlyph;
+
+typedef struct {
+    FT_Face face; // NULL for unused entries
+    u32 size;
+    FT_UInt left, right;
+    s32 kerning_x;
+} CachedKerning;
+
+typedef struct {
+    u32* atlas;
+    u32 atlas_width, atlas_height;
+    u32 shelf_x, shelf_y, shelf_height;
+
+    CachedGlyph* glyphs;
+    u32 num_glyphs;
+    CachedKerning* kernings;
+    u32 num_kernings;
+
+    u32 num_flushes;
+} GlyphCache;
+
+bool glyph_cache_create(GlyphCache* cache, u32 atlas_width, u32 atlas_height);
+void glyph_cache_destroy(GlyphCache* cache);
+void glyph_cache_flush(GlyphCache* cache);
+
+// Returns the glyph for a codepoint at the current size of the face, rendering it if needed.
+// Returns NULL if FreeType fails to render it. The pointer is valid until the next call.
+const CachedGlyph* glyph_cache_get(GlyphCache* cache, FT_Face face, u32 codepoint);
+
+// Returns the horizontal kerning (in pixels) to apply between two glyphs of the same face
+s32 glyph_cache_get_kerning(GlyphCache* cache, FT_Face face, FT_UInt left, FT_UInt right);
+
+static inline const u32* glyph_cache_pixels(const GlyphCache* cache, const CachedGlyph* glyph)
+{
+    return &cache->atlas[glyph->y * cache->atlas_width + glyph->x];
+}
@@ -7,6 +7,8 @@
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
+#include "glyph_cache.h"
+
 //See also libnx pl.h.
 
 // Define the desired framebuffer resolution (here we set it to 720p).
@@ -18,37 +20,49 @@
 
 static u32 framebuf_width=0;
 
+//Glyphs are only rendered by FreeType the first time they are drawn, see glyph_cache.h.
+static GlyphCache glyph_cache;
+
 //Note that this doesn't handle any blending.
-void draw_glyph(FT_Bitmap* bitmap, u32* framebuf, u32 x, u32 y)
+void draw_glyph(const CachedGlyph* glyph, u32* framebuf, s32 x, s32 y)
 {
-    u32 framex, framey;
-    u32 tmpx, tmpy;
-    u8* imageptr = bitmap->buffer;
-
-    if (bitmap->pixel_mode!=FT_PIXEL_MODE_GRAY) return;
-
-    for (tmpy=0; tmpy<bitmap->rows; tmpy++)
+    s32 width = glyph->width, height = glyph->height;
+    const u32* imageptr = glyph_cache_pixels(&glyph_cache, glyph);
+
+    //Clip the glyph to the framebuffer.
+    if (x < 0) {
+        imageptr -= x;
+        width += x;
+        x = 0;
+    }
+    if (y < 0) {
+        imageptr -= y * glyph_cache.atlas_width;
+        height += y;
+        y = 0;
+    }
+    if (x + width > FB_WIDTH)
+        width = FB_WIDTH - x;
+    if (y + height > FB_HEIGHT)
+        height = FB_HEIGHT - y;
+    if (width <= 0 || height <= 0) return;
+
+    //The atlas already holds the final pixels, so each row is a plain copy.
+    u32* frameptr = &framebuf[y * framebuf_width + x];
+    for (s32 tmpy=0; tmpy<height; tmpy++)
     {
-        for (tmpx=0; tmpx<bitmap->width; tmpx++)
-        {
-            framex = x + tmpx;
-            framey = y + tmpy;
-
-            framebuf[framey * framebuf_width + framex] = RGBA8_MAXALPHA(imageptr[tmpx], imageptr[tmpx], imageptr[tmpx]);
-        }
-
-        imageptr+= bitmap->pitch;
+        memcpy(frameptr, imageptr, width * sizeof(u32));
+        frameptr+= framebuf_width;
+        imageptr+= glyph_cache.atlas_width;
     }
 }
 
-//Note that this doesn't handle {tmpx > width}, etc.
 //str is UTF-8.
-void draw_text(FT_Face face, u32* framebuf, u32 x, u32 y, const char* str)
+void draw_text(FT_Face face, u32* framebuf, s32 x, s32 y, const char* str)
 {
-    u32 tmpx = x;
-    FT_Error ret=0;
-    FT_UInt glyph_index;
-    FT_GlyphSlot slot = face->glyph;
+    s32 tmpx = x;
+    const CachedGlyph* glyph;
+    FT_UInt prev_index = 0;
+    bool has_prev = false;
 
     u32 i;
     u32 str_size = strlen(str);
@@ -65,29 +79,22 @@ void draw_text(FT_Face face, u32* framebuf, u32 x, u32 y, const char* str)
         {
             tmpx = x;
             y+= face->size->metrics.height / 64;
+            has_prev = false;
             continue;
         }
 
-        glyph_index = FT_Get_Char_Index(face, tmpchar);
-        //If using multiple fonts, you could check for glyph_index==0 here and attempt using the FT_Face for the other fonts with FT_Get_Char_Index.
-
-        ret = FT_Load_Glyph(
-                face,          /* handle to face object */
-                glyph_index,   /* glyph index           */
-                FT_LOAD_DEFAULT);
-
-        if (ret==0)
-        {
-            ret = FT_Render_Glyph( face->glyph,   /* glyph slot  */
-                                   FT_RENDER_MODE_NORMAL);  /* render mode */
-        }
+        glyph = glyph_cache_get(&glyph_cache, face, tmpchar);
+        if (!glyph) return;
 
-        if (ret) return;
+        if (has_prev)
+            tmpx += glyph_cache_get_kerning(&glyph_cache, face, prev_index, glyph->index);
+        prev_index = glyph->index;
+        has_prev = true;
 
-        draw_glyph(&slot->bitmap, framebuf, tmpx + slot->bitmap_left, y - slot->bitmap_top);
+        draw_glyph(glyph, framebuf, tmpx + glyph->left, y - glyph->top);
 
-        tmpx += slot->advance.x >> 6;
-        y += slot->advance.y >> 6;
+        tmpx += glyph->advance_x;
+        y += glyph->advance_y;
     }
 }
 
@@ -192,6 +199,12 @@ int main(int argc, char **argv)
         return error_screen("FT_Set_Char_Size() failed: %d\n", ret);
     }
 
+    if (!glyph_cache_create(&glyph_cache, 1024, 512)) {
+        FT_Done_Face(face);
+        FT_Done_FreeType(library);
+        return error_screen("glyph_cache_create() failed\n");
+    }
+
     Framebuffer fb;
     framebufferCreate(&fb, nwindowGetDefault(), FB_WIDTH, FB_HEIGHT, PIXEL_FORMAT_RGBA_8888, 2);
     framebufferMakeLinear(&fb);
@@ -217,6 +230,7 @@ int main(int argc, char **argv)
     }
 
     framebufferClose(&fb);
+    glyph_cache_destroy(&glyph_cache);
     FT_Done_Face(face);
     FT_Done_FreeType(library);
     return 0;
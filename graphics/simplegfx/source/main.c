@@ -6,6 +6,8 @@
 // Include the main libnx system header, for Switch development
 #include <switch.h>
 
+#include "swraster.h"
+
 #ifdef DISPLAY_IMAGE
 #include "image_bin.h"//Your own raw RGB888 1280x720 image at "data/image.bin" is required.
 #endif
@@ -51,30 +53,28 @@ int main(int argc, char* argv[])
             break; // break in order to return to hbmenu
 
         // Retrieve the framebuffer
-        u32 stride;
-        u32* framebuf = (u32*) framebufferBegin(&fb, &stride);
+        SwrSurface surf;
+        swrBegin(&surf, &fb);
 
         if (cnt != 60)
             cnt ++;
         else
             cnt = 0;
 
-        // Each pixel is 4-bytes due to RGBA8888.
+        // Each pixel is 4-bytes due to RGBA8888. The swraster helpers process whole rows at a time.
+#ifdef DISPLAY_IMAGE
         for (u32 y = 0; y < FB_HEIGHT; y ++)
         {
-            for (u32 x = 0; x < FB_WIDTH; x ++)
-            {
-                u32 pos = y * stride / sizeof(u32) + x;
-#ifdef DISPLAY_IMAGE
-                framebuf[pos] = RGBA8_MAXALPHA(imageptr[pos*3+0]+(cnt*4), imageptr[pos*3+1], imageptr[pos*3+2]);
+            u32* row = swrRow(&surf, y);
+            swrConvertRowRGB888(row, &imageptr[y*FB_WIDTH*3], FB_WIDTH);
+            swrAddRow(row, RGBA8(cnt*4, 0, 0, 0), FB_WIDTH); // Tint the image red.
+        }
 #else
-                framebuf[pos] = 0x01010101 * cnt * 4;//Set framebuf to different shades of grey.
+        swrFill(&surf, 0x01010101 * cnt * 4);//Set framebuf to different shades of grey.
 #endif
-            }
-        }
 
         // We're done rendering, so we end the frame here.
-        framebufferEnd(&fb);
+        swrEnd(&surf);
     }
 
     framebufferClose(&fb);
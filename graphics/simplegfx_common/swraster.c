@@ -0,0 +1,209 @@
+#include <string.h>
+#include "swraster.h"
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+void swrBegin(SwrSurface* surf, Framebuffer* fb)
+{
+    u32 stride;
+    surf->fb = fb;
+    surf->pixels = (u32*)framebufferBegin(fb, &stride);
+    surf->stride = stride / sizeof(u32);
+
+    // framebufferCreate sets the dimensions of the window to those of the framebuffer
+    nwindowGetDimensions(fb->win, &surf->width, &surf->height);
+}
+
+void swrEnd(SwrSurface* surf)
+{
+    framebufferEnd(surf->fb);
+    surf->pixels = NULL;
+}
+
+void swrFillRow(u32* dst, u32 color, u32 count)
+{
+    u32 i = 0;
+#ifdef __ARM_NEON
+    uint32x4_t c = vdupq_n_u32(color);
+    for (; i + 16 <= count; i += 16)
+    {
+        vst1q_u32(dst + i + 0,  c);
+        vst1q_u32(dst + i + 4,  c);
+        vst1q_u32(dst + i + 8,  c);
+        vst1q_u32(dst + i + 12, c);
+    }
+#endif
+    for (; i < count; i ++)
+        dst[i] = color;
+}
+
+void swrCopyRow(u32* dst, const u32* src, u32 count)
+{
+    // newlib's memcpy is already vectorized, and handles misalignment better than we would
+    memcpy(dst, src, count * sizeof(u32));
+}
+
+// Divides by 255 with rounding, exactly, for any product of two 8-bit values
+static inline u8 div255(u32 x)
+{
+    return (x + 128 + ((x + 128) >> 8)) >> 8;
+}
+
+#ifdef __ARM_NEON
+static inline uint8x8_t div255_u16(uint16x8_t x)
+{
+    return vrshrn_n_u16(vrsraq_n_u16(x, x, 8), 8);
+}
+
+static inline uint8x16_t blend_u8(uint8x16_t s, uint8x16_t d, uint8x16_t a, uint8x16_t ia)
+{
+    uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(s), vget_low_u8(a)), vget_low_u8(d), vget_low_u8(ia));
+    uint16x8_t hi = vmlal_u8(vmull_u8(vget_high_u8(s), vget_high_u8(a)), vget_high_u8(d), vget_high_u8(ia));
+    return vcombine_u8(div255_u16(lo), div255_u16(hi));
+}
+#endif
+
+void swrBlendRow(u32* dst, const u32* src, u32 count)
+{
+    u32 i = 0;
+#ifdef __ARM_NEON
+    for (; i + 16 <= count; i += 16)
+    {
+        // Deinterleave 16 pixels into one register per channel
+        uint8x16x4_t s = vld4q_u8((const u8*)(src + i));
+        uint8x16x4_t d = vld4q_u8((const u8*)(dst + i));
+        uint8x16_t a = s.val[3], ia = vmvnq_u8(a);
+        d.val[0] = blend_u8(s.val[0], d.val[0], a, ia);
+        d.val[1] = blend_u8(s.val[1], d.val[1], a, ia);
+        d.val[2] = blend_u8(s.val[2], d.val[2], a, ia);
+        d.val[3] = blend_u8(vdupq_n_u8(0xFF), d.val[3], a, ia);
+        vst4q_u8((u8*)(dst + i), d);
+    }
+#endif
+    for (; i < count; i ++)
+    {
+        const u8* s = (const u8*)&src[i];
+        u8* d = (u8*)&dst[i];
+        u32 a = s[3], ia = 255 - a;
+        d[0] = div255(s[0]*a + d[0]*ia);
+        d[1] = div255(s[1]*a + d[1]*ia);
+        d[2] = div255(s[2]*a + d[2]*ia);
+        d[3] = div255(255*a + d[3]*ia);
+    }
+}
+
+void swrAddRow(u32* dst, u32 color, u32 count)
+{
+    u32 i = 0;
+#ifdef __ARM_NEON
+    uint8x16_t c = vreinterpretq_u8_u32(vdupq_n_u32(color));
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x4_t d = vld1q_u8_x4((const u8*)(dst + i));
+        d.val[0] = vaddq_u8(d.val[0], c);
+        d.val[1] = vaddq_u8(d.val[1], c);
+        d.val[2] = vaddq_u8(d.val[2], c);
+        d.val[3] = vaddq_u8(d.val[3], c);
+        vst1q_u8_x4((u8*)(dst + i), d);
+    }
+#endif
+    const u8* c8 = (const u8*)&color;
+    for (; i < count; i ++)
+    {
+        u8* d = (u8*)&dst[i];
+        d[0] += c8[0];
+        d[1] += c8[1];
+        d[2] += c8[2];
+        d[3] += c8[3];
+    }
+}
+
+void swrConvertRowRGB888(u32* dst, const u8* src, u32 count)
+{
+    u32 i = 0;
+#ifdef __ARM_NEON
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x3_t s = vld3q_u8(src + i*3);
+        uint8x16x4_t d = { { s.val[0], s.val[1], s.val[2], vdupq_n_u8(0xFF) } };
+        vst4q_u8((u8*)(dst + i), d);
+    }
+#endif
+    for (; i < count; i ++)
+        dst[i] = RGBA8_MAXALPHA(src[i*3+0], src[i*3+1], src[i*3+2]);
+}
+
+// Clips a rectangle to the surface, and returns the offset (in pixels) of its corner in the source image
+static bool clipRect(const SwrSurface* surf, s32* x, s32* y, s32* w, s32* h, u32* srcX, u32* srcY)
+{
+    *srcX = 0;
+    *srcY = 0;
+    if (*x < 0)
+    {
+        *srcX = -*x;
+        *w += *x;
+        *x = 0;
+    }
+    if (*y < 0)
+    {
+        *srcY = -*y;
+        *h += *y;
+        *y = 0;
+    }
+    if (*x + *w > (s32)surf->width)
+        *w = (s32)surf->width - *x;
+    if (*y + *h > (s32)surf->height)
+        *h = (s32)surf->height - *y;
+    return *w > 0 && *h > 0;
+}
+
+void swrFill(const SwrSurface* surf, u32 color)
+{
+    for (u32 y = 0; y < surf->height; y ++)
+        swrFillRow(swrRow(surf, y), color, surf->width);
+}
+
+void swrFillRect(const SwrSurface* surf, s32 x, s32 y, s32 w, s32 h, u32 color)
+{
+    u32 srcX, srcY;
+    if (!clipRect(surf, &x, &y, &w, &h, &srcX, &srcY))
+        return;
+
+    for (s32 i = 0; i < h; i ++)
+        swrFillRow(swrRow(surf, y + i) + x, color, w);
+}
+
+void swrBlit(const SwrSurface* surf, s32 x, s32 y, const u32* src, u32 srcStride, s32 w, s32 h)
+{
+    u32 srcX, srcY;
+    if (!clipRect(surf, &x, &y, &w, &h, &srcX, &srcY))
+        return;
+
+    src += srcY * srcStride + srcX;
+    for (s32 i = 0; i < h; i ++, src += srcStride)
+        swrCopyRow(swrRow(surf, y + i) + x, src, w);
+}
+
+void swrBlendBlit(const SwrSurface* surf, s32 x, s32 y, const u32* src, u32 srcStride, s32 w, s32 h)
+{
+    u32 srcX, srcY;
+    if (!clipRect(surf, &x, &y, &w, &h, &srcX, &srcY))
+        return;
+
+    src += srcY * srcStride + srcX;
+    for (s32 i = 0; i < h; i ++, src += srcStride)
+        swrBlendRow(swrRow(surf, y + i) + x, src, w);
+}
+
+void swrBlitRGB888(const SwrSurface* surf, s32 x, s32 y, const u8* src, u32 srcStride, s32 w, s32 h)
+{
+    u32 srcX, srcY;
+    if (!clipRect(surf, &x, &y, &w, &h, &srcX, &srcY))
+        return;
+
+    src += srcY * srcStride + srcX * 3;
+    for (s32 i = 0; i < h; i ++, src += srcStride)
+        swrConvertRowRGB888(swrRow(surf, y + i) + x, src, w);
+}
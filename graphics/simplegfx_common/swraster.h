@@ -0,0 +1,47 @@
+#pragma once
+#include <switch.h>
+
+// Small software rasterization helpers for the simplegfx examples.
+// They work on RGBA8888 pixels as laid out by libnx (see RGBA8 in display/framebuffer.h),
+// one row at a time, and are vectorized with NEON: a row is processed 16 pixels at a time,
+// with a scalar loop for the remaining pixels. The surface functions below apply the row
+// operations to a rectangle of a framebuffer, clipped to the surface.
+//
+// Usage:
+//     SwrSurface surf;
+//     swrBegin(&surf, &fb);
+//     swrFill(&surf, RGBA8_MAXALPHA(0x10, 0x10, 0x10));
+//     swrBlendBlit(&surf, x, y, sprite, spriteWidth, spriteWidth, spriteHeight);
+//     swrEnd(&surf);
+
+typedef struct
+{
+    Framebuffer* fb;
+    u32* pixels;
+    u32 stride; // in pixels, not bytes
+    u32 width;
+    u32 height;
+} SwrSurface;
+
+// Starts rendering a frame into the framebuffer (framebufferBegin), and ends it (framebufferEnd)
+void swrBegin(SwrSurface* surf, Framebuffer* fb);
+void swrEnd(SwrSurface* surf);
+
+static inline u32* swrRow(const SwrSurface* surf, u32 y)
+{
+    return surf->pixels + y * surf->stride;
+}
+
+// Row operations, on count pixels
+void swrFillRow(u32* dst, u32 color, u32 count);
+void swrCopyRow(u32* dst, const u32* src, u32 count);
+void swrBlendRow(u32* dst, const u32* src, u32 count);           // src over dst, using the alpha of src
+void swrAddRow(u32* dst, u32 color, u32 count);                  // adds color to each channel, wrapping around
+void swrConvertRowRGB888(u32* dst, const u8* src, u32 count);   // RGB888 to RGBA8888, with alpha set to 0xFF
+
+// Surface operations. srcStride is in pixels for RGBA8888 images, and in bytes for RGB888 images.
+void swrFill(const SwrSurface* surf, u32 color);
+void swrFillRect(const SwrSurface* surf, s32 x, s32 y, s32 w, s32 h, u32 color);
+void swrBlit(const SwrSurface* surf, s32 x, s32 y, const u32* src, u32 srcStride, s32 w, s32 h);
+void swrBlendBlit(const SwrSurface* surf, s32 x, s32 y, const u32* src, u32 srcStride, s32 w, s32 h);
+void swrBlitRGB888(const SwrSurface* surf, s32 x, s32 y, const u8* src, u32 srcStride, s32 w, s32 h);
@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "audio_capture.h"
+
+#define RING_MASK (AUDIO_CAPTURE_RING_FRAMES - 1)
+
+// Copies frames out of (or into) the ring starting at pos, handling the wraparound
+static void ringCopy(AudioCapture* cap, s16* dst, const s16* src, u64 pos, u32 frames, bool toRing)
+{
+    u32 offset = pos & RING_MASK;
+    u32 first = AUDIO_CAPTURE_RING_FRAMES - offset;
+    if (first > frames)
+        first = frames;
+
+    size_t frameSize = cap->channels * sizeof(s16);
+    if (toRing) {
+        memcpy(&cap->ring[offset * cap->channels], src, first * frameSize);
+        memcpy(cap->ring, src + first * cap->channels, (frames - first) * frameSize);
+    } else {
+        memcpy(dst, &cap->ring[offset * cap->channels], first * frameSize);
+        memcpy(dst + first * cap->channels, cap->ring, (frames - first) * frameSize);
+    }
+}
+
+static void encoderThreadFunc(void* arg)
+{
+    AudioCapture* cap = (AudioCapture*)arg;
+    size_t chunkSize = AUDIO_CAPTURE_CHUNK_FRAMES * cap->channels * sizeof(s16);
+
+    for (;;) {
+        bool exit = __atomic_load_n(&cap->exit, __ATOMIC_ACQUIRE);
+
+        // Encode all the complete chunks available
+        u64 writePos = __atomic_load_n(&cap->writePos, __ATOMIC_ACQUIRE);
+        while (writePos - cap->readPos >= AUDIO_CAPTURE_CHUNK_FRAMES) {
+            ringCopy(cap, cap->chunk, NULL, cap->readPos, AUDIO_CAPTURE_CHUNK_FRAMES, false);
+            __atomic_store_n(&cap->readPos, cap->readPos + AUDIO_CAPTURE_CHUNK_FRAMES, __ATOMIC_RELEASE);
+
+            Result rc = grcMovieMakerEncodeAudioSample(cap->maker, cap->chunk, chunkSize);
+            if (R_FAILED(rc)) printf("grcMovieMakerEncodeAudioSample(): 0x%x\n", rc);
+        }
+
+        if (exit)
+            break;
+
+        // Wait for the mixer to give us more audio
+        waitSingle(waiterForUEvent(&cap->dataEvent), UINT64_MAX);
+    }
+}
+
+Result audioCaptureCreate(AudioCapture* cap, GrcMovieMaker* maker, u32 channels)
+{
+    memset(cap, 0, sizeof(*cap));
+    cap->maker = maker;
+    cap->channels = channels;
+
+    cap->ring = (s16*)malloc(AUDIO_CAPTURE_RING_FRAMES * channels * sizeof(s16));
+    cap->chunk = (s16*)malloc(AUDIO_CAPTURE_CHUNK_FRAMES * channels * sizeof(s16));
+    if (!cap->ring || !cap->chunk) {
+        free(cap->ring);
+        free(cap->chunk);
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    }
+
+    ueventCreate(&cap->dataEvent, true);
+
+    // Use a higher priority than the main thread, so that encoding keeps up with the mixer
+    Result rc = threadCreate(&cap->thread, encoderThreadFunc, cap, NULL, 0x10000, 0x2B, -2);
+    if (R_SUCCEEDED(rc))
+        rc = threadStart(&cap->thread);
+
+    if (R_FAILED(rc)) {
+        threadClose(&cap->thread);
+        free(cap->ring);
+        free(cap->chunk);
+    }
+    return rc;
+}
+
+void audioCaptureClose(AudioCapture* cap)
+{
+    __atomic_store_n(&cap->exit, true, __ATOMIC_RELEASE);
+    ueventSignal(&cap->dataEvent);
+    threadWaitForExit(&cap->thread);
+    threadClose(&cap->thread);
+
+    free(cap->ring);
+    free(cap->chunk);
+}
+
+u32 audioCaptureWrite(AudioCapture* cap, const s16* samples, u32 frames)
+{
+    u64 readPos = __atomic_load_n(&cap->readPos, __ATOMIC_ACQUIRE);
+    u32 space = AUDIO_CAPTURE_RING_FRAMES - (u32)(cap->writePos - readPos);
+    if (frames > space) {
+        __atomic_fetch_add(&cap->dropped, frames - space, __ATOMIC_RELAXED);
+        frames = space;
+    }
+
+    if (frames) {
+        ringCopy(cap, NULL, samples, cap->writePos, frames, true);
+        __atomic_store_n(&cap->writePos, cap->writePos + frames, __ATOMIC_RELEASE);
+        ueventSignal(&cap->dataEvent);
+    }
+    return frames;
+}
+
+u32 audioCaptureGetDropped(AudioCapture* cap)
+{
+    return __atomic_load_n(&cap->dropped, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <switch.h>
+
+// Feeds audio to grcMovieMakerEncodeAudioSample from a dedicated encoder thread.
+//
+// The mixer of the app copies its output in with audioCaptureWrite, which never blocks: the
+// samples go into a lock-free single producer/single consumer ring buffer, which the encoder
+// thread drains one video frame worth of audio at a time. A latency spike in the encoder then
+// only makes the ring fill up, instead of stalling the frame. If the ring is full, the samples
+// that do not fit are dropped (and counted).
+//
+// Samples are interleaved PCM16, with the channel count given to audioCaptureCreate
+// (which must match the audio_channel_count of the recording parameters).
+
+#define AUDIO_CAPTURE_SAMPLE_RATE  48000
+#define AUDIO_CAPTURE_CHUNK_FRAMES (AUDIO_CAPTURE_SAMPLE_RATE/60) // one video frame
+#define AUDIO_CAPTURE_RING_FRAMES  32768                          // must be a power of two
+
+typedef struct {
+    GrcMovieMaker* maker;
+    u32 channels;
+
+    s16* ring;
+    u64 writePos; // in frames, only ever increasing
+    u64 readPos;
+    u32 dropped;
+
+    s16* chunk;
+    Thread thread;
+    UEvent dataEvent;
+    bool exit;
+} AudioCapture;
+
+Result audioCaptureCreate(AudioCapture* cap, GrcMovieMaker* maker, u32 channels);
+
+// Encodes the remaining complete chunks, then stops the encoder thread
+void audioCaptureClose(AudioCapture* cap);
+
+// Returns the number of frames actually queued
+u32 audioCaptureWrite(AudioCapture* cap, const s16* samples, u32 frames);
+
+// Returns the number of frames dropped so far because the ring was full
+u32 audioCaptureGetDropped(AudioCapture* cap);
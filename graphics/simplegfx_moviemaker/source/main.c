@@ -2,11 +2,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <unistd.h>
 
 // Include the main libnx system header, for Switch development
 #include <switch.h>
 
+#include "swraster.h"
+#include "audio_capture.h"
+#include "nxlink_log.h"
+
 #ifdef DISPLAY_IMAGE
 #include "image_bin.h"//Your own raw RGB888 1280x720 image at "data/image.bin" is required.
 #endif
@@ -15,40 +18,47 @@
 
 // This example shows how to use grc MovieMaker, see also grc.h (and applet.h for the requirements for using this).
 
+// By default each row is rendered straight into both the display and the MovieMaker framebuffers, while
+// its source data is still in the cache. Define COPY_MOVIE_FRAME to instead render into the display
+// framebuffer only, then memcpy the whole frame into the MovieMaker framebuffer (3.5 MiB per frame at 720p).
+
 // Define the desired framebuffer resolution (here we set it to 720p).
 #define FB_WIDTH  1280
 #define FB_HEIGHT 720
 
-static int s_nxlinkSock = -1;
-
-static void initNxLink()
+// The mixer of this example: a short beep each time the screen goes back to black, so that
+// the audio in the recorded video can be checked to be in sync with the picture.
+static void mixAudio(s16* out, u32 frames, u32 channels, u32 cnt)
 {
-    if (R_FAILED(socketInitializeDefault()))
-        return;
-
-    s_nxlinkSock = nxlinkStdio();
-    if (s_nxlinkSock < 0)
-        socketExit();
+    static u32 phase;
+    for (u32 i = 0; i < frames; i ++) {
+        s16 sample = 0;
+        if (cnt < 6) // 100ms
+            sample = (phase++ / 55) & 1 ? 4000 : -4000; // ~440Hz square wave
+        for (u32 c = 0; c < channels; c ++)
+            *out++ = sample;
+    }
 }
 
-static void deinitNxLink()
+// Render a row of the frame, see the main loop below
+static void renderRow(u32* row, u32 y, u32 cnt)
 {
-    if (s_nxlinkSock >= 0)
-    {
-        close(s_nxlinkSock);
-        socketExit();
-        s_nxlinkSock = -1;
-    }
+#ifdef DISPLAY_IMAGE
+    swrConvertRowRGB888(row, &((const u8*)image_bin)[y*FB_WIDTH*3], FB_WIDTH);
+    swrAddRow(row, RGBA8(cnt*4, 0, 0, 0), FB_WIDTH); // Tint the image red.
+#else
+    swrFillRow(row, 0x01010101 * cnt * 4, FB_WIDTH);//Set framebuf to different shades of grey.
+#endif
 }
 
 void userAppInit()
 {
-    initNxLink();
+    nxlinkLogInit();
 }
 
 void userAppExit()
 {
-    deinitNxLink();
+    nxlinkLogExit();
 }
 
 // Main program entrypoint
@@ -57,8 +67,8 @@ int main(int argc, char* argv[])
     Result rc=0;
     GrcMovieMaker maker={0};
     GrcOffscreenRecordingParameter makerparam={0};
-    u8 *audiobuf = NULL;
-    size_t audiobuf_size = (48000/60)*2; // PCM16 samples for a single frame.
+    AudioCapture capture;
+    s16 *audiobuf = NULL;
 
     // Initialize and start video recording, the app will immediately exit if this fails.
     rc = grcCreateMovieMaker(&maker, GRC_MOVIEMAKER_WORKMEMORY_SIZE_DEFAULT);
@@ -72,11 +82,16 @@ int main(int argc, char* argv[])
     }
 
     if (R_SUCCEEDED(rc)) {
-        audiobuf = (u8*)malloc(audiobuf_size);
-        if (audiobuf)
-            memset(audiobuf, 0, audiobuf_size);
-        else {
+        // The audio is encoded from its own thread, see audio_capture.h.
+        rc = audioCaptureCreate(&capture, &maker, makerparam.audio_channel_count);
+        printf("audioCaptureCreate(): 0x%x\n", rc);
+    }
+
+    if (R_SUCCEEDED(rc)) {
+        audiobuf = (s16*)malloc(AUDIO_CAPTURE_CHUNK_FRAMES * makerparam.audio_channel_count * sizeof(s16)); // PCM16 samples for a single frame.
+        if (!audiobuf) {
             printf("Failed to allocate audiobuf.\n");
+            audioCaptureClose(&capture);
             rc = 1; // Trigger the below R_FAILED block.
         }
     }
@@ -100,10 +115,6 @@ int main(int argc, char* argv[])
     framebufferCreate(&fb_movie, win_movie, FB_WIDTH, FB_HEIGHT, PIXEL_FORMAT_RGBA_8888, 2);
     framebufferMakeLinear(&fb_movie);
 
-#ifdef DISPLAY_IMAGE
-    u8* imageptr = (u8*)image_bin;
-#endif
-
     u32 cnt = 0;
 
     // Main loop
@@ -119,50 +130,50 @@ int main(int argc, char* argv[])
         if (kDown & KEY_PLUS)
             break; // break in order to return to hbmenu
 
-        // Retrieve the framebuffer.
-        u32 stride;
-        u32* framebuf = (u32*) framebufferBegin(&fb, &stride);
+        // Retrieve the framebuffer, and the MovieMaker framebuffer.
+        SwrSurface surf, surf_movie;
+        swrBegin(&surf, &fb);
+        swrBegin(&surf_movie, &fb_movie);
 
         if (cnt != 60)
             cnt ++;
         else
             cnt = 0;
 
-        // Each pixel is 4-bytes due to RGBA8888.
+        // Each pixel is 4-bytes due to RGBA8888. The swraster helpers process whole rows at a time.
         for (u32 y = 0; y < FB_HEIGHT; y ++)
         {
-            for (u32 x = 0; x < FB_WIDTH; x ++)
-            {
-                u32 pos = y * stride / sizeof(u32) + x;
-#ifdef DISPLAY_IMAGE
-                framebuf[pos] = RGBA8_MAXALPHA(imageptr[pos*3+0]+(cnt*4), imageptr[pos*3+1], imageptr[pos*3+2]);
-#else
-                framebuf[pos] = 0x01010101 * cnt * 4;//Set framebuf to different shades of grey.
+            renderRow(swrRow(&surf, y), y, cnt);
+#ifndef COPY_MOVIE_FRAME
+            renderRow(swrRow(&surf_movie, y), y, cnt);
 #endif
-            }
         }
 
-        // Retrieve the MovieMaker framebuffer.
-        u32* framebuf_movie = (u32*) framebufferBegin(&fb_movie, NULL); // Not using stride since we're just doing memcpy from the above image.
-
+#ifdef COPY_MOVIE_FRAME
         // Copy the above rendered image to the MovieMaker fb.
-        memcpy(framebuf_movie, framebuf, FB_HEIGHT * stride);
+        memcpy(surf_movie.pixels, surf.pixels, FB_HEIGHT * surf.stride * sizeof(u32));
+#endif
 
         // We're done rendering with MovieMaker, so we end the frame here.
-        framebufferEnd(&fb_movie);
+        swrEnd(&surf_movie);
 
         // We're done rendering, so we end the frame here.
-        framebufferEnd(&fb);
+        swrEnd(&surf);
 
-        // If you want audio you should fill audiobuf with actual data, but here we'll leave it at 0.
+        // Hand one frame of audio to the encoder thread, which calls grcMovieMakerEncodeAudioSample.
         // If you don't use grcMovieMakerEncodeAudioSample, the recorded video will be missing audio.
-        rc = grcMovieMakerEncodeAudioSample(&maker, audiobuf, audiobuf_size);
-        if (R_FAILED(rc)) printf("grcMovieMakerEncodeAudioSample(): 0x%x\n", rc);
+        // A real app would copy here the output of its mixer (e.g. the final mix of audren).
+        mixAudio(audiobuf, AUDIO_CAPTURE_CHUNK_FRAMES, makerparam.audio_channel_count, cnt);
+        audioCaptureWrite(&capture, audiobuf, AUDIO_CAPTURE_CHUNK_FRAMES);
     }
 
     framebufferClose(&fb);
     framebufferClose(&fb_movie);
 
+    // Encode the remaining audio.
+    audioCaptureClose(&capture);
+    printf("Dropped audio frames: %u\n", audioCaptureGetDropped(&capture));
+
     // Finish video recording.
     // You can set your own UserData/thumbnail if you want, but in this example we won't do that.
     // If you want the output caps-entry you can do so, however see grc.h regarding that.
@@ -6,6 +6,8 @@
 // Include the main libnx system header, for Switch development
 #include <switch.h>
 
+#include "pad_snapshot.h"
+
 // This example shows how to use AbstractedPad, see also libnx hiddbg.h. Depending on state npadInterfaceType, either a new virtual controller can be registered, or the state can be merged with an existing controller.
 // This is deprecated, use Hdls instead when running on compatible system-versions.
 
@@ -54,11 +56,16 @@ int main(int argc, char* argv[])
     printf("Press X to scan controllers.\n");
     printf("Press + to exit.\n");
 
+    // State of all the connected controllers, gathered once per frame
+    PadSnapshot pads_snapshot;
+    padSnapshotInit(&pads_snapshot);
+
     // Main loop
     while (appletMainLoop())
     {
         // Scan all the inputs. This should be done once for each frame
         hidScanInput();
+        padSnapshotUpdate(&pads_snapshot);
 
         // hidKeysDown returns information about which buttons have been
         // just pressed in this frame compared to the previous one
@@ -66,13 +73,10 @@ int main(int argc, char* argv[])
 
         if (R_SUCCEEDED(rc) && (kDown & (KEY_A | KEY_X))) {
             printf("Connected controllers:\n");
-            for(i=0; i<10; i++) {
-                if (hidIsControllerConnected(i)) {
-                    JoystickPosition tmpjoy[2];
-                    hidJoystickRead(&tmpjoy[0], i, JOYSTICK_LEFT);
-                    hidJoystickRead(&tmpjoy[1], i, JOYSTICK_RIGHT);
-                    printf("%d: type = 0x%x, devicetype = 0x%x, buttons = 0x%lx, stickL.dx = 0x%x, stickL.dy = 0x%x, stickR.dx = 0x%x, stickR.dy = 0x%x\n", i, hidGetControllerType(i), hidGetControllerDeviceType(i), hidKeysHeld(i), tmpjoy[0].dx, tmpjoy[0].dy, tmpjoy[1].dx, tmpjoy[1].dy);
-                }
+            for (u32 n=0; n<pads_snapshot.count; n++) {
+                const JoystickPosition* stickL = &pads_snapshot.sticks[JOYSTICK_LEFT][n];
+                const JoystickPosition* stickR = &pads_snapshot.sticks[JOYSTICK_RIGHT][n];
+                printf("%d: type = 0x%x, devicetype = 0x%x, buttons = 0x%lx, stickL.dx = 0x%x, stickL.dy = 0x%x, stickR.dx = 0x%x, stickR.dy = 0x%x\n", pads_snapshot.id[n], pads_snapshot.info[n]->type, pads_snapshot.info[n]->device_type, pads_snapshot.buttons[n], stickL->dx, stickL->dy, stickR->dx, stickR->dy);
             }
         }
 
@@ -0,0 +1,208 @@
+#include <string.h>
+#include <math.h>
+
+#include "gesture.h"
+
+// Weight of the newest movement in the velocity estimate
+#define VELOCITY_SMOOTHING 0.4f
+
+void gestureInit(GestureRecognizer* g)
+{
+    memset(g, 0, sizeof(*g));
+}
+
+static GestureEvent* emit(GestureRecognizer* g, GestureType type, GesturePhase phase, float x, float y)
+{
+    if (g->num_events >= GESTURE_MAX_EVENTS) {
+        g->dropped_events++;
+        return NULL;
+    }
+
+    GestureEvent* ev = &g->events[g->num_events++];
+    memset(ev, 0, sizeof(*ev));
+    ev->type = type;
+    ev->phase = phase;
+    ev->x = x;
+    ev->y = y;
+    ev->scale = 1.0f;
+    return ev;
+}
+
+static float distance(float x0, float y0, float x1, float y1)
+{
+    return sqrtf((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0));
+}
+
+static GestureTrack* findTrack(GestureRecognizer* g, u32 id)
+{
+    GestureTrack* free_track = NULL;
+    for (u32 i = 0; i < GESTURE_MAX_TRACKS; i++) {
+        GestureTrack* t = &g->tracks[i];
+        if (t->active && t->id == id)
+            return t;
+        if (!t->active && !free_track)
+            free_track = t;
+    }
+    return free_track;
+}
+
+static void endPan(GestureRecognizer* g)
+{
+    GestureTrack* t = g->pan;
+    GestureEvent* ev = emit(g, GestureType_Pan, GesturePhase_End, t->x, t->y);
+    if (ev) {
+        ev->vx = t->vx;
+        ev->vy = t->vy;
+    }
+    g->pan = NULL;
+}
+
+static void endPinch(GestureRecognizer* g)
+{
+    GestureTrack* a = g->pinch[0];
+    GestureTrack* b = g->pinch[1];
+    emit(g, GestureType_Pinch, GesturePhase_End, (a->x + b->x) * 0.5f, (a->y + b->y) * 0.5f);
+    g->pinch[0] = g->pinch[1] = NULL;
+}
+
+static void trackMoved(GestureRecognizer* g, GestureTrack* t, float x, float y, u64 tick)
+{
+    float dt = armTicksToNs(tick - t->last_tick) / 1e9f;
+    if (dt > 0.0f) {
+        t->vx += VELOCITY_SMOOTHING * ((x - t->x) / dt - t->vx);
+        t->vy += VELOCITY_SMOOTHING * ((y - t->y) / dt - t->vy);
+    }
+    t->x = x;
+    t->y = y;
+    t->last_tick = tick;
+
+    if (!t->moved && distance(t->start_x, t->start_y, x, y) > GESTURE_SLOP)
+        t->moved = true;
+
+    if (!t->moved && !t->long_pressed && armTicksToNs(tick - t->start_tick) >= GESTURE_LONG_PRESS_MS * 1000000ULL) {
+        t->long_pressed = true;
+        emit(g, GestureType_LongPress, GesturePhase_Begin, x, y);
+    }
+}
+
+static void trackEnded(GestureRecognizer* g, GestureTrack* t)
+{
+    if (g->pinch[0] == t || g->pinch[1] == t)
+        endPinch(g);
+
+    if (g->pan == t) {
+        endPan(g);
+        if (sqrtf(t->vx * t->vx + t->vy * t->vy) >= GESTURE_SWIPE_SPEED) {
+            GestureEvent* ev = emit(g, GestureType_Swipe, GesturePhase_End, t->x, t->y);
+            if (ev) {
+                ev->vx = t->vx;
+                ev->vy = t->vy;
+            }
+        }
+    } else if (!t->moved && !t->long_pressed && armTicksToNs(t->last_tick - t->start_tick) < GESTURE_TAP_MS * 1000000ULL) {
+        emit(g, GestureType_Tap, GesturePhase_End, t->start_x, t->start_y);
+    }
+
+    t->active = false;
+    g->num_active--;
+}
+
+u32 gestureUpdate(GestureRecognizer* g, const touchPosition* touches, u32 count, u64 tick)
+{
+    g->num_events = 0;
+    g->update++;
+
+    for (u32 i = 0; i < count; i++) {
+        const touchPosition* tp = &touches[i];
+        GestureTrack* t = findTrack(g, tp->id);
+        if (!t)
+            continue; // More fingers than tracks
+
+        if (!t->active) {
+            memset(t, 0, sizeof(*t));
+            t->id = tp->id;
+            t->active = true;
+            t->start_x = t->x = tp->px;
+            t->start_y = t->y = tp->py;
+            t->start_tick = t->last_tick = tick;
+            g->num_active++;
+        } else {
+            trackMoved(g, t, tp->px, tp->py, tick);
+        }
+        t->seen = g->update;
+    }
+
+    // Lifted fingers
+    GestureTrack* remaining[2] = { NULL, NULL };
+    u32 num_remaining = 0;
+    for (u32 i = 0; i < GESTURE_MAX_TRACKS; i++) {
+        GestureTrack* t = &g->tracks[i];
+        if (!t->active)
+            continue;
+        if (t->seen != g->update)
+            trackEnded(g, t);
+        else if (num_remaining < 2)
+            remaining[num_remaining++] = t;
+    }
+
+    // Two fingers pinch, anything else than one finger ends a pan
+    if (g->pinch[0] && g->num_active != 2)
+        endPinch(g);
+    if (g->pan && g->num_active != 1)
+        endPan(g);
+
+    if (g->num_active == 2) {
+        GestureTrack* a = remaining[0];
+        GestureTrack* b = remaining[1];
+        float dist = distance(a->x, a->y, b->x, b->y);
+        float cx = (a->x + b->x) * 0.5f, cy = (a->y + b->y) * 0.5f;
+
+        if (!g->pinch[0]) {
+            // Neither finger counts as a tap or long press anymore
+            a->moved = b->moved = true;
+            a->pinched = b->pinched = true;
+            g->pinch[0] = a;
+            g->pinch[1] = b;
+            emit(g, GestureType_Pinch, GesturePhase_Begin, cx, cy);
+        } else {
+            GestureEvent* ev = emit(g, GestureType_Pinch, GesturePhase_Move, cx, cy);
+            if (ev && g->pinch_dist > 0.0f)
+                ev->scale = dist / g->pinch_dist;
+        }
+        g->pinch_dist = dist;
+    } else if (g->num_active == 1 && remaining[0]->moved) {
+        GestureTrack* t = remaining[0];
+        GestureEvent* ev;
+
+        if (!g->pan) {
+            // Picks up from the start of the touch, or from where the finger is after a pinch
+            g->pan = t;
+            ev = emit(g, GestureType_Pan, GesturePhase_Begin, t->x, t->y);
+            g->pan_x = t->pinched ? t->x : t->start_x;
+            g->pan_y = t->pinched ? t->y : t->start_y;
+        } else {
+            ev = emit(g, GestureType_Pan, GesturePhase_Move, t->x, t->y);
+        }
+        if (ev) {
+            ev->dx = t->x - g->pan_x;
+            ev->dy = t->y - g->pan_y;
+            ev->vx = t->vx;
+            ev->vy = t->vy;
+        }
+        g->pan_x = t->x;
+        g->pan_y = t->y;
+    }
+
+    return g->num_events;
+}
+
+u32 gestureUpdateFromHid(GestureRecognizer* g)
+{
+    touchPosition touches[GESTURE_MAX_TRACKS];
+    u32 count = hidTouchCount();
+    if (count > GESTURE_MAX_TRACKS)
+        count = GESTURE_MAX_TRACKS;
+    for (u32 i = 0; i < count; i++)
+        hidTouchRead(&touches[i], i);
+    return gestureUpdate(g, touches, count, armGetSystemTick());
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <switch.h>
+
+// Multi-touch gesture recognizer: tap, long press, pan, pinch and swipe.
+//
+// gestureUpdate is given the touches of the current frame. It follows each finger by its touch id,
+// with a smoothed velocity, and emits gesture events into a fixed array: there's no allocation, and
+// the work done is proportional to the number of touches.
+//
+// - Tap:       a finger lifted within GESTURE_TAP_MS, without moving further than GESTURE_SLOP
+// - LongPress: a finger held for GESTURE_LONG_PRESS_MS without moving, emitted once while it's held
+// - Pan:       a single finger moving, with Begin/Move/End phases and the movement since the previous event
+// - Pinch:     two fingers, with Begin/Move/End phases and the change in distance since the previous event
+// - Swipe:     a pan which ended with the finger moving faster than GESTURE_SWIPE_SPEED
+//
+// Usage:
+//     GestureRecognizer gestures;
+//     gestureInit(&gestures);
+//     ...
+//     // Once per frame, after hidScanInput
+//     u32 count = gestureUpdateFromHid(&gestures);
+//     for (u32 i = 0; i < count; i++)
+//         handle(&gestures.events[i]);
+
+#define GESTURE_MAX_TRACKS    16
+#define GESTURE_MAX_EVENTS    16
+#define GESTURE_SLOP          16.0f   // pixels
+#define GESTURE_TAP_MS        250
+#define GESTURE_LONG_PRESS_MS 500
+#define GESTURE_SWIPE_SPEED   1000.0f // pixels per second
+
+typedef enum {
+    GestureType_Tap,
+    GestureType_LongPress,
+    GestureType_Pan,
+    GestureType_Pinch,
+    GestureType_Swipe,
+} GestureType;
+
+typedef enum {
+    GesturePhase_Begin,
+    GesturePhase_Move,
+    GesturePhase_End,
+} GesturePhase;
+
+typedef struct {
+    GestureType type;
+    GesturePhase phase; // Pan and Pinch only
+    float x, y;         // Position, or center of the two fingers for Pinch
+    float dx, dy;       // Pan: movement since the previous Pan event
+    float vx, vy;       // Pan and Swipe: velocity in pixels per second
+    float scale;        // Pinch: distance between the fingers, relative to the previous Pinch event
+} GestureEvent;
+
+typedef struct {
+    u32 id;
+    bool active;
+    bool moved;        // Went further than GESTURE_SLOP from where it started
+    bool long_pressed;
+    bool pinched;      // Was part of a pinch
+    float start_x, start_y;
+    float x, y;
+    float vx, vy;
+    u64 start_tick;
+    u64 last_tick;
+    u32 seen;          // Last update the finger was present in
+} GestureTrack;
+
+typedef struct {
+    GestureTrack tracks[GESTURE_MAX_TRACKS];
+    u32 num_active;
+    u32 update;
+
+    GestureTrack* pan;       // Finger being panned, if any
+    float pan_x, pan_y;      // Position of the previous Pan event
+    GestureTrack* pinch[2];  // Fingers being pinched, if any
+    float pinch_dist;        // Distance of the previous Pinch event
+
+    GestureEvent events[GESTURE_MAX_EVENTS];
+    u32 num_events;
+    u32 dropped_events;
+} GestureRecognizer;
+
+void gestureInit(GestureRecognizer* g);
+
+// Processes the touches of a frame, taken at the given system tick. Returns the number of events in g->events.
+u32 gestureUpdate(GestureRecognizer* g, const touchPosition* touches, u32 count, u64 tick);
+// Same, with the touches of the latest hidScanInput
+u32 gestureUpdateFromHid(GestureRecognizer* g);
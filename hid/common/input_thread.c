@@ -0,0 +1,90 @@
+#include <string.h>
+
+#include "input_thread.h"
+
+bool inputRingPush(InputRing* ring, const InputEvent* ev)
+{
+    u32 head = ring->head;
+    if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) >= INPUT_RING_SIZE) {
+        __atomic_add_fetch(&ring->dropped, 1, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    ring->events[head % INPUT_RING_SIZE] = *ev;
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool inputRingPop(InputRing* ring, InputEvent* ev)
+{
+    u32 tail = ring->tail;
+    if (tail == __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE))
+        return false;
+
+    *ev = ring->events[tail % INPUT_RING_SIZE];
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static void inputThreadFunc(void* arg)
+{
+    InputThread* it = (InputThread*)arg;
+
+    while (__atomic_load_n(&it->running, __ATOMIC_ACQUIRE)) {
+        hidScanInput();
+        u64 tick = armGetSystemTick();
+        u64 held = hidKeysHeld(it->id);
+        it->scans++;
+
+        if (held != it->held) {
+            InputEvent ev;
+            ev.tick = tick;
+            ev.down = held & ~it->held;
+            ev.up = it->held & ~held;
+            ev.held = held;
+            // When the ring is full the transition is retried on the next scan, so that the
+            // consumer always sees masks computed against the state it last received
+            if (inputRingPush(&it->ring, &ev))
+                it->held = held;
+        }
+
+        svcSleepThread(it->period_ns);
+    }
+}
+
+Result inputThreadStart(InputThread* it, HidControllerID id, u64 period_ns)
+{
+    memset(it, 0, sizeof(*it));
+    it->id = id;
+    it->period_ns = period_ns;
+    it->running = true;
+
+    // Above the main thread, so that scans happen on time even while a frame is being built
+    Result rc = threadCreate(&it->thread, inputThreadFunc, it, NULL, 0x4000, 0x2B, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&it->thread);
+        if (R_FAILED(rc))
+            threadClose(&it->thread);
+    }
+    if (R_FAILED(rc))
+        it->running = false;
+    return rc;
+}
+
+void inputThreadStop(InputThread* it)
+{
+    if (!it->running)
+        return;
+
+    __atomic_store_n(&it->running, false, __ATOMIC_RELEASE);
+    threadWaitForExit(&it->thread);
+    threadClose(&it->thread);
+}
+
+u32 inputThreadPoll(InputThread* it, InputEvent* events, u32 max)
+{
+    u32 count = 0;
+    while (count < max && inputRingPop(&it->ring, &events[count]))
+        count++;
+    return count;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <switch.h>
+
+// Input sampling thread, so that button presses are seen with sub-frame timing.
+//
+// Calling hidScanInput once per frame only compares the state at two frames: a press shorter than a
+// frame is lost, and every press is timed to the frame it's seen on. Instead, the input thread scans
+// every period_ns (faster than controllers report), and pushes an event with the system tick into a
+// ring whenever the buttons changed. The game thread then takes all the events since the last frame
+// with inputThreadPoll.
+//
+// The input thread is the only one calling hidScanInput while it runs; the other hid functions
+// (hidJoystickRead, hidTouchRead...) can still be used from any thread, and return the latest scan.
+//
+// Usage:
+//     InputThread input;
+//     inputThreadStart(&input, CONTROLLER_P1_AUTO, INPUT_THREAD_DEFAULT_PERIOD);
+//     ...
+//     // Once per frame
+//     InputEvent events[INPUT_RING_SIZE];
+//     u32 count = inputThreadPoll(&input, events, INPUT_RING_SIZE);
+
+#define INPUT_RING_SIZE 256 // Power of two
+#define INPUT_THREAD_DEFAULT_PERIOD 1000000ULL // 1ms
+
+typedef struct {
+    u64 tick;   // armGetSystemTick of the scan that saw the change
+    u64 down;   // Buttons pressed since the previous event
+    u64 up;     // Buttons released since the previous event
+    u64 held;   // Buttons held from then on
+} InputEvent;
+
+// Single producer, single consumer ring of events
+typedef struct {
+    InputEvent events[INPUT_RING_SIZE];
+    u32 head;    // Next event to write, only written by the producer
+    u32 tail;    // Next event to read, only written by the consumer
+    u32 dropped; // Events lost because the consumer fell behind
+} InputRing;
+
+// Returns false (and counts the event as dropped) if the ring is full
+bool inputRingPush(InputRing* ring, const InputEvent* ev);
+// Returns false if the ring is empty
+bool inputRingPop(InputRing* ring, InputEvent* ev);
+
+typedef struct {
+    Thread thread;
+    bool running;
+    HidControllerID id;
+    u64 period_ns;
+    u64 held;
+    u32 scans;
+    InputRing ring;
+} InputThread;
+
+Result inputThreadStart(InputThread* it, HidControllerID id, u64 period_ns);
+void inputThreadStop(InputThread* it);
+
+// Takes the oldest events queued by the input thread, up to max. Returns their count.
+u32 inputThreadPoll(InputThread* it, InputEvent* events, u32 max);
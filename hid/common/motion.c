@@ -0,0 +1,120 @@
+#include <string.h>
+#include <math.h>
+
+#include "motion.h"
+
+// Sampling period of the sensors, used until the time between two reads is known
+#define DEFAULT_SAMPLE_PERIOD 0.005f
+
+void motionFilterInit(MotionFilter* f, float beta)
+{
+    f->q[0] = 1.0f;
+    f->q[1] = f->q[2] = f->q[3] = 0.0f;
+    f->beta = beta;
+}
+
+void motionFilterUpdate(MotionFilter* f, const float gyro[3], const float accel[3], float dt)
+{
+    float q0 = f->q[0], q1 = f->q[1], q2 = f->q[2], q3 = f->q[3];
+    float gx = gyro[0], gy = gyro[1], gz = gyro[2];
+
+    // Rate of change of the quaternion, from the gyroscope
+    float qd0 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz);
+    float qd1 = 0.5f * ( q0 * gx + q2 * gz - q3 * gy);
+    float qd2 = 0.5f * ( q0 * gy - q1 * gz + q3 * gx);
+    float qd3 = 0.5f * ( q0 * gz + q1 * gy - q2 * gx);
+
+    // Gradient descent step towards the orientation where gravity points along the accelerometer reading
+    float an = accel[0] * accel[0] + accel[1] * accel[1] + accel[2] * accel[2];
+    if (an > 0.0f) {
+        float inv = 1.0f / sqrtf(an);
+        float ax = accel[0] * inv, ay = accel[1] * inv, az = accel[2] * inv;
+
+        float q0q0 = q0 * q0, q1q1 = q1 * q1, q2q2 = q2 * q2, q3q3 = q3 * q3;
+        float s0 = 4.0f * q0 * q2q2 + 2.0f * q2 * ax + 4.0f * q0 * q1q1 - 2.0f * q1 * ay;
+        float s1 = 4.0f * q1 * q3q3 - 2.0f * q3 * ax + 4.0f * q0q0 * q1 - 2.0f * q0 * ay - 4.0f * q1
+                 + 8.0f * q1 * q1q1 + 8.0f * q1 * q2q2 + 4.0f * q1 * az;
+        float s2 = 4.0f * q0q0 * q2 + 2.0f * q0 * ax + 4.0f * q2 * q3q3 - 2.0f * q3 * ay - 4.0f * q2
+                 + 8.0f * q2 * q1q1 + 8.0f * q2 * q2q2 + 4.0f * q2 * az;
+        float s3 = 4.0f * q1q1 * q3 - 2.0f * q1 * ax + 4.0f * q2q2 * q3 - 2.0f * q2 * ay;
+
+        float sn = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+        if (sn > 0.0f) {
+            float k = f->beta / sqrtf(sn);
+            qd0 -= k * s0;
+            qd1 -= k * s1;
+            qd2 -= k * s2;
+            qd3 -= k * s3;
+        }
+    }
+
+    q0 += qd0 * dt;
+    q1 += qd1 * dt;
+    q2 += qd2 * dt;
+    q3 += qd3 * dt;
+
+    float inv = 1.0f / sqrtf(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+    f->q[0] = q0 * inv;
+    f->q[1] = q1 * inv;
+    f->q[2] = q2 * inv;
+    f->q[3] = q3 * inv;
+}
+
+void motionFilterGetEuler(const MotionFilter* f, float* yaw, float* pitch, float* roll)
+{
+    float q0 = f->q[0], q1 = f->q[1], q2 = f->q[2], q3 = f->q[3];
+    float sp = 2.0f * (q0 * q2 - q3 * q1);
+    *roll = atan2f(2.0f * (q0 * q1 + q2 * q3), 1.0f - 2.0f * (q1 * q1 + q2 * q2));
+    *pitch = fabsf(sp) >= 1.0f ? copysignf((float)M_PI / 2, sp) : asinf(sp);
+    *yaw = atan2f(2.0f * (q0 * q3 + q1 * q2), 1.0f - 2.0f * (q2 * q2 + q3 * q3));
+}
+
+void sixAxisReaderInit(SixAxisReader* r, HidControllerID id, float beta)
+{
+    memset(r, 0, sizeof(*r));
+    r->id = id;
+    motionFilterInit(&r->filter, beta);
+}
+
+u32 sixAxisReaderUpdate(SixAxisReader* r)
+{
+    // Newest first
+    SixAxisSensorValues history[MOTION_HISTORY_SIZE];
+    u32 count = hidSixAxisSensorValuesRead(history, r->id, MOTION_HISTORY_SIZE);
+    u64 tick = armGetSystemTick();
+    r->reads++;
+
+    u32 fresh = 0;
+    while (fresh < count && !(r->has_last && memcmp(&history[fresh], &r->last, sizeof(r->last)) == 0))
+        fresh++;
+    if (!fresh)
+        return 0;
+    if (fresh == MOTION_HISTORY_SIZE && r->has_last)
+        r->overruns++;
+
+    // The new samples are spread evenly over the time since the previous read
+    float dt = DEFAULT_SAMPLE_PERIOD;
+    if (r->has_last) {
+        dt = armTicksToNs(tick - r->last_tick) / 1e9f / fresh;
+        if (dt > 4 * DEFAULT_SAMPLE_PERIOD)
+            dt = 4 * DEFAULT_SAMPLE_PERIOD;
+    }
+
+    for (u32 i = fresh; i-- > 0;) {
+        const SixAxisSensorValues* v = &history[i];
+        // The gyroscope reports rotations per second
+        float gyro[3] = {
+            v->gyroscope.x * 2.0f * (float)M_PI,
+            v->gyroscope.y * 2.0f * (float)M_PI,
+            v->gyroscope.z * 2.0f * (float)M_PI,
+        };
+        float accel[3] = { v->accelerometer.x, v->accelerometer.y, v->accelerometer.z };
+        motionFilterUpdate(&r->filter, gyro, accel, dt);
+    }
+
+    r->last = history[0];
+    r->has_last = true;
+    r->last_tick = tick;
+    r->samples += fresh;
+    return fresh;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <switch.h>
+
+// Motion sensing: batched six-axis reads, fused into an orientation.
+//
+// The sensors sample far more often than a game renders, and libnx keeps the last 17 samples of
+// each controller in shared memory. Reading only the latest one per frame throws the others away,
+// and with them most of the gyroscope integration. SixAxisReader reads the whole history at once
+// (a plain shared memory read, no IPC), keeps only the samples it hasn't seen yet, and runs each of
+// them through a Madgwick filter, oldest first.
+//
+// The history has no sampling numbers, so samples are matched against the newest one of the previous
+// read. If all 17 are new, samples were likely missed in between: these reads are counted as overruns.
+
+#define MOTION_HISTORY_SIZE 17
+#define MOTION_DEFAULT_BETA 0.05f // Weight of the accelerometer correction, higher converges faster but is noisier
+
+// Madgwick orientation filter (IMU version: gyroscope and accelerometer, no magnetometer)
+typedef struct {
+    float q[4];   // Orientation quaternion, w x y z
+    float beta;
+} MotionFilter;
+
+void motionFilterInit(MotionFilter* f, float beta);
+// gyro in radians per second, accel in any unit (only its direction is used), dt in seconds
+void motionFilterUpdate(MotionFilter* f, const float gyro[3], const float accel[3], float dt);
+// In radians
+void motionFilterGetEuler(const MotionFilter* f, float* yaw, float* pitch, float* roll);
+
+typedef struct {
+    HidControllerID id;
+    SixAxisSensorValues last;   // Newest sample of the previous read
+    bool has_last;
+    u64 last_tick;
+    MotionFilter filter;
+
+    // Statistics
+    u32 samples;
+    u32 reads;
+    u32 overruns;
+} SixAxisReader;
+
+// The sensors must have been started with hidStartSixAxisSensor
+void sixAxisReaderInit(SixAxisReader* r, HidControllerID id, float beta);
+// Reads the history and fuses the new samples, returning their count
+u32 sixAxisReaderUpdate(SixAxisReader* r);
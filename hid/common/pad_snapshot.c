@@ -0,0 +1,64 @@
+#include <string.h>
+
+#include "pad_snapshot.h"
+
+void padSnapshotInit(PadSnapshot* snap)
+{
+    memset(snap, 0, sizeof(*snap));
+}
+
+static void refreshPower(PadSnapshot* snap, HidControllerID id)
+{
+    PadSnapshotInfo* info = &snap->cache[id];
+    memset(info->power, 0, sizeof(info->power));
+    hidGetControllerPowerInfo(id, &info->power[0], 1);
+    hidGetControllerPowerInfo(id, &info->power[1], 2);
+    snap->refreshes++;
+}
+
+static void refreshInfo(PadSnapshot* snap, HidControllerID id, HidControllerType type)
+{
+    PadSnapshotInfo* info = &snap->cache[id];
+    info->type = type;
+    info->device_type = hidGetControllerDeviceType(id);
+    info->interface_type = 0;
+    hidGetNpadInterfaceType(id, &info->interface_type);
+    refreshPower(snap, id);
+}
+
+void padSnapshotUpdate(PadSnapshot* snap)
+{
+    u32 connected = 0;
+    u32 n = 0;
+
+    for (u32 i = 0; i < PAD_SNAPSHOT_MAX_PADS; i++) {
+        HidControllerID id = (HidControllerID)i;
+        if (!hidIsControllerConnected(id))
+            continue;
+
+        connected |= BIT(i);
+        HidControllerType type = hidGetControllerType(id);
+        if (!(snap->connected & BIT(i)) || type != snap->cache[i].type)
+            refreshInfo(snap, id, type);
+
+        snap->id[n] = id;
+        snap->buttons[n] = hidKeysHeld(id);
+        hidJoystickRead(&snap->sticks[JOYSTICK_LEFT][n], id, JOYSTICK_LEFT);
+        hidJoystickRead(&snap->sticks[JOYSTICK_RIGHT][n], id, JOYSTICK_RIGHT);
+        snap->info[n] = &snap->cache[i];
+        n++;
+    }
+
+    snap->count = n;
+    snap->joined = connected & ~snap->connected;
+    snap->left = snap->connected & ~connected;
+    snap->connected = connected;
+
+    // Battery levels have no change notification: refresh them one controller at a time
+    u64 now = armGetSystemTick();
+    if (n && now >= snap->next_power_tick) {
+        snap->next_power_id = (snap->next_power_id + 1) % n;
+        refreshPower(snap, snap->id[snap->next_power_id]);
+        snap->next_power_tick = now + armNsToTicks(PAD_SNAPSHOT_POWER_PERIOD_MS * 1000000ULL);
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <switch.h>
+
+// State of every connected controller, gathered in one pass per frame.
+//
+// padSnapshotUpdate walks the controller ids once after hidScanInput, and packs the connected
+// controllers at the front of each array (struct of arrays: a loop over all the players' buttons
+// or sticks touches one contiguous array). The type of each controller is read every frame, since
+// it's a plain shared memory read, and is used to detect changes. Everything else that's slow or
+// rarely changes is cached per controller and refreshed only when needed:
+// - the device and interface types (hidGetNpadInterfaceType is an IPC call), when the controller
+//   connects or its type changes,
+// - the power info, at the same times, and otherwise for one controller every
+//   PAD_SNAPSHOT_POWER_PERIOD_MS, so that the cost stays the same however many players there are.
+
+#define PAD_SNAPSHOT_MAX_PADS 10 // CONTROLLER_PLAYER_1 to CONTROLLER_UNKNOWN
+#define PAD_SNAPSHOT_POWER_PERIOD_MS 100
+
+typedef struct {
+    HidControllerType type;
+    u32 device_type;
+    u8 interface_type;
+    HidPowerInfo power[3];  // Whole controller, then left and right Joy-Con
+} PadSnapshotInfo;
+
+typedef struct {
+    // Connected controllers, in id order
+    u32 count;
+    HidControllerID id[PAD_SNAPSHOT_MAX_PADS];
+    u64 buttons[PAD_SNAPSHOT_MAX_PADS];
+    JoystickPosition sticks[2][PAD_SNAPSHOT_MAX_PADS]; // Indexed by JOYSTICK_LEFT/JOYSTICK_RIGHT first
+    const PadSnapshotInfo* info[PAD_SNAPSHOT_MAX_PADS];
+
+    // Bitmasks by controller id
+    u32 connected;
+    u32 joined;       // since the previous update
+    u32 left;
+
+    // Per controller id
+    PadSnapshotInfo cache[PAD_SNAPSHOT_MAX_PADS];
+    u64 next_power_tick;
+    u32 next_power_id;
+    u32 refreshes;    // Number of cache refreshes, for statistics
+} PadSnapshot;
+
+void padSnapshotInit(PadSnapshot* snap);
+// Must be called after hidScanInput
+void padSnapshotUpdate(PadSnapshot* snap);
@@ -0,0 +1,134 @@
+#include <string.h>
+
+#include "ringcon_reader.h"
+
+static float ringConReaderCalibrate(const RingConCalibration* cal, s16 raw)
+{
+    float d = raw - cal->neutral;
+    float range = d >= 0 ? cal->pushed - cal->neutral : cal->neutral - cal->pulled;
+    if (range <= 0)
+        return 0.0f;
+
+    float v = d / range;
+    return v > 1.0f ? 1.0f : v < -1.0f ? -1.0f : v;
+}
+
+static void ringConReaderAdd(RingConReader* r, const RingConPollingData* data, u64 tick)
+{
+    mutexLock(&r->mutex);
+    float v = r->calibrated ? ringConReaderCalibrate(&r->cal, data->data) : data->data;
+    r->filtered = r->filter_reset ? v : r->filtered + r->smoothing * (v - r->filtered);
+    r->filter_reset = false;
+
+    RingConSample* s = &r->history[r->count % RINGCON_HISTORY_SIZE];
+    s->sampling_number = data->sampling_number;
+    s->tick = tick;
+    s->raw = data->data;
+    s->value = r->filtered;
+    r->count++;
+    mutexUnlock(&r->mutex);
+}
+
+static void ringConReaderThreadFunc(void* arg)
+{
+    RingConReader* r = (RingConReader*)arg;
+
+    while (__atomic_load_n(&r->running, __ATOMIC_ACQUIRE)) {
+        RingConPollingData polldata[RINGCON_POLL_SIZE];
+        s32 total_out = 0;
+        r->last_rc = ringconGetPollingData(r->ring, polldata, RINGCON_POLL_SIZE, &total_out);
+        u64 tick = armGetSystemTick();
+        r->reads++;
+
+        // The new reports, oldest first, whichever order the buffer is in
+        while (R_SUCCEEDED(r->last_rc)) {
+            const RingConPollingData* next = NULL;
+            for (s32 i = 0; i < total_out; i++) {
+                if ((!r->has_last || polldata[i].sampling_number > r->last_sampling_number) &&
+                    (!next || polldata[i].sampling_number < next->sampling_number))
+                    next = &polldata[i];
+            }
+            if (!next)
+                break;
+
+            if (r->has_last && next->sampling_number > r->last_sampling_number + 1)
+                r->lost += next->sampling_number - r->last_sampling_number - 1;
+            r->last_sampling_number = next->sampling_number;
+            r->has_last = true;
+            ringConReaderAdd(r, next, tick);
+        }
+
+        svcSleepThread(r->period_ns);
+    }
+}
+
+Result ringConReaderStart(RingConReader* r, RingCon* ring, u64 period_ns, float smoothing)
+{
+    memset(r, 0, sizeof(*r));
+    r->ring = ring;
+    r->period_ns = period_ns;
+    r->smoothing = smoothing;
+    r->filter_reset = true;
+    r->running = true;
+    mutexInit(&r->mutex);
+
+    // Above the main thread, so that reads happen on time even while a frame is being built
+    Result rc = threadCreate(&r->thread, ringConReaderThreadFunc, r, NULL, 0x4000, 0x2B, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&r->thread);
+        if (R_FAILED(rc))
+            threadClose(&r->thread);
+    }
+    if (R_FAILED(rc))
+        r->running = false;
+    return rc;
+}
+
+void ringConReaderStop(RingConReader* r)
+{
+    if (!r->running)
+        return;
+
+    __atomic_store_n(&r->running, false, __ATOMIC_RELEASE);
+    threadWaitForExit(&r->thread);
+    threadClose(&r->thread);
+}
+
+void ringConReaderSetSmoothing(RingConReader* r, float smoothing)
+{
+    mutexLock(&r->mutex);
+    r->smoothing = smoothing;
+    mutexUnlock(&r->mutex);
+}
+
+void ringConReaderSetCalibration(RingConReader* r, const RingConCalibration* cal)
+{
+    mutexLock(&r->mutex);
+    r->cal = *cal;
+    r->calibrated = true;
+    // Restart the filter from the next sample, instead of blending raw and calibrated values
+    r->filter_reset = true;
+    mutexUnlock(&r->mutex);
+}
+
+bool ringConReaderGetLatest(RingConReader* r, RingConSample* out)
+{
+    mutexLock(&r->mutex);
+    bool found = r->count != 0;
+    if (found)
+        *out = r->history[(r->count - 1) % RINGCON_HISTORY_SIZE];
+    mutexUnlock(&r->mutex);
+    return found;
+}
+
+u32 ringConReaderGetHistory(RingConReader* r, RingConSample* out, u32 max)
+{
+    mutexLock(&r->mutex);
+    u32 n = r->count < RINGCON_HISTORY_SIZE ? r->count : RINGCON_HISTORY_SIZE;
+    if (n > max)
+        n = max;
+    for (u32 i = 0; i < n; i++)
+        out[i] = r->history[(r->count - n + i) % RINGCON_HISTORY_SIZE];
+    mutexUnlock(&r->mutex);
+    return n;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <switch.h>
+
+// Ring-Con sampling thread, with calibration and smoothing.
+//
+// The Ring-Con reports its flex sensor faster than a game renders, and ringconGetPollingData only keeps the last
+// RINGCON_POLL_SIZE reports. Reading one entry per frame loses most of them, and puts the read on the frame. Instead,
+// the reader thread reads the whole buffer every period_ns, keeps the reports it hasn't seen yet (by sampling
+// number), and runs each of them once through the calibration and a low-pass filter into a history ring. The game
+// thread takes the latest sample or the recent history, which are plain copies under a mutex.
+//
+// Usage:
+//     RingConReader reader;
+//     ringConReaderStart(&reader, &ring, RINGCON_READER_DEFAULT_PERIOD, RINGCON_READER_DEFAULT_SMOOTHING);
+//     ...
+//     // Once per frame
+//     RingConSample sample;
+//     if (ringConReaderGetLatest(&reader, &sample)) ... sample.value ...
+
+#define RINGCON_POLL_SIZE 9
+#define RINGCON_HISTORY_SIZE 64                  // Power of two
+#define RINGCON_READER_DEFAULT_PERIOD 4000000ULL // 4ms
+#define RINGCON_READER_DEFAULT_SMOOTHING 0.3f
+
+// Raw sensor values at rest, fully pulled apart and fully squeezed, measured by having the user hold the Ring-Con so
+typedef struct {
+    s16 neutral;
+    s16 pulled;
+    s16 pushed;
+} RingConCalibration;
+
+typedef struct {
+    u64 sampling_number;
+    u64 tick;      // armGetSystemTick of the read that saw it
+    s16 raw;
+    float value;   // Calibrated and filtered: -1 fully pulled, 0 at rest, 1 fully squeezed. Raw and filtered without calibration.
+} RingConSample;
+
+typedef struct {
+    Thread thread;
+    bool running;
+    RingCon* ring;
+    u64 period_ns;
+
+    Mutex mutex;                  // Protects everything below
+    float smoothing;              // Weight of each new sample in the low-pass filter, 1 to disable it
+    RingConCalibration cal;
+    bool calibrated;
+    bool filter_reset;            // The next sample restarts the filter
+    RingConSample history[RINGCON_HISTORY_SIZE];
+    u32 count;                    // Samples ever added, the newest is history[(count - 1) % RINGCON_HISTORY_SIZE]
+
+    // Only used by the reader thread
+    u64 last_sampling_number;
+    bool has_last;
+    float filtered;
+
+    // Statistics
+    u32 reads;
+    u32 lost;                     // Reports which left the polling buffer before being read
+    Result last_rc;
+} RingConReader;
+
+// The Ring-Con must have been set up with ringconCreate
+Result ringConReaderStart(RingConReader* r, RingCon* ring, u64 period_ns, float smoothing);
+void ringConReaderStop(RingConReader* r);
+
+void ringConReaderSetSmoothing(RingConReader* r, float smoothing);
+// Applies to the samples read from then on
+void ringConReaderSetCalibration(RingConReader* r, const RingConCalibration* cal);
+
+// Returns false if there's no sample yet
+bool ringConReaderGetLatest(RingConReader* r, RingConSample* out);
+// Copies up to max of the latest samples, oldest first, returns their count
+u32 ringConReaderGetHistory(RingConReader* r, RingConSample* out, u32 max);
@@ -0,0 +1,258 @@
+#include <string.h>
+
+#include "rumble.h"
+
+#define HANDLE_EFFECT_BITS 8
+
+// Same as what official software sends to stop: muted bands, with the default frequencies
+static const HidVibrationValue stop_value = { 0.0f, 160.0f, 0.0f, 320.0f };
+
+typedef struct {
+    float amp_low, freq_low, amp_high, freq_high;
+} RumbleMix;
+
+static int controllerIndex(HidControllerID id)
+{
+    if (id == CONTROLLER_P1_AUTO)
+        id = hidGetHandheldMode() ? CONTROLLER_HANDHELD : CONTROLLER_PLAYER_1;
+    if (id == CONTROLLER_HANDHELD)
+        return RUMBLE_MAX_CONTROLLERS - 1;
+    if (id >= CONTROLLER_PLAYER_1 && id < CONTROLLER_PLAYER_1 + RUMBLE_MAX_CONTROLLERS - 1)
+        return id - CONTROLLER_PLAYER_1;
+    return -1;
+}
+
+static HidControllerID controllerId(int index)
+{
+    return index == RUMBLE_MAX_CONTROLLERS - 1 ? CONTROLLER_HANDHELD : (HidControllerID)(CONTROLLER_PLAYER_1 + index);
+}
+
+// Initializes the vibration devices for the current type of the controller. Returns false if it can't vibrate.
+static bool setupController(RumbleController* c, HidControllerID id)
+{
+    HidControllerType type = hidGetControllerType(id);
+    if (type == c->type)
+        return c->num_handles != 0;
+
+    // Two motors for the pairs, one for single Joy-Cons
+    static const struct { HidControllerType type; u32 num_handles; u8 motors[2]; } kinds[] = {
+        { TYPE_PROCONTROLLER, 2, { RumbleMotor_Left, RumbleMotor_Right } },
+        { TYPE_JOYCON_PAIR,   2, { RumbleMotor_Left, RumbleMotor_Right } },
+        { TYPE_HANDHELD,      2, { RumbleMotor_Left, RumbleMotor_Right } },
+        { TYPE_JOYCON_LEFT,   1, { RumbleMotor_Left } },
+        { TYPE_JOYCON_RIGHT,  1, { RumbleMotor_Right } },
+    };
+
+    c->type = type;
+    c->num_handles = 0;
+    c->vibrating = false;
+    for (u32 i = 0; i < sizeof(kinds) / sizeof(kinds[0]); i++) {
+        if (!(type & kinds[i].type))
+            continue;
+        if (R_SUCCEEDED(hidInitializeVibrationDevices(c->handles, kinds[i].num_handles, id, kinds[i].type))) {
+            c->num_handles = kinds[i].num_handles;
+            memcpy(c->motors, kinds[i].motors, sizeof(c->motors));
+            c->sent[0] = c->sent[1] = stop_value;
+        }
+        break;
+    }
+    return c->num_handles != 0;
+}
+
+// Adds up the effects, removing the ones which are over. Called with the mutex held.
+static void mixEffects(RumbleScheduler* rs, u64 now, RumbleMix mix[RUMBLE_MAX_CONTROLLERS][2], bool active[RUMBLE_MAX_CONTROLLERS])
+{
+    memset(mix, 0, sizeof(RumbleMix) * RUMBLE_MAX_CONTROLLERS * 2);
+    memset(active, 0, sizeof(bool) * RUMBLE_MAX_CONTROLLERS);
+
+    for (u32 i = 0; i < RUMBLE_MAX_EFFECTS; i++) {
+        RumbleEffect* e = &rs->effects[i];
+        if (!e->clip)
+            continue;
+
+        const RumbleClip* clip = e->clip;
+        u32 total = 0;
+        for (u32 s = 0; s < clip->num_segments; s++)
+            total += clip->segments[s].ms;
+
+        u64 elapsed = armTicksToNs(now - e->start_tick) / 1000000;
+        if (elapsed >= total && (!clip->loop || !total)) {
+            e->clip = NULL;
+            continue;
+        }
+        elapsed %= total;
+
+        const RumbleSegment* seg = clip->segments;
+        while (elapsed >= seg->ms) {
+            elapsed -= seg->ms;
+            seg++;
+        }
+
+        active[e->controller] = true;
+        for (u32 m = 0; m < 2; m++) {
+            if (!(e->motors & BIT(m)))
+                continue;
+            RumbleMix* out = &mix[e->controller][m];
+            float al = seg->amp_low * e->gain, ah = seg->amp_high * e->gain;
+            out->amp_low += al;
+            out->freq_low += al * seg->freq_low;
+            out->amp_high += ah;
+            out->freq_high += ah * seg->freq_high;
+        }
+    }
+}
+
+static HidVibrationValue mixToValue(const RumbleMix* mix)
+{
+    HidVibrationValue v = stop_value;
+    if (mix->amp_low > 0.0f) {
+        v.freq_low = mix->freq_low / mix->amp_low;
+        v.amp_low = mix->amp_low < 1.0f ? mix->amp_low : 1.0f;
+    }
+    if (mix->amp_high > 0.0f) {
+        v.freq_high = mix->freq_high / mix->amp_high;
+        v.amp_high = mix->amp_high < 1.0f ? mix->amp_high : 1.0f;
+    }
+    return v;
+}
+
+static void rumbleThreadFunc(void* arg)
+{
+    RumbleScheduler* rs = (RumbleScheduler*)arg;
+    RumbleMix mix[RUMBLE_MAX_CONTROLLERS][2];
+    bool active[RUMBLE_MAX_CONTROLLERS];
+    u32 handles[RUMBLE_MAX_CONTROLLERS * 2];
+    HidVibrationValue values[RUMBLE_MAX_CONTROLLERS * 2];
+    bool running = true;
+
+    while (running) {
+        running = __atomic_load_n(&rs->running, __ATOMIC_ACQUIRE);
+
+        mutexLock(&rs->mutex);
+        mixEffects(rs, armGetSystemTick(), mix, active);
+        mutexUnlock(&rs->mutex);
+
+        // Stopping sends the stop values to everything that still vibrates
+        if (!running)
+            memset(active, 0, sizeof(active));
+
+        u32 count = 0;
+        for (int i = 0; i < RUMBLE_MAX_CONTROLLERS; i++) {
+            RumbleController* c = &rs->controllers[i];
+            if (!active[i] && !c->vibrating)
+                continue;
+
+            HidControllerID id = controllerId(i);
+            if (!hidIsControllerConnected(id) || !setupController(c, id))
+                continue;
+
+            for (u32 h = 0; h < c->num_handles; h++) {
+                int motor = c->motors[h] == RumbleMotor_Left ? 0 : 1;
+                HidVibrationValue v = active[i] ? mixToValue(&mix[i][motor]) : stop_value;
+                if (memcmp(&v, &c->sent[h], sizeof(v)) == 0)
+                    continue;
+                handles[count] = c->handles[h];
+                values[count] = v;
+                c->sent[h] = v;
+                count++;
+            }
+            c->vibrating = active[i];
+        }
+
+        if (count) {
+            u64 start = armGetSystemTick();
+            hidSendVibrationValues(handles, values, count);
+            rs->send_ticks += armGetSystemTick() - start;
+            rs->sends++;
+            rs->values_sent += count;
+        }
+        rs->ticks++;
+
+        if (running)
+            svcSleepThread(RUMBLE_TICK_NS);
+    }
+}
+
+Result rumbleSchedulerStart(RumbleScheduler* rs)
+{
+    memset(rs, 0, sizeof(*rs));
+    mutexInit(&rs->mutex);
+    rs->next_serial = 1;
+    rs->running = true;
+
+    // Above the main thread: vibration timing shouldn't depend on how long frames take
+    Result rc = threadCreate(&rs->thread, rumbleThreadFunc, rs, NULL, 0x4000, 0x2B, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&rs->thread);
+        if (R_FAILED(rc))
+            threadClose(&rs->thread);
+    }
+    if (R_FAILED(rc))
+        rs->running = false;
+    return rc;
+}
+
+void rumbleSchedulerStop(RumbleScheduler* rs)
+{
+    if (!rs->running)
+        return;
+
+    __atomic_store_n(&rs->running, false, __ATOMIC_RELEASE);
+    threadWaitForExit(&rs->thread);
+    threadClose(&rs->thread);
+}
+
+RumbleHandle rumblePlay(RumbleScheduler* rs, HidControllerID id, const RumbleClip* clip, u8 motors, float gain)
+{
+    int index = controllerIndex(id);
+    if (index < 0 || !clip || !clip->num_segments)
+        return RUMBLE_INVALID_HANDLE;
+
+    RumbleHandle handle = RUMBLE_INVALID_HANDLE;
+    mutexLock(&rs->mutex);
+    for (u32 i = 0; i < RUMBLE_MAX_EFFECTS; i++) {
+        RumbleEffect* e = &rs->effects[i];
+        if (e->clip)
+            continue;
+
+        e->clip = clip;
+        e->controller = index;
+        e->motors = motors;
+        e->gain = gain;
+        e->start_tick = armGetSystemTick();
+        e->serial = rs->next_serial++;
+        if (!(rs->next_serial << HANDLE_EFFECT_BITS))
+            rs->next_serial = 1; // never produce RUMBLE_INVALID_HANDLE
+        handle = (e->serial << HANDLE_EFFECT_BITS) | i;
+        break;
+    }
+    if (handle == RUMBLE_INVALID_HANDLE)
+        rs->rejected++;
+    mutexUnlock(&rs->mutex);
+    return handle;
+}
+
+void rumbleCancel(RumbleScheduler* rs, RumbleHandle handle)
+{
+    u32 i = handle & ((1 << HANDLE_EFFECT_BITS) - 1);
+    if (handle == RUMBLE_INVALID_HANDLE || i >= RUMBLE_MAX_EFFECTS)
+        return;
+
+    mutexLock(&rs->mutex);
+    RumbleEffect* e = &rs->effects[i];
+    if (e->clip && ((e->serial << HANDLE_EFFECT_BITS) | i) == handle)
+        e->clip = NULL;
+    mutexUnlock(&rs->mutex);
+}
+
+void rumbleCancelAll(RumbleScheduler* rs, HidControllerID id)
+{
+    int index = controllerIndex(id);
+
+    mutexLock(&rs->mutex);
+    for (u32 i = 0; i < RUMBLE_MAX_EFFECTS; i++) {
+        if (rs->effects[i].controller == index)
+            rs->effects[i].clip = NULL;
+    }
+    mutexUnlock(&rs->mutex);
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <switch.h>
+
+// Vibration scheduler for all the controllers at once.
+//
+// Gameplay code plays timed rumble clips with rumblePlay, on any controller and from any thread,
+// and never talks to hid itself. A background thread mixes the effects playing on each controller
+// every RUMBLE_TICK_NS: amplitudes add up (clamped to 1) and frequencies are averaged, weighted by
+// amplitude. It then sends the values which changed, for every connected controller, in a single
+// hidSendVibrationValues call. Vibration devices are initialized when a controller first needs them,
+// and again whenever its type changes.
+//
+// Clips are arrays of segments held for their duration, and must stay valid while they play.
+//
+// Usage:
+//     static const RumbleSegment hit_segments[] = { { 40, 0.8f, 160.0f, 0.6f, 320.0f }, { 60, 0.3f, 160.0f, 0.2f, 320.0f } };
+//     static const RumbleClip hit = { hit_segments, 2, false };
+//
+//     static RumbleScheduler rumble;
+//     rumbleSchedulerStart(&rumble);
+//     rumblePlay(&rumble, CONTROLLER_P1_AUTO, &hit, RumbleMotor_Both, 1.0f);
+
+#define RUMBLE_MAX_CONTROLLERS 9 // CONTROLLER_PLAYER_1 to CONTROLLER_PLAYER_8, and CONTROLLER_HANDHELD
+#define RUMBLE_MAX_EFFECTS     32
+#define RUMBLE_TICK_NS         5000000ULL
+
+typedef struct {
+    u32 ms;
+    float amp_low, freq_low;
+    float amp_high, freq_high;
+} RumbleSegment;
+
+typedef struct {
+    const RumbleSegment* segments;
+    u32 num_segments;
+    bool loop;          // Plays until cancelled
+} RumbleClip;
+
+typedef enum {
+    RumbleMotor_Left  = BIT(0),
+    RumbleMotor_Right = BIT(1),
+    RumbleMotor_Both  = BIT(0) | BIT(1),
+} RumbleMotor;
+
+// Identifies one playback of a clip, it becomes stale once the effect ends
+typedef u32 RumbleHandle;
+#define RUMBLE_INVALID_HANDLE 0
+
+typedef struct {
+    const RumbleClip* clip; // NULL when free
+    u32 serial;
+    u8 controller;
+    u8 motors;
+    float gain;
+    u64 start_tick;
+} RumbleEffect;
+
+typedef struct {
+    HidControllerType type; // the vibration devices were initialized for, 0 if none
+    u32 handles[2];
+    u8 motors[2];           // Motor of each handle
+    u32 num_handles;
+    HidVibrationValue sent[2];
+    bool vibrating;         // Last values sent were not the stop values
+} RumbleController;
+
+typedef struct {
+    Thread thread;
+    Mutex mutex;
+    bool running;
+
+    RumbleEffect effects[RUMBLE_MAX_EFFECTS];
+    u32 next_serial;
+    RumbleController controllers[RUMBLE_MAX_CONTROLLERS];
+
+    // Statistics
+    u32 ticks;
+    u32 sends;
+    u32 values_sent;
+    u32 rejected;       // rumblePlay calls which found no free effect
+    u64 send_ticks;     // spent in hidSendVibrationValues
+} RumbleScheduler;
+
+Result rumbleSchedulerStart(RumbleScheduler* rs);
+// Stops all vibrations before returning
+void rumbleSchedulerStop(RumbleScheduler* rs);
+
+// CONTROLLER_P1_AUTO plays on the handheld controller in handheld mode, otherwise on player 1.
+// gain scales the amplitudes of the clip. Returns RUMBLE_INVALID_HANDLE if too many effects are playing.
+RumbleHandle rumblePlay(RumbleScheduler* rs, HidControllerID id, const RumbleClip* clip, u8 motors, float gain);
+void rumbleCancel(RumbleScheduler* rs, RumbleHandle handle);
+void rumbleCancelAll(RumbleScheduler* rs, HidControllerID id);
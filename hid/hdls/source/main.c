@@ -6,6 +6,8 @@
 // Include the main libnx system header, for Switch development
 #include <switch.h>
 
+#include "pad_snapshot.h"
+
 // This example shows how to use Hdls for virtual HID controllers, see also libnx hiddbg.h.
 // The virtual controllers can be used used by all processes.
 
@@ -78,11 +80,16 @@ int main(int argc, char* argv[])
     printf("Press A to scan controllers.\n");
     printf("Press + to exit.\n");
 
+    // State of all the connected controllers, gathered once per frame
+    PadSnapshot pads_snapshot;
+    padSnapshotInit(&pads_snapshot);
+
     // Main loop
     while (appletMainLoop())
     {
         // Scan all the inputs. This should be done once for each frame
         hidScanInput();
+        padSnapshotUpdate(&pads_snapshot);
 
         // hidKeysDown returns information about which buttons have been
         // just pressed in this frame compared to the previous one
@@ -112,25 +119,16 @@ int main(int argc, char* argv[])
 
         if (R_SUCCEEDED(rc) && (kDown & (KEY_A | KEY_X))) {
             printf("Connected controllers:\n");
-            for(i=0; i<10; i++) {
-                if (hidIsControllerConnected(i)) {
-                    JoystickPosition tmpjoy[2];
-                    hidJoystickRead(&tmpjoy[0], i, JOYSTICK_LEFT);
-                    hidJoystickRead(&tmpjoy[1], i, JOYSTICK_RIGHT);
-
-                    u8 interfacetype=0;
-                    rc2 = hidGetNpadInterfaceType(i, &interfacetype);
-                    if (R_FAILED(rc2)) printf("hidGetNpadInterfaceType(): 0x%x\n", rc2);
-
-                    HidPowerInfo powerinfo[3]={0};
-                    hidGetControllerPowerInfo(i, &powerinfo[0], 1);
-                    hidGetControllerPowerInfo(i, &powerinfo[1], 2);
+            for (u32 n=0; n<pads_snapshot.count; n++) {
+                const PadSnapshotInfo* info = pads_snapshot.info[n];
+                const JoystickPosition* stickL = &pads_snapshot.sticks[JOYSTICK_LEFT][n];
+                const JoystickPosition* stickR = &pads_snapshot.sticks[JOYSTICK_RIGHT][n];
+                HidControllerID id = pads_snapshot.id[n];
 
-                    printf("%d: type = 0x%x, devicetype = 0x%x, buttons = 0x%lx, stickL.dx = 0x%x, stickL.dy = 0x%x, stickR.dx = 0x%x, stickR.dy = 0x%x, interface = %d\n", i, hidGetControllerType(i), hidGetControllerDeviceType(i), hidKeysHeld(i), tmpjoy[0].dx, tmpjoy[0].dy, tmpjoy[1].dx, tmpjoy[1].dy, interfacetype);
+                printf("%d: type = 0x%x, devicetype = 0x%x, buttons = 0x%lx, stickL.dx = 0x%x, stickL.dy = 0x%x, stickR.dx = 0x%x, stickR.dy = 0x%x, interface = %d\n", id, info->type, info->device_type, pads_snapshot.buttons[n], stickL->dx, stickL->dy, stickR->dx, stickR->dy, info->interface_type);
 
-                    for (u32 poweri=0; poweri<3; poweri++)
-                        printf("%d powerinfo[%d]: powerConnected = %d, isCharging = %d, batteryCharge = %d\n", i, poweri, powerinfo[poweri].powerConnected, powerinfo[poweri].isCharging, powerinfo[poweri].batteryCharge);
-                }
+                for (u32 poweri=0; poweri<3; poweri++)
+                    printf("%d powerinfo[%d]: powerConnected = %d, isCharging = %d, batteryCharge = %d\n", id, poweri, info->power[poweri].powerConnected, info->power[poweri].isCharging, info->power[poweri].batteryCharge);
             }
             printf("\n");
         }
@@ -0,0 +1,290 @@
+// Include the most common headers from the C standard library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include the main libnx system header, for Switch development
+#include <switch.h>
+
+#include "input_thread.h"
+#include "swraster.h"
+#include "nxlink_log.h"
+
+// This example measures the latency from a button press to the frame showing it, see also hid/read-controls,
+// graphics/simplegfx and hid/notification-led.
+//
+// Press A: the screen flashes white for one frame, and the notification LED of the controller pulses. For each press,
+// the system tick of each stage is recorded:
+//   edge:    the input thread saw the button go down (it scans every millisecond)
+//   poll:    the main loop took the event, at the start of a frame
+//   present: framebufferEnd returned, the flashed frame is queued for display
+//   vsync:   first vsync after that, when the frame starts being scanned out (at the earliest)
+// The remaining latency, from scanout to light, depends on the panel or TV. It can be measured externally by filming
+// the screen and the LED (lit right after the present) with a high speed camera.
+//
+// Each measurement is drawn as a bar, one color per stage and one line per press (newest at the top), with a mark every
+// 16.7ms. When started with nxlink -s, the measurements are also printed on the host.
+
+#define FB_WIDTH  1280
+#define FB_HEIGHT 720
+
+#define HISTORY 32
+#define PIXELS_PER_MS 20
+
+typedef enum {
+    Stage_Edge,
+    Stage_Poll,
+    Stage_Present,
+    Stage_Vsync,
+    Stage_Count,
+} Stage;
+
+typedef struct {
+    u64 ticks[Stage_Count];
+    u64 led_tick;
+} Measurement;
+
+// Ticks of the latest vsyncs, recorded by the vsync thread
+#define VSYNC_RING 8
+
+typedef struct {
+    ViDisplay display;
+    Event event;
+    Thread thread;
+    bool running;
+    u64 ticks[VSYNC_RING];
+    u32 count;
+} VsyncTracker;
+
+void userAppInit()
+{
+    nxlinkLogInit();
+}
+
+void userAppExit()
+{
+    nxlinkLogExit();
+}
+
+static void vsyncThreadFunc(void* arg)
+{
+    VsyncTracker* vt = (VsyncTracker*)arg;
+    while (__atomic_load_n(&vt->running, __ATOMIC_ACQUIRE))
+    {
+        // Time out now and then, to notice when we're asked to stop
+        if (R_FAILED(eventWait(&vt->event, 100000000ULL)))
+            continue;
+
+        u32 count = vt->count;
+        vt->ticks[count % VSYNC_RING] = armGetSystemTick();
+        __atomic_store_n(&vt->count, count + 1, __ATOMIC_RELEASE);
+    }
+}
+
+static bool vsyncTrackerStart(VsyncTracker* vt)
+{
+    memset(vt, 0, sizeof(*vt));
+    if (R_FAILED(viOpenDefaultDisplay(&vt->display)))
+        return false;
+    if (R_FAILED(viGetDisplayVsyncEvent(&vt->display, &vt->event)))
+    {
+        viCloseDisplay(&vt->display);
+        return false;
+    }
+
+    // Above the main thread, so that vsyncs are timestamped as soon as they're signaled
+    vt->running = true;
+    if (R_FAILED(threadCreate(&vt->thread, vsyncThreadFunc, vt, NULL, 0x4000, 0x2B, -2)))
+    {
+        viCloseDisplay(&vt->display);
+        return false;
+    }
+    if (R_FAILED(threadStart(&vt->thread)))
+    {
+        threadClose(&vt->thread);
+        viCloseDisplay(&vt->display);
+        return false;
+    }
+    return true;
+}
+
+static void vsyncTrackerStop(VsyncTracker* vt)
+{
+    __atomic_store_n(&vt->running, false, __ATOMIC_RELEASE);
+    threadWaitForExit(&vt->thread);
+    threadClose(&vt->thread);
+    viCloseDisplay(&vt->display);
+}
+
+// Returns the tick of the first recorded vsync after the given tick, or 0 if there's none yet
+static u64 vsyncTrackerFindAfter(VsyncTracker* vt, u64 tick)
+{
+    u32 count = __atomic_load_n(&vt->count, __ATOMIC_ACQUIRE);
+    u32 first = count > VSYNC_RING ? count - VSYNC_RING : 0;
+    for (u32 i = first; i < count; i++)
+    {
+        if (vt->ticks[i % VSYNC_RING] > tick)
+            return vt->ticks[i % VSYNC_RING];
+    }
+    return 0;
+}
+
+// Lights the notification LED for a moment, on all the pads of the controller
+static u64 pulseLed(const u64* padIds, s32 numPads)
+{
+    HidsysNotificationLedPattern pattern;
+    memset(&pattern, 0, sizeof(pattern));
+    pattern.baseMiniCycleDuration = 0x1;             // 12.5ms.
+    pattern.totalMiniCycles = 0x0;                   // 1 mini cycle.
+    pattern.totalFullCycles = 0x0;                   // Repeat forever, until the timeout.
+    pattern.startIntensity = 0xF;                    // 100%.
+    pattern.miniCycles[0].ledIntensity = 0xF;        // 100%.
+    pattern.miniCycles[0].transitionSteps = 0x0;
+    pattern.miniCycles[0].finalStepDuration = 0xF;   // 187.5ms.
+
+    for (s32 i = 0; i < numPads; i++)
+        hidsysSetNotificationLedPatternWithTimeout(&pattern, padIds[i], 200000000ULL);
+    return armGetSystemTick();
+}
+
+static float ticksToMs(u64 ticks)
+{
+    return armTicksToNs(ticks) / 1000000.0f;
+}
+
+static void drawMeasurement(const SwrSurface* surf, const Measurement* m, s32 y, s32 h)
+{
+    static const u32 colors[Stage_Count - 1] = {
+        RGBA8_MAXALPHA(0xE0, 0x40, 0x40), // edge to poll
+        RGBA8_MAXALPHA(0x40, 0xC0, 0x40), // poll to present
+        RGBA8_MAXALPHA(0x40, 0x80, 0xE0), // present to vsync
+    };
+
+    s32 x = 0;
+    for (u32 s = 0; s < Stage_Count - 1; s++)
+    {
+        s32 w = (s32)(ticksToMs(m->ticks[s + 1] - m->ticks[s]) * PIXELS_PER_MS);
+        swrFillRect(surf, x, y, w, h, colors[s]);
+        x += w;
+    }
+}
+
+// Main program entrypoint
+int main(int argc, char* argv[])
+{
+    NWindow* win = nwindowGetDefault();
+
+    Framebuffer fb;
+    framebufferCreate(&fb, win, FB_WIDTH, FB_HEIGHT, PIXEL_FORMAT_RGBA_8888, 2);
+    framebufferMakeLinear(&fb);
+
+    InputThread input;
+    bool inputOk = R_SUCCEEDED(inputThreadStart(&input, CONTROLLER_P1_AUTO, INPUT_THREAD_DEFAULT_PERIOD));
+
+    VsyncTracker vsync;
+    bool vsyncOk = vsyncTrackerStart(&vsync);
+
+    u64 padIds[2] = {0};
+    s32 numPads = 0;
+    bool hidsysOk = R_SUCCEEDED(hidsysInitialize());
+    if (hidsysOk)
+        hidsysGetUniquePadsFromNpad(hidGetHandheldMode() ? CONTROLLER_HANDHELD : CONTROLLER_PLAYER_1, padIds, 2, &numPads);
+
+    printf("input-latency: input thread %s, vsync event %s, %d pads with a notification LED\n",
+        inputOk ? "ok" : "failed", vsyncOk ? "ok" : "failed", numPads);
+    printf("Press A to measure, PLUS to exit.\n");
+
+    static Measurement history[HISTORY];
+    u32 numMeasurements = 0;
+    Measurement pending;
+    bool measuring = false;     // waiting for the vsync of the flashed frame
+    u32 ignored = 0;            // presses during a measurement
+    u64 totalMin = UINT64_MAX, totalMax = 0, totalSum = 0;
+
+    while (inputOk && appletMainLoop())
+    {
+        // Buttons pressed since the previous frame, with the tick they were seen at
+        InputEvent events[INPUT_RING_SIZE];
+        u32 numEvents = inputThreadPoll(&input, events, INPUT_RING_SIZE);
+        u64 pollTick = armGetSystemTick();
+
+        u64 kDown = 0, edgeTick = 0;
+        for (u32 i = 0; i < numEvents; i++)
+        {
+            if ((events[i].down & KEY_A) && !edgeTick)
+                edgeTick = events[i].tick;
+            kDown |= events[i].down;
+        }
+
+        if (kDown & KEY_PLUS)
+            break; // break in order to return to hbmenu
+
+        bool flash = false;
+        if (edgeTick)
+        {
+            if (measuring)
+                ignored++;
+            else
+            {
+                memset(&pending, 0, sizeof(pending));
+                pending.ticks[Stage_Edge] = edgeTick;
+                pending.ticks[Stage_Poll] = pollTick;
+                flash = true;
+            }
+        }
+
+        SwrSurface surf;
+        swrBegin(&surf, &fb);
+        if (flash)
+            swrFill(&surf, RGBA8_MAXALPHA(0xFF, 0xFF, 0xFF));
+        else
+        {
+            swrFill(&surf, RGBA8_MAXALPHA(0x10, 0x10, 0x10));
+
+            // One mark per 60Hz frame
+            for (s32 x = 0; x < FB_WIDTH; x += PIXELS_PER_MS * 1000 / 60)
+                swrFillRect(&surf, x, 0, 1, FB_HEIGHT, RGBA8_MAXALPHA(0x50, 0x50, 0x50));
+
+            for (u32 i = 0; i < numMeasurements && i < HISTORY; i++)
+                drawMeasurement(&surf, &history[(numMeasurements - 1 - i) % HISTORY], 8 + i * 20, 16);
+        }
+        swrEnd(&surf);
+
+        if (flash)
+        {
+            pending.ticks[Stage_Present] = armGetSystemTick();
+            pending.led_tick = numPads ? pulseLed(padIds, numPads) : 0;
+            measuring = true;
+        }
+
+        // The vsync thread may not have seen the vsync of the flashed frame yet, in that case we'll check again next frame
+        if (measuring)
+        {
+            u64 vsyncTick = vsyncOk ? vsyncTrackerFindAfter(&vsync, pending.ticks[Stage_Present]) : pending.ticks[Stage_Present];
+            if (vsyncTick)
+            {
+                pending.ticks[Stage_Vsync] = vsyncTick;
+                history[numMeasurements++ % HISTORY] = pending;
+                measuring = false;
+
+                const u64* t = pending.ticks;
+                u64 total = t[Stage_Vsync] - t[Stage_Edge];
+                if (total < totalMin) totalMin = total;
+                if (total > totalMax) totalMax = total;
+                totalSum += total;
+                printf("edge->poll %6.2fms, poll->present %6.2fms, present->vsync %6.2fms, total %6.2fms, led at +%.2fms, %u ignored\n",
+                    ticksToMs(t[Stage_Poll] - t[Stage_Edge]), ticksToMs(t[Stage_Present] - t[Stage_Poll]),
+                    ticksToMs(t[Stage_Vsync] - t[Stage_Present]), ticksToMs(total),
+                    pending.led_tick ? ticksToMs(pending.led_tick - t[Stage_Edge]) : 0.0f, ignored);
+                printf("total over %u presses: min %.2fms, avg %.2fms, max %.2fms\n",
+                    numMeasurements, ticksToMs(totalMin), ticksToMs(totalSum / numMeasurements), ticksToMs(totalMax));
+            }
+        }
+    }
+
+    if (hidsysOk) hidsysExit();
+    if (vsyncOk) vsyncTrackerStop(&vsync);
+    if (inputOk) inputThreadStop(&input);
+    framebufferClose(&fb);
+    return 0;
+}
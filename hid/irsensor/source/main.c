@@ -5,11 +5,60 @@
 
 #include <switch.h>
 
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
 // Joy-Con IR-sensor example, displays the image from the IR camera. See also libnx irs.h.
+//
+// The IR image is polled from a worker thread, so that the render loop never waits on irs.
+// The resolution can be changed at runtime: smaller formats (and trimmed images) are updated more often.
+// - Left/Right: select the IrsImageTransferProcessorFormat.
+// - A: toggle between downscaling the whole image and trimming (cropping) its center,
+//      using irsRunImageTransferExProcessor.
 
 // Define the desired framebuffer resolution (here we set it to 720p).
 #define FB_WIDTH  1280
 #define FB_HEIGHT 720
+#define FB_COUNT  2
+
+// Size for the max IrsImageTransferProcessorFormat.
+#define IR_MAX_WIDTH  320
+#define IR_MAX_HEIGHT 240
+
+// irs has no event for new images, so the worker polls at this interval.
+#define IR_POLL_INTERVAL_NS 4000000ULL
+
+typedef struct {
+    u8* data;
+    u32 width, height;
+    u64 sampling_number;
+} IrImage;
+
+typedef struct {
+    IrsIrCameraHandle handle;
+    Thread thread;
+    Mutex mutex;
+    bool exit;
+
+    // Requested mode, set by the main thread and applied by the worker
+    u32 format;
+    bool trim;
+
+    // Triple buffering: the worker fills images[work], then swaps it with images[ready].
+    // The main thread swaps images[ready] with images[display] when there's a new one.
+    IrImage images[3];
+    u32 work, ready, display;
+    bool ready_new;
+} IrWorker;
+
+static const u32 ir_format_sizes[5][2] = {
+    { 320, 240 }, // IrsImageTransferProcessorFormat_320x240
+    { 160, 120 }, // IrsImageTransferProcessorFormat_160x120
+    {  80,  60 }, // IrsImageTransferProcessorFormat_80x60
+    {  40,  30 }, // IrsImageTransferProcessorFormat_40x30
+    {  20,  15 }, // IrsImageTransferProcessorFormat_20x15
+};
 
 void userAppInit(void)
 {
@@ -45,19 +94,202 @@ static int error_screen(const char* fmt, ...)
     return EXIT_FAILURE;
 }
 
-int main(int argc, char **argv)
+static Result ir_run_processor(IrsIrCameraHandle handle, u32 format, bool trim)
 {
-    Result rc=0;
+    if (!trim) {
+        // The whole image, downscaled by the sensor.
+        IrsImageTransferProcessorConfig config;
+        irsGetDefaultImageTransferProcessorConfig(&config);
+        config.sensor_res = format;
+        return irsRunImageTransferProcessor(handle, &config, 0x100000);
+    }
+
+    // The center of the full resolution image, at the size of the selected format.
+    IrsImageTransferProcessorExConfig config;
+    irsGetDefaultImageTransferProcessorExConfig(&config);
+    config.orig_format = IrsImageTransferProcessorFormat_320x240;
+    config.trimming_format = format;
+    config.trimming_start_x = (IR_MAX_WIDTH - ir_format_sizes[format][0]) / 2;
+    config.trimming_start_y = (IR_MAX_HEIGHT - ir_format_sizes[format][1]) / 2;
+    return irsRunImageTransferExProcessor(handle, &config, 0x100000);
+}
+
+static void ir_worker_func(void* arg)
+{
+    IrWorker* w = (IrWorker*)arg;
+    u32 cur_format = 0;
+    bool cur_trim = false;
+    u64 sampling_number = 0;
+
+    while (!__atomic_load_n(&w->exit, __ATOMIC_ACQUIRE)) {
+        mutexLock(&w->mutex);
+        u32 format = w->format;
+        bool trim = w->trim;
+        mutexUnlock(&w->mutex);
+
+        // Restart the processor when the mode changed.
+        if (format != cur_format || trim != cur_trim) {
+            irsStopImageProcessor(w->handle);
+            Result rc = ir_run_processor(w->handle, format, trim);
+            if (R_FAILED(rc)) printf("ir_run_processor() returned 0x%x\n", rc);
+            cur_format = format;
+            cur_trim = trim;
+            sampling_number = 0;
+        }
 
-    const size_t ir_buffer_size = 0x12c00; // Size for the max IrsImageTransferProcessorFormat.
-    u8 *ir_buffer = NULL;
-    ir_buffer = (u8*)malloc(ir_buffer_size);
-    if (!ir_buffer) {
-        rc = MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
-        return error_screen("Failed to allocate memory for ir_buffer.\n");
+        // It takes a while for the first image to become available after (re)starting the processor.
+        // This will return an error when no image is available yet.
+        IrImage* img = &w->images[w->work];
+        u32 width = ir_format_sizes[cur_format][0];
+        u32 height = ir_format_sizes[cur_format][1];
+        IrsImageTransferProcessorState state;
+        Result rc = irsGetImageTransferProcessorState(w->handle, img->data, width * height, &state);
+
+        if (R_SUCCEEDED(rc) && state.sampling_number != sampling_number) {
+            sampling_number = state.sampling_number;
+            img->width = width;
+            img->height = height;
+            img->sampling_number = sampling_number;
+
+            // Publish the image.
+            mutexLock(&w->mutex);
+            u32 tmp = w->ready;
+            w->ready = w->work;
+            w->work = tmp;
+            w->ready_new = true;
+            mutexUnlock(&w->mutex);
+        }
+
+        svcSleepThread(IR_POLL_INTERVAL_NS);
+    }
+}
+
+static Result ir_worker_start(IrWorker* w, IrsIrCameraHandle handle)
+{
+    memset(w, 0, sizeof(*w));
+    w->handle = handle;
+    mutexInit(&w->mutex);
+    w->work = 0;
+    w->ready = 1;
+    w->display = 2;
+
+    Result rc = 0;
+    for (u32 i = 0; i < 3; i++) {
+        w->images[i].data = (u8*)calloc(1, IR_MAX_WIDTH * IR_MAX_HEIGHT);
+        if (!w->images[i].data)
+            rc = MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
     }
 
-    memset(ir_buffer, 0, ir_buffer_size);
+    // Start with the default config. The default uses the max IrsImageTransferProcessorFormat, which has the slowest update-rate.
+    if (R_SUCCEEDED(rc))
+        rc = ir_run_processor(handle, IrsImageTransferProcessorFormat_320x240, false);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadCreate(&w->thread, ir_worker_func, w, NULL, 0x4000, 0x2C, -2);
+        if (R_SUCCEEDED(rc)) {
+            rc = threadStart(&w->thread);
+            if (R_FAILED(rc)) threadClose(&w->thread);
+        }
+        if (R_FAILED(rc)) irsStopImageProcessor(handle);
+    }
+
+    if (R_FAILED(rc)) {
+        for (u32 i = 0; i < 3; i++)
+            free(w->images[i].data);
+    }
+    return rc;
+}
+
+static void ir_worker_stop(IrWorker* w)
+{
+    __atomic_store_n(&w->exit, true, __ATOMIC_RELEASE);
+    threadWaitForExit(&w->thread);
+    threadClose(&w->thread);
+    irsStopImageProcessor(w->handle);
+
+    for (u32 i = 0; i < 3; i++)
+        free(w->images[i].data);
+}
+
+static void ir_worker_set_mode(IrWorker* w, u32 format, bool trim)
+{
+    mutexLock(&w->mutex);
+    w->format = format;
+    w->trim = trim;
+    mutexUnlock(&w->mutex);
+}
+
+// Returns the latest image if there's a new one since the last call, otherwise NULL.
+static const IrImage* ir_worker_get_image(IrWorker* w)
+{
+    const IrImage* ret = NULL;
+    mutexLock(&w->mutex);
+    if (w->ready_new) {
+        u32 tmp = w->display;
+        w->display = w->ready;
+        w->ready = tmp;
+        w->ready_new = false;
+        ret = &w->images[w->display];
+    }
+    mutexUnlock(&w->mutex);
+    return ret;
+}
+
+// Expands a row of grayscale pixels to RGBA, into the green channel. Each pixel is repeated scale times horizontally.
+static void gray_to_rgba_row(u32* dst, const u8* src, u32 width, u32 scale)
+{
+    u32 x = 0;
+#ifdef __ARM_NEON
+    if (scale == 1) {
+        uint8x16x4_t px = { { vdupq_n_u8(0), vdupq_n_u8(0), vdupq_n_u8(0), vdupq_n_u8(0xFF) } };
+        for (; x + 16 <= width; x += 16) {
+            px.val[1] = vld1q_u8(&src[x]);
+            vst4q_u8((u8*)&dst[x], px);
+        }
+    }
+    else if (scale % 4 == 0) {
+        for (; x < width; x++) {
+            uint32x4_t px = vdupq_n_u32(RGBA8_MAXALPHA(0, src[x], 0));
+            u32* out = &dst[x * scale];
+            for (u32 i = 0; i < scale; i += 4)
+                vst1q_u32(&out[i], px);
+        }
+    }
+#endif
+    for (; x < width; x++) {
+        u32 px = RGBA8_MAXALPHA(0, src[x], 0);
+        for (u32 i = 0; i < scale; i++)
+            dst[x * scale + i] = px;
+    }
+}
+
+// Draws the image centered and scaled up by the largest integer factor that fits.
+static void draw_image(u32* framebuf, u32 stride, const IrImage* img)
+{
+    u32 scale_x = FB_WIDTH / img->width;
+    u32 scale_y = FB_HEIGHT / img->height;
+    u32 scale = scale_x < scale_y ? scale_x : scale_y;
+    u32 out_width = img->width * scale;
+    u32 out_height = img->height * scale;
+    u32 start_x = (FB_WIDTH - out_width) / 2;
+    u32 start_y = (FB_HEIGHT - out_height) / 2;
+    u32 pitch = stride / sizeof(u32);
+
+    memset(framebuf, 0, stride * FB_HEIGHT);
+
+    //The IR image/camera is sideways with the joycon held flat. We won't rotate it here - you can do so yourself if you want.
+    for (u32 y = 0; y < img->height; y++) {
+        u32* row = &framebuf[(start_y + y * scale) * pitch + start_x];
+        gray_to_rgba_row(row, &img->data[y * img->width], img->width, scale);
+
+        // Repeat the row vertically.
+        for (u32 i = 1; i < scale; i++)
+            memcpy(row + i * pitch, row, out_width * sizeof(u32));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Result rc=0;
 
     // Get the handle for the specified controller.
     IrsIrCameraHandle irhandle;
@@ -76,18 +308,19 @@ int main(int argc, char **argv)
         hidLaShowControllerFirmwareUpdate(&updatearg);
     }
 
-    // Run the ImageTransferProcessor with the default config. The default uses the max IrsImageTransferProcessorFormat which has the slowest update-rate with irsGetImageTransferProcessorState. Hence, you may want to use a different IrsImageTransferProcessorFormat, or trim the image with irsRunImageTransferExProcessor.
-    IrsImageTransferProcessorConfig config;
-    irsGetDefaultImageTransferProcessorConfig(&config);
-    rc = irsRunImageTransferProcessor(irhandle, &config, 0x100000);
+    static IrWorker worker;
+    rc = ir_worker_start(&worker, irhandle);
     if (R_FAILED(rc))
-        return error_screen("irsRunImageTransferProcessor() returned 0x%x\n", rc);
+        return error_screen("ir_worker_start() returned 0x%x\n", rc);
 
     Framebuffer fb;
-    framebufferCreate(&fb, nwindowGetDefault(), FB_WIDTH, FB_HEIGHT, PIXEL_FORMAT_RGBA_8888, 2);
+    framebufferCreate(&fb, nwindowGetDefault(), FB_WIDTH, FB_HEIGHT, PIXEL_FORMAT_RGBA_8888, FB_COUNT);
     framebufferMakeLinear(&fb);
 
-    u64 sampling_number=0;
+    u32 format = IrsImageTransferProcessorFormat_320x240;
+    bool trim = false;
+    const IrImage* image = NULL;
+    u32 dirty = 0;
 
     while (appletMainLoop())
     {
@@ -99,38 +332,31 @@ int main(int argc, char **argv)
 
         if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
 
-        // With the default config the image is updated every few seconds (see above). Likewise, it takes a few seconds for the initial image to become available.
-        // This will return an error when no image is available yet.
-        IrsImageTransferProcessorState state;
-        rc = irsGetImageTransferProcessorState(irhandle, ir_buffer, ir_buffer_size, &state);
+        if (kDown & (KEY_LEFT | KEY_RIGHT | KEY_A)) {
+            if ((kDown & KEY_LEFT) && format > IrsImageTransferProcessorFormat_320x240) format--;
+            if ((kDown & KEY_RIGHT) && format < IrsImageTransferProcessorFormat_20x15) format++;
+            if (kDown & KEY_A) trim = !trim;
+            ir_worker_set_mode(&worker, format, trim);
+        }
+
+        const IrImage* new_image = ir_worker_get_image(&worker);
+        if (new_image) {
+            image = new_image;
+            dirty = FB_COUNT; // every framebuffer needs to be updated with the new image
+        }
 
         u32 stride;
         u32* framebuf = (u32*)framebufferBegin(&fb, &stride);
 
-        if (R_SUCCEEDED(rc) && state.sampling_number != sampling_number) { // Only update framebuf when irsGetImageTransferProcessorState() is successful, where sampling_number changed.
-            sampling_number = state.sampling_number;
-            memset(framebuf, 0, stride*FB_HEIGHT);
-
-            // IR image width/height with the default config.
-            // The image is grayscale (1 byte per pixel / 8bits, with 1 color-component).
-            const u32 ir_width = 320;
-            const u32 ir_height = 240;
-
-            u32 x, y;
-            for (y=0; y<ir_height; y++) { // Access the buffer linearly.
-                for (x=0; x<ir_width; x++) {
-                    u32 pos = y * stride/sizeof(u32) + x;
-                    u32 pos2 = y * ir_width + x;//The IR image/camera is sideways with the joycon held flat. We won't rotate it here - you can do so yourself if you want.
-                    framebuf[pos] = RGBA8_MAXALPHA(/*ir_buffer[pos2]*/0, ir_buffer[pos2], /*ir_buffer[pos2]*/0);
-                }
-            }
+        if (dirty) {
+            draw_image(framebuf, stride, image);
+            dirty--;
         }
 
         framebufferEnd(&fb);
     }
 
     framebufferClose(&fb);
-    irsStopImageProcessor(irhandle);
-    free(ir_buffer);
+    ir_worker_stop(&worker);
     return 0;
 }
@@ -1,8 +1,11 @@
 #include <string.h>
 #include <stdio.h>
+#include <inttypes.h>
 
 #include <switch.h>
 
+#include "input_thread.h"
+
 //See also libnx hid.h.
 
 int main(int argc, char **argv)
@@ -23,6 +26,14 @@ int main(int argc, char **argv)
 
     u32 kDownOld = 0, kHeldOld = 0, kUpOld = 0; //In these variables there will be information about keys detected in the previous frame
 
+    //Inputs are scanned by a thread every millisecond, which timestamps every change: presses shorter than a frame aren't lost.
+    //Scanning once per frame with hidScanInput is done only if the thread couldn't be started.
+    InputThread input;
+    Result rc = inputThreadStart(&input, CONTROLLER_P1_AUTO, INPUT_THREAD_DEFAULT_PERIOD);
+    bool threaded = R_SUCCEEDED(rc);
+    u64 lastPollTick = armGetSystemTick(), pollTick = lastPollTick;
+    u64 kHeld = 0;
+
     printf("\x1b[1;1HPress PLUS to exit.");
     printf("\x1b[2;1HLeft joystick position:");
     printf("\x1b[4;1HRight joystick position:");
@@ -30,15 +41,35 @@ int main(int argc, char **argv)
     // Main loop
     while(appletMainLoop())
     {
-        //Scan all the inputs. This should be done once for each frame
-        hidScanInput();
+        //Events since the previous frame, oldest first
+        static InputEvent events[INPUT_RING_SIZE];
+        u32 numEvents = 0;
+        u64 kDown = 0, kUp = 0;
 
-        //hidKeysDown returns information about which buttons have been just pressed (and they weren't in the previous frame)
-        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
-        //hidKeysHeld returns information about which buttons have are held down in this frame
-        u64 kHeld = hidKeysHeld(CONTROLLER_P1_AUTO);
-        //hidKeysUp returns information about which buttons have been just released
-        u64 kUp = hidKeysUp(CONTROLLER_P1_AUTO);
+        if (threaded)
+        {
+            pollTick = armGetSystemTick();
+            numEvents = inputThreadPoll(&input, events, INPUT_RING_SIZE);
+            //Everything pressed or released since the previous frame: a quick tap shows up as both down and up
+            for (u32 i = 0; i < numEvents; i++)
+            {
+                kDown |= events[i].down;
+                kUp |= events[i].up;
+                kHeld = events[i].held;
+            }
+        }
+        else
+        {
+            //Scan all the inputs. This should be done once for each frame
+            hidScanInput();
+
+            //hidKeysDown returns information about which buttons have been just pressed (and they weren't in the previous frame)
+            kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+            //hidKeysHeld returns information about which buttons have are held down in this frame
+            kHeld = hidKeysHeld(CONTROLLER_P1_AUTO);
+            //hidKeysUp returns information about which buttons have been just released
+            kUp = hidKeysUp(CONTROLLER_P1_AUTO);
+        }
 
         if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
 
@@ -63,7 +94,21 @@ int main(int argc, char **argv)
                 if (kHeld & BIT(i)) printf("%s held\n", keysNames[i]);
                 if (kUp & BIT(i)) printf("%s up\n", keysNames[i]);
             }
+
+            //When each change happened, relative to the previous frame (a scan can land just before it, but be seen only now)
+            for (u32 e = 0; e < numEvents; e++)
+            {
+                u64 us = events[e].tick > lastPollTick ? armTicksToNs(events[e].tick - lastPollTick) / 1000 : 0;
+                for (i = 0; i < 32; i++)
+                {
+                    if (events[e].down & BIT(i)) printf("%s down at +%" PRIu64 ".%" PRIu64 "ms\n", keysNames[i], us / 1000, (us / 100) % 10);
+                    if (events[e].up & BIT(i)) printf("%s up at +%" PRIu64 ".%" PRIu64 "ms\n", keysNames[i], us / 1000, (us / 100) % 10);
+                }
+            }
+            if (threaded && input.ring.dropped)
+                printf("%" PRIu32 " events dropped\n", input.ring.dropped);
         }
+        lastPollTick = pollTick;
 
         //Set keys old values for the next frame
         kDownOld = kDown;
@@ -83,6 +128,9 @@ int main(int argc, char **argv)
         consoleUpdate(NULL);
     }
 
+    if (threaded)
+        inputThreadStop(&input);
+
     consoleExit(NULL);
     return 0;
 }
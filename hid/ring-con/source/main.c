@@ -6,8 +6,14 @@
 // Include the main libnx system header, for Switch development
 #include <switch.h>
 
+#include "ringcon_reader.h"
+
 // This example shows how to use the Ring-Con which attaches to a Joy-Con (from Ring Fit Adventure).
 // See also libnx ringcon.h.
+// The sensor is read on a thread at its own rate (see hid/common/ringcon_reader.h), the main loop only displays the
+// latest filtered sample and the recent history.
+
+#define HISTORY_LINES 8
 
 // Main program entrypoint
 int main(int argc, char **argv)
@@ -32,6 +38,20 @@ int main(int argc, char **argv)
 
     // For more ringcon functionality, see ringcon.h.
 
+    RingConReader reader;
+    if (ready) {
+        rc = ringConReaderStart(&reader, &ring, RINGCON_READER_DEFAULT_PERIOD, RINGCON_READER_DEFAULT_SMOOTHING);
+        printf(CONSOLE_ESC(3;1H)"ringConReaderStart(): 0x%x", rc);
+        ready = R_SUCCEEDED(rc);
+    }
+
+    // Normally(?) the UserCal is not calibrated. So instead, you have to have the user hold the Ring-Con in various positions, then use that as your app-specific calibration (with the polling-data).
+    // Here: A at rest, X while pulling it apart, Y while squeezing it. The calibration is applied once all three are set.
+    RingConCalibration cal={0};
+    u32 cal_set=0;
+    float smoothing = RINGCON_READER_DEFAULT_SMOOTHING;
+    if (ready) printf(CONSOLE_ESC(5;1H)"Calibrate with A at rest, X pulled, Y squeezed. Up/Down change the smoothing.");
+
     // Main loop
     while(appletMainLoop())
     {
@@ -45,23 +65,42 @@ int main(int argc, char **argv)
         if (kDown & KEY_PLUS)
             break; // break in order to return to hbmenu
 
-        // Get the sensor state data.
+        // Get the sensor state data, as read by the reader thread.
         if (ready) {
-            s32 total_out=0;
-            RingConPollingData polldata[0x1]; // For this example we'll just read the latest entry, however if you want the rest use 0x9.
-            rc = ringconGetPollingData(&ring, polldata, 0x1, &total_out); // See libnx ringcon.h regarding ringconGetPollingData().
-            printf(CONSOLE_ESC(4;1H)"ringconGetPollingData(): 0x%x\n", rc);
-            printf("total_out=%d\n", total_out);
-            for (s32 polli=0; polli<total_out; polli++) printf("[%d]: data =     %d\n", polli, polldata[polli].data);
-
-            // Normally(?) the UserCal is not calibrated. So instead, you have to have the user hold the Ring-Con in various positions, then use that as your app-specific calibration (with the above polling-data).
-            // Then afterwards in your app you'd compare your app-specific calibration with the polling-data.
+            RingConSample sample;
+            if (ringConReaderGetLatest(&reader, &sample)) {
+                if (kDown & KEY_A) { cal.neutral = sample.raw; cal_set |= 1; }
+                if (kDown & KEY_X) { cal.pulled = sample.raw; cal_set |= 2; }
+                if (kDown & KEY_Y) { cal.pushed = sample.raw; cal_set |= 4; }
+                if ((kDown & (KEY_A | KEY_X | KEY_Y)) && cal_set == 7) ringConReaderSetCalibration(&reader, &cal);
+
+                printf(CONSOLE_ESC(7;1H)"latest: raw = %6d, value = %8.3f (%s)      \n", sample.raw, sample.value, cal_set == 7 ? "calibrated" : "raw");
+            }
+
+            if (kDown & (KEY_DUP | KEY_DDOWN)) {
+                smoothing += (kDown & KEY_DUP) ? 0.05f : -0.05f;
+                if (smoothing < 0.05f) smoothing = 0.05f;
+                if (smoothing > 1.0f) smoothing = 1.0f;
+                ringConReaderSetSmoothing(&reader, smoothing);
+            }
+
+            printf(CONSOLE_ESC(8;1H)"smoothing = %.2f, reads = %u, samples = %u, lost = %u, last result = 0x%x      \n", smoothing, reader.reads, reader.count, reader.lost, reader.last_rc);
+
+            // Newest first.
+            RingConSample history[HISTORY_LINES];
+            u32 count = ringConReaderGetHistory(&reader, history, HISTORY_LINES);
+            printf(CONSOLE_ESC(10;1H)"History:\n");
+            for (u32 i=0; i<count; i++) {
+                const RingConSample *s = &history[count-1-i];
+                printf("[%lu]: raw = %6d, value = %8.3f\n", s->sampling_number, s->raw, s->value);
+            }
         }
 
         // Update the console, sending a new frame to the display
         consoleUpdate(NULL);
     }
 
+    if (ready) ringConReaderStop(&reader);
     ringconClose(&ring);
     // Deinitialize and clean up resources used by the console (important!)
     consoleExit(NULL);
@@ -7,13 +7,46 @@
 // See also libnx hid.h.
 // SevenSixAxisSensor combines the SixAxisSensor for the Console and Joy-Cons together.
 
+// Number of states requested per read: everything buffered since the previous frame is taken at once
+#define MAX_STATES 32
+
+// Keeps only the states not seen yet (by sampling number), oldest first. Returns their count.
+static size_t read_new_states(HidSevenSixAxisSensorState* states, u64* last_sampling_number, u64* lost)
+{
+    size_t total_out=0;
+    if (R_FAILED(hidGetSevenSixAxisSensorStates(states, MAX_STATES, &total_out)))
+        return 0;
+
+    size_t count=0;
+    for (size_t i=0; i<total_out; i++) {
+        if (states[i].sampling_number > *last_sampling_number)
+            states[count++] = states[i];
+    }
+
+    // Insertion sort, there are only a few states
+    for (size_t i=1; i<count; i++) {
+        HidSevenSixAxisSensorState tmp = states[i];
+        size_t j=i;
+        for (; j>0 && states[j-1].sampling_number > tmp.sampling_number; j--) states[j] = states[j-1];
+        states[j] = tmp;
+    }
+
+    // Gaps in the sampling numbers are states which were overwritten before being read
+    for (size_t i=0; i<count; i++) {
+        if (*last_sampling_number && states[i].sampling_number > *last_sampling_number + 1)
+            *lost += states[i].sampling_number - *last_sampling_number - 1;
+        *last_sampling_number = states[i].sampling_number;
+    }
+    return count;
+}
+
 int main(int argc, char **argv)
 {
     Result rc=0;
 
     consoleInit(NULL);
 
-    printf("Press A to get state.\n");
+    printf("Press A to print the newest state.\n");
     printf("Press + to exit.\n");
 
     rc = hidInitializeSevenSixAxisSensor();
@@ -28,6 +61,10 @@ int main(int argc, char **argv)
     rc = hidStartSevenSixAxisSensor();
     printf("hidStartSevenSixAxisSensor(): 0x%x\n", rc);
 
+    static HidSevenSixAxisSensorState states[MAX_STATES];
+    HidSevenSixAxisSensorState newest={0};
+    u64 last_sampling_number=0, lost=0, total=0;
+
     // Main loop
     while(appletMainLoop())
     {
@@ -39,17 +76,15 @@ int main(int argc, char **argv)
 
         if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
 
+        size_t count = read_new_states(states, &last_sampling_number, &lost);
+        if (count) newest = states[count-1];
+        total += count;
+        printf("\x1b[8;1Hnew states: %2lu, total: %lu, lost: %lu, sampling_number: %lu   \n", count, total, lost, newest.sampling_number);
+
         if (kDown & KEY_A) {
-                HidSevenSixAxisSensorState states[1]={0};
-                size_t total_out=0;
-                rc = hidGetSevenSixAxisSensorStates(states, 1, &total_out);
-                printf("hidGetSevenSixAxisSensorStates(): 0x%x, %lx\n", rc, total_out);
-
-                if (R_SUCCEEDED(rc) && total_out) {
-                    printf("unk_x18: ");
-                    for (u32 i=0; i<sizeof(states[0].unk_x18)/sizeof(float); i++) printf("%f ", states[0].unk_x18[i]);
-                    printf("\n");
-                }
+                printf("\x1b[10;1Hunk_x18: ");
+                for (u32 i=0; i<sizeof(newest.unk_x18)/sizeof(float); i++) printf("%f ", newest.unk_x18[i]);
+                printf("\n");
         }
 
         consoleUpdate(NULL);
@@ -1,8 +1,12 @@
 #include <string.h>
 #include <stdio.h>
 
+#include <math.h>
+
 #include <switch.h>
 
+#include "motion.h"
+
 //See also libnx hid.h.
 
 int main(int argc, char **argv)
@@ -19,7 +23,11 @@ int main(int argc, char **argv)
     hidStartSixAxisSensor(handles[2]);
     hidStartSixAxisSensor(handles[3]);
 
-    printf("\x1b[1;1HPress PLUS to exit.");
+    // Every sample since the previous frame is read at once, and fused into an orientation
+    SixAxisReader reader;
+    sixAxisReaderInit(&reader, CONTROLLER_P1_AUTO, MOTION_DEFAULT_BETA);
+
+    printf("\x1b[1;1HPress PLUS to exit, A to reset the fused orientation.");
     printf("\x1b[2;1HSixAxis Sensor readings:");
 
     // Main loop
@@ -33,9 +41,12 @@ int main(int argc, char **argv)
 
         if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
 
-        SixAxisSensorValues sixaxis;
-        // You can read back up to 17 successive values at once
-        hidSixAxisSensorValuesRead(&sixaxis, CONTROLLER_P1_AUTO, 1);
+        if (kDown & KEY_A)
+            motionFilterInit(&reader.filter, MOTION_DEFAULT_BETA);
+
+        // You can read back up to 17 successive values at once, the reader reads them all and keeps the newest
+        u32 fresh = sixAxisReaderUpdate(&reader);
+        SixAxisSensorValues sixaxis = reader.last;
 
         printf("\x1b[3;1H");
 
@@ -51,6 +62,12 @@ int main(int argc, char **argv)
             sixaxis.orientation[1].x, sixaxis.orientation[1].y, sixaxis.orientation[1].z,
             sixaxis.orientation[2].x, sixaxis.orientation[2].y, sixaxis.orientation[2].z);
 
+        float yaw, pitch, roll;
+        motionFilterGetEuler(&reader.filter, &yaw, &pitch, &roll);
+        printf("Fused quaternion: w=% .4f, x=% .4f, y=% .4f, z=% .4f\n", reader.filter.q[0], reader.filter.q[1], reader.filter.q[2], reader.filter.q[3]);
+        printf("Fused angles:     yaw=% 7.2f, pitch=% 7.2f, roll=% 7.2f\n", yaw * 180.0f / M_PI, pitch * 180.0f / M_PI, roll * 180.0f / M_PI);
+        printf("Samples:          %2u this frame, %u total, %u overruns\n", fresh, reader.samples, reader.overruns);
+
         consoleUpdate(NULL);
     }
 
@@ -3,12 +3,25 @@
 
 #include <switch.h>
 
+#include "gesture.h"
+
 //See also libnx hid.h.
 
+#define LOG_LINES 8
+
+static const char* const gesture_names[] = { "tap", "long press", "pan", "pinch", "swipe" };
+static const char* const phase_names[] = { "begin", "move", "end" };
+
 int main(int argc, char **argv)
 {
     u32 prev_touchcount=0;
 
+    //Recognized gestures, newest last
+    GestureRecognizer gestures;
+    gestureInit(&gestures);
+    char log[LOG_LINES][80] = {0};
+    u32 log_pos=0;
+
     consoleInit(NULL);
 
     printf("\x1b[1;1HPress PLUS to exit.");
@@ -51,6 +64,36 @@ int main(int argc, char **argv)
             printf("[point_id=%d] px=%03d, py=%03d, dx=%03d, dy=%03d, angle=%03d\n", i, touch.px, touch.py, touch.dx, touch.dy, touch.angle);
         }
 
+        //Pans and pinches send an event every frame while they go on, only their begin and end are logged
+        u32 num_events = gestureUpdateFromHid(&gestures);
+        for(i=0; i<num_events; i++)
+        {
+            const GestureEvent* ev = &gestures.events[i];
+            if (ev->phase == GesturePhase_Move) continue;
+
+            char* line = log[log_pos++ % LOG_LINES];
+            if (ev->type == GestureType_Swipe)
+                snprintf(line, sizeof(log[0]), "swipe at %.0f,%.0f, velocity %.0f,%.0f px/s", ev->x, ev->y, ev->vx, ev->vy);
+            else if (ev->type == GestureType_Pan || ev->type == GestureType_Pinch)
+                snprintf(line, sizeof(log[0]), "%s %s at %.0f,%.0f", gesture_names[ev->type], phase_names[ev->phase], ev->x, ev->y);
+            else
+                snprintf(line, sizeof(log[0]), "%s at %.0f,%.0f", gesture_names[ev->type], ev->x, ev->y);
+        }
+
+        //Live pinch scale and pan position
+        for(i=0; i<num_events; i++)
+        {
+            const GestureEvent* ev = &gestures.events[i];
+            if (ev->type == GestureType_Pinch && ev->phase == GesturePhase_Move)
+                printf("\x1b[18;1Hpinch scale: %.3f      ", ev->scale);
+            else if (ev->type == GestureType_Pan && ev->phase == GesturePhase_Move)
+                printf("\x1b[18;1Hpan: %.0f,%.0f, velocity %.0f,%.0f px/s      ", ev->x, ev->y, ev->vx, ev->vy);
+        }
+
+        printf("\x1b[20;1HGestures:\n");
+        for(i=0; i<LOG_LINES; i++)
+            printf("%-79s\n", log[(log_pos + i) % LOG_LINES]);
+
         consoleUpdate(NULL);
     }
 
@@ -3,8 +3,32 @@
 
 #include <switch.h>
 
+#include "rumble.h"
+
 //Example for HID vibration/rumble.
 
+//Rumble clips played through the scheduler. Each segment is held for its duration (in ms).
+static const RumbleSegment HitSegments[] = {
+    { 30, 0.9f, 160.0f, 0.7f, 320.0f },
+    { 50, 0.4f, 140.0f, 0.3f, 280.0f },
+    { 80, 0.15f, 120.0f, 0.1f, 240.0f },
+};
+static const RumbleClip HitClip = { HitSegments, 3, false };
+
+static const RumbleSegment EngineSegments[] = {
+    { 20, 0.25f, 60.0f, 0.05f, 200.0f },
+    { 20, 0.15f, 55.0f, 0.05f, 200.0f },
+};
+static const RumbleClip EngineClip = { EngineSegments, 2, true };
+
+static const RumbleSegment HeartbeatSegments[] = {
+    { 60, 0.6f, 80.0f, 0.0f, 320.0f },
+    { 120, 0.0f, 160.0f, 0.0f, 320.0f },
+    { 80, 0.4f, 80.0f, 0.0f, 320.0f },
+    { 500, 0.0f, 160.0f, 0.0f, 320.0f },
+};
+static const RumbleClip HeartbeatClip = { HeartbeatSegments, 4, false };
+
 int main(int argc, char **argv)
 {
     u32 VibrationDeviceHandles[2][2];
@@ -29,6 +53,13 @@ int main(int argc, char **argv)
 
     if (R_SUCCEEDED(rc)) printf("Hold R to vibrate, and press A/B/X/Y while holding R to adjust values.\n");
 
+    //The scheduler mixes clips on every controller from a thread, and sends all the changes in one call every 5ms.
+    static RumbleScheduler rumble;
+    Result rc_rumble = rumbleSchedulerStart(&rumble);
+    RumbleHandle engine = RUMBLE_INVALID_HANDLE;
+    printf("rumbleSchedulerStart() returned: 0x%x\n", rc_rumble);
+    if (R_SUCCEEDED(rc_rumble)) printf("ZL: hit, ZR: toggle engine loop, L: heartbeat on every controller (mixed with the rest).\n");
+
     VibrationValue.amp_low   = 0.2f;
     VibrationValue.freq_low  = 10.0f;
     VibrationValue.amp_high  = 0.2f;
@@ -59,6 +90,38 @@ int main(int argc, char **argv)
         if (!hidGetHandheldMode())
             target_device = 1;
 
+        if (R_SUCCEEDED(rc_rumble))
+        {
+            if (kDown & KEY_ZL) rumblePlay(&rumble, CONTROLLER_P1_AUTO, &HitClip, RumbleMotor_Both, 1.0f);
+
+            if (kDown & KEY_ZR)
+            {
+                if (engine != RUMBLE_INVALID_HANDLE)
+                {
+                    rumbleCancel(&rumble, engine);
+                    engine = RUMBLE_INVALID_HANDLE;
+                }
+                else
+                    engine = rumblePlay(&rumble, CONTROLLER_P1_AUTO, &EngineClip, RumbleMotor_Both, 1.0f);
+            }
+
+            if (kDown & KEY_L)
+            {
+                for (int i = 0; i < 8; i++) rumblePlay(&rumble, CONTROLLER_PLAYER_1 + i, &HeartbeatClip, RumbleMotor_Both, 1.0f);
+                rumblePlay(&rumble, CONTROLLER_HANDHELD, &HeartbeatClip, RumbleMotor_Both, 1.0f);
+            }
+
+            //Holding R sends values directly, which the scheduler would overwrite
+            if (kDown & KEY_R)
+            {
+                rumbleCancelAll(&rumble, CONTROLLER_P1_AUTO);
+                engine = RUMBLE_INVALID_HANDLE;
+            }
+
+            u64 avg_us = rumble.sends ? armTicksToNs(rumble.send_ticks / rumble.sends) / 1000 : 0;
+            printf("\x1b[8;1Hscheduler: %u sends, %u values, %lu us per send, %u rejected      ", rumble.sends, rumble.values_sent, avg_us, rumble.rejected);
+        }
+
         if (R_SUCCEEDED(rc) && (kHeld & KEY_R))
         {
             //Calling hidSendVibrationValue/hidSendVibrationValues is really only needed when sending new VibrationValue(s).
@@ -91,6 +154,8 @@ int main(int argc, char **argv)
         consoleUpdate(NULL);
     }
 
+    if (R_SUCCEEDED(rc_rumble)) rumbleSchedulerStop(&rumble);
+
     consoleExit(NULL);
     return 0;
 }
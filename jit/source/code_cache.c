@@ -0,0 +1,177 @@
+#include <string.h>
+
+#include "code_cache.h"
+
+static bool code_cache_has_code_memory(CodeCache* cc)
+{
+    return cc->jit.type == JitType_CodeMemory;
+}
+
+Result code_cache_init(CodeCache* cc, size_t size)
+{
+    memset(cc, 0, sizeof(*cc));
+    Result rc = jitCreate(&cc->jit, size);
+    if (R_SUCCEEDED(rc)) {
+        cc->rw = (u8*)jitGetRwAddr(&cc->jit);
+        cc->rx = (u8*)jitGetRxAddr(&cc->jit);
+        cc->size = size;
+    }
+    return rc;
+}
+
+void code_cache_exit(CodeCache* cc)
+{
+    jitClose(&cc->jit);
+}
+
+static void code_cache_evict_oldest(CodeCache* cc)
+{
+    CodeCacheEntry entry = cc->entries[cc->first_entry];
+    cc->first_entry = (cc->first_entry + 1) % CODE_CACHE_MAX_ENTRIES;
+    cc->num_entries--;
+    cc->stats.evictions++;
+    if (entry.evict)
+        entry.evict(entry.user);
+}
+
+void code_cache_clear(CodeCache* cc)
+{
+    while (cc->num_entries)
+        code_cache_evict_oldest(cc);
+    cc->head = 0;
+}
+
+// Where size bytes fit without evicting anything, if they do
+static bool code_cache_fits(CodeCache* cc, u32 size, u32* offset)
+{
+    if (!cc->num_entries) {
+        *offset = 0;
+        return true;
+    }
+
+    // The live functions are the ones from the oldest one up to head, wrapping at the end of the region
+    u32 tail = cc->entries[cc->first_entry].offset;
+    if (cc->head > tail) {
+        if (cc->head + size <= cc->size) {
+            *offset = cc->head;
+            return true;
+        }
+        // The end of the region is left unused, and the next functions start over from the beginning
+        if (size <= tail) {
+            *offset = 0;
+            return true;
+        }
+        return false;
+    }
+
+    if (cc->head + size <= tail) {
+        *offset = cc->head;
+        return true;
+    }
+    return false;
+}
+
+static void code_cache_mark_dirty(CodeCache* cc, u32 start, u32 end)
+{
+    // Functions of a window are mostly allocated one after the other, which makes a single range
+    for (u32 i = 0; i < cc->num_dirty; i++) {
+        CodeCacheRange* range = &cc->dirty[i];
+        if (start <= range->end && end >= range->start) {
+            range->start = start < range->start ? start : range->start;
+            range->end = end > range->end ? end : range->end;
+            return;
+        }
+    }
+
+    if (cc->num_dirty < CODE_CACHE_MAX_DIRTY) {
+        cc->dirty[cc->num_dirty++] = (CodeCacheRange){ start, end };
+        return;
+    }
+
+    // Out of ranges: the last one grows to cover this one too
+    CodeCacheRange* range = &cc->dirty[cc->num_dirty - 1];
+    range->start = start < range->start ? start : range->start;
+    range->end = end > range->end ? end : range->end;
+}
+
+Result code_cache_begin(CodeCache* cc)
+{
+    if (cc->window_depth++)
+        return 0;
+
+    // With code memory, the writable mapping is always there
+    Result rc = code_cache_has_code_memory(cc) ? 0 : jitTransitionToWritable(&cc->jit);
+    if (R_FAILED(rc))
+        cc->window_depth--;
+    return rc;
+}
+
+Result code_cache_end(CodeCache* cc)
+{
+    if (!cc->window_depth || --cc->window_depth)
+        return 0;
+
+    if (cc->pending)
+        code_cache_commit(cc, 0, NULL, NULL);
+
+    Result rc = 0;
+    if (code_cache_has_code_memory(cc)) {
+        // What was written goes from the data cache to memory, and stale instructions are dropped
+        for (u32 i = 0; i < cc->num_dirty; i++) {
+            const CodeCacheRange* range = &cc->dirty[i];
+            armDCacheFlush(cc->rw + range->start, range->end - range->start);
+            armICacheInvalidate(cc->rx + range->start, range->end - range->start);
+            cc->stats.bytes_flushed += range->end - range->start;
+        }
+    }
+    else if (cc->num_dirty) {
+        rc = jitTransitionToExecutable(&cc->jit);
+        cc->stats.bytes_flushed += cc->size;
+    }
+
+    cc->num_dirty = 0;
+    cc->stats.windows++;
+    return rc;
+}
+
+void* code_cache_alloc(CodeCache* cc, u32 max_size)
+{
+    u32 size = (max_size + CODE_CACHE_ALIGN - 1) & ~(CODE_CACHE_ALIGN - 1);
+    if (!cc->window_depth || cc->pending || !size || size > cc->size)
+        return NULL;
+
+    if (cc->num_entries == CODE_CACHE_MAX_ENTRIES)
+        code_cache_evict_oldest(cc);
+
+    u32 offset;
+    while (!code_cache_fits(cc, size, &offset))
+        code_cache_evict_oldest(cc);
+
+    cc->pending = true;
+    cc->pending_offset = offset;
+    cc->pending_size = size;
+    return cc->rw + offset;
+}
+
+const void* code_cache_commit(CodeCache* cc, u32 size, CodeCacheEvictFunc evict, void* user)
+{
+    if (!cc->pending)
+        return NULL;
+    cc->pending = false;
+
+    size = (size + CODE_CACHE_ALIGN - 1) & ~(CODE_CACHE_ALIGN - 1);
+    if (size > cc->pending_size)
+        size = cc->pending_size;
+    if (!size)
+        return NULL;
+
+    CodeCacheEntry* entry = &cc->entries[(cc->first_entry + cc->num_entries) % CODE_CACHE_MAX_ENTRIES];
+    *entry = (CodeCacheEntry){ cc->pending_offset, size, evict, user };
+    cc->num_entries++;
+    cc->head = cc->pending_offset + size;
+
+    code_cache_mark_dirty(cc, cc->pending_offset, cc->pending_offset + size);
+    cc->stats.functions++;
+    cc->stats.bytes_written += size;
+    return cc->rx + entry->offset;
+}
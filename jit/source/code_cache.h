@@ -0,0 +1,79 @@
+#pragma once
+#include <switch.h>
+
+// Code cache over one Jit region.
+//
+// jitTransitionToExecutable cleans the data cache and invalidates the instruction cache of the whole region (and, with
+// JitType_SetProcessMemoryPermission, maps it again), however little code changed. Instead, code is written in
+// windows: code_cache_begin opens one, any number of functions are allocated and written, and code_cache_end makes
+// them all executable at once. With JitType_CodeMemory (4.0.0+), where the writable and the executable mappings exist
+// side by side, no transition is needed at all, and only the ranges written in the window get their cache lines
+// maintained. With JitType_SetProcessMemoryPermission, the region isn't executable while a window is open: no code of
+// the cache may run until code_cache_end.
+//
+// Space is allocated from the region as a ring, in allocation order. When there's no room left, the oldest functions
+// are evicted to make some: their evict callback is called, after which the caller must not call them anymore (e.g.
+// it falls back to an interpreter). Nothing evicted may be running, the cache is meant to be used by one thread.
+
+#define CODE_CACHE_ALIGN 16
+#define CODE_CACHE_MAX_ENTRIES 1024
+#define CODE_CACHE_MAX_DIRTY 8
+
+typedef void (*CodeCacheEvictFunc)(void* user);
+
+typedef struct {
+    u32 offset;
+    u32 size;
+    CodeCacheEvictFunc evict;
+    void* user;
+} CodeCacheEntry;
+
+typedef struct {
+    u32 start, end;                 // Offsets in the region
+} CodeCacheRange;
+
+typedef struct {
+    u64 windows;                    // code_cache_begin/code_cache_end pairs
+    u64 functions;                  // Allocated
+    u64 evictions;
+    u64 bytes_written;
+    u64 bytes_flushed;              // Which got their cache lines maintained
+} CodeCacheStats;
+
+typedef struct {
+    Jit jit;
+    u8* rw;
+    u8* rx;
+    u32 size;
+
+    // Ring of the live functions, oldest first
+    CodeCacheEntry entries[CODE_CACHE_MAX_ENTRIES];
+    u32 first_entry, num_entries;
+    u32 head;                       // Offset of the next allocation
+
+    u32 window_depth;
+    bool pending;                   // A function was allocated, and not committed yet
+    u32 pending_offset, pending_size;
+    CodeCacheRange dirty[CODE_CACHE_MAX_DIRTY];
+    u32 num_dirty;
+
+    CodeCacheStats stats;
+} CodeCache;
+
+Result code_cache_init(CodeCache* cc, size_t size);
+// The functions left are dropped, without calling their evict callback
+void code_cache_exit(CodeCache* cc);
+
+// Windows nest, only the outermost one transitions the region
+Result code_cache_begin(CodeCache* cc);
+Result code_cache_end(CodeCache* cc);
+
+// Reserves max_size bytes in the open window, evicting functions if needed, and returns where to write them. Returns
+// NULL if max_size is larger than the region.
+void* code_cache_alloc(CodeCache* cc, u32 max_size);
+// Ends the last allocation with the size actually written (0 gives the space back), and returns the address to call.
+// evict is called with user when the function is evicted.
+const void* code_cache_commit(CodeCache* cc, u32 size, CodeCacheEvictFunc evict, void* user);
+
+// Evicts everything
+void code_cache_clear(CodeCache* cc);
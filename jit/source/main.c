@@ -3,7 +3,173 @@
 
 #include <switch.h>
 
+#include "vm.h"
+
 //Example for using JIT. See also libnx jit.h.
+//The second part runs functions of a small bytecode VM (vm.h) in its interpreter, then compiled to AArch64 by its JIT, and compares both with the same functions in C.
+
+//sum of (i*i) ^ (i>>3) for i from 0 to r0-1
+static const VmInsn g_MixCode[] = {
+    { VmOp_LoadImm, 5, 0, 0, 3 },
+    { VmOp_Mul,     3, 1, 1, 0 },     //1: loop
+    { VmOp_Shr,     4, 1, 5, 0 },
+    { VmOp_Xor,     3, 3, 4, 0 },
+    { VmOp_Add,     2, 2, 3, 0 },
+    { VmOp_AddImm,  1, 1, 0, 1 },
+    { VmOp_Jlt,     1, 0, 0, 1 },
+    { VmOp_Ret,     2, 0, 0, 0 },
+};
+
+//Total number of Collatz steps for the numbers from 1 to r0-1
+static const VmInsn g_CollatzCode[] = {
+    { VmOp_LoadImm, 5, 0, 0, 1 },
+    { VmOp_LoadImm, 6, 0, 0, 3 },
+    { VmOp_LoadImm, 1, 0, 0, 1 },
+    { VmOp_Jge,     1, 0, 0, 16 },
+    { VmOp_Mov,     3, 1, 0, 0 },     //4: for each number
+    { VmOp_Jeq,     3, 5, 0, 14 },    //5: until it's 1
+    { VmOp_And,     4, 3, 5, 0 },
+    { VmOp_Jeq,     4, 5, 0, 11 },
+    { VmOp_Shr,     3, 3, 5, 0 },     //even: x/2
+    { VmOp_AddImm,  2, 2, 0, 1 },     //9
+    { VmOp_Jmp,     0, 0, 0, 5 },
+    { VmOp_Mul,     3, 3, 6, 0 },     //11: odd: 3x+1
+    { VmOp_AddImm,  3, 3, 0, 1 },
+    { VmOp_Jmp,     0, 0, 0, 9 },
+    { VmOp_AddImm,  1, 1, 0, 1 },     //14
+    { VmOp_Jlt,     1, 0, 0, 4 },
+    { VmOp_Ret,     2, 0, 0, 0 },     //16
+};
+
+__attribute__((noinline)) static s64 mix_c(s64 n)
+{
+    s64 acc = 0, i = 0;
+    do {
+        acc += (i*i) ^ ((u64)i >> 3);
+    } while (++i < n);
+    return acc;
+}
+
+__attribute__((noinline)) static s64 collatz_c(s64 n)
+{
+    s64 steps = 0;
+    for (s64 i = 1; i < n; i++) {
+        for (u64 x = i; x != 1; steps++)
+            x = (x & 1) ? x*3 + 1 : x >> 1;
+    }
+    return steps;
+}
+
+static VmFunction g_MixFunc, g_CollatzFunc, g_TierFunc;
+static VmFunction g_ManyFuncs[64];
+
+static void benchmark(Vm* vm, VmFunction* fn, const char* name, s64 n, s64 (*native)(s64))
+{
+    s64 args[VM_NUM_ARGS] = { n };
+
+    u64 start = armGetSystemTick();
+    s64 interpreted = vm_interpret(fn, args);
+    u64 interpret_ticks = armGetSystemTick() - start;
+
+    start = armGetSystemTick();
+    bool compiled = vm_compile(vm, fn);
+    u64 compile_ticks = armGetSystemTick() - start;
+    if (!compiled)
+    {
+        printf("%s: vm_compile() failed\n", name);
+        return;
+    }
+
+    start = armGetSystemTick();
+    s64 jitted = fn->native(args[0], args[1], args[2], args[3]);
+    u64 jit_ticks = armGetSystemTick() - start;
+
+    start = armGetSystemTick();
+    s64 expected = native(n);
+    u64 native_ticks = armGetSystemTick() - start;
+
+    printf("%s(%ld) = %ld%s\n", name, n, jitted, (interpreted == expected && jitted == expected) ? "" : " (MISMATCH)");
+    printf("  interpreter %8lu us\n", armTicksToNs(interpret_ticks) / 1000);
+    printf("  JIT         %8lu us, %.1fx faster, compiled in %lu us\n", armTicksToNs(jit_ticks) / 1000,
+        (double)interpret_ticks / (jit_ticks ? jit_ticks : 1), armTicksToNs(compile_ticks) / 1000);
+    printf("  C           %8lu us\n", armTicksToNs(native_ticks) / 1000);
+}
+
+//Many hot functions in a code cache too small for all of them: each frame, the functions which got hot are compiled together in one window, and the oldest ones are evicted to make room.
+static void run_code_cache(void)
+{
+    Vm vm;
+    Result rc = vm_init(&vm, 0x1000);
+    printf("\nvm_init() returned: 0x%x\n", rc);
+    if (R_FAILED(rc))
+        return;
+
+    u32 numFuncs = sizeof(g_ManyFuncs) / sizeof(VmFunction);
+    u32 i, frame, mismatches = 0;
+    for (i=0; i<numFuncs; i++)
+        vm_function_init(&g_ManyFuncs[i], g_CollatzCode, sizeof(g_CollatzCode) / sizeof(VmInsn));
+
+    s64 args[VM_NUM_ARGS] = { 100 };
+    s64 expected = collatz_c(100);
+    u64 start = armGetSystemTick();
+    for (frame=0; frame<4*VM_JIT_THRESHOLD; frame++)
+    {
+        for (i=0; i<numFuncs; i++)
+        {
+            if (vm_call(&vm, &g_ManyFuncs[i], args) != expected)
+                mismatches++;
+        }
+        vm_compile_pending(&vm);
+    }
+    u64 ticks = armGetSystemTick() - start;
+
+    u32 compiled = 0;
+    for (i=0; i<numFuncs; i++)
+    {
+        if (g_ManyFuncs[i].native)
+            compiled++;
+    }
+
+    const CodeCacheStats* stats = &vm.cache.stats;
+    printf("%u frames of %u functions in %lu us, %u mismatches, %u compiled at the end\n", frame, numFuncs, armTicksToNs(ticks) / 1000, mismatches, compiled);
+    printf("%lu functions compiled in %lu windows, %lu evicted\n", stats->functions, stats->windows, stats->evictions);
+    printf("%lu bytes written, %lu flushed (the whole region each time: %lu)\n", stats->bytes_written, stats->bytes_flushed, stats->windows * vm.cache.size);
+
+    vm_exit(&vm);
+}
+
+static void run_vm(void)
+{
+    Vm vm;
+    Result rc = vm_init(&vm, 0x10000);
+    printf("\nvm_init() returned: 0x%x\n", rc);
+    if (R_FAILED(rc))
+        return;
+
+    if (vm_function_init(&g_MixFunc, g_MixCode, sizeof(g_MixCode) / sizeof(VmInsn)))
+        benchmark(&vm, &g_MixFunc, "mix", 10000000, mix_c);
+    if (vm_function_init(&g_CollatzFunc, g_CollatzCode, sizeof(g_CollatzCode) / sizeof(VmInsn)))
+        benchmark(&vm, &g_CollatzFunc, "collatz", 100000, collatz_c);
+
+    //Tiering: vm_call interprets a function until it's been called VM_JIT_THRESHOLD times, then queues it to be compiled by vm_compile_pending, called once per frame.
+    if (vm_function_init(&g_TierFunc, g_MixCode, sizeof(g_MixCode) / sizeof(VmInsn)))
+    {
+        s64 args[VM_NUM_ARGS] = { 10000 };
+        u32 i;
+        for (i=0; i<2*VM_JIT_THRESHOLD; i++)
+        {
+            u64 start = armGetSystemTick();
+            vm_call(&vm, &g_TierFunc, args);
+            printf("call %2u: %5lu us%s\n", i + 1, armTicksToNs(armGetSystemTick() - start) / 1000, g_TierFunc.native ? " (compiled)" : "");
+            vm_compile_pending(&vm);
+        }
+    }
+
+    printf("%lu bytes of code generated\n", vm.cache.stats.bytes_written);
+    vm_exit(&vm);
+
+    run_code_cache();
+}
 
 int main(int argc, char **argv)
 {
@@ -44,6 +210,8 @@ int main(int argc, char **argv)
         printf("jitClose() returned: 0x%x\n", rc);
     }
 
+    run_vm();
+
     // Main loop
     while(appletMainLoop())
     {
@@ -0,0 +1,123 @@
+#include <string.h>
+
+#include "vm.h"
+
+Result vm_init(Vm* vm, size_t code_size)
+{
+    vm->num_pending = 0;
+    return code_cache_init(&vm->cache, code_size);
+}
+
+void vm_exit(Vm* vm)
+{
+    code_cache_exit(&vm->cache);
+}
+
+bool vm_function_init(VmFunction* fn, const VmInsn* code, u32 num_insns)
+{
+    memset(fn, 0, sizeof(*fn));
+    if (!num_insns)
+        return false;
+
+    for (u32 i = 0; i < num_insns; i++) {
+        const VmInsn* insn = &code[i];
+        if (insn->op >= VmOp_Count || insn->a >= VM_NUM_REGS || insn->b >= VM_NUM_REGS || insn->c >= VM_NUM_REGS)
+            return false;
+        if (insn->op >= VmOp_Jmp && insn->op <= VmOp_Jge && (insn->imm < 0 || (u32)insn->imm >= num_insns))
+            return false;
+    }
+
+    // Nothing but a jump or a return may be last, so that no tier runs past the end
+    u8 last = code[num_insns - 1].op;
+    if (last != VmOp_Jmp && last != VmOp_Ret)
+        return false;
+
+    fn->code = code;
+    fn->num_insns = num_insns;
+    return true;
+}
+
+s64 vm_interpret(const VmFunction* fn, const s64* args)
+{
+    // Direct threading: each handler jumps to the next one itself, rather than all going through one indirect branch
+    static const void* const handlers[VmOp_Count] = {
+        [VmOp_LoadImm] = &&op_load_imm,
+        [VmOp_Mov]     = &&op_mov,
+        [VmOp_Add]     = &&op_add,
+        [VmOp_AddImm]  = &&op_add_imm,
+        [VmOp_Sub]     = &&op_sub,
+        [VmOp_Mul]     = &&op_mul,
+        [VmOp_And]     = &&op_and,
+        [VmOp_Or]      = &&op_or,
+        [VmOp_Xor]     = &&op_xor,
+        [VmOp_Shl]     = &&op_shl,
+        [VmOp_Shr]     = &&op_shr,
+        [VmOp_Jmp]     = &&op_jmp,
+        [VmOp_Jeq]     = &&op_jeq,
+        [VmOp_Jne]     = &&op_jne,
+        [VmOp_Jlt]     = &&op_jlt,
+        [VmOp_Jge]     = &&op_jge,
+        [VmOp_Ret]     = &&op_ret,
+    };
+
+    s64 r[VM_NUM_REGS] = {0};
+    memcpy(r, args, VM_NUM_ARGS * sizeof(s64));
+    const VmInsn* code = fn->code;
+    const VmInsn* pc = code;
+
+#define DISPATCH() goto *handlers[pc->op]
+#define NEXT() do { pc++; DISPATCH(); } while (0)
+#define BRANCH(cond) do { pc = (cond) ? &code[pc->imm] : pc + 1; DISPATCH(); } while (0)
+
+    DISPATCH();
+
+op_load_imm: r[pc->a] = pc->imm; NEXT();
+op_mov:      r[pc->a] = r[pc->b]; NEXT();
+op_add:      r[pc->a] = (s64)((u64)r[pc->b] + (u64)r[pc->c]); NEXT();
+op_add_imm:  r[pc->a] = (s64)((u64)r[pc->b] + (u64)(s64)pc->imm); NEXT();
+op_sub:      r[pc->a] = (s64)((u64)r[pc->b] - (u64)r[pc->c]); NEXT();
+op_mul:      r[pc->a] = (s64)((u64)r[pc->b] * (u64)r[pc->c]); NEXT();
+op_and:      r[pc->a] = r[pc->b] & r[pc->c]; NEXT();
+op_or:       r[pc->a] = r[pc->b] | r[pc->c]; NEXT();
+op_xor:      r[pc->a] = r[pc->b] ^ r[pc->c]; NEXT();
+op_shl:      r[pc->a] = (s64)((u64)r[pc->b] << (r[pc->c] & 63)); NEXT();
+op_shr:      r[pc->a] = (s64)((u64)r[pc->b] >> (r[pc->c] & 63)); NEXT();
+op_jmp:      BRANCH(true);
+op_jeq:      BRANCH(r[pc->a] == r[pc->b]);
+op_jne:      BRANCH(r[pc->a] != r[pc->b]);
+op_jlt:      BRANCH(r[pc->a] < r[pc->b]);
+op_jge:      BRANCH(r[pc->a] >= r[pc->b]);
+op_ret:      return r[pc->a];
+
+#undef DISPATCH
+#undef NEXT
+#undef BRANCH
+}
+
+s64 vm_call(Vm* vm, VmFunction* fn, const s64* args)
+{
+    if (fn->native)
+        return fn->native(args[0], args[1], args[2], args[3]);
+
+    if (++fn->calls == VM_JIT_THRESHOLD) {
+        if (vm->num_pending < VM_MAX_PENDING)
+            vm->pending[vm->num_pending++] = fn;
+        else
+            vm_compile(vm, fn);
+    }
+    return vm_interpret(fn, args);
+}
+
+void vm_compile_pending(Vm* vm)
+{
+    if (!vm->num_pending)
+        return;
+
+    // One window for all of them: a single transition, and only the new code gets its cache lines maintained
+    if (R_FAILED(code_cache_begin(&vm->cache)))
+        return;
+    for (u32 i = 0; i < vm->num_pending; i++)
+        vm_compile(vm, vm->pending[i]);
+    code_cache_end(&vm->cache);
+    vm->num_pending = 0;
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <switch.h>
+
+#include "code_cache.h"
+
+// Small register-based bytecode VM, with two tiers.
+//
+// A function is an array of VmInsn working on 16 registers of 64 bits: its (up to) 4 arguments come in r0-r3, the
+// other registers start at 0, and VmOp_Ret returns one of them. Functions are interpreted first, vm_call counts how many
+// times each one is called, and once it reaches VM_JIT_THRESHOLD the function is queued for compilation to AArch64 code.
+// vm_compile_pending compiles all the queued functions in one window of the code cache (code_cache.h), at a time the
+// caller chooses, e.g. once per frame: later calls then run the compiled code. If the function is evicted from the
+// cache, it's interpreted again until it gets hot again.
+//
+// The compiler is a baseline template JIT: each instruction emits a fixed sequence, with the VM registers mapped to
+// x0-x15 (caller-saved, and the generated functions are leaves: nothing needs saving), so there's no dispatch, no
+// decoding and no register file in memory left.
+//
+// Bytecode is checked by vm_function_init, neither tier checks anything at runtime.
+
+#define VM_NUM_REGS 16
+#define VM_NUM_ARGS 4
+#define VM_JIT_THRESHOLD 8
+#define VM_MAX_PENDING 64
+
+typedef enum {
+    VmOp_LoadImm,     // a = imm
+    VmOp_Mov,         // a = b
+    VmOp_Add,         // a = b + c
+    VmOp_AddImm,      // a = b + imm
+    VmOp_Sub,         // a = b - c
+    VmOp_Mul,         // a = b * c
+    VmOp_And,         // a = b & c
+    VmOp_Or,          // a = b | c
+    VmOp_Xor,         // a = b ^ c
+    VmOp_Shl,         // a = b << (c & 63)
+    VmOp_Shr,         // a = (u64)b >> (c & 63)
+    VmOp_Jmp,         // Go to imm
+    VmOp_Jeq,         // Go to imm if a == b
+    VmOp_Jne,         // Go to imm if a != b
+    VmOp_Jlt,         // Go to imm if a < b (signed)
+    VmOp_Jge,         // Go to imm if a >= b (signed)
+    VmOp_Ret,         // Returns a
+    VmOp_Count,
+} VmOp;
+
+typedef struct {
+    u8 op;            // VmOp
+    u8 a, b, c;       // Registers
+    s32 imm;          // Immediate, or index of the target instruction
+} VmInsn;
+
+typedef s64 (*VmNativeFunc)(s64 r0, s64 r1, s64 r2, s64 r3);
+
+typedef struct {
+    const VmInsn* code;
+    u32 num_insns;
+    u32 calls;
+    VmNativeFunc native;            // Once compiled
+} VmFunction;
+
+typedef struct {
+    CodeCache cache;
+    VmFunction* pending[VM_MAX_PENDING];
+    u32 num_pending;
+} Vm;
+
+Result vm_init(Vm* vm, size_t code_size);
+void vm_exit(Vm* vm);
+
+// Returns false if the bytecode uses registers out of range, jumps out of the function, or can run past its end
+bool vm_function_init(VmFunction* fn, const VmInsn* code, u32 num_insns);
+
+// Runs the function in the tier it's in, and queues it once it got hot
+s64 vm_call(Vm* vm, VmFunction* fn, const s64* args);
+// Compiles the queued functions
+void vm_compile_pending(Vm* vm);
+
+// The tiers themselves
+s64 vm_interpret(const VmFunction* fn, const s64* args);
+// Compiles one function, in its own window of the code cache unless one is already open. Returns false if it's larger
+// than the code cache.
+bool vm_compile(Vm* vm, VmFunction* fn);
@@ -0,0 +1,179 @@
+#include <stdlib.h>
+
+#include "vm.h"
+
+// AArch64 encodings, with the VM registers as x0-x15 and x16 (IP0) as a scratch register
+#define A64_SCRATCH 16
+#define A64_XZR 31
+
+#define A64_COND_EQ 0x0
+#define A64_COND_NE 0x1
+#define A64_COND_GE 0xA
+#define A64_COND_LT 0xB
+
+typedef struct {
+    u32* buf;
+    u32 pos;
+    u32 cap;                        // In instructions, nothing is written past it
+} Emitter;
+
+// Longest sequence of an instruction (VmOp_AddImm with a large immediate), and of the prologue
+#define MAX_INSN_WORDS 4
+#define MAX_PROLOGUE_WORDS (VM_NUM_REGS - VM_NUM_ARGS)
+
+typedef struct {
+    u32 pos;                        // Of the branch instruction
+    u32 target;                     // Bytecode index
+    bool cond;                      // B.cond (imm19), B otherwise (imm26)
+} Fixup;
+
+static void emit(Emitter* e, u32 insn)
+{
+    if (e->pos < e->cap)
+        e->buf[e->pos] = insn;
+    e->pos++;
+}
+
+static void emit_rrr(Emitter* e, u32 base, u32 d, u32 n, u32 m)
+{
+    emit(e, base | m << 16 | n << 5 | d);
+}
+
+static void emit_load_imm(Emitter* e, u32 d, s32 imm)
+{
+    if (imm >= 0 && imm <= 0xFFFF)
+        emit(e, 0xD2800000 | (u32)imm << 5 | d);                      // movz xd, #imm
+    else if (imm < 0 && imm >= -0x10000)
+        emit(e, 0x92800000 | (~(u32)imm & 0xFFFF) << 5 | d);          // movn xd, #~imm
+    else {
+        emit(e, 0xD2800000 | ((u32)imm & 0xFFFF) << 5 | d);           // movz xd, #lo
+        emit(e, 0xF2A00000 | ((u32)imm >> 16) << 5 | d);              // movk xd, #hi, lsl #16
+        emit(e, 0x93407C00 | d << 5 | d);                              // sxtw xd, wd
+    }
+}
+
+static void emit_add_imm(Emitter* e, u32 d, u32 n, s32 imm)
+{
+    if (imm >= 0 && imm <= 0xFFF)
+        emit(e, 0x91000000 | (u32)imm << 10 | n << 5 | d);            // add xd, xn, #imm
+    else if (imm < 0 && imm >= -0xFFF)
+        emit(e, 0xD1000000 | (u32)-imm << 10 | n << 5 | d);           // sub xd, xn, #-imm
+    else {
+        emit_load_imm(e, A64_SCRATCH, imm);
+        emit_rrr(e, 0x8B000000, d, n, A64_SCRATCH);                    // add xd, xn, x16
+    }
+}
+
+static void emit_branch(Emitter* e, Fixup* fixups, u32* num_fixups, u32 base, u32 target, bool cond)
+{
+    fixups[(*num_fixups)++] = (Fixup){ .pos = e->pos, .target = target, .cond = cond };
+    emit(e, base);
+}
+
+static void emit_cond_branch(Emitter* e, Fixup* fixups, u32* num_fixups, const VmInsn* insn, u32 cond)
+{
+    emit_rrr(e, 0xEB000000, A64_XZR, insn->a, insn->b);               // cmp xa, xb
+    emit_branch(e, fixups, num_fixups, 0x54000000 | cond, insn->imm, true);
+}
+
+static void vm_evict(void* user)
+{
+    VmFunction* fn = (VmFunction*)user;
+    fn->native = NULL;
+    fn->calls = 0;
+}
+
+bool vm_compile(Vm* vm, VmFunction* fn)
+{
+    if (fn->native)
+        return true;
+
+    u32* offsets = (u32*)malloc(fn->num_insns * sizeof(u32));
+    Fixup* fixups = (Fixup*)malloc(fn->num_insns * sizeof(Fixup));
+    if (!offsets || !fixups) {
+        free(offsets);
+        free(fixups);
+        return false;
+    }
+
+    if (R_FAILED(code_cache_begin(&vm->cache))) {
+        free(offsets);
+        free(fixups);
+        return false;
+    }
+
+    u32 max_words = MAX_PROLOGUE_WORDS + fn->num_insns * MAX_INSN_WORDS;
+    Emitter e = {
+        .buf = (u32*)code_cache_alloc(&vm->cache, max_words * 4),
+        .cap = max_words,
+    };
+    if (!e.buf) {
+        code_cache_end(&vm->cache);
+        free(offsets);
+        free(fixups);
+        return false;
+    }
+    u32 num_fixups = 0;
+
+    // The registers which aren't arguments start at 0, like in the interpreter
+    u32 used = 0;
+    for (u32 i = 0; i < fn->num_insns; i++) {
+        const VmInsn* insn = &fn->code[i];
+        used |= 1U << insn->a | 1U << insn->b | 1U << insn->c;
+    }
+    for (u32 reg = VM_NUM_ARGS; reg < VM_NUM_REGS; reg++) {
+        if (used & (1U << reg))
+            emit(&e, 0xD2800000 | reg);                                 // movz xreg, #0
+    }
+
+    for (u32 i = 0; i < fn->num_insns; i++) {
+        const VmInsn* insn = &fn->code[i];
+        offsets[i] = e.pos;
+
+        switch (insn->op) {
+            case VmOp_LoadImm: emit_load_imm(&e, insn->a, insn->imm); break;
+            case VmOp_Mov:     emit(&e, 0xAA0003E0 | insn->b << 16 | insn->a); break; // orr xa, xzr, xb
+            case VmOp_Add:     emit_rrr(&e, 0x8B000000, insn->a, insn->b, insn->c); break;
+            case VmOp_AddImm:  emit_add_imm(&e, insn->a, insn->b, insn->imm); break;
+            case VmOp_Sub:     emit_rrr(&e, 0xCB000000, insn->a, insn->b, insn->c); break;
+            case VmOp_Mul:     emit_rrr(&e, 0x9B007C00, insn->a, insn->b, insn->c); break; // madd xa, xb, xc, xzr
+            case VmOp_And:     emit_rrr(&e, 0x8A000000, insn->a, insn->b, insn->c); break;
+            case VmOp_Or:      emit_rrr(&e, 0xAA000000, insn->a, insn->b, insn->c); break;
+            case VmOp_Xor:     emit_rrr(&e, 0xCA000000, insn->a, insn->b, insn->c); break;
+            case VmOp_Shl:     emit_rrr(&e, 0x9AC02000, insn->a, insn->b, insn->c); break; // lslv
+            case VmOp_Shr:     emit_rrr(&e, 0x9AC02400, insn->a, insn->b, insn->c); break; // lsrv
+            case VmOp_Jmp:     emit_branch(&e, fixups, &num_fixups, 0x14000000, insn->imm, false); break;
+            case VmOp_Jeq:     emit_cond_branch(&e, fixups, &num_fixups, insn, A64_COND_EQ); break;
+            case VmOp_Jne:     emit_cond_branch(&e, fixups, &num_fixups, insn, A64_COND_NE); break;
+            case VmOp_Jlt:     emit_cond_branch(&e, fixups, &num_fixups, insn, A64_COND_LT); break;
+            case VmOp_Jge:     emit_cond_branch(&e, fixups, &num_fixups, insn, A64_COND_GE); break;
+            case VmOp_Ret:
+                if (insn->a != 0)
+                    emit(&e, 0xAA0003E0 | insn->a << 16);                // mov x0, xa
+                emit(&e, 0xD65F03C0);                                   // ret
+                break;
+        }
+    }
+
+    bool fits = e.pos <= e.cap;
+    if (fits) {
+        // Branches are relative, in instructions: imm19 reaches +-1MiB, imm26 +-128MiB
+        for (u32 i = 0; i < num_fixups; i++) {
+            s32 delta = (s32)offsets[fixups[i].target] - (s32)fixups[i].pos;
+            if (fixups[i].cond)
+                e.buf[fixups[i].pos] |= ((u32)delta & 0x7FFFF) << 5;
+            else
+                e.buf[fixups[i].pos] |= (u32)delta & 0x3FFFFFF;
+        }
+    }
+
+    const void* code = code_cache_commit(&vm->cache, fits ? e.pos * 4 : 0, vm_evict, fn);
+
+    // Makes the new code visible to instruction fetches, unless it's part of a larger window
+    if (R_SUCCEEDED(code_cache_end(&vm->cache)) && code)
+        fn->native = (VmNativeFunc)code;
+
+    free(offsets);
+    free(fixups);
+    return fn->native != NULL;
+}
@@ -1,22 +1,10 @@
 #include <stdio.h>
-#include <stdarg.h>
 #include <inttypes.h>
 #include <switch.h>
 
-static Mutex g_PrintMutex;
-static Barrier g_Barrier;
+#include "async_log.h"
 
-__attribute__((format(printf, 1, 2)))
-static void locked_printf(const char* fmt, ...)
-{
-    mutexLock(&g_PrintMutex);
-    va_list va;
-    va_start(va, fmt);
-    vprintf(fmt, va);
-    va_end(va);
-    consoleUpdate(NULL);
-    mutexUnlock(&g_PrintMutex);
-}
+static Barrier g_Barrier;
 
 void threadFunc(void* arg)
 {
@@ -25,9 +13,9 @@ void threadFunc(void* arg)
     u64 i;
     for (i=0; i<2; i++)
     {
-        locked_printf("Entering barrier %" PRIu64 "\n", num);
+        asyncLog("Entering barrier %" PRIu64 "\n", num);
         barrierWait(&g_Barrier);
-        locked_printf("Leaving barrier %" PRIu64 "\n", num);
+        asyncLog("Leaving barrier %" PRIu64 "\n", num);
     }
 }
 
@@ -35,10 +23,11 @@ int main(int argc, char **argv)
 {
     consoleInit(NULL);
 
-    mutexInit(&g_PrintMutex);
+    // The threads only copy what they log, it's printed by this one, which also updates the console
+    asyncLogInit(0x2D, true);
     barrierInit(&g_Barrier, 4);
 
-    locked_printf("Creating threads\n");
+    asyncLog("Creating threads\n");
 
     static Thread thread[4];
     int num_threads;
@@ -68,9 +57,7 @@ int main(int argc, char **argv)
         if (kDown & KEY_PLUS)
             break;
 
-        mutexLock(&g_PrintMutex);
-        consoleUpdate(NULL);
-        mutexUnlock(&g_PrintMutex);
+        svcSleepThread(16666667ull); // About a frame, the console is updated by the log thread
     }
 
 clean_up:
@@ -78,6 +65,7 @@ clean_up:
         threadWaitForExit(&thread[i]);
         threadClose(&thread[i]);
     }
+    asyncLogExit();
     consoleExit(NULL);
     return 0;
 }
@@ -0,0 +1,46 @@
+#pragma once
+#include <switch.h>
+
+// A benchmark is a function doing one repetition of some work, which returns how much it did (pixels, bytes,
+// samples, round trips...). The runner times each call: throughput benchmarks are reported in millions of units per
+// second, latency benchmarks in ns per unit.
+//
+// A run returning 0 failed, and stops the benchmark.
+//
+// setup runs once before the warm-up repetitions and may leave a context for run and teardown in *ctx. When it fails,
+// the benchmark is reported as skipped (e.g. no network) and the others still run. setup and teardown may be NULL.
+
+typedef enum {
+    BenchKind_Throughput,
+    BenchKind_Latency,
+} BenchKind;
+
+typedef struct {
+    const char* suite;
+    const char* name;
+    const char* unit;             // Of what run returns: "pixel", "byte", "frame"...
+    BenchKind kind;
+    Result (*setup)(void** ctx);
+    u64 (*run)(void* ctx);
+    void (*teardown)(void* ctx);
+} Bench;
+
+typedef struct {
+    const Bench* benches;
+    u32 count;
+} BenchSuite;
+
+// One per file, listed in main.c
+extern const BenchSuite g_graphicsBenches;
+extern const BenchSuite g_consoleBenches;
+extern const BenchSuite g_audioBenches;
+extern const BenchSuite g_fsBenches;
+extern const BenchSuite g_threadBenches;
+extern const BenchSuite g_networkBenches;
+
+#define BENCH_SUITE(var, ...) \
+    static const Bench var##List[] = { __VA_ARGS__ }; \
+    const BenchSuite var = { var##List, sizeof(var##List) / sizeof(var##List[0]) }
+
+// Keeps results alive, so that the work isn't optimized out
+extern volatile u64 g_benchSink;
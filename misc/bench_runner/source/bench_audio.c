@@ -0,0 +1,105 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "resampler.h"
+
+// Audio processing as the application side does it before queuing buffers: mixing stereo PCM16 voices with gains
+// and saturation, and resampling 44.1kHz assets with the polyphase resampler of audio/common. Throughput is in output
+// frames: one second of 48kHz audio is 0.048 Mframe.
+
+#define AUDIO_VOICES 16
+#define AUDIO_FRAMES 4800 // 100ms at 48kHz
+#define AUDIO_BLOCKS 10
+
+typedef struct {
+    s16* voices[AUDIO_VOICES];
+    s32 gains[AUDIO_VOICES];   // Q15
+    s32* mix;
+    s16* out;
+    ResamplerFilter filter;
+    Resampler resampler;
+} AudioContext;
+
+static void audioTeardown(void* ctx)
+{
+    AudioContext* a = (AudioContext*)ctx;
+    for (u32 v = 0; v < AUDIO_VOICES; v++)
+        free(a->voices[v]);
+    free(a->mix);
+    free(a->out);
+    free(a);
+}
+
+static Result audioSetup(void** ctx)
+{
+    AudioContext* a = (AudioContext*)aligned_alloc(16, sizeof(AudioContext));
+    if (!a)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    memset(a, 0, sizeof(*a));
+
+    bool ok = true;
+    for (u32 v = 0; v < AUDIO_VOICES; v++) {
+        a->voices[v] = (s16*)aligned_alloc(16, AUDIO_FRAMES * 2 * sizeof(s16));
+        ok = ok && a->voices[v];
+        a->gains[v] = 0x8000 / 4 + v * 0x200;
+    }
+    a->mix = (s32*)aligned_alloc(16, AUDIO_FRAMES * 2 * sizeof(s32));
+    a->out = (s16*)aligned_alloc(16, AUDIO_FRAMES * 2 * sizeof(s16));
+    if (!ok || !a->mix || !a->out) {
+        audioTeardown(a);
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    }
+
+    // Loud noise, so that the mix saturates
+    u32 seed = 1;
+    for (u32 v = 0; v < AUDIO_VOICES; v++) {
+        for (u32 i = 0; i < AUDIO_FRAMES * 2; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            a->voices[v][i] = (s16)(seed >> 16);
+        }
+    }
+
+    resamplerFilterInit(&a->filter, 44100, 48000);
+    resamplerInit(&a->resampler, &a->filter, 2);
+    *ctx = a;
+    return 0;
+}
+
+static u64 audioMix(void* ctx)
+{
+    AudioContext* a = (AudioContext*)ctx;
+    for (u32 b = 0; b < AUDIO_BLOCKS; b++) {
+        memset(a->mix, 0, AUDIO_FRAMES * 2 * sizeof(s32));
+        for (u32 v = 0; v < AUDIO_VOICES; v++) {
+            const s16* in = a->voices[v];
+            s32 gain = a->gains[v];
+            for (u32 i = 0; i < AUDIO_FRAMES * 2; i++)
+                a->mix[i] += (in[i] * gain) >> 15;
+        }
+        for (u32 i = 0; i < AUDIO_FRAMES * 2; i++) {
+            s32 s = a->mix[i];
+            a->out[i] = s > 0x7FFF ? 0x7FFF : s < -0x8000 ? -0x8000 : s;
+        }
+    }
+    g_benchSink = a->out[AUDIO_FRAMES];
+    return (u64)AUDIO_BLOCKS * AUDIO_FRAMES;
+}
+
+static u64 audioResample(void* ctx)
+{
+    AudioContext* a = (AudioContext*)ctx;
+    u64 produced = 0;
+    for (u32 b = 0; b < AUDIO_BLOCKS; b++) {
+        // Input for one block of output, from one of the voices
+        u32 in_frames = AUDIO_FRAMES * 44100 / 48000;
+        produced += resamplerProcess(&a->resampler, a->voices[b % AUDIO_VOICES], &in_frames, a->out, AUDIO_FRAMES);
+    }
+    g_benchSink = a->out[0];
+    return produced;
+}
+
+BENCH_SUITE(g_audioBenches,
+    { "audio", "mix_16_voices", "frame", BenchKind_Throughput, audioSetup, audioMix, audioTeardown },
+    { "audio", "resample_44100_to_48000", "frame", BenchKind_Throughput, audioSetup, audioResample, audioTeardown },
+);
@@ -0,0 +1,56 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+// Console output, in a window at the bottom of the screen so that the results above stay readable. The window is a
+// copy of the runner's console: it shares the renderer, and only has its own cursor and bounds.
+
+#define CONSOLE_LINES 200
+#define CONSOLE_CHARS 20000
+
+extern PrintConsole* g_runnerConsole;
+
+static Result consoleSetup(void** ctx)
+{
+    PrintConsole* c = (PrintConsole*)malloc(sizeof(PrintConsole));
+    if (!c)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    *c = *g_runnerConsole;
+    consoleSetWindow(c, 0, c->consoleHeight - 8, c->consoleWidth, 8);
+    consoleSelect(c);
+    consoleClear();
+    *ctx = c;
+    return 0;
+}
+
+static void consoleTeardown(void* ctx)
+{
+    consoleClear();
+    consoleSelect(g_runnerConsole);
+    free(ctx);
+}
+
+static u64 consoleFormattedLines(void* ctx)
+{
+    // As a log would: formatted, and shown as soon as it's printed
+    for (u32 i = 0; i < CONSOLE_LINES; i++) {
+        printf("line %4u: value %08X, %6.2f%%\n", i, i * 2654435761u, i * 0.5);
+        consoleUpdate(NULL);
+    }
+    return CONSOLE_LINES;
+}
+
+static u64 consoleChars(void* ctx)
+{
+    for (u32 i = 0; i < CONSOLE_CHARS; i++)
+        putchar(i % 79 == 78 ? '\n' : 'a' + i % 26);
+    fflush(stdout);
+    consoleUpdate(NULL);
+    return CONSOLE_CHARS;
+}
+
+BENCH_SUITE(g_consoleBenches,
+    { "console", "printf_line_and_update", "line", BenchKind_Latency, consoleSetup, consoleFormattedLines, consoleTeardown },
+    { "console", "putchar", "char", BenchKind_Throughput, consoleSetup, consoleChars, consoleTeardown },
+);
@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+// SD card I/O: sequential writes and reads of a 16 MiB file with the native fs API in 1 MiB calls, which is about as
+// fast as the card goes, and with stdio in 4 KiB fwrite calls, which is how most code writes files. The file is
+// created at its final size once, in setup, so that the writes measure the card rather than FAT allocation.
+
+#define FS_PATH "sdmc:/bench_runner.tmp"
+#define FS_FILE_SIZE (16 * 1024 * 1024)
+#define FS_CHUNK (1024 * 1024)
+#define FS_SMALL_CHUNK 4096
+
+typedef struct {
+    FsFileSystem* fs;
+    char path[FS_MAX_PATH];
+    u8* buffer;
+} FsContext;
+
+static void fsTeardown(void* ctx)
+{
+    FsContext* f = (FsContext*)ctx;
+    fsFsDeleteFile(f->fs, f->path);
+    free(f->buffer);
+    free(f);
+}
+
+static Result fsSetup(void** ctx)
+{
+    FsContext* f = (FsContext*)calloc(1, sizeof(FsContext));
+    if (!f)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    if (fsdevTranslatePath(FS_PATH, &f->fs, f->path) == -1) {
+        free(f);
+        return MAKERESULT(Module_Libnx, LibnxError_NotFound);
+    }
+
+    f->buffer = (u8*)aligned_alloc(0x1000, FS_CHUNK);
+    if (!f->buffer) {
+        free(f);
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    }
+    for (u32 i = 0; i < FS_CHUNK; i++)
+        f->buffer[i] = (u8)(i * 7);
+
+    fsFsDeleteFile(f->fs, f->path);
+    Result rc = fsFsCreateFile(f->fs, f->path, FS_FILE_SIZE, 0);
+    if (R_FAILED(rc)) {
+        free(f->buffer);
+        free(f);
+        return rc;
+    }
+    *ctx = f;
+    return 0;
+}
+
+// The file is opened by each run rather than kept open, so that the stdio runs can open it too
+static u64 fsWriteNative(void* ctx)
+{
+    FsContext* f = (FsContext*)ctx;
+    FsFile file;
+    if (R_FAILED(fsFsOpenFile(f->fs, f->path, FsOpenMode_Write, &file)))
+        return 0;
+    Result rc = 0;
+    for (s64 offset = 0; offset < FS_FILE_SIZE && R_SUCCEEDED(rc); offset += FS_CHUNK)
+        rc = fsFileWrite(&file, offset, f->buffer, FS_CHUNK, FsWriteOption_None);
+    if (R_SUCCEEDED(rc))
+        rc = fsFileFlush(&file);
+    fsFileClose(&file);
+    return R_SUCCEEDED(rc) ? FS_FILE_SIZE : 0;
+}
+
+static u64 fsReadNative(void* ctx)
+{
+    FsContext* f = (FsContext*)ctx;
+    FsFile file;
+    if (R_FAILED(fsFsOpenFile(f->fs, f->path, FsOpenMode_Read, &file)))
+        return 0;
+    u64 total = 0;
+    for (s64 offset = 0; offset < FS_FILE_SIZE; offset += FS_CHUNK) {
+        u64 read = 0;
+        if (R_FAILED(fsFileRead(&file, offset, f->buffer, FS_CHUNK, FsReadOption_None, &read)) || read != FS_CHUNK)
+            break;
+        total += read;
+    }
+    fsFileClose(&file);
+    return total == FS_FILE_SIZE ? total : 0;
+}
+
+static u64 fsWriteStdio(void* ctx)
+{
+    FsContext* f = (FsContext*)ctx;
+    FILE* fp = fopen(FS_PATH, "r+b");
+    if (!fp)
+        return 0;
+    u64 written = 0;
+    while (written < FS_FILE_SIZE && fwrite(f->buffer, 1, FS_SMALL_CHUNK, fp) == FS_SMALL_CHUNK)
+        written += FS_SMALL_CHUNK;
+    if (fclose(fp) != 0)
+        return 0;
+    return written == FS_FILE_SIZE ? written : 0;
+}
+
+static u64 fsReadStdio(void* ctx)
+{
+    FsContext* f = (FsContext*)ctx;
+    FILE* fp = fopen(FS_PATH, "rb");
+    if (!fp)
+        return 0;
+    u64 read = 0;
+    size_t n;
+    while ((n = fread(f->buffer, 1, FS_SMALL_CHUNK, fp)) > 0)
+        read += n;
+    fclose(fp);
+    return read;
+}
+
+BENCH_SUITE(g_fsBenches,
+    { "fs", "write_native_1m", "byte", BenchKind_Throughput, fsSetup, fsWriteNative, fsTeardown },
+    { "fs", "read_native_1m", "byte", BenchKind_Throughput, fsSetup, fsReadNative, fsTeardown },
+    { "fs", "fwrite_4k", "byte", BenchKind_Throughput, fsSetup, fsWriteStdio, fsTeardown },
+    { "fs", "fread_4k", "byte", BenchKind_Throughput, fsSetup, fsReadStdio, fsTeardown },
+);
@@ -0,0 +1,94 @@
+#include <stdlib.h>
+
+#include "bench.h"
+#include "swraster.h"
+
+// Software drawing with the swraster helpers, into a 1280x720 surface in memory rather than the display, so that
+// the console of the runner stays on screen and presenting doesn't wait for vsync. One repetition draws 10 frames.
+
+#define GFX_WIDTH 1280
+#define GFX_HEIGHT 720
+#define GFX_FRAMES 10
+#define GFX_SPRITE 64
+
+typedef struct {
+    SwrSurface surf;
+    u32* sprite;
+    u8* rgb;
+} GfxContext;
+
+static Result gfxSetup(void** ctx)
+{
+    GfxContext* g = (GfxContext*)calloc(1, sizeof(GfxContext));
+    if (!g)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+
+    g->surf.pixels = (u32*)aligned_alloc(64, GFX_WIDTH * GFX_HEIGHT * sizeof(u32));
+    g->sprite = (u32*)aligned_alloc(64, GFX_SPRITE * GFX_SPRITE * sizeof(u32));
+    g->rgb = (u8*)malloc(GFX_WIDTH * GFX_HEIGHT * 3);
+    if (!g->surf.pixels || !g->sprite || !g->rgb) {
+        free(g->surf.pixels);
+        free(g->sprite);
+        free(g->rgb);
+        free(g);
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    }
+    g->surf.stride = g->surf.width = GFX_WIDTH;
+    g->surf.height = GFX_HEIGHT;
+
+    // Half transparent, so that blending can't take the opaque shortcut
+    for (u32 i = 0; i < GFX_SPRITE * GFX_SPRITE; i++)
+        g->sprite[i] = RGBA8(i & 0xFF, (i >> 4) & 0xFF, 0x80, 0x80);
+    for (u32 i = 0; i < GFX_WIDTH * GFX_HEIGHT * 3; i++)
+        g->rgb[i] = (u8)i;
+
+    *ctx = g;
+    return 0;
+}
+
+static void gfxTeardown(void* ctx)
+{
+    GfxContext* g = (GfxContext*)ctx;
+    free(g->surf.pixels);
+    free(g->sprite);
+    free(g->rgb);
+    free(g);
+}
+
+static u64 gfxFill(void* ctx)
+{
+    GfxContext* g = (GfxContext*)ctx;
+    for (u32 f = 0; f < GFX_FRAMES; f++)
+        swrFill(&g->surf, RGBA8_MAXALPHA(f, 0x10, 0x10));
+    return (u64)GFX_FRAMES * GFX_WIDTH * GFX_HEIGHT;
+}
+
+static u64 gfxBlendSprites(void* ctx)
+{
+    GfxContext* g = (GfxContext*)ctx;
+    // Covers the whole surface with sprites, each one a little off the grid so that rows aren't aligned
+    u32 count = 0;
+    for (u32 f = 0; f < GFX_FRAMES; f++) {
+        for (s32 y = 0; y < GFX_HEIGHT; y += GFX_SPRITE) {
+            for (s32 x = 0; x < GFX_WIDTH; x += GFX_SPRITE) {
+                swrBlendBlit(&g->surf, x + (f & 3), y, g->sprite, GFX_SPRITE, GFX_SPRITE, GFX_SPRITE);
+                count++;
+            }
+        }
+    }
+    return (u64)count * GFX_SPRITE * GFX_SPRITE;
+}
+
+static u64 gfxConvertRGB(void* ctx)
+{
+    GfxContext* g = (GfxContext*)ctx;
+    for (u32 f = 0; f < GFX_FRAMES; f++)
+        swrBlitRGB888(&g->surf, 0, 0, g->rgb, GFX_WIDTH * 3, GFX_WIDTH, GFX_HEIGHT);
+    return (u64)GFX_FRAMES * GFX_WIDTH * GFX_HEIGHT;
+}
+
+BENCH_SUITE(g_graphicsBenches,
+    { "graphics", "fill", "pixel", BenchKind_Throughput, gfxSetup, gfxFill, gfxTeardown },
+    { "graphics", "blend_sprites_64", "pixel", BenchKind_Throughput, gfxSetup, gfxBlendSprites, gfxTeardown },
+    { "graphics", "blit_rgb888", "pixel", BenchKind_Throughput, gfxSetup, gfxConvertRGB, gfxTeardown },
+);
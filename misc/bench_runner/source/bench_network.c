@@ -0,0 +1,161 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#include "bench.h"
+
+// The socket stack, over TCP on the loopback interface so that no network is needed and the numbers don't depend on
+// the access point: bulk throughput with 64 KiB sends, drained by a thread on core 1, and the round trip of a small
+// message echoed by that thread, with Nagle's algorithm off. Sockets are initialized by the runner.
+
+#define NET_STREAM_SIZE (8 * 1024 * 1024)
+#define NET_CHUNK 0x10000
+#define NET_ECHO_ROUNDS 500
+#define NET_ECHO_SIZE 64
+
+typedef struct {
+    int client, server;
+    Thread thread;
+    UEvent done;              // The receiver got a whole stream
+    u8* buffer;
+} NetContext;
+
+static void streamReceiver(void* arg)
+{
+    NetContext* n = (NetContext*)arg;
+    u8* buf = (u8*)malloc(NET_CHUNK);
+    u64 received = 0;
+    ssize_t len;
+    while (buf && (len = recv(n->server, buf, NET_CHUNK, 0)) > 0) {
+        received += len;
+        if (received >= NET_STREAM_SIZE) {
+            received -= NET_STREAM_SIZE;
+            ueventSignal(&n->done);
+        }
+    }
+    free(buf);
+}
+
+static void echoServer(void* arg)
+{
+    NetContext* n = (NetContext*)arg;
+    u8 msg[NET_ECHO_SIZE];
+    while (recv(n->server, msg, sizeof(msg), MSG_WAITALL) == sizeof(msg)) {
+        if (send(n->server, msg, sizeof(msg), 0) != sizeof(msg))
+            break;
+    }
+}
+
+static void netTeardown(void* ctx)
+{
+    NetContext* n = (NetContext*)ctx;
+    // Closing the client ends the server thread's recv
+    if (n->client >= 0)
+        close(n->client);
+    if (n->thread.handle) {
+        threadWaitForExit(&n->thread);
+        threadClose(&n->thread);
+    }
+    if (n->server >= 0)
+        close(n->server);
+    free(n->buffer);
+    free(n);
+}
+
+static Result netConnect(void** ctx, ThreadFunc serverFunc)
+{
+    NetContext* n = (NetContext*)calloc(1, sizeof(NetContext));
+    if (!n)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    n->client = n->server = -1;
+    ueventCreate(&n->done, true);
+    n->buffer = (u8*)malloc(NET_CHUNK);
+
+    struct sockaddr_in addr = {0};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addrlen = sizeof(addr);
+
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    bool ok = n->buffer && listener >= 0
+        && bind(listener, (struct sockaddr*)&addr, sizeof(addr)) == 0
+        && listen(listener, 1) == 0
+        && getsockname(listener, (struct sockaddr*)&addr, &addrlen) == 0;
+    if (ok) {
+        n->client = socket(AF_INET, SOCK_STREAM, 0);
+        ok = n->client >= 0 && connect(n->client, (struct sockaddr*)&addr, sizeof(addr)) == 0;
+    }
+    if (ok) {
+        n->server = accept(listener, NULL, NULL);
+        ok = n->server >= 0;
+    }
+    if (listener >= 0)
+        close(listener);
+
+    if (ok) {
+        int one = 1;
+        setsockopt(n->client, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        setsockopt(n->server, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+        ok = R_SUCCEEDED(threadCreate(&n->thread, serverFunc, n, NULL, 0x4000, 0x2C, 1));
+        if (ok && R_FAILED(threadStart(&n->thread))) {
+            threadClose(&n->thread);
+            ok = false;
+        }
+        if (!ok)
+            memset(&n->thread, 0, sizeof(n->thread));
+    }
+
+    if (!ok) {
+        netTeardown(n);
+        return MAKERESULT(Module_Libnx, LibnxError_NotInitialized);
+    }
+    *ctx = n;
+    return 0;
+}
+
+static Result streamSetup(void** ctx)
+{
+    return netConnect(ctx, streamReceiver);
+}
+
+static Result echoSetup(void** ctx)
+{
+    return netConnect(ctx, echoServer);
+}
+
+static u64 netStream(void* ctx)
+{
+    NetContext* n = (NetContext*)ctx;
+    for (u32 sent = 0; sent < NET_STREAM_SIZE;) {
+        ssize_t len = send(n->client, n->buffer, NET_CHUNK, 0);
+        if (len <= 0)
+            return 0;
+        sent += len;
+    }
+    // Until it's all been received, not only queued
+    if (R_FAILED(waitSingle(waiterForUEvent(&n->done), 5000000000ULL)))
+        return 0;
+    return NET_STREAM_SIZE;
+}
+
+static u64 netEcho(void* ctx)
+{
+    NetContext* n = (NetContext*)ctx;
+    u8 msg[NET_ECHO_SIZE] = {0};
+    for (u32 i = 0; i < NET_ECHO_ROUNDS; i++) {
+        if (send(n->client, msg, sizeof(msg), 0) != sizeof(msg)
+            || recv(n->client, msg, sizeof(msg), MSG_WAITALL) != sizeof(msg))
+            return 0;
+    }
+    return NET_ECHO_ROUNDS;
+}
+
+BENCH_SUITE(g_networkBenches,
+    { "network", "tcp_loopback_stream_64k", "byte", BenchKind_Throughput, streamSetup, netStream, netTeardown },
+    { "network", "tcp_loopback_echo_64b", "round trip", BenchKind_Latency, echoSetup, netEcho, netTeardown },
+);
@@ -0,0 +1,124 @@
+#include <stdlib.h>
+
+#include "bench.h"
+#include "perf.h"
+
+// Thread scheduling: the round trip of a UEvent between the runner's thread on core 0 and a thread on core 1, the
+// cost of creating, starting and joining a thread, and the overhead of the libperf job system per small job.
+
+#define PING_ROUNDS 1000
+#define THREAD_ROUNDS 50
+#define JOBS 4096
+
+typedef struct {
+    UEvent ping, pong;
+    Thread thread;
+    bool stop;
+} PingContext;
+
+static void pongFunc(void* arg)
+{
+    PingContext* p = (PingContext*)arg;
+    for (;;) {
+        waitSingle(waiterForUEvent(&p->ping), UINT64_MAX);
+        if (__atomic_load_n(&p->stop, __ATOMIC_ACQUIRE))
+            break;
+        ueventSignal(&p->pong);
+    }
+}
+
+static Result pingSetup(void** ctx)
+{
+    PingContext* p = (PingContext*)calloc(1, sizeof(PingContext));
+    if (!p)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    ueventCreate(&p->ping, true);
+    ueventCreate(&p->pong, true);
+
+    Result rc = threadCreate(&p->thread, pongFunc, p, NULL, 0x4000, 0x2C, 1);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&p->thread);
+        if (R_FAILED(rc))
+            threadClose(&p->thread);
+    }
+    if (R_FAILED(rc)) {
+        free(p);
+        return rc;
+    }
+    *ctx = p;
+    return 0;
+}
+
+static void pingTeardown(void* ctx)
+{
+    PingContext* p = (PingContext*)ctx;
+    __atomic_store_n(&p->stop, true, __ATOMIC_RELEASE);
+    ueventSignal(&p->ping);
+    threadWaitForExit(&p->thread);
+    threadClose(&p->thread);
+    free(p);
+}
+
+static u64 pingRoundTrips(void* ctx)
+{
+    PingContext* p = (PingContext*)ctx;
+    for (u32 i = 0; i < PING_ROUNDS; i++) {
+        ueventSignal(&p->ping);
+        waitSingle(waiterForUEvent(&p->pong), UINT64_MAX);
+    }
+    return PING_ROUNDS;
+}
+
+static void emptyThread(void* arg)
+{
+}
+
+static u64 threadLifetimes(void* ctx)
+{
+    for (u32 i = 0; i < THREAD_ROUNDS; i++) {
+        Thread t;
+        if (R_FAILED(threadCreate(&t, emptyThread, NULL, NULL, 0x4000, 0x2C, 1)))
+            return 0;
+        if (R_SUCCEEDED(threadStart(&t)))
+            threadWaitForExit(&t);
+        threadClose(&t);
+    }
+    return THREAD_ROUNDS;
+}
+
+static Result jobsSetup(void** ctx)
+{
+    *ctx = NULL;
+    return jobSystemInit();
+}
+
+static void jobsTeardown(void* ctx)
+{
+    jobSystemExit();
+}
+
+static void smallJob(void* arg)
+{
+    u64* out = (u64*)arg;
+    u64 x = *out;
+    for (u32 i = 0; i < 64; i++)
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    *out = x;
+}
+
+static u64 jobsRun(void* ctx)
+{
+    static u64 values[JOBS];
+    JobCounter counter = {0};
+    for (u32 i = 0; i < JOBS; i++)
+        jobRun(smallJob, &values[i], &counter);
+    jobWait(&counter);
+    g_benchSink = values[JOBS - 1];
+    return JOBS;
+}
+
+BENCH_SUITE(g_threadBenches,
+    { "threads", "uevent_round_trip_core0_core1", "round trip", BenchKind_Latency, pingSetup, pingRoundTrips, pingTeardown },
+    { "threads", "create_start_join", "thread", BenchKind_Latency, NULL, threadLifetimes, NULL },
+    { "threads", "job_run_and_wait", "job", BenchKind_Latency, jobsSetup, jobsRun, jobsTeardown },
+);
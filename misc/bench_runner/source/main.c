@@ -0,0 +1,237 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <switch.h>
+
+#include "bench.h"
+#include "perf.h"
+
+// This example runs the benchmarks of each subsystem in sequence (software drawing, console output, audio mixing,
+// SD card I/O, thread scheduling, loopback networking), and writes all the results to a single JSON report, along
+// with what they depend on: the operation mode (handheld or docked), the performance mode and the clock rates, and
+// the firmware version. Reports from different releases, run on the same hardware in the same mode, can be compared
+// to spot regressions.
+//
+// Each benchmark runs BENCH_WARMUP_RUNS times unmeasured (caches, page faults, lazy initialization), then up to
+// BENCH_RUNS times measured, stopping after BENCH_MIN_RUNS once it has taken BENCH_MAX_NS. The report has every
+// measured run; the median is what the console shows, being the least sensitive to a preemption by the system.
+//
+// To add a benchmark, add it to one of the bench_*.c files, or add a file with its own BENCH_SUITE to g_suites.
+
+#define REPORT_PATH "sdmc:/bench_runner.json"
+#define BENCH_WARMUP_RUNS 2
+#define BENCH_RUNS 15
+#define BENCH_MIN_RUNS 3
+#define BENCH_MAX_NS 5000000000ULL
+
+static const BenchSuite* const g_suites[] = {
+    &g_graphicsBenches,
+    &g_consoleBenches,
+    &g_audioBenches,
+    &g_fsBenches,
+    &g_threadBenches,
+    &g_networkBenches,
+};
+
+PrintConsole* g_runnerConsole;
+volatile u64 g_benchSink;
+
+typedef struct {
+    u32 cpu_hz, gpu_hz, emc_hz;
+} ClockRates;
+
+static u32 readClock(PcvModuleId id, PcvModule module)
+{
+    // pcv was replaced by clkrst for this in 8.0.0
+    u32 hz = 0;
+    if (hosversionAtLeast(8,0,0)) {
+        ClkrstSession session;
+        if (R_SUCCEEDED(clkrstOpenSession(&session, id, 3))) {
+            clkrstGetClockRate(&session, &hz);
+            clkrstCloseSession(&session);
+        }
+    }
+    else
+        pcvGetClockRate(module, &hz);
+    return hz;
+}
+
+static void readClocks(ClockRates* clocks)
+{
+    bool clkrst = hosversionAtLeast(8,0,0);
+    Result rc = clkrst ? clkrstInitialize() : pcvInitialize();
+    if (R_FAILED(rc)) {
+        // Not all launchers give access to these services: the rates are reported as null
+        clocks->cpu_hz = clocks->gpu_hz = clocks->emc_hz = 0;
+        return;
+    }
+
+    clocks->cpu_hz = readClock(PcvModuleId_CpuBus, PcvModule_CpuBus);
+    clocks->gpu_hz = readClock(PcvModuleId_GPU, PcvModule_GPU);
+    clocks->emc_hz = readClock(PcvModuleId_EMC, PcvModule_EMC);
+
+    if (clkrst)
+        clkrstExit();
+    else
+        pcvExit();
+}
+
+static int compareDoubles(const void* a, const void* b)
+{
+    double x = *(const double*)a, y = *(const double*)b;
+    return x < y ? -1 : x > y;
+}
+
+static void writeClock(FILE* f, const char* name, u32 hz, bool last)
+{
+    if (hz)
+        fprintf(f, "      \"%s\": %u%s\n", name, hz, last ? "" : ",");
+    else
+        fprintf(f, "      \"%s\": null%s\n", name, last ? "" : ",");
+}
+
+static void writeDevice(FILE* f, const ClockRates* clocks)
+{
+    u32 hos = hosversionGet();
+    fprintf(f, "  \"device\": {\n");
+    fprintf(f, "    \"firmware\": \"%u.%u.%u\",\n", HOSVER_MAJOR(hos), HOSVER_MINOR(hos), HOSVER_MICRO(hos));
+    fprintf(f, "    \"operation_mode\": \"%s\",\n",
+        appletGetOperationMode() == AppletOperationMode_Docked ? "docked" : "handheld");
+    fprintf(f, "    \"performance_mode\": \"%s\",\n", appletGetPerformanceMode() == 1 ? "boost" : "normal");
+    fprintf(f, "    \"tick_freq\": %lu,\n", armGetSystemTickFreq());
+    fprintf(f, "    \"clocks_hz\": {\n");
+    writeClock(f, "cpu", clocks->cpu_hz, false);
+    writeClock(f, "gpu", clocks->gpu_hz, false);
+    writeClock(f, "emc", clocks->emc_hz, true);
+    fprintf(f, "    }\n");
+    fprintf(f, "  },\n");
+}
+
+// Runs a benchmark, prints its median, and appends its entry to the report
+static void runBench(FILE* f, const Bench* b, bool first)
+{
+    bool throughput = b->kind == BenchKind_Throughput;
+    const char* unit = throughput ? "M/s" : "ns";
+
+    printf("%-9s %-32s ", b->suite, b->name);
+    consoleUpdate(NULL);
+
+    if (f) {
+        char full_unit[32];
+        if (throughput)
+            snprintf(full_unit, sizeof(full_unit), "M%s/s", b->unit);
+        else
+            snprintf(full_unit, sizeof(full_unit), "ns/%s", b->unit);
+        fprintf(f, "%s    {\"suite\": \"%s\", \"name\": \"%s\", \"unit\": \"%s\"",
+            first ? "" : ",\n", b->suite, b->name, full_unit);
+    }
+
+    void* ctx = NULL;
+    Result rc = b->setup ? b->setup(&ctx) : 0;
+    if (R_FAILED(rc)) {
+        printf("skipped (0x%x)\n", rc);
+        if (f)
+            fprintf(f, ", \"skipped\": \"0x%x\"}", rc);
+        return;
+    }
+
+    double values[BENCH_RUNS];
+    u32 runs = 0;
+    bool failed = false;
+    u64 total = 0;
+
+    for (u32 i = 0; i < BENCH_WARMUP_RUNS && !failed; i++)
+        failed = b->run(ctx) == 0;
+
+    while (!failed && runs < BENCH_RUNS && (runs < BENCH_MIN_RUNS || total < BENCH_MAX_NS)) {
+        u64 start = armGetSystemTick();
+        u64 work = b->run(ctx);
+        u64 ns = timingTicksToNs(armGetSystemTick() - start);
+        if (work == 0) {
+            failed = true;
+            break;
+        }
+        total += ns;
+        values[runs++] = throughput ? (double)work * 1e3 / ns : (double)ns / work;
+    }
+
+    if (b->teardown)
+        b->teardown(ctx);
+
+    if (failed) {
+        printf("failed\n");
+        if (f)
+            fprintf(f, ", \"failed\": true}");
+        return;
+    }
+
+    if (f) {
+        fprintf(f, ", \"runs\": [");
+        for (u32 i = 0; i < runs; i++)
+            fprintf(f, "%s%.4f", i ? ", " : "", values[i]);
+        fprintf(f, "]");
+    }
+
+    qsort(values, runs, sizeof(double), compareDoubles);
+    double median = runs & 1 ? values[runs / 2] : (values[runs / 2 - 1] + values[runs / 2]) / 2;
+    printf("%10.3f %-3s (%u runs)\n", median, unit, runs);
+    if (f)
+        fprintf(f, ", \"min\": %.4f, \"median\": %.4f, \"max\": %.4f}", values[0], median, values[runs - 1]);
+}
+
+int main(int argc, char* argv[])
+{
+    g_runnerConsole = consoleInit(NULL);
+    timingInit();
+    // Without sockets, the network benchmarks fail their setup and are reported as skipped
+    Result rc_net = socketInitializeDefault();
+
+    ClockRates clocks;
+    readClocks(&clocks);
+
+    printf("Benchmark runner: %s mode, CPU %u MHz, GPU %u MHz, EMC %u MHz\n\n",
+        appletGetOperationMode() == AppletOperationMode_Docked ? "docked" : "handheld",
+        clocks.cpu_hz / 1000000, clocks.gpu_hz / 1000000, clocks.emc_hz / 1000000);
+    consoleUpdate(NULL);
+
+    FILE* f = fopen(REPORT_PATH, "w");
+    if (f) {
+        fprintf(f, "{\n");
+        fprintf(f, "  \"version\": 1,\n");
+        fprintf(f, "  \"built\": \"%s %s\",\n", __DATE__, __TIME__);
+        fprintf(f, "  \"time\": %ld,\n", (long)time(NULL));
+        writeDevice(f, &clocks);
+        fprintf(f, "  \"warmup_runs\": %u,\n", BENCH_WARMUP_RUNS);
+        fprintf(f, "  \"results\": [\n");
+    }
+    else
+        printf("Couldn't open %s, results are only shown\n\n", REPORT_PATH);
+
+    bool first = true;
+    for (u32 s = 0; s < sizeof(g_suites) / sizeof(g_suites[0]); s++) {
+        for (u32 i = 0; i < g_suites[s]->count; i++) {
+            runBench(f, &g_suites[s]->benches[i], first);
+            first = false;
+        }
+    }
+
+    if (f) {
+        fprintf(f, "\n  ]\n}\n");
+        fclose(f);
+        printf("\nReport written to %s\n", REPORT_PATH);
+    }
+
+    printf("Press PLUS to exit\n");
+    while (appletMainLoop())
+    {
+        hidScanInput();
+        if (hidKeysDown(CONTROLLER_P1_AUTO) & KEY_PLUS)
+            break;
+        consoleUpdate(NULL);
+    }
+
+    if (R_SUCCEEDED(rc_net))
+        socketExit();
+    consoleExit(NULL);
+    return 0;
+}
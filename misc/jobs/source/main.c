@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <math.h>
+#include <switch.h>
+
+#include "job_system.h"
+
+// This example runs the same made-up frame update twice: once split evenly between one thread per core which wait
+// for each other with a barrier after each phase, like the barrier example, and once with the job system (see
+// job_system.h). The cost of the items is uneven, a few of them cost much more than the others, so with the barrier
+// the threads which got the cheap items wait for the one which got the expensive ones.
+
+#define NUM_ITEMS 16384
+#define NUM_PHASES 3
+#define NUM_FRAMES 30
+#define NUM_SKELETONS 24
+#define MAX_THREADS 4
+
+static float g_Data[NUM_ITEMS];
+
+// The items near the start of the array, and every 64th, cost 40 times more
+static void updateItem(u32 phase, u32 i)
+{
+    u32 steps = (i < NUM_ITEMS / 8 || (i & 63) == 0) ? 400 : 10;
+    float x = g_Data[i];
+    for (u32 s = 0; s < steps; s++)
+        x = sinf(x + phase) * 0.5f + 0.5f;
+    g_Data[i] = x;
+}
+
+//---------------------------------------------------------------------------------
+// Barrier version
+//---------------------------------------------------------------------------------
+static Barrier g_Barrier;
+static u32 g_NumThreads;
+
+static void runSlice(u32 index)
+{
+    u32 begin = NUM_ITEMS * index / g_NumThreads;
+    u32 end = NUM_ITEMS * (index + 1) / g_NumThreads;
+    for (u32 frame = 0; frame < NUM_FRAMES; frame++) {
+        for (u32 phase = 0; phase < NUM_PHASES; phase++) {
+            for (u32 i = begin; i < end; i++)
+                updateItem(phase, i);
+            barrierWait(&g_Barrier);
+        }
+    }
+}
+
+static void sliceThreadFunc(void* arg)
+{
+    runSlice((u32)(uintptr_t)arg);
+}
+
+static u64 runWithBarrier(void)
+{
+    static Thread thread[MAX_THREADS];
+    u32 numStarted = 1;
+    Result rc = 0;
+
+    // Same cores as the job system's workers, this thread does the first slice
+    g_NumThreads = jobSystemGetNumWorkers();
+    barrierInit(&g_Barrier, g_NumThreads);
+    for (u32 i = 1; i < g_NumThreads; i++) {
+        rc = threadCreate(&thread[i], sliceThreadFunc, (void*)(uintptr_t)i, NULL, 0x10000, 0x2C, (svcGetCurrentProcessorNumber() + i) % 3);
+        if (R_SUCCEEDED(rc)) {
+            rc = threadStart(&thread[i]);
+            if (R_FAILED(rc))
+                threadClose(&thread[i]);
+        }
+        if (R_FAILED(rc))
+            break;
+        numStarted++;
+    }
+    if (R_FAILED(rc)) {
+        // The started threads are waiting for the others at the barrier, which never come
+        printf("threadCreate failed: 0x%x\n", rc);
+        return 0;
+    }
+
+    u64 start = armGetSystemTick();
+    runSlice(0);
+    u64 ticks = armGetSystemTick() - start;
+
+    for (u32 i = 1; i < numStarted; i++) {
+        threadWaitForExit(&thread[i]);
+        threadClose(&thread[i]);
+    }
+    return ticks;
+}
+
+//---------------------------------------------------------------------------------
+// Job version
+//---------------------------------------------------------------------------------
+typedef struct {
+    u32 phase;
+    u32 begin, end;
+} Range;
+
+static void updateRange(void* arg, u32 begin, u32 end)
+{
+    Range* r = (Range*)arg;
+    for (u32 i = r->begin + begin; i < r->begin + end; i++)
+        updateItem(r->phase, i);
+}
+
+// A parent job: each skeleton splits its own bones into child jobs, and waits for them without blocking its worker
+static void updateSkeleton(void* arg)
+{
+    Range* r = (Range*)arg;
+    jobParallelFor(r->end - r->begin, 32, updateRange, r);
+}
+
+static u64 runWithJobs(void)
+{
+    u64 start = armGetSystemTick();
+    for (u32 frame = 0; frame < NUM_FRAMES; frame++) {
+        for (u32 phase = 0; phase < NUM_PHASES - 1; phase++) {
+            Range all = { phase, 0, NUM_ITEMS };
+            jobParallelFor(NUM_ITEMS, 64, updateRange, &all);
+        }
+
+        // The last phase as jobs which create jobs
+        static Range skeletons[NUM_SKELETONS];
+        JobCounter counter = { 0 };
+        for (u32 s = 0; s < NUM_SKELETONS; s++) {
+            skeletons[s] = (Range){ NUM_PHASES - 1, NUM_ITEMS * s / NUM_SKELETONS, NUM_ITEMS * (s + 1) / NUM_SKELETONS };
+            jobRun(updateSkeleton, &skeletons[s], &counter);
+        }
+        jobWait(&counter);
+    }
+    return armGetSystemTick() - start;
+}
+
+static void runBoth(void)
+{
+    for (u32 i = 0; i < NUM_ITEMS; i++)
+        g_Data[i] = i * 0.001f;
+
+    printf("Running %u frames of %u phases of %u items...\n", NUM_FRAMES, NUM_PHASES, NUM_ITEMS);
+    consoleUpdate(NULL);
+    u64 barrierTicks = runWithBarrier();
+    u64 jobTicks = runWithJobs();
+    printf("barrier: %.2f ms per frame\n", armTicksToNs(barrierTicks) / 1000000.0 / NUM_FRAMES);
+    printf("jobs:    %.2f ms per frame\n\n", armTicksToNs(jobTicks) / 1000000.0 / NUM_FRAMES);
+}
+
+int main(int argc, char **argv)
+{
+    consoleInit(NULL);
+
+    Result rc = jobSystemInit();
+    if (R_FAILED(rc))
+        printf("jobSystemInit failed: 0x%x\n", rc);
+    else {
+        printf("Job system started, %u workers\n", jobSystemGetNumWorkers());
+        printf("Press A to run again, + to exit\n\n");
+        runBoth();
+    }
+
+    while(appletMainLoop())
+    {
+        hidScanInput();
+
+        u32 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+
+        if (kDown & KEY_PLUS)
+            break;
+
+        if ((kDown & KEY_A) && R_SUCCEEDED(rc))
+            runBoth();
+
+        consoleUpdate(NULL);
+    }
+
+    if (R_SUCCEEDED(rc))
+        jobSystemExit();
+    consoleExit(NULL);
+    return 0;
+}
@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <switch.h>
+
+#include "perf.h"
+
+// This example links libperf (build it first with make in templates/library/) and measures its primitives against
+// what they replace:
+//  - SpscQueue and MpscQueue with one producer thread and one consumer thread, on two cores,
+//  - Pool and Arena against malloc and free,
+//  - jobRun against running the same small functions inline.
+// Times are read with armGetSystemTick, and converted with timing.h.
+
+#define QUEUE_ITEMS (1 << 20)
+#define QUEUE_CAPACITY 1024
+#define POOL_OBJECTS 256
+#define POOL_ROUNDS 2000
+#define ARENA_ALLOCS 1000
+#define ARENA_ROUNDS 200
+#define JOBS 4096
+
+static volatile u64 g_Sink;
+
+static void report(const char* name, u64 ticks, u64 ops)
+{
+    printf("%-36s %8.2f ns/op\n", name, (double)timingTicksToNs(ticks) / ops);
+    consoleUpdate(NULL);
+}
+
+static Result startThread(Thread* t, ThreadFunc func, void* arg, int prio, int core)
+{
+    Result rc = threadCreate(t, func, arg, NULL, 0x10000, prio, core);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(t);
+        if (R_FAILED(rc))
+            threadClose(t);
+    }
+    return rc;
+}
+
+//---------------------------------------------------------------------------------
+// Queues
+//---------------------------------------------------------------------------------
+static void spscProducer(void* arg)
+{
+    SpscQueue* q = (SpscQueue*)arg;
+    for (u32 i = 0; i < QUEUE_ITEMS; i++) {
+        while (!spscQueuePush(q, &i))
+            ;
+    }
+}
+
+static void mpscProducer(void* arg)
+{
+    MpscQueue* q = (MpscQueue*)arg;
+    for (u32 i = 0; i < QUEUE_ITEMS; i++) {
+        while (!mpscQueuePush(q, &i))
+            ;
+    }
+}
+
+static void benchQueues(void)
+{
+    u32 batch[64];
+    Thread thread;
+
+    SpscQueue spsc;
+    if (R_SUCCEEDED(spscQueueCreate(&spsc, QUEUE_CAPACITY, sizeof(u32)))) {
+        u64 start = armGetSystemTick(), sum = 0;
+        if (R_SUCCEEDED(startThread(&thread, spscProducer, &spsc, 0x2C, 1))) {
+            for (u32 received = 0; received < QUEUE_ITEMS;) {
+                u32 n = spscQueuePop(&spsc, batch, 64);
+                for (u32 i = 0; i < n; i++)
+                    sum += batch[i];
+                received += n;
+            }
+            report("SpscQueue push+pop", armGetSystemTick() - start, QUEUE_ITEMS);
+            threadWaitForExit(&thread);
+            threadClose(&thread);
+        }
+        g_Sink = sum;
+        spscQueueClose(&spsc);
+    }
+
+    MpscQueue mpsc;
+    if (R_SUCCEEDED(mpscQueueCreate(&mpsc, QUEUE_CAPACITY, sizeof(u32)))) {
+        u64 start = armGetSystemTick(), sum = 0;
+        if (R_SUCCEEDED(startThread(&thread, mpscProducer, &mpsc, 0x2C, 1))) {
+            for (u32 received = 0; received < QUEUE_ITEMS;) {
+                u32 n = mpscQueuePop(&mpsc, batch, 64);
+                for (u32 i = 0; i < n; i++)
+                    sum += batch[i];
+                received += n;
+            }
+            report("MpscQueue push+pop (1 producer)", armGetSystemTick() - start, QUEUE_ITEMS);
+            threadWaitForExit(&thread);
+            threadClose(&thread);
+        }
+        g_Sink = sum;
+        mpscQueueClose(&mpsc);
+    }
+}
+
+//---------------------------------------------------------------------------------
+// Allocators
+//---------------------------------------------------------------------------------
+static void benchAllocators(void)
+{
+    static void* objects[POOL_OBJECTS];
+
+    Pool pool;
+    if (R_SUCCEEDED(poolCreate(&pool, 64, POOL_OBJECTS))) {
+        u64 start = armGetSystemTick();
+        for (u32 round = 0; round < POOL_ROUNDS; round++) {
+            for (u32 i = 0; i < POOL_OBJECTS; i++)
+                objects[i] = poolAlloc(&pool);
+            // In another order than allocated, as objects usually die
+            for (u32 i = 0; i < POOL_OBJECTS; i++)
+                poolFree(&pool, objects[(i * 97) % POOL_OBJECTS]);
+        }
+        report("Pool alloc+free (64 bytes)", armGetSystemTick() - start, POOL_ROUNDS * POOL_OBJECTS);
+        poolClose(&pool);
+    }
+
+    u64 start = armGetSystemTick();
+    for (u32 round = 0; round < POOL_ROUNDS; round++) {
+        for (u32 i = 0; i < POOL_OBJECTS; i++)
+            objects[i] = malloc(64);
+        for (u32 i = 0; i < POOL_OBJECTS; i++)
+            free(objects[(i * 97) % POOL_OBJECTS]);
+    }
+    report("malloc+free (64 bytes)", armGetSystemTick() - start, POOL_ROUNDS * POOL_OBJECTS);
+
+    static void* allocs[ARENA_ALLOCS];
+    Arena arena;
+    if (R_SUCCEEDED(arenaCreate(&arena, ARENA_ALLOCS * 64))) {
+        start = armGetSystemTick();
+        for (u32 round = 0; round < ARENA_ROUNDS; round++) {
+            for (u32 i = 0; i < ARENA_ALLOCS; i++)
+                allocs[i] = arenaAlloc(&arena, 16 + (i & 31), 16);
+            g_Sink = (u64)(uintptr_t)allocs[ARENA_ALLOCS - 1];
+            arenaReset(&arena);
+        }
+        report("Arena alloc, reset per round", armGetSystemTick() - start, ARENA_ROUNDS * ARENA_ALLOCS);
+        arenaClose(&arena);
+    }
+
+    start = armGetSystemTick();
+    for (u32 round = 0; round < ARENA_ROUNDS; round++) {
+        for (u32 i = 0; i < ARENA_ALLOCS; i++)
+            allocs[i] = malloc(16 + (i & 31));
+        for (u32 i = 0; i < ARENA_ALLOCS; i++)
+            free(allocs[i]);
+    }
+    report("malloc+free, same sizes", armGetSystemTick() - start, ARENA_ROUNDS * ARENA_ALLOCS);
+}
+
+//---------------------------------------------------------------------------------
+// Jobs
+//---------------------------------------------------------------------------------
+static void smallJob(void* arg)
+{
+    u64* out = (u64*)arg;
+    u64 x = *out;
+    for (u32 i = 0; i < 64; i++)
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    *out = x;
+}
+
+static void benchJobs(void)
+{
+    static u64 values[JOBS];
+
+    u64 start = armGetSystemTick();
+    for (u32 i = 0; i < JOBS; i++)
+        smallJob(&values[i]);
+    report("Small function, inline", armGetSystemTick() - start, JOBS);
+
+    if (R_FAILED(jobSystemInit()))
+        return;
+    JobCounter counter = {0};
+    start = armGetSystemTick();
+    for (u32 i = 0; i < JOBS; i++)
+        jobRun(smallJob, &values[i], &counter);
+    jobWait(&counter);
+    char name[48];
+    snprintf(name, sizeof(name), "Small function, jobRun (%u workers)", jobSystemGetNumWorkers());
+    report(name, armGetSystemTick() - start, JOBS);
+    jobSystemExit();
+}
+
+int main(int argc, char* argv[])
+{
+    consoleInit(NULL);
+    timingInit();
+
+    printf("libperf benchmarks\n\n");
+    consoleUpdate(NULL);
+
+    benchQueues();
+    benchAllocators();
+    benchJobs();
+
+    printf("\nPress PLUS to exit\n");
+    while (appletMainLoop())
+    {
+        hidScanInput();
+        if (hidKeysDown(CONTROLLER_P1_AUTO) & KEY_PLUS)
+            break;
+        consoleUpdate(NULL);
+    }
+
+    consoleExit(NULL);
+    return 0;
+}
@@ -0,0 +1,463 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <switch.h>
+
+#include "perf.h"
+
+// This example links libperf (build it first with make in templates/library/) and checks the behaviour of its
+// primitives:
+//  - SpscQueue and MpscQueue keep the order of each producer, report full and empty, and wrap around,
+//  - Pool runs out at its capacity and hands freed objects out again,
+//  - Arena aligns, runs out at its size, and frees back to a mark or entirely,
+//  - jobWait returns once every job added to its counter has run, and jobParallelFor covers its range once.
+// Each case prints PASS or FAIL, along with the first check which failed, and main returns non-zero if any case
+// failed, so a run from nxlink reports it through the exit code. misc/perf_bench has the timings.
+
+#define THREAD_ITEMS (1 << 16)
+#define THREAD_CAPACITY 64
+#define MPSC_PRODUCERS 3
+#define POOL_OBJECTS 32
+#define JOBS 1000
+#define PARALLEL_ITEMS 10000
+
+#define EXPECT(cond) do { \
+        if (!(cond)) { \
+            printf("  line %d: %s\n", __LINE__, #cond); \
+            return false; \
+        } \
+    } while (0)
+
+static Result startThread(Thread* t, ThreadFunc func, void* arg, int prio, int core)
+{
+    Result rc = threadCreate(t, func, arg, NULL, 0x10000, prio, core);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(t);
+        if (R_FAILED(rc))
+            threadClose(t);
+    }
+    return rc;
+}
+
+//---------------------------------------------------------------------------------
+// Queues
+//---------------------------------------------------------------------------------
+static bool spscFullEmpty(SpscQueue* q)
+{
+    u32 out[8];
+    EXPECT(spscQueuePop(q, out, 8) == 0);
+
+    // Several laps, so that the indices wrap around the buffer
+    u32 next = 0, expected = 0;
+    for (u32 lap = 0; lap < 5; lap++) {
+        for (u32 i = 0; i < 8; i++, next++)
+            EXPECT(spscQueuePush(q, &next));
+        EXPECT(!spscQueuePush(q, &next));
+
+        // Partly drained, there's room for as many elements as were popped
+        EXPECT(spscQueuePop(q, out, 3) == 3);
+        for (u32 i = 0; i < 3; i++)
+            EXPECT(out[i] == expected++);
+        for (u32 i = 0; i < 3; i++, next++)
+            EXPECT(spscQueuePush(q, &next));
+        EXPECT(!spscQueuePush(q, &next));
+
+        EXPECT(spscQueuePop(q, out, 8) == 8);
+        for (u32 i = 0; i < 8; i++)
+            EXPECT(out[i] == expected++);
+        EXPECT(spscQueuePop(q, out, 8) == 0);
+    }
+    return true;
+}
+
+static bool testSpscFullEmpty(void)
+{
+    SpscQueue q;
+    EXPECT(R_SUCCEEDED(spscQueueCreate(&q, 8, sizeof(u32))));
+    bool ok = spscFullEmpty(&q);
+    spscQueueClose(&q);
+    return ok;
+}
+
+static void spscProducer(void* arg)
+{
+    SpscQueue* q = (SpscQueue*)arg;
+    for (u32 i = 0; i < THREAD_ITEMS; i++) {
+        while (!spscQueuePush(q, &i))
+            ;
+    }
+}
+
+static bool spscOrder(SpscQueue* q)
+{
+    // Everything is popped even after a mismatch, the producer only exits once it pushed it all
+    u32 batch[16], expected = 0, mismatches = 0;
+    for (u32 received = 0; received < THREAD_ITEMS;) {
+        u32 n = spscQueuePop(q, batch, 16);
+        for (u32 i = 0; i < n; i++) {
+            if (batch[i] != expected)
+                mismatches++;
+            expected = batch[i] + 1;
+        }
+        received += n;
+    }
+    EXPECT(mismatches == 0);
+    return true;
+}
+
+static bool testSpscOrder(void)
+{
+    SpscQueue q;
+    Thread thread;
+    EXPECT(R_SUCCEEDED(spscQueueCreate(&q, THREAD_CAPACITY, sizeof(u32))));
+    if (R_FAILED(startThread(&thread, spscProducer, &q, 0x2C, 1))) {
+        spscQueueClose(&q);
+        EXPECT(!"threadCreate");
+    }
+
+    bool ok = spscOrder(&q);
+    threadWaitForExit(&thread);
+    threadClose(&thread);
+    spscQueueClose(&q);
+    return ok;
+}
+
+static bool mpscFullEmpty(MpscQueue* q)
+{
+    u32 out[8];
+    // Empty: the consumer may wait, and the next push wakes it
+    u32 next = 0, expected = 0;
+    EXPECT(mpscQueuePop(q, out, 8) == 0);
+    EXPECT(mpscQueuePrepareWait(q));
+    EXPECT(mpscQueuePush(q, &next));
+    next++;
+    EXPECT(R_SUCCEEDED(waitSingle(mpscQueueWaiter(q), 0)));
+    EXPECT(mpscQueuePop(q, out, 8) == 1 && out[0] == expected++);
+
+    for (u32 lap = 0; lap < 5; lap++) {
+        for (u32 i = 0; i < 8; i++, next++)
+            EXPECT(mpscQueuePush(q, &next));
+        EXPECT(!mpscQueuePush(q, &next));
+        EXPECT(!mpscQueuePrepareWait(q));
+
+        EXPECT(mpscQueuePop(q, out, 3) == 3);
+        for (u32 i = 0; i < 3; i++)
+            EXPECT(out[i] == expected++);
+        for (u32 i = 0; i < 3; i++, next++)
+            EXPECT(mpscQueuePush(q, &next));
+        EXPECT(!mpscQueuePush(q, &next));
+
+        EXPECT(mpscQueuePop(q, out, 8) == 8);
+        for (u32 i = 0; i < 8; i++)
+            EXPECT(out[i] == expected++);
+        EXPECT(mpscQueuePop(q, out, 8) == 0);
+    }
+    return true;
+}
+
+static bool testMpscFullEmpty(void)
+{
+    MpscQueue q;
+    EXPECT(R_SUCCEEDED(mpscQueueCreate(&q, 8, sizeof(u32))));
+    bool ok = mpscFullEmpty(&q);
+    mpscQueueClose(&q);
+    return ok;
+}
+
+typedef struct {
+    MpscQueue* queue;
+    u32 id;
+} MpscProducerArgs;
+
+static void mpscProducer(void* arg)
+{
+    MpscProducerArgs* args = (MpscProducerArgs*)arg;
+    for (u32 i = 0; i < THREAD_ITEMS; i++) {
+        // Producer in the top bits, sequence number in the others
+        u32 elem = (args->id << 24) | i;
+        while (!mpscQueuePush(args->queue, &elem))
+            ;
+    }
+}
+
+static bool mpscOrder(MpscQueue* q)
+{
+    // Producers interleave, but the elements of each of them come out in the order it pushed them.
+    // Everything is popped even after a mismatch, the producers only exit once they pushed it all.
+    u32 batch[16], expected[MPSC_PRODUCERS] = {0}, mismatches = 0;
+    for (u32 received = 0; received < MPSC_PRODUCERS * THREAD_ITEMS;) {
+        u32 n = mpscQueuePop(q, batch, 16);
+        for (u32 i = 0; i < n; i++) {
+            u32 id = batch[i] >> 24, seq = batch[i] & 0xFFFFFF;
+            if (id >= MPSC_PRODUCERS) {
+                mismatches++;
+                continue;
+            }
+            if (seq != expected[id])
+                mismatches++;
+            expected[id] = seq + 1;
+        }
+        received += n;
+    }
+    EXPECT(mismatches == 0);
+    for (u32 id = 0; id < MPSC_PRODUCERS; id++)
+        EXPECT(expected[id] == THREAD_ITEMS);
+    return true;
+}
+
+static bool testMpscOrder(void)
+{
+    MpscQueue q;
+    Thread threads[MPSC_PRODUCERS];
+    MpscProducerArgs args[MPSC_PRODUCERS];
+    EXPECT(R_SUCCEEDED(mpscQueueCreate(&q, THREAD_CAPACITY, sizeof(u32))));
+
+    u32 started = 0;
+    for (; started < MPSC_PRODUCERS; started++) {
+        args[started].queue = &q;
+        args[started].id = started;
+        // On the other cores, so that the producers race for the same slots
+        if (R_FAILED(startThread(&threads[started], mpscProducer, &args[started], 0x2C, started % 2 + 1)))
+            break;
+    }
+
+    bool ok = started == MPSC_PRODUCERS;
+    if (ok) {
+        ok = mpscOrder(&q);
+    }
+    else {
+        // Drain what the producers which did start push, until they're done
+        printf("  threadCreate failed\n");
+        u32 batch[16];
+        for (u32 received = 0; received < started * THREAD_ITEMS;)
+            received += mpscQueuePop(&q, batch, 16);
+    }
+
+    for (u32 i = 0; i < started; i++) {
+        threadWaitForExit(&threads[i]);
+        threadClose(&threads[i]);
+    }
+    mpscQueueClose(&q);
+    return ok;
+}
+
+//---------------------------------------------------------------------------------
+// Allocators
+//---------------------------------------------------------------------------------
+static bool poolExhaustReuse(Pool* p)
+{
+    static u8* objects[POOL_OBJECTS];
+
+    for (u32 i = 0; i < POOL_OBJECTS; i++) {
+        objects[i] = (u8*)poolAlloc(p);
+        EXPECT(objects[i] != NULL);
+        EXPECT(((uintptr_t)objects[i] & (sizeof(void*) - 1)) == 0);
+        // Distinct objects which don't overlap
+        memset(objects[i], i, 24);
+        for (u32 j = 0; j < i; j++)
+            EXPECT(objects[j][0] == (u8)j && objects[j][23] == (u8)j);
+    }
+    EXPECT(p->in_use == POOL_OBJECTS);
+    EXPECT(poolAlloc(p) == NULL);
+
+    // The last object freed is the first one handed out again
+    poolFree(p, objects[5]);
+    poolFree(p, objects[17]);
+    EXPECT(p->in_use == POOL_OBJECTS - 2);
+    EXPECT(poolAlloc(p) == objects[17]);
+    EXPECT(poolAlloc(p) == objects[5]);
+    EXPECT(poolAlloc(p) == NULL);
+
+    // Freeing everything makes all of the objects available again
+    for (u32 i = 0; i < POOL_OBJECTS; i++)
+        poolFree(p, objects[i]);
+    EXPECT(p->in_use == 0);
+    EXPECT(p->peak == POOL_OBJECTS);
+    for (u32 i = 0; i < POOL_OBJECTS; i++)
+        EXPECT(poolAlloc(p) != NULL);
+    EXPECT(poolAlloc(p) == NULL);
+    return true;
+}
+
+static bool testPool(void)
+{
+    Pool p;
+    EXPECT(R_SUCCEEDED(poolCreate(&p, 24, POOL_OBJECTS)));
+    bool ok = poolExhaustReuse(&p);
+    poolClose(&p);
+    return ok;
+}
+
+static bool testArena(void)
+{
+    static u8 mem[256] __attribute__((aligned(64)));
+    Arena a;
+    arenaInit(&a, mem, sizeof(mem));
+
+    u8* first = (u8*)arenaAlloc(&a, 3, 1);
+    EXPECT(first == mem);
+    u8* aligned = (u8*)arenaAlloc(&a, 16, 16);
+    EXPECT(aligned == mem + 16);
+    EXPECT(a.used == 32);
+
+    // Everything allocated after the mark is freed, what was allocated before it stays
+    ArenaMark mark = arenaMark(&a);
+    EXPECT(arenaAlloc(&a, 64, 8) == mem + 32);
+    EXPECT(arenaAlloc(&a, 64, 64) == mem + 128);
+    arenaRewind(&a, mark);
+    EXPECT(a.used == 32);
+    EXPECT(arenaAlloc(&a, 8, 8) == mem + 32);
+    EXPECT(a.peak == 192);
+
+    // Runs out at its size, without moving
+    arenaRewind(&a, mark);
+    EXPECT(arenaAlloc(&a, sizeof(mem) - 31, 1) == NULL);
+    EXPECT(a.used == 32);
+    EXPECT(arenaAlloc(&a, sizeof(mem) - 32, 1) == mem + 32);
+    EXPECT(a.used == sizeof(mem));
+    EXPECT(arenaAlloc(&a, 1, 1) == NULL);
+
+    arenaReset(&a);
+    EXPECT(a.used == 0);
+    EXPECT(arenaAlloc(&a, 8, 8) == mem);
+    arenaClose(&a);
+    return true;
+}
+
+//---------------------------------------------------------------------------------
+// Jobs
+//---------------------------------------------------------------------------------
+static u32 g_JobRuns[JOBS];
+
+static void countJob(void* arg)
+{
+    __atomic_add_fetch((u32*)arg, 1, __ATOMIC_RELAXED);
+}
+
+static void parentJob(void* arg)
+{
+    // Waits on its own counter from within a job, its worker keeps running jobs meanwhile
+    u32* runs = (u32*)arg;
+    JobCounter children = {0};
+    for (u32 i = 0; i < 8; i++)
+        jobRun(countJob, runs, &children);
+    jobWait(&children);
+    if (__atomic_load_n(&children.value, __ATOMIC_ACQUIRE) == 0)
+        __atomic_add_fetch(runs, 1, __ATOMIC_RELAXED);
+}
+
+static bool jobCounters(void)
+{
+    // Each job ran exactly once by the time jobWait returns
+    JobCounter counter = {0};
+    for (u32 i = 0; i < JOBS; i++)
+        jobRun(countJob, &g_JobRuns[i], &counter);
+    jobWait(&counter);
+    EXPECT(counter.value == 0);
+    for (u32 i = 0; i < JOBS; i++)
+        EXPECT(g_JobRuns[i] == 1);
+
+    // Nested: a parent only counts as run once its children did, 8 of them and itself
+    static u32 nested[16];
+    for (u32 i = 0; i < 16; i++)
+        jobRun(parentJob, &nested[i], &counter);
+    jobWait(&counter);
+    EXPECT(counter.value == 0);
+    for (u32 i = 0; i < 16; i++)
+        EXPECT(nested[i] == 9);
+
+    // Waiting on a counter nothing was added to returns right away
+    JobCounter empty = {0};
+    jobWait(&empty);
+    return true;
+}
+
+static u8 g_ParallelHits[PARALLEL_ITEMS];
+
+static void hitRange(void* arg, u32 begin, u32 end)
+{
+    u32* ranges = (u32*)arg;
+    __atomic_add_fetch(ranges, 1, __ATOMIC_RELAXED);
+    for (u32 i = begin; i < end; i++)
+        g_ParallelHits[i]++;
+}
+
+static bool parallelFor(void)
+{
+    // Every item is in exactly one range, of at most grain items
+    u32 ranges = 0;
+    jobParallelFor(PARALLEL_ITEMS, 64, hitRange, &ranges);
+    for (u32 i = 0; i < PARALLEL_ITEMS; i++)
+        EXPECT(g_ParallelHits[i] == 1);
+    EXPECT(ranges >= (PARALLEL_ITEMS + 63) / 64);
+
+    ranges = 0;
+    jobParallelFor(0, 64, hitRange, &ranges);
+    EXPECT(ranges == 0);
+    return true;
+}
+
+static bool testJobs(void)
+{
+    EXPECT(R_SUCCEEDED(jobSystemInit()));
+    bool ok = jobCounters();
+    jobSystemExit();
+    return ok;
+}
+
+static bool testParallelFor(void)
+{
+    EXPECT(R_SUCCEEDED(jobSystemInit()));
+    bool ok = parallelFor();
+    jobSystemExit();
+    return ok;
+}
+
+//---------------------------------------------------------------------------------
+// main
+//---------------------------------------------------------------------------------
+typedef struct {
+    const char* name;
+    bool (*func)(void);
+} TestCase;
+
+static const TestCase g_Tests[] = {
+    { "SpscQueue full/empty",           testSpscFullEmpty },
+    { "SpscQueue order, 1 producer",    testSpscOrder },
+    { "MpscQueue full/empty",           testMpscFullEmpty },
+    { "MpscQueue order, 3 producers",   testMpscOrder },
+    { "Pool exhaustion and reuse",      testPool },
+    { "Arena mark/rewind/reset",        testArena },
+    { "JobCounter completion",          testJobs },
+    { "jobParallelFor coverage",        testParallelFor },
+};
+
+int main(int argc, char* argv[])
+{
+    consoleInit(NULL);
+
+    printf("libperf tests\n\n");
+    consoleUpdate(NULL);
+
+    int failed = 0;
+    for (u32 i = 0; i < sizeof(g_Tests) / sizeof(g_Tests[0]); i++) {
+        bool ok = g_Tests[i].func();
+        printf("%s %s\n", ok ? "PASS" : "FAIL", g_Tests[i].name);
+        consoleUpdate(NULL);
+        if (!ok)
+            failed++;
+    }
+
+    printf("\n%d of %d failed\n", failed, (int)(sizeof(g_Tests) / sizeof(g_Tests[0])));
+    printf("\nPress PLUS to exit\n");
+    while (appletMainLoop())
+    {
+        hidScanInput();
+        if (hidKeysDown(CONTROLLER_P1_AUTO) & KEY_PLUS)
+            break;
+        consoleUpdate(NULL);
+    }
+
+    consoleExit(NULL);
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
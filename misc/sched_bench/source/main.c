@@ -0,0 +1,391 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <malloc.h>
+#include <switch.h>
+
+// This example measures what the choice of core and priority of a thread costs:
+//  - compute and memory throughput of each core alone, and of all of them at once,
+//  - round-trip time of a UEvent and of a CondVar ping-pong between two threads, on the same core and across cores,
+//  - how long a thread takes to wake up while another thread keeps its core busy, at a higher, the same, or a lower
+//    priority than the busy thread (a lower value is a higher priority).
+// Core 3 is the system core: threads of the application are preempted there by the system's.
+// The results are printed and written to sdmc:/sched_bench.csv.
+
+#define CSV_PATH "sdmc:/sched_bench.csv"
+#define RUN_NS 500000000ULL // Per throughput measurement
+#define MEMORY_SIZE (8*1024*1024) // Per thread, well over the L2 cache
+#define PING_ROUNDS 2000
+#define WAKE_ROUNDS 100
+#define BASE_PRIO 0x2C
+
+static FILE* g_Csv;
+
+__attribute__((format(printf, 3, 4)))
+static void report(const char* test, const char* unit, const char* fmt, ...)
+{
+    // The value comes last: "<config...>: <value> <unit>"
+    char line[128];
+    va_list va;
+    va_start(va, fmt);
+    vsnprintf(line, sizeof(line), fmt, va);
+    va_end(va);
+
+    printf("%s %s %s\n", test, line, unit);
+    consoleUpdate(NULL);
+    if (g_Csv)
+        fprintf(g_Csv, "%s,\"%s\",%s\n", test, line, unit);
+}
+
+static Result startThread(Thread* t, ThreadFunc func, void* arg, int prio, int core)
+{
+    Result rc = threadCreate(t, func, arg, NULL, 0x10000, prio, core);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(t);
+        if (R_FAILED(rc))
+            threadClose(t);
+    }
+    return rc;
+}
+
+static void joinThread(Thread* t)
+{
+    threadWaitForExit(t);
+    threadClose(t);
+}
+
+//---------------------------------------------------------------------------------
+// Throughput
+//---------------------------------------------------------------------------------
+typedef struct {
+    Thread thread;
+    UEvent* start;
+    u64 work;           // Iterations or bytes
+    u64 ns;
+    u64* memory;
+    u64 sink;
+} Worker;
+
+static void computeFunc(void* arg)
+{
+    Worker* w = (Worker*)arg;
+    waitSingle(waiterForUEvent(w->start), UINT64_MAX);
+
+    u64 x = 1, iterations = 0;
+    u64 start = armGetSystemTick(), end = start + armNsToTicks(RUN_NS), tick;
+    do {
+        for (u32 i = 0; i < 4096; i++)
+            x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        iterations += 4096;
+    } while ((tick = armGetSystemTick()) < end);
+
+    w->work = iterations;
+    w->ns = armTicksToNs(tick - start);
+    w->sink = x;
+}
+
+static void memoryFunc(void* arg)
+{
+    Worker* w = (Worker*)arg;
+    waitSingle(waiterForUEvent(w->start), UINT64_MAX);
+
+    u64 sum = 0, bytes = 0;
+    u64 start = armGetSystemTick(), end = start + armNsToTicks(RUN_NS), tick;
+    do {
+        for (u32 i = 0; i < MEMORY_SIZE / 8; i += 4)
+            sum += w->memory[i] + w->memory[i+1] + w->memory[i+2] + w->memory[i+3];
+        bytes += MEMORY_SIZE;
+    } while ((tick = armGetSystemTick()) < end);
+
+    w->work = bytes;
+    w->ns = armTicksToNs(tick - start);
+    w->sink = sum;
+}
+
+// Runs func on each core of the mask at the same time. Returns the total rate, in work per second, or -1 if a thread
+// couldn't be created on one of the cores.
+static double runOnCores(ThreadFunc func, u32 core_mask)
+{
+    static Worker workers[4];
+    UEvent start;
+    ueventCreate(&start, false);
+
+    u32 started = 0;
+    bool ok = true;
+    for (u32 core = 0; core < 4; core++) {
+        if (!(core_mask & BIT(core)))
+            continue;
+        Worker* w = &workers[started];
+        w->start = &start;
+        w->work = w->ns = 0;
+        if (func == memoryFunc && !w->memory) {
+            w->memory = (u64*)memalign(0x1000, MEMORY_SIZE);
+            if (!w->memory) {
+                ok = false;
+                break;
+            }
+            for (u32 i = 0; i < MEMORY_SIZE / 8; i++)
+                w->memory[i] = i;
+        }
+        if (R_FAILED(startThread(&w->thread, func, w, BASE_PRIO, core))) {
+            ok = false;
+            break;
+        }
+        started++;
+    }
+
+    // Started together, once they're all created
+    ueventSignal(&start);
+    double rate = 0;
+    for (u32 i = 0; i < started; i++) {
+        joinThread(&workers[i].thread);
+        if (workers[i].ns)
+            rate += workers[i].work * 1e9 / workers[i].ns;
+    }
+    return ok ? rate : -1;
+}
+
+static void benchThroughput(void)
+{
+    u32 all = 0;
+    for (u32 core = 0; core < 4; core++) {
+        double compute = runOnCores(computeFunc, BIT(core));
+        if (compute < 0) {
+            report("compute", "", "core %u: unavailable", core);
+            continue;
+        }
+        all |= BIT(core);
+        report("compute", "Miter/s", "core %u: %.1f", core, compute / 1e6);
+        report("memory", "MB/s", "core %u: %.1f", core, runOnCores(memoryFunc, BIT(core)) / 1e6);
+    }
+    // Memory bandwidth is shared though, one core doesn't get it all
+    report("compute", "Miter/s", "cores 0x%x together: %.1f", all, runOnCores(computeFunc, all) / 1e6);
+    report("memory", "MB/s", "cores 0x%x together: %.1f", all, runOnCores(memoryFunc, all) / 1e6);
+}
+
+//---------------------------------------------------------------------------------
+// Ping-pong
+//---------------------------------------------------------------------------------
+typedef struct {
+    bool useCondVar;
+    UEvent ping, pong;
+    Mutex mutex;
+    CondVar condvar;
+    u32 turn;           // CondVar mode: 1 when the ponger is to answer
+} PingPong;
+
+static void pongFunc(void* arg)
+{
+    PingPong* p = (PingPong*)arg;
+    for (u32 i = 0; i < PING_ROUNDS; i++) {
+        if (p->useCondVar) {
+            mutexLock(&p->mutex);
+            while (p->turn != 1)
+                condvarWait(&p->condvar, &p->mutex);
+            p->turn = 0;
+            condvarWakeAll(&p->condvar);
+            mutexUnlock(&p->mutex);
+        }
+        else {
+            waitSingle(waiterForUEvent(&p->ping), UINT64_MAX);
+            ueventSignal(&p->pong);
+        }
+    }
+}
+
+static void sendPing(PingPong* p)
+{
+    if (p->useCondVar) {
+        mutexLock(&p->mutex);
+        p->turn = 1;
+        condvarWakeAll(&p->condvar);
+        while (p->turn != 0)
+            condvarWait(&p->condvar, &p->mutex);
+        mutexUnlock(&p->mutex);
+    }
+    else {
+        ueventSignal(&p->ping);
+        waitSingle(waiterForUEvent(&p->pong), UINT64_MAX);
+    }
+}
+
+// The ping side runs on a thread too, so that both cores can be chosen
+static u64 g_PingMin, g_PingTotal, g_PingMax;
+
+static void pingFunc(void* arg)
+{
+    PingPong* p = (PingPong*)arg;
+    g_PingMin = UINT64_MAX;
+    g_PingTotal = g_PingMax = 0;
+    for (u32 i = 0; i < PING_ROUNDS; i++) {
+        u64 start = armGetSystemTick();
+        sendPing(p);
+        u64 ticks = armGetSystemTick() - start;
+        g_PingTotal += ticks;
+        if (ticks < g_PingMin) g_PingMin = ticks;
+        if (ticks > g_PingMax) g_PingMax = ticks;
+    }
+}
+
+static void benchPingPong(bool useCondVar, u32 coreA, u32 coreB)
+{
+    static PingPong p;
+    p.useCondVar = useCondVar;
+    ueventCreate(&p.ping, true);
+    ueventCreate(&p.pong, true);
+    mutexInit(&p.mutex);
+    condvarInit(&p.condvar);
+    p.turn = 0;
+
+    Thread ping, pong;
+    const char* name = useCondVar ? "condvar_rtt" : "uevent_rtt";
+    if (R_FAILED(startThread(&pong, pongFunc, &p, BASE_PRIO, coreB))) {
+        report(name, "", "cores %u-%u: unavailable", coreA, coreB);
+        return;
+    }
+    if (R_FAILED(startThread(&ping, pingFunc, &p, BASE_PRIO, coreA))) {
+        // The ponger waits for pings which never come: send them from here
+        for (u32 i = 0; i < PING_ROUNDS; i++)
+            sendPing(&p);
+        joinThread(&pong);
+        report(name, "", "cores %u-%u: unavailable", coreA, coreB);
+        return;
+    }
+    joinThread(&ping);
+    joinThread(&pong);
+
+    report(name, "us", "cores %u-%u: min %.2f, avg %.2f, max %.2f", coreA, coreB, armTicksToNs(g_PingMin) / 1000.0,
+        armTicksToNs(g_PingTotal) / 1000.0 / PING_ROUNDS, armTicksToNs(g_PingMax) / 1000.0);
+}
+
+//---------------------------------------------------------------------------------
+// Wake-up latency against a busy thread
+//---------------------------------------------------------------------------------
+typedef struct {
+    UEvent wake, ack;
+    u64 signalTick;
+    u64 total, max;
+    u32 count;
+    bool exit;
+    u64 hogEnd;
+} WakeTest;
+
+static void hogFunc(void* arg)
+{
+    WakeTest* t = (WakeTest*)arg;
+    volatile u64 x = 0;
+    while (armGetSystemTick() < t->hogEnd)
+        x++;
+}
+
+static void waiterFunc(void* arg)
+{
+    WakeTest* t = (WakeTest*)arg;
+    for (;;) {
+        waitSingle(waiterForUEvent(&t->wake), UINT64_MAX);
+        if (__atomic_load_n(&t->exit, __ATOMIC_ACQUIRE))
+            break;
+        u64 ticks = armGetSystemTick() - __atomic_load_n(&t->signalTick, __ATOMIC_ACQUIRE);
+        t->total += ticks;
+        if (ticks > t->max) t->max = ticks;
+        t->count++;
+        ueventSignal(&t->ack);
+    }
+}
+
+static void benchWakeLatency(u32 core, int waiterPrio)
+{
+    static WakeTest t;
+    ueventCreate(&t.wake, true);
+    ueventCreate(&t.ack, true);
+    t.total = t.max = 0;
+    t.count = 0;
+    t.exit = false;
+    // Long enough for every round even when the waiter is starved, runs out by itself in any case
+    t.hogEnd = armGetSystemTick() + armNsToTicks(WAKE_ROUNDS * 12000000ULL);
+
+    Thread hog, waiter;
+    if (R_FAILED(startThread(&waiter, waiterFunc, &t, waiterPrio, core)))
+        return;
+    if (R_FAILED(startThread(&hog, hogFunc, &t, BASE_PRIO, core))) {
+        __atomic_store_n(&t.exit, true, __ATOMIC_RELEASE);
+        ueventSignal(&t.wake);
+        joinThread(&waiter);
+        return;
+    }
+
+    // Signaled from this thread, on another core
+    u32 late = 0;
+    for (u32 i = 0; i < WAKE_ROUNDS; i++) {
+        svcSleepThread(10000000ULL); // 10ms
+        ueventClear(&t.ack);
+        __atomic_store_n(&t.signalTick, armGetSystemTick(), __ATOMIC_RELEASE);
+        ueventSignal(&t.wake);
+        if (R_FAILED(waitSingle(waiterForUEvent(&t.ack), 1000000ULL))) // 1ms
+            late++;
+    }
+
+    joinThread(&hog);
+    __atomic_store_n(&t.exit, true, __ATOMIC_RELEASE);
+    ueventSignal(&t.wake);
+    joinThread(&waiter);
+
+    const char* rel = waiterPrio < BASE_PRIO ? "above" : waiterPrio == BASE_PRIO ? "same as" : "below";
+    report("wake_latency", "us", "core %u, waiter 0x%x %s busy thread, %u/%u over 1ms: avg %.2f, max %.2f", core, waiterPrio, rel,
+        late, WAKE_ROUNDS, t.count ? armTicksToNs(t.total) / 1000.0 / t.count : 0.0, armTicksToNs(t.max) / 1000.0);
+}
+
+static void runAll(void)
+{
+    g_Csv = fopen(CSV_PATH, "w");
+    if (g_Csv)
+        fprintf(g_Csv, "test,config,unit\n");
+
+    benchThroughput();
+
+    static const u32 pairs[][2] = { {0, 0}, {0, 1}, {1, 2}, {0, 3} };
+    for (u32 i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++) {
+        benchPingPong(false, pairs[i][0], pairs[i][1]);
+        benchPingPong(true, pairs[i][0], pairs[i][1]);
+    }
+
+    // This thread signals from its own core, the waiter and the busy thread share another one
+    u32 core = (svcGetCurrentProcessorNumber() + 1) % 3;
+    benchWakeLatency(core, BASE_PRIO - 1);
+    benchWakeLatency(core, BASE_PRIO);
+    benchWakeLatency(core, BASE_PRIO + 1);
+    benchWakeLatency(3, BASE_PRIO - 1);
+
+    if (g_Csv) {
+        fclose(g_Csv);
+        g_Csv = NULL;
+        printf("Results written to " CSV_PATH "\n");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    consoleInit(NULL);
+
+    printf("sched_bench example\n");
+    printf("Press A to run the benchmark, + to exit\n\n");
+    consoleUpdate(NULL);
+
+    while(appletMainLoop())
+    {
+        hidScanInput();
+
+        u32 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+
+        if (kDown & KEY_PLUS)
+            break;
+
+        if (kDown & KEY_A)
+            runAll();
+
+        consoleUpdate(NULL);
+    }
+
+    consoleExit(NULL);
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <time.h>
+#include <switch.h>
+
+#include "timing.h"
+
+// This example measures what reading the time costs, with each of the ways there are to do it, next to the timing.h
+// conversions and scope timer. Each one is called in a loop, and the time per call is the time of the loop, read with
+// armGetSystemTick, divided by the number of calls. The loops with the time service make fewer calls, each of them
+// being an IPC round trip.
+
+#define FAST_CALLS 1000000
+#define SVC_CALLS 100000
+#define IPC_CALLS 1000
+
+static volatile u64 g_Sink;
+
+#define BENCH(name, calls, expr) do {                                                   \
+        u64 sum_ = 0;                                                                   \
+        u64 start_ = armGetSystemTick();                                                \
+        for (u64 i = 0; i < (calls); i++)                                               \
+            sum_ += (u64)(expr);                                                        \
+        u64 ticks_ = armGetSystemTick() - start_;                                       \
+        g_Sink = sum_;                                                                  \
+        printf("%-28s %9.2f ns\n", name, (double)timingTicksToNs(ticks_) / (calls));    \
+        consoleUpdate(NULL);                                                            \
+    } while (0)
+
+static u64 timeServiceSeconds(void)
+{
+    u64 seconds = 0;
+    timeGetCurrentTime(TimeType_Default, &seconds);
+    return seconds;
+}
+
+static u64 scopeTimer(TimingStat* stat)
+{
+    TIMING_SCOPE(stat);
+    return stat->count;
+}
+
+static void runBenchmarks(void)
+{
+    printf("Cost per call:\n");
+    BENCH("armGetSystemTick", FAST_CALLS, armGetSystemTick());
+    BENCH("svcGetSystemTick", SVC_CALLS, svcGetSystemTick());
+    BENCH("armTicksToNs", FAST_CALLS, armTicksToNs(armGetSystemTick() + i));
+    BENCH("timingTicksToNs", FAST_CALLS, timingTicksToNs(armGetSystemTick() + i));
+    BENCH("timingNsToTicks", FAST_CALLS, timingNsToTicks(armGetSystemTick() + i));
+    BENCH("timingUnixNs", FAST_CALLS, timingUnixNs());
+
+    static TimingStat stat;
+    BENCH("TIMING_SCOPE (empty)", FAST_CALLS, scopeTimer(&stat));
+
+    BENCH("timeGetCurrentTime", IPC_CALLS, timeServiceSeconds());
+    BENCH("time(NULL)", IPC_CALLS, time(NULL));
+    BENCH("time(NULL) + gmtime", IPC_CALLS, ({ time_t t = time(NULL); gmtime(&t)->tm_sec; }));
+
+    // Against libnx's own conversion, which divides by a constant
+    u64 max_error = 0;
+    for (u64 ticks = 1; ticks < (1ULL << 54); ticks = ticks * 3 + 7) {
+        u64 a = armTicksToNs(ticks), b = timingTicksToNs(ticks);
+        u64 error = a > b ? a - b : b - a;
+        if (error > max_error)
+            max_error = error;
+    }
+    printf("\ntimingTicksToNs vs armTicksToNs: %lu ns at most, up to 2^54 ticks\n", max_error);
+}
+
+int main(int argc, char* argv[])
+{
+    consoleInit(NULL);
+
+    timingInit();
+    printf("Tick frequency: %lu Hz\n", g_timingClock.freq);
+    printf("Calibrating the wall clock...\n");
+    consoleUpdate(NULL);
+    if (!timingCalibrateWallClock())
+        printf("The time service failed, timingUnixNs is off by up to a second\n");
+
+    printf("\n");
+    runBenchmarks();
+
+    printf("\nPress A to compare the clocks, PLUS to exit\n");
+    consoleUpdate(NULL);
+
+    while (appletMainLoop())
+    {
+        hidScanInput();
+        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+
+        if (kDown & KEY_PLUS)
+            break;
+
+        if (kDown & KEY_A) {
+            // The time service only has seconds, the difference stays within [0, 1) s as long as the calibration holds
+            u64 unix_ns = timingUnixNs();
+            u64 seconds = timeServiceSeconds();
+            printf("timingUnixNs - time service: %+.3f s\n", (double)(s64)(unix_ns - seconds * 1000000000ULL) / 1e9);
+        }
+
+        consoleUpdate(NULL);
+    }
+
+    consoleExit(NULL);
+    return 0;
+}
@@ -1,44 +1,46 @@
 #include <stdio.h>
-#include <stdarg.h>
 #include <switch.h>
 
+#include "mpsc_queue.h"
+#include "async_log.h"
+
+#define NUM_PRODUCERS 3
+#define MESSAGES_PER_PRODUCER 2000
+
+typedef struct
+{
+    u32 producer;
+    u32 value;
+} Message;
+
 static UEvent g_Event;
 static UEvent g_ExitEvent;
-static Mutex g_PrintMutex;
 
-__attribute__((format(printf, 1, 2)))
-static void locked_printf(const char* fmt, ...)
-{
-    mutexLock(&g_PrintMutex);
-    va_list va;
-    va_start(va, fmt);
-    vprintf(fmt, va);
-    va_end(va);
-    consoleUpdate(NULL);
-    mutexUnlock(&g_PrintMutex);
-}
+// The second part sends messages through a queue, whose event is only signaled when the consumer is waiting
+static MpscQueue g_Queue;
+static UEvent g_QueueExitEvent;
 
 void threadFunc1(void* arg)
 {
     Result rc;
     int idx;
 
-    locked_printf("Entering thread\n");
+    asyncLog("Entering thread\n");
 
     while (1)
     {
         rc = waitMulti(&idx, -1, waiterForUEvent(&g_Event), waiterForUEvent(&g_ExitEvent));
-        locked_printf("waitMulti returned %x, index triggered = %d\n", rc, idx);
+        asyncLog("waitMulti returned %x, index triggered = %d\n", rc, idx);
 
         if (R_SUCCEEDED(rc))
         {
             if (idx == 0)
             {
-                locked_printf("g_Event triggered!\n");
+                asyncLog("g_Event triggered!\n");
                 ueventClear(&g_Event);
             }
             else {
-                locked_printf("g_ExitEvent triggered!\n");
+                asyncLog("g_ExitEvent triggered!\n");
                 break;
             }
         }
@@ -47,18 +49,129 @@ void threadFunc1(void* arg)
     rc = waitMulti(&idx, 0, waiterForUEvent(&g_Event), waiterForUEvent(&g_ExitEvent));
 
     if (R_SUCCEEDED(rc))
-        locked_printf("Got leftover event %u\n", idx);
+        asyncLog("Got leftover event %u\n", idx);
+}
+
+void producerFunc(void* arg)
+{
+    u32 producer = (u32)(uintptr_t)arg;
+    u32 i;
+    for (i=0; i<MESSAGES_PER_PRODUCER; i++)
+    {
+        Message msg = { producer, i };
+        while (!mpscQueuePush(&g_Queue, &msg))
+            svcSleepThread(0); // Full, let the consumer catch up
+
+        if ((i % 16) == 15)
+            svcSleepThread(100000ull); // 100us, messages come in bursts
+    }
+}
+
+void consumerFunc(void* arg)
+{
+    u32 received = 0, wakeups = 0, batches = 0;
+    u32 next[NUM_PRODUCERS] = {0};
+    bool exiting = false, inOrder = true;
+    Message batch[32];
+
+    while (1)
+    {
+        u32 count, i;
+        while ((count = mpscQueuePop(&g_Queue, batch, 32)))
+        {
+            for (i=0; i<count; i++)
+            {
+                if (batch[i].value != next[batch[i].producer])
+                    inOrder = false;
+                next[batch[i].producer] = batch[i].value + 1;
+            }
+            received += count;
+            batches++;
+        }
+
+        // Everything sent before the exit event is in the queue already, and was just drained
+        if (exiting)
+            break;
+
+        if (mpscQueuePrepareWait(&g_Queue))
+        {
+            int idx;
+            Result rc = waitMulti(&idx, -1, mpscQueueWaiter(&g_Queue), waiterForUEvent(&g_QueueExitEvent));
+            if (R_SUCCEEDED(rc))
+            {
+                if (idx == 0)
+                    wakeups++;
+                else
+                    exiting = true;
+            }
+        }
+    }
+
+    asyncLog("Received %u messages (%s), in %u batches, after %u wakeups\n", received, inOrder ? "in order" : "NOT in order", batches, wakeups);
+}
+
+void runQueue(void)
+{
+    static Thread consumer, producers[NUM_PRODUCERS];
+    Result rc;
+    u32 numProducers = 0;
+    size_t i;
+
+    rc = mpscQueueCreate(&g_Queue, 256, sizeof(Message));
+    if (R_FAILED(rc))
+        return;
+    ueventCreate(&g_QueueExitEvent, false);
+
+    asyncLog("Sending %u messages from %u threads through a queue\n", NUM_PRODUCERS * MESSAGES_PER_PRODUCER, NUM_PRODUCERS);
+
+    rc = threadCreate(&consumer, consumerFunc, NULL, NULL, 0x10000, 0x2C, -2);
+    if (R_SUCCEEDED(rc))
+    {
+        rc = threadStart(&consumer);
+
+        if (R_SUCCEEDED(rc))
+        {
+            for (i=0; i<NUM_PRODUCERS; i++)
+            {
+                rc = threadCreate(&producers[i], producerFunc, (void*)(uintptr_t)i, NULL, 0x10000, 0x2C, -2);
+                if (R_FAILED(rc))
+                    break;
+                rc = threadStart(&producers[i]);
+                if (R_FAILED(rc))
+                {
+                    threadClose(&producers[i]);
+                    break;
+                }
+                numProducers++;
+            }
+
+            for (i=0; i<numProducers; i++)
+            {
+                threadWaitForExit(&producers[i]);
+                threadClose(&producers[i]);
+            }
+
+            ueventSignal(&g_QueueExitEvent);
+            threadWaitForExit(&consumer);
+            asyncLog("The queue's event was signaled %u times\n", g_Queue.signals);
+        }
+
+        threadClose(&consumer);
+    }
+
+    mpscQueueClose(&g_Queue);
 }
 
 int main(int argc, char **argv)
 {
     consoleInit(NULL);
 
-    mutexInit(&g_PrintMutex);
+    // The threads only copy what they log, it's printed by this one, which also updates the console
+    asyncLogInit(0x2D, true);
     ueventCreate(&g_Event, false);
     ueventCreate(&g_ExitEvent, false);
 
-    locked_printf("Creating thread\n");
+    asyncLog("Creating thread\n");
 
     Thread thread;
     Result rc;
@@ -72,10 +185,10 @@ int main(int argc, char **argv)
         {
             size_t i;
             for (i=0; i<5; i++) {
-                locked_printf("Sleeping for a while\n");
+                asyncLog("Sleeping for a while\n");
                 svcSleepThread(1000000000ull); // 1s
 
-                locked_printf("Fire!\n");
+                asyncLog("Fire!\n");
                 ueventSignal(&g_Event);
             }
 
@@ -86,6 +199,11 @@ int main(int argc, char **argv)
         threadClose(&thread);
     }
 
+    runQueue();
+
+    // The other threads are done, the console is this one's again
+    asyncLogExit();
+
     while (appletMainLoop())
     {
         hidScanInput();
@@ -1,30 +1,22 @@
 #include <stdio.h>
-#include <stdarg.h>
+#include <stdlib.h>
 #include <switch.h>
 
+#include "timer_wheel.h"
+#include "async_log.h"
+
+#define NUM_WHEEL_TIMERS 5000
+
 static UTimer g_Timer;
 static UTimer g_FastTimer;
 static UEvent g_ExitEvent;
-static Mutex g_PrintMutex;
-
-__attribute__((format(printf, 1, 2)))
-static void locked_printf(const char* fmt, ...)
-{
-    mutexLock(&g_PrintMutex);
-    va_list va;
-    va_start(va, fmt);
-    vprintf(fmt, va);
-    va_end(va);
-    consoleUpdate(NULL);
-    mutexUnlock(&g_PrintMutex);
-}
 
 void threadFunc1(void* arg)
 {
     Result rc;
     int idx;
 
-    locked_printf("Entering thread\n");
+    asyncLog("Entering thread\n");
 
     while (1)
     {
@@ -33,29 +25,84 @@ void threadFunc1(void* arg)
         if (R_SUCCEEDED(rc))
         {
             if (idx == 0) {
-                locked_printf("g_Timer triggered!\n");
+                asyncLog("g_Timer triggered!\n");
             }
             else if (idx == 1) {
-                locked_printf("g_FasterTimer triggered!\n");
+                asyncLog("g_FasterTimer triggered!\n");
             }
             else {
-                locked_printf("g_ExitEvent triggered!\n");
+                asyncLog("g_ExitEvent triggered!\n");
                 break;
             }
         }
     }
 }
 
+// The second part schedules thousands of timeouts on a timer wheel, which waits on a single UTimer
+static TimerWheel g_Wheel;
+static TimerWheelTimer g_WheelTimers[NUM_WHEEL_TIMERS];
+static u64 g_Deadlines[NUM_WHEEL_TIMERS];
+static TimerWheelTimer g_Heartbeat;
+static u32 g_Fired;
+static u64 g_TotalLateNs, g_MaxLateNs;
+
+// Callbacks all run on the wheel's thread, one at a time
+void wheelTimerFunc(TimerWheelTimer* timer, void* arg)
+{
+    u64 late = armTicksToNs(armGetSystemTick() - g_Deadlines[(uintptr_t)arg]);
+    g_Fired++;
+    g_TotalLateNs += late;
+    if (late > g_MaxLateNs)
+        g_MaxLateNs = late;
+}
+
+void heartbeatFunc(TimerWheelTimer* timer, void* arg)
+{
+    asyncLog("Heartbeat, %u timeouts so far\n", g_Fired);
+    timerWheelAdd(&g_Wheel, timer, 500000000ull, heartbeatFunc, NULL); // Again in 500ms
+}
+
+void runWheel(void)
+{
+    Result rc = timerWheelStart(&g_Wheel, 1000000ull, 0x2B); // 1ms ticks
+    if (R_FAILED(rc))
+        return;
+
+    asyncLog("Scheduling %u timeouts of up to 3s on a timer wheel\n", NUM_WHEEL_TIMERS);
+    timerWheelAdd(&g_Wheel, &g_Heartbeat, 500000000ull, heartbeatFunc, NULL);
+
+    u32 i, cancelled = 0;
+    for (i=0; i<NUM_WHEEL_TIMERS; i++) {
+        u64 delay = (1 + rand() % 3000) * 1000000ull;
+        g_Deadlines[i] = armGetSystemTick() + armNsToTicks(delay);
+        timerWheelAdd(&g_Wheel, &g_WheelTimers[i], delay, wheelTimerFunc, (void*)(uintptr_t)i);
+    }
+
+    // Most timeouts never expire in practice, the operation they guard completes first
+    for (i=0; i<NUM_WHEEL_TIMERS; i+=4) {
+        if (timerWheelCancel(&g_Wheel, &g_WheelTimers[i]))
+            cancelled++;
+    }
+
+    svcSleepThread(3500000000ull); // 3.5s
+    timerWheelCancel(&g_Wheel, &g_Heartbeat);
+    timerWheelStop(&g_Wheel);
+
+    asyncLog("%u timeouts expired, %u cancelled, late by %.3f ms on average, %.3f ms at most\n", g_Fired, cancelled,
+        g_Fired ? g_TotalLateNs / 1000000.0 / g_Fired : 0.0, g_MaxLateNs / 1000000.0);
+}
+
 int main(int argc, char **argv)
 {
     consoleInit(NULL);
 
-    mutexInit(&g_PrintMutex);
+    // The threads only copy what they log, it's printed by this one, which also updates the console
+    asyncLogInit(0x2D, true);
     utimerCreate(&g_Timer, 2000000000, TimerType_Repeating); // 2s
     utimerCreate(&g_FastTimer, 1000000000, TimerType_Repeating); // 1s
     ueventCreate(&g_ExitEvent, false);
 
-    locked_printf("Creating thread\n");
+    asyncLog("Creating thread\n");
 
     Thread thread;
     Result rc;
@@ -67,22 +114,22 @@ int main(int argc, char **argv)
 
         if (R_SUCCEEDED(rc))
         {
-            locked_printf("Starting timer for 5s\n");
+            asyncLog("Starting timer for 5s\n");
             utimerStart(&g_Timer);
             utimerStart(&g_FastTimer);
             svcSleepThread(5000000000ull); // 5s
 
-            locked_printf("Stopping timer for 5s\n");
+            asyncLog("Stopping timer for 5s\n");
             utimerStop(&g_Timer);
             utimerStop(&g_FastTimer);
             svcSleepThread(5000000000ull); // 5s
 
-            locked_printf("Starting timer for 5s\n");
+            asyncLog("Starting timer for 5s\n");
             utimerStart(&g_Timer);
             utimerStart(&g_FastTimer);
             svcSleepThread(5000000000ull); // 5s
 
-            locked_printf("Done\n");
+            asyncLog("Done\n");
             ueventSignal(&g_ExitEvent);
 
             threadWaitForExit(&thread);
@@ -91,6 +138,11 @@ int main(int argc, char **argv)
         threadClose(&thread);
     }
 
+    runWheel();
+
+    // The other threads are done, the console is this one's again
+    asyncLogExit();
+
     while(appletMainLoop())
     {
         hidScanInput();
@@ -0,0 +1,390 @@
+#include <string.h>
+#include <strings.h>
+#include <stdlib.h>
+
+#include "download_manager.h"
+
+static void download_share_lock(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr)
+{
+    DownloadManager* m = (DownloadManager*)userptr;
+    mutexLock(&m->share_locks[data]);
+}
+
+static void download_share_unlock(CURL* handle, curl_lock_data data, void* userptr)
+{
+    DownloadManager* m = (DownloadManager*)userptr;
+    mutexUnlock(&m->share_locks[data]);
+}
+
+static size_t download_write(char* ptr, size_t size, size_t nmemb, void* userdata)
+{
+    DownloadSlot* slot = (DownloadSlot*)userdata;
+    size_t n = size * nmemb;
+
+    // Grows geometrically, a response is usually received in many small pieces
+    if (slot->size + n > slot->capacity) {
+        size_t capacity = slot->capacity ? slot->capacity : 0x4000;
+        while (capacity < slot->size + n)
+            capacity *= 2;
+        u8* data = (u8*)realloc(slot->data, capacity);
+        if (!data)
+            return 0; // Fails the transfer with CURLE_WRITE_ERROR
+        slot->data = data;
+        slot->capacity = capacity;
+    }
+
+    memcpy(slot->data + slot->size, ptr, n);
+    slot->size += n;
+    return n;
+}
+
+// Copies the value of a header line after its name, without the surrounding whitespace and CRLF
+static void download_header_value(const char* value, size_t len, char* out, size_t out_size)
+{
+    while (len && (*value == ' ' || *value == '\t')) {
+        value++;
+        len--;
+    }
+    while (len && (value[len - 1] == '\r' || value[len - 1] == '\n' || value[len - 1] == ' ' || value[len - 1] == '\t'))
+        len--;
+
+    // Too long to be stored, it's dropped rather than truncated
+    if (len >= out_size)
+        len = 0;
+    memcpy(out, value, len);
+    out[len] = 0;
+}
+
+// Picks up the validators of the response for the cache
+static size_t download_header(char* buffer, size_t size, size_t nitems, void* userdata)
+{
+    DownloadSlot* slot = (DownloadSlot*)userdata;
+    size_t n = size * nitems;
+
+    // Each response (redirects, 100 Continue) starts with a status line, only the last one's headers count
+    if (n >= 5 && memcmp(buffer, "HTTP/", 5) == 0) {
+        slot->etag[0] = slot->last_modified[0] = 0;
+        slot->no_store = false;
+    }
+    else if (n > 5 && strncasecmp(buffer, "ETag:", 5) == 0)
+        download_header_value(buffer + 5, n - 5, slot->etag, sizeof(slot->etag));
+    else if (n > 14 && strncasecmp(buffer, "Last-Modified:", 14) == 0)
+        download_header_value(buffer + 14, n - 14, slot->last_modified, sizeof(slot->last_modified));
+    else if (n > 14 && strncasecmp(buffer, "Cache-Control:", 14) == 0) {
+        char value[128];
+        download_header_value(buffer + 14, n - 14, value, sizeof(value));
+        if (strstr(value, "no-store"))
+            slot->no_store = true;
+    }
+    return n;
+}
+
+static void download_finish(DownloadManager* m, DownloadSlot* slot, CURLcode res);
+
+// Starts queued downloads on the free slots
+static void download_start_pending(DownloadManager* m)
+{
+    for (u32 i = 0; i < m->max_concurrent; i++) {
+        DownloadSlot* slot = &m->slots[i];
+        if (slot->busy)
+            continue;
+
+        mutexLock(&m->mutex);
+        bool found = m->pending_tail != m->pending_head;
+        if (found) {
+            DownloadPending* p = &m->pending[m->pending_tail++ % DOWNLOAD_QUEUE_SIZE];
+            slot->req = p->req;
+            slot->add_tick = p->add_tick;
+        }
+        mutexUnlock(&m->mutex);
+        if (!found)
+            break;
+
+        // curl_easy_reset keeps the connections, caches and share of the handle, only the options are reset
+        curl_easy_reset(slot->easy);
+        curl_easy_setopt(slot->easy, CURLOPT_URL, slot->req.url);
+        curl_easy_setopt(slot->easy, CURLOPT_USERAGENT, "libnx curl example/1.0");
+        curl_easy_setopt(slot->easy, CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(slot->easy, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(slot->easy, CURLOPT_SHARE, m->share);
+        curl_easy_setopt(slot->easy, CURLOPT_TCP_KEEPALIVE, 1L);
+        // Wait for a connection which can be multiplexed (HTTP/2), rather than opening another one
+        curl_easy_setopt(slot->easy, CURLOPT_PIPEWAIT, 1L);
+        curl_easy_setopt(slot->easy, CURLOPT_WRITEFUNCTION, download_write);
+        curl_easy_setopt(slot->easy, CURLOPT_WRITEDATA, slot);
+        curl_easy_setopt(slot->easy, CURLOPT_PRIVATE, slot);
+
+        slot->data = NULL;
+        slot->size = slot->capacity = 0;
+        slot->start_tick = armGetSystemTick();
+        slot->busy = true;
+        m->active++;
+
+        slot->to_file = slot->req.path[0] != 0;
+        slot->headers = NULL;
+        slot->conditional = false;
+        slot->etag[0] = slot->last_modified[0] = 0;
+        slot->no_store = false;
+
+        // Files are hashed as they're written, they aren't cached
+        if (m->cache && !slot->to_file) {
+            curl_easy_setopt(slot->easy, CURLOPT_HEADERFUNCTION, download_header);
+            curl_easy_setopt(slot->easy, CURLOPT_HEADERDATA, slot);
+            HttpCacheEntry* e = http_cache_find(m->cache, slot->req.url);
+            if (e) {
+                slot->headers = http_cache_add_conditions(e, NULL);
+                curl_easy_setopt(slot->easy, CURLOPT_HTTPHEADER, slot->headers);
+                slot->conditional = true;
+            }
+        }
+
+        if (slot->to_file) {
+            if (!file_sink_open(&slot->sink, slot->req.path, true)) {
+                download_finish(m, slot, CURLE_WRITE_ERROR);
+                continue;
+            }
+            curl_easy_setopt(slot->easy, CURLOPT_WRITEFUNCTION, file_sink_curl_write);
+            curl_easy_setopt(slot->easy, CURLOPT_WRITEDATA, &slot->sink);
+            // Fewer, larger pieces for the sink to copy
+            curl_easy_setopt(slot->easy, CURLOPT_BUFFERSIZE, CURL_MAX_READ_SIZE);
+        }
+
+        curl_multi_add_handle(m->multi, slot->easy);
+    }
+}
+
+static void download_finish(DownloadManager* m, DownloadSlot* slot, CURLcode res)
+{
+    DownloadResult r;
+    memset(&r, 0, sizeof(r));
+    r.id = slot->req.id;
+    r.user = slot->req.user;
+    r.res = res;
+    curl_easy_getinfo(slot->easy, CURLINFO_RESPONSE_CODE, &r.http_code);
+    curl_easy_getinfo(slot->easy, CURLINFO_NUM_CONNECTS, &r.connects);
+    r.data = slot->data;
+    r.size = slot->size;
+    r.queue_ticks = slot->start_tick - slot->add_tick;
+    r.transfer_ticks = armGetSystemTick() - slot->start_tick;
+
+    // Removing a handle which wasn't added (the file couldn't be created) does nothing
+    curl_multi_remove_handle(m->multi, slot->easy);
+
+    r.to_file = slot->to_file;
+    if (slot->to_file && slot->sink.f) {
+        bool ok = file_sink_close(&slot->sink, r.sha256);
+        if (!ok && res == CURLE_OK)
+            r.res = CURLE_WRITE_ERROR;
+        r.size = slot->sink.total;
+        r.write_rate = file_sink_get_rate(&slot->sink);
+        r.write_stalls = slot->sink.stalls;
+    }
+
+    if (m->cache && !slot->to_file && res == CURLE_OK) {
+        // The entry is looked up again, the cache may have changed since the request was sent
+        HttpCacheEntry* e = slot->conditional ? http_cache_find(m->cache, slot->req.url) : NULL;
+        if (r.http_code == 304 && e) {
+            free(r.data);
+            r.data = http_cache_load(m->cache, e, &r.size);
+            if (r.data)
+                r.from_cache = true;
+            else {
+                r.size = 0;
+                r.res = CURLE_READ_ERROR;
+            }
+        }
+        else if (r.http_code == 200 && !slot->no_store)
+            http_cache_store(m->cache, slot->req.url, slot->etag, slot->last_modified, r.data, r.size);
+    }
+    curl_slist_free_all(slot->headers);
+    slot->headers = NULL;
+
+    slot->data = NULL;
+    slot->size = slot->capacity = 0;
+    slot->busy = false;
+    m->active--;
+
+    // There's always room: download_manager_add doesn't queue more than DOWNLOAD_QUEUE_SIZE outstanding downloads
+    mutexLock(&m->mutex);
+    m->done[m->done_head++ % DOWNLOAD_QUEUE_SIZE] = r;
+    mutexUnlock(&m->mutex);
+}
+
+static void download_thread_func(void* arg)
+{
+    DownloadManager* m = (DownloadManager*)arg;
+
+    for (;;) {
+        mutexLock(&m->mutex);
+        bool stop = m->exit;
+        mutexUnlock(&m->mutex);
+        if (stop)
+            break;
+
+        download_start_pending(m);
+
+        // Nothing to do until downloads are queued, a good time to write the cache index
+        if (!m->active) {
+            if (m->cache && m->cache->dirty)
+                http_cache_save_index(m->cache);
+            waitSingle(waiterForUEvent(&m->wake_event), UINT64_MAX);
+            continue;
+        }
+
+        int running = 0;
+        curl_multi_perform(m->multi, &running);
+
+        CURLMsg* msg;
+        int left = 0;
+        while ((msg = curl_multi_info_read(m->multi, &left))) {
+            if (msg->msg != CURLMSG_DONE)
+                continue;
+
+            DownloadSlot* slot = NULL;
+            curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, (char**)&slot);
+            download_finish(m, slot, msg->data.result);
+        }
+
+        // Sleeps until there's socket activity, at most 20ms so that new downloads start soon enough
+        if (m->active) {
+            int numfds = 0;
+            curl_multi_wait(m->multi, NULL, 0, 20, &numfds);
+        }
+    }
+}
+
+Result download_manager_init(DownloadManager* m, u32 max_concurrent)
+{
+    memset(m, 0, sizeof(*m));
+    if (max_concurrent == 0 || max_concurrent > DOWNLOAD_MAX_CONCURRENT)
+        max_concurrent = DOWNLOAD_MAX_CONCURRENT;
+    m->max_concurrent = max_concurrent;
+    m->next_id = 1;
+
+    mutexInit(&m->mutex);
+    ueventCreate(&m->wake_event, true);
+    for (u32 i = 0; i < CURL_LOCK_DATA_LAST; i++)
+        mutexInit(&m->share_locks[i]);
+
+    m->share = curl_share_init();
+    m->multi = curl_multi_init();
+    if (!m->share || !m->multi)
+        goto fail;
+
+    curl_share_setopt(m->share, CURLSHOPT_LOCKFUNC, download_share_lock);
+    curl_share_setopt(m->share, CURLSHOPT_UNLOCKFUNC, download_share_unlock);
+    curl_share_setopt(m->share, CURLSHOPT_USERDATA, m);
+    curl_share_setopt(m->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    curl_share_setopt(m->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+
+    // Several transfers to one host go over one HTTP/2 connection when the server supports it
+    curl_multi_setopt(m->multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+    curl_multi_setopt(m->multi, CURLMOPT_MAX_HOST_CONNECTIONS, (long)max_concurrent);
+
+    for (u32 i = 0; i < max_concurrent; i++) {
+        m->slots[i].easy = curl_easy_init();
+        if (!m->slots[i].easy)
+            goto fail;
+    }
+
+    // TLS needs a large stack
+    Result rc = threadCreate(&m->thread, download_thread_func, m, NULL, 0x20000, 0x2C, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&m->thread);
+        if (R_FAILED(rc))
+            threadClose(&m->thread);
+    }
+    if (R_SUCCEEDED(rc))
+        return 0;
+
+fail:
+    for (u32 i = 0; i < max_concurrent; i++) {
+        if (m->slots[i].easy)
+            curl_easy_cleanup(m->slots[i].easy);
+    }
+    if (m->multi) curl_multi_cleanup(m->multi);
+    if (m->share) curl_share_cleanup(m->share);
+    memset(m, 0, sizeof(*m));
+    return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+}
+
+void download_manager_exit(DownloadManager* m)
+{
+    mutexLock(&m->mutex);
+    m->exit = true;
+    mutexUnlock(&m->mutex);
+    ueventSignal(&m->wake_event);
+
+    threadWaitForExit(&m->thread);
+    threadClose(&m->thread);
+
+    // Downloads still running are aborted, the ones not polled are dropped
+    for (u32 i = 0; i < m->max_concurrent; i++) {
+        DownloadSlot* slot = &m->slots[i];
+        if (slot->busy) {
+            curl_multi_remove_handle(m->multi, slot->easy);
+            if (slot->to_file)
+                file_sink_close(&slot->sink, NULL);
+            curl_slist_free_all(slot->headers);
+        }
+        free(slot->data);
+        curl_easy_cleanup(slot->easy);
+    }
+    while (m->done_tail != m->done_head)
+        free(m->done[m->done_tail++ % DOWNLOAD_QUEUE_SIZE].data);
+
+    curl_multi_cleanup(m->multi);
+    curl_share_cleanup(m->share);
+}
+
+void download_manager_set_cache(DownloadManager* m, HttpCache* cache)
+{
+    m->cache = cache;
+}
+
+static u32 download_manager_queue(DownloadManager* m, const char* url, const char* path, void* user)
+{
+    if (strlen(url) >= DOWNLOAD_URL_MAX || strlen(path) >= DOWNLOAD_PATH_MAX)
+        return 0;
+
+    mutexLock(&m->mutex);
+    u32 id = 0;
+    if (m->outstanding < DOWNLOAD_QUEUE_SIZE) {
+        id = m->next_id++;
+        DownloadPending* p = &m->pending[m->pending_head++ % DOWNLOAD_QUEUE_SIZE];
+        p->req.id = id;
+        strcpy(p->req.url, url);
+        strcpy(p->req.path, path);
+        p->req.user = user;
+        p->add_tick = armGetSystemTick();
+        m->outstanding++;
+    }
+    mutexUnlock(&m->mutex);
+
+    if (id)
+        ueventSignal(&m->wake_event);
+    return id;
+}
+
+u32 download_manager_add(DownloadManager* m, const char* url, void* user)
+{
+    return download_manager_queue(m, url, "", user);
+}
+
+u32 download_manager_add_file(DownloadManager* m, const char* url, const char* path, void* user)
+{
+    return download_manager_queue(m, url, path, user);
+}
+
+bool download_manager_poll(DownloadManager* m, DownloadResult* out)
+{
+    mutexLock(&m->mutex);
+    bool found = m->done_tail != m->done_head;
+    if (found) {
+        *out = m->done[m->done_tail++ % DOWNLOAD_QUEUE_SIZE];
+        m->outstanding--;
+    }
+    mutexUnlock(&m->mutex);
+    return found;
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <switch.h>
+
+#include <curl/curl.h>
+
+#include "file_sink.h"
+#include "http_cache.h"
+
+// Concurrent downloads with curl_multi.
+//
+// A network thread drives up to max_concurrent transfers at once with a curl multi handle. The easy handles are
+// created once and reused, and they share one DNS cache, TLS session cache and connection cache (through curl_share),
+// so that requests to the same host reuse connections that are already open, or at least resume the TLS session,
+// instead of paying a full handshake each.
+//
+// The main thread only queues URLs with download_manager_add and picks up the finished downloads with
+// download_manager_poll, neither of them blocks on the network. Downloads are kept in memory, or streamed to a file
+// with download_manager_add_file (through a FileSink, which allocates 2 MiB while the download runs).
+//
+// With download_manager_set_cache, downloads to memory are revalidated against an HttpCache: a 304 answer is returned
+// as a normal download, with the body read from the cache, and from_cache set.
+//
+// curl_global_init must have been called, and sockets initialized.
+
+#define DOWNLOAD_MAX_CONCURRENT 8
+#define DOWNLOAD_QUEUE_SIZE 256     // Downloads queued, running or finished but not polled yet
+#define DOWNLOAD_URL_MAX 512
+#define DOWNLOAD_PATH_MAX 256
+
+typedef struct {
+    u32 id;
+    char url[DOWNLOAD_URL_MAX];
+    char path[DOWNLOAD_PATH_MAX];   // Empty to download to memory
+    void* user;
+} DownloadRequest;
+
+typedef struct {
+    u32 id;
+    void* user;
+    CURLcode res;
+    long http_code;
+    u8* data;                       // Body of the response, to be freed with free(). NULL when downloaded to a file.
+    size_t size;
+    bool to_file;
+    u8 sha256[32];                  // Hash of the file, computed while it was written
+    double write_rate;              // Sustained write rate to the file, in MB/s
+    u32 write_stalls;               // Times the download waited for the SD card
+    long connects;                  // Connections opened for this download, 0 when one was reused
+    u64 queue_ticks;                // Time from download_manager_add to the start of the transfer
+    u64 transfer_ticks;             // Time taken by the transfer
+    bool from_cache;                // The server answered 304, data was read from the cache
+} DownloadResult;
+
+typedef struct {
+    CURL* easy;
+    bool busy;
+    DownloadRequest req;
+    u8* data;
+    size_t size, capacity;
+    bool to_file;
+    FileSink sink;
+    u64 add_tick, start_tick;
+    struct curl_slist* headers;     // Conditional request headers
+    bool conditional;               // Revalidating a cached response
+    char etag[HTTP_CACHE_ETAG_MAX];
+    char last_modified[HTTP_CACHE_DATE_MAX];
+    bool no_store;
+} DownloadSlot;
+
+typedef struct {
+    DownloadRequest req;
+    u64 add_tick;
+} DownloadPending;
+
+typedef struct {
+    Thread thread;
+    Mutex mutex;                    // Protects the queues, outstanding and exit
+    UEvent wake_event;              // New downloads were queued, or exit
+    bool exit;
+
+    CURLM* multi;
+    CURLSH* share;
+    Mutex share_locks[CURL_LOCK_DATA_LAST];
+    u32 max_concurrent;
+
+    DownloadPending pending[DOWNLOAD_QUEUE_SIZE];
+    u32 pending_head, pending_tail;
+    DownloadResult done[DOWNLOAD_QUEUE_SIZE];
+    u32 done_head, done_tail;
+    u32 outstanding;                // Downloads added but not polled yet
+    u32 next_id;
+
+    // Only used by the network thread
+    DownloadSlot slots[DOWNLOAD_MAX_CONCURRENT];
+    u32 active;
+    HttpCache* cache;               // Set before queuing downloads, then only used by the network thread
+} DownloadManager;
+
+Result download_manager_init(DownloadManager* m, u32 max_concurrent);
+void download_manager_exit(DownloadManager* m);
+// Caches the downloads to memory in cache, which must stay open until download_manager_exit
+void download_manager_set_cache(DownloadManager* m, HttpCache* cache);
+
+// Queues a download, returns its id, or 0 if DOWNLOAD_QUEUE_SIZE downloads are already outstanding
+u32 download_manager_add(DownloadManager* m, const char* url, void* user);
+// Same, streaming the body to the file at path, and hashing it
+u32 download_manager_add_file(DownloadManager* m, const char* url, const char* path, void* user);
+
+// Returns true and takes the oldest finished download if there is one, never blocks
+bool download_manager_poll(DownloadManager* m, DownloadResult* out);
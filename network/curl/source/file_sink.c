@@ -0,0 +1,182 @@
+#include <string.h>
+#include <malloc.h>
+
+#include "file_sink.h"
+
+static void file_sink_thread_func(void* arg)
+{
+    FileSink* s = (FileSink*)arg;
+
+    for (;;) {
+        mutexLock(&s->mutex);
+        int i = s->write_chunk;
+        bool ready = s->ready[i];
+        size_t size = s->chunk_size[i];
+        bool stop = s->exit;
+        mutexUnlock(&s->mutex);
+
+        // Chunks which are already filled are still written when asked to stop
+        if (!ready) {
+            if (stop)
+                break;
+            waitSingle(waiterForUEvent(&s->data_event), -1);
+            continue;
+        }
+
+        bool ok = fwrite(s->chunks[i], 1, size, s->f) == size;
+        if (s->hash)
+            sha256ContextUpdate(&s->sha256, s->chunks[i], size);
+
+        mutexLock(&s->mutex);
+        s->ready[i] = false;
+        if (!ok)
+            s->error = true;
+        s->write_chunk = i ^ 1;
+        mutexUnlock(&s->mutex);
+
+        ueventSignal(&s->space_event);
+    }
+}
+
+// Hands the chunk being filled to the thread
+static void file_sink_submit(FileSink* s)
+{
+    int i = s->fill_chunk;
+
+    mutexLock(&s->mutex);
+    s->chunk_size[i] = s->fill_pos;
+    s->ready[i] = true;
+    mutexUnlock(&s->mutex);
+    ueventSignal(&s->data_event);
+
+    s->fill_chunk = i ^ 1;
+    s->fill_pos = 0;
+}
+
+bool file_sink_open(FileSink* s, const char* path, bool hash)
+{
+    memset(s, 0, sizeof(*s));
+
+    s->f = fopen(path, "wb");
+    if (!s->f)
+        return false;
+
+    // Chunks are written whole, stdio buffering would only add a copy
+    setvbuf(s->f, NULL, _IONBF, 0);
+
+    s->mem = (u8*)memalign(0x1000, 2 * FILE_SINK_CHUNK_SIZE);
+    if (!s->mem) {
+        fclose(s->f);
+        s->f = NULL;
+        return false;
+    }
+    s->chunks[0] = s->mem;
+    s->chunks[1] = s->mem + FILE_SINK_CHUNK_SIZE;
+
+    s->hash = hash;
+    if (hash)
+        sha256ContextCreate(&s->sha256);
+
+    mutexInit(&s->mutex);
+    ueventCreate(&s->data_event, true);
+    ueventCreate(&s->space_event, true);
+
+    // Same priority as the network thread: writing is mostly waiting on the filesystem anyway
+    Result rc = threadCreate(&s->thread, file_sink_thread_func, s, NULL, 0x4000, 0x2C, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&s->thread);
+        if (R_FAILED(rc))
+            threadClose(&s->thread);
+    }
+    if (R_FAILED(rc)) {
+        free(s->mem);
+        fclose(s->f);
+        memset(s, 0, sizeof(*s));
+        return false;
+    }
+    return true;
+}
+
+size_t file_sink_write(FileSink* s, const void* data, size_t size)
+{
+    const u8* src = (const u8*)data;
+    size_t left = size;
+
+    if (!s->start_tick)
+        s->start_tick = armGetSystemTick();
+
+    while (left) {
+        mutexLock(&s->mutex);
+        bool busy = s->ready[s->fill_chunk];
+        bool error = s->error;
+        mutexUnlock(&s->mutex);
+
+        if (error)
+            return 0;
+
+        // The chunk to fill is still being written: the SD card is behind
+        if (busy) {
+            s->stalls++;
+            waitSingle(waiterForUEvent(&s->space_event), -1);
+            continue;
+        }
+
+        size_t n = FILE_SINK_CHUNK_SIZE - s->fill_pos;
+        if (n > left)
+            n = left;
+        memcpy(s->chunks[s->fill_chunk] + s->fill_pos, src, n);
+        s->fill_pos += n;
+        src += n;
+        left -= n;
+
+        if (s->fill_pos == FILE_SINK_CHUNK_SIZE)
+            file_sink_submit(s);
+    }
+
+    s->total += size;
+    return size;
+}
+
+bool file_sink_close(FileSink* s, u8* hash_out)
+{
+    if (!s->f)
+        return false;
+
+    // The partial chunk: it was free when its filling started
+    if (s->fill_pos)
+        file_sink_submit(s);
+
+    mutexLock(&s->mutex);
+    s->exit = true;
+    mutexUnlock(&s->mutex);
+    ueventSignal(&s->data_event);
+
+    threadWaitForExit(&s->thread);
+    threadClose(&s->thread);
+    s->end_tick = armGetSystemTick();
+
+    bool ok = !s->error;
+    if (fclose(s->f) != 0)
+        ok = false;
+    s->f = NULL;
+
+    if (s->hash && hash_out)
+        sha256ContextGetHash(&s->sha256, hash_out);
+
+    free(s->mem);
+    s->mem = NULL;
+    return ok;
+}
+
+double file_sink_get_rate(FileSink* s)
+{
+    u64 end = s->end_tick ? s->end_tick : armGetSystemTick();
+    u64 ns = s->start_tick ? armTicksToNs(end - s->start_tick) : 0;
+    return ns ? s->total * 1000.0 / ns : 0.0;
+}
+
+size_t file_sink_curl_write(char* ptr, size_t size, size_t nmemb, void* userdata)
+{
+    // Anything other than size * nmemb fails the transfer with CURLE_WRITE_ERROR
+    return file_sink_write((FileSink*)userdata, ptr, size * nmemb);
+}
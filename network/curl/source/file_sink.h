@@ -0,0 +1,53 @@
+#pragma once
+#include <stdio.h>
+#include <switch.h>
+
+// Write-behind file sink, for streaming downloads to sdmc.
+//
+// curl hands its data over in pieces of a few KiB, and writing each of them to the SD card directly spends most of the
+// time in filesystem calls. Instead, file_sink_write copies the data into one of two large aligned chunks. When it's
+// full, a thread writes it out in one call, unbuffered, and hashes it if asked to, while the other chunk fills up. The
+// downloading side only waits when both chunks are full, that is when the SD card can't keep up.
+
+#define FILE_SINK_CHUNK_SIZE 0x100000
+
+typedef struct {
+    Thread thread;
+    Mutex mutex;          // Protects ready, chunk_size, error and exit
+    UEvent data_event;    // A chunk was filled
+    UEvent space_event;   // A chunk was written
+
+    FILE* f;
+    u8* mem;
+    u8* chunks[2];
+    size_t chunk_size[2];
+    bool ready[2];        // Filled, waiting for the thread
+    int write_chunk;      // Next chunk the thread writes
+    bool error;
+    bool exit;
+
+    bool hash;
+    Sha256Context sha256;
+
+    // Only used by the writing side
+    int fill_chunk;
+    size_t fill_pos;
+    u64 total;
+    u32 stalls;           // Number of times a write had to wait for the thread
+    u64 start_tick, end_tick;
+} FileSink;
+
+// Returns false if the file can't be created. With hash, the data is hashed with SHA-256 on the thread as it's written.
+bool file_sink_open(FileSink* s, const char* path, bool hash);
+
+// Returns size, or 0 once a write to the file failed
+size_t file_sink_write(FileSink* s, const void* data, size_t size);
+
+// Writes what's left and closes the file, returns false if any write failed. hash_out may be NULL.
+bool file_sink_close(FileSink* s, u8* hash_out);
+
+// Sustained rate from the first write to the close, in MB/s
+double file_sink_get_rate(FileSink* s);
+
+// CURLOPT_WRITEFUNCTION writing to the FileSink set with CURLOPT_WRITEDATA
+size_t file_sink_curl_write(char* ptr, size_t size, size_t nmemb, void* userdata);
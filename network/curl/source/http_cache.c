@@ -0,0 +1,231 @@
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "http_cache.h"
+
+#define HTTP_CACHE_MAGIC 0x58494348 // "HCIX"
+#define HTTP_CACHE_VERSION 1
+
+// Index file: this header, then count HttpCacheEntry
+typedef struct {
+    u32 magic;
+    u32 version;
+    u32 count;
+    u32 reserved;
+    u64 use_counter;
+} HttpCacheIndexHeader;
+
+static u64 http_cache_key(const char* url)
+{
+    u8 hash[SHA256_HASH_SIZE];
+    sha256CalculateHash(hash, url, strlen(url));
+    u64 key;
+    memcpy(&key, hash, sizeof(key));
+    return key;
+}
+
+static void http_cache_entry_path(const HttpCache* c, u64 key, char* path, size_t size)
+{
+    snprintf(path, size, "%s/%016llx.bin", c->dir, (unsigned long long)key);
+}
+
+bool http_cache_open(HttpCache* c, const char* dir, u64 max_bytes)
+{
+    memset(c, 0, sizeof(*c));
+    if (strlen(dir) >= sizeof(c->dir))
+        return false;
+    strcpy(c->dir, dir);
+    c->max_bytes = max_bytes;
+
+    struct stat st;
+    if (stat(dir, &st) != 0 && mkdir(dir, 0777) != 0)
+        return false;
+
+    char path[160];
+    snprintf(path, sizeof(path), "%s/index.bin", c->dir);
+    FILE* f = fopen(path, "rb");
+    if (!f)
+        return true; // Empty cache
+
+    // A bad index only loses the cache, the orphaned files are overwritten when their URLs are cached again
+    HttpCacheIndexHeader hdr;
+    bool ok = fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == HTTP_CACHE_MAGIC && hdr.version == HTTP_CACHE_VERSION &&
+        hdr.count <= HTTP_CACHE_MAX_ENTRIES && fread(c->entries, sizeof(HttpCacheEntry), hdr.count, f) == hdr.count;
+    fclose(f);
+
+    if (ok) {
+        c->count = hdr.count;
+        c->use_counter = hdr.use_counter;
+        for (u32 i = 0; i < c->count; i++) {
+            HttpCacheEntry* e = &c->entries[i];
+            e->url[sizeof(e->url) - 1] = 0;
+            e->etag[sizeof(e->etag) - 1] = 0;
+            e->last_modified[sizeof(e->last_modified) - 1] = 0;
+            c->total_bytes += e->size;
+        }
+    }
+    else
+        memset(c->entries, 0, sizeof(c->entries));
+    return true;
+}
+
+bool http_cache_save_index(HttpCache* c)
+{
+    char path[160], tmp_path[160];
+    snprintf(path, sizeof(path), "%s/index.bin", c->dir);
+    snprintf(tmp_path, sizeof(tmp_path), "%s/index.tmp", c->dir);
+
+    FILE* f = fopen(tmp_path, "wb");
+    if (!f)
+        return false;
+
+    HttpCacheIndexHeader hdr = { HTTP_CACHE_MAGIC, HTTP_CACHE_VERSION, c->count, 0, c->use_counter };
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1 && fwrite(c->entries, sizeof(HttpCacheEntry), c->count, f) == c->count;
+    if (fclose(f) != 0)
+        ok = false;
+
+    // Written aside first, so that a crash while saving doesn't leave a truncated index. FS can't rename over a file.
+    if (ok) {
+        unlink(path);
+        ok = rename(tmp_path, path) == 0;
+    }
+    if (!ok)
+        unlink(tmp_path);
+    else
+        c->dirty = false;
+    return ok;
+}
+
+void http_cache_close(HttpCache* c)
+{
+    if (c->dirty)
+        http_cache_save_index(c);
+}
+
+HttpCacheEntry* http_cache_find(HttpCache* c, const char* url)
+{
+    u64 key = http_cache_key(url);
+    for (u32 i = 0; i < c->count; i++) {
+        HttpCacheEntry* e = &c->entries[i];
+        if (e->key == key && strcmp(e->url, url) == 0)
+            return e;
+    }
+    return NULL;
+}
+
+struct curl_slist* http_cache_add_conditions(const HttpCacheEntry* e, struct curl_slist* list)
+{
+    char header[32 + HTTP_CACHE_ETAG_MAX];
+    if (e->etag[0]) {
+        snprintf(header, sizeof(header), "If-None-Match: %s", e->etag);
+        list = curl_slist_append(list, header);
+    }
+    if (e->last_modified[0]) {
+        snprintf(header, sizeof(header), "If-Modified-Since: %s", e->last_modified);
+        list = curl_slist_append(list, header);
+    }
+    return list;
+}
+
+void http_cache_remove(HttpCache* c, HttpCacheEntry* e)
+{
+    char path[160];
+    http_cache_entry_path(c, e->key, path, sizeof(path));
+    unlink(path);
+
+    c->total_bytes -= e->size;
+    *e = c->entries[--c->count];
+    c->dirty = true;
+}
+
+u8* http_cache_load(HttpCache* c, HttpCacheEntry* e, size_t* size)
+{
+    char path[160];
+    http_cache_entry_path(c, e->key, path, sizeof(path));
+
+    u8* data = NULL;
+    FILE* f = fopen(path, "rb");
+    if (f) {
+        data = (u8*)malloc(e->size ? e->size : 1);
+        if (data && fread(data, 1, e->size, f) != e->size) {
+            free(data);
+            data = NULL;
+        }
+        fclose(f);
+    }
+
+    // Deleted or damaged: the next request downloads it again
+    if (!data) {
+        http_cache_remove(c, e);
+        return NULL;
+    }
+
+    e->last_use = ++c->use_counter;
+    c->dirty = true;
+    c->stats.hits++;
+    c->stats.bytes_saved += e->size;
+    *size = e->size;
+    return data;
+}
+
+// Evicts the least recently used entries until there's room for size bytes, and an entry
+static void http_cache_make_room(HttpCache* c, u64 size)
+{
+    while (c->count && (c->count == HTTP_CACHE_MAX_ENTRIES || c->total_bytes + size > c->max_bytes)) {
+        HttpCacheEntry* lru = &c->entries[0];
+        for (u32 i = 1; i < c->count; i++) {
+            if (c->entries[i].last_use < lru->last_use)
+                lru = &c->entries[i];
+        }
+        http_cache_remove(c, lru);
+        c->stats.evicted++;
+    }
+}
+
+bool http_cache_store(HttpCache* c, const char* url, const char* etag, const char* last_modified, const u8* data, size_t size)
+{
+    // Without a validator the response can't be revalidated, and a truncated one would never match
+    if (strlen(etag) >= HTTP_CACHE_ETAG_MAX)
+        etag = "";
+    if (strlen(last_modified) >= HTTP_CACHE_DATE_MAX)
+        last_modified = "";
+    if ((!etag[0] && !last_modified[0]) || strlen(url) >= HTTP_CACHE_URL_MAX || size > HTTP_CACHE_MAX_ENTRY_SIZE || size > c->max_bytes)
+        return false;
+
+    HttpCacheEntry* old = http_cache_find(c, url);
+    if (old)
+        http_cache_remove(c, old);
+    http_cache_make_room(c, size);
+
+    u64 key = http_cache_key(url);
+    char path[160];
+    http_cache_entry_path(c, key, path, sizeof(path));
+
+    FILE* f = fopen(path, "wb");
+    if (!f)
+        return false;
+    bool ok = fwrite(data, 1, size, f) == size;
+    if (fclose(f) != 0)
+        ok = false;
+    if (!ok) {
+        unlink(path);
+        return false;
+    }
+
+    HttpCacheEntry* e = &c->entries[c->count++];
+    memset(e, 0, sizeof(*e));
+    e->key = key;
+    e->last_use = ++c->use_counter;
+    e->size = size;
+    strcpy(e->url, url);
+    strcpy(e->etag, etag);
+    strcpy(e->last_modified, last_modified);
+
+    c->total_bytes += size;
+    c->dirty = true;
+    c->stats.stored++;
+    return true;
+}
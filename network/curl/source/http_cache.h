@@ -0,0 +1,64 @@
+#pragma once
+#include <switch.h>
+
+#include <curl/curl.h>
+
+// On-disk cache of HTTP responses, keyed by URL.
+//
+// Responses which come with an ETag or a Last-Modified header are stored in dir, one file per URL, along with the
+// validators in an index file. The next request for the URL is sent with If-None-Match/If-Modified-Since, and when the
+// server answers 304 Not Modified the body is read back from the cache instead of being downloaded again. When the
+// cache goes over max_bytes (or HTTP_CACHE_MAX_ENTRIES), the least recently used responses are evicted.
+//
+// Not thread-safe: the download manager only uses it from its network thread.
+
+#define HTTP_CACHE_MAX_ENTRIES 128
+#define HTTP_CACHE_MAX_ENTRY_SIZE 0x100000    // Larger responses aren't cached
+#define HTTP_CACHE_URL_MAX 512
+#define HTTP_CACHE_ETAG_MAX 128
+#define HTTP_CACHE_DATE_MAX 64
+
+typedef struct {
+    u64 key;                                  // Hash of the URL, also the name of the file
+    u64 last_use;                             // Value of use_counter when it was last stored or read
+    u64 size;
+    char url[HTTP_CACHE_URL_MAX];
+    char etag[HTTP_CACHE_ETAG_MAX];           // Empty when the server didn't send one
+    char last_modified[HTTP_CACHE_DATE_MAX];
+} HttpCacheEntry;
+
+typedef struct {
+    u64 hits;                                 // 304 answered from the cache
+    u64 stored, evicted;
+    u64 bytes_saved;                          // Bodies read from the cache instead of downloaded
+} HttpCacheStats;
+
+typedef struct {
+    char dir[128];
+    u64 max_bytes;
+    u64 total_bytes;
+    u64 use_counter;
+    HttpCacheEntry entries[HTTP_CACHE_MAX_ENTRIES];
+    u32 count;
+    bool dirty;                               // The index changed since it was saved
+    HttpCacheStats stats;
+} HttpCache;
+
+// Loads the index from dir, which is created if needed. Returns false if dir can't be used.
+bool http_cache_open(HttpCache* c, const char* dir, u64 max_bytes);
+// Saves the index
+void http_cache_close(HttpCache* c);
+bool http_cache_save_index(HttpCache* c);
+
+HttpCacheEntry* http_cache_find(HttpCache* c, const char* url);
+
+// Appends the If-None-Match/If-Modified-Since headers for the entry to list, returns the new list
+struct curl_slist* http_cache_add_conditions(const HttpCacheEntry* e, struct curl_slist* list);
+
+// Reads the cached body, to be freed with free(), or returns NULL and drops the entry if it can't be read
+u8* http_cache_load(HttpCache* c, HttpCacheEntry* e, size_t* size);
+
+// Stores a response for url, replacing the one cached before. Returns false if it isn't cacheable, or can't be written.
+bool http_cache_store(HttpCache* c, const char* url, const char* etag, const char* last_modified, const u8* data, size_t size);
+
+void http_cache_remove(HttpCache* c, HttpCacheEntry* e);
@@ -8,34 +8,52 @@
 
 #include <curl/curl.h>
 
-// This example shows how to use libcurl. For more examples, see the official examples: https://curl.haxx.se/libcurl/c/example.html
-
-void network_request(void) {
-    CURL *curl;
-    CURLcode res;
-
-    printf("curl init\n");
-    curl_global_init(CURL_GLOBAL_DEFAULT);
-
-    curl = curl_easy_init();
-    if (curl) {
-        curl_easy_setopt(curl, CURLOPT_URL, "https://example.com/");
-        curl_easy_setopt(curl, CURLOPT_USERAGENT, "libnx curl example/1.0");
-        // Add any other options here.
-
-        printf("curl_easy_perform\n");
-        consoleUpdate(NULL);
-
-        res = curl_easy_perform(curl);
-        if (res != CURLE_OK) printf("curl_easy_perform() failed: %s\n", curl_easy_strerror(res));
-
-        // In an actual app you should return an error on failure, following cleanup.
+#include "download_manager.h"
+#include "range_download.h"
 
-        printf("cleanup\n");
-        curl_easy_cleanup(curl);
+// This example shows how to use libcurl. For more examples, see the official examples: https://curl.haxx.se/libcurl/c/example.html
+// Downloads run on a network thread, several at once, see download_manager.h.
+
+// List of URLs to download with A, one per line. Without it, DEFAULT_URL is downloaded DEFAULT_COUNT times.
+#define MANIFEST_PATH "sdmc:/curl_manifest.txt"
+#define DEFAULT_URL "https://example.com/"
+#define DEFAULT_COUNT 200
+// Downloaded to STREAM_PATH with Y, through large double-buffered writes. Replace it with a large file to measure the SD card write rate.
+#define STREAM_URL "https://example.com/"
+#define STREAM_PATH "sdmc:/curl_download.bin"
+// Downloaded to RANGE_PATH with X, in byte ranges over RANGE_CONNECTIONS connections. Pressing X again after B resumes it.
+#define RANGE_URL "https://example.com/"
+#define RANGE_PATH "sdmc:/curl_range.bin"
+#define RANGE_CONNECTIONS 4
+// Downloads to memory are cached there, and revalidated with the server the next time. Pressing A again mostly gets 304s.
+#define CACHE_DIR "sdmc:/switch/curl_cache"
+#define CACHE_MAX_BYTES (16*1024*1024)
+
+typedef struct {
+    u32 queued, completed, failed, cached;
+    u64 bytes;
+    long connects;
+    u64 start_tick;
+} DownloadStats;
+
+// Queues every URL of the manifest, returns their count.
+u32 queue_manifest(DownloadManager *manager) {
+    u32 count = 0;
+    FILE *f = fopen(MANIFEST_PATH, "r");
+    if (f) {
+        char line[DOWNLOAD_URL_MAX];
+        while (fgets(line, sizeof(line), f)) {
+            line[strcspn(line, "\r\n")] = 0;
+            if (line[0] && download_manager_add(manager, line, NULL)) count++;
+        }
+        fclose(f);
+        return count;
     }
 
-    curl_global_cleanup();
+    for (u32 i=0; i<DEFAULT_COUNT; i++) {
+        if (download_manager_add(manager, DEFAULT_URL, NULL)) count++;
+    }
+    return count;
 }
 
 // Main program entrypoint
@@ -52,7 +70,27 @@ int main(int argc, char* argv[])
 
     printf("curl example\n");
 
-    network_request();
+    printf("curl init\n");
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+
+    static DownloadManager manager;
+    Result rc = download_manager_init(&manager, DOWNLOAD_MAX_CONCURRENT);
+    static HttpCache cache;
+    bool cache_open = false;
+    if (R_FAILED(rc)) printf("download_manager_init() failed: 0x%x\n", rc);
+    else {
+        cache_open = http_cache_open(&cache, CACHE_DIR, CACHE_MAX_BYTES);
+        if (cache_open) download_manager_set_cache(&manager, &cache);
+        else printf("Can't open the cache in " CACHE_DIR ".\n");
+
+        printf("Press A to download the URLs of " MANIFEST_PATH " (or " DEFAULT_URL " %d times).\n", DEFAULT_COUNT);
+        printf("Press Y to download " STREAM_URL " to " STREAM_PATH ".\n");
+        printf("Press X to download " RANGE_URL " to " RANGE_PATH " in ranges, B to stop it.\n");
+    }
+
+    DownloadStats stats = {0};
+    static RangeDownload range;
+    bool range_running = false;
 
     // Main loop
     while(appletMainLoop())
@@ -67,12 +105,81 @@ int main(int argc, char* argv[])
         if (kDown & KEY_PLUS)
             break; // break in order to return to hbmenu
 
-        // Your code goes here
+        if (R_SUCCEEDED(rc)) {
+            if ((kDown & KEY_A) && stats.completed == stats.queued) {
+                memset(&stats, 0, sizeof(stats));
+                stats.start_tick = armGetSystemTick();
+                stats.queued = queue_manifest(&manager);
+            }
+
+            if (kDown & KEY_Y) {
+                if (download_manager_add_file(&manager, STREAM_URL, STREAM_PATH, NULL)) printf("Downloading " STREAM_URL " to " STREAM_PATH "...\n");
+            }
+
+            if ((kDown & KEY_X) && !range_running) {
+                Result rc2 = range_download_start(&range, RANGE_URL, RANGE_PATH, RANGE_CONNECTIONS);
+                if (R_FAILED(rc2)) printf("range_download_start() failed: 0x%x\n", rc2);
+                range_running = R_SUCCEEDED(rc2);
+            }
+
+            if (range_running) {
+                bool done = range_download_poll(&range);
+                if (!done && (kDown & KEY_B)) {
+                    range_download_close(&range);
+                    printf("Stopped with %u/%u segments complete, press X to resume.\n", range.segments_done, range.num_segments);
+                    range_running = false;
+                }
+                else if (done) {
+                    printf(RANGE_PATH ": %s, HTTP %ld, 0x%llx bytes in %u segments (%u resumed), %.2f MB/s\n", curl_easy_strerror(range.res), range.http_code,
+                        (unsigned long long)range.size, range.num_segments, range.segments_resumed, range_download_get_rate(&range));
+                    range_download_close(&range);
+                    range_running = false;
+                }
+                else
+                    printf("\x1b[22;1Hranges: %u/%u segments, %.2f MB/s      \n", range.segments_done, range.num_segments, range_download_get_rate(&range));
+            }
+
+            // Downloads which finished since the previous frame.
+            DownloadResult res;
+            while (download_manager_poll(&manager, &res)) {
+                if (res.to_file) {
+                    printf("%s: 0x%zx bytes, %s, HTTP %ld, in %.2f s, written at %.2f MB/s with %u stalls\nSHA-256: ", STREAM_PATH, res.size,
+                        curl_easy_strerror(res.res), res.http_code, armTicksToNs(res.transfer_ticks) / 1000000000.0, res.write_rate, res.write_stalls);
+                    for (u32 i=0; i<sizeof(res.sha256); i++) printf("%02x", res.sha256[i]);
+                    printf("\n");
+                    continue;
+                }
+
+                stats.completed++;
+                stats.bytes += res.size;
+                stats.connects += res.connects;
+                if (res.from_cache) stats.cached++;
+                if (res.res != CURLE_OK || res.http_code >= 400) {
+                    stats.failed++;
+                    printf("download %u failed: %s, HTTP %ld\n", res.id, curl_easy_strerror(res.res), res.http_code);
+                }
+
+                // In an actual app you'd use the data here.
+                free(res.data);
+            }
+
+            if (stats.queued) {
+                printf("\x1b[20;1H%u/%u downloaded, %u failed, %u from cache, %llu bytes, %ld connections opened, %.2f s      \n", stats.completed, stats.queued,
+                    stats.failed, stats.cached, (unsigned long long)stats.bytes, stats.connects, armTicksToNs(armGetSystemTick() - stats.start_tick) / 1000000000.0);
+                if (stats.completed == stats.queued) stats.queued = stats.completed = 0;
+            }
+        }
 
         // Update the console, sending a new frame to the display
         consoleUpdate(NULL);
     }
 
+    printf("cleanup\n");
+    if (range_running) range_download_close(&range);
+    if (R_SUCCEEDED(rc)) download_manager_exit(&manager);
+    if (cache_open) http_cache_close(&cache);
+    curl_global_cleanup();
+
     socketExit();
     // Deinitialize and clean up resources used by the console (important!)
     consoleExit(NULL);
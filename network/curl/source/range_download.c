@@ -0,0 +1,411 @@
+#include <string.h>
+#include <strings.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <malloc.h>
+
+#include "range_download.h"
+
+#define RANGE_JOURNAL_MAGIC 0x4C4E524A // "JRNL"
+
+typedef struct {
+    u32 magic;
+    u32 num_segments;
+    u64 size;
+    u64 segment_size;
+    char validator[128];
+} RangeJournalHeader;
+
+static bool range_is_done(RangeDownload* d, u32 i)
+{
+    return d->done[i / 8] & (1 << (i % 8));
+}
+
+static u64 range_segment_start(RangeDownload* d, u32 i)
+{
+    return i * d->segment_size;
+}
+
+// 0 when the size is unknown
+static u64 range_segment_length(RangeDownload* d, u32 i)
+{
+    u64 start = range_segment_start(d, i);
+    return d->size - start < d->segment_size ? d->size - start : d->segment_size;
+}
+
+static void range_write_journal(RangeDownload* d)
+{
+    FILE* f = fopen(d->journal_path, "wb");
+    if (!f)
+        return;
+
+    RangeJournalHeader hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = RANGE_JOURNAL_MAGIC;
+    hdr.num_segments = d->num_segments;
+    hdr.size = d->size;
+    hdr.segment_size = d->segment_size;
+    memcpy(hdr.validator, d->validator, sizeof(hdr.validator));
+    fwrite(&hdr, sizeof(hdr), 1, f);
+    fwrite(d->done, (d->num_segments + 7) / 8, 1, f);
+    fclose(f);
+}
+
+// Returns true if the journal is for this same file, and loads which segments are complete
+static bool range_read_journal(RangeDownload* d)
+{
+    FILE* f = fopen(d->journal_path, "rb");
+    if (!f)
+        return false;
+
+    RangeJournalHeader hdr;
+    bool ok = fread(&hdr, sizeof(hdr), 1, f) == 1 && hdr.magic == RANGE_JOURNAL_MAGIC &&
+        hdr.num_segments == d->num_segments && hdr.size == d->size && hdr.segment_size == d->segment_size &&
+        memcmp(hdr.validator, d->validator, sizeof(hdr.validator)) == 0;
+    if (ok)
+        ok = fread(d->done, (d->num_segments + 7) / 8, 1, f) == 1;
+    fclose(f);
+    return ok;
+}
+
+static size_t range_header(char* buffer, size_t size, size_t nitems, void* userdata)
+{
+    RangeDownload* d = (RangeDownload*)userdata;
+    size_t n = size * nitems;
+
+    // Each response of a redirect starts over
+    if (n >= 5 && strncmp(buffer, "HTTP/", 5) == 0) {
+        d->ranges = false;
+        d->validator[0] = 0;
+    }
+    else if (n >= 20 && strncasecmp(buffer, "Accept-Ranges: bytes", 20) == 0)
+        d->ranges = true;
+    else if ((n > 6 && strncasecmp(buffer, "ETag: ", 6) == 0) ||
+        (n > 15 && strncasecmp(buffer, "Last-Modified: ", 15) == 0 && !d->validator[0])) {
+        const char* value = strchr(buffer, ':') + 2;
+        size_t len = n - (value - buffer);
+        while (len && (value[len - 1] == '\r' || value[len - 1] == '\n'))
+            len--;
+        if (len >= sizeof(d->validator))
+            len = sizeof(d->validator) - 1;
+        memcpy(d->validator, value, len);
+        d->validator[len] = 0;
+    }
+    return n;
+}
+
+static void range_setup(RangeDownload* d, CURL* easy)
+{
+    curl_easy_reset(easy);
+    curl_easy_setopt(easy, CURLOPT_URL, d->url);
+    curl_easy_setopt(easy, CURLOPT_USERAGENT, "libnx curl example/1.0");
+    curl_easy_setopt(easy, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);
+}
+
+// HEAD request, for the size of the file and whether it can be fetched in ranges
+static CURLcode range_probe(RangeDownload* d, CURL* easy)
+{
+    range_setup(d, easy);
+    curl_easy_setopt(easy, CURLOPT_NOBODY, 1L);
+    curl_easy_setopt(easy, CURLOPT_HEADERFUNCTION, range_header);
+    curl_easy_setopt(easy, CURLOPT_HEADERDATA, d);
+
+    CURLcode res = curl_easy_perform(easy);
+    if (res != CURLE_OK)
+        return res;
+
+    curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &d->http_code);
+    if (d->http_code >= 400)
+        return CURLE_HTTP_RETURNED_ERROR;
+
+    curl_off_t length = -1;
+    curl_easy_getinfo(easy, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &length);
+    d->size = length > 0 ? length : 0;
+    if (!d->size)
+        d->ranges = false;
+    return CURLE_OK;
+}
+
+static bool range_flush(RangeConnection* c)
+{
+    RangeDownload* d = c->d;
+    if (c->fill) {
+        if (fseeko(d->f, c->offset, SEEK_SET) != 0 || fwrite(c->buf, 1, c->fill, d->f) != c->fill)
+            c->write_error = true;
+        c->offset += c->fill;
+        c->fill = 0;
+    }
+    return !c->write_error;
+}
+
+static size_t range_write(char* ptr, size_t size, size_t nmemb, void* userdata)
+{
+    RangeConnection* c = (RangeConnection*)userdata;
+    RangeDownload* d = c->d;
+    size_t n = size * nmemb;
+
+    // A server which ignores the range sends the whole file, which mustn't be written at the offset of the segment
+    if (d->ranges && c->received == 0) {
+        long code = 0;
+        curl_easy_getinfo(c->easy, CURLINFO_RESPONSE_CODE, &code);
+        if (code != 206)
+            return 0;
+    }
+
+    size_t left = n;
+    while (left) {
+        size_t chunk = RANGE_WRITE_BUFFER_SIZE - c->fill;
+        if (chunk > left)
+            chunk = left;
+        memcpy(c->buf + c->fill, ptr, chunk);
+        c->fill += chunk;
+        ptr += chunk;
+        left -= chunk;
+
+        if (c->fill == RANGE_WRITE_BUFFER_SIZE && !range_flush(c))
+            return 0;
+    }
+
+    c->received += n;
+    __atomic_add_fetch(&d->downloaded, n, __ATOMIC_RELAXED);
+    return n;
+}
+
+static bool range_start_segment(RangeDownload* d, RangeConnection* c)
+{
+    while (d->first_todo < d->num_segments && d->state[d->first_todo] != RangeSegment_Todo)
+        d->first_todo++;
+    if (d->first_todo == d->num_segments)
+        return false;
+
+    u32 i = d->first_todo++;
+    d->state[i] = RangeSegment_Active;
+    c->segment = i;
+    c->offset = range_segment_start(d, i);
+    c->received = 0;
+    c->fill = 0;
+    c->write_error = false;
+
+    range_setup(d, c->easy);
+    curl_easy_setopt(c->easy, CURLOPT_WRITEFUNCTION, range_write);
+    curl_easy_setopt(c->easy, CURLOPT_WRITEDATA, c);
+    curl_easy_setopt(c->easy, CURLOPT_PRIVATE, c);
+    curl_easy_setopt(c->easy, CURLOPT_BUFFERSIZE, CURL_MAX_READ_SIZE);
+    if (d->ranges) {
+        char range[64];
+        snprintf(range, sizeof(range), "%llu-%llu", (unsigned long long)c->offset,
+            (unsigned long long)(c->offset + range_segment_length(d, i) - 1));
+        curl_easy_setopt(c->easy, CURLOPT_RANGE, range);
+    }
+    curl_multi_add_handle(d->multi, c->easy);
+    return true;
+}
+
+static void range_finish_segment(RangeDownload* d, RangeConnection* c, CURLcode res)
+{
+    u32 i = c->segment;
+    curl_multi_remove_handle(d->multi, c->easy);
+    c->segment = -1;
+
+    bool ok = range_flush(c) && res == CURLE_OK;
+    curl_easy_getinfo(c->easy, CURLINFO_RESPONSE_CODE, &d->http_code);
+    if (ok && d->size)
+        ok = c->received == range_segment_length(d, i);
+
+    if (ok) {
+        d->state[i] = RangeSegment_Done;
+        d->done[i / 8] |= 1 << (i % 8);
+        d->segments_done++;
+        if (d->ranges)
+            range_write_journal(d);
+        return;
+    }
+
+    // Retried from the start of the segment, on whichever connection is free first
+    if (c->write_error || !d->ranges || ++d->retries[i] > RANGE_MAX_RETRIES) {
+        d->res = c->write_error ? CURLE_WRITE_ERROR : res != CURLE_OK ? res : CURLE_PARTIAL_FILE;
+        return;
+    }
+    d->state[i] = RangeSegment_Todo;
+    if (i < d->first_todo)
+        d->first_todo = i;
+}
+
+static void range_run(RangeDownload* d)
+{
+    CURL* easy = curl_easy_init();
+    if (!easy) {
+        d->res = CURLE_OUT_OF_MEMORY;
+        return;
+    }
+    d->res = range_probe(d, easy);
+    curl_easy_cleanup(easy);
+    if (d->res != CURLE_OK)
+        return;
+
+    // Segments no smaller than RANGE_MIN_SEGMENT_SIZE, and at most RANGE_MAX_SEGMENTS of them
+    if (d->ranges) {
+        d->segment_size = (d->size + RANGE_MAX_SEGMENTS - 1) / RANGE_MAX_SEGMENTS;
+        if (d->segment_size < RANGE_MIN_SEGMENT_SIZE)
+            d->segment_size = RANGE_MIN_SEGMENT_SIZE;
+        d->num_segments = (d->size + d->segment_size - 1) / d->segment_size;
+    }
+    else {
+        d->segment_size = d->size;
+        d->num_segments = 1;
+    }
+
+    // Resume into the existing file, or start over
+    if (d->ranges && d->validator[0] && range_read_journal(d))
+        d->f = fopen(d->path, "r+b");
+    if (!d->f) {
+        memset(d->done, 0, sizeof(d->done));
+        d->f = fopen(d->path, "wb");
+        if (!d->f) {
+            d->res = CURLE_WRITE_ERROR;
+            return;
+        }
+        // Allocated up front, rather than growing as ranges land all over it
+        if (d->size)
+            ftruncate(fileno(d->f), d->size);
+        if (d->ranges)
+            range_write_journal(d);
+    }
+    setvbuf(d->f, NULL, _IONBF, 0);
+
+    for (u32 i = 0; i < d->num_segments; i++) {
+        if (range_is_done(d, i)) {
+            d->state[i] = RangeSegment_Done;
+            d->segments_resumed++;
+            d->segments_done++;
+        }
+    }
+
+    // Each range on its own connection, rather than multiplexed over one
+    d->multi = curl_multi_init();
+    if (!d->multi) {
+        d->res = CURLE_OUT_OF_MEMORY;
+        return;
+    }
+    curl_multi_setopt(d->multi, CURLMOPT_PIPELINING, CURLPIPE_NOTHING);
+    curl_multi_setopt(d->multi, CURLMOPT_MAX_HOST_CONNECTIONS, (long)d->num_connections);
+
+    for (u32 i = 0; i < d->num_connections; i++) {
+        RangeConnection* c = &d->conns[i];
+        c->d = d;
+        c->segment = -1;
+        c->easy = curl_easy_init();
+        c->buf = (u8*)memalign(0x1000, RANGE_WRITE_BUFFER_SIZE);
+        if (!c->easy || !c->buf) {
+            d->res = CURLE_OUT_OF_MEMORY;
+            return;
+        }
+    }
+
+    u32 active = 0;
+    while (d->res == CURLE_OK && !__atomic_load_n(&d->cancel, __ATOMIC_ACQUIRE)) {
+        for (u32 i = 0; i < d->num_connections; i++) {
+            if (d->conns[i].segment < 0 && range_start_segment(d, &d->conns[i]))
+                active++;
+        }
+        if (!active)
+            break;
+
+        int running = 0;
+        curl_multi_perform(d->multi, &running);
+
+        CURLMsg* msg;
+        int left = 0;
+        while ((msg = curl_multi_info_read(d->multi, &left))) {
+            if (msg->msg != CURLMSG_DONE)
+                continue;
+
+            RangeConnection* c = NULL;
+            curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, (char**)&c);
+            range_finish_segment(d, c, msg->data.result);
+            active--;
+        }
+
+        int numfds = 0;
+        curl_multi_wait(d->multi, NULL, 0, 100, &numfds);
+    }
+
+    if (d->res == CURLE_OK && d->segments_done < d->num_segments)
+        d->res = CURLE_ABORTED_BY_CALLBACK; // Cancelled
+}
+
+static void range_thread_func(void* arg)
+{
+    RangeDownload* d = (RangeDownload*)arg;
+
+    range_run(d);
+    d->end_tick = armGetSystemTick();
+
+    // Segments which were still running are just dropped: the journal only lists complete ones
+    for (u32 i = 0; i < RANGE_MAX_CONNECTIONS; i++) {
+        RangeConnection* c = &d->conns[i];
+        if (c->easy) {
+            if (c->segment >= 0)
+                curl_multi_remove_handle(d->multi, c->easy);
+            curl_easy_cleanup(c->easy);
+        }
+        free(c->buf);
+    }
+    if (d->multi)
+        curl_multi_cleanup(d->multi);
+
+    if (d->f) {
+        if (fclose(d->f) != 0 && d->res == CURLE_OK)
+            d->res = CURLE_WRITE_ERROR;
+        d->f = NULL;
+    }
+    if (d->res == CURLE_OK)
+        unlink(d->journal_path);
+
+    ueventSignal(&d->done_event);
+}
+
+Result range_download_start(RangeDownload* d, const char* url, const char* path, u32 num_connections)
+{
+    memset(d, 0, sizeof(*d));
+    if (strlen(url) >= sizeof(d->url) || strlen(path) >= sizeof(d->path))
+        return MAKERESULT(Module_Libnx, LibnxError_BadInput);
+
+    strcpy(d->url, url);
+    strcpy(d->path, path);
+    snprintf(d->journal_path, sizeof(d->journal_path), "%s.journal", path);
+    d->num_connections = num_connections == 0 || num_connections > RANGE_MAX_CONNECTIONS ? RANGE_MAX_CONNECTIONS : num_connections;
+    ueventCreate(&d->done_event, false);
+    d->start_tick = armGetSystemTick();
+
+    // TLS needs a large stack
+    Result rc = threadCreate(&d->thread, range_thread_func, d, NULL, 0x20000, 0x2C, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&d->thread);
+        if (R_FAILED(rc))
+            threadClose(&d->thread);
+    }
+    if (R_FAILED(rc))
+        memset(d, 0, sizeof(*d));
+    return rc;
+}
+
+bool range_download_poll(RangeDownload* d)
+{
+    return R_SUCCEEDED(waitSingle(waiterForUEvent(&d->done_event), 0));
+}
+
+void range_download_close(RangeDownload* d)
+{
+    __atomic_store_n(&d->cancel, true, __ATOMIC_RELEASE);
+    threadWaitForExit(&d->thread);
+    threadClose(&d->thread);
+}
+
+double range_download_get_rate(RangeDownload* d)
+{
+    u64 end = d->end_tick ? d->end_tick : armGetSystemTick();
+    u64 ns = armTicksToNs(end - d->start_tick);
+    return ns ? __atomic_load_n(&d->downloaded, __ATOMIC_RELAXED) * 1000.0 / ns : 0.0;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <stdio.h>
+#include <switch.h>
+
+#include <curl/curl.h>
+
+// Segmented download of one large file, over several connections at once.
+//
+// A single transfer over Wi-Fi is bound by the round trip time rather than the bandwidth. Instead, the size of the
+// file is probed with a HEAD request, and the file is split into segments which are fetched with HTTP range requests,
+// connections of them at once, each on its own connection. Each range is written at its offset in the file, which is
+// preallocated.
+//
+// A journal next to the file (path + ".journal") records the size, the ETag or Last-Modified of the file, and which
+// segments are complete. Starting the same download again after it was cancelled or interrupted only fetches the
+// missing segments, unless the file changed on the server. The journal is deleted once the download completes.
+//
+// Servers which don't support ranges, or don't report the size, get the whole file in one transfer (without resume).
+
+#define RANGE_MAX_CONNECTIONS 8
+#define RANGE_MAX_SEGMENTS 4096
+#define RANGE_MIN_SEGMENT_SIZE 0x400000   // 4 MiB
+#define RANGE_WRITE_BUFFER_SIZE 0x40000   // Per connection, written at its offset when full
+#define RANGE_MAX_RETRIES 3               // Per segment
+
+typedef struct RangeDownload RangeDownload;
+
+enum {
+    RangeSegment_Todo,
+    RangeSegment_Active,
+    RangeSegment_Done,
+};
+
+typedef struct {
+    RangeDownload* d;
+    CURL* easy;
+    s32 segment;                          // -1 when idle
+    u64 offset;                           // Where the buffer goes in the file
+    u64 received;                         // Bytes of the segment received so far
+    u8* buf;
+    size_t fill;
+    bool write_error;
+} RangeConnection;
+
+struct RangeDownload {
+    Thread thread;
+    UEvent done_event;
+    bool cancel;
+
+    char url[512];
+    char path[256];
+    char journal_path[264];
+    u32 num_connections;
+
+    // Written by the thread
+    FILE* f;
+    CURLM* multi;
+    RangeConnection conns[RANGE_MAX_CONNECTIONS];
+    u64 size;                             // 0 when unknown
+    bool ranges;                          // The server supports range requests
+    char validator[128];                  // ETag, or Last-Modified
+    u64 segment_size;
+    u32 num_segments;
+    u8 done[RANGE_MAX_SEGMENTS / 8];      // Bitmap of the complete segments, as stored in the journal
+    u8 state[RANGE_MAX_SEGMENTS];         // RangeSegment_*
+    u8 retries[RANGE_MAX_SEGMENTS];
+    u32 first_todo;                       // No segment below this is left to start
+    u32 segments_resumed;                 // Complete from the journal, when starting
+    u32 segments_done;
+
+    u64 downloaded;                       // Bytes received by this run, read with __atomic_load_n
+    CURLcode res;
+    long http_code;
+    u64 start_tick, end_tick;
+};
+
+// Starts downloading url to path, resuming if there's a journal for it. curl_global_init must have been called.
+Result range_download_start(RangeDownload* d, const char* url, const char* path, u32 num_connections);
+
+// Returns true once the download is complete or has failed, see res
+bool range_download_poll(RangeDownload* d);
+
+// Stops the download if it's running, the journal is kept so that it can be resumed. Must be called after a successful start.
+void range_download_close(RangeDownload* d);
+
+// Rate of this run, in MB/s
+double range_download_get_rate(RangeDownload* d);
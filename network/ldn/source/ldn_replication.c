@@ -0,0 +1,288 @@
+#include <string.h>
+
+#include "ldn_replication.h"
+
+#define LDN_REPL_MSG_SNAPSHOT 0xF0
+#define LDN_REPL_MSG_ACK      0xF1
+#define LDN_REPL_SNAPSHOT_HEADER_SIZE 13  // Type, seq, baseline, time
+
+static const LdnSnapshot s_empty_baseline;
+
+typedef struct {
+    u8* buf;
+    size_t size;
+    u32 pos;                              // In bits
+    bool overflow;
+} BitStream;
+
+static void bits_write(BitStream* bs, u32 value, u32 count)
+{
+    if (bs->pos + count > bs->size * 8) {
+        bs->overflow = true;
+        return;
+    }
+    for (u32 i = 0; i < count; i++, bs->pos++) {
+        if (value & (1U << i))
+            bs->buf[bs->pos >> 3] |= 1 << (bs->pos & 7);
+    }
+}
+
+static u32 bits_read(BitStream* bs, u32 count)
+{
+    if (bs->pos + count > bs->size * 8) {
+        bs->overflow = true;
+        return 0;
+    }
+    u32 value = 0;
+    for (u32 i = 0; i < count; i++, bs->pos++) {
+        if (bs->buf[bs->pos >> 3] & (1 << (bs->pos & 7)))
+            value |= 1U << i;
+    }
+    return value;
+}
+
+// Size classes of the differences, written as 2 bits before each of them
+static const u8 s_diff_bits[4] = { 4, 8, 16, 32 };
+
+static void delta_encode(BitStream* bs, const s32* base, const s32* cur)
+{
+    for (u32 i = 0; i < LDN_REPL_NUM_FIELDS; i++) {
+        if (cur[i] == base[i]) {
+            bits_write(bs, 0, 1);
+            continue;
+        }
+
+        // Zigzag, so that small negative differences are small too
+        s32 diff = (s32)((u32)cur[i] - (u32)base[i]);
+        u32 zz = ((u32)diff << 1) ^ (u32)(diff >> 31);
+
+        u32 cls = 0;
+        while (cls < 3 && (zz >> s_diff_bits[cls]))
+            cls++;
+
+        bits_write(bs, 1, 1);
+        bits_write(bs, cls, 2);
+        bits_write(bs, zz, s_diff_bits[cls]);
+    }
+}
+
+static void delta_decode(BitStream* bs, const s32* base, s32* out)
+{
+    for (u32 i = 0; i < LDN_REPL_NUM_FIELDS; i++) {
+        if (!bits_read(bs, 1)) {
+            out[i] = base[i];
+            continue;
+        }
+
+        u32 cls = bits_read(bs, 2);
+        u32 zz = bits_read(bs, s_diff_bits[cls]);
+        s32 diff = (s32)((zz >> 1) ^ -(zz & 1));
+        out[i] = (s32)((u32)base[i] + (u32)diff);
+    }
+}
+
+static u64 ldn_repl_now_ms(LdnReplication* r)
+{
+    return armTicksToNs(armGetSystemTick() - r->start_tick) / 1000000;
+}
+
+// Returns the snapshot with this seq if it's still in the history
+static const LdnSnapshot* ldn_repl_find(LdnReplication* r, u32 seq)
+{
+    if (!seq)
+        return &s_empty_baseline;
+    const LdnSnapshot* snap = &r->history[seq % LDN_REPL_HISTORY];
+    return snap->seq == seq ? snap : NULL;
+}
+
+void ldn_repl_init(LdnReplication* r, LdnSession* session, bool host, u32 interp_mask)
+{
+    memset(r, 0, sizeof(*r));
+    r->session = session;
+    r->host = host;
+    r->interp_mask = interp_mask;
+    r->start_tick = armGetSystemTick();
+}
+
+static void ldn_repl_host_send(LdnReplication* r, const LdnSnapshot* snap, u32 baseline)
+{
+    u8 msg[LDN_MESSAGE_MAX] = { LDN_REPL_MSG_SNAPSHOT };
+    memcpy(&msg[1], &snap->seq, 4);
+    memcpy(&msg[5], &baseline, 4);
+    memcpy(&msg[9], &snap->time_ms, 4);
+
+    BitStream bs = { .buf = &msg[LDN_REPL_SNAPSHOT_HEADER_SIZE], .size = sizeof(msg) - LDN_REPL_SNAPSHOT_HEADER_SIZE };
+    delta_encode(&bs, ldn_repl_find(r, baseline)->fields, snap->fields);
+
+    size_t size = LDN_REPL_SNAPSHOT_HEADER_SIZE + (bs.pos + 7) / 8;
+    if (!ldn_session_send(r->session, msg, size))
+        return;
+
+    r->stats.snapshots_sent++;
+    r->stats.bytes_sent += size;
+    r->stats.full_bytes += LDN_REPL_SNAPSHOT_HEADER_SIZE + sizeof(snap->fields);
+}
+
+void ldn_repl_host_update(LdnReplication* r, const s32* fields)
+{
+    memcpy(r->fields, fields, sizeof(r->fields));
+
+    u64 now = armGetSystemTick();
+    if (now < r->next_send_tick)
+        return;
+    r->next_send_tick = now + armNsToTicks(LDN_REPL_SEND_INTERVAL_MS * 1000000ULL);
+
+    u32 seq = ++r->latest;
+    LdnSnapshot* snap = &r->history[seq % LDN_REPL_HISTORY];
+    snap->seq = seq;
+    snap->time_ms = ldn_repl_now_ms(r);
+    memcpy(snap->fields, r->fields, sizeof(snap->fields));
+
+    // One delta per baseline acked by the peers, usually all of them acked the same one
+    u32 baselines[LDN_REPL_MAX_PEERS];
+    u32 num_baselines = 0;
+    const u64 timeout = armNsToTicks(LDN_REPL_PEER_TIMEOUT_MS * 1000000ULL);
+
+    for (u32 i = 0; i < r->num_peers;) {
+        LdnReplPeer* peer = &r->peers[i];
+        if (now - peer->ack_tick > timeout) {
+            *peer = r->peers[--r->num_peers];
+            continue;
+        }
+        i++;
+
+        u32 baseline = peer->acked;
+        if (seq - baseline >= LDN_REPL_HISTORY || !ldn_repl_find(r, baseline))
+            baseline = 0;
+
+        bool found = false;
+        for (u32 j = 0; j < num_baselines && !found; j++)
+            found = baselines[j] == baseline;
+        if (!found)
+            baselines[num_baselines++] = baseline;
+    }
+
+    // Nobody acked anything yet, peers which join get the full state
+    if (!num_baselines)
+        baselines[num_baselines++] = 0;
+
+    for (u32 i = 0; i < num_baselines; i++)
+        ldn_repl_host_send(r, snap, baselines[i]);
+}
+
+static void ldn_repl_host_handle_ack(LdnReplication* r, u32 from, u32 seq)
+{
+    LdnReplPeer* peer = NULL;
+    for (u32 i = 0; i < r->num_peers && !peer; i++) {
+        if (r->peers[i].addr == from)
+            peer = &r->peers[i];
+    }
+
+    if (!peer) {
+        if (r->num_peers == LDN_REPL_MAX_PEERS)
+            return;
+        peer = &r->peers[r->num_peers++];
+        peer->addr = from;
+        peer->acked = 0;
+    }
+
+    // Acks can arrive out of order
+    if (seq > peer->acked && seq <= r->latest)
+        peer->acked = seq;
+    peer->ack_tick = armGetSystemTick();
+}
+
+static void ldn_repl_client_handle_snapshot(LdnReplication* r, const u8* data, size_t size)
+{
+    u32 seq, baseline, time_ms;
+    memcpy(&seq, &data[1], 4);
+    memcpy(&baseline, &data[5], 4);
+    memcpy(&time_ms, &data[9], 4);
+
+    // Older, or the same snapshot encoded against another baseline
+    if (seq <= r->latest)
+        return;
+
+    const LdnSnapshot* base = ldn_repl_find(r, baseline);
+    if (!base) {
+        r->stats.undecodable++;
+        return;
+    }
+
+    LdnSnapshot snap = { .seq = seq, .time_ms = time_ms };
+    BitStream bs = { .buf = (u8*)&data[LDN_REPL_SNAPSHOT_HEADER_SIZE], .size = size - LDN_REPL_SNAPSHOT_HEADER_SIZE };
+    delta_decode(&bs, base->fields, snap.fields);
+    if (bs.overflow)
+        return;
+
+    r->history[seq % LDN_REPL_HISTORY] = snap;
+    r->latest = seq;
+    r->stats.snapshots_received++;
+
+    // Delays only ever make the estimate smaller: take the largest, and let it drift down slowly
+    double offset = (double)time_ms - (double)ldn_repl_now_ms(r);
+    if (!r->clock_valid || offset > r->clock_offset_ms)
+        r->clock_offset_ms = offset;
+    else
+        r->clock_offset_ms += (offset - r->clock_offset_ms) * 0.05;
+    r->clock_valid = true;
+
+    u8 ack[5] = { LDN_REPL_MSG_ACK };
+    memcpy(&ack[1], &seq, 4);
+    ldn_session_send(r->session, ack, sizeof(ack));
+}
+
+bool ldn_repl_handle_message(LdnReplication* r, const LdnMessage* msg)
+{
+    if (!msg->size || (msg->data[0] != LDN_REPL_MSG_SNAPSHOT && msg->data[0] != LDN_REPL_MSG_ACK))
+        return false;
+
+    if (msg->data[0] == LDN_REPL_MSG_ACK && r->host && msg->size == 5) {
+        u32 seq;
+        memcpy(&seq, &msg->data[1], 4);
+        ldn_repl_host_handle_ack(r, msg->from, seq);
+    }
+    else if (msg->data[0] == LDN_REPL_MSG_SNAPSHOT && !r->host && msg->size >= LDN_REPL_SNAPSHOT_HEADER_SIZE)
+        ldn_repl_client_handle_snapshot(r, msg->data, msg->size);
+
+    return true;
+}
+
+bool ldn_repl_client_sample(LdnReplication* r, s32* fields)
+{
+    if (r->host || !r->latest)
+        return false;
+
+    double render_ms = (double)ldn_repl_now_ms(r) + r->clock_offset_ms - LDN_REPL_INTERP_DELAY_MS;
+
+    // Find the snapshots before and after the render time, walking back from the newest
+    const LdnSnapshot* after = ldn_repl_find(r, r->latest);
+    const LdnSnapshot* before = NULL;
+    if (render_ms < after->time_ms) {
+        for (u32 seq = r->latest - 1; seq && r->latest - seq < LDN_REPL_HISTORY; seq--) {
+            const LdnSnapshot* snap = ldn_repl_find(r, seq);
+            if (!snap)
+                continue;
+            if (snap->time_ms <= render_ms) {
+                before = snap;
+                break;
+            }
+            after = snap;
+        }
+    }
+
+    // Past the newest snapshot, or before the oldest one: hold it rather than extrapolate
+    if (!before) {
+        memcpy(fields, after->fields, sizeof(after->fields));
+        return true;
+    }
+
+    double t = (render_ms - before->time_ms) / (double)(after->time_ms - before->time_ms);
+    for (u32 i = 0; i < LDN_REPL_NUM_FIELDS; i++) {
+        if (r->interp_mask & (1U << i))
+            fields[i] = before->fields[i] + (s32)(((double)after->fields[i] - before->fields[i]) * t);
+        else
+            fields[i] = before->fields[i];
+    }
+    return true;
+}
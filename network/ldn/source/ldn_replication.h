@@ -0,0 +1,77 @@
+#pragma once
+#include <switch.h>
+
+#include "ldn_session.h"
+
+// Snapshot replication over a LdnSession.
+//
+// The host owns the state, LDN_REPL_NUM_FIELDS s32 fields, and sends a snapshot of it every LDN_REPL_SEND_INTERVAL_MS.
+// Clients ack each snapshot they decode, and the host encodes the next snapshot as a delta against the one acked: one
+// bit per unchanged field, and the zigzag-encoded difference of the others, in 4, 8, 16 or 32 bits. A state where a
+// few fields change costs a few bytes instead of the whole state. Acks from clients which are behind are grouped by
+// baseline, so losing a snapshot only costs one more delta against an older baseline, and clients which haven't acked
+// anything still in the history of the host get the full state (a delta against zeros).
+//
+// Clients keep the last snapshots they received, and sample the state LDN_REPL_INTERP_DELAY_MS in the past of the host,
+// interpolating between the two snapshots around that time. This hides the send interval and the jitter of the network.
+//
+// Replication messages start with 0xF0 or 0xF1, other messages of the session are left to the app.
+
+#define LDN_REPL_NUM_FIELDS 32
+#define LDN_REPL_HISTORY 32               // Snapshots kept on both sides, for baselines and interpolation
+#define LDN_REPL_MAX_PEERS 7
+#define LDN_REPL_SEND_INTERVAL_MS 33
+#define LDN_REPL_INTERP_DELAY_MS (2 * LDN_REPL_SEND_INTERVAL_MS + 16)
+#define LDN_REPL_PEER_TIMEOUT_MS 2000     // Peers which haven't acked for this long don't get deltas anymore
+
+typedef struct {
+    u32 seq;                              // 0 for the empty baseline
+    u32 time_ms;                          // Host time when the snapshot was taken
+    s32 fields[LDN_REPL_NUM_FIELDS];
+} LdnSnapshot;
+
+typedef struct {
+    u32 addr;
+    u32 acked;                            // Last snapshot decoded by the peer
+    u64 ack_tick;
+} LdnReplPeer;
+
+typedef struct {
+    u64 snapshots_sent;                   // Host: messages sent, one per baseline
+    u64 bytes_sent, full_bytes;           // Host: size of those, and what full states would have cost
+    u64 snapshots_received;               // Client: snapshots decoded
+    u64 undecodable;                      // Client: deltas against a baseline which is not in the history
+} LdnReplStats;
+
+typedef struct {
+    LdnSession* session;
+    bool host;
+    u32 interp_mask;                      // Fields interpolated by clients, the others take the older snapshot's value
+    u64 start_tick;
+
+    LdnSnapshot history[LDN_REPL_HISTORY]; // Ring, indexed by seq
+    u32 latest;                           // Seq of the newest snapshot, 0 when there is none
+
+    // Host
+    s32 fields[LDN_REPL_NUM_FIELDS];
+    LdnReplPeer peers[LDN_REPL_MAX_PEERS];
+    u32 num_peers;
+    u64 next_send_tick;
+
+    // Client
+    double clock_offset_ms;               // Host time minus local time, as estimated from the snapshots
+    bool clock_valid;
+
+    LdnReplStats stats;
+} LdnReplication;
+
+void ldn_repl_init(LdnReplication* r, LdnSession* session, bool host, u32 interp_mask);
+
+// Host: sets the current state, and sends it to the peers when the send interval has elapsed. Call it every frame.
+void ldn_repl_host_update(LdnReplication* r, const s32* fields);
+
+// Handles a message from ldn_session_recv, returns false if it's not a replication message
+bool ldn_repl_handle_message(LdnReplication* r, const LdnMessage* msg);
+
+// Client: writes the state at the interpolation time, returns false until a snapshot was received
+bool ldn_repl_client_sample(LdnReplication* r, s32* fields);
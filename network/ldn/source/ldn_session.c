@@ -0,0 +1,250 @@
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+
+#include "ldn_session.h"
+
+#define LDN_DATAGRAM_MAGIC 0x314E444C // "LDN1"
+
+static void ldn_session_track_peer(LdnSession* s, u32 from, u32 seq, u64* lost)
+{
+    LdnPeer* peer = NULL;
+    for (u32 i = 0; i < s->num_peers; i++) {
+        if (s->peers[i].addr == from) {
+            peer = &s->peers[i];
+            break;
+        }
+    }
+
+    if (!peer) {
+        // A network has at most 8 nodes, replace the first one past that
+        peer = &s->peers[s->num_peers < 8 ? s->num_peers++ : 0];
+        peer->addr = from;
+    }
+    else if (seq > peer->next_seq)
+        *lost += seq - peer->next_seq;
+
+    peer->next_seq = seq + 1;
+}
+
+// Unpacks one received datagram into the receive queue
+static void ldn_session_unpack(LdnSession* s, u32 from, size_t size)
+{
+    LdnDatagramHeader hdr;
+    if (size < sizeof(hdr))
+        return;
+    memcpy(&hdr, s->datagram, sizeof(hdr));
+    if (hdr.magic != LDN_DATAGRAM_MAGIC)
+        return;
+
+    u64 lost = 0;
+    ldn_session_track_peer(s, from, hdr.seq, &lost);
+
+    mutexLock(&s->mutex);
+    s->stats.datagrams_received++;
+    s->stats.datagrams_lost += lost;
+
+    size_t pos = sizeof(hdr);
+    for (u32 i = 0; i < hdr.count; i++) {
+        if (pos >= size)
+            break;
+        u8 msg_size = s->datagram[pos++];
+        if (msg_size > size - pos)
+            break;
+
+        if (s->recv_tail - s->recv_head < LDN_QUEUE_SIZE) {
+            LdnMessage* msg = &s->recv_queue[s->recv_tail++ % LDN_QUEUE_SIZE];
+            msg->from = from;
+            msg->size = msg_size;
+            memcpy(msg->data, &s->datagram[pos], msg_size);
+            s->stats.messages_received++;
+        }
+        else
+            s->stats.recv_dropped++;
+
+        pos += msg_size;
+    }
+    mutexUnlock(&s->mutex);
+}
+
+// Reads everything that arrived, without blocking
+static void ldn_session_drain(LdnSession* s)
+{
+    for (;;) {
+        struct sockaddr_in src_addr = {0};
+        socklen_t fromlen = sizeof(src_addr);
+        ssize_t ret = recvfrom(s->sockfd, s->datagram, sizeof(s->datagram), MSG_DONTWAIT, (struct sockaddr*)&src_addr, &fromlen);
+        if (ret < 0)
+            break; // EAGAIN/EWOULDBLOCK once drained
+
+        u32 from = ntohl(src_addr.sin_addr.s_addr);
+        if (from == s->local_addr)
+            continue; // Our own broadcasts
+
+        ldn_session_unpack(s, from, ret);
+    }
+}
+
+// Packs the send queue into datagrams and broadcasts them
+static void ldn_session_flush(LdnSession* s)
+{
+    for (;;) {
+        LdnDatagramHeader hdr = { .magic = LDN_DATAGRAM_MAGIC };
+        size_t pos = sizeof(hdr);
+
+        mutexLock(&s->mutex);
+        while (s->send_head != s->send_tail) {
+            LdnMessage* msg = &s->send_queue[s->send_head % LDN_QUEUE_SIZE];
+            if (pos + 1 + msg->size > sizeof(s->datagram))
+                break;
+            s->datagram[pos++] = (u8)msg->size;
+            memcpy(&s->datagram[pos], msg->data, msg->size);
+            pos += msg->size;
+            hdr.count++;
+            s->send_head++;
+        }
+        mutexUnlock(&s->mutex);
+
+        if (!hdr.count)
+            break;
+
+        hdr.seq = s->seq++;
+        memcpy(s->datagram, &hdr, sizeof(hdr));
+
+        ssize_t ret = sendto(s->sockfd, s->datagram, pos, 0, (struct sockaddr*)&s->broadcast_addr, sizeof(s->broadcast_addr));
+
+        mutexLock(&s->mutex);
+        if (ret == (ssize_t)pos) {
+            s->stats.datagrams_sent++;
+            s->stats.messages_sent += hdr.count;
+        }
+        else
+            s->stats.send_errors++;
+        mutexUnlock(&s->mutex);
+    }
+}
+
+static void ldn_session_thread_func(void* arg)
+{
+    LdnSession* s = (LdnSession*)arg;
+    const u64 tick = armNsToTicks(LDN_SESSION_TICK_MS * 1000000ULL);
+    u64 next_tick = armGetSystemTick() + tick;
+
+    while (!__atomic_load_n(&s->exit, __ATOMIC_ACQUIRE)) {
+        u64 now = armGetSystemTick();
+        int timeout_ms = now < next_tick ? (int)((armTicksToNs(next_tick - now) + 999999) / 1000000) : 0;
+
+        struct pollfd pfd = { .fd = s->sockfd, .events = POLLIN };
+        if (poll(&pfd, 1, timeout_ms) > 0 && (pfd.revents & POLLIN))
+            ldn_session_drain(s);
+
+        now = armGetSystemTick();
+        if (now >= next_tick) {
+            ldn_session_flush(s);
+            next_tick += tick;
+            if (next_tick <= now) // Fell behind, don't send bursts to catch up
+                next_tick = now + tick;
+        }
+    }
+}
+
+Result ldn_session_start(LdnSession* s, const LdnIpv4Address* addr, const LdnSubnetMask* mask)
+{
+    memset(s, 0, sizeof(*s));
+    mutexInit(&s->mutex);
+    s->local_addr = addr->addr;
+
+    s->sockfd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (s->sockfd < 0)
+        return MAKERESULT(Module_Libnx, LibnxError_IoError);
+
+    int optval = 1;
+    bool ok = setsockopt(s->sockfd, SOL_SOCKET, SO_BROADCAST, (char*)&optval, sizeof(optval)) == 0;
+
+    if (ok) {
+        int flags = fcntl(s->sockfd, F_GETFL, 0);
+        ok = flags != -1 && fcntl(s->sockfd, F_SETFL, flags | O_NONBLOCK) != -1;
+    }
+
+    if (ok) {
+        // Broadcast address of the network. If you want to use addrs for nodes on the network, you can use: htonl(netinfo.nodes[i].ip_addr.addr)
+        s->broadcast_addr.sin_family = AF_INET;
+        s->broadcast_addr.sin_addr.s_addr = htonl(addr->addr | ~mask->mask);
+        s->broadcast_addr.sin_port = htons(LDN_SESSION_PORT);
+        ok = bind(s->sockfd, (struct sockaddr*)&s->broadcast_addr, sizeof(s->broadcast_addr)) == 0;
+    }
+
+    if (!ok) {
+        close(s->sockfd);
+        s->sockfd = -1;
+        return MAKERESULT(Module_Libnx, LibnxError_IoError);
+    }
+
+    // Above the main thread, so that received data is handled as it arrives instead of waiting for the frame to end
+    Result rc = threadCreate(&s->thread, ldn_session_thread_func, s, NULL, 0x4000, 0x2B, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&s->thread);
+        if (R_FAILED(rc))
+            threadClose(&s->thread);
+    }
+    if (R_FAILED(rc)) {
+        close(s->sockfd);
+        s->sockfd = -1;
+    }
+    return rc;
+}
+
+void ldn_session_stop(LdnSession* s)
+{
+    if (s->sockfd < 0)
+        return;
+
+    // The thread notices within a tick
+    __atomic_store_n(&s->exit, true, __ATOMIC_RELEASE);
+    threadWaitForExit(&s->thread);
+    threadClose(&s->thread);
+
+    close(s->sockfd);
+    s->sockfd = -1;
+}
+
+bool ldn_session_send(LdnSession* s, const void* data, size_t size)
+{
+    // Each message must fit in a datagram with its size byte
+    if (size > LDN_MESSAGE_MAX)
+        return false;
+
+    mutexLock(&s->mutex);
+    bool ok = s->send_tail - s->send_head < LDN_QUEUE_SIZE;
+    if (ok) {
+        LdnMessage* msg = &s->send_queue[s->send_tail++ % LDN_QUEUE_SIZE];
+        msg->from = s->local_addr;
+        msg->size = size;
+        memcpy(msg->data, data, size);
+    }
+    else
+        s->stats.send_dropped++;
+    mutexUnlock(&s->mutex);
+    return ok;
+}
+
+bool ldn_session_recv(LdnSession* s, LdnMessage* out)
+{
+    mutexLock(&s->mutex);
+    bool ok = s->recv_head != s->recv_tail;
+    if (ok)
+        *out = s->recv_queue[s->recv_head++ % LDN_QUEUE_SIZE];
+    mutexUnlock(&s->mutex);
+    return ok;
+}
+
+void ldn_session_get_stats(LdnSession* s, LdnSessionStats* out)
+{
+    mutexLock(&s->mutex);
+    *out = s->stats;
+    mutexUnlock(&s->mutex);
+}
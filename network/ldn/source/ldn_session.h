@@ -0,0 +1,81 @@
+#pragma once
+#include <netinet/in.h>
+#include <switch.h>
+
+// UDP messaging over an ldn network, from a thread of its own.
+//
+// The main loop only queues messages with ldn_session_send and picks up the received ones with ldn_session_recv, neither
+// of them touches the socket. The network thread waits on the non-blocking socket with poll, drains everything that
+// arrived, and once per tick packs all the queued messages into as few datagrams as possible, which are broadcast to
+// the network. This way the traffic doesn't depend on the frame rate, and many small messages don't cost a datagram
+// (and a trip through bsd) each.
+//
+// Datagram format: LdnDatagramHeader, then count messages, each a u8 size followed by the data.
+//
+// The ldn network must be created or joined, and sockets initialized.
+
+#define LDN_SESSION_PORT 7777
+#define LDN_SESSION_TICK_MS 10
+#define LDN_MESSAGE_MAX 255           // Size of one message
+#define LDN_DATAGRAM_MAX 1200         // Stays below the MTU
+#define LDN_QUEUE_SIZE 64             // Per direction, messages are dropped when full
+
+typedef struct {
+    u32 magic;
+    u32 seq;                          // Per sender, to count the datagrams lost
+    u16 count;
+    u16 pad;
+} LdnDatagramHeader;
+
+typedef struct {
+    u32 from;                         // IPv4 address of the sender, host byte order
+    u16 size;
+    u8 data[LDN_MESSAGE_MAX];
+} LdnMessage;
+
+typedef struct {
+    u64 datagrams_sent, datagrams_received;
+    u64 messages_sent, messages_received;
+    u64 datagrams_lost;               // Gaps in the sequence numbers of the senders
+    u64 send_dropped, recv_dropped;   // Messages dropped because a queue was full
+    u64 send_errors;
+} LdnSessionStats;
+
+typedef struct {
+    u32 addr;
+    u32 next_seq;
+} LdnPeer;
+
+typedef struct {
+    Thread thread;
+    bool exit;                        // Accessed with __atomic
+    Mutex mutex;                      // Protects the queues and stats
+
+    int sockfd;
+    struct sockaddr_in broadcast_addr;
+    u32 local_addr;
+
+    LdnMessage send_queue[LDN_QUEUE_SIZE];
+    u32 send_head, send_tail;
+    LdnMessage recv_queue[LDN_QUEUE_SIZE];
+    u32 recv_head, recv_tail;
+    LdnSessionStats stats;
+
+    // Only used by the network thread
+    u32 seq;
+    LdnPeer peers[8];
+    u32 num_peers;
+    u8 datagram[LDN_DATAGRAM_MAX];
+} LdnSession;
+
+// Opens the broadcast socket for the network with this address and subnet mask, and starts the thread
+Result ldn_session_start(LdnSession* s, const LdnIpv4Address* addr, const LdnSubnetMask* mask);
+void ldn_session_stop(LdnSession* s);
+
+// Queues a message for the next tick, returns false if it's too large or the queue is full
+bool ldn_session_send(LdnSession* s, const void* data, size_t size);
+
+// Returns true and takes the oldest received message if there is one, never blocks
+bool ldn_session_recv(LdnSession* s, LdnMessage* out);
+
+void ldn_session_get_stats(LdnSession* s, LdnSessionStats* out);
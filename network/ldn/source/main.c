@@ -1,18 +1,18 @@
 // Include the most common headers from the C standard library
 #include <string.h>
 #include <stdio.h>
-#include <sys/socket.h>
-#include <arpa/inet.h>
-#include <sys/errno.h>
-#include <unistd.h>
 
 // Include the main libnx system header, for Switch development
 #include <switch.h>
 
+#include "ldn_session.h"
+#include "ldn_replication.h"
+
 // This example shows how to use ldn, for local-network communications. See also libnx ldn.h.
 // All systems in the network must be running the same hbl host Application. If any systems are running non-Application (where control.nacp loading fails), all systems must be running non-Application as well.
 
-// Note that in an actual app you may want to use ldn/sockets from another thread.
+// Once on a network, the sockets are handled by a LdnSession on its own thread, see ldn_session.h.
+// The system which created the network also replicates a small state to the others, see ldn_replication.h: the left stick moves a position, which the others interpolate.
 
 // Replace this keydata with your own. See ldn.h SecurityConfig for the required size.
 static const u8 sec_data[0x10]={0x04, 0xb9, 0x9d, 0x4d, 0x58, 0xbc, 0x65, 0xe1, 0x77, 0x13, 0xc2, 0xb8, 0xd1, 0xb8, 0xec, 0xf6};
@@ -117,8 +117,10 @@ int main(int argc, char **argv)
 
     printf("ldn example\n");
 
-    int sockfd=-1;
-    struct sockaddr_in serv_addr;
+    LdnSession session;
+    bool session_active=false;
+    LdnReplication repl;
+    s32 state[LDN_REPL_NUM_FIELDS]={0};
 
     Result rc=0;
     LdnIpv4Address addr={0};
@@ -202,6 +204,7 @@ int main(int argc, char **argv)
         printf("Press B to connect to a network.\n");
         printf("Press X to leave a network.\n");
         printf("Press the D-Pad buttons while on a network to send messages.\n");
+        printf("Press Y while on a network to show the session stats.\n");
     }
     printf("Press + to exit.\n");
 
@@ -239,75 +242,68 @@ int main(int argc, char **argv)
                      printf("ldnGetIpv4Address(): 0x%x\n", rc2);
                  }
 
-                 // Once on a network, you can use whatever sockets you want. In this example, we'll send/recv data with UDP-broadcast.
+                 // Once on a network, you can use whatever sockets you want. In this example, we'll send/recv data with UDP-broadcast, from the session thread.
+
+                 if (R_SUCCEEDED(rc2)) {
+                     rc2 = ldn_session_start(&session, &addr, &mask);
+                     printf("ldn_session_start(): 0x%x\n", rc2);
+                     session_active = R_SUCCEEDED(rc2);
+                 }
 
                  if (R_SUCCEEDED(rc2)) {
-                     sockfd = socket(AF_INET, SOCK_DGRAM, 0);
-                     if (sockfd < 0) {
-                         printf("socket() failed\n");
-                     }
-                     else {
-                         int ret=0;
-
-                         int optval = 1;
-                         ret = setsockopt(sockfd, SOL_SOCKET, SO_BROADCAST, (char *)&optval, sizeof(optval));
-                         if (ret==-1) {
-                             printf("setsockopt() failed\n");
-                             close(sockfd);
-                             sockfd = -1;
-                         }
-
-                         if (sockfd >= 0) {
-                             memset(&serv_addr, 0, sizeof(serv_addr));
-                             serv_addr.sin_family = AF_INET;
-                             serv_addr.sin_addr.s_addr = htonl(addr.addr | ~mask.mask); // Setup a broadcast addr. If you want to use addrs for nodes on the network, you can use: htonl(netinfo.nodes[i].ip_addr.addr)
-                             serv_addr.sin_port = htons(7777);
-
-                             if (bind(sockfd, (struct sockaddr*) &serv_addr, sizeof(serv_addr)) < 0) {
-                                 printf("bind failed\n");
-                                 close(sockfd);
-                                 sockfd = -1;
-                             }
-                         }
-                     }
+                     // Fields 0 and 1 are the position, interpolated. Field 2 is the buttons held, which are not.
+                     ldn_repl_init(&repl, &session, (kDown & KEY_A) != 0, 0x3);
+                     memset(state, 0, sizeof(state));
                  }
              }
         }
 
         if (R_SUCCEEDED(rc) && (kDown & KEY_X)) {
-            if (sockfd >= 0) {
-                close(sockfd);
-                sockfd = -1;
+            if (session_active) {
+                ldn_session_stop(&session);
+                session_active = false;
             }
             leave_network();
         }
 
-        if (R_SUCCEEDED(rc) && sockfd>=0 && (kDown & (KEY_DLEFT|KEY_DRIGHT|KEY_DUP|KEY_DDOWN))) {
-            char tmpstr[32];
-            memset(tmpstr, 0, sizeof(tmpstr));
-
-            if (kDown & KEY_DLEFT) strncpy(tmpstr, "Button DLEFT pressed.", sizeof(tmpstr)-1);
-            else if (kDown & KEY_DRIGHT) strncpy(tmpstr, "Button DRIGHT pressed.", sizeof(tmpstr)-1);
-            else if (kDown & KEY_DUP) strncpy(tmpstr, "Button DUP pressed.", sizeof(tmpstr)-1);
-            else if (kDown & KEY_DDOWN) strncpy(tmpstr, "Button DDOWN pressed.", sizeof(tmpstr)-1);
-
-            ssize_t ret = sendto(sockfd, tmpstr, sizeof(tmpstr), 0, (struct sockaddr*) &serv_addr, sizeof(struct sockaddr_in));
-            int tmp = errno;
-            printf("sendto(): %ld", ret);
-            if (ret < 0) printf(", %s", strerror(tmp));
-            printf("\n");
-        }
-
-        if (R_SUCCEEDED(rc) && sockfd>=0) {
-            char tmpstr[32];
-            memset(tmpstr, 0, sizeof(tmpstr));
-
-            struct sockaddr_in src_addr={0};
-            socklen_t fromlen = sizeof(struct sockaddr_in);
-            ssize_t ret = recvfrom(sockfd, tmpstr, sizeof(tmpstr), MSG_DONTWAIT, (struct sockaddr*) &src_addr, &fromlen);
+        if (R_SUCCEEDED(rc) && session_active) {
+            // Queued messages go out with the next tick of the session, packed together in one datagram
+            if (kDown & KEY_DLEFT) ldn_session_send(&session, "Button DLEFT pressed.", sizeof("Button DLEFT pressed."));
+            if (kDown & KEY_DRIGHT) ldn_session_send(&session, "Button DRIGHT pressed.", sizeof("Button DRIGHT pressed."));
+            if (kDown & KEY_DUP) ldn_session_send(&session, "Button DUP pressed.", sizeof("Button DUP pressed."));
+            if (kDown & KEY_DDOWN) ldn_session_send(&session, "Button DDOWN pressed.", sizeof("Button DDOWN pressed."));
+
+            if (repl.host) {
+                JoystickPosition pos;
+                hidJoystickRead(&pos, CONTROLLER_P1_AUTO, JOYSTICK_LEFT);
+                state[0] += pos.dx / 1024;
+                state[1] += pos.dy / 1024;
+                state[2] = hidKeysHeld(CONTROLLER_P1_AUTO);
+                ldn_repl_host_update(&repl, state);
+            }
+            else
+                ldn_repl_client_sample(&repl, state);
+
+            if (kDown & KEY_Y) {
+                printf("state: position %d,%d, buttons 0x%x\n", state[0], state[1], state[2]);
+                if (repl.host)
+                    printf("sent %lu snapshots, %lu bytes instead of %lu\n", repl.stats.snapshots_sent, repl.stats.bytes_sent, repl.stats.full_bytes);
+                else
+                    printf("received %lu snapshots, %lu undecodable\n", repl.stats.snapshots_received, repl.stats.undecodable);
+
+                LdnSessionStats stats;
+                ldn_session_get_stats(&session, &stats);
+                printf("sent %lu msgs in %lu datagrams, received %lu msgs in %lu datagrams\n", stats.messages_sent, stats.datagrams_sent, stats.messages_received, stats.datagrams_received);
+                printf("lost %lu datagrams, dropped %lu/%lu msgs, %lu send errors\n", stats.datagrams_lost, stats.send_dropped, stats.recv_dropped, stats.send_errors);
+            }
 
-            tmpstr[sizeof(tmpstr)-1] = 0;
-            if (ret>0) printf("Received data: %s\n", tmpstr);
+            LdnMessage msg;
+            while (ldn_session_recv(&session, &msg)) {
+                if (ldn_repl_handle_message(&repl, &msg))
+                    continue;
+                msg.data[msg.size ? msg.size-1 : 0] = 0;
+                printf("Received data from %u.%u.%u.%u: %s\n", (msg.from>>24)&0xFF, (msg.from>>16)&0xFF, (msg.from>>8)&0xFF, msg.from&0xFF, (char*)msg.data);
+            }
         }
 
         if (R_SUCCEEDED(rc) && R_SUCCEEDED(eventWait(&state_event, 0))) {
@@ -322,9 +318,9 @@ int main(int argc, char **argv)
         consoleUpdate(NULL);
     }
 
-    if (sockfd >= 0) {
-        close(sockfd);
-        sockfd = -1;
+    if (session_active) {
+        ldn_session_stop(&session);
+        session_active = false;
     }
 
     leave_network();
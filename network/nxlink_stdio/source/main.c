@@ -5,24 +5,23 @@
 
   -s or --server tells nxlink to open a socket nxlink can connect to.
 
+  printf doesn't write to the socket directly: the output goes through a ring buffer, which a background thread sends
+  to the host, see nxlink_log.h. A slow network can't stall the main loop, lines are dropped instead.
+
 */
 
 #include <string.h>
 #include <stdio.h>
-#include <sys/socket.h>
 #include <arpa/inet.h>
-#include <sys/errno.h>
-#include <unistd.h>
 
 #include <switch.h>
 
+#include "nxlink_log.h"
+
 int main(int argc, char **argv)
 {
     consoleInit(NULL);
 
-    // Initialise sockets
-    socketInitializeDefault();
-
     printf("Hello World!\n");
 
     // Display arguments sent from nxlink
@@ -35,11 +34,12 @@ int main(int argc, char **argv)
     // the host ip where nxlink was launched
     printf("nxlink host is %s\n", inet_ntoa(__nxlink_host));
 
-    // redirect stdout & stderr over network to nxlink
-    nxlinkStdio();
+    // redirect stdout & stderr over network to nxlink, this also initializes sockets
+    bool nxlink = nxlinkLogInit();
 
     // this text should display on nxlink host
     printf("printf output now goes to nxlink server\n");
+    printf("Press Y to print a burst of 1000 lines\n");
 
     // Main loop
     while(appletMainLoop())
@@ -60,11 +60,23 @@ int main(int argc, char **argv)
         if (kDown & KEY_B) {
             printf("B Pressed\n");
         }
+        if (kDown & KEY_Y) {
+            // Each printf only copies the line into the ring, however slow the network is
+            u64 start = armGetSystemTick();
+            for (int i=0; i<1000; i++) {
+                printf("line %d of the burst\n", i);
+            }
+            u64 ns = armTicksToNs(armGetSystemTick() - start);
+
+            u64 dropped_bytes;
+            u64 dropped = nxlinkLogGetDropped(&dropped_bytes);
+            printf("1000 printf took %lu us, %lu lines (%lu bytes) dropped so far\n", ns / 1000, dropped, dropped_bytes);
+        }
 
         consoleUpdate(NULL);
     }
 
-    socketExit();
+    if (nxlink) nxlinkLogExit();
     consoleExit(NULL);
     return 0;
 }
@@ -0,0 +1,309 @@
+// Socket buffer benchmark.
+// socketInitializeDefault() fixes the TCP/UDP buffer sizes, and with them the size of the transfer memory given to
+// bsd. This initializes sockets with each of a few SocketInitConfig in turn, and runs iperf-style tests against the
+// nxlink host with each of them:
+// - TCP upload: as much data as possible for a few seconds, until the host has received all of it
+// - UDP upload: 1470-byte datagrams as fast as possible; the host reports what it received and how many were lost
+// The results are shown once all configurations are done, and are also appended to a CSV file on the SD card.
+//
+// On the host, run an iperf2 server for both protocols, then run this from nxlink (the host address comes from it):
+//     iperf -s & iperf -s -u &
+//     nxlink socket_bench.nro
+// Press A to run the benchmark, PLUS to exit.
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+
+#include <switch.h>
+
+#define BENCH_PORT     5001    // iperf default
+#define BENCH_SECONDS  3
+#define TCP_WRITE_SIZE 0x10000
+#define UDP_DATAGRAM   1470    // iperf default, fits in the MTU
+
+#define CSV_PATH "sdmc:/switch/socket_bench.csv"
+
+typedef struct {
+    const char* name;
+    u32 tcp_tx_buf_size, tcp_rx_buf_size;
+    u32 tcp_tx_buf_max_size, tcp_rx_buf_max_size;
+    u32 udp_tx_buf_size, udp_rx_buf_size;
+    u32 sb_efficiency;
+} BenchConfig;
+
+// The first one matches socketInitializeDefault()
+static const BenchConfig s_configs[] = {
+    { "default",      0x8000,  0x10000, 0x40000,  0x40000,  0x2400,  0xA500,  4 },
+    { "small",        0x4000,  0x4000,  0x10000,  0x10000,  0x2400,  0xA500,  2 },
+    { "large tcp",    0x20000, 0x20000, 0x100000, 0x100000, 0x2400,  0xA500,  4 },
+    { "large udp",    0x8000,  0x10000, 0x40000,  0x40000,  0x20000, 0x40000, 4 },
+    { "large, eff 8", 0x20000, 0x40000, 0x100000, 0x100000, 0x20000, 0x40000, 8 },
+};
+
+#define NUM_CONFIGS (sizeof(s_configs) / sizeof(s_configs[0]))
+
+typedef struct {
+    bool init_ok;
+    size_t tmem_size;
+    bool tcp_ok;
+    double tcp_mbps;
+    bool udp_ok, udp_report;
+    double udp_send_mbps, udp_recv_mbps;
+    u32 udp_lost, udp_datagrams;
+} BenchResult;
+
+static BenchResult s_results[NUM_CONFIGS];
+static u8 s_buf[TCP_WRITE_SIZE];
+
+// Size of the transfer memory bsd gets for a config, as computed by socketInitialize
+static size_t tmemSize(const SocketInitConfig* cfg)
+{
+    u32 tcp_tx = cfg->tcp_tx_buf_max_size ? cfg->tcp_tx_buf_max_size : cfg->tcp_tx_buf_size;
+    u32 tcp_rx = cfg->tcp_rx_buf_max_size ? cfg->tcp_rx_buf_max_size : cfg->tcp_rx_buf_size;
+    u32 sum = tcp_tx + tcp_rx + cfg->udp_tx_buf_size + cfg->udp_rx_buf_size;
+    sum = (sum + 0xFFF) & ~0xFFF;
+    return (size_t)cfg->sb_efficiency * sum;
+}
+
+static int connectToHost(int type)
+{
+    int fd = socket(AF_INET, type, 0);
+    if (fd < 0)
+        return -1;
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(BENCH_PORT);
+    addr.sin_addr = __nxlink_host;
+    if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static double secondsSince(u64 start)
+{
+    return armTicksToNs(armGetSystemTick() - start) / 1e9;
+}
+
+static bool runTcp(BenchResult* res)
+{
+    int fd = connectToHost(SOCK_STREAM);
+    if (fd < 0)
+        return false;
+
+    u64 total = 0;
+    bool ok = true;
+    u64 start = armGetSystemTick();
+    while (ok && secondsSince(start) < BENCH_SECONDS) {
+        ssize_t ret = send(fd, s_buf, sizeof(s_buf), 0);
+        if (ret <= 0)
+            ok = false;
+        else
+            total += ret;
+    }
+
+    // Only done once the host has everything: it closes its side when it sees the end of the stream
+    if (ok) {
+        shutdown(fd, SHUT_WR);
+        struct pollfd pfd = { .fd = fd, .events = POLLIN };
+        while (poll(&pfd, 1, 2000) > 0 && recv(fd, s_buf, sizeof(s_buf), 0) > 0);
+    }
+    double seconds = secondsSince(start);
+    close(fd);
+
+    res->tcp_mbps = total / seconds / 1e6;
+    return ok;
+}
+
+// iperf2 datagram header, and the report the server sends back for the final datagram. Big-endian.
+typedef struct {
+    s32 id;
+    u32 tv_sec, tv_usec;
+} UdpHeader;
+
+typedef struct {
+    s32 flags;
+    s32 total_len1, total_len2;
+    s32 stop_sec, stop_usec;
+    s32 error_cnt, outorder_cnt;
+    s32 datagrams;
+    s32 jitter1, jitter2;
+} UdpServerReport;
+
+#define UDP_REPORT_FLAG 0x80000000
+
+static void udpStamp(UdpHeader* hdr, s32 id)
+{
+    u64 us = armTicksToNs(armGetSystemTick()) / 1000;
+    hdr->id = htonl(id);
+    hdr->tv_sec = htonl(us / 1000000);
+    hdr->tv_usec = htonl(us % 1000000);
+}
+
+// The report follows the datagram header, which has an extra 32-bit id field since iperf 2.0.10
+static bool udpParseReport(const u8* data, ssize_t size, BenchResult* res)
+{
+    static const size_t offsets[] = { sizeof(UdpHeader), sizeof(UdpHeader) + 4 };
+    for (u32 i = 0; i < 2; i++) {
+        UdpServerReport rep;
+        if (size < (ssize_t)(offsets[i] + sizeof(rep)))
+            continue;
+        memcpy(&rep, data + offsets[i], sizeof(rep));
+        if (!(ntohl(rep.flags) & UDP_REPORT_FLAG))
+            continue;
+
+        u64 bytes = ((u64)(u32)ntohl(rep.total_len1) << 32) | (u32)ntohl(rep.total_len2);
+        double seconds = (s32)ntohl(rep.stop_sec) + (s32)ntohl(rep.stop_usec) / 1e6;
+        res->udp_recv_mbps = seconds > 0 ? bytes / seconds / 1e6 : 0.0;
+        res->udp_lost = ntohl(rep.error_cnt);
+        res->udp_datagrams = ntohl(rep.datagrams);
+        return true;
+    }
+    return false;
+}
+
+static bool runUdp(BenchResult* res)
+{
+    int fd = connectToHost(SOCK_DGRAM);
+    if (fd < 0)
+        return false;
+
+    memset(s_buf, 0, UDP_DATAGRAM);
+    UdpHeader* hdr = (UdpHeader*)s_buf;
+
+    u64 total = 0;
+    s32 id = 0;
+    u64 start = armGetSystemTick();
+    while (secondsSince(start) < BENCH_SECONDS) {
+        udpStamp(hdr, id);
+        ssize_t ret = send(fd, s_buf, UDP_DATAGRAM, 0);
+        if (ret > 0) {
+            total += ret;
+            id++;
+        }
+        else if (errno != ENOBUFS && errno != EAGAIN)
+            break;
+    }
+    res->udp_send_mbps = total / secondsSince(start) / 1e6;
+
+    // A negative id ends the test, the server answers it with its report. Both can get lost, so retry like iperf does.
+    res->udp_report = false;
+    for (u32 tries = 0; tries < 10 && !res->udp_report; tries++) {
+        udpStamp(hdr, -id);
+        send(fd, s_buf, UDP_DATAGRAM, 0);
+
+        struct pollfd pfd = { .fd = fd, .events = POLLIN };
+        if (poll(&pfd, 1, 250) > 0) {
+            u8 reply[256];
+            ssize_t ret = recv(fd, reply, sizeof(reply), 0);
+            res->udp_report = udpParseReport(reply, ret, res);
+        }
+    }
+
+    close(fd);
+    return total > 0;
+}
+
+static void runConfig(const BenchConfig* bc, BenchResult* res)
+{
+    SocketInitConfig cfg = *socketGetDefaultInitConfig();
+    cfg.tcp_tx_buf_size = bc->tcp_tx_buf_size;
+    cfg.tcp_rx_buf_size = bc->tcp_rx_buf_size;
+    cfg.tcp_tx_buf_max_size = bc->tcp_tx_buf_max_size;
+    cfg.tcp_rx_buf_max_size = bc->tcp_rx_buf_max_size;
+    cfg.udp_tx_buf_size = bc->udp_tx_buf_size;
+    cfg.udp_rx_buf_size = bc->udp_rx_buf_size;
+    cfg.sb_efficiency = bc->sb_efficiency;
+
+    memset(res, 0, sizeof(*res));
+    res->tmem_size = tmemSize(&cfg);
+    res->init_ok = R_SUCCEEDED(socketInitialize(&cfg));
+    if (!res->init_ok)
+        return;
+
+    res->tcp_ok = runTcp(res);
+    res->udp_ok = runUdp(res);
+    socketExit();
+}
+
+static void printResults(void)
+{
+    printf("\n%-13s %6s %8s %8s %8s %12s\n", "config", "tmem", "TCP", "UDP tx", "UDP rx", "UDP lost");
+    for (u32 i = 0; i < NUM_CONFIGS; i++) {
+        const BenchResult* res = &s_results[i];
+        printf("%-13s %5zuK ", s_configs[i].name, res->tmem_size / 1024);
+        if (!res->init_ok) {
+            printf("socketInitialize failed\n");
+            continue;
+        }
+
+        if (res->tcp_ok) printf("%8.2f ", res->tcp_mbps);
+        else printf("%8s ", "failed");
+        if (res->udp_ok) printf("%8.2f ", res->udp_send_mbps);
+        else printf("%8s ", "failed");
+        if (res->udp_report) printf("%8.2f %5u/%-6u\n", res->udp_recv_mbps, res->udp_lost, res->udp_datagrams);
+        else printf("%8s\n", "-");
+    }
+    printf("(MB/s)\n");
+}
+
+static void writeCsv(void)
+{
+    FILE* csv = fopen(CSV_PATH, "a");
+    if (!csv)
+        return;
+
+    for (u32 i = 0; i < NUM_CONFIGS; i++) {
+        const BenchConfig* bc = &s_configs[i];
+        const BenchResult* res = &s_results[i];
+        fprintf(csv, "%s,%u,%u,%u,%u,%u,%u,%u,%zu,%d,%.3f,%.3f,%.3f,%u,%u\n", bc->name,
+            bc->tcp_tx_buf_size, bc->tcp_rx_buf_size, bc->tcp_tx_buf_max_size, bc->tcp_rx_buf_max_size,
+            bc->udp_tx_buf_size, bc->udp_rx_buf_size, bc->sb_efficiency, res->tmem_size, res->init_ok,
+            res->tcp_ok ? res->tcp_mbps : 0.0, res->udp_ok ? res->udp_send_mbps : 0.0,
+            res->udp_report ? res->udp_recv_mbps : 0.0, res->udp_lost, res->udp_datagrams);
+    }
+    fclose(csv);
+}
+
+int main(int argc, char* argv[])
+{
+    consoleInit(NULL);
+
+    printf("Socket buffer benchmark\n");
+    if (__nxlink_host.s_addr == 0)
+        printf("Run this from nxlink, the tests run against the nxlink host.\n");
+    else
+        printf("Host: %s, port %d (iperf -s, iperf -s -u)\n", inet_ntoa(__nxlink_host), BENCH_PORT);
+    printf("Press A to run the benchmark, PLUS to exit.\n");
+
+    while (appletMainLoop())
+    {
+        hidScanInput();
+        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+
+        if (kDown & KEY_PLUS)
+            break;
+
+        if ((kDown & KEY_A) && __nxlink_host.s_addr != 0) {
+            for (u32 i = 0; i < NUM_CONFIGS; i++) {
+                printf("Running \"%s\"...\n", s_configs[i].name);
+                consoleUpdate(NULL);
+                runConfig(&s_configs[i], &s_results[i]);
+            }
+            printResults();
+            writeCsv();
+        }
+
+        consoleUpdate(NULL);
+    }
+
+    consoleExit(NULL);
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+  Binary telemetry to the nxlink host, see telemetry.h.
+
+  On the host, start the decoder first, then run this example from nxlink:
+
+  python3 tools/telemetry_decode.py
+  nxlink <-a switch_ip> telemetry.nro
+
+  Every frame sends a frame record, two nested spans and two counters. The decoder prints a summary every second.
+*/
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#include <switch.h>
+
+#include "telemetry.h"
+
+#define MAX_PARTICLES 20000
+
+static float s_particles[MAX_PARTICLES];
+
+// Some work to measure
+static float simulate(u32 count, u32 frame)
+{
+    float sum = 0.0f;
+    for (u32 i = 0; i < count; i++) {
+        s_particles[i] = sinf(s_particles[i] + frame * 0.01f + i);
+        sum += s_particles[i];
+    }
+    return sum;
+}
+
+int main(int argc, char **argv)
+{
+    consoleInit(NULL);
+    socketInitializeDefault();
+
+    printf("telemetry example\n");
+    bool connected = telemetryInit();
+    if (!connected)
+        printf("Can't connect to the decoder, run tools/telemetry_decode.py on the host and start this from nxlink.\n");
+    printf("Press Up/Down to change the amount of work, + to exit.\n");
+
+    u16 span_update = telemetryRegister(TelemetryKind_Span, "update");
+    u16 span_simulate = telemetryRegister(TelemetryKind_Span, "simulate");
+    u16 counter_particles = telemetryRegister(TelemetryKind_Counter, "particles");
+    u16 counter_keys = telemetryRegister(TelemetryKind_Counter, "keys_held");
+
+    u32 particles = 2000;
+    u32 frame = 0;
+    u64 last_frame_tick = armGetSystemTick();
+
+    // Main loop
+    while(appletMainLoop())
+    {
+        u64 frame_tick = armGetSystemTick();
+
+        telemetrySpanBegin();
+
+        //Scan all the inputs. This should be done once for each frame
+        hidScanInput();
+
+        //hidKeysDown returns information about which buttons have been just pressed (and they weren't in the previous frame)
+        u64 kDown = hidKeysDown(CONTROLLER_P1_AUTO);
+
+        if (kDown & KEY_PLUS) break; // break in order to return to hbmenu
+
+        if ((kDown & KEY_DUP) && particles < MAX_PARTICLES) particles += 1000;
+        if ((kDown & KEY_DDOWN) && particles > 1000) particles -= 1000;
+
+        telemetrySpanBegin();
+        simulate(particles, frame);
+        telemetrySpanEnd(span_simulate);
+
+        telemetryCounter(counter_particles, particles);
+        telemetryCounter(counter_keys, hidKeysHeld(CONTROLLER_P1_AUTO));
+
+        if (frame % 60 == 0) {
+            TelemetryStats stats;
+            telemetryGetStats(&stats);
+            printf(CONSOLE_ESC(6;1H) "particles: %5u\n", particles);
+            printf("%s: %lu records, %lu dropped, %lu bytes sent, %u flushes blocked" CONSOLE_ESC(K) "\n",
+                telemetryIsConnected() ? "connected" : "not connected", stats.records, stats.dropped, stats.bytes_sent, stats.flushes_blocked);
+        }
+
+        telemetrySpanEnd(span_update);
+
+        u64 now = armGetSystemTick();
+        telemetryFrame(frame, armTicksToNs(now - frame_tick) / 1000, 0, armTicksToNs(frame_tick - last_frame_tick) / 1000);
+        last_frame_tick = frame_tick;
+        frame++;
+
+        // One writev per frame, never blocks
+        telemetryFlush();
+
+        consoleUpdate(NULL);
+    }
+
+    telemetryExit();
+    socketExit();
+    consoleExit(NULL);
+    return 0;
+}
@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+#
+# telemetry_decode.py: receives and decodes the binary telemetry stream of templates/library/source/telemetry.c
+#
+# Usage:
+#   telemetry_decode.py [--port 28772] [--raw] [--csv frames.csv]
+#
+# Listens for the connection from the console, then prints a summary every second: frame times (average and
+# maximum), the latest value of each counter, and the count, average and maximum duration of each span. --raw prints
+# every record instead, --csv writes the frame records to a file.
+#
+# Stream layout (little endian): a sequence of records, each starting with a header {u16 size, u8 type, u8 reserved},
+# size being that of the whole record, a multiple of 8. The first record is the hello, with the tick frequency.
+#
+import argparse
+import socket
+import struct
+import sys
+import time
+
+TELEMETRY_MAGIC = 0x4D4C4554 # 'TELM'
+TELEMETRY_VERSION = 1
+
+TYPE_PAD, TYPE_HELLO, TYPE_NAME, TYPE_FRAME, TYPE_COUNTER, TYPE_SPAN = range(6)
+KIND_COUNTER, KIND_SPAN = range(2)
+
+HEADER = struct.Struct('<HBx')
+HELLO = struct.Struct('<IQI4x')
+NAME = struct.Struct('<HBB')
+FRAME = struct.Struct('<IQIII4x')
+COUNTER = struct.Struct('<H2xQq')
+SPAN = struct.Struct('<HHQQ')
+
+class Decoder:
+    def __init__(self, raw, csv):
+        self.raw = raw
+        self.csv = csv
+        self.tick_freq = None
+        self.names = {}
+        self.reset()
+
+    def reset(self):
+        self.frames = []
+        self.counters = {}
+        self.spans = {}
+
+    def name(self, kind, id):
+        return self.names.get((kind, id), '#%d' % id)
+
+    def us(self, ticks):
+        return ticks * 1e6 / self.tick_freq
+
+    def record(self, type, body):
+        if type == TYPE_PAD:
+            return
+        if type == TYPE_HELLO:
+            magic, self.tick_freq, version = HELLO.unpack_from(body)
+            if magic != TELEMETRY_MAGIC or version != TELEMETRY_VERSION:
+                sys.exit('unknown stream: magic 0x%08x, version %d' % (magic, version))
+            print('connected, tick frequency %d Hz' % self.tick_freq)
+            return
+        if self.tick_freq is None:
+            sys.exit('stream does not start with a hello record')
+
+        if type == TYPE_NAME:
+            id, kind, length = NAME.unpack_from(body)
+            self.names[(kind, id)] = body[NAME.size:NAME.size+length].decode('utf-8', 'replace')
+        elif type == TYPE_FRAME:
+            frame, tick, cpu_us, gpu_us, interval_us = FRAME.unpack_from(body)
+            self.frames.append((cpu_us, gpu_us, interval_us))
+            if self.raw:
+                print('frame %d: cpu %d us, gpu %d us, interval %d us' % (frame, cpu_us, gpu_us, interval_us))
+            if self.csv:
+                self.csv.write('%d,%d,%d,%d,%d\n' % (frame, tick, cpu_us, gpu_us, interval_us))
+        elif type == TYPE_COUNTER:
+            id, tick, value = COUNTER.unpack_from(body)
+            self.counters[id] = value
+            if self.raw:
+                print('counter %s = %d' % (self.name(KIND_COUNTER, id), value))
+        elif type == TYPE_SPAN:
+            id, depth, start, end = SPAN.unpack_from(body)
+            duration = self.us(end - start)
+            count, total, peak, _ = self.spans.get(id, (0, 0.0, 0.0, depth))
+            self.spans[id] = (count + 1, total + duration, max(peak, duration), depth)
+            if self.raw:
+                print('%sspan %s: %.1f us' % ('  ' * depth, self.name(KIND_SPAN, id), duration))
+
+    def summary(self):
+        if self.raw or self.tick_freq is None:
+            return
+        if self.frames:
+            n = len(self.frames)
+            print('%d frames: cpu avg %.0f/max %d us, interval avg %.0f/max %d us' % (n,
+                sum(f[0] for f in self.frames) / n, max(f[0] for f in self.frames),
+                sum(f[2] for f in self.frames) / n, max(f[2] for f in self.frames)))
+        for id, (count, total, peak, depth) in sorted(self.spans.items()):
+            print('  %s%-16s %6d x, avg %8.1f us, max %8.1f us' % ('  ' * depth, self.name(KIND_SPAN, id), count, total / count, peak))
+        for id, value in sorted(self.counters.items()):
+            print('  %-18s %d' % (self.name(KIND_COUNTER, id), value))
+        self.reset()
+
+def main():
+    parser = argparse.ArgumentParser(description='Decodes the telemetry stream of the console')
+    parser.add_argument('--port', type=int, default=28772)
+    parser.add_argument('--raw', action='store_true', help='print every record')
+    parser.add_argument('--csv', help='write the frame records to this file')
+    args = parser.parse_args()
+
+    csv = open(args.csv, 'w') if args.csv else None
+    if csv:
+        csv.write('frame,tick,cpu_us,gpu_us,interval_us\n')
+
+    server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    server.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    server.bind(('', args.port))
+    server.listen(1)
+    print('waiting for the console on port %d' % args.port)
+
+    conn, addr = server.accept()
+    print('connection from %s' % addr[0])
+    decoder = Decoder(args.raw, csv)
+
+    buf = b''
+    next_summary = time.monotonic() + 1.0
+    conn.settimeout(0.25)
+    while True:
+        try:
+            data = conn.recv(0x10000)
+            if not data:
+                break
+            buf += data
+        except socket.timeout:
+            pass
+
+        pos = 0
+        while len(buf) - pos >= HEADER.size:
+            size, type = HEADER.unpack_from(buf, pos)
+            if size < HEADER.size or size % 8:
+                sys.exit('corrupt stream: record of size %d' % size)
+            if len(buf) - pos < size:
+                break
+            decoder.record(type, buf[pos+HEADER.size:pos+size])
+            pos += size
+        buf = buf[pos:]
+
+        if time.monotonic() >= next_summary:
+            decoder.summary()
+            next_summary += 1.0
+
+    decoder.summary()
+    print('connection closed')
+    if csv:
+        csv.close()
+
+if __name__ == '__main__':
+    main()
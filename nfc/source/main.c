@@ -7,6 +7,8 @@
 // Include the main libnx system header, for Switch development
 #include <switch.h>
 
+#include "nfc_worker.h"
+
 // See also libnx nfc.h.
 
 // Indefinitely wait for an event to be signaled
@@ -31,138 +33,33 @@ void print_hex(void *buf, size_t size) {
     consoleUpdate(NULL);
 }
 
-Result process_amiibo(u32 app_id) {
-    Result rc = 0;
-
-    // Get the handle of the first controller with NFC capabilities.
-    NfcDeviceHandle handle={0};
-    if (R_SUCCEEDED(rc)) {
-        s32 device_count;
-        rc = nfpListDevices(&device_count, &handle, 1);
-
-        if (R_FAILED(rc))
-            return rc;
-    }
-
-    // Get the activation event. This is signaled when a tag is detected.
-    Event activate_event = {0};
-    if (R_FAILED(nfpAttachActivateEvent(&handle, &activate_event)))
-        goto fail_0;
-
-    // Get the deactivation event. This is signaled when a tag is removed.
-    Event deactivate_event = {0};
-    if (R_FAILED(nfpAttachDeactivateEvent(&handle, &deactivate_event)))
-        goto fail_1;
-
-    NfpState state = 0;
-    if (R_SUCCEEDED(rc)) {
-        rc = nfpGetState(&state);
-
-        if (R_SUCCEEDED(rc) && state == NfpState_NonInitialized) {
-            printf("Bad nfp state: %u\n", state);
-            consoleUpdate(NULL);
-            rc = -1;
-        }
-    }
-
-    NfpDeviceState device_state = 0;
-    if (R_SUCCEEDED(rc)) {
-        rc = nfpGetDeviceState(&handle, &device_state);
-
-        if (R_SUCCEEDED(rc) && device_state > NfpDeviceState_TagFound) {
-            printf("Bad nfp device state: %u\n", device_state);
-            consoleUpdate(NULL);
-            rc = -1;
-        }
-    }
-
-    if (R_FAILED(rc))
-        goto fail_1;
-
-    // Start the detection of tags.
-    rc = nfpStartDetection(&handle);
-    if (R_SUCCEEDED(rc)) {
-        printf("Scanning for a tag...\n");
-        consoleUpdate(NULL);
-    }
-
-    // Wait until a tag is detected.
-    // You could also wait until nfpGetDeviceState returns NfpDeviceState_TagFound.
-    if (R_SUCCEEDED(rc)) {
-        rc = eventWaitLoop(&activate_event);
-
-        if (R_SUCCEEDED(rc)) {
-            printf("A tag was detected, please do not remove it from the NFC spot.\n");
-            consoleUpdate(NULL);
-        }
-    }
-
-    // If a tag was successfully detected, load it into memory.
-    if (R_SUCCEEDED(rc))
-        rc = nfpMount(&handle, NfpDeviceType_Amiibo, NfpMountTarget_All);
-
-    // Retrieve the model info data, which contains the amiibo id.
-    if (R_SUCCEEDED(rc)) {
-        NfpModelInfo model_info = {0};
-        rc = nfpGetModelInfo(&handle, &model_info);
-
-        if (R_SUCCEEDED(rc)) {
-            printf("Amiibo ID: ");
-            print_hex(model_info.amiibo_id, 8);
-        }
+// Print a result posted by the worker.
+void print_result(const NfcWorkerResult *res, u32 app_id) {
+    if (res->type == NfcWorkerResult_TagRemoved) {
+        printf("The tag was removed.\n\n");
+        return;
     }
 
-    // Retrieve the common info data, which contains the application area size.
-    u32 app_area_size = 0;
-    if (R_SUCCEEDED(rc)) {
-        NfpCommonInfo common_info = {0};
-        rc = nfpGetCommonInfo(&handle, &common_info);
-
-        if (R_SUCCEEDED(rc))
-            app_area_size = common_info.application_area_size;
+    if (res->type == NfcWorkerResult_Error) {
+        printf("Error: 0x%x.\n\n", res->rc);
+        return;
     }
 
-    if (R_SUCCEEDED(rc)) {
-        rc = nfpOpenApplicationArea(&handle, app_id);
-
-        if (rc == 0x10073) // 2115-0128
-            printf("This tag contains no application data.\n");
-        if (rc == 0x13073) // 2115-0152
-            printf("This tag contains application data associated with an ID other than 0x%x.\n", app_id);
+    printf("Tag UID: ");
+    print_hex((void*)res->uid, res->uid_length);
+    printf("Amiibo ID: ");
+    print_hex((void*)res->amiibo_id, 8);
+
+    if (res->app_area_rc == 0x10073) // 2115-0128
+        printf("This tag contains no application data.\n");
+    else if (res->app_area_rc == 0x13073) // 2115-0152
+        printf("This tag contains application data associated with an ID other than 0x%x.\n", app_id);
+    else if (R_SUCCEEDED(res->app_area_rc)) {
+        printf("App area:\n");
+        print_hex((void*)res->app_area, res->app_area_size);
     }
 
-    u8 app_area[0xd8] = {0}; // Maximum size of the application area.
-    if (app_area_size > sizeof(app_area)) app_area_size = sizeof(app_area);
-    if (R_SUCCEEDED(rc)) {
-        rc = nfpGetApplicationArea(&handle, app_area, app_area_size);
-
-        if (R_SUCCEEDED(rc)) {
-            printf("App area:\n");
-            print_hex(app_area, app_area_size);
-        }
-    }
-
-    // Wait until the tag is removed.
-    // You could also wait until nfpGetDeviceState returns NfpDeviceState_TagRemoved.
-    if (R_SUCCEEDED(rc)) {
-        printf("You can now remove the tag.\n");
-        consoleUpdate(NULL);
-        eventWaitLoop(&deactivate_event);
-    }
-
-    // Unmount the tag.
-    nfpUnmount(&handle);
-
-    // Stop the detection of tags.
-    nfpStopDetection(&handle);
-
-    // Cleanup.
-fail_1:
-    eventClose(&deactivate_event);
-fail_0:
-    eventClose(&activate_event);
-
-    return rc;
+    printf("Read %s in %lu ms.\n\n", res->cached ? "from the cache" : "from the tag", armTicksToNs(res->read_ticks) / 1000000);
 }
 
 // Main program entrypoint
@@ -216,9 +113,16 @@ int main(int argc, char* argv[])
     if (R_FAILED(rc))
         goto fail_main;
 
-    printf("Press A to process an amiibo.\n");
-    printf("Press + at any time to exit.\n");
-    printf("Waiting for user input...\n\n");
+    // Tags are detected and read on a thread, the main loop only picks up the results.
+    NfcWorker worker;
+    rc = nfc_worker_start(&worker, app_id);
+    if (R_FAILED(rc)) {
+        printf("nfc_worker_start(): 0x%x\n", rc);
+        goto fail_main;
+    }
+
+    printf("Scanning for a tag...\n");
+    printf("Press + at any time to exit.\n\n");
     consoleUpdate(NULL);
 
     // Main loop
@@ -226,19 +130,11 @@ int main(int argc, char* argv[])
         // Scan all the inputs. This should be done once for each frame
         hidScanInput();
 
-        // hidKeysDown returns information about which buttons have been
-        // just pressed in this frame compared to the previous one
-        if (hidKeysDown(CONTROLLER_P1_AUTO) & KEY_A) {
-            rc = process_amiibo(app_id);
-
-            // If an error happened, print it.
-            if (R_FAILED(rc))
-                printf("Error: 0x%x.\n", rc);
+        // Print what the worker found since the previous frame.
+        NfcWorkerResult res;
+        while (nfc_worker_poll(&worker, &res))
+            print_result(&res, app_id);
 
-            printf("Waiting for user input...\n\n");
-        }
-
-        // If + was pressed to exit an eventWaitLoop(), we also catch it here.
         if (hidKeysDown(CONTROLLER_P1_AUTO) & KEY_PLUS)
             break; // break in order to return to hbmenu
 
@@ -246,6 +142,8 @@ int main(int argc, char* argv[])
         consoleUpdate(NULL);
     }
 
+    nfc_worker_stop(&worker);
+
 fail_main:
     nfpExit();
 
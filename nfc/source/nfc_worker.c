@@ -0,0 +1,238 @@
+#include <string.h>
+
+#include "nfc_worker.h"
+
+static void nfc_worker_post(NfcWorker* w, const NfcWorkerResult* res)
+{
+    mutexLock(&w->mutex);
+    // When the main loop falls behind, the oldest result is dropped: the newest ones describe the tag on the spot now
+    if (w->queue_head - w->queue_tail == NFC_WORKER_QUEUE_SIZE) {
+        w->queue_tail++;
+        w->dropped++;
+    }
+    w->queue[w->queue_head++ % NFC_WORKER_QUEUE_SIZE] = *res;
+    mutexUnlock(&w->mutex);
+}
+
+static const NfcWorkerResult* nfc_worker_cache_find(NfcWorker* w, const NfpTagInfo* info)
+{
+    for (u32 i = 0; i < w->cache_count; i++) {
+        const NfcWorkerResult* entry = &w->cache[i];
+        if (entry->uid_length == info->uid_length && memcmp(entry->uid, info->uid, info->uid_length) == 0)
+            return entry;
+    }
+    return NULL;
+}
+
+static void nfc_worker_cache_add(NfcWorker* w, const NfcWorkerResult* res)
+{
+    // Replaces the oldest entry once full
+    w->cache[w->cache_next] = *res;
+    w->cache_next = (w->cache_next + 1) % NFC_WORKER_CACHE_SIZE;
+    if (w->cache_count < NFC_WORKER_CACHE_SIZE)
+        w->cache_count++;
+}
+
+static void nfc_worker_read_tag(NfcWorker* w, const NfpTagInfo* info, NfcWorkerResult* res)
+{
+    // Load the tag into memory.
+    Result rc = nfpMount(&w->handle, NfpDeviceType_Amiibo, NfpMountTarget_All);
+
+    // Retrieve the model info data, which contains the amiibo id.
+    if (R_SUCCEEDED(rc)) {
+        NfpModelInfo model_info = {0};
+        rc = nfpGetModelInfo(&w->handle, &model_info);
+
+        if (R_SUCCEEDED(rc))
+            memcpy(res->amiibo_id, model_info.amiibo_id, sizeof(res->amiibo_id));
+    }
+
+    // Retrieve the common info data, which contains the application area size.
+    u32 app_area_size = 0;
+    if (R_SUCCEEDED(rc)) {
+        NfpCommonInfo common_info = {0};
+        rc = nfpGetCommonInfo(&w->handle, &common_info);
+
+        if (R_SUCCEEDED(rc))
+            app_area_size = common_info.application_area_size;
+    }
+    if (app_area_size > sizeof(res->app_area)) app_area_size = sizeof(res->app_area);
+
+    // A tag without application data for app_id is still a successful read.
+    if (R_SUCCEEDED(rc)) {
+        res->app_area_rc = nfpOpenApplicationArea(&w->handle, w->app_id);
+
+        if (R_SUCCEEDED(res->app_area_rc)) {
+            rc = nfpGetApplicationArea(&w->handle, res->app_area, app_area_size);
+
+            if (R_SUCCEEDED(rc))
+                res->app_area_size = app_area_size;
+        }
+    }
+
+    // The data was copied out, the tag doesn't need to stay mounted.
+    nfpUnmount(&w->handle);
+
+    res->rc = rc;
+    res->type = R_SUCCEEDED(rc) ? NfcWorkerResult_TagRead : NfcWorkerResult_Error;
+    memcpy(res->uid, info->uid, sizeof(res->uid));
+    res->uid_length = info->uid_length;
+}
+
+static void nfc_worker_on_activate(NfcWorker* w)
+{
+    NfcWorkerResult res;
+    memset(&res, 0, sizeof(res));
+    u64 start = armGetSystemTick();
+
+    NfpTagInfo info = {0};
+    Result rc = nfpGetTagInfo(&w->handle, &info);
+    if (R_SUCCEEDED(rc) && info.uid_length > sizeof(info.uid))
+        info.uid_length = sizeof(info.uid);
+
+    if (R_FAILED(rc)) {
+        res.type = NfcWorkerResult_Error;
+        res.rc = rc;
+    }
+    else {
+        const NfcWorkerResult* entry = nfc_worker_cache_find(w, &info);
+        if (entry) {
+            res = *entry;
+            res.cached = true;
+            w->cache_hits++;
+        }
+        else {
+            nfc_worker_read_tag(w, &info, &res);
+            // Failed reads aren't cached, the tag may just have been removed too early
+            if (res.type == NfcWorkerResult_TagRead)
+                nfc_worker_cache_add(w, &res);
+        }
+    }
+
+    res.read_ticks = armGetSystemTick() - start;
+    nfc_worker_post(w, &res);
+}
+
+static void nfc_worker_thread_func(void* arg)
+{
+    NfcWorker* w = (NfcWorker*)arg;
+
+    for (;;) {
+        s32 idx = -1;
+        Result rc = waitMulti(&idx, -1, waiterForEvent(&w->activate_event), waiterForEvent(&w->deactivate_event),
+            waiterForUEvent(&w->exit_event));
+
+        mutexLock(&w->mutex);
+        bool stop = w->exit;
+        mutexUnlock(&w->mutex);
+
+        if (stop || R_FAILED(rc))
+            break;
+
+        if (idx == 0) {
+            eventClear(&w->activate_event);
+            nfc_worker_on_activate(w);
+        }
+        else if (idx == 1) {
+            eventClear(&w->deactivate_event);
+
+            NfcWorkerResult res;
+            memset(&res, 0, sizeof(res));
+            res.type = NfcWorkerResult_TagRemoved;
+            nfc_worker_post(w, &res);
+
+            // Look for the next tag.
+            nfpStopDetection(&w->handle);
+            nfpStartDetection(&w->handle);
+        }
+    }
+}
+
+Result nfc_worker_start(NfcWorker* w, u32 app_id)
+{
+    memset(w, 0, sizeof(*w));
+    w->app_id = app_id;
+
+    // Get the handle of the first controller with NFC capabilities.
+    s32 device_count;
+    Result rc = nfpListDevices(&device_count, &w->handle, 1);
+    if (R_FAILED(rc))
+        return rc;
+
+    // Get the activation event. This is signaled when a tag is detected.
+    rc = nfpAttachActivateEvent(&w->handle, &w->activate_event);
+    if (R_FAILED(rc))
+        return rc;
+
+    // Get the deactivation event. This is signaled when a tag is removed.
+    rc = nfpAttachDeactivateEvent(&w->handle, &w->deactivate_event);
+    if (R_FAILED(rc))
+        goto fail_0;
+
+    NfpState state = 0;
+    rc = nfpGetState(&state);
+    if (R_SUCCEEDED(rc) && state == NfpState_NonInitialized)
+        rc = -1;
+
+    NfpDeviceState device_state = 0;
+    if (R_SUCCEEDED(rc)) {
+        rc = nfpGetDeviceState(&w->handle, &device_state);
+        if (R_SUCCEEDED(rc) && device_state > NfpDeviceState_TagFound)
+            rc = -1;
+    }
+
+    // Start the detection of tags, it stays on until the worker is stopped.
+    if (R_SUCCEEDED(rc))
+        rc = nfpStartDetection(&w->handle);
+    if (R_FAILED(rc))
+        goto fail_1;
+
+    mutexInit(&w->mutex);
+    ueventCreate(&w->exit_event, false);
+
+    // Same priority as the main thread: mounting a tag is mostly waiting on the controller
+    rc = threadCreate(&w->thread, nfc_worker_thread_func, w, NULL, 0x4000, 0x2C, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&w->thread);
+        if (R_FAILED(rc))
+            threadClose(&w->thread);
+    }
+    if (R_FAILED(rc))
+        goto fail_2;
+
+    return 0;
+
+fail_2:
+    nfpStopDetection(&w->handle);
+fail_1:
+    eventClose(&w->deactivate_event);
+fail_0:
+    eventClose(&w->activate_event);
+    memset(w, 0, sizeof(*w));
+    return rc;
+}
+
+void nfc_worker_stop(NfcWorker* w)
+{
+    mutexLock(&w->mutex);
+    w->exit = true;
+    mutexUnlock(&w->mutex);
+    ueventSignal(&w->exit_event);
+
+    threadWaitForExit(&w->thread);
+    threadClose(&w->thread);
+
+    nfpStopDetection(&w->handle);
+    eventClose(&w->deactivate_event);
+    eventClose(&w->activate_event);
+}
+
+bool nfc_worker_poll(NfcWorker* w, NfcWorkerResult* out)
+{
+    mutexLock(&w->mutex);
+    bool found = w->queue_tail != w->queue_head;
+    if (found)
+        *out = w->queue[w->queue_tail++ % NFC_WORKER_QUEUE_SIZE];
+    mutexUnlock(&w->mutex);
+    return found;
+}
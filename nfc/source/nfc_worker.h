@@ -0,0 +1,60 @@
+#pragma once
+#include <switch.h>
+
+// Background NFC worker.
+//
+// A thread keeps detection running and waits on the activate and deactivate events of the controller (and on an
+// exit event) with waitMulti. When a tag is detected it mounts it, reads the model info and the application area,
+// and unmounts it, then posts the result to a queue that the main loop polls with nfc_worker_poll. Reads are cached
+// per tag UID, so tapping a tag again doesn't mount it again.
+
+#define NFC_WORKER_APP_AREA_MAX 0xd8   // Maximum size of the application area
+#define NFC_WORKER_QUEUE_SIZE 8
+#define NFC_WORKER_CACHE_SIZE 16
+
+typedef enum {
+    NfcWorkerResult_TagRead,     // A tag was detected and read (or found in the cache)
+    NfcWorkerResult_TagRemoved,
+    NfcWorkerResult_Error,       // A tag was detected, but reading it failed, see rc
+} NfcWorkerResultType;
+
+typedef struct {
+    NfcWorkerResultType type;
+    Result rc;
+    u8 uid[10];
+    u8 uid_length;
+    u8 amiibo_id[8];
+    Result app_area_rc;          // Result of nfpOpenApplicationArea, the area is only valid if this succeeded
+    u8 app_area[NFC_WORKER_APP_AREA_MAX];
+    u32 app_area_size;
+    bool cached;                 // The tag wasn't mounted, the data comes from an earlier read
+    u64 read_ticks;              // Time taken by the read, on the worker thread
+} NfcWorkerResult;
+
+typedef struct {
+    Thread thread;
+    Mutex mutex;                 // Protects the queue and exit
+    UEvent exit_event;
+
+    NfcDeviceHandle handle;
+    Event activate_event;
+    Event deactivate_event;
+    u32 app_id;
+    bool exit;
+
+    NfcWorkerResult queue[NFC_WORKER_QUEUE_SIZE];
+    u32 queue_head, queue_tail;
+    u32 dropped;                 // Results lost because the queue was full
+
+    // Only used by the worker thread
+    NfcWorkerResult cache[NFC_WORKER_CACHE_SIZE];
+    u32 cache_count, cache_next;
+    u32 cache_hits;
+} NfcWorker;
+
+// nfp must be initialized. Uses the first controller with NFC capabilities, and reads the application area of app_id.
+Result nfc_worker_start(NfcWorker* w, u32 app_id);
+void nfc_worker_stop(NfcWorker* w);
+
+// Returns true and copies the oldest result if there is one, never blocks
+bool nfc_worker_poll(NfcWorker* w, NfcWorkerResult* out);
@@ -0,0 +1,57 @@
+#pragma once
+#include <switch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Linear allocator: allocating bumps an offset, and everything allocated after a mark is freed at once by going back to
+// it. Meant for what lives for a frame, a level or a request, e.g. reset once per frame. Not thread safe: one arena per
+// thread.
+
+typedef struct {
+    u8* base;
+    size_t size;
+    size_t used;
+    size_t peak;                  // Highest used has been, for sizing
+    bool owned;                   // base was allocated by arenaCreate
+} Arena;
+
+typedef size_t ArenaMark;
+
+Result arenaCreate(Arena* a, size_t size);
+// Over memory the caller keeps, e.g. a static array
+void arenaInit(Arena* a, void* mem, size_t size);
+void arenaClose(Arena* a);
+
+// align must be a power of 2. NULL if there's no room left.
+static inline void* arenaAlloc(Arena* a, size_t size, size_t align)
+{
+    size_t offset = (a->used + align - 1) & ~(align - 1);
+    if (offset > a->size || size > a->size - offset)
+        return NULL;
+    a->used = offset + size;
+    if (a->used > a->peak)
+        a->peak = a->used;
+    return a->base + offset;
+}
+
+static inline ArenaMark arenaMark(const Arena* a)
+{
+    return a->used;
+}
+
+// Frees everything allocated since the mark
+static inline void arenaRewind(Arena* a, ArenaMark mark)
+{
+    a->used = mark;
+}
+
+static inline void arenaReset(Arena* a)
+{
+    a->used = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,76 @@
+#pragma once
+#include <string.h>
+#include <switch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Logging which doesn't serialize the threads doing it.
+//
+// Wrapping printf in a mutex makes every thread which prints wait for the others, and for the console: output then
+// changes the very timing it's trying to show. Instead, asyncLog doesn't format anything. It copies the format pointer
+// and up to ASYNC_LOG_MAX_ARGS arguments, as 64-bit words, into a ring belonging to the calling thread (allocated the
+// first time it logs, no other thread writes to it). One thread takes the records from all the rings in the order they
+// were logged, formats them, and writes them to stdout.
+//
+// The log thread sleeps when the rings are empty, and a writer only signals it when it has seen it going to sleep: the
+// cost of a record is that of a dozen stores and a memory barrier. If a ring is full, the record is dropped and
+// counted instead of waiting.
+//
+// Formats are the ones of printf, checked the same way, without '*' widths or precisions, or long double. The format
+// and the strings of %s aren't copied: they must still be valid when the log thread gets to them, string literals
+// usually. PrintConsole isn't thread-safe: with update_console, the log thread calls consoleUpdate after writing, and
+// no other thread may use the console until asyncLogExit.
+
+#define ASYNC_LOG_RING_RECORDS 256    // Per thread, a power of 2
+#define ASYNC_LOG_MAX_ARGS 8
+
+// Starts the log thread at the given priority, records written before are dropped
+bool asyncLogInit(int prio, bool update_console);
+// Writes what's left, and stops the thread. Call it once the other threads are done logging.
+void asyncLogExit(void);
+
+void asyncLogWrite(const char* fmt, u32 num_args, const u64* args);
+
+// Records dropped because a ring was full, since asyncLogInit
+u64 asyncLogGetDropped(void);
+
+#define asyncLog(fmt, ...) do { \
+    if (0) \
+        asyncLogFormatCheck(fmt, ##__VA_ARGS__); \
+    const u64 async_log_args_[] = { 0, ASYNC_LOG_MAP(__VA_ARGS__) }; \
+    asyncLogWrite(fmt, sizeof(async_log_args_) / sizeof(u64) - 1, async_log_args_ + 1); \
+} while (0)
+
+__attribute__((format(printf, 1, 2)))
+static inline void asyncLogFormatCheck(const char* fmt, ...)
+{
+    (void)fmt;
+}
+
+// The bits of an argument, after the promotions printf would see: small integers to int, float to double
+#define ASYNC_LOG_ARG(x) ({ \
+    __typeof__(_Generic((x) + 0, float: 0.0, default: (x) + 0)) async_log_v_ = (x) + 0; \
+    _Static_assert(sizeof(async_log_v_) <= sizeof(u64), "asyncLog arguments are at most 64-bit"); \
+    u64 async_log_b_ = 0; \
+    memcpy(&async_log_b_, &async_log_v_, sizeof(async_log_v_)); \
+    async_log_b_; \
+})
+
+// A comma-separated ASYNC_LOG_ARG of each argument
+#define ASYNC_LOG_MAP_(_0, _1, _2, _3, _4, _5, _6, _7, _8, N, ...) ASYNC_LOG_MAP##N
+#define ASYNC_LOG_MAP(...) ASYNC_LOG_MAP_(0, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)(__VA_ARGS__)
+#define ASYNC_LOG_MAP0(...)
+#define ASYNC_LOG_MAP1(a) ASYNC_LOG_ARG(a)
+#define ASYNC_LOG_MAP2(a, ...) ASYNC_LOG_ARG(a), ASYNC_LOG_MAP1(__VA_ARGS__)
+#define ASYNC_LOG_MAP3(a, ...) ASYNC_LOG_ARG(a), ASYNC_LOG_MAP2(__VA_ARGS__)
+#define ASYNC_LOG_MAP4(a, ...) ASYNC_LOG_ARG(a), ASYNC_LOG_MAP3(__VA_ARGS__)
+#define ASYNC_LOG_MAP5(a, ...) ASYNC_LOG_ARG(a), ASYNC_LOG_MAP4(__VA_ARGS__)
+#define ASYNC_LOG_MAP6(a, ...) ASYNC_LOG_ARG(a), ASYNC_LOG_MAP5(__VA_ARGS__)
+#define ASYNC_LOG_MAP7(a, ...) ASYNC_LOG_ARG(a), ASYNC_LOG_MAP6(__VA_ARGS__)
+#define ASYNC_LOG_MAP8(a, ...) ASYNC_LOG_ARG(a), ASYNC_LOG_MAP7(__VA_ARGS__)
+
+#ifdef __cplusplus
+}
+#endif
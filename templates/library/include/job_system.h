@@ -0,0 +1,52 @@
+#pragma once
+#include <switch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A work-stealing job system.
+//
+// jobSystemInit starts one worker thread on each core the application can use, other than the one of the calling
+// thread, pinned to it. The calling thread is a worker too, but only while it waits for jobs (jobWait), so it never
+// sits idle either.
+//
+// Each worker has a Chase-Lev deque of jobs: it pushes the jobs it creates and takes them back from the same end, so
+// the jobs it runs are the most recent ones, while idle workers steal the oldest ones from the other end. Workers with
+// nothing to run or steal sleep until a job is pushed.
+//
+// Instead of a barrier, jobs are grouped with a JobCounter: jobRun adds one to it, and it's decremented once the job
+// has run. jobWait runs jobs until the counter is back to 0, so a job can create child jobs and wait for them without
+// blocking its worker. jobParallelFor splits a range into jobs as they're stolen, so uneven work spreads over the cores.
+//
+// Jobs can only be created by the workers, that is by jobs and by the thread which called jobSystemInit. jobRun called
+// from another thread, or when the worker's deque is full, runs the job right away.
+
+#define JOB_DEQUE_SIZE 1024           // Jobs waiting per worker, a power of 2
+#define JOB_MAX_WORKERS 4
+
+typedef void (*JobFunc)(void* arg);
+typedef void (*JobRangeFunc)(void* arg, u32 begin, u32 end);
+
+typedef struct {
+    u32 value;                    // Jobs not finished yet
+} JobCounter;
+
+Result jobSystemInit(void);
+// Waits for the workers to finish the job they're running, jobs which weren't started are dropped
+void jobSystemExit(void);
+
+// Number of workers, the thread which called jobSystemInit included
+u32 jobSystemGetNumWorkers(void);
+
+void jobRun(JobFunc func, void* arg, JobCounter* counter);
+// Runs jobs until every job added to counter has run
+void jobWait(JobCounter* counter);
+
+// Calls func for [begin, end) ranges covering [0, count), of at most grain items, and returns once
+// they're all done
+void jobParallelFor(u32 count, u32 grain, JobRangeFunc func, void* arg);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+#include <switch.h>
+#include <turbojpeg.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Decoding of JPEG images (icons, profile pictures) straight into small square RGBA8 thumbnails.
+//
+// The image is decoded at the smallest IDCT scaling of libjpeg-turbo which still gives at least the thumbnail size:
+// the decoder then only computes the low frequencies, so a quarter of the pixels cost much less than a quarter of the
+// time. A 256x256 image is decoded at 1/4 straight into a 64x64 thumbnail. Images which don't scale to the exact size
+// are decoded as small as possible into a temporary buffer, then point sampled.
+//
+// Unlike the other headers, this one isn't included by perf.h: it needs libjpeg-turbo, link -lturbojpeg after -lperf.
+
+// Decodes into out, size*size pixels with rows tightly packed. tj comes from tjInitDecompress, one per thread.
+bool jpegDecodeThumbnail(tjhandle tj, const void* jpeg, u32 jpeg_size, u32* out, u32 size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,55 @@
+#pragma once
+#include <switch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A bounded lock-free queue for many producer threads and one consumer thread, with a UEvent to wait on.
+//
+// Producers claim a slot with a compare-and-swap and publish it with its sequence number, they never wait for each
+// other or for the consumer. The event isn't signaled on every push: only the first push after the consumer announced
+// that it's about to wait (mpscQueuePrepareWait) signals it, so the consumer wakes once and drains what came in
+// meanwhile in one batch.
+//
+// Consumer loop:
+//     for (;;) {
+//         while ((n = mpscQueuePop(&q, batch, 32)))
+//             process(batch, n);
+//         if (mpscQueuePrepareWait(&q))
+//             waitMulti(&idx, -1, mpscQueueWaiter(&q), waiterForUEvent(&exit_event));
+//     }
+
+typedef struct {
+    u32* seqs;                    // Of each slot: its position when free, its position + 1 once published
+    u8* data;
+    u32 capacity;                 // A power of 2
+    u32 elem_size;
+    u32 head;                     // Only used by the consumer
+
+    u32 tail __attribute__((aligned(64)));
+    u32 sleeping __attribute__((aligned(64)));
+    u32 signals;                  // Number of times the event was signaled, for statistics
+
+    UEvent event;
+} MpscQueue;
+
+Result mpscQueueCreate(MpscQueue* q, u32 capacity, u32 elem_size);
+void mpscQueueClose(MpscQueue* q);
+
+// Copies elem into the queue, returns false if it's full
+bool mpscQueuePush(MpscQueue* q, const void* elem);
+
+// Consumer only: copies up to max elements to out, returns how many
+u32 mpscQueuePop(MpscQueue* q, void* out, u32 max);
+// Consumer only: to call once mpscQueuePop returned 0, before waiting. Returns false if an element came in meanwhile,
+// then it shouldn't wait.
+bool mpscQueuePrepareWait(MpscQueue* q);
+
+static inline Waiter mpscQueueWaiter(MpscQueue* q) {
+    return waiterForUEvent(&q->event);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,42 @@
+#pragma once
+#include <stddef.h>
+#include <switch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Non-blocking logging to the nxlink host.
+//
+// nxlinkStdio() makes stdout the socket itself, so every printf waits for the network, and debug output changes the
+// timing of the frame it's trying to show. Instead, nxlinkLogInit connects to the host and takes over stdout and
+// stderr: what they write is copied into a ring of fixed-size slots, and a low-priority thread sends it to the host in
+// batches. Writers never wait, neither on the socket nor on each other (a slot is claimed with a compare-and-swap).
+// When the ring is full, the write is dropped and counted instead.
+//
+// stdout is line-buffered, so that each line is written to the ring whole. Like nxlinkStdio, call it after
+// consoleInit, output then goes to nxlink only.
+//
+// Usage:
+//     void userAppInit(void) { nxlinkLogInit(); }
+//     void userAppExit(void) { nxlinkLogExit(); }
+
+#define NXLINK_LOG_SLOTS 512
+#define NXLINK_LOG_SLOT_SIZE 128
+#define NXLINK_LOG_FLUSH_INTERVAL_MS 5
+
+// Returns false if the app wasn't started through nxlink, or the host can't be reached
+bool nxlinkLogInit(void);
+// Sends what's left, and gives stdout and stderr back
+void nxlinkLogExit(void);
+
+// Writes to the ring directly, without going through stdio
+void nxlinkLogWrite(const char* data, size_t size);
+void nxlinkLogPrintf(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
+
+// Writes and bytes dropped because the ring was full, since nxlinkLogInit
+u64 nxlinkLogGetDropped(u64* bytes);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,24 @@
+#pragma once
+
+// libperf: the primitives shared by the examples, as one static library.
+//
+// Allocators:  arena.h (linear, per frame), pool.h (fixed-size objects)
+// Queues:      spsc_queue.h (one producer), mpsc_queue.h (many producers, with a UEvent)
+// Threads:     job_system.h (work stealing), timer_wheel.h (many timers on one UTimer)
+// Timing:      timing.h (ticks, conversions without division, scope timers)
+// Logging:     async_log.h (per-thread rings, formatted on a background thread), nxlink_log.h
+// Profiling:   trace.h (Chrome trace spans), telemetry.h (binary records to the nxlink host)
+
+#include "arena.h"
+#include "pool.h"
+#include "spsc_queue.h"
+
+#include "mpsc_queue.h"
+#include "job_system.h"
+#include "timer_wheel.h"
+#include "timing.h"
+#include "async_log.h"
+
+#include "nxlink_log.h"
+#include "trace.h"
+#include "telemetry.h"
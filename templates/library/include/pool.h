@@ -0,0 +1,47 @@
+#pragma once
+#include <switch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Pool of objects of one size, allocated all at once: poolAlloc and poolFree pop and push an intrusive free list, in
+// constant time, without ever fragmenting. Freed objects are reused first, while their cache lines are still warm. Not
+// thread safe: one pool per thread, or a lock around it.
+
+typedef struct {
+    u8* mem;
+    void* free_list;
+    u32 elem_size;                // Rounded up to hold a pointer, and keep objects aligned to it
+    u32 capacity;
+    u32 in_use;
+    u32 peak;
+} Pool;
+
+Result poolCreate(Pool* p, u32 elem_size, u32 capacity);
+void poolClose(Pool* p);
+
+// NULL if all the objects are in use
+static inline void* poolAlloc(Pool* p)
+{
+    void* obj = p->free_list;
+    if (!obj)
+        return NULL;
+    p->free_list = *(void**)obj;
+    if (++p->in_use > p->peak)
+        p->peak = p->in_use;
+    return obj;
+}
+
+static inline void poolFree(Pool* p, void* obj)
+{
+    if (!obj)
+        return;
+    *(void**)obj = p->free_list;
+    p->free_list = obj;
+    p->in_use--;
+}
+
+#ifdef __cplusplus
+}
+#endif
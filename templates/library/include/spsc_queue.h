@@ -0,0 +1,38 @@
+#pragma once
+#include <switch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A bounded lock-free queue for one producer thread and one consumer thread.
+//
+// With a single producer, claiming a slot doesn't need a compare-and-swap as in MpscQueue: each side owns its index,
+// and only publishes it with a release store. Each side also keeps the last value it read of the other's index, and
+// only reads it again when the queue looks full (or empty) with it, so that the cache line of the other side isn't
+// pulled over on every push and pop. There's no event: the consumer polls, or pairs the queue with its own UEvent.
+
+typedef struct {
+    u8* data;
+    u32 capacity;                 // A power of 2
+    u32 elem_size;
+
+    u32 head __attribute__((aligned(64)));    // Written by the consumer
+    u32 cached_tail;
+
+    u32 tail __attribute__((aligned(64)));    // Written by the producer
+    u32 cached_head;
+} SpscQueue;
+
+Result spscQueueCreate(SpscQueue* q, u32 capacity, u32 elem_size);
+void spscQueueClose(SpscQueue* q);
+
+// Producer only: copies elem into the queue, returns false if it's full
+bool spscQueuePush(SpscQueue* q, const void* elem);
+
+// Consumer only: copies up to max elements to out, returns how many
+u32 spscQueuePop(SpscQueue* q, void* out, u32 max);
+
+#ifdef __cplusplus
+}
+#endif
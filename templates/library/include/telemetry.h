@@ -0,0 +1,118 @@
+#pragma once
+#include <stddef.h>
+#include <switch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Binary telemetry to the nxlink host.
+//
+// Printing metrics as text every frame, and parsing them back on the host, costs more than the metrics are worth.
+// Instead, records with a fixed layout (frame times, counters, trace spans) are written in place into a ring buffer,
+// and telemetryFlush sends what's pending with one non-blocking writev of the (at most two) pieces of the ring, without
+// copying. If the host doesn't keep up and the ring fills, new records are dropped and counted.
+//
+// The stream is a sequence of records, each starting with a TelemetryHeader which gives its size (a multiple of 8) and
+// type, in little endian. It starts with a TelemetryHello. network/telemetry/tools/telemetry_decode.py listens for it
+// on the host, and decodes it.
+//
+// The API isn't thread-safe: record and flush from one thread, e.g. the main loop, flushing once per frame. Sockets
+// must be initialized.
+
+#define TELEMETRY_PORT 28772
+#define TELEMETRY_RING_SIZE 0x8000
+#define TELEMETRY_MAGIC 0x4D4C4554 // "TELM"
+#define TELEMETRY_VERSION 1
+#define TELEMETRY_NAME_MAX 48
+
+typedef enum {
+    TelemetryType_Pad,                // Fills the end of the ring, skipped by the decoder
+    TelemetryType_Hello,
+    TelemetryType_Name,
+    TelemetryType_Frame,
+    TelemetryType_Counter,
+    TelemetryType_Span,
+} TelemetryType;
+
+typedef enum {
+    TelemetryKind_Counter,
+    TelemetryKind_Span,
+} TelemetryKind;
+
+typedef struct {
+    u16 size;
+    u8 type;                          // TelemetryType
+    u8 reserved;
+} TelemetryHeader;
+
+typedef struct {
+    TelemetryHeader hdr;
+    u32 magic;
+    u64 tick_freq;                    // Of the ticks in the other records
+    u32 version;
+    u32 reserved;
+} TelemetryHello;
+
+// Names an id of telemetryRegister, sent once
+typedef struct {
+    TelemetryHeader hdr;
+    u16 id;
+    u8 kind;                          // TelemetryKind
+    u8 len;
+    char name[];                      // Not NUL-terminated, padded to 8 bytes
+} TelemetryName;
+
+typedef struct {
+    TelemetryHeader hdr;
+    u32 frame;
+    u64 tick;
+    u32 cpu_us, gpu_us, interval_us;
+    u32 reserved;
+} TelemetryFrame;
+
+typedef struct {
+    TelemetryHeader hdr;
+    u16 id;
+    u16 reserved;
+    u64 tick;
+    s64 value;
+} TelemetryCounter;
+
+typedef struct {
+    TelemetryHeader hdr;
+    u16 id;
+    u16 depth;                        // Nesting, for the decoder to show spans as a tree
+    u64 start_tick, end_tick;
+} TelemetrySpan;
+
+typedef struct {
+    u64 records, dropped;
+    u64 bytes_sent;
+    u32 flushes_blocked;              // Flushes where the socket didn't take everything
+} TelemetryStats;
+
+// Connects to the nxlink host, returns false if the app wasn't started through nxlink or the decoder isn't running
+bool telemetryInit(void);
+// Sends what's pending, waiting for at most a second
+void telemetryExit(void);
+bool telemetryIsConnected(void);
+
+// Returns the id to use for the counter or span, and sends its name
+u16 telemetryRegister(TelemetryKind kind, const char* name);
+
+void telemetryFrame(u32 frame, u32 cpu_us, u32 gpu_us, u32 interval_us);
+void telemetryCounter(u16 id, s64 value);
+
+// Spans nest: telemetrySpanEnd closes the last span begun
+void telemetrySpanBegin(void);
+void telemetrySpanEnd(u16 id);
+
+// Sends what it can without blocking
+void telemetryFlush(void);
+
+void telemetryGetStats(TelemetryStats* out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,11 +0,0 @@
-#pragma once
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-int myLibFunction();
-
-#ifdef __cplusplus
-}
-#endif
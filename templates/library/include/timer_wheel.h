@@ -0,0 +1,66 @@
+#pragma once
+#include <switch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Many timeouts driven by a single UTimer.
+//
+// The timers are kept in a hierarchical timer wheel: 256 slots of one tick (the resolution given to timerWheelStart),
+// then 3 levels of 64 slots of 64 times the previous slot length, for delays up to 2^26 ticks (18 hours at 1 ms, longer
+// delays are rescheduled once they're in range). Adding or cancelling a timer only links or unlinks it from the list of
+// its slot, and timers in the higher levels move down one level each time the level below goes round.
+//
+// A thread sleeps on one UTimer armed for the next slot which has timers, and calls their callbacks once they expire.
+// Callbacks run on that thread, without the wheel locked: they can add timers (themselves included, to repeat) and
+// cancel timers.
+//
+// The TimerWheelTimer structs belong to the caller, and must stay valid while they're scheduled.
+
+#define TIMER_WHEEL_LEVELS 4
+#define TIMER_WHEEL_L0_BITS 8
+#define TIMER_WHEEL_LN_BITS 6
+
+typedef struct TimerWheelTimer TimerWheelTimer;
+typedef void (*TimerWheelCallback)(TimerWheelTimer* timer, void* arg);
+
+struct TimerWheelTimer {
+    TimerWheelTimer* next;
+    TimerWheelTimer** pprev;      // NULL when not scheduled
+    u64 expires;                  // In ticks of the wheel
+    TimerWheelCallback callback;
+    void* arg;
+};
+
+typedef struct {
+    Mutex mutex;
+    Thread thread;
+    UTimer timer;
+    UEvent wake_event;
+    bool exit;
+
+    u64 base_tick;                // System tick of tick 0 of the wheel
+    u64 tick_length;              // In system ticks
+    u64 now;                      // Next tick to process
+    u64 armed;                    // Tick the UTimer is armed for, UINT64_MAX if none
+    u32 count;                    // Timers scheduled
+
+    TimerWheelTimer* slots[TIMER_WHEEL_LEVELS][1 << TIMER_WHEEL_L0_BITS];
+    u64 occupied[TIMER_WHEEL_LEVELS][(1 << TIMER_WHEEL_L0_BITS) / 64];
+    TimerWheelTimer* expired;     // Taken from a slot, their callbacks not called yet
+} TimerWheel;
+
+// Starts the thread, at the given priority, with ticks of resolution_ns
+Result timerWheelStart(TimerWheel* w, u64 resolution_ns, int prio);
+// Timers not expired yet are dropped
+void timerWheelStop(TimerWheel* w);
+
+// Schedules callback to be called in delay_ns (rounded up to a tick). If the timer is already scheduled, it's moved.
+void timerWheelAdd(TimerWheel* w, TimerWheelTimer* t, u64 delay_ns, TimerWheelCallback callback, void* arg);
+// Returns false if the timer wasn't scheduled (it may have expired, its callback may be running)
+bool timerWheelCancel(TimerWheel* w, TimerWheelTimer* t);
+
+#ifdef __cplusplus
+}
+#endif
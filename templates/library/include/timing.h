@@ -0,0 +1,132 @@
+#pragma once
+#include <switch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Timing with the system tick, and conversions which don't divide.
+//
+// armGetSystemTick reads the counter register directly: it's monotonic, shared by all cores, and costs a few cycles.
+// svcGetSystemTick reads the same counter through a system call, and the time service (time(NULL), gmtime,
+// timeGetCurrentTime) is an IPC call: neither belongs in anything measured per frame.
+//
+// Conversions multiply by a 64.64 fixed point ratio: one multiplication for the integer part, one high half
+// multiplication (umulh) for the fraction, they're off by at most a nanosecond or a tick. The ratios are computed from
+// armGetSystemTickFreq by timingInit, and default to the 19.2 MHz of the Switch until then.
+//
+// timingUnixNs is the wall clock derived from the tick: the time service is sampled once, by timingInit or
+// timingCalibrateWallClock, and the time elapsed since is added on the application side. It follows the system clock
+// as it was at calibration: changes to it (e.g. network time sync) are only seen after calibrating again.
+//
+// Scope timers accumulate the time spent in a block into a TimingStat:
+//     static TimingStat s_update;
+//     void update(void) {
+//         TIMING_SCOPE(&s_update);
+//         ...
+//     }
+
+typedef struct {
+    u64 freq;
+    u64 ns_int, ns_frac;                // ns = ticks * (ns_int + ns_frac / 2^64)
+    u64 ticks_int, ticks_frac;          // ticks = ns * (ticks_int + ticks_frac / 2^64)
+    u64 unix_ns;                        // Wall clock at unix_tick
+    u64 unix_tick;
+} TimingClock;
+
+extern TimingClock g_timingClock;
+
+// Reads the tick frequency and samples the wall clock, to the second
+void timingInit(void);
+// Samples the wall clock on the edge of a second, to get it to the tick: waits about half a second on average, up to
+// one. Returns false if the time service failed.
+bool timingCalibrateWallClock(void);
+
+// Steady clock, in ticks
+static inline u64 timingNow(void)
+{
+    return armGetSystemTick();
+}
+
+static inline u64 timingTicksToNs(u64 ticks)
+{
+    return ticks * g_timingClock.ns_int + (u64)(((unsigned __int128)ticks * g_timingClock.ns_frac) >> 64);
+}
+
+static inline u64 timingNsToTicks(u64 ns)
+{
+    return ns * g_timingClock.ticks_int + (u64)(((unsigned __int128)ns * g_timingClock.ticks_frac) >> 64);
+}
+
+// Steady clock, in ns since boot
+static inline u64 timingNowNs(void)
+{
+    return timingTicksToNs(armGetSystemTick());
+}
+
+// Wall clock, in ns since 1970, without calling the time service
+static inline u64 timingUnixNs(void)
+{
+    return g_timingClock.unix_ns + timingTicksToNs(armGetSystemTick() - g_timingClock.unix_tick);
+}
+
+typedef struct {
+    u64 count;
+    u64 total;                          // Ticks
+    u64 min, max;
+} TimingStat;
+
+static inline void timingStatAdd(TimingStat* stat, u64 ticks)
+{
+    if (!stat->count || ticks < stat->min)
+        stat->min = ticks;
+    if (ticks > stat->max)
+        stat->max = ticks;
+    stat->total += ticks;
+    stat->count++;
+}
+
+static inline void timingStatReset(TimingStat* stat)
+{
+    stat->count = stat->total = stat->min = stat->max = 0;
+}
+
+// Mean, in ns
+static inline u64 timingStatMeanNs(const TimingStat* stat)
+{
+    return stat->count ? timingTicksToNs(stat->total / stat->count) : 0;
+}
+
+#define TIMING_CONCAT_(a, b) a##b
+#define TIMING_CONCAT(a, b) TIMING_CONCAT_(a, b)
+
+#ifdef __cplusplus
+}
+
+struct TimingScope
+{
+    TimingStat* stat;
+    u64 start;
+
+    TimingScope(TimingStat* stat) : stat(stat), start(armGetSystemTick()) {}
+    ~TimingScope() { timingStatAdd(stat, armGetSystemTick() - start); }
+    TimingScope(const TimingScope&) = delete;
+    TimingScope& operator=(const TimingScope&) = delete;
+};
+
+#define TIMING_SCOPE(stat) TimingScope TIMING_CONCAT(timing_scope_, __LINE__)(stat)
+#else
+typedef struct {
+    TimingStat* stat;
+    u64 start;
+} TimingScope;
+
+static inline void timingScopeEnd(TimingScope* scope)
+{
+    timingStatAdd(scope->stat, armGetSystemTick() - scope->start);
+}
+
+// The time is added when the variable goes out of scope, however the block is left
+#define TIMING_SCOPE(stat) \
+    __attribute__((cleanup(timingScopeEnd), unused)) TimingScope TIMING_CONCAT(timing_scope_, __LINE__) = { (stat), armGetSystemTick() }
+#endif
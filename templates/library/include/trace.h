@@ -0,0 +1,83 @@
+#pragma once
+#include <switch.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Span profiler, written as a Chrome trace (chrome://tracing, or https://ui.perfetto.dev).
+//
+// TRACE_SCOPE("name") times the rest of the enclosing block on the calling thread. Each thread records its spans into
+// its own buffer, allocated the first time it traces: a span is a begin and end tick of armGetSystemTick, taken in
+// traceBegin and traceEnd, and written as one event once it ends. Nesting is per thread and follows the begin and end
+// order, the viewer shows spans contained in another below it. Recording takes no lock and makes no system call,
+// only the owner writes to its buffer: if the background thread hasn't emptied it in time, the span is dropped and
+// counted instead of waiting.
+//
+// Every TRACE_FLUSH_INTERVAL_MS, a low-priority thread formats what the buffers hold as trace-event JSON and writes it
+// to a file, or sends it to the nxlink host: run `nc -l 28773 > trace.json` there before starting the app (sockets must
+// be initialized, and the app started through nxlink).
+//
+// Names aren't copied: they must stay valid until traceExit, string literals or __func__. Call traceExit once the
+// threads being traced are done with it, i.e. on app exit; spans still open then aren't written.
+//
+// Usage:
+//     traceInit("sdmc:/trace.json");
+//     ...
+//     void render(void) {
+//         TRACE_SCOPE("render");
+//         ...
+//     }
+
+#define TRACE_BUFFER_EVENTS 4096      // Per thread, a power of 2
+#define TRACE_MAX_DEPTH 32            // Spans nested deeper are counted but not recorded
+#define TRACE_FLUSH_INTERVAL_MS 100
+#define TRACE_PORT 28773
+
+// Writes to path, or to the nxlink host if it's NULL. Tracing starts enabled.
+bool traceInit(const char* path);
+// Writes what's left, and closes the trace
+void traceExit(void);
+
+// Spans begun while disabled aren't recorded, the cost is then that of reading a flag
+void traceSetEnabled(bool enabled);
+bool traceIsEnabled(void);
+
+// Names the calling thread in the viewer
+void traceSetThreadName(const char* name);
+
+// Spans nest: traceEnd ends the last span begun by the calling thread
+void traceBegin(const char* name);
+void traceEnd(void);
+
+// Spans dropped because a buffer was full or they were nested too deep, since traceInit
+u64 traceGetDropped(void);
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+#ifdef __cplusplus
+}
+
+struct TraceScope
+{
+    TraceScope(const char* name) { traceBegin(name); }
+    ~TraceScope() { traceEnd(); }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(trace_scope_, __LINE__)(name)
+#else
+static inline void traceScopeEnd(int* scope)
+{
+    (void)scope;
+    traceEnd();
+}
+
+// The span ends when the variable goes out of scope, however the block is left
+#define TRACE_SCOPE(name) \
+    __attribute__((cleanup(traceScopeEnd), unused)) int TRACE_CONCAT(trace_scope_, __LINE__) = (traceBegin(name), 0)
+#endif
+
+#define TRACE_FUNCTION() TRACE_SCOPE(__func__)
@@ -0,0 +1,29 @@
+#include <string.h>
+#include <stdlib.h>
+
+#include "arena.h"
+
+Result arenaCreate(Arena* a, size_t size)
+{
+    memset(a, 0, sizeof(*a));
+    a->base = (u8*)aligned_alloc(64, (size + 63) & ~(size_t)63);
+    if (!a->base)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    a->size = size;
+    a->owned = true;
+    return 0;
+}
+
+void arenaInit(Arena* a, void* mem, size_t size)
+{
+    memset(a, 0, sizeof(*a));
+    a->base = (u8*)mem;
+    a->size = size;
+}
+
+void arenaClose(Arena* a)
+{
+    if (a->owned)
+        free(a->base);
+    memset(a, 0, sizeof(*a));
+}
@@ -0,0 +1,277 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "async_log.h"
+
+typedef struct {
+    const char* fmt;
+    u64 tick;
+    u32 num_args;
+    u64 args[ASYNC_LOG_MAX_ARGS];
+} AsyncLogRecord;
+
+typedef struct AsyncLogRing AsyncLogRing;
+struct AsyncLogRing {
+    AsyncLogRing* next;               // Never changes once the ring is in the list
+    u32 head;                         // Written by the owner
+    u32 tail;                         // Written by the log thread
+    u64 dropped;
+    AsyncLogRecord records[ASYNC_LOG_RING_RECORDS];
+};
+
+static AsyncLogRing* s_rings;
+static bool s_running;
+static u32 s_generation;              // Of the current asyncLogInit, the rings of another one are stale
+
+static __thread AsyncLogRing* t_ring;
+static __thread u32 t_generation;
+
+static Thread s_thread;
+static UEvent s_event;
+static bool s_exit;
+static u32 s_sleeping;
+static bool s_updateConsole;
+static u64 s_droppedReported;
+
+// The ring of the calling thread, added to the list the first time
+static AsyncLogRing* asyncLogGetRing(void)
+{
+    if (!__atomic_load_n(&s_running, __ATOMIC_ACQUIRE))
+        return NULL;
+    if (t_ring && t_generation == __atomic_load_n(&s_generation, __ATOMIC_RELAXED))
+        return t_ring;
+
+    AsyncLogRing* ring = (AsyncLogRing*)calloc(1, sizeof(AsyncLogRing));
+    if (!ring)
+        return NULL;
+
+    ring->next = __atomic_load_n(&s_rings, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&s_rings, &ring->next, ring, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    t_ring = ring;
+    t_generation = __atomic_load_n(&s_generation, __ATOMIC_RELAXED);
+    return ring;
+}
+
+void asyncLogWrite(const char* fmt, u32 num_args, const u64* args)
+{
+    AsyncLogRing* ring = asyncLogGetRing();
+    if (!ring)
+        return;
+
+    u32 head = ring->head;
+    if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) >= ASYNC_LOG_RING_RECORDS) {
+        __atomic_add_fetch(&ring->dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    AsyncLogRecord* rec = &ring->records[head % ASYNC_LOG_RING_RECORDS];
+    rec->fmt = fmt;
+    rec->tick = armGetSystemTick();
+    rec->num_args = num_args < ASYNC_LOG_MAX_ARGS ? num_args : ASYNC_LOG_MAX_ARGS;
+    memcpy(rec->args, args, rec->num_args * sizeof(u64));
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+
+    // Pairs with the fence of the log thread: either it sees this record, or this sees it sleeping
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&s_sleeping, __ATOMIC_RELAXED) && __atomic_exchange_n(&s_sleeping, 0, __ATOMIC_ACQ_REL))
+        ueventSignal(&s_event);
+}
+
+u64 asyncLogGetDropped(void)
+{
+    u64 dropped = 0;
+    for (AsyncLogRing* ring = __atomic_load_n(&s_rings, __ATOMIC_ACQUIRE); ring; ring = ring->next)
+        dropped += __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED);
+    return dropped;
+}
+
+// printf of the record, one conversion at a time, each with the type its conversion specifier takes
+static size_t asyncLogFormat(char* out, size_t size, const AsyncLogRecord* rec)
+{
+    const char* fmt = rec->fmt;
+    size_t len = 0;
+    u32 arg = 0;
+
+    while (*fmt && len < size - 1) {
+        if (*fmt != '%') {
+            out[len++] = *fmt++;
+            continue;
+        }
+
+        const char* start = fmt++;
+        if (*fmt == '%') {
+            out[len++] = *fmt++;
+            continue;
+        }
+
+        bool wide = false;
+        fmt += strspn(fmt, "-+ #0");
+        fmt += strspn(fmt, "0123456789");
+        if (*fmt == '.') {
+            fmt++;
+            fmt += strspn(fmt, "0123456789");
+        }
+        for (; *fmt && strchr("hljzt", *fmt); fmt++) {
+            if (*fmt != 'h')
+                wide = true;
+        }
+        if (!*fmt)
+            break;
+
+        char conv = *fmt++;
+        char spec[24];
+        size_t spec_len = fmt - start;
+        if (spec_len >= sizeof(spec))
+            continue;
+        memcpy(spec, start, spec_len);
+        spec[spec_len] = 0;
+
+        u64 value = arg < rec->num_args ? rec->args[arg++] : 0;
+        int n;
+        switch (conv) {
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+                double d;
+                memcpy(&d, &value, sizeof(d));
+                n = snprintf(&out[len], size - len, spec, d);
+                break;
+            }
+            case 's':
+                n = snprintf(&out[len], size - len, spec, value ? (const char*)(uintptr_t)value : "(null)");
+                break;
+            case 'p':
+                n = snprintf(&out[len], size - len, spec, (void*)(uintptr_t)value);
+                break;
+            case 'n':
+                n = 0;
+                break;
+            default:
+                n = wide ? snprintf(&out[len], size - len, spec, (long long)value) : snprintf(&out[len], size - len, spec, (int)value);
+                break;
+        }
+
+        if (n > 0)
+            len += (size_t)n < size - len ? (size_t)n : size - len - 1;
+    }
+
+    out[len] = 0;
+    return len;
+}
+
+// Writes the records of all the rings, oldest first. Returns false if there were none.
+static bool asyncLogDrain(void)
+{
+    char line[512];
+    bool any = false;
+
+    for (;;) {
+        AsyncLogRing* oldest = NULL;
+        u64 oldest_tick = 0;
+        for (AsyncLogRing* ring = __atomic_load_n(&s_rings, __ATOMIC_ACQUIRE); ring; ring = ring->next) {
+            if (ring->tail == __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE))
+                continue;
+            u64 tick = ring->records[ring->tail % ASYNC_LOG_RING_RECORDS].tick;
+            if (!oldest || tick < oldest_tick) {
+                oldest = ring;
+                oldest_tick = tick;
+            }
+        }
+        if (!oldest)
+            break;
+
+        size_t len = asyncLogFormat(line, sizeof(line), &oldest->records[oldest->tail % ASYNC_LOG_RING_RECORDS]);
+        __atomic_store_n(&oldest->tail, oldest->tail + 1, __ATOMIC_RELEASE);
+        fwrite(line, 1, len, stdout);
+        any = true;
+    }
+
+    u64 dropped = asyncLogGetDropped();
+    if (dropped != s_droppedReported) {
+        printf("(%llu log records dropped)\n", (unsigned long long)(dropped - s_droppedReported));
+        s_droppedReported = dropped;
+        any = true;
+    }
+
+    if (any) {
+        fflush(stdout);
+        if (s_updateConsole)
+            consoleUpdate(NULL);
+    }
+    return any;
+}
+
+static bool asyncLogPending(void)
+{
+    for (AsyncLogRing* ring = __atomic_load_n(&s_rings, __ATOMIC_ACQUIRE); ring; ring = ring->next) {
+        if (ring->tail != __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE))
+            return true;
+    }
+    return false;
+}
+
+static void asyncLogThreadFunc(void* arg)
+{
+    for (;;) {
+        if (asyncLogDrain())
+            continue;
+        if (__atomic_load_n(&s_exit, __ATOMIC_ACQUIRE))
+            break;
+
+        // Pairs with the fence of asyncLogWrite
+        __atomic_store_n(&s_sleeping, 1, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (asyncLogPending() || __atomic_load_n(&s_exit, __ATOMIC_ACQUIRE)) {
+            // A writer may have seen the flag already, then the event is signaled for nothing
+            __atomic_store_n(&s_sleeping, 0, __ATOMIC_RELAXED);
+            continue;
+        }
+        waitSingle(waiterForUEvent(&s_event), UINT64_MAX);
+    }
+}
+
+bool asyncLogInit(int prio, bool update_console)
+{
+    if (s_running)
+        return false;
+
+    ueventCreate(&s_event, true);
+    s_exit = false;
+    s_sleeping = 0;
+    s_updateConsole = update_console;
+    s_droppedReported = 0;
+
+    Result rc = threadCreate(&s_thread, asyncLogThreadFunc, NULL, NULL, 0x4000, prio, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&s_thread);
+        if (R_FAILED(rc))
+            threadClose(&s_thread);
+    }
+    if (R_FAILED(rc))
+        return false;
+
+    __atomic_add_fetch(&s_generation, 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&s_running, true, __ATOMIC_RELEASE);
+    return true;
+}
+
+void asyncLogExit(void)
+{
+    if (!s_running)
+        return;
+
+    __atomic_store_n(&s_running, false, __ATOMIC_RELEASE);
+
+    // The thread writes what's left before exiting
+    __atomic_store_n(&s_exit, true, __ATOMIC_RELEASE);
+    ueventSignal(&s_event);
+    threadWaitForExit(&s_thread);
+    threadClose(&s_thread);
+
+    AsyncLogRing* ring = s_rings;
+    s_rings = NULL;
+    while (ring) {
+        AsyncLogRing* next = ring->next;
+        free(ring);
+        ring = next;
+    }
+}
@@ -0,0 +1,259 @@
+#include <string.h>
+
+#include "job_system.h"
+
+typedef struct {
+    JobFunc func;
+    JobRangeFunc range_func;      // Instead of func, for the jobs of jobParallelFor
+    void* arg;
+    u32 begin, end, grain;
+    JobCounter* counter;
+} Job;
+
+// Chase-Lev deque: the owner pushes and pops at bottom, thieves take from top. top and bottom are on their own cache
+// lines, the owner doesn't touch top unless the deque is almost empty.
+typedef struct {
+    s64 top __attribute__((aligned(64)));
+    s64 bottom __attribute__((aligned(64)));
+    Job jobs[JOB_DEQUE_SIZE] __attribute__((aligned(64)));
+} JobDeque;
+
+typedef struct {
+    JobDeque deque;
+    Thread thread;
+    u32 index;
+} JobWorker;
+
+static JobWorker s_workers[JOB_MAX_WORKERS];
+static u32 s_numWorkers;
+static __thread JobWorker* t_worker;
+
+// Idle workers sleep on s_sleepCondVar while s_pending, the number of jobs in the deques, is 0
+static Mutex s_sleepMutex;
+static CondVar s_sleepCondVar;
+static u32 s_sleepers;
+static s32 s_pending;
+static bool s_exit;
+
+static bool jobDequePush(JobDeque* d, const Job* job)
+{
+    s64 b = __atomic_load_n(&d->bottom, __ATOMIC_RELAXED);
+    s64 t = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+    if (b - t >= JOB_DEQUE_SIZE)
+        return false;
+
+    d->jobs[b & (JOB_DEQUE_SIZE - 1)] = *job;
+    __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static bool jobDequePop(JobDeque* d, Job* out)
+{
+    s64 b = __atomic_load_n(&d->bottom, __ATOMIC_RELAXED) - 1;
+    __atomic_store_n(&d->bottom, b, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    s64 t = __atomic_load_n(&d->top, __ATOMIC_RELAXED);
+
+    if (t > b) {
+        // Empty
+        __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    *out = d->jobs[b & (JOB_DEQUE_SIZE - 1)];
+    if (t == b) {
+        // The last job, a thief may be taking it too
+        bool won = __atomic_compare_exchange_n(&d->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+        __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+        return won;
+    }
+    return true;
+}
+
+static bool jobDequeSteal(JobDeque* d, Job* out)
+{
+    s64 t = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    s64 b = __atomic_load_n(&d->bottom, __ATOMIC_ACQUIRE);
+    if (t >= b)
+        return false;
+
+    // The slot can't be reused by the owner before top moves past it, so the copy is only kept if the CAS succeeds
+    *out = d->jobs[t & (JOB_DEQUE_SIZE - 1)];
+    return __atomic_compare_exchange_n(&d->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
+
+static void jobExecute(Job* job);
+
+static void jobPush(const Job* job)
+{
+    JobWorker* w = t_worker;
+    if (w) {
+        // Counted before it can be taken, so that s_pending never goes below 0
+        __atomic_add_fetch(&s_pending, 1, __ATOMIC_SEQ_CST);
+        if (jobDequePush(&w->deque, job)) {
+            if (__atomic_load_n(&s_sleepers, __ATOMIC_SEQ_CST)) {
+                mutexLock(&s_sleepMutex);
+                condvarWakeOne(&s_sleepCondVar);
+                mutexUnlock(&s_sleepMutex);
+            }
+            return;
+        }
+        __atomic_sub_fetch(&s_pending, 1, __ATOMIC_SEQ_CST);
+    }
+
+    Job copy = *job;
+    jobExecute(&copy);
+}
+
+static void jobExecute(Job* job)
+{
+    if (job->range_func) {
+        // Splits off the upper half until what's left is small enough, the halves are stolen by the idle workers
+        while (job->end - job->begin > job->grain) {
+            Job half = *job;
+            half.begin = job->begin + (job->end - job->begin) / 2;
+            job->end = half.begin;
+            __atomic_add_fetch(&job->counter->value, 1, __ATOMIC_RELAXED);
+            jobPush(&half);
+        }
+        job->range_func(job->arg, job->begin, job->end);
+    }
+    else
+        job->func(job->arg);
+
+    if (job->counter)
+        __atomic_sub_fetch(&job->counter->value, 1, __ATOMIC_RELEASE);
+}
+
+static bool jobTryRunOne(JobWorker* w)
+{
+    // Grows while jobSystemInit starts the workers, the deques of the others are empty until then
+    u32 num_workers = __atomic_load_n(&s_numWorkers, __ATOMIC_ACQUIRE);
+    Job job;
+    bool found = jobDequePop(&w->deque, &job);
+    for (u32 i = 1; !found && i < num_workers; i++)
+        found = jobDequeSteal(&s_workers[(w->index + i) % num_workers].deque, &job);
+    if (!found)
+        return false;
+
+    __atomic_sub_fetch(&s_pending, 1, __ATOMIC_SEQ_CST);
+    jobExecute(&job);
+    return true;
+}
+
+static void jobWorkerFunc(void* arg)
+{
+    JobWorker* w = (JobWorker*)arg;
+    t_worker = w;
+
+    while (!__atomic_load_n(&s_exit, __ATOMIC_ACQUIRE)) {
+        // Spins a little before sleeping, jobs often come in bursts
+        bool ran = false;
+        for (u32 i = 0; i < 64 && !ran; i++)
+            ran = jobTryRunOne(w);
+        if (ran)
+            continue;
+
+        // The waker checks s_sleepers after adding to s_pending, and this checks s_pending after adding to s_sleepers
+        mutexLock(&s_sleepMutex);
+        __atomic_add_fetch(&s_sleepers, 1, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&s_pending, __ATOMIC_SEQ_CST) <= 0 && !__atomic_load_n(&s_exit, __ATOMIC_ACQUIRE))
+            condvarWait(&s_sleepCondVar, &s_sleepMutex);
+        __atomic_sub_fetch(&s_sleepers, 1, __ATOMIC_SEQ_CST);
+        mutexUnlock(&s_sleepMutex);
+    }
+}
+
+Result jobSystemInit(void)
+{
+    u64 core_mask = 0;
+    Result rc = svcGetInfo(&core_mask, InfoType_CoreMask, CUR_PROCESS_HANDLE, 0);
+    if (R_FAILED(rc))
+        return rc;
+
+    // The workers are scheduled like the thread which creates the jobs
+    s32 prio = 0x2C;
+    svcGetThreadPriority(&prio, CUR_THREAD_HANDLE);
+    u32 cur_core = svcGetCurrentProcessorNumber();
+
+    memset(s_workers, 0, sizeof(s_workers));
+    mutexInit(&s_sleepMutex);
+    condvarInit(&s_sleepCondVar);
+    s_sleepers = 0;
+    s_pending = 0;
+    s_exit = false;
+
+    s_workers[0].index = 0;
+    s_numWorkers = 1;
+    t_worker = &s_workers[0];
+
+    for (u32 core = 0; core < 64 && s_numWorkers < JOB_MAX_WORKERS; core++) {
+        if (!(core_mask & BIT(core)) || core == cur_core)
+            continue;
+
+        JobWorker* w = &s_workers[s_numWorkers];
+        w->index = s_numWorkers;
+        rc = threadCreate(&w->thread, jobWorkerFunc, w, NULL, 0x10000, prio, core);
+        if (R_SUCCEEDED(rc)) {
+            rc = threadStart(&w->thread);
+            if (R_FAILED(rc))
+                threadClose(&w->thread);
+        }
+        if (R_FAILED(rc)) {
+            jobSystemExit();
+            return rc;
+        }
+        __atomic_store_n(&s_numWorkers, s_numWorkers + 1, __ATOMIC_RELEASE);
+    }
+    return 0;
+}
+
+void jobSystemExit(void)
+{
+    mutexLock(&s_sleepMutex);
+    __atomic_store_n(&s_exit, true, __ATOMIC_RELEASE);
+    condvarWakeAll(&s_sleepCondVar);
+    mutexUnlock(&s_sleepMutex);
+
+    for (u32 i = 1; i < s_numWorkers; i++) {
+        threadWaitForExit(&s_workers[i].thread);
+        threadClose(&s_workers[i].thread);
+    }
+    s_numWorkers = 0;
+    t_worker = NULL;
+}
+
+u32 jobSystemGetNumWorkers(void)
+{
+    return s_numWorkers;
+}
+
+void jobRun(JobFunc func, void* arg, JobCounter* counter)
+{
+    Job job = { .func = func, .arg = arg, .counter = counter };
+    if (counter)
+        __atomic_add_fetch(&counter->value, 1, __ATOMIC_RELAXED);
+    jobPush(&job);
+}
+
+void jobWait(JobCounter* counter)
+{
+    JobWorker* w = t_worker;
+    while (__atomic_load_n(&counter->value, __ATOMIC_ACQUIRE) != 0) {
+        // The jobs left are being run by other workers
+        if (!w || !jobTryRunOne(w))
+            svcSleepThread(0);
+    }
+}
+
+void jobParallelFor(u32 count, u32 grain, JobRangeFunc func, void* arg)
+{
+    if (count == 0)
+        return;
+
+    JobCounter counter = { 1 };
+    Job job = { .range_func = func, .arg = arg, .begin = 0, .end = count, .grain = grain ? grain : 1, .counter = &counter };
+    jobExecute(&job);
+    jobWait(&counter);
+}
@@ -0,0 +1,38 @@
+#include <stdlib.h>
+
+#include "jpeg_thumb.h"
+
+bool jpegDecodeThumbnail(tjhandle tj, const void* jpeg, u32 jpeg_size, u32* out, u32 size)
+{
+    const u8* src = (const u8*)jpeg;
+    int width, height, subsamp, colorspace;
+    if (tjDecompressHeader3(tj, src, jpeg_size, &width, &height, &subsamp, &colorspace) != 0)
+        return false;
+
+    // The smallest scaling which still gives at least the thumbnail size
+    int num_factors;
+    tjscalingfactor* factors = tjGetScalingFactors(&num_factors);
+    int scaled_w = width, scaled_h = height;
+    for (int i = 0; i < num_factors; i++) {
+        int w = TJSCALED(width, factors[i]), h = TJSCALED(height, factors[i]);
+        if (w >= (int)size && h >= (int)size && w * h < scaled_w * scaled_h) {
+            scaled_w = w;
+            scaled_h = h;
+        }
+    }
+
+    if (scaled_w == (int)size && scaled_h == (int)size)
+        return tjDecompress2(tj, src, jpeg_size, (u8*)out, scaled_w, size * 4, scaled_h, TJPF_RGBA, TJFLAG_FASTDCT) == 0;
+
+    // Images of other sizes: decoded as small as possible, then point sampled
+    u32* tmp = (u32*)malloc((size_t)scaled_w * scaled_h * 4);
+    bool ok = tmp && tjDecompress2(tj, src, jpeg_size, (u8*)tmp, scaled_w, scaled_w * 4, scaled_h, TJPF_RGBA,
+        TJFLAG_FASTDCT) == 0;
+    for (u32 y = 0; ok && y < size; y++) {
+        const u32* row = tmp + (size_t)(y * scaled_h / size) * scaled_w;
+        for (u32 x = 0; x < size; x++)
+            out[y * size + x] = row[x * scaled_w / size];
+    }
+    free(tmp);
+    return ok;
+}
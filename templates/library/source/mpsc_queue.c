@@ -0,0 +1,92 @@
+#include <string.h>
+#include <stdlib.h>
+
+#include "mpsc_queue.h"
+
+Result mpscQueueCreate(MpscQueue* q, u32 capacity, u32 elem_size)
+{
+    memset(q, 0, sizeof(*q));
+    if (capacity < 2 || (capacity & (capacity - 1)) || elem_size == 0)
+        return MAKERESULT(Module_Libnx, LibnxError_BadInput);
+
+    q->seqs = (u32*)malloc(capacity * sizeof(u32));
+    q->data = (u8*)malloc((size_t)capacity * elem_size);
+    if (!q->seqs || !q->data) {
+        mpscQueueClose(q);
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    }
+
+    for (u32 i = 0; i < capacity; i++)
+        q->seqs[i] = i;
+    q->capacity = capacity;
+    q->elem_size = elem_size;
+    // Cleared when the consumer's wait returns
+    ueventCreate(&q->event, true);
+    return 0;
+}
+
+void mpscQueueClose(MpscQueue* q)
+{
+    free(q->seqs);
+    free(q->data);
+    q->seqs = NULL;
+    q->data = NULL;
+}
+
+bool mpscQueuePush(MpscQueue* q, const void* elem)
+{
+    u32 pos = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+    for (;;) {
+        u32 seq = __atomic_load_n(&q->seqs[pos & (q->capacity - 1)], __ATOMIC_ACQUIRE);
+        s32 diff = (s32)(seq - pos);
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&q->tail, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                break;
+        }
+        else if (diff < 0)
+            return false; // The slot wasn't popped since the last lap: full
+        else
+            pos = __atomic_load_n(&q->tail, __ATOMIC_RELAXED); // Claimed by another producer meanwhile
+    }
+
+    memcpy(q->data + (size_t)(pos & (q->capacity - 1)) * q->elem_size, elem, q->elem_size);
+    __atomic_store_n(&q->seqs[pos & (q->capacity - 1)], pos + 1, __ATOMIC_RELEASE);
+
+    // Pairs with the fence of mpscQueuePrepareWait: either the consumer sees this element, or this sees it sleeping
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&q->sleeping, __ATOMIC_RELAXED) && __atomic_exchange_n(&q->sleeping, 0, __ATOMIC_ACQ_REL)) {
+        __atomic_add_fetch(&q->signals, 1, __ATOMIC_RELAXED);
+        ueventSignal(&q->event);
+    }
+    return true;
+}
+
+u32 mpscQueuePop(MpscQueue* q, void* out, u32 max)
+{
+    u8* dst = (u8*)out;
+    u32 count = 0;
+    for (; count < max; count++) {
+        u32 slot = q->head & (q->capacity - 1);
+        // Slots are published in any order, this stops at the first one which isn't
+        if (__atomic_load_n(&q->seqs[slot], __ATOMIC_ACQUIRE) != q->head + 1)
+            break;
+
+        memcpy(dst, q->data + (size_t)slot * q->elem_size, q->elem_size);
+        dst += q->elem_size;
+        __atomic_store_n(&q->seqs[slot], q->head + q->capacity, __ATOMIC_RELEASE);
+        q->head++;
+    }
+    return count;
+}
+
+bool mpscQueuePrepareWait(MpscQueue* q)
+{
+    __atomic_store_n(&q->sleeping, 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&q->seqs[q->head & (q->capacity - 1)], __ATOMIC_ACQUIRE) != q->head + 1)
+        return true;
+
+    // The producer of that element may have seen the flag already, then the event is signaled for nothing
+    __atomic_store_n(&q->sleeping, 0, __ATOMIC_RELAXED);
+    return false;
+}
@@ -0,0 +1,222 @@
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <sys/iosupport.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+
+#include "nxlink_log.h"
+
+#define NXLINK_LOG_SLOT_DATA (NXLINK_LOG_SLOT_SIZE - 8)
+
+// seq is the position the slot is free for, position + 1 once written, and position + NXLINK_LOG_SLOTS once sent
+typedef struct {
+    u32 seq;
+    u32 size;
+    char data[NXLINK_LOG_SLOT_DATA];
+} NxlinkLogSlot;
+
+static NxlinkLogSlot s_slots[NXLINK_LOG_SLOTS];
+static u32 s_writePos;                // Next position to claim, shared by the writers
+static u32 s_readPos;                 // Only used by the thread
+static u64 s_dropped, s_droppedBytes;
+
+static int s_sock = -1;
+static bool s_sendFailed;
+static Thread s_thread;
+static bool s_exit;
+static char s_sendBuf[4096];
+
+static const devoptab_t* s_prevStdout;
+static const devoptab_t* s_prevStderr;
+
+void nxlinkLogWrite(const char* data, size_t size)
+{
+    if (!size)
+        return;
+
+    u32 count = (size + NXLINK_LOG_SLOT_DATA - 1) / NXLINK_LOG_SLOT_DATA;
+    if (count > NXLINK_LOG_SLOTS) {
+        __atomic_add_fetch(&s_dropped, 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&s_droppedBytes, size, __ATOMIC_RELAXED);
+        return;
+    }
+
+    // Claim count consecutive slots. The thread frees them in order, so they're all free if the last one is.
+    u32 pos = __atomic_load_n(&s_writePos, __ATOMIC_RELAXED);
+    for (;;) {
+        u32 last = pos + count - 1;
+        u32 seq = __atomic_load_n(&s_slots[last % NXLINK_LOG_SLOTS].seq, __ATOMIC_ACQUIRE);
+        if (seq == last) {
+            if (__atomic_compare_exchange_n(&s_writePos, &pos, pos + count, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+                break;
+        }
+        else if ((s32)(seq - last) < 0) {
+            // Not sent yet: the ring is full
+            __atomic_add_fetch(&s_dropped, 1, __ATOMIC_RELAXED);
+            __atomic_add_fetch(&s_droppedBytes, size, __ATOMIC_RELAXED);
+            return;
+        }
+        else
+            pos = __atomic_load_n(&s_writePos, __ATOMIC_RELAXED); // Claimed by another writer meanwhile
+    }
+
+    for (u32 i = 0; i < count; i++) {
+        NxlinkLogSlot* slot = &s_slots[(pos + i) % NXLINK_LOG_SLOTS];
+        size_t n = size < NXLINK_LOG_SLOT_DATA ? size : NXLINK_LOG_SLOT_DATA;
+        memcpy(slot->data, data, n);
+        slot->size = n;
+        data += n;
+        size -= n;
+        __atomic_store_n(&slot->seq, pos + i + 1, __ATOMIC_RELEASE);
+    }
+}
+
+void nxlinkLogPrintf(const char* fmt, ...)
+{
+    char buf[256];
+    va_list va;
+    va_start(va, fmt);
+    int len = vsnprintf(buf, sizeof(buf), fmt, va);
+    va_end(va);
+
+    if (len > 0)
+        nxlinkLogWrite(buf, (size_t)len < sizeof(buf) ? (size_t)len : sizeof(buf) - 1);
+}
+
+u64 nxlinkLogGetDropped(u64* bytes)
+{
+    if (bytes)
+        *bytes = __atomic_load_n(&s_droppedBytes, __ATOMIC_RELAXED);
+    return __atomic_load_n(&s_dropped, __ATOMIC_RELAXED);
+}
+
+static ssize_t nxlinkLogDevWrite(struct _reent* r, void* fd, const char* ptr, size_t len)
+{
+    nxlinkLogWrite(ptr, len);
+    return len;
+}
+
+static const devoptab_t s_devoptab = {
+    .name = "nxlink",
+    .write_r = nxlinkLogDevWrite,
+};
+
+// Takes the written slots, in order, up to the size of the send buffer
+static size_t nxlinkLogGather(void)
+{
+    size_t fill = 0;
+    for (;;) {
+        NxlinkLogSlot* slot = &s_slots[s_readPos % NXLINK_LOG_SLOTS];
+        if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != s_readPos + 1)
+            break;
+        if (fill + slot->size > sizeof(s_sendBuf))
+            break;
+
+        memcpy(&s_sendBuf[fill], slot->data, slot->size);
+        fill += slot->size;
+        __atomic_store_n(&slot->seq, s_readPos + NXLINK_LOG_SLOTS, __ATOMIC_RELEASE);
+        s_readPos++;
+    }
+    return fill;
+}
+
+static void nxlinkLogThreadFunc(void* arg)
+{
+    for (;;) {
+        size_t size = nxlinkLogGather();
+        if (!size) {
+            if (__atomic_load_n(&s_exit, __ATOMIC_ACQUIRE))
+                break;
+            svcSleepThread(NXLINK_LOG_FLUSH_INTERVAL_MS * 1000000ULL);
+            continue;
+        }
+
+        // Once the host is gone, the slots are still freed so that writers don't see a full ring forever
+        for (size_t off = 0; off < size && !s_sendFailed;) {
+            ssize_t ret = send(s_sock, &s_sendBuf[off], size - off, 0);
+            if (ret <= 0)
+                s_sendFailed = true;
+            else
+                off += ret;
+        }
+    }
+}
+
+bool nxlinkLogInit(void)
+{
+    // Only set when started through nxlink
+    if (__nxlink_host.s_addr == 0)
+        return false;
+
+    if (R_FAILED(socketInitializeDefault()))
+        return false;
+
+    s_sock = socket(AF_INET, SOCK_STREAM, 0);
+    if (s_sock >= 0) {
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(NXLINK_CLIENT_PORT);
+        addr.sin_addr = __nxlink_host;
+        if (connect(s_sock, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+            close(s_sock);
+            s_sock = -1;
+        }
+    }
+    if (s_sock < 0) {
+        socketExit();
+        return false;
+    }
+
+    for (u32 i = 0; i < NXLINK_LOG_SLOTS; i++)
+        s_slots[i].seq = i;
+    s_writePos = s_readPos = 0;
+    s_dropped = s_droppedBytes = 0;
+    s_sendFailed = false;
+    s_exit = false;
+
+    // Below everything else, it only has to keep up on average
+    Result rc = threadCreate(&s_thread, nxlinkLogThreadFunc, NULL, NULL, 0x4000, 0x3B, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&s_thread);
+        if (R_FAILED(rc))
+            threadClose(&s_thread);
+    }
+    if (R_FAILED(rc)) {
+        close(s_sock);
+        s_sock = -1;
+        socketExit();
+        return false;
+    }
+
+    fflush(stdout);
+    fflush(stderr);
+    s_prevStdout = devoptab_list[STD_OUT];
+    s_prevStderr = devoptab_list[STD_ERR];
+    devoptab_list[STD_OUT] = &s_devoptab;
+    devoptab_list[STD_ERR] = &s_devoptab;
+    setvbuf(stdout, NULL, _IOLBF, 256);
+    return true;
+}
+
+void nxlinkLogExit(void)
+{
+    if (s_sock < 0)
+        return;
+
+    fflush(stdout);
+    fflush(stderr);
+    devoptab_list[STD_OUT] = s_prevStdout;
+    devoptab_list[STD_ERR] = s_prevStderr;
+
+    // The thread sends what's left before exiting
+    __atomic_store_n(&s_exit, true, __ATOMIC_RELEASE);
+    threadWaitForExit(&s_thread);
+    threadClose(&s_thread);
+
+    close(s_sock);
+    s_sock = -1;
+    socketExit();
+}
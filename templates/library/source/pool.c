@@ -0,0 +1,32 @@
+#include <string.h>
+#include <stdlib.h>
+
+#include "pool.h"
+
+Result poolCreate(Pool* p, u32 elem_size, u32 capacity)
+{
+    memset(p, 0, sizeof(*p));
+    if (!elem_size || !capacity)
+        return MAKERESULT(Module_Libnx, LibnxError_BadInput);
+
+    elem_size = (elem_size + sizeof(void*) - 1) & ~(u32)(sizeof(void*) - 1);
+    p->mem = (u8*)aligned_alloc(64, ((size_t)elem_size * capacity + 63) & ~(size_t)63);
+    if (!p->mem)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    p->elem_size = elem_size;
+    p->capacity = capacity;
+
+    // Linked in address order, so that the first objects allocated are next to each other
+    for (u32 i = capacity; i-- > 0;) {
+        void* obj = p->mem + (size_t)i * elem_size;
+        *(void**)obj = p->free_list;
+        p->free_list = obj;
+    }
+    return 0;
+}
+
+void poolClose(Pool* p)
+{
+    free(p->mem);
+    memset(p, 0, sizeof(*p));
+}
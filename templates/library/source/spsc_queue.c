@@ -0,0 +1,59 @@
+#include <string.h>
+#include <stdlib.h>
+
+#include "spsc_queue.h"
+
+Result spscQueueCreate(SpscQueue* q, u32 capacity, u32 elem_size)
+{
+    memset(q, 0, sizeof(*q));
+    if (capacity < 2 || (capacity & (capacity - 1)) || elem_size == 0)
+        return MAKERESULT(Module_Libnx, LibnxError_BadInput);
+
+    q->data = (u8*)malloc((size_t)capacity * elem_size);
+    if (!q->data)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+
+    q->capacity = capacity;
+    q->elem_size = elem_size;
+    return 0;
+}
+
+void spscQueueClose(SpscQueue* q)
+{
+    free(q->data);
+    q->data = NULL;
+}
+
+bool spscQueuePush(SpscQueue* q, const void* elem)
+{
+    u32 tail = q->tail;
+    if (tail - q->cached_head == q->capacity) {
+        q->cached_head = __atomic_load_n(&q->head, __ATOMIC_ACQUIRE);
+        if (tail - q->cached_head == q->capacity)
+            return false;
+    }
+
+    memcpy(q->data + (size_t)(tail & (q->capacity - 1)) * q->elem_size, elem, q->elem_size);
+    __atomic_store_n(&q->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+u32 spscQueuePop(SpscQueue* q, void* out, u32 max)
+{
+    u32 head = q->head;
+    if (q->cached_tail - head < max)
+        q->cached_tail = __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE);
+
+    u32 count = q->cached_tail - head;
+    if (count > max)
+        count = max;
+
+    // At most two copies: up to the end of the buffer, and from its start
+    u32 slot = head & (q->capacity - 1);
+    u32 first = count < q->capacity - slot ? count : q->capacity - slot;
+    memcpy(out, q->data + (size_t)slot * q->elem_size, (size_t)first * q->elem_size);
+    memcpy((u8*)out + (size_t)first * q->elem_size, q->data, (size_t)(count - first) * q->elem_size);
+
+    __atomic_store_n(&q->head, head + count, __ATOMIC_RELEASE);
+    return count;
+}
@@ -0,0 +1,225 @@
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#include "telemetry.h"
+
+#define TELEMETRY_SPAN_DEPTH 16
+
+static u8 s_ring[TELEMETRY_RING_SIZE] __attribute__((aligned(8)));
+static u32 s_head, s_tail;            // Positions written and sent
+static int s_sock = -1;
+static u16 s_nextId;
+static u64 s_spanStarts[TELEMETRY_SPAN_DEPTH];
+static u32 s_spanDepth;
+static TelemetryStats s_stats;
+
+// Returns the space for a record of this size (rounded up to 8 bytes) in the ring, with its header filled, or NULL if
+// the ring is full. Records never wrap: the end of the ring is skipped with a pad record when needed.
+static void* telemetryReserve(TelemetryType type, size_t size)
+{
+    if (s_sock < 0)
+        return NULL;
+
+    size = (size + 7) & ~7;
+    u32 pos = s_head % TELEMETRY_RING_SIZE;
+    u32 contig = TELEMETRY_RING_SIZE - pos;
+    u32 pad = size > contig ? contig : 0;
+
+    if ((s_head - s_tail) + pad + size > TELEMETRY_RING_SIZE) {
+        s_stats.dropped++;
+        return NULL;
+    }
+
+    if (pad) {
+        TelemetryHeader* hdr = (TelemetryHeader*)&s_ring[pos];
+        *hdr = (TelemetryHeader){ .size = pad, .type = TelemetryType_Pad };
+        s_head += pad;
+        pos = 0;
+    }
+
+    TelemetryHeader* hdr = (TelemetryHeader*)&s_ring[pos];
+    *hdr = (TelemetryHeader){ .size = size, .type = type };
+    s_head += size;
+    s_stats.records++;
+    return hdr;
+}
+
+static void telemetryClose(void)
+{
+    if (s_sock >= 0) {
+        close(s_sock);
+        s_sock = -1;
+    }
+}
+
+void telemetryFlush(void)
+{
+    u32 pending = s_head - s_tail;
+    if (s_sock < 0 || !pending)
+        return;
+
+    // The pending data is in at most two pieces, the end and the start of the ring
+    struct iovec iov[2];
+    int iovcnt = 1;
+    u32 pos = s_tail % TELEMETRY_RING_SIZE;
+    u32 first = TELEMETRY_RING_SIZE - pos;
+    if (first > pending)
+        first = pending;
+    iov[0].iov_base = &s_ring[pos];
+    iov[0].iov_len = first;
+    if (pending > first) {
+        iov[1].iov_base = s_ring;
+        iov[1].iov_len = pending - first;
+        iovcnt = 2;
+    }
+
+    ssize_t ret = writev(s_sock, iov, iovcnt);
+    if (ret < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+            s_stats.flushes_blocked++;
+        else
+            telemetryClose(); // The decoder went away
+        return;
+    }
+
+    s_tail += ret;
+    s_stats.bytes_sent += ret;
+    if ((u32)ret < pending)
+        s_stats.flushes_blocked++;
+}
+
+bool telemetryInit(void)
+{
+    // Only set when started through nxlink
+    if (__nxlink_host.s_addr == 0)
+        return false;
+
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0)
+        return false;
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(TELEMETRY_PORT);
+    addr.sin_addr = __nxlink_host;
+    if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        return false;
+    }
+
+    // Records are already batched per flush, don't let Nagle delay them further
+    int optval = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &optval, sizeof(optval));
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags == -1 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) == -1) {
+        close(fd);
+        return false;
+    }
+
+    s_sock = fd;
+    s_head = s_tail = 0;
+    s_nextId = 0;
+    s_spanDepth = 0;
+    memset(&s_stats, 0, sizeof(s_stats));
+
+    TelemetryHello* hello = (TelemetryHello*)telemetryReserve(TelemetryType_Hello, sizeof(TelemetryHello));
+    hello->magic = TELEMETRY_MAGIC;
+    hello->tick_freq = armGetSystemTickFreq();
+    hello->version = TELEMETRY_VERSION;
+    hello->reserved = 0;
+    telemetryFlush();
+    return true;
+}
+
+void telemetryExit(void)
+{
+    u64 start = armGetSystemTick();
+    while (s_sock >= 0 && s_head != s_tail && armTicksToNs(armGetSystemTick() - start) < 1000000000ULL) {
+        telemetryFlush();
+        svcSleepThread(1000000ULL);
+    }
+    telemetryClose();
+}
+
+bool telemetryIsConnected(void)
+{
+    return s_sock >= 0;
+}
+
+u16 telemetryRegister(TelemetryKind kind, const char* name)
+{
+    u16 id = s_nextId++;
+    size_t len = strnlen(name, TELEMETRY_NAME_MAX);
+
+    TelemetryName* rec = (TelemetryName*)telemetryReserve(TelemetryType_Name, sizeof(TelemetryName) + len);
+    if (rec) {
+        rec->id = id;
+        rec->kind = kind;
+        rec->len = len;
+        memcpy(rec->name, name, len);
+        memset(rec->name + len, 0, rec->hdr.size - sizeof(TelemetryName) - len);
+    }
+    return id;
+}
+
+void telemetryFrame(u32 frame, u32 cpu_us, u32 gpu_us, u32 interval_us)
+{
+    TelemetryFrame* rec = (TelemetryFrame*)telemetryReserve(TelemetryType_Frame, sizeof(TelemetryFrame));
+    if (!rec)
+        return;
+    rec->frame = frame;
+    rec->tick = armGetSystemTick();
+    rec->cpu_us = cpu_us;
+    rec->gpu_us = gpu_us;
+    rec->interval_us = interval_us;
+    rec->reserved = 0;
+}
+
+void telemetryCounter(u16 id, s64 value)
+{
+    TelemetryCounter* rec = (TelemetryCounter*)telemetryReserve(TelemetryType_Counter, sizeof(TelemetryCounter));
+    if (!rec)
+        return;
+    rec->id = id;
+    rec->reserved = 0;
+    rec->tick = armGetSystemTick();
+    rec->value = value;
+}
+
+void telemetrySpanBegin(void)
+{
+    // Deeper spans are still balanced, only their start time is lost
+    if (s_spanDepth < TELEMETRY_SPAN_DEPTH)
+        s_spanStarts[s_spanDepth] = armGetSystemTick();
+    s_spanDepth++;
+}
+
+void telemetrySpanEnd(u16 id)
+{
+    if (!s_spanDepth)
+        return;
+    u32 depth = --s_spanDepth;
+    if (depth >= TELEMETRY_SPAN_DEPTH)
+        return;
+
+    TelemetrySpan* rec = (TelemetrySpan*)telemetryReserve(TelemetryType_Span, sizeof(TelemetrySpan));
+    if (!rec)
+        return;
+    rec->id = id;
+    rec->depth = depth;
+    rec->start_tick = s_spanStarts[depth];
+    rec->end_tick = armGetSystemTick();
+}
+
+void telemetryGetStats(TelemetryStats* out)
+{
+    *out = s_stats;
+}
@@ -1,6 +0,0 @@
-int myLibFunction() {
-
-    
-    return 42;
-
-}
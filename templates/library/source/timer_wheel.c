@@ -0,0 +1,245 @@
+#include <string.h>
+
+#include "timer_wheel.h"
+
+#define L0_SIZE (1U << TIMER_WHEEL_L0_BITS)
+#define LN_SIZE (1U << TIMER_WHEEL_LN_BITS)
+
+// Bit position of the slot index of a level in the expiry tick
+static inline u32 timerWheelShift(u32 level)
+{
+    return level ? TIMER_WHEEL_L0_BITS + (level - 1) * TIMER_WHEEL_LN_BITS : 0;
+}
+
+static inline u32 timerWheelSlotMask(u32 level)
+{
+    return level ? LN_SIZE - 1 : L0_SIZE - 1;
+}
+
+static u64 timerWheelCurrentTick(TimerWheel* w)
+{
+    return (armGetSystemTick() - w->base_tick) / w->tick_length;
+}
+
+static void timerWheelLink(TimerWheelTimer** head, TimerWheelTimer* t)
+{
+    t->next = *head;
+    if (t->next)
+        t->next->pprev = &t->next;
+    t->pprev = head;
+    *head = t;
+}
+
+static void timerWheelUnlink(TimerWheel* w, TimerWheelTimer* t)
+{
+    *t->pprev = t->next;
+    if (t->next)
+        t->next->pprev = t->pprev;
+
+    // Keeps the occupied bits right when that was the last timer of its slot
+    for (u32 level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+        TimerWheelTimer** slots = w->slots[level];
+        if (t->pprev >= slots && t->pprev < slots + L0_SIZE) {
+            u32 slot = t->pprev - slots;
+            if (!*t->pprev)
+                w->occupied[level][slot / 64] &= ~(1ULL << (slot % 64));
+            break;
+        }
+    }
+    t->next = NULL;
+    t->pprev = NULL;
+}
+
+static void timerWheelInsert(TimerWheel* w, TimerWheelTimer* t)
+{
+    u64 expires = t->expires < w->now ? w->now : t->expires;
+    u64 delta = expires - w->now;
+
+    // Level n holds the timers less than 2^shift(n + 1) ticks away
+    u32 level = 0;
+    while (level < TIMER_WHEEL_LEVELS - 1 && delta >= (u64)1 << timerWheelShift(level + 1))
+        level++;
+
+    // Too far ahead for the last level: placed at its end, and inserted again when that slot comes down
+    u64 max_delta = ((u64)1 << (timerWheelShift(TIMER_WHEEL_LEVELS - 1) + TIMER_WHEEL_LN_BITS)) - 1;
+    if (delta > max_delta)
+        expires = w->now + max_delta;
+
+    u32 slot = (expires >> timerWheelShift(level)) & timerWheelSlotMask(level);
+    timerWheelLink(&w->slots[level][slot], t);
+    w->occupied[level][slot / 64] |= 1ULL << (slot % 64);
+}
+
+// Moves the timers of a slot of a higher level down, now that they're less than a slot of that level away
+static void timerWheelCascade(TimerWheel* w, u32 level, u32 slot)
+{
+    TimerWheelTimer* t = w->slots[level][slot];
+    w->slots[level][slot] = NULL;
+    w->occupied[level][slot / 64] &= ~(1ULL << (slot % 64));
+
+    while (t) {
+        TimerWheelTimer* next = t->next;
+        timerWheelInsert(w, t);
+        t = next;
+    }
+}
+
+// Processes the ticks up to target, calling the callbacks of the expired timers. Called with the mutex locked.
+static void timerWheelAdvance(TimerWheel* w, u64 target)
+{
+    if (!w->count) {
+        w->now = target + 1;
+        return;
+    }
+
+    while (w->now <= target) {
+        u32 slot = w->now & (L0_SIZE - 1);
+        if (slot == 0) {
+            for (u32 level = 1; level < TIMER_WHEEL_LEVELS; level++) {
+                u32 s = (w->now >> timerWheelShift(level)) & (LN_SIZE - 1);
+                timerWheelCascade(w, level, s);
+                if (s != 0)
+                    break;
+            }
+        }
+
+        // Taken out of the slot first, the callbacks can change any list
+        if (w->slots[0][slot]) {
+            w->expired = w->slots[0][slot];
+            w->expired->pprev = &w->expired;
+            w->slots[0][slot] = NULL;
+            w->occupied[0][slot / 64] &= ~(1ULL << (slot % 64));
+        }
+        w->now++;
+
+        while (w->expired) {
+            TimerWheelTimer* t = w->expired;
+            timerWheelUnlink(w, t);
+            w->count--;
+
+            mutexUnlock(&w->mutex);
+            t->callback(t, t->arg);
+            mutexLock(&w->mutex);
+        }
+    }
+}
+
+// The next tick which has timers in level 0, or the next time level 0 goes round if only higher levels have some
+static u64 timerWheelNextTick(TimerWheel* w)
+{
+    if (!w->count)
+        return UINT64_MAX;
+
+    // The slots are searched a word of the bitmap at a time, from the current one and round
+    u32 start = w->now & (L0_SIZE - 1);
+    for (u32 n = 0; n < L0_SIZE;) {
+        u32 slot = (start + n) & (L0_SIZE - 1);
+        u64 bits = w->occupied[0][slot / 64] >> (slot % 64);
+        if (bits)
+            return w->now + n + __builtin_ctzll(bits);
+        n += 64 - slot % 64;
+    }
+    return (w->now + L0_SIZE - 1) & ~(u64)(L0_SIZE - 1);
+}
+
+static void timerWheelThreadFunc(void* arg)
+{
+    TimerWheel* w = (TimerWheel*)arg;
+
+    mutexLock(&w->mutex);
+    while (!w->exit) {
+        timerWheelAdvance(w, timerWheelCurrentTick(w));
+        u64 next = timerWheelNextTick(w);
+        w->armed = next;
+        mutexUnlock(&w->mutex);
+
+        if (next == UINT64_MAX)
+            waitSingle(waiterForUEvent(&w->wake_event), UINT64_MAX);
+        else {
+            u64 deadline = w->base_tick + next * w->tick_length;
+            u64 tick = armGetSystemTick();
+            if (deadline > tick) {
+                // This thread is the only one waiting on the timer, so it can be set up again for another delay
+                utimerStop(&w->timer);
+                utimerCreate(&w->timer, armTicksToNs(deadline - tick), TimerType_OneShot);
+                utimerStart(&w->timer);
+                int idx;
+                waitMulti(&idx, UINT64_MAX, waiterForUTimer(&w->timer), waiterForUEvent(&w->wake_event));
+            }
+        }
+
+        mutexLock(&w->mutex);
+    }
+    mutexUnlock(&w->mutex);
+}
+
+Result timerWheelStart(TimerWheel* w, u64 resolution_ns, int prio)
+{
+    memset(w, 0, sizeof(*w));
+    w->tick_length = armNsToTicks(resolution_ns);
+    if (!w->tick_length)
+        return MAKERESULT(Module_Libnx, LibnxError_BadInput);
+
+    mutexInit(&w->mutex);
+    ueventCreate(&w->wake_event, true);
+    utimerCreate(&w->timer, resolution_ns, TimerType_OneShot);
+    w->base_tick = armGetSystemTick();
+    w->armed = UINT64_MAX;
+
+    Result rc = threadCreate(&w->thread, timerWheelThreadFunc, w, NULL, 0x4000, prio, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&w->thread);
+        if (R_FAILED(rc))
+            threadClose(&w->thread);
+    }
+    return rc;
+}
+
+void timerWheelStop(TimerWheel* w)
+{
+    mutexLock(&w->mutex);
+    w->exit = true;
+    mutexUnlock(&w->mutex);
+    ueventSignal(&w->wake_event);
+
+    threadWaitForExit(&w->thread);
+    threadClose(&w->thread);
+}
+
+void timerWheelAdd(TimerWheel* w, TimerWheelTimer* t, u64 delay_ns, TimerWheelCallback callback, void* arg)
+{
+    mutexLock(&w->mutex);
+    if (t->pprev) {
+        timerWheelUnlink(w, t);
+        w->count--;
+    }
+
+    t->callback = callback;
+    t->arg = arg;
+    // Rounded up to the next tick, a timer never expires early
+    u64 deadline = armGetSystemTick() - w->base_tick + armNsToTicks(delay_ns);
+    t->expires = (deadline + w->tick_length - 1) / w->tick_length;
+    timerWheelInsert(w, t);
+    w->count++;
+
+    // The thread only needs waking if it sleeps past this timer
+    bool wake = t->expires < w->armed;
+    if (wake)
+        w->armed = t->expires;
+    mutexUnlock(&w->mutex);
+
+    if (wake)
+        ueventSignal(&w->wake_event);
+}
+
+bool timerWheelCancel(TimerWheel* w, TimerWheelTimer* t)
+{
+    mutexLock(&w->mutex);
+    bool scheduled = t->pprev != NULL;
+    if (scheduled) {
+        timerWheelUnlink(w, t);
+        w->count--;
+    }
+    mutexUnlock(&w->mutex);
+    return scheduled;
+}
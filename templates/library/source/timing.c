@@ -0,0 +1,62 @@
+#include "timing.h"
+
+#define TIMING_DEFAULT_FREQ 19200000ULL
+
+// Integer part, and fraction rounded up, of num / den: the conversions truncate, and round up the fraction, so that exact
+// results (e.g. 12 ticks at 19.2 MHz, 625 ns) aren't one below
+#define TIMING_INT(num, den) ((num) / (den))
+#define TIMING_FRAC(num, den) \
+    ((u64)(((((unsigned __int128)((num) % (den))) << 64) + (den) - 1) / (den)))
+
+TimingClock g_timingClock = {
+    .freq = TIMING_DEFAULT_FREQ,
+    .ns_int = TIMING_INT(1000000000ULL, TIMING_DEFAULT_FREQ),
+    .ns_frac = TIMING_FRAC(1000000000ULL, TIMING_DEFAULT_FREQ),
+    .ticks_int = TIMING_INT(TIMING_DEFAULT_FREQ, 1000000000ULL),
+    .ticks_frac = TIMING_FRAC(TIMING_DEFAULT_FREQ, 1000000000ULL),
+};
+
+static bool timingSampleWallClock(u64* seconds)
+{
+    return R_SUCCEEDED(timeGetCurrentTime(TimeType_Default, seconds));
+}
+
+void timingInit(void)
+{
+    u64 freq = armGetSystemTickFreq();
+    if (freq) {
+        g_timingClock.freq = freq;
+        g_timingClock.ns_int = TIMING_INT(1000000000ULL, freq);
+        g_timingClock.ns_frac = TIMING_FRAC(1000000000ULL, freq);
+        g_timingClock.ticks_int = TIMING_INT(freq, 1000000000ULL);
+        g_timingClock.ticks_frac = TIMING_FRAC(freq, 1000000000ULL);
+    }
+
+    // The tick is read after the call: the time it took is what the sample can be late by, at most
+    u64 seconds;
+    if (timingSampleWallClock(&seconds)) {
+        g_timingClock.unix_tick = armGetSystemTick();
+        g_timingClock.unix_ns = seconds * 1000000000ULL;
+    }
+}
+
+bool timingCalibrateWallClock(void)
+{
+    u64 first, seconds;
+    if (!timingSampleWallClock(&first))
+        return false;
+
+    // Polled every millisecond until the second changes, the time service only has seconds
+    u64 deadline = armGetSystemTick() + timingNsToTicks(1100000000ULL);
+    do {
+        svcSleepThread(1000000);
+        if (!timingSampleWallClock(&seconds))
+            return false;
+    } while (seconds == first && armGetSystemTick() < deadline);
+
+    if (seconds == first)
+        return false;
+    g_timingClock.unix_tick = armGetSystemTick();
+    g_timingClock.unix_ns = seconds * 1000000000ULL;
+    return true;
+}
@@ -0,0 +1,360 @@
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+
+#include "trace.h"
+
+typedef struct {
+    const char* name;
+    u64 start, end;
+} TraceEvent;
+
+typedef struct TraceThread TraceThread;
+struct TraceThread {
+    TraceThread* next;                // Never changes once the buffer is in the list
+    u64 tid;
+    const char* name;                 // Of traceSetThreadName
+    bool name_written;                // Only used by the thread
+
+    // Only used by the owner
+    u32 depth;
+    const char* open_names[TRACE_MAX_DEPTH];
+    u64 open_starts[TRACE_MAX_DEPTH]; // 0 for spans begun while disabled
+
+    u32 head;                         // Written by the owner
+    u32 tail;                         // Written by the thread
+    u64 dropped;
+    TraceEvent events[TRACE_BUFFER_EVENTS];
+};
+
+static TraceThread* s_threads;
+static bool s_running, s_enabled;
+static u32 s_generation;              // Of the current traceInit, the buffers of another one are stale
+static u64 s_baseTick;
+
+static __thread TraceThread* t_thread;
+static __thread u32 t_generation;
+
+static Thread s_thread;
+static UEvent s_exitEvent;
+static FILE* s_file;
+static int s_sock = -1;
+static bool s_writeFailed;
+static bool s_firstEvent;
+static char s_out[0x4000];
+static size_t s_outFill;
+
+static TraceThread* traceCurThread(void)
+{
+    if (!__atomic_load_n(&s_running, __ATOMIC_ACQUIRE) || t_generation != __atomic_load_n(&s_generation, __ATOMIC_RELAXED))
+        return NULL;
+    return t_thread;
+}
+
+// The buffer of the calling thread, added to the list the first time
+static TraceThread* traceGetThread(void)
+{
+    TraceThread* t = traceCurThread();
+    if (t || !__atomic_load_n(&s_running, __ATOMIC_ACQUIRE))
+        return t;
+
+    t = (TraceThread*)calloc(1, sizeof(TraceThread));
+    if (!t)
+        return NULL;
+    if (R_FAILED(svcGetThreadId(&t->tid, threadGetCurHandle())))
+        t->tid = (uintptr_t)t;
+
+    t->next = __atomic_load_n(&s_threads, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&s_threads, &t->next, t, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    t_thread = t;
+    t_generation = __atomic_load_n(&s_generation, __ATOMIC_RELAXED);
+    return t;
+}
+
+void traceBegin(const char* name)
+{
+    bool enabled = __atomic_load_n(&s_enabled, __ATOMIC_RELAXED);
+    // Disabled, a thread without a buffer doesn't need one: its traceEnd is ignored the same way
+    TraceThread* t = enabled ? traceGetThread() : traceCurThread();
+    if (!t)
+        return;
+
+    if (t->depth < TRACE_MAX_DEPTH) {
+        t->open_names[t->depth] = name;
+        t->open_starts[t->depth] = enabled ? armGetSystemTick() : 0;
+    }
+    t->depth++;
+}
+
+void traceEnd(void)
+{
+    TraceThread* t = traceCurThread();
+    if (!t || !t->depth)
+        return;
+
+    u32 depth = --t->depth;
+    if (depth >= TRACE_MAX_DEPTH) {
+        __atomic_add_fetch(&t->dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    if (!t->open_starts[depth])
+        return;
+
+    u64 end = armGetSystemTick();
+    u32 head = t->head;
+    if (head - __atomic_load_n(&t->tail, __ATOMIC_ACQUIRE) >= TRACE_BUFFER_EVENTS) {
+        __atomic_add_fetch(&t->dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    TraceEvent* ev = &t->events[head % TRACE_BUFFER_EVENTS];
+    ev->name = t->open_names[depth];
+    ev->start = t->open_starts[depth];
+    ev->end = end;
+    __atomic_store_n(&t->head, head + 1, __ATOMIC_RELEASE);
+}
+
+void traceSetEnabled(bool enabled)
+{
+    __atomic_store_n(&s_enabled, enabled, __ATOMIC_RELAXED);
+}
+
+bool traceIsEnabled(void)
+{
+    return __atomic_load_n(&s_enabled, __ATOMIC_RELAXED);
+}
+
+void traceSetThreadName(const char* name)
+{
+    TraceThread* t = traceGetThread();
+    if (t)
+        __atomic_store_n(&t->name, name, __ATOMIC_RELEASE);
+}
+
+u64 traceGetDropped(void)
+{
+    u64 dropped = 0;
+    for (TraceThread* t = __atomic_load_n(&s_threads, __ATOMIC_ACQUIRE); t; t = t->next)
+        dropped += __atomic_load_n(&t->dropped, __ATOMIC_RELAXED);
+    return dropped;
+}
+
+static void traceOutFlush(void)
+{
+    // Once writing failed, the buffers are still emptied so that spans are dropped rather than piling up
+    if (s_file) {
+        if (!s_writeFailed && fwrite(s_out, 1, s_outFill, s_file) != s_outFill)
+            s_writeFailed = true;
+    }
+    else {
+        for (size_t off = 0; off < s_outFill && !s_writeFailed;) {
+            ssize_t ret = send(s_sock, &s_out[off], s_outFill - off, 0);
+            if (ret <= 0)
+                s_writeFailed = true;
+            else
+                off += ret;
+        }
+    }
+    s_outFill = 0;
+}
+
+static void traceOut(const char* data, size_t size)
+{
+    while (size) {
+        if (s_outFill == sizeof(s_out))
+            traceOutFlush();
+        size_t n = sizeof(s_out) - s_outFill;
+        if (n > size)
+            n = size;
+        memcpy(&s_out[s_outFill], data, n);
+        s_outFill += n;
+        data += n;
+        size -= n;
+    }
+}
+
+static void traceOutString(const char* str)
+{
+    char buf[128];
+    size_t len = 0;
+    for (; *str; str++) {
+        if (len > sizeof(buf) - 2) {
+            traceOut(buf, len);
+            len = 0;
+        }
+        if (*str == '"' || *str == '\\')
+            buf[len++] = '\\';
+        if ((u8)*str >= 0x20)
+            buf[len++] = *str;
+    }
+    traceOut(buf, len);
+}
+
+// Starts an event, with its separator. Events are a single JSON array.
+static void traceOutEventStart(void)
+{
+    if (s_firstEvent)
+        s_firstEvent = false;
+    else
+        traceOut(",\n", 2);
+}
+
+// Microseconds, with the nanoseconds as decimals
+static void traceOutTime(const char* key, u64 ticks)
+{
+    char buf[48];
+    u64 ns = armTicksToNs(ticks);
+    int len = snprintf(buf, sizeof(buf), ",\"%s\":%" PRIu64 ".%03u", key, ns / 1000, (u32)(ns % 1000));
+    traceOut(buf, len);
+}
+
+static void traceDrain(void)
+{
+    char buf[64];
+    int len;
+
+    for (TraceThread* t = __atomic_load_n(&s_threads, __ATOMIC_ACQUIRE); t; t = t->next) {
+        const char* name = __atomic_load_n(&t->name, __ATOMIC_ACQUIRE);
+        if (name && !t->name_written) {
+            traceOutEventStart();
+            len = snprintf(buf, sizeof(buf), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%" PRIu64, t->tid);
+            traceOut(buf, len);
+            traceOut(",\"args\":{\"name\":\"", 17);
+            traceOutString(name);
+            traceOut("\"}}", 3);
+            t->name_written = true;
+        }
+
+        u32 head = __atomic_load_n(&t->head, __ATOMIC_ACQUIRE);
+        for (u32 pos = t->tail; pos != head; pos++) {
+            const TraceEvent* ev = &t->events[pos % TRACE_BUFFER_EVENTS];
+            traceOutEventStart();
+            traceOut("{\"name\":\"", 9);
+            traceOutString(ev->name);
+            len = snprintf(buf, sizeof(buf), "\",\"ph\":\"X\",\"pid\":0,\"tid\":%" PRIu64, t->tid);
+            traceOut(buf, len);
+            traceOutTime("ts", ev->start - s_baseTick);
+            traceOutTime("dur", ev->end - ev->start);
+            traceOut("}", 1);
+        }
+        __atomic_store_n(&t->tail, head, __ATOMIC_RELEASE);
+    }
+
+    traceOutFlush();
+}
+
+static void traceThreadFunc(void* arg)
+{
+    for (;;) {
+        // Signaled on exit, timing out otherwise
+        Result rc = waitSingle(waiterForUEvent(&s_exitEvent), TRACE_FLUSH_INTERVAL_MS * 1000000ULL);
+        traceDrain();
+        if (R_SUCCEEDED(rc))
+            break;
+    }
+}
+
+static bool traceOpenNxlink(void)
+{
+    // Only set when started through nxlink
+    if (__nxlink_host.s_addr == 0)
+        return false;
+
+    s_sock = socket(AF_INET, SOCK_STREAM, 0);
+    if (s_sock < 0)
+        return false;
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(TRACE_PORT);
+    addr.sin_addr = __nxlink_host;
+    if (connect(s_sock, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+        close(s_sock);
+        s_sock = -1;
+        return false;
+    }
+    return true;
+}
+
+static void traceClose(void)
+{
+    if (s_file)
+        fclose(s_file);
+    if (s_sock >= 0)
+        close(s_sock);
+    s_file = NULL;
+    s_sock = -1;
+}
+
+bool traceInit(const char* path)
+{
+    if (s_running)
+        return false;
+
+    if (path) {
+        s_file = fopen(path, "w");
+        if (!s_file)
+            return false;
+    }
+    else if (!traceOpenNxlink())
+        return false;
+
+    s_writeFailed = false;
+    s_firstEvent = true;
+    s_outFill = 0;
+    const char* header = "{\"traceEvents\":[\n";
+    traceOut(header, strlen(header));
+
+    ueventCreate(&s_exitEvent, false);
+
+    // Below everything else, it only has to keep up on average
+    Result rc = threadCreate(&s_thread, traceThreadFunc, NULL, NULL, 0x4000, 0x3B, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&s_thread);
+        if (R_FAILED(rc))
+            threadClose(&s_thread);
+    }
+    if (R_FAILED(rc)) {
+        traceClose();
+        return false;
+    }
+
+    s_baseTick = armGetSystemTick();
+    __atomic_add_fetch(&s_generation, 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&s_enabled, true, __ATOMIC_RELAXED);
+    __atomic_store_n(&s_running, true, __ATOMIC_RELEASE);
+    return true;
+}
+
+void traceExit(void)
+{
+    if (!s_running)
+        return;
+
+    __atomic_store_n(&s_enabled, false, __ATOMIC_RELAXED);
+    __atomic_store_n(&s_running, false, __ATOMIC_RELEASE);
+
+    // The thread writes what's left before exiting
+    ueventSignal(&s_exitEvent);
+    threadWaitForExit(&s_thread);
+    threadClose(&s_thread);
+
+    const char* footer = "\n],\"displayTimeUnit\":\"ns\"}\n";
+    traceOut(footer, strlen(footer));
+    traceOutFlush();
+    traceClose();
+
+    TraceThread* t = s_threads;
+    s_threads = NULL;
+    while (t) {
+        TraceThread* next = t->next;
+        free(t);
+        t = next;
+    }
+}
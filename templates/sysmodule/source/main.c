@@ -6,21 +6,46 @@
 // Include the main libnx system header, for Switch development
 #include <switch.h>
 
+#include "server.h"
+#include "slab_heap.h"
+
+// This template runs a small line-based TCP server, see server.h. Connect with e.g. `nc <switch ip> 6000`: lines are
+// echoed back, "stats" shows the server stats, "heap" the slab heap stats, and "quit" closes the connection. Replace
+// on_data with your protocol.
+#define SERVER_PORT 6000
+
+// psc module acknowledging sleep/wake, so that the sockets are closed before sleep and reopened after. Any id which
+// isn't used by the system works.
+#define PSC_MODULE_ID 0x7E
+
 // Sysmodules should not use applet*.
 u32 __nx_applet_type = AppletType_None;
 // Sysmodules will normally only want to use one FS session.
 u32 __nx_fs_num_sessions = 1;
 
-// Adjust size as needed.
+// Adjust size as needed. With the config below, sockets take about 0x5000 of it, and the server 0xC000.
 #define INNER_HEAP_SIZE 0x80000
 size_t nx_inner_heap_size = INNER_HEAP_SIZE;
 char   nx_inner_heap[INNER_HEAP_SIZE];
 
+// The end of the inner heap is given to a slab heap (see slab_heap.h), for what the sysmodule allocates while running:
+// unlike newlib's heap, it doesn't fragment over weeks of uptime. Set to 0 to give all of it to newlib.
+#define SLAB_HEAP_SIZE 0x20000
+
+#if SLAB_HEAP_SIZE
+static SlabHeap s_slabHeap;
+#endif
+
 void __libnx_initheap(void)
 {
 	void*  addr = nx_inner_heap;
 	size_t size = nx_inner_heap_size;
 
+#if SLAB_HEAP_SIZE
+	size -= SLAB_HEAP_SIZE;
+	slab_heap_init(&s_slabHeap, (char*)addr + size, SLAB_HEAP_SIZE);
+#endif
+
 	// Newlib
 	extern char* fake_heap_start;
 	extern char* fake_heap_end;
@@ -29,6 +54,25 @@ void __libnx_initheap(void)
 	fake_heap_end   = (char*)addr + size;
 }
 
+// Small socket buffers: the transfer memory given to bsd comes out of the heap, and socketInitializeDefault()'s needs
+// a few MiB. One bsd session is enough for a single thread.
+static const SocketInitConfig s_socketInitConfig = {
+    .bsdsockets_version = 1,
+
+    .tcp_tx_buf_size = 0x800,
+    .tcp_rx_buf_size = 0x800,
+    .tcp_tx_buf_max_size = 0x2000,
+    .tcp_rx_buf_max_size = 0x2000,
+
+    .udp_tx_buf_size = 0x400,
+    .udp_rx_buf_size = 0x400,
+
+    .sb_efficiency = 1,
+
+    .num_bsd_sessions = 1,
+    .bsd_service_type = BsdServiceType_Auto,
+};
+
 // Init/exit services, update as needed.
 void __attribute__((weak)) __appInit(void)
 {
@@ -56,6 +100,14 @@ void __attribute__((weak)) __appInit(void)
         fatalThrow(MAKERESULT(Module_Libnx, LibnxError_InitFail_FS));
 
     fsdevMountSdmc();
+
+    rc = socketInitialize(&s_socketInitConfig);
+    if (R_FAILED(rc))
+        fatalThrow(MAKERESULT(Module_Libnx, LibnxError_InitFail_BSD));
+
+    rc = pscmInitialize();
+    if (R_FAILED(rc))
+        fatalThrow(rc);
 }
 
 void __attribute__((weak)) userAppExit(void);
@@ -63,6 +115,8 @@ void __attribute__((weak)) userAppExit(void);
 void __attribute__((weak)) __appExit(void)
 {
     // Cleanup default services.
+    pscmExit();
+    socketExit();
     fsdevUnmountAll();
     fsExit();
     //timeExit();//Enable this if you want to use time.
@@ -70,14 +124,93 @@ void __attribute__((weak)) __appExit(void)
     smExit();
 }
 
+static size_t on_data(Server* s, ServerClient* c, const u8* data, size_t size, void* user)
+{
+    size_t used = 0;
+    for (;;) {
+        const u8* end = memchr(data + used, '\n', size - used);
+        if (!end)
+            break;
+
+        const char* line = (const char*)data + used;
+        size_t len = end - (data + used);
+        used += len + 1;
+        if (len && line[len - 1] == '\r')
+            len--;
+
+        if (len == 4 && memcmp(line, "quit", 4) == 0) {
+            server_close_client(s, c);
+            break;
+        }
+
+        if (len == 5 && memcmp(line, "stats", 5) == 0) {
+            char buf[160];
+            int n = snprintf(buf, sizeof(buf), "clients %u, accepted %lu, rejected %lu, closed idle %lu/overflow %lu\n",
+                s->num_clients, s->stats.accepted, s->stats.rejected, s->stats.closed_idle, s->stats.closed_overflow);
+            if (!server_send(s, c, buf, n))
+                break;
+            continue;
+        }
+
+#if SLAB_HEAP_SIZE
+        if (len == 4 && memcmp(line, "heap", 4) == 0) {
+            SlabHeapStats stats;
+            slab_heap_get_stats(&s_slabHeap, &stats);
+            char buf[160];
+            int n = snprintf(buf, sizeof(buf), "slab heap: %zu bytes in use, pages %u free/%u (lowest %u), %lu failures\n",
+                stats.bytes_in_use, stats.free_pages, stats.total_pages, stats.min_free_pages, stats.failures);
+            if (!server_send(s, c, buf, n))
+                break;
+            continue;
+        }
+#endif
+
+        if (!server_send(s, c, line, len) || !server_send(s, c, "\n", 1))
+            break;
+    }
+    return used;
+}
+
+static void on_pm_event(Server* s, void* user)
+{
+    PscPmModule* module = (PscPmModule*)user;
+    PscPmState state;
+    u32 flags;
+    if (R_FAILED(pscPmModuleGetRequest(module, &state, &flags)))
+        return;
+
+    // The connections don't survive sleep
+    if (state == PscPmState_ReadySleep)
+        server_close_all(s);
+    else if (state == PscPmState_ReadyAwaken)
+        server_listen(s, SERVER_PORT);
+
+    pscPmModuleAcknowledge(module, state);
+}
+
 // Main program entrypoint
 int main(int argc, char* argv[])
 {
     // Initialization code can go here.
+    static Server server;
+    if (!server_init(&server, on_data, NULL))
+        return 1;
+    server_listen(&server, SERVER_PORT);
+
+    PscPmModule pm_module;
+    bool pm = R_SUCCEEDED(pscmGetPmModule(&pm_module, (PscPmModuleId)PSC_MODULE_ID, NULL, 0, true));
+    if (pm)
+        server_add_waiter(&server, waiterForEvent(&pm_module.event), on_pm_event, &pm_module);
 
     // Your code / main loop goes here.
-    // If you need threads, you can use threadCreate etc.
+    // Everything runs from this thread, in the callbacks of the server.
+    server_run(&server);
 
     // Deinitialization and resources clean up code can go here.
+    if (pm) {
+        pscPmModuleFinalize(&pm_module);
+        pscPmModuleClose(&pm_module);
+    }
+    server_exit(&server);
     return 0;
 }
@@ -0,0 +1,268 @@
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+
+#include "server.h"
+
+static bool server_set_nonblocking(int fd)
+{
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags != -1 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) != -1;
+}
+
+bool server_init(Server* s, ServerDataFn on_data, void* user)
+{
+    memset(s, 0, sizeof(*s));
+    s->listen_fd = -1;
+    s->on_data = on_data;
+    s->user = user;
+
+    // All of it up front: once running, the server never allocates
+    s->buffers = (u8*)malloc(SERVER_MAX_CLIENTS * (SERVER_RX_BUF_SIZE + SERVER_TX_BUF_SIZE));
+    if (!s->buffers)
+        return false;
+
+    for (u32 i = 0; i < SERVER_MAX_CLIENTS; i++) {
+        ServerClient* c = &s->clients[i];
+        c->fd = -1;
+        c->rx = s->buffers + i * (SERVER_RX_BUF_SIZE + SERVER_TX_BUF_SIZE);
+        c->tx = c->rx + SERVER_RX_BUF_SIZE;
+    }
+    return true;
+}
+
+void server_exit(Server* s)
+{
+    server_close_all(s);
+    free(s->buffers);
+    s->buffers = NULL;
+}
+
+bool server_listen(Server* s, u16 port)
+{
+    if (s->listen_fd >= 0)
+        return true;
+
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0)
+        return false;
+
+    int optval = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &optval, sizeof(optval));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 4) != 0 || !server_set_nonblocking(fd)) {
+        close(fd);
+        return false;
+    }
+
+    s->listen_fd = fd;
+    return true;
+}
+
+void server_close_client(Server* s, ServerClient* c)
+{
+    if (c->fd < 0)
+        return;
+    close(c->fd);
+    c->fd = -1;
+    s->num_clients--;
+}
+
+void server_close_all(Server* s)
+{
+    for (u32 i = 0; i < SERVER_MAX_CLIENTS; i++)
+        server_close_client(s, &s->clients[i]);
+
+    if (s->listen_fd >= 0) {
+        close(s->listen_fd);
+        s->listen_fd = -1;
+    }
+}
+
+bool server_add_waiter(Server* s, Waiter waiter, ServerEventFn fn, void* user)
+{
+    if (s->num_waiters == SERVER_MAX_WAITERS)
+        return false;
+    s->waiters[s->num_waiters] = waiter;
+    s->event_fns[s->num_waiters] = fn;
+    s->event_users[s->num_waiters] = user;
+    s->num_waiters++;
+    return true;
+}
+
+void server_stop(Server* s)
+{
+    s->exit = true;
+}
+
+// Sends as much of the send buffer as the socket takes
+static void server_flush(Server* s, ServerClient* c)
+{
+    size_t off = 0;
+    while (off < c->tx_len) {
+        ssize_t ret = send(c->fd, c->tx + off, c->tx_len - off, MSG_DONTWAIT);
+        if (ret <= 0)
+            break;
+        off += ret;
+    }
+
+    if (off) {
+        memmove(c->tx, c->tx + off, c->tx_len - off);
+        c->tx_len -= off;
+        s->stats.bytes_sent += off;
+    }
+}
+
+bool server_send(Server* s, ServerClient* c, const void* data, size_t size)
+{
+    if (c->fd < 0)
+        return false;
+
+    if (size > SERVER_TX_BUF_SIZE - c->tx_len) {
+        // The client doesn't read, don't let it hold the slot
+        s->stats.closed_overflow++;
+        server_close_client(s, c);
+        return false;
+    }
+
+    memcpy(c->tx + c->tx_len, data, size);
+    c->tx_len += size;
+    server_flush(s, c);
+    return true;
+}
+
+static void server_accept(Server* s)
+{
+    for (;;) {
+        int fd = accept(s->listen_fd, NULL, NULL);
+        if (fd < 0)
+            break;
+
+        ServerClient* c = NULL;
+        for (u32 i = 0; i < SERVER_MAX_CLIENTS && !c; i++) {
+            if (s->clients[i].fd < 0)
+                c = &s->clients[i];
+        }
+
+        if (!c || !server_set_nonblocking(fd)) {
+            close(fd);
+            s->stats.rejected++;
+            continue;
+        }
+
+        c->fd = fd;
+        c->id = ++s->next_id;
+        c->rx_len = c->tx_len = 0;
+        c->last_tick = armGetSystemTick();
+        s->num_clients++;
+        s->stats.accepted++;
+    }
+}
+
+static void server_receive(Server* s, ServerClient* c)
+{
+    ssize_t ret = recv(c->fd, c->rx + c->rx_len, SERVER_RX_BUF_SIZE - c->rx_len, MSG_DONTWAIT);
+    if (ret == 0 || (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        server_close_client(s, c);
+        return;
+    }
+    if (ret < 0)
+        return;
+
+    c->rx_len += ret;
+    c->last_tick = armGetSystemTick();
+    s->stats.bytes_received += ret;
+
+    size_t used = s->on_data(s, c, c->rx, c->rx_len, s->user);
+    if (c->fd < 0)
+        return; // Closed by the callback
+
+    if (used > c->rx_len)
+        used = c->rx_len;
+    memmove(c->rx, c->rx + used, c->rx_len - used);
+    c->rx_len -= used;
+
+    // A request larger than the buffer can never complete
+    if (c->rx_len == SERVER_RX_BUF_SIZE) {
+        s->stats.closed_overflow++;
+        server_close_client(s, c);
+    }
+}
+
+void server_run(Server* s)
+{
+    struct pollfd pfds[1 + SERVER_MAX_CLIENTS];
+    ServerClient* pclients[1 + SERVER_MAX_CLIENTS];
+    const u64 idle_timeout = armNsToTicks(SERVER_IDLE_TIMEOUT_MS * 1000000ULL);
+
+    s->exit = false;
+    while (!s->exit) {
+        nfds_t count = 0;
+        if (s->listen_fd >= 0) {
+            pfds[count] = (struct pollfd){ .fd = s->listen_fd, .events = POLLIN };
+            pclients[count++] = NULL;
+        }
+        for (u32 i = 0; i < SERVER_MAX_CLIENTS; i++) {
+            ServerClient* c = &s->clients[i];
+            if (c->fd < 0)
+                continue;
+            pfds[count] = (struct pollfd){ .fd = c->fd, .events = POLLIN | (c->tx_len ? POLLOUT : 0) };
+            pclients[count++] = c;
+        }
+
+        // Nothing to poll while the sockets are closed (e.g. asleep), only the waiters
+        int ret = 0;
+        if (count)
+            ret = poll(pfds, count, SERVER_POLL_TIMEOUT_MS);
+
+        for (nfds_t i = 0; ret > 0 && i < count; i++) {
+            short revents = pfds[i].revents;
+            if (!revents)
+                continue;
+
+            ServerClient* c = pclients[i];
+            if (!c) {
+                server_accept(s);
+                continue;
+            }
+
+            if (revents & POLLOUT)
+                server_flush(s, c);
+            if (c->fd >= 0 && (revents & POLLIN))
+                server_receive(s, c);
+            if (c->fd >= 0 && (revents & (POLLERR | POLLHUP | POLLNVAL)) && !(revents & POLLIN))
+                server_close_client(s, c);
+        }
+
+        u64 now = armGetSystemTick();
+        for (u32 i = 0; i < SERVER_MAX_CLIENTS; i++) {
+            ServerClient* c = &s->clients[i];
+            if (c->fd >= 0 && now - c->last_tick > idle_timeout) {
+                s->stats.closed_idle++;
+                server_close_client(s, c);
+            }
+        }
+
+        // Every signaled waiter, without blocking, or for the poll timeout when there are no sockets.
+        // waitObjects is waitMulti over an array.
+        u64 timeout = count ? 0 : SERVER_POLL_TIMEOUT_MS * 1000000ULL;
+        s32 idx;
+        while (s->num_waiters && !s->exit && R_SUCCEEDED(waitObjects(&idx, s->waiters, s->num_waiters, timeout))) {
+            s->event_fns[idx](s, s->event_users[idx]);
+            timeout = 0;
+        }
+        if (!count && !s->num_waiters)
+            svcSleepThread(SERVER_POLL_TIMEOUT_MS * 1000000ULL);
+    }
+}
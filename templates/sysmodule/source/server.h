@@ -0,0 +1,80 @@
+#pragma once
+#include <switch.h>
+
+// Single-threaded TCP server for sysmodules.
+//
+// A sysmodule has a small fixed heap, so there is no thread and no allocation per connection: the connection table has
+// a fixed size, and the receive and send buffers of all the slots are allocated once by server_init. server_run polls
+// the listening socket and the connections with poll, with a short timeout, and in between checks the waiters added
+// with server_add_waiter (events of other services, e.g. sleep/wake from psc) without blocking.
+//
+// Data received on a connection is handed to the ServerDataFn, which returns how much of it it used, the rest is kept
+// for the next call. A connection that doesn't send anything for SERVER_IDLE_TIMEOUT_MS is closed, as is one whose
+// receive buffer is full without the callback using any of it, or whose send buffer overflows.
+
+#define SERVER_MAX_CLIENTS 16
+#define SERVER_RX_BUF_SIZE 0x400
+#define SERVER_TX_BUF_SIZE 0x800
+#define SERVER_MAX_WAITERS 4
+#define SERVER_POLL_TIMEOUT_MS 20         // Latency of the waiters, at worst
+#define SERVER_IDLE_TIMEOUT_MS 60000
+
+typedef struct Server Server;
+
+typedef struct {
+    int fd;                               // -1 when the slot is free
+    u32 id;
+    u8* rx;
+    u8* tx;
+    size_t rx_len, tx_len;
+    u64 last_tick;
+} ServerClient;
+
+typedef size_t (*ServerDataFn)(Server* s, ServerClient* c, const u8* data, size_t size, void* user);
+// Called when the waiter is signaled. Events which aren't autoclear must be cleared by it.
+typedef void (*ServerEventFn)(Server* s, void* user);
+
+typedef struct {
+    u64 accepted, rejected;               // Rejected when the table was full
+    u64 closed_idle, closed_overflow;
+    u64 bytes_received, bytes_sent;
+} ServerStats;
+
+struct Server {
+    int listen_fd;
+    u8* buffers;
+    ServerClient clients[SERVER_MAX_CLIENTS];
+    u32 num_clients;
+    u32 next_id;
+
+    ServerDataFn on_data;
+    void* user;
+
+    Waiter waiters[SERVER_MAX_WAITERS];
+    ServerEventFn event_fns[SERVER_MAX_WAITERS];
+    void* event_users[SERVER_MAX_WAITERS];
+    u32 num_waiters;
+
+    bool exit;
+    ServerStats stats;
+};
+
+// Allocates the buffers of all the slots, returns false if they don't fit in the heap
+bool server_init(Server* s, ServerDataFn on_data, void* user);
+void server_exit(Server* s);
+
+// Opens the listening socket, on all addresses
+bool server_listen(Server* s, u16 port);
+// Closes all the connections and the listening socket, e.g. before sleep
+void server_close_all(Server* s);
+
+bool server_add_waiter(Server* s, Waiter waiter, ServerEventFn fn, void* user);
+
+// Runs the event loop until server_stop is called, from one of the callbacks
+void server_run(Server* s);
+void server_stop(Server* s);
+
+// Queues data on the connection and sends what it can right away. Returns false, and closes the connection, if the
+// send buffer overflows.
+bool server_send(Server* s, ServerClient* c, const void* data, size_t size);
+void server_close_client(Server* s, ServerClient* c);
@@ -0,0 +1,263 @@
+#include <string.h>
+
+#include "slab_heap.h"
+
+static const u16 s_class_sizes[SLAB_HEAP_NUM_CLASSES] = { 16, 32, 48, 64, 96, 128, 192, 256, 512, 1024, 2048 };
+
+static u32 slab_heap_class_of(size_t size)
+{
+    u32 cls = 0;
+    while (s_class_sizes[cls] < size)
+        cls++;
+    return cls;
+}
+
+static u32 slab_heap_blocks_per_page(u32 cls)
+{
+    return SLAB_HEAP_PAGE_SIZE / s_class_sizes[cls];
+}
+
+static u8* slab_heap_page_addr(SlabHeap* h, u32 page)
+{
+    return h->base + (size_t)page * SLAB_HEAP_PAGE_SIZE;
+}
+
+void slab_heap_init(SlabHeap* h, void* mem, size_t size)
+{
+    memset(h, 0, sizeof(*h));
+    mutexInit(&h->mutex);
+
+    uintptr_t start = ((uintptr_t)mem + 15) & ~(uintptr_t)15;
+    uintptr_t end = (uintptr_t)mem + size;
+    u32 num_pages = end > start ? (end - start) / (SLAB_HEAP_PAGE_SIZE + sizeof(SlabPage)) : 0;
+    if (num_pages > SLAB_HEAP_NONE)
+        num_pages = SLAB_HEAP_NONE;
+
+    // The table comes first, the pages after it are page-aligned: fewer of them may fit than estimated
+    uintptr_t base;
+    for (;; num_pages--) {
+        base = (start + num_pages * sizeof(SlabPage) + SLAB_HEAP_PAGE_SIZE - 1) & ~(uintptr_t)(SLAB_HEAP_PAGE_SIZE - 1);
+        if (!num_pages || base + (uintptr_t)num_pages * SLAB_HEAP_PAGE_SIZE <= end)
+            break;
+    }
+
+    h->pages = (SlabPage*)start;
+    h->base = (u8*)base;
+    h->num_pages = num_pages;
+    for (u32 i = 0; i < num_pages; i++)
+        h->pages[i].cls = SlabPageType_Free;
+    for (u32 cls = 0; cls < SLAB_HEAP_NUM_CLASSES; cls++) {
+        h->partial[cls] = SLAB_HEAP_NONE;
+        h->stats.classes[cls].block_size = s_class_sizes[cls];
+    }
+
+    h->stats.total_pages = num_pages;
+    h->stats.free_pages = num_pages;
+    h->stats.min_free_pages = num_pages;
+}
+
+static void slab_heap_take_pages(SlabHeap* h, u32 count)
+{
+    h->stats.free_pages -= count;
+    if (h->stats.free_pages < h->stats.min_free_pages)
+        h->stats.min_free_pages = h->stats.free_pages;
+}
+
+static void slab_heap_list_push(SlabHeap* h, u32 cls, u32 index)
+{
+    SlabPage* page = &h->pages[index];
+    page->prev = SLAB_HEAP_NONE;
+    page->next = h->partial[cls];
+    if (page->next != SLAB_HEAP_NONE)
+        h->pages[page->next].prev = index;
+    h->partial[cls] = index;
+}
+
+static void slab_heap_list_remove(SlabHeap* h, u32 cls, u32 index)
+{
+    SlabPage* page = &h->pages[index];
+    if (page->prev != SLAB_HEAP_NONE)
+        h->pages[page->prev].next = page->next;
+    else
+        h->partial[cls] = page->next;
+    if (page->next != SLAB_HEAP_NONE)
+        h->pages[page->next].prev = page->prev;
+}
+
+static void* slab_heap_alloc_small(SlabHeap* h, u32 cls)
+{
+    u32 index = h->partial[cls];
+    if (index == SLAB_HEAP_NONE) {
+        // A new page for the class, from the top
+        for (index = h->num_pages; index-- > 0;) {
+            if (h->pages[index].cls == SlabPageType_Free)
+                break;
+        }
+        if (index == (u32)-1)
+            return NULL;
+
+        SlabPage* page = &h->pages[index];
+        page->cls = cls;
+        page->in_use = 0;
+        page->free_block = SLAB_HEAP_NONE;
+        page->bump = 0;
+        slab_heap_list_push(h, cls, index);
+        slab_heap_take_pages(h, 1);
+        h->stats.classes[cls].pages++;
+    }
+
+    SlabPage* page = &h->pages[index];
+    u8* page_addr = slab_heap_page_addr(h, index);
+    u32 block = page->free_block;
+    if (block != SLAB_HEAP_NONE)
+        page->free_block = *(u16*)(page_addr + block * s_class_sizes[cls]);
+    else
+        block = page->bump++;
+
+    if (++page->in_use == slab_heap_blocks_per_page(cls))
+        slab_heap_list_remove(h, cls, index);
+    h->stats.classes[cls].blocks_in_use++;
+    h->stats.classes[cls].allocs++;
+    return page_addr + block * s_class_sizes[cls];
+}
+
+static void* slab_heap_alloc_run(SlabHeap* h, size_t size)
+{
+    u32 count = (size + SLAB_HEAP_PAGE_SIZE - 1) / SLAB_HEAP_PAGE_SIZE;
+
+    // First fit, from the bottom
+    for (u32 start = 0, len = 0; start + len < h->num_pages;) {
+        if (h->pages[start + len].cls != SlabPageType_Free) {
+            start += len + 1;
+            len = 0;
+            continue;
+        }
+        if (++len < count)
+            continue;
+
+        h->pages[start].cls = SlabPageType_Run;
+        h->pages[start].in_use = count;
+        for (u32 i = 1; i < count; i++)
+            h->pages[start + i].cls = SlabPageType_RunTail;
+        slab_heap_take_pages(h, count);
+        h->stats.large_allocs++;
+        h->stats.large_pages += count;
+        return slab_heap_page_addr(h, start);
+    }
+    return NULL;
+}
+
+void* slab_heap_alloc(SlabHeap* h, size_t size)
+{
+    if (!size || size > (size_t)h->num_pages * SLAB_HEAP_PAGE_SIZE)
+        return NULL;
+
+    mutexLock(&h->mutex);
+    void* ptr = size <= SLAB_HEAP_MAX_SMALL ? slab_heap_alloc_small(h, slab_heap_class_of(size)) : slab_heap_alloc_run(h, size);
+    if (!ptr)
+        h->stats.failures++;
+    mutexUnlock(&h->mutex);
+    return ptr;
+}
+
+void* slab_heap_calloc(SlabHeap* h, size_t count, size_t size)
+{
+    if (size && count > SIZE_MAX / size)
+        return NULL;
+    void* ptr = slab_heap_alloc(h, count * size);
+    if (ptr)
+        memset(ptr, 0, count * size);
+    return ptr;
+}
+
+// Index of the page holding ptr, SLAB_HEAP_NONE if it isn't the start of a block of the heap (that isn't a free page)
+static u32 slab_heap_page_of(SlabHeap* h, const void* ptr)
+{
+    uintptr_t offset = (uintptr_t)ptr - (uintptr_t)h->base;
+    if ((uintptr_t)ptr < (uintptr_t)h->base || offset >= (uintptr_t)h->num_pages * SLAB_HEAP_PAGE_SIZE || (offset & 15))
+        return SLAB_HEAP_NONE;
+
+    u32 index = offset / SLAB_HEAP_PAGE_SIZE;
+    u8 cls = h->pages[index].cls;
+    if (cls == SlabPageType_Free || cls == SlabPageType_RunTail)
+        return SLAB_HEAP_NONE;
+    if (cls == SlabPageType_Run)
+        return offset % SLAB_HEAP_PAGE_SIZE ? SLAB_HEAP_NONE : index;
+
+    u32 in_page = offset % SLAB_HEAP_PAGE_SIZE;
+    if (in_page % s_class_sizes[cls] || in_page / s_class_sizes[cls] >= h->pages[index].bump)
+        return SLAB_HEAP_NONE;
+    return index;
+}
+
+void slab_heap_free(SlabHeap* h, void* ptr)
+{
+    if (!ptr)
+        return;
+
+    mutexLock(&h->mutex);
+    u32 index = slab_heap_page_of(h, ptr);
+    if (index == SLAB_HEAP_NONE) {
+        // Not from this heap: ignored rather than corrupting the lists
+        mutexUnlock(&h->mutex);
+        return;
+    }
+
+    SlabPage* page = &h->pages[index];
+    if (page->cls == SlabPageType_Run) {
+        u32 count = page->in_use;
+        for (u32 i = 0; i < count; i++)
+            h->pages[index + i].cls = SlabPageType_Free;
+        h->stats.free_pages += count;
+        h->stats.large_allocs--;
+        h->stats.large_pages -= count;
+        mutexUnlock(&h->mutex);
+        return;
+    }
+
+    u32 cls = page->cls;
+    u32 block = ((uintptr_t)ptr - (uintptr_t)slab_heap_page_addr(h, index)) / s_class_sizes[cls];
+    *(u16*)ptr = page->free_block;
+    page->free_block = block;
+    if (page->in_use-- == slab_heap_blocks_per_page(cls))
+        slab_heap_list_push(h, cls, index);
+    h->stats.classes[cls].blocks_in_use--;
+    h->stats.classes[cls].frees++;
+
+    // An empty page goes back to the free pages, unless it's the last partial page of its class: a block allocated and
+    // freed over and over doesn't take and give back a page each time
+    if (!page->in_use && (h->partial[cls] != index || page->next != SLAB_HEAP_NONE)) {
+        slab_heap_list_remove(h, cls, index);
+        page->cls = SlabPageType_Free;
+        h->stats.free_pages++;
+        h->stats.classes[cls].pages--;
+    }
+    mutexUnlock(&h->mutex);
+}
+
+size_t slab_heap_usable_size(SlabHeap* h, const void* ptr)
+{
+    if (!ptr)
+        return 0;
+
+    mutexLock(&h->mutex);
+    u32 index = slab_heap_page_of(h, ptr);
+    size_t size = 0;
+    if (index != SLAB_HEAP_NONE) {
+        const SlabPage* page = &h->pages[index];
+        size = page->cls == SlabPageType_Run ? (size_t)page->in_use * SLAB_HEAP_PAGE_SIZE : s_class_sizes[page->cls];
+    }
+    mutexUnlock(&h->mutex);
+    return size;
+}
+
+void slab_heap_get_stats(SlabHeap* h, SlabHeapStats* out)
+{
+    mutexLock(&h->mutex);
+    *out = h->stats;
+    mutexUnlock(&h->mutex);
+
+    out->bytes_in_use = (size_t)out->large_pages * SLAB_HEAP_PAGE_SIZE;
+    for (u32 cls = 0; cls < SLAB_HEAP_NUM_CLASSES; cls++)
+        out->bytes_in_use += (size_t)out->classes[cls].blocks_in_use * out->classes[cls].block_size;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <switch.h>
+
+// Size-class allocator over a fixed region, for sysmodules which run for weeks on a small heap.
+//
+// The region is split into pages of SLAB_HEAP_PAGE_SIZE. An allocation up to SLAB_HEAP_MAX_SMALL bytes is rounded up to
+// its size class, and comes from a page holding only blocks of that class: each page has its own free list, and the
+// pages of a class with free blocks are on a list of their own. A page whose blocks are all freed goes back to the free
+// pages, for any class to use. Larger allocations take runs of whole pages. Small pages are taken from the top of the
+// region and runs from the bottom, so that runs aren't cut by small pages.
+//
+// Blocks of a class only ever reuse the pages of that class, and pages are given back whole, so that what a class holds
+// never grows past the peak of its own usage, whatever the order of allocations and frees: a service with a steady
+// working set stays in the same memory for weeks, where a general-purpose heap slowly fragments until a large
+// allocation fails. The cost is the rounding to a class, and the free blocks left in partially used pages. Blocks are
+// 16-byte aligned. All functions are thread safe.
+//
+// The sysmodule template gives part of its inner heap to newlib (libnx and the sockets allocate from it) and the rest
+// to a slab heap, see main.c.
+
+#define SLAB_HEAP_PAGE_SIZE 0x1000
+#define SLAB_HEAP_NUM_CLASSES 11
+#define SLAB_HEAP_MAX_SMALL 2048
+#define SLAB_HEAP_NONE 0xFFFF               // End of a page or block list
+
+typedef enum {
+    SlabPageType_Free = 0xFF,
+    SlabPageType_Run = 0xFE,                // First page of a run
+    SlabPageType_RunTail = 0xFD,            // Other pages of a run
+} SlabPageType;
+
+typedef struct {
+    u8 cls;                                 // Size class, or one of the SlabPageType values
+    u8 pad;
+    u16 in_use;                             // Blocks allocated, or length of the run
+    u16 free_block;                         // Index of the first free block, SLAB_HEAP_NONE if none
+    u16 bump;                               // Index of the first block never allocated
+    u16 prev, next;                         // In the list of partial pages of the class
+} SlabPage;
+
+typedef struct {
+    u32 block_size;
+    u32 blocks_in_use;
+    u32 pages;
+    u64 allocs, frees;
+} SlabHeapClassStats;
+
+typedef struct {
+    SlabHeapClassStats classes[SLAB_HEAP_NUM_CLASSES];
+    u32 total_pages;
+    u32 free_pages;
+    u32 min_free_pages;                     // Lowest it has been since slab_heap_init
+    u32 large_allocs;                       // In use
+    u32 large_pages;
+    size_t bytes_in_use;                    // Rounded to classes and pages
+    u64 failures;
+} SlabHeapStats;
+
+typedef struct {
+    Mutex mutex;
+    u8* base;                               // Of the first page
+    SlabPage* pages;
+    u32 num_pages;
+    u16 partial[SLAB_HEAP_NUM_CLASSES];     // First partial page of each class
+    SlabHeapStats stats;
+} SlabHeap;
+
+// The page table is taken from the start of mem
+void slab_heap_init(SlabHeap* h, void* mem, size_t size);
+
+// NULL if there's no room, or for 0 bytes
+void* slab_heap_alloc(SlabHeap* h, size_t size);
+void* slab_heap_calloc(SlabHeap* h, size_t count, size_t size);
+// ptr may be NULL
+void slab_heap_free(SlabHeap* h, void* ptr);
+// What the block could hold, at least what was asked for
+size_t slab_heap_usable_size(SlabHeap* h, const void* ptr);
+
+void slab_heap_get_stats(SlabHeap* h, SlabHeapStats* out);
@@ -7,22 +7,121 @@
 // Include the main libnx system header, for Switch development
 #include <switch.h>
 
+#include "usb_devices.h"
+
 // This example shows how to use USB devices via usbhs, see also libnx usbhs.h/usb.h.
 // Only devices which are not used by sysmodules are usable. This example will only detect/use USB mass storage devices.
+// Devices are acquired and released as they are plugged in and out (see usb_devices.c), several of them can be used
+// at once. For each one, after the inquiry, the read throughput is measured with one large SCSI READ(10), whose data
+// is received by several transfers kept outstanding at once (see usb_xfer.c).
+
+// Transfers kept outstanding on the INPUT endpoint, and their size.
+#define BENCH_URBS 4
+#define BENCH_XFER_SIZE 0x10000
+// Largest read done by the benchmark.
+#define BENCH_MAX_SIZE 0x1000000
+
+// Sends a mass-storage Command Block Wrapper for a SCSI command reading data_size bytes, see the USB Mass Storage Class Bulk-Only Transport spec.
+Result bot_send_command(UsbHsClientEpSession *ep_out, u8 *tmpbuf, u32 tag, const u8 *cdb, u8 cdb_size, u32 data_size) {
+    u32 transferredSize=0;
+    memset(tmpbuf, 0, 0x1000);
+    memcpy(tmpbuf, "USBC", 4);
+    memcpy(&tmpbuf[4], &tag, 4);
+    memcpy(&tmpbuf[8], &data_size, 4);
+    tmpbuf[12] = 0x80; // Data from the device.
+    tmpbuf[14] = cdb_size;
+    memcpy(&tmpbuf[15], cdb, cdb_size);
+    return usbHsEpPostBuffer(ep_out, tmpbuf, 31, &transferredSize);
+}
+
+// Reads the Command Status Wrapper which ends each command, returns its status (0 when the command succeeded).
+Result bot_read_status(UsbHsClientEpSession *ep_in, u8 *tmpbuf) {
+    u32 transferredSize=0;
+    memset(tmpbuf, 0, 0x1000);
+    Result rc = usbHsEpPostBuffer(ep_in, tmpbuf, 0x200, &transferredSize);
+    if (R_SUCCEEDED(rc) && (transferredSize != 13 || memcmp(tmpbuf, "USBS", 4) != 0)) rc = 3;
+    if (R_SUCCEEDED(rc)) rc = tmpbuf[12];
+    return rc;
+}
+
+// Runs a command with a data phase of up to 0x200 bytes, which ends up in tmpbuf.
+Result bot_read_command(UsbDevice *dev, u8 *tmpbuf, u32 tag, const u8 *cdb, u8 cdb_size, u32 data_size, u32 *transferredSize) {
+    Result rc = bot_send_command(&dev->ep_out, tmpbuf, tag, cdb, cdb_size, data_size);
+    if (R_SUCCEEDED(rc)) {
+        memset(tmpbuf, 0, 0x1000);
+        *transferredSize = 0;
+        rc = usbHsEpPostBuffer(&dev->ep_in, tmpbuf, 0x200, transferredSize);
+    }
+    return rc;
+}
+
+// Starts reading up to BENCH_MAX_SIZE bytes from the start of the device, with BENCH_URBS transfers outstanding.
+// The read goes on in the background, see the main loop.
+void bench_start(UsbDevice *dev, u8 *tmpbuf) {
+    u32 transferredSize=0, tmpi;
+
+    // SCSI Inquiry.
+    static const u8 inquiry[6] = {0x12, 0x00, 0x00, 0x00, 0x24, 0x00};
+    Result rc = bot_read_command(dev, tmpbuf, 1, inquiry, sizeof(inquiry), 0x24, &transferredSize);
+    printf("Inquiry returned: 0x%x, transferredSize=0x%x\n", rc, transferredSize);
+    if (R_SUCCEEDED(rc)) {
+        for(tmpi=0; tmpi<transferredSize; tmpi++)printf("%02X", tmpbuf[tmpi]);
+        printf("\n");
+        rc = bot_read_status(&dev->ep_in, tmpbuf);
+    }
+
+    // READ CAPACITY(10), for the block size and count.
+    static const u8 read_capacity[10] = {0x25};
+    if (R_SUCCEEDED(rc)) rc = bot_read_command(dev, tmpbuf, 2, read_capacity, sizeof(read_capacity), 8, &transferredSize);
+    if (R_SUCCEEDED(rc) && transferredSize != 8) rc = 4;
+    u32 block_count = 0, block_size = 0;
+    if (R_SUCCEEDED(rc)) {
+        block_count = ((tmpbuf[0]<<24) | (tmpbuf[1]<<16) | (tmpbuf[2]<<8) | tmpbuf[3]) + 1;
+        block_size = (tmpbuf[4]<<24) | (tmpbuf[5]<<16) | (tmpbuf[6]<<8) | tmpbuf[7];
+        rc = bot_read_status(&dev->ep_in, tmpbuf);
+    }
+    if (R_SUCCEEDED(rc) && (block_size == 0 || block_size > BENCH_MAX_SIZE)) rc = 5;
+    printf("READ CAPACITY returned: 0x%x, %u blocks of %u bytes\n", rc, block_count, block_size);
+    if (R_FAILED(rc)) return;
+
+    u32 blocks = BENCH_MAX_SIZE / block_size;
+    if (blocks > block_count) blocks = block_count;
+    if (blocks > 0xFFFF) blocks = 0xFFFF;
+    u32 size = blocks * block_size;
+
+    // READ(10) from LBA 0, the data phase is received by the transfer engine of the device.
+    u8 read10[10] = {0x28, 0, 0, 0, 0, 0, 0, blocks>>8, blocks & 0xFF, 0};
+    rc = bot_send_command(&dev->ep_out, tmpbuf, 3, read10, sizeof(read10), size);
+    if (R_SUCCEEDED(rc)) rc = usb_xfer_start(&dev->xfer, &dev->ep_in, true, BENCH_URBS, BENCH_XFER_SIZE, size, NULL, NULL, NULL);
+    dev->xfer_active = R_SUCCEEDED(rc);
+    if (R_FAILED(rc)) printf("Starting the read failed: 0x%x\n", rc);
+}
+
+void on_attach(void *user, UsbDevice *dev) {
+    UsbDeviceManager *manager = (UsbDeviceManager*)user;
+    UsbHsInterface *inf = &dev->session.inf;
+
+    printf("Attached %04x:%04x at %s in %lu us, config descriptor %s:\n", inf->device_desc.idVendor, inf->device_desc.idProduct,
+        inf->pathstr, armTicksToNs(dev->attach_ticks) / 1000, dev->config_cached ? "cached" : "read");
+    for(u32 i=0; i<dev->config.config_size; i++)printf("%02X", dev->config.config_desc[i]);
+    printf("\n");
+
+    if (dev->ep_out_open && dev->ep_in_open)
+        bench_start(dev, manager->tmpbuf);
+    else
+        printf("Failed to find the required endpoints.\n");
+}
+
+void on_detach(void *user, UsbDevice *dev) {
+    printf("Detached %s%s.\n", dev->session.inf.pathstr, dev->xfer_active ? ", while reading" : "");
+}
 
 // Main program entrypoint
 int main(int argc, char* argv[])
 {
-    Result rc=0, rc2=0;
-    s32 total_entries=0;
-    s32 i, epi, tmpi;
-    Event inf_event;
-    struct usb_endpoint_descriptor *ep_desc = NULL;
-    UsbHsClientIfSession inf_session; // This example only uses 1 interface and 2 endpoints, an actual app may differ.
-    UsbHsClientEpSession ep_sessions[2];
+    Result rc=0;
     UsbHsInterfaceFilter filter;
-    UsbHsInterface interfaces[8];
-    bool endpoints_found[2];
+    static UsbDeviceManager manager;
 
     // This example uses a text console, as a simple way to output text to the screen.
     // If you want to write a software-rendered graphics application,
@@ -33,11 +132,7 @@ int main(int argc, char* argv[])
 
     printf("usbhs example\n");
 
-    memset(&inf_event, 0, sizeof(inf_event));
     memset(&filter, 0, sizeof(filter));
-    memset(interfaces, 0, sizeof(interfaces));
-    memset(&inf_session, 0, sizeof(inf_session));
-    memset(&ep_sessions, 0, sizeof(ep_sessions));
 
     // See libnx usbhs.h regarding filtering. Flags has to be set, since [7.0.0+] doesn't allow using a filter struct which matches an existing one.
     filter.Flags = UsbHsInterfaceFilterFlags_bInterfaceClass;
@@ -46,14 +141,15 @@ int main(int argc, char* argv[])
     rc = usbHsInitialize();
     if (R_FAILED(rc)) printf("usbHsInitialize() failed: 0x%x\n", rc);
 
+    // The endpoints of each device are opened for BENCH_URBS outstanding transfers of BENCH_XFER_SIZE, used by bench_start.
+    bool manager_ok = false;
     if (R_SUCCEEDED(rc)) {
-        rc = usbHsCreateInterfaceAvailableEvent(&inf_event, true, 0, &filter);
-       if (R_FAILED(rc)) printf("usbHsCreateInterfaceAvailableEvent() failed: 0x%x\n", rc);
+        rc = usb_devices_init(&manager, &filter, BENCH_URBS, BENCH_XFER_SIZE, on_attach, on_detach, &manager);
+        if (R_FAILED(rc)) printf("usb_devices_init() failed: 0x%x\n", rc);
+        manager_ok = R_SUCCEEDED(rc);
     }
 
-    if (R_SUCCEEDED(rc)) printf("Ready.\n");
-
-    rc2=rc;
+    if (manager_ok) printf("Ready, plug in up to %d mass storage devices.\n", USB_DEVICES_MAX);
 
     // Main loop
     while (appletMainLoop())
@@ -68,149 +164,23 @@ int main(int argc, char* argv[])
         if (kDown & KEY_PLUS)
             break; // break in order to return to hbmenu
 
-        if (R_SUCCEEDED(rc2)) rc = eventWait(&inf_event, 0);
-        if (R_SUCCEEDED(rc2) && R_SUCCEEDED(rc)) {
-            printf("The available interfaces have changed.\n");
-
-            memset(interfaces, 0, sizeof(interfaces));
-            rc = usbHsQueryAvailableInterfaces(&filter, interfaces, sizeof(interfaces), &total_entries);
-            if (R_FAILED(rc)) printf("usbHsQueryAvailableInterfaces() failed: 0x%x\n", rc);
-
-            if (R_SUCCEEDED(rc)) {
-                printf("total: %d\n", total_entries);
-                for(i=0; i<total_entries; i++) {
-                    printf("%d: pathstr = %s\n", i, interfaces[i].pathstr);//Run any interfaces[i] processing here.
-
-                    // You can verify whether this is an interface you want to use by checking the content of interfaces[i], or do so later via control transfers etc.
-
-                    rc = usbHsAcquireUsbIf(&inf_session, &interfaces[i]);
-                    printf("usbHsAcquireUsbIf(interface index = %d) returned: 0x%x\n", i, rc);
-                    if (R_SUCCEEDED(rc)) {
-                        u8* tmpbuf = memalign(0x1000, 0x1000);// The allocated buffer address/size must be 0x1000-byte aligned, for usbHsIfCtrlXfer/usbHsEpPostBuffer.
-
-                        if (tmpbuf) {
-                            u32 transferredSize=0;
-
-                            // Note that an actual app may want to validate that transferredSize==<input size>.
-
-                            // This shows how to use a control transfer, an actual app might not need this.
-                            // This gets descriptors starting with the config descriptor, via a control transfer.
-                            memset(tmpbuf, 0, 0x1000);
-                            rc = usbHsIfCtrlXfer(&inf_session, USB_ENDPOINT_IN, USB_REQUEST_GET_DESCRIPTOR, (USB_DT_CONFIG<<8) | 0, 0, 0x40, tmpbuf, &transferredSize);
-                            printf("usbHsIfCtrlXfer(interface index = %d) returned: 0x%x, transferredSize=0x%x\n", i, rc, transferredSize);
-                            if (R_SUCCEEDED(rc)) {
-                                for(tmpi=0; tmpi<transferredSize; tmpi++)printf("%02X", tmpbuf[tmpi]);
-                                printf("\n");
-                            }
-
-                            rc = 1;
-
-                            // Locate any endpoints you want to use by going through input_endpoint_descs/output_endpoint_descs.
-                            // Note that official sw uses control transfer(s) to get the descriptors (see above).
-                            // This example uses 1 OUTPUT and INPUT endpoint, with an actual app this may differ.
-                            memset(endpoints_found, 0, sizeof(endpoints_found));
-                            for(epi=0; epi<15; epi++) {
-                                ep_desc = &inf_session.inf.inf.output_endpoint_descs[epi];
-                                if (ep_desc->bLength != 0 && ep_desc->bEndpointAddress == (USB_ENDPOINT_OUT | 0x1)) {
-                                    printf("Using OUTPUT endpoint %d.\n", epi);
-
-                                    endpoints_found[0] = true;
-                                    rc = usbHsIfOpenUsbEp(&inf_session, &ep_sessions[0], 1, ep_desc->wMaxPacketSize, ep_desc);
-                                    printf("usbHsIfOpenUsbEp returned: 0x%x\n", rc);
-                                    if (R_FAILED(rc)) break;
-                                }
-
-                                ep_desc = &inf_session.inf.inf.input_endpoint_descs[epi];
-                                if (ep_desc->bLength != 0 && ep_desc->bEndpointAddress == (USB_ENDPOINT_IN | 0x2)) {
-                                    printf("Using INPUT endpoint %d.\n", epi);
-
-                                    endpoints_found[1] = true;
-                                    rc = usbHsIfOpenUsbEp(&inf_session, &ep_sessions[1], 1, ep_desc->wMaxPacketSize, ep_desc);
-                                    printf("usbHsIfOpenUsbEp returned: 0x%x\n", rc);
-                                    if (R_FAILED(rc)) break;
-                                }
-
-                                if (endpoints_found[0] && endpoints_found[1]) break;
-                            }
-
-                            if (!endpoints_found[0] || !endpoints_found[1]) {
-                                printf("Failed to find the required endpoints.\n");
-                                rc = 2;
-                            }
-
-                            // Use the endpoints. An actual app would have different endpoint handling, depending on the USB device.
-
-                            // Write data to the OUTPUT endpoint. In this case this is a mass-storage SCSI Inquiry.
-                            // Note that an actual app may want to validate transferredSize.
-                            if (R_SUCCEEDED(rc)) {
-                                memset(tmpbuf, 0, 0x1000);
-
-                                u8 tmpdata[] = {0x55, 0x53, 0x42, 0x43, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x80, 0x00, 0x06, 0x12, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-                                memcpy(tmpbuf, tmpdata, sizeof(tmpdata));
-
-                                transferredSize = 0;
-                                rc = usbHsEpPostBuffer(&ep_sessions[0], tmpbuf, sizeof(tmpdata), &transferredSize);
-                                printf("usbHsEpPostBuffer returned: 0x%x, transferredSize=0x%x\n", rc, transferredSize);
-                            }
-
-                            // Read data from the INPUT endpoint. In this case this is mass-storage SCSI Inquiry response data.
-                            // Note that an actual app may want to validate transferredSize.
-                            if (R_SUCCEEDED(rc)) {
-                                memset(tmpbuf, 0, 0x1000);
-
-                                transferredSize = 0;
-                                rc = usbHsEpPostBuffer(&ep_sessions[1], tmpbuf, 0x200, &transferredSize);
-                                printf("usbHsEpPostBuffer returned: 0x%x, transferredSize=0x%x\n", rc, transferredSize);
-                                if (R_SUCCEEDED(rc)) {
-                                    for(tmpi=0; tmpi<transferredSize; tmpi++)printf("%02X", tmpbuf[tmpi]);
-                                    printf("\n");
-                                }
-                            }
-
-                            // At this point this example is done using the endpoints, close these.
-                            usbHsEpClose(&ep_sessions[0]);
-                            usbHsEpClose(&ep_sessions[1]);
-
-                            free(tmpbuf);
-                        }
-                        else
-                            printf("tmpbuf alloc failed.\n");
-
-                        usbHsIfClose(&inf_session); // At this point this example is done using the interface, close it.
-                    }
-                }
-            }
-        }
+        if (manager_ok) {
+            // Acquires the new devices and releases the ones which were unplugged, never blocks.
+            usb_devices_update(&manager);
 
-        // Signaled when a device was removed, cleanup state if our interface can't be found in the usbHsQueryAcquiredInterfaces output.
-        if (R_SUCCEEDED(rc2)) rc = eventWait(usbHsGetInterfaceStateChangeEvent(), 0);
-        if (R_SUCCEEDED(rc2) && R_SUCCEEDED(rc)) {
-            eventClear(usbHsGetInterfaceStateChangeEvent());
-
-            printf("InterfaceStateChangeEvent was signaled.\n");
-
-            // Only need to check the rest of this if our interface is actually initialized. This won't actually run since this example already closed the interface above.
-            if (usbHsIfIsActive(&inf_session)) {
-                memset(interfaces, 0, sizeof(interfaces));
-                rc = usbHsQueryAcquiredInterfaces(interfaces, sizeof(interfaces), &total_entries);
-                if (R_FAILED(rc)) printf("usbHsQueryAcquiredInterfaces() failed: 0x%x\n", rc);
-
-                if (R_SUCCEEDED(rc)) {
-                    bool found_flag = 0;
-                    for(i=0; i<total_entries; i++) {
-                        if (usbHsIfGetID(&inf_session) == interfaces[i].inf.ID) {
-                            found_flag = 1;
-                            break;
-                        }
-                    }
-
-                    if(!found_flag) {
-                        printf("Interface not found, cleaning up state...\n");
-                        usbHsEpClose(&ep_sessions[0]);
-                        usbHsEpClose(&ep_sessions[1]);
-                        usbHsIfClose(&inf_session);
-                    }
-                }
+            // Reads which finished since the previous frame.
+            for (u32 i=0; i<USB_DEVICES_MAX; i++) {
+                UsbDevice *dev = &manager.devices[i];
+                if (!dev->active || !dev->xfer_active || !usb_xfer_wait(&dev->xfer, 0))
+                    continue;
+
+                printf("%s: read 0x%lx bytes in %u transfers of up to 0x%x, %u outstanding: %.2f MB/s, result 0x%x\n",
+                    dev->session.inf.pathstr, dev->xfer.transferred, dev->xfer.completed, dev->xfer.buf_size, dev->xfer.num_urbs,
+                    usb_xfer_get_rate(&dev->xfer), dev->xfer.error);
+
+                bool ok = R_SUCCEEDED(dev->xfer.error);
+                usb_device_stop_xfer(dev);
+                if (ok) printf("READ(10) status: 0x%x\n", bot_read_status(&dev->ep_in, manager.tmpbuf));
             }
         }
 
@@ -218,9 +188,8 @@ int main(int argc, char* argv[])
         consoleUpdate(NULL);
     }
 
-    // Make sure to cleanup interface/endpoint state before exiting, if it's not already closed.
-
-    usbHsDestroyInterfaceAvailableEvent(&inf_event, 0);
+    // Make sure to cleanup interface/endpoint state before exiting.
+    if (manager_ok) usb_devices_exit(&manager);
     usbHsExit();
 
     // Deinitialize and clean up resources used by the console (important!)
@@ -0,0 +1,219 @@
+#include <string.h>
+#include <malloc.h>
+
+#include "usb_devices.h"
+
+static UsbDeviceConfig* usb_devices_cache_find(UsbDeviceManager* m, const UsbHsInterface* inf)
+{
+    for (u32 i = 0; i < m->cache_count; i++) {
+        UsbDeviceConfig* c = &m->cache[i];
+        if (c->idVendor == inf->device_desc.idVendor && c->idProduct == inf->device_desc.idProduct &&
+            strncmp(c->pathstr, inf->pathstr, sizeof(c->pathstr)) == 0)
+            return c;
+    }
+    return NULL;
+}
+
+// Reads the config descriptor, and picks the endpoints to use
+static UsbDeviceConfig* usb_devices_cache_add(UsbDeviceManager* m, UsbDevice* dev)
+{
+    const UsbHsInterface* inf = &dev->session.inf;
+    u32 transferredSize = 0;
+
+    // Header first, for the total size of the config descriptor and the descriptors which follow it.
+    memset(m->tmpbuf, 0, 0x1000);
+    Result rc = usbHsIfCtrlXfer(&dev->session, USB_ENDPOINT_IN, USB_REQUEST_GET_DESCRIPTOR, (USB_DT_CONFIG<<8) | 0, 0, 9, m->tmpbuf, &transferredSize);
+    if (R_FAILED(rc) || transferredSize < 9)
+        return NULL;
+
+    u32 total = m->tmpbuf[2] | (m->tmpbuf[3] << 8);
+    if (total > USB_DEVICES_CONFIG_MAX) total = USB_DEVICES_CONFIG_MAX;
+    rc = usbHsIfCtrlXfer(&dev->session, USB_ENDPOINT_IN, USB_REQUEST_GET_DESCRIPTOR, (USB_DT_CONFIG<<8) | 0, 0, total, m->tmpbuf, &transferredSize);
+    if (R_FAILED(rc))
+        return NULL;
+
+    // Replaces the oldest entry once full
+    UsbDeviceConfig* c = &m->cache[m->cache_next];
+    m->cache_next = (m->cache_next + 1) % USB_DEVICES_CACHE_SIZE;
+    if (m->cache_count < USB_DEVICES_CACHE_SIZE)
+        m->cache_count++;
+
+    memset(c, 0, sizeof(*c));
+    c->idVendor = inf->device_desc.idVendor;
+    c->idProduct = inf->device_desc.idProduct;
+    strncpy(c->pathstr, inf->pathstr, sizeof(c->pathstr) - 1);
+    c->config_size = transferredSize < total ? transferredSize : total;
+    memcpy(c->config_desc, m->tmpbuf, c->config_size);
+
+    // The first bulk endpoint of each direction.
+    c->ep_out_index = c->ep_in_index = -1;
+    for (s32 i = 0; i < 15; i++) {
+        const struct usb_endpoint_descriptor* ep_desc = &inf->inf.output_endpoint_descs[i];
+        if (c->ep_out_index < 0 && ep_desc->bLength != 0 && (ep_desc->bmAttributes & USB_TRANSFER_TYPE_MASK) == USB_TRANSFER_TYPE_BULK)
+            c->ep_out_index = i;
+
+        ep_desc = &inf->inf.input_endpoint_descs[i];
+        if (c->ep_in_index < 0 && ep_desc->bLength != 0 && (ep_desc->bmAttributes & USB_TRANSFER_TYPE_MASK) == USB_TRANSFER_TYPE_BULK)
+            c->ep_in_index = i;
+    }
+    return c;
+}
+
+static void usb_devices_release(UsbDeviceManager* m, UsbDevice* dev)
+{
+    if (m->on_detach)
+        m->on_detach(m->user, dev);
+
+    usb_device_stop_xfer(dev);
+    if (dev->ep_out_open) usbHsEpClose(&dev->ep_out);
+    if (dev->ep_in_open) usbHsEpClose(&dev->ep_in);
+    usbHsIfClose(&dev->session);
+
+    memset(dev, 0, sizeof(*dev));
+    m->num_active--;
+}
+
+static void usb_devices_acquire(UsbDeviceManager* m, UsbHsInterface* inf)
+{
+    UsbDevice* dev = NULL;
+    for (u32 i = 0; i < USB_DEVICES_MAX && !dev; i++) {
+        if (!m->devices[i].active)
+            dev = &m->devices[i];
+    }
+    if (!dev)
+        return;
+
+    u64 start = armGetSystemTick();
+    memset(dev, 0, sizeof(*dev));
+    if (R_FAILED(usbHsAcquireUsbIf(&dev->session, inf)))
+        return;
+
+    const UsbDeviceConfig* config = usb_devices_cache_find(m, inf);
+    dev->config_cached = config != NULL;
+    if (config)
+        m->cache_hits++;
+    else
+        config = usb_devices_cache_add(m, dev);
+    if (config)
+        dev->config = *config;
+
+    Result rc = config ? 0 : 1;
+    if (R_SUCCEEDED(rc) && dev->config.ep_out_index >= 0) {
+        struct usb_endpoint_descriptor* ep_desc = &dev->session.inf.inf.output_endpoint_descs[dev->config.ep_out_index];
+        rc = usbHsIfOpenUsbEp(&dev->session, &dev->ep_out, m->max_urbs, m->max_xfer_size, ep_desc);
+        dev->ep_out_open = R_SUCCEEDED(rc);
+    }
+    if (R_SUCCEEDED(rc) && dev->config.ep_in_index >= 0) {
+        struct usb_endpoint_descriptor* ep_desc = &dev->session.inf.inf.input_endpoint_descs[dev->config.ep_in_index];
+        rc = usbHsIfOpenUsbEp(&dev->session, &dev->ep_in, m->max_urbs, m->max_xfer_size, ep_desc);
+        dev->ep_in_open = R_SUCCEEDED(rc);
+    }
+    if (R_FAILED(rc)) {
+        if (dev->ep_out_open) usbHsEpClose(&dev->ep_out);
+        usbHsIfClose(&dev->session);
+        memset(dev, 0, sizeof(*dev));
+        return;
+    }
+
+    dev->active = true;
+    dev->attach_ticks = armGetSystemTick() - start;
+    m->num_active++;
+
+    if (m->on_attach)
+        m->on_attach(m->user, dev);
+}
+
+Result usb_devices_init(UsbDeviceManager* m, const UsbHsInterfaceFilter* filter, u16 max_urbs, u32 max_xfer_size,
+    UsbDeviceCallback on_attach, UsbDeviceCallback on_detach, void* user)
+{
+    memset(m, 0, sizeof(*m));
+    m->filter = *filter;
+    m->max_urbs = max_urbs;
+    m->max_xfer_size = max_xfer_size;
+    m->on_attach = on_attach;
+    m->on_detach = on_detach;
+    m->user = user;
+
+    m->tmpbuf = (u8*)memalign(0x1000, 0x1000); // The buffer address/size must be 0x1000-byte aligned for usbHsIfCtrlXfer.
+    if (!m->tmpbuf)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+
+    Result rc = usbHsCreateInterfaceAvailableEvent(&m->available_event, true, 0, &m->filter);
+    if (R_FAILED(rc)) {
+        free(m->tmpbuf);
+        m->tmpbuf = NULL;
+        return rc;
+    }
+
+    // Interfaces plugged in before the event was created are picked up by the first update.
+    m->rescan = true;
+    return 0;
+}
+
+void usb_devices_exit(UsbDeviceManager* m)
+{
+    for (u32 i = 0; i < USB_DEVICES_MAX; i++) {
+        if (m->devices[i].active)
+            usb_devices_release(m, &m->devices[i]);
+    }
+
+    usbHsDestroyInterfaceAvailableEvent(&m->available_event, 0);
+    free(m->tmpbuf);
+    m->tmpbuf = NULL;
+}
+
+void usb_devices_update(UsbDeviceManager* m)
+{
+    UsbHsInterface interfaces[8];
+    s32 total_entries = 0;
+
+    // Interfaces which were released by the system: the devices were unplugged.
+    if (m->num_active && R_SUCCEEDED(eventWait(usbHsGetInterfaceStateChangeEvent(), 0))) {
+        eventClear(usbHsGetInterfaceStateChangeEvent());
+
+        memset(interfaces, 0, sizeof(interfaces));
+        if (R_SUCCEEDED(usbHsQueryAcquiredInterfaces(interfaces, sizeof(interfaces), &total_entries))) {
+            for (u32 i = 0; i < USB_DEVICES_MAX; i++) {
+                UsbDevice* dev = &m->devices[i];
+                if (!dev->active)
+                    continue;
+
+                bool found = false;
+                for (s32 j = 0; j < total_entries && !found; j++)
+                    found = usbHsIfGetID(&dev->session) == interfaces[j].inf.ID;
+                if (!found)
+                    usb_devices_release(m, dev);
+            }
+        }
+    }
+
+    // New interfaces, the ones already acquired aren't listed as available anymore.
+    if (m->rescan || R_SUCCEEDED(eventWait(&m->available_event, 0))) {
+        m->rescan = false;
+        memset(interfaces, 0, sizeof(interfaces));
+        if (R_SUCCEEDED(usbHsQueryAvailableInterfaces(&m->filter, interfaces, sizeof(interfaces), &total_entries))) {
+            for (s32 i = 0; i < total_entries && m->num_active < USB_DEVICES_MAX; i++)
+                usb_devices_acquire(m, &interfaces[i]);
+        }
+    }
+}
+
+void usb_device_stop_xfer(UsbDevice* dev)
+{
+    if (!dev->xfer_active)
+        return;
+
+    // Closing the endpoint cancels the transfers which are still pending, so that their buffers can be freed.
+    if (usb_xfer_stop(&dev->xfer)) {
+        if (dev->xfer.ep == &dev->ep_in && dev->ep_in_open) {
+            usbHsEpClose(&dev->ep_in);
+            dev->ep_in_open = false;
+        }
+        else if (dev->xfer.ep == &dev->ep_out && dev->ep_out_open) {
+            usbHsEpClose(&dev->ep_out);
+            dev->ep_out_open = false;
+        }
+    }
+    usb_xfer_free(&dev->xfer);
+    dev->xfer_active = false;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <switch.h>
+
+#include "usb_xfer.h"
+
+// Hotplug-aware manager for usbhs interfaces.
+//
+// usb_devices_update is called once per frame and never blocks: when the interface available event is signaled, the
+// new interfaces matching the filter are acquired (the ones already held are left alone), and when the interface state
+// change event is signaled, the interfaces which are gone are released. Each device gets its first bulk OUTPUT and
+// INPUT endpoints opened, and its own transfer engine.
+//
+// The config descriptor of each device is read with a control transfer the first time it's seen, then cached by
+// vendor/product id and port path, so that a device which is plugged back in is ready without it.
+
+#define USB_DEVICES_MAX 4
+#define USB_DEVICES_CACHE_SIZE 8
+#define USB_DEVICES_CONFIG_MAX 0x200
+
+typedef struct {
+    u16 idVendor, idProduct;
+    char pathstr[0x40];
+    u8 config_desc[USB_DEVICES_CONFIG_MAX];
+    u32 config_size;
+    s32 ep_out_index, ep_in_index; // Indices into output_endpoint_descs/input_endpoint_descs, -1 if there's none
+} UsbDeviceConfig;
+
+typedef struct UsbDevice {
+    bool active;
+    UsbHsClientIfSession session;
+    UsbHsClientEpSession ep_out, ep_in;
+    bool ep_out_open, ep_in_open;
+    UsbDeviceConfig config;        // Copied from the cache, which may replace the entry meanwhile
+    bool config_cached;            // The config descriptor came from the cache
+    u64 attach_ticks;              // Time taken to acquire and open the device
+
+    // Transfer context of the device, usb_xfer_start may be used on it directly
+    UsbXfer xfer;
+    bool xfer_active;
+
+    void* user;
+} UsbDevice;
+
+typedef void (*UsbDeviceCallback)(void* user, UsbDevice* dev);
+
+typedef struct {
+    UsbHsInterfaceFilter filter;
+    Event available_event;
+    bool rescan;
+    u16 max_urbs;                  // Endpoints are opened for this many outstanding transfers of max_xfer_size
+    u32 max_xfer_size;
+
+    UsbDevice devices[USB_DEVICES_MAX];
+    u32 num_active;
+
+    UsbDeviceConfig cache[USB_DEVICES_CACHE_SIZE];
+    u32 cache_count, cache_next;
+    u32 cache_hits;
+
+    UsbDeviceCallback on_attach;   // Called once the endpoints are open
+    UsbDeviceCallback on_detach;   // Called before the device is released, it may not be plugged in anymore
+    void* user;
+
+    // Shared by the control transfers, 0x1000-byte aligned
+    u8* tmpbuf;
+} UsbDeviceManager;
+
+// usbhs must be initialized
+Result usb_devices_init(UsbDeviceManager* m, const UsbHsInterfaceFilter* filter, u16 max_urbs, u32 max_xfer_size,
+    UsbDeviceCallback on_attach, UsbDeviceCallback on_detach, void* user);
+void usb_devices_exit(UsbDeviceManager* m);
+void usb_devices_update(UsbDeviceManager* m);
+
+// Stops the transfer of the device (if any) and frees its buffers
+void usb_device_stop_xfer(UsbDevice* dev);
@@ -0,0 +1,158 @@
+#include <string.h>
+#include <malloc.h>
+
+#include "usb_xfer.h"
+
+static void usb_xfer_post(UsbXfer* x)
+{
+    while (x->in_flight < x->num_urbs && !__atomic_load_n(&x->exit, __ATOMIC_ACQUIRE) && R_SUCCEEDED(x->error)) {
+        if (x->total && x->posted >= x->total)
+            break;
+
+        u32 i = x->next_post % x->num_urbs;
+        u32 size = x->buf_size;
+        if (x->total && x->total - x->posted < size)
+            size = x->total - x->posted;
+
+        if (!x->in && x->fill) {
+            size = x->fill(x->user, x->bufs[i], size);
+            if (size == 0) {
+                // Nothing more to send
+                x->total = x->posted;
+                break;
+            }
+        }
+
+        Result rc = usbHsEpPostBufferAsync(x->ep, x->bufs[i], size, 0, &x->xfer_ids[i]);
+        if (R_FAILED(rc)) {
+            x->error = rc;
+            break;
+        }
+
+        x->sizes[i] = size;
+        x->posted += size;
+        x->next_post++;
+        x->in_flight++;
+    }
+}
+
+static void usb_xfer_thread_func(void* arg)
+{
+    UsbXfer* x = (UsbXfer*)arg;
+    Event* xfer_event = usbHsEpGetXferEvent(x->ep);
+
+    x->start_tick = armGetSystemTick();
+    usb_xfer_post(x);
+
+    while (x->in_flight) {
+        // Once stopping, only wait a little for the outstanding transfers
+        bool stopping = __atomic_load_n(&x->exit, __ATOMIC_ACQUIRE);
+        s32 idx = -1;
+        Result rc = waitMulti(&idx, stopping ? 100000000ULL : UINT64_MAX, waiterForEvent(xfer_event),
+            waiterForUEvent(&x->exit_event));
+        if (R_FAILED(rc))
+            break;
+        if (idx != 0)
+            continue;
+
+        eventClear(xfer_event);
+
+        UsbHsXferReport reports[USB_XFER_MAX_URBS];
+        u32 count = 0;
+        memset(reports, 0, sizeof(reports));
+        rc = usbHsEpGetXferReport(x->ep, reports, x->num_urbs, &count);
+        if (R_FAILED(rc)) {
+            x->error = rc;
+            break;
+        }
+
+        // Transfers on one endpoint complete in the order they were posted
+        for (u32 r = 0; r < count && x->in_flight; r++) {
+            u32 i = x->next_complete % x->num_urbs;
+            if (reports[r].xferId != x->xfer_ids[i])
+                continue;
+
+            x->next_complete++;
+            x->in_flight--;
+            x->completed++;
+            x->transferred += reports[r].transferredSize;
+            if (R_FAILED(reports[r].res) && R_SUCCEEDED(x->error))
+                x->error = reports[r].res;
+
+            if (x->complete)
+                x->complete(x->user, x->bufs[i], reports[r].transferredSize, reports[r].res);
+        }
+
+        x->end_tick = armGetSystemTick();
+        usb_xfer_post(x);
+    }
+
+    ueventSignal(&x->done_event);
+}
+
+Result usb_xfer_start(UsbXfer* x, UsbHsClientEpSession* ep, bool in, u32 num_urbs, u32 buf_size, u64 total,
+    UsbXferComplete complete, UsbXferFill fill, void* user)
+{
+    memset(x, 0, sizeof(*x));
+    if (num_urbs == 0 || num_urbs > USB_XFER_MAX_URBS)
+        return MAKERESULT(Module_Libnx, LibnxError_BadInput);
+
+    x->ep = ep;
+    x->in = in;
+    x->num_urbs = num_urbs;
+    x->buf_size = (buf_size + 0xFFF) & ~0xFFF; // The buffer address/size must be 0x1000-byte aligned for usbHsEpPostBufferAsync.
+    x->total = total;
+    x->complete = complete;
+    x->fill = fill;
+    x->user = user;
+
+    x->mem = (u8*)memalign(0x1000, num_urbs * x->buf_size);
+    if (!x->mem)
+        return MAKERESULT(Module_Libnx, LibnxError_OutOfMemory);
+    memset(x->mem, 0, num_urbs * x->buf_size);
+    for (u32 i = 0; i < num_urbs; i++)
+        x->bufs[i] = x->mem + i * x->buf_size;
+
+    ueventCreate(&x->exit_event, true);
+    ueventCreate(&x->done_event, false);
+
+    // Above the main thread, so that the next transfer is posted as soon as one completes
+    Result rc = threadCreate(&x->thread, usb_xfer_thread_func, x, NULL, 0x4000, 0x2B, -2);
+    if (R_SUCCEEDED(rc)) {
+        rc = threadStart(&x->thread);
+        if (R_FAILED(rc))
+            threadClose(&x->thread);
+    }
+    if (R_FAILED(rc)) {
+        free(x->mem);
+        memset(x, 0, sizeof(*x));
+    }
+    return rc;
+}
+
+bool usb_xfer_wait(UsbXfer* x, u64 timeout)
+{
+    return R_SUCCEEDED(waitSingle(waiterForUEvent(&x->done_event), timeout));
+}
+
+u32 usb_xfer_stop(UsbXfer* x)
+{
+    __atomic_store_n(&x->exit, true, __ATOMIC_RELEASE);
+    ueventSignal(&x->exit_event);
+
+    threadWaitForExit(&x->thread);
+    threadClose(&x->thread);
+    return x->in_flight;
+}
+
+void usb_xfer_free(UsbXfer* x)
+{
+    free(x->mem);
+    x->mem = NULL;
+}
+
+double usb_xfer_get_rate(UsbXfer* x)
+{
+    u64 ns = armTicksToNs(x->end_tick - x->start_tick);
+    return ns ? x->transferred * 1000.0 / ns : 0.0;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <switch.h>
+
+// Asynchronous bulk transfer engine for one usbhs endpoint.
+//
+// Several transfers are kept outstanding with usbHsEpPostBufferAsync, each with its own 0x1000-byte aligned buffer,
+// so that the host controller always has a request queued when the previous one completes. A thread waits on the
+// transfer event of the endpoint, collects the completions with usbHsEpGetXferReport and posts the next transfers.
+//
+// The endpoint must have been opened with a maxUrbCount of at least num_urbs, and a maxXferSize of at least buf_size.
+
+#define USB_XFER_MAX_URBS 8
+
+// Called on the thread for each completed transfer, in the order they were posted.
+// For an IN endpoint buf holds the data received. For an OUT endpoint, see UsbXferFill.
+typedef void (*UsbXferComplete)(void* user, const u8* buf, u32 size, Result res);
+
+// Called on the thread to fill the buffer of the next OUT transfer, returns the size to send.
+typedef u32 (*UsbXferFill)(void* user, u8* buf, u32 size);
+
+typedef struct {
+    Thread thread;
+    UEvent exit_event;
+    UEvent done_event;            // Signaled when the whole transfer is done, or on error
+    UsbHsClientEpSession* ep;
+    bool in;
+    bool exit;
+
+    u8* mem;
+    u8* bufs[USB_XFER_MAX_URBS];
+    u32 xfer_ids[USB_XFER_MAX_URBS];
+    u32 sizes[USB_XFER_MAX_URBS];
+    u32 num_urbs, buf_size;
+    u32 next_post, next_complete; // Buffers are used round robin
+    u32 in_flight;
+
+    UsbXferComplete complete;
+    UsbXferFill fill;
+    void* user;
+
+    u64 total;                    // Bytes to transfer, 0 to go on until stopped
+    u64 posted;
+
+    // Written by the thread
+    u64 transferred;
+    u32 completed;
+    Result error;                 // First failed transfer, which stops the engine
+    u64 start_tick, end_tick;
+} UsbXfer;
+
+// Starts transferring total bytes in buf_size chunks (the last one may be shorter), keeping num_urbs of them
+// outstanding. fill is only used for an OUT endpoint, and may be NULL to send the buffers as they are, zeroed.
+Result usb_xfer_start(UsbXfer* x, UsbHsClientEpSession* ep, bool in, u32 num_urbs, u32 buf_size, u64 total,
+    UsbXferComplete complete, UsbXferFill fill, void* user);
+
+// Waits for the transfer to finish, returns false on timeout
+bool usb_xfer_wait(UsbXfer* x, u64 timeout);
+
+// Stops posting transfers and waits for the outstanding ones for up to 100ms, returns the number still pending
+u32 usb_xfer_stop(UsbXfer* x);
+
+// Frees the buffers. If transfers were still pending, close the endpoint first: that cancels them.
+void usb_xfer_free(UsbXfer* x);
+
+// Throughput of the completed transfers, in MB/s
+double usb_xfer_get_rate(UsbXfer* x);